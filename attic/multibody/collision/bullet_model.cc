@@ -390,6 +390,9 @@ void BulletModel::DoAddElement(const Element& element) {
       // does no cleanup.
       bt_collision_shapes_.push_back(move(bt_shape));
       bt_collision_shapes_.push_back(move(bt_shape_no_margin));
+
+      // The new object needs a broadphase AABB.
+      force_full_aabb_update_ = true;
     }
   }
 }
@@ -403,6 +406,7 @@ void BulletModel::DoRemoveElement(ElementId id) {
       world->bt_collision_objects.erase(itr);
     }
   }
+  moved_element_ids_.erase(id);
 }
 
 bool BulletModel::CollidingPointsCheckOnly(
@@ -475,19 +479,23 @@ bool BulletModel::UpdateElementWorldTransform(
   const bool element_exists(
       Model::UpdateElementWorldTransform(id, T_local_to_world));
   if (element_exists) {
-    btTransform btT = convert(elements[id]->getWorldTransform());
-
-    auto bt_obj_iter = bullet_world_.bt_collision_objects.find(id);
-    auto bt_obj_no_margin_iter =
-        bullet_world_no_margin_.bt_collision_objects.find(id);
-    if (bt_obj_iter != bullet_world_.bt_collision_objects.end()) {
-      bullet_world_.bt_collision_objects.at(id)->setWorldTransform(btT);
+    const btTransform btT = convert(elements[id]->getWorldTransform());
+
+    // Only write through (and schedule an AABB refresh) when the transform
+    // actually changed; stationary elements keep their broadphase entries
+    // untouched.
+    bool moved = false;
+    for (BulletCollisionWorldWrapper* world :
+         {&bullet_world_, &bullet_world_no_margin_}) {
+      const auto& itr = world->bt_collision_objects.find(id);
+      if (itr != world->bt_collision_objects.end() &&
+          !(itr->second->getWorldTransform() == btT)) {
+        itr->second->setWorldTransform(btT);
+        moved = true;
+      }
     }
-
-    if (bt_obj_no_margin_iter !=
-        bullet_world_no_margin_.bt_collision_objects.end()) {
-      bullet_world_no_margin_.bt_collision_objects.at(id)
-          ->setWorldTransform(btT);
+    if (moved) {
+      moved_element_ids_.insert(id);
     }
   }
   return element_exists;
@@ -507,8 +515,24 @@ void BulletModel::NotifyFilterCriteriaChanged(ElementId id) {
 }
 
 void BulletModel::UpdateModel() {
-  bullet_world_.bt_collision_world->updateAabbs();
-  bullet_world_no_margin_.bt_collision_world->updateAabbs();
+  if (force_full_aabb_update_) {
+    bullet_world_.bt_collision_world->updateAabbs();
+    bullet_world_no_margin_.bt_collision_world->updateAabbs();
+    force_full_aabb_update_ = false;
+  } else {
+    // The broadphase structures persist across steps; refresh the AABBs of
+    // just the elements that moved since the last update.
+    for (const ElementId id : moved_element_ids_) {
+      for (BulletCollisionWorldWrapper* world :
+           {&bullet_world_, &bullet_world_no_margin_}) {
+        const auto& itr = world->bt_collision_objects.find(id);
+        if (itr != world->bt_collision_objects.end()) {
+          world->bt_collision_world->updateSingleAabb(itr->second.get());
+        }
+      }
+    }
+  }
+  moved_element_ids_.clear();
 }
 
 PointPair<double> BulletModel::findClosestPointsBetweenElements(
@@ -845,9 +869,11 @@ bool BulletModel::ComputeMaximumDepthCollisionPoints(
   std::vector<double> distance;
   BulletCollisionWorldWrapper& bt_world = getBulletWorld(use_margins);
 
-  // This removes the "persistent" behavior of Bullet's manifolds allowing to
-  // perform a clean, from scratch, collision dispatch.
-  ClearCachedResults(use_margins);
+  if (!contact_manifold_caching_enabled_) {
+    // This removes the "persistent" behavior of Bullet's manifolds allowing
+    // to perform a clean, from scratch, collision dispatch.
+    ClearCachedResults(use_margins);
+  }
 
   // Internally updates AABB's calling btCollisionWorld::updateAabbs();
   // TODO(amcastro-tri): analyze if the call to BulletModel::updateModel() is
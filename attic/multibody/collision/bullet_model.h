@@ -3,6 +3,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "BulletCollision/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.h"
@@ -80,6 +81,24 @@ class BulletModel : public Model {
   bool ComputeMaximumDepthCollisionPoints(
       bool use_margins, std::vector<PointPair<double>>* points) override;
 
+  /**
+   * Enables or disables retention of Bullet's persistent per-pair contact
+   * manifolds across calls to ComputeMaximumDepthCollisionPoints().  When
+   * enabled, manifolds survive between steps so that persistent contacts
+   * (e.g. under RigidBodyPlant time stepping) start each dispatch from warm
+   * contact data instead of being re-discovered from scratch; Bullet
+   * refreshes the retained points each dispatch and prunes any that have
+   * drifted apart.  Disabled by default, preserving the historical one-shot
+   * dispatch behavior.
+   */
+  void set_contact_manifold_caching_enabled(bool enabled) {
+    contact_manifold_caching_enabled_ = enabled;
+  }
+
+  bool contact_manifold_caching_enabled() const {
+    return contact_manifold_caching_enabled_;
+  }
+
   /**
    * Finds the points where each pair of elements in id_pairs are
    * closest.  Inserts those points in closest_points.
@@ -185,6 +204,13 @@ class BulletModel : public Model {
   BulletCollisionWorldWrapper bullet_world_;
   BulletCollisionWorldWrapper bullet_world_no_margin_;
   DispatchMethod dispatch_method_in_use_{kNotYetDecided};
+  bool contact_manifold_caching_enabled_{false};
+  // Elements whose world transform has changed since the last UpdateModel();
+  // UpdateModel() refreshes the broadphase AABBs of these elements only.
+  std::unordered_set<ElementId> moved_element_ids_;
+  // Forces the next UpdateModel() to refresh every AABB; set when elements
+  // are added to the model.
+  bool force_full_aabb_update_{true};
 };
 
 }  // namespace collision
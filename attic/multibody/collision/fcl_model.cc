@@ -1,5 +1,8 @@
 #include "drake/multibody/collision/fcl_model.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <utility>
 
 #include <Eigen/Dense>
@@ -76,6 +79,55 @@ bool CollisionCallback(fcl::CollisionObjectd* fcl_object_A,
   // configuration, we return false.
   return false;
 }
+
+// Struct for use in PointDistanceCallback(). Contains the distance request
+// and accumulates the running minimum over the elements visited so far.
+struct PointDistanceData {
+  // Distance request
+  fcl::DistanceRequestd request;
+
+  // Signed distance from the query point to the nearest element found so far.
+  double distance{std::numeric_limits<double>::infinity()};
+
+  // The nearest element found so far, or nullptr if none has been visited.
+  const Element* element{nullptr};
+
+  // The nearest point on that element, in the world frame.
+  Eigen::Vector3d p_WBc{Eigen::Vector3d::Zero()};
+};
+
+// Callback function for the broadphase manager's distance traversal, used by
+// the point queries. One of the two objects is the zero-radius query sphere
+// (recognizable by its null user data); the other is a model element.
+bool PointDistanceCallback(fcl::CollisionObjectd* fcl_object_A,
+                           fcl::CollisionObjectd* fcl_object_B,
+                           void* callback_data, double& dist) {
+  fcl::CollisionObjectd* query_object = fcl_object_A;
+  fcl::CollisionObjectd* model_object = fcl_object_B;
+  if (query_object->getUserData() != nullptr) {
+    std::swap(query_object, model_object);
+  }
+
+  auto* distance_data = static_cast<PointDistanceData*>(callback_data);
+  fcl::DistanceResultd result;
+  fcl::distance(query_object, model_object, distance_data->request, result);
+  if (result.min_distance < distance_data->distance) {
+    distance_data->distance = result.min_distance;
+    distance_data->element =
+        static_cast<const Element*>(model_object->getUserData());
+    distance_data->p_WBc = result.nearest_points[1];
+  }
+
+  // Tighten the manager's pruning bound to the current minimum. The bound is
+  // clamped at zero so that elements whose bounding volumes overlap the query
+  // point are still visited when the running minimum is already negative;
+  // a deeper penetration may yet be found among them.
+  dist = std::max(distance_data->distance, 0.);
+
+  // Returning true would terminate the traversal early; we want the global
+  // minimum, so we return false.
+  return false;
+}
 }  // namespace
 
 void FclModel::DoAddElement(const Element& element) {
@@ -86,6 +138,12 @@ void FclModel::DoAddElement(const Element& element) {
   std::shared_ptr<fcl::CollisionGeometryd> fcl_geometry;
 
   switch (element.getShape()) {
+    case DrakeShapes::BOX: {
+      const auto& box =
+          static_cast<const DrakeShapes::Box&>(element.getGeometry());
+      fcl_geometry =
+          std::make_shared<fcl::Boxd>(box.size(0), box.size(1), box.size(2));
+    } break;
     case DrakeShapes::SPHERE: {
       const auto& sphere =
           static_cast<const DrakeShapes::Sphere&>(element.getGeometry());
@@ -97,6 +155,12 @@ void FclModel::DoAddElement(const Element& element) {
       fcl_geometry =
           std::make_shared<fcl::Cylinderd>(cylinder.radius, cylinder.length);
     } break;
+    case DrakeShapes::CAPSULE: {
+      const auto& capsule =
+          static_cast<const DrakeShapes::Capsule&>(element.getGeometry());
+      fcl_geometry =
+          std::make_shared<fcl::Capsuled>(capsule.radius, capsule.length);
+    } break;
     default:
       DRAKE_ABORT_MSG("Not implemented.");
       break;
@@ -143,12 +207,69 @@ bool FclModel::UpdateElementWorldTransform(ElementId id,
   return element_exists;
 }
 
+PointPair<double> FclModel::FindClosestPointsBetweenElements(
+    ElementId idA, ElementId idB) const {
+  const fcl::CollisionObjectd* fcl_object_A =
+      fcl_collision_objects_.at(idA).get();
+  const fcl::CollisionObjectd* fcl_object_B =
+      fcl_collision_objects_.at(idB).get();
+
+  fcl::DistanceRequestd request;
+  request.enable_nearest_points = true;
+  request.enable_signed_distance = true;
+  fcl::DistanceResultd result;
+  fcl::distance(fcl_object_A, fcl_object_B, request, result);
+
+  const double distance = result.min_distance;
+  const Vector3d p_WAc = result.nearest_points[0];
+  const Vector3d p_WBc = result.nearest_points[1];
+
+  // By convention, Drake requires the contact normal to point out of B and
+  // into A. The witness points satisfy p_WAc - p_WBc = distance * normal for
+  // both the separated (distance > 0) and penetrating (distance < 0) cases.
+  // When the elements are osculating the witness points coincide; fall back
+  // to the direction between the object origins.
+  Vector3d drake_normal;
+  if ((p_WAc - p_WBc).norm() > std::numeric_limits<double>::epsilon()) {
+    drake_normal = (p_WAc - p_WBc) / distance;
+  } else {
+    drake_normal =
+        (fcl_object_A->getTranslation() - fcl_object_B->getTranslation())
+            .normalized();
+  }
+
+  // Report the witness points in their respective body frames, per the
+  // contract of ClosestPointsPairwise().
+  const Element* element_A = FindElement(idA);
+  const Element* element_B = FindElement(idB);
+  const Vector3d p_AAc = element_A->getLocalTransform() *
+                         (element_A->getWorldTransform().inverse() * p_WAc);
+  const Vector3d p_BBc = element_B->getLocalTransform() *
+                         (element_B->getWorldTransform().inverse() * p_WBc);
+
+  return PointPair<double>(element_A, element_B, p_AAc, p_BBc, drake_normal,
+                           distance);
+}
+
 bool FclModel::ClosestPointsAllToAll(
     const std::vector<ElementId>& ids_to_check, bool use_margins,
     std::vector<PointPair<double>>* closest_points) {
-  drake::unused(ids_to_check, use_margins, closest_points);
-  DRAKE_ABORT_MSG("Not implemented.");
-  return false;
+  DRAKE_DEMAND(closest_points != nullptr);
+  std::vector<ElementIdPair> id_pairs;
+  for (size_t i = 0; i < ids_to_check.size(); ++i) {
+    ElementId id_a = ids_to_check[i];
+    const Element* element_a = FindElement(id_a);
+    if (element_a != nullptr) {
+      for (size_t j = i + 1; j < ids_to_check.size(); ++j) {
+        ElementId id_b = ids_to_check[j];
+        const Element* element_b = FindElement(id_b);
+        if (element_b != nullptr && element_a->CanCollideWith(element_b)) {
+          id_pairs.push_back(std::make_pair(id_a, id_b));
+        }
+      }
+    }
+  }
+  return ClosestPointsPairwise(id_pairs, use_margins, closest_points);
 }
 
 bool FclModel::ComputeMaximumDepthCollisionPoints(
@@ -164,21 +285,94 @@ bool FclModel::ComputeMaximumDepthCollisionPoints(
 bool FclModel::ClosestPointsPairwise(
     const std::vector<ElementIdPair>& id_pairs, bool use_margins,
     std::vector<PointPair<double>>* closest_points) {
-  drake::unused(id_pairs, use_margins, closest_points);
-  DRAKE_ABORT_MSG("Not implemented.");
-  return false;
+  DRAKE_DEMAND(closest_points != nullptr);
+  // FCL does not maintain a separate margin representation; both settings
+  // dispatch the same narrowphase signed-distance query.
+  drake::unused(use_margins);
+  closest_points->clear();
+  closest_points->reserve(id_pairs.size());
+  for (const ElementIdPair& pair : id_pairs) {
+    closest_points->push_back(
+        FindClosestPointsBetweenElements(pair.first, pair.second));
+  }
+  return closest_points->size() > 0;
+}
+
+double FclModel::DistanceFromPoint(const Eigen::Vector3d& p_WQ) {
+  // Pose the query point as a zero-radius sphere so that the broadphase
+  // manager can prune distant elements instead of visiting every element.
+  fcl::CollisionObjectd query_object(std::make_shared<fcl::Sphered>(0.));
+  query_object.setTranslation(p_WQ);
+  PointDistanceData distance_data;
+  distance_data.request.enable_signed_distance = true;
+  broadphase_manager_.distance(&query_object,
+                               static_cast<void*>(&distance_data),
+                               PointDistanceCallback);
+  return distance_data.distance;
 }
 
 void FclModel::CollisionDetectFromPoints(
     const Eigen::Matrix3Xd& points, bool use_margins,
     std::vector<PointPair<double>>* closest_points) {
-  drake::unused(points, use_margins, closest_points);
-  DRAKE_ABORT_MSG("Not implemented.");
+  DRAKE_DEMAND(closest_points != nullptr);
+  drake::unused(use_margins);
+  closest_points->resize(points.cols());
+
+  // Pose each query point as a zero-radius sphere so that the broadphase
+  // manager can prune distant elements instead of visiting every element.
+  auto point_geometry = std::make_shared<fcl::Sphered>(0.);
+  for (int i = 0; i < points.cols(); ++i) {
+    const Vector3d p_WQ = points.col(i);
+    fcl::CollisionObjectd query_object(point_geometry);
+    query_object.setTranslation(p_WQ);
+
+    PointDistanceData distance_data;
+    distance_data.request.enable_nearest_points = true;
+    distance_data.request.enable_signed_distance = true;
+    broadphase_manager_.distance(&query_object,
+                                 static_cast<void*>(&distance_data),
+                                 PointDistanceCallback);
+
+    if (distance_data.element != nullptr) {
+      const Element* element = distance_data.element;
+      const double distance = distance_data.distance;
+      const Vector3d& p_WBc = distance_data.p_WBc;
+      // The normal points from the nearest surface point toward the query
+      // point; dividing by the signed distance keeps it outward-pointing when
+      // the query point is inside the element.
+      Vector3d drake_normal;
+      if (std::abs(distance) > std::numeric_limits<double>::epsilon()) {
+        drake_normal = (p_WQ - p_WBc) / distance;
+      } else {
+        drake_normal = Vector3d(0., 0., 1.);
+      }
+      // Per the contract of this query (and matching BulletModel), ptA is the
+      // nearest point in the element's frame and ptB is that same point in
+      // the world frame.
+      const Vector3d p_EBc = element->getWorldTransform().inverse() * p_WBc;
+      closest_points->at(i) = PointPair<double>(element, element, p_EBc, p_WBc,
+                                                drake_normal, distance);
+    } else {
+      // Values used in the degenerate case of no closest points.
+      constexpr double inf = std::numeric_limits<double>::infinity();
+      const Vector3d inf_vector(0, 0, inf);
+      const Vector3d default_norm(0, 0, 1);
+
+      // In case there are no other objects found, we report a null object
+      // infinitely far away.
+      closest_points->at(i) = PointPair<double>();
+      closest_points->at(i).distance = inf;
+      closest_points->at(i).normal = default_norm;
+      closest_points->at(i).ptA = inf_vector;
+      closest_points->at(i).ptB = inf_vector;
+    }
+  }
 }
 
 void FclModel::ClearCachedResults(bool use_margins) {
+  // FCL's collision and distance dispatches are stateless; there are no
+  // cached results to clear.
   drake::unused(use_margins);
-  DRAKE_ABORT_MSG("Not implemented.");
 }
 
 bool FclModel::CollisionRaycast(const Eigen::Matrix3Xd& origins,
@@ -193,17 +387,24 @@ bool FclModel::CollisionRaycast(const Eigen::Matrix3Xd& origins,
 bool FclModel::CollidingPointsCheckOnly(
     const std::vector<Eigen::Vector3d>& input_points,
     double collision_threshold) {
-  drake::unused(input_points, collision_threshold);
-  DRAKE_ABORT_MSG("Not implemented.");
+  for (const Eigen::Vector3d& point : input_points) {
+    if (DistanceFromPoint(point) <= collision_threshold) {
+      return true;
+    }
+  }
   return false;
 }
 
 std::vector<size_t> FclModel::CollidingPoints(
     const std::vector<Eigen::Vector3d>& input_points,
     double collision_threshold) {
-  drake::unused(input_points, collision_threshold);
-  DRAKE_ABORT_MSG("Not implemented.");
-  return std::vector<size_t>();
+  std::vector<size_t> in_collision_indices;
+  for (size_t i = 0; i < input_points.size(); ++i) {
+    if (DistanceFromPoint(input_points[i]) <= collision_threshold) {
+      in_collision_indices.push_back(i);
+    }
+  }
+  return in_collision_indices;
 }
 
 }  // namespace collision
@@ -52,6 +52,17 @@ class FclModel : public Model {
       ElementId, const Eigen::Isometry3d& T_local_to_world) override;
 
  private:
+  // Performs a narrowphase signed-distance query between the elements with
+  // ids `idA` and `idB`, reporting the witness points in the respective body
+  // frames and the normal pointing out of B and into A.
+  PointPair<double> FindClosestPointsBetweenElements(ElementId idA,
+                                                     ElementId idB) const;
+
+  // Returns the signed distance from the world-frame point `p_WQ` to the
+  // nearest element surface, or infinity when the model is empty.  Uses the
+  // broadphase manager to prune distant elements.
+  double DistanceFromPoint(const Eigen::Vector3d& p_WQ);
+
   fcl::DynamicAABBTreeCollisionManager<double> broadphase_manager_;
   std::unordered_map<ElementId, std::unique_ptr<fcl::CollisionObject<double>>>
       fcl_collision_objects_;
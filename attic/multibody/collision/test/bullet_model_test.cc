@@ -1,5 +1,8 @@
 #include "drake/multibody/collision/bullet_model.h"
 
+#include <memory>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/eigen_types.h"
@@ -56,6 +59,49 @@ GTEST_TEST(BulletModelTest, newBulletBoxShapeTest) {
     EXPECT_NEAR(bullet_vertex.z(), expected_vertices[i].z(), 0.0);
   }
 }
+
+// Verifies that retaining Bullet's persistent contact manifolds across
+// dispatches produces the same contact results as the default from-scratch
+// behavior, including after elements move into and out of contact.
+GTEST_TEST(BulletModelTest, ContactManifoldCachingTest) {
+  const double kRadius{0.5};
+  BulletModel model;
+  Element* element_A =
+      model.AddElement(std::make_unique<Element>(DrakeShapes::Sphere(kRadius)));
+  Element* element_B =
+      model.AddElement(std::make_unique<Element>(DrakeShapes::Sphere(kRadius)));
+
+  EXPECT_FALSE(model.contact_manifold_caching_enabled());
+  model.set_contact_manifold_caching_enabled(true);
+  EXPECT_TRUE(model.contact_manifold_caching_enabled());
+
+  // Overlap the spheres by 0.1 along the x-axis.
+  model.UpdateElementWorldTransform(element_A->getId(),
+                                    Eigen::Isometry3d::Identity());
+  model.UpdateElementWorldTransform(
+      element_B->getId(),
+      Eigen::Isometry3d(Eigen::Translation3d(0.9, 0., 0.)));
+  model.UpdateModel();
+
+  std::vector<PointPair<double>> points;
+  model.ComputeMaximumDepthCollisionPoints(true, &points);
+  ASSERT_EQ(1u, points.size());
+  EXPECT_NEAR(-0.1, points[0].distance, 1e-9);
+
+  // A second dispatch starts from the warm manifold and reports the same
+  // contact.
+  model.ComputeMaximumDepthCollisionPoints(true, &points);
+  ASSERT_EQ(1u, points.size());
+  EXPECT_NEAR(-0.1, points[0].distance, 1e-9);
+
+  // Separating the spheres prunes the stale manifold points.
+  model.UpdateElementWorldTransform(
+      element_B->getId(),
+      Eigen::Isometry3d(Eigen::Translation3d(2., 0., 0.)));
+  model.UpdateModel();
+  model.ComputeMaximumDepthCollisionPoints(true, &points);
+  EXPECT_TRUE(points.empty());
+}
 }  // namespace
 }  // namespace collision
 }  // namespace multibody
@@ -0,0 +1,156 @@
+// Micro-benchmark comparing the collision backends available through
+// newModel() on a pallet-style scene: layers of lightly-interpenetrating
+// boxes with a row of spheres resting on top.  For each backend the
+// benchmark times the broadphase refresh after perturbing every element,
+// the maximum-depth contact query, and the all-to-all closest-points query.
+//
+// Run with:
+//   bazel run //attic/multibody/collision:collision_model_benchmark
+
+#include <cstdio>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/test_utilities/measure_execution.h"
+#include "drake/multibody/collision/drake_collision.h"
+
+using Eigen::Isometry3d;
+using Eigen::Translation3d;
+using Eigen::Vector3d;
+
+namespace drake {
+namespace multibody {
+namespace collision {
+namespace {
+
+using common::test::MeasureExecutionTime;
+
+// Populates @p model with a stack of boxes arranged like a loaded pallet,
+// with each box slightly overlapping its neighbors, plus a row of spheres on
+// the top layer.  Returns the ids of all the added elements along with the
+// world poses used, so that the caller can re-pose the elements during the
+// benchmark.
+std::vector<std::pair<ElementId, Isometry3d>> BuildPalletScene(Model* model) {
+  const int kRows = 4;
+  const int kColumns = 4;
+  const int kLayers = 3;
+  const Vector3d kBoxSize(0.3, 0.4, 0.25);
+  // Space the boxes at 99% of their footprint so that every neighboring pair
+  // is in slight penetration, as bins on a real pallet are after settling.
+  const double kOverlap = 0.99;
+
+  std::vector<std::pair<ElementId, Isometry3d>> poses;
+  for (int layer = 0; layer < kLayers; ++layer) {
+    for (int row = 0; row < kRows; ++row) {
+      for (int column = 0; column < kColumns; ++column) {
+        Element* element =
+            model->AddElement(std::make_unique<Element>(DrakeShapes::Box(
+                kBoxSize)));
+        const Isometry3d X_WE(Translation3d(row * kBoxSize(0) * kOverlap,
+                                            column * kBoxSize(1) * kOverlap,
+                                            layer * kBoxSize(2) * kOverlap));
+        model->UpdateElementWorldTransform(element->getId(), X_WE);
+        poses.emplace_back(element->getId(), X_WE);
+      }
+    }
+  }
+
+  // A row of spheres resting on (and slightly penetrating) the top layer.
+  const double kSphereRadius = 0.1;
+  for (int row = 0; row < kRows; ++row) {
+    Element* element = model->AddElement(
+        std::make_unique<Element>(DrakeShapes::Sphere(kSphereRadius)));
+    const Isometry3d X_WE(Translation3d(
+        row * kBoxSize(0) * kOverlap, 0.,
+        kLayers * kBoxSize(2) * kOverlap - kBoxSize(2) * 0.5 + kSphereRadius *
+            0.95));
+    model->UpdateElementWorldTransform(element->getId(), X_WE);
+    poses.emplace_back(element->getId(), X_WE);
+  }
+
+  model->UpdateModel();
+  return poses;
+}
+
+void BenchmarkModel(const char* backend_name, Model* model,
+                    int num_iterations) {
+  const std::vector<std::pair<ElementId, Isometry3d>> poses =
+      BuildPalletScene(model);
+
+  std::vector<ElementId> ids;
+  for (const auto& id_and_pose : poses) {
+    ids.push_back(id_and_pose.first);
+  }
+
+  // Re-poses every element with a small configuration-dependent offset and
+  // refreshes the broadphase structures, as happens once per simulation step.
+  int step = 0;
+  auto update = [&]() {
+    for (int i = 0; i < num_iterations; ++i) {
+      ++step;
+      const Vector3d offset(1e-4 * (step % 7), 1e-4 * (step % 5),
+                            1e-4 * (step % 3));
+      for (const auto& id_and_pose : poses) {
+        model->UpdateElementWorldTransform(
+            id_and_pose.first,
+            Isometry3d(Translation3d(offset)) * id_and_pose.second);
+      }
+      model->UpdateModel();
+    }
+  };
+
+  std::vector<PointPair<double>> points;
+  auto max_depth = [&]() {
+    for (int i = 0; i < num_iterations; ++i) {
+      model->ComputeMaximumDepthCollisionPoints(true, &points);
+    }
+  };
+
+  auto closest_points = [&]() {
+    for (int i = 0; i < num_iterations; ++i) {
+      model->ClosestPointsAllToAll(ids, true, &points);
+    }
+  };
+
+  const double update_time = MeasureExecutionTime(update) / num_iterations;
+  const double max_depth_time =
+      MeasureExecutionTime(max_depth) / num_iterations;
+  const double closest_points_time =
+      MeasureExecutionTime(closest_points) / num_iterations;
+
+  std::printf("%s (%d elements):\n", backend_name,
+              static_cast<int>(ids.size()));
+  std::printf("  update + broadphase refresh: %10.3f us\n", update_time * 1e6);
+  std::printf("  maximum-depth contacts:      %10.3f us (%d pairs)\n",
+              max_depth_time * 1e6, static_cast<int>(points.size()));
+  std::printf("  all-to-all closest points:   %10.3f us\n",
+              closest_points_time * 1e6);
+}
+
+int DoMain() {
+  const int kNumIterations = 100;
+
+#ifdef BULLET_COLLISION
+  {
+    std::unique_ptr<Model> model = newModel(ModelType::kBullet);
+    BenchmarkModel("Bullet", model.get(), kNumIterations);
+  }
+#endif
+#ifndef DRAKE_DISABLE_FCL
+  {
+    std::unique_ptr<Model> model = newModel(ModelType::kFcl);
+    BenchmarkModel("FCL", model.get(), kNumIterations);
+  }
+#endif
+  return 0;
+}
+
+}  // namespace
+}  // namespace collision
+}  // namespace multibody
+}  // namespace drake
+
+int main() { return drake::multibody::collision::DoMain(); }
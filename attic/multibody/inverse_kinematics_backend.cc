@@ -1,7 +1,11 @@
 #include "drake/multibody/inverse_kinematics_backend.h"
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
 #include <vector>
 
 #include <Eigen/Core>
@@ -219,22 +223,27 @@ void inverseKinBackend(RigidBodyTree<double>* model, const int nT,
         "nq x nT");
   }
 
-  KinematicsCacheHelper<double> kin_helper(*model);
+  MatrixXd Q;
+  ikoptions.getQ(Q);
 
+  // Solves the IK problem at knot `t_index` from `initial_guess`, writing the
+  // result into the `t_index` column of `q_sol` and entry of `info`.  The
+  // caller supplies the KinematicsCacheHelper; a helper must not be shared
+  // between concurrently-running knots.
+  //
   // TODO(sam.creasey) I really don't like rebuilding the
   // MathematicalProgram for every timestep, but it's not possible to
   // enable/disable (or even remove) a constraint from an
   // MathematicalProgram between calls to Solve() currently, so
   // there's not actually another way.
-  for (int t_index = 0; t_index < nT; t_index++) {
+  auto solve_knot = [&](int t_index, KinematicsCacheHelper<double>* kin_helper,
+                        const VectorXd& initial_guess) {
     MathematicalProgram prog;
     SetIKSolverOptions(ikoptions, &prog);
 
     drake::solvers::VectorXDecisionVariable vars =
         prog.NewContinuousVariables(model->get_num_positions());
 
-    MatrixXd Q;
-    ikoptions.getQ(Q);
     auto objective = std::make_shared<InverseKinObjective>(Q);
     prog.AddCost(objective, vars);
 
@@ -249,7 +258,7 @@ void inverseKinBackend(RigidBodyTree<double>* model, const int nT,
           continue;
         }
         auto wrapper = std::make_shared<SingleTimeKinematicConstraintWrapper>(
-            stc, &kin_helper);
+            stc, kin_helper);
         prog.AddConstraint(wrapper, vars);
       } else if (constraint_category ==
                  RigidBodyConstraint::PostureConstraintCategory) {
@@ -269,7 +278,7 @@ void inverseKinBackend(RigidBodyTree<double>* model, const int nT,
             &t[t_index], constraint, model->get_num_positions(), vars, &prog);
       } else if (constraint_category ==
                  RigidBodyConstraint::QuasiStaticConstraintCategory) {
-        AddQuasiStaticConstraint(&t[t_index], constraint, &kin_helper, vars,
+        AddQuasiStaticConstraint(&t[t_index], constraint, kin_helper, vars,
                                  &prog);
       } else if (constraint_category ==
                  RigidBodyConstraint::MultipleTimeKinematicConstraintCategory) {
@@ -292,16 +301,76 @@ void inverseKinBackend(RigidBodyTree<double>* model, const int nT,
     // TODO(sam.creasey) would this be faster if we stored the view
     // instead of copying into a VectorXd?
     objective->set_q_nom(q_nom.col(t_index));
-    if (!ikoptions.getSequentialSeedFlag() || (t_index == 0)) {
-      prog.SetInitialGuess(vars, q_seed.col(t_index));
-    } else {
-      prog.SetInitialGuess(vars, q_sol->col(t_index - 1));
-    }
+    prog.SetInitialGuess(vars, initial_guess);
 
     SolutionResult result = prog.Solve();
     const VectorXd& vars_value = prog.GetSolution(vars);
     q_sol->col(t_index) = vars_value;
     info[t_index] = GetIKSolverInfo(result);
+  };
+
+  if (ikoptions.getSequentialSeedFlag()) {
+    // Each knot is seeded from the previous knot's solution, so the knots
+    // must be solved in order.
+    KinematicsCacheHelper<double> kin_helper(*model);
+    for (int t_index = 0; t_index < nT; t_index++) {
+      if (t_index == 0) {
+        solve_knot(t_index, &kin_helper, q_seed.col(t_index));
+      } else {
+        solve_knot(t_index, &kin_helper, q_sol->col(t_index - 1));
+      }
+    }
+    return;
+  }
+
+  // Without sequential seeding the knots are independent, so they are farmed
+  // out to worker threads.  Each worker owns its own KinematicsCacheHelper
+  // (the helpers hold mutable kinematics state) and pulls knot indices off a
+  // shared counter; each knot writes to a distinct column of q_sol and entry
+  // of info, so no locking is needed around the solves themselves.
+  int num_workers = std::max<int>(1, std::thread::hardware_concurrency());
+  // The f2c flavor of SNOPT keeps global state, so its solves cannot overlap.
+  if (drake::solvers::SnoptSolver::is_available() &&
+      !drake::solvers::SnoptSolver::is_thread_safe()) {
+    num_workers = 1;
+  }
+  num_workers = std::min(num_workers, nT);
+
+  std::atomic<int> next_knot{0};
+  std::atomic<bool> cancelled{false};
+  std::mutex exception_mutex;
+  std::exception_ptr first_exception{nullptr};
+
+  auto solve_knots = [&]() {
+    KinematicsCacheHelper<double> kin_helper(*model);
+    try {
+      int t_index{};
+      while (!cancelled && (t_index = next_knot++) < nT) {
+        solve_knot(t_index, &kin_helper, q_seed.col(t_index));
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> guard(exception_mutex);
+      if (first_exception == nullptr) {
+        first_exception = std::current_exception();
+      }
+      cancelled = true;
+    }
+  };
+
+  if (num_workers <= 1) {
+    solve_knots();
+  } else {
+    std::vector<std::thread> workers;
+    workers.reserve(num_workers);
+    for (int i = 0; i < num_workers; ++i) {
+      workers.emplace_back(solve_knots);
+    }
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+  }
+  if (first_exception != nullptr) {
+    std::rethrow_exception(first_exception);
   }
 }
 
@@ -40,6 +40,10 @@ KinematicsCache<T>::KinematicsCache(
       v(Eigen::Matrix<T, Eigen::Dynamic, 1>::Zero(num_velocities_)),
       velocity_vector_valid(false) {
   DRAKE_DEMAND(num_joint_positions.size() == num_joint_velocities.size());
+  // Size the element storage once up front: every element lives in one
+  // contiguous aligned buffer, and reserving avoids reallocating (and
+  // copying) the multi-kilobyte elements as the vector grows.
+  elements_.reserve(num_joint_positions.size());
   for (int body_id = 0;
        body_id < static_cast<int>(num_joint_positions.size()); ++body_id) {
     elements_.emplace_back(num_joint_positions[body_id],
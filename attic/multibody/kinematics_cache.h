@@ -74,6 +74,12 @@ class KinematicsCacheElement {
 template <typename T>
 class KinematicsCache {
  private:
+  // All cache elements live in this single contiguous aligned buffer.  Note
+  // that every dynamically-sized matrix in KinematicsCacheElement has a
+  // compile-time maximum size, so its storage is inline in the element rather
+  // than on the heap; a kinematics sweep over the elements therefore walks
+  // one contiguous block of memory, and constructing the cache performs no
+  // per-element allocations.
   std::vector<KinematicsCacheElement<T>,
               Eigen::aligned_allocator<KinematicsCacheElement<T>>> elements_;
   int num_positions_;
@@ -0,0 +1,59 @@
+#include "drake/multibody/kinematics_cache_pool.h"
+
+#include "drake/common/autodiff.h"
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace systems {
+namespace plants {
+
+template <typename Scalar>
+KinematicsCachePool<Scalar>::KinematicsCachePool(
+    const RigidBodyTree<double>& tree)
+    : tree_(&tree) {}
+
+template <typename Scalar>
+typename KinematicsCachePool<Scalar>::Checkout
+KinematicsCachePool<Scalar>::CheckOut() {
+  std::unique_ptr<KinematicsCache<Scalar>> cache;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!idle_caches_.empty()) {
+      cache = std::move(idle_caches_.back());
+      idle_caches_.pop_back();
+    } else {
+      cache = std::make_unique<KinematicsCache<Scalar>>(
+          tree_->CreateKinematicsCacheWithType<Scalar>());
+      ++num_created_;
+    }
+  }
+  return Checkout(this, std::move(cache));
+}
+
+template <typename Scalar>
+int KinematicsCachePool<Scalar>::num_idle() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return static_cast<int>(idle_caches_.size());
+}
+
+template <typename Scalar>
+int KinematicsCachePool<Scalar>::num_created() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return num_created_;
+}
+
+template <typename Scalar>
+void KinematicsCachePool<Scalar>::Return(
+    std::unique_ptr<KinematicsCache<Scalar>> cache) {
+  DRAKE_DEMAND(cache != nullptr);
+  std::lock_guard<std::mutex> lock(mutex_);
+  idle_caches_.push_back(std::move(cache));
+}
+
+// Explicitly instantiates on the most common scalar types.
+template class KinematicsCachePool<double>;
+template class KinematicsCachePool<AutoDiffXd>;
+
+}  // namespace plants
+}  // namespace systems
+}  // namespace drake
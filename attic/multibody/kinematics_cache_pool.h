@@ -0,0 +1,99 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/multibody/rigid_body_tree.h"
+
+namespace drake {
+namespace systems {
+namespace plants {
+
+/// A thread-safe pool of KinematicsCache objects for a single RigidBodyTree,
+/// allowing parallel worker threads (e.g. collision checkers in a planner) to
+/// run RigidBodyTree::doKinematics() and kinematics queries against one
+/// shared const tree without allocating a fresh cache per query.  Caches are
+/// created on demand, handed out through RAII checkouts, and returned to the
+/// pool with their per-body element storage intact, so steady-state operation
+/// is allocation-free.
+///
+/// Typical use, on each worker thread:
+/// @code
+/// auto checkout = pool.CheckOut();
+/// checkout.cache().initialize(q);
+/// tree.doKinematics(checkout.cache());
+/// auto points_in_world = tree.transformPoints(checkout.cache(), ...);
+/// // The cache returns to the pool when `checkout` goes out of scope.
+/// @endcode
+template <typename Scalar>
+class KinematicsCachePool {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(KinematicsCachePool)
+
+  /// An RAII handle on a pooled KinematicsCache.  The cache is exclusively
+  /// owned by the holder for the lifetime of the Checkout and is returned to
+  /// the pool upon destruction.  Movable but not copyable.
+  class Checkout {
+   public:
+    Checkout(const Checkout&) = delete;
+    Checkout& operator=(const Checkout&) = delete;
+    Checkout& operator=(Checkout&&) = delete;
+
+    Checkout(Checkout&& other)
+        : pool_(other.pool_), cache_(std::move(other.cache_)) {
+      other.pool_ = nullptr;
+    }
+
+    ~Checkout();
+
+    KinematicsCache<Scalar>& cache() { return *cache_; }
+
+   private:
+    friend class KinematicsCachePool;
+
+    Checkout(KinematicsCachePool* pool,
+             std::unique_ptr<KinematicsCache<Scalar>> cache)
+        : pool_(pool), cache_(std::move(cache)) {}
+
+    KinematicsCachePool* pool_{};
+    std::unique_ptr<KinematicsCache<Scalar>> cache_;
+  };
+
+  /// Constructs an empty pool serving caches for @p tree, which is aliased
+  /// and must outlive this object.
+  explicit KinematicsCachePool(const RigidBodyTree<double>& tree);
+
+  /// Obtains a cache from the pool, creating one if no idle cache is
+  /// available.  The returned cache holds whatever stale kinematics its
+  /// previous user left behind; callers must initialize() it before use.
+  Checkout CheckOut();
+
+  /// Returns the number of caches currently sitting idle in the pool.
+  int num_idle() const;
+
+  /// Returns the total number of caches this pool has created; with N worker
+  /// threads this plateaus at the maximum number of simultaneous checkouts.
+  int num_created() const;
+
+ private:
+  void Return(std::unique_ptr<KinematicsCache<Scalar>> cache);
+
+  const RigidBodyTree<double>* const tree_;
+  mutable std::mutex mutex_;
+  std::vector<std::unique_ptr<KinematicsCache<Scalar>>> idle_caches_;
+  int num_created_{0};
+};
+
+template <typename Scalar>
+KinematicsCachePool<Scalar>::Checkout::~Checkout() {
+  if (pool_ != nullptr) {
+    pool_->Return(std::move(cache_));
+  }
+}
+
+}  // namespace plants
+}  // namespace systems
+}  // namespace drake
@@ -129,7 +129,9 @@ void approximateIK(
  * the seed for t[i]. If the solver fails to find a posture at t[i-1], then
  * q_seed.col(i) would be used as the seed for t[i]
  *                    if ikoptions.sequentialSeedFlag = false, then
- * q_seed.col(i) would always be used as the seed at t[i]
+ * q_seed.col(i) would always be used as the seed at t[i], and the knots are
+ * independent of each other; they are then solved in parallel across the
+ * available hardware threads
  */
 template <typename DerivedA, typename DerivedB, typename DerivedC>
 void inverseKinPointwise(
@@ -121,6 +121,23 @@ class CompliantContactModel {
   // By default, it uses all hard-coded values.
   CompliantMaterial default_material_;
 
+  // Memoized result of the most recent ComputeContactForce() evaluation.
+  // Error-controlled integration commonly re-evaluates the contact force at
+  // an unchanged state; when (q, v) match the previous evaluation exactly and
+  // no ContactResults are requested, the cached generalized force is returned
+  // without re-running collision dispatch.  These members are mutable because
+  // they cache derived values only; they make ComputeContactForce()
+  // non-reentrant, so a model instance must not be shared between threads.
+  mutable VectorX<T> last_q_;
+  mutable VectorX<T> last_v_;
+  mutable VectorX<T> last_contact_force_;
+  mutable bool last_contact_force_valid_{false};
+
+  // Preallocated workspace for the per-pair contact Jacobian in the contact
+  // frame, J = [D1; D2; n], to avoid reallocating it for every contact in
+  // every evaluation.
+  mutable Eigen::Matrix<T, 3, Eigen::Dynamic> J_workspace_;
+
   // For scalar-converting copy constructor.
   template <typename U>
   friend class CompliantContactModel;
@@ -99,6 +99,36 @@ TEST_F(CompliantContactModelTestDouble, ModelTouching) {
   ASSERT_EQ(contact_results.get_num_contacts(), 0);
 }
 
+// Confirms that re-evaluating the contact force at an unchanged state (the
+// memoized fast path used under error-controlled integration) reproduces the
+// from-scratch result exactly, and that a changed state is not served from
+// the memo.
+TEST_F(CompliantContactModelTestDouble, RepeatedEvaluationMemoization) {
+  const double offset = 0.1;
+  auto& contact_results = RunTest(-offset);
+  const VectorX<double>& fresh_force =
+      contact_results.get_generalized_contact_force();
+
+  VectorX<double> q0 = unique_tree_->getZeroConfiguration();
+  const VectorX<double> v0 =
+      VectorX<double>::Zero(unique_tree_->get_num_velocities());
+  auto kinsol = unique_tree_->doKinematics(q0, v0);
+
+  // The memoized result matches the full evaluation bit-for-bit.
+  const VectorX<double> memoized_force =
+      compliant_contact_model_->ComputeContactForce(*unique_tree_, kinsol);
+  EXPECT_TRUE(::drake::CompareMatrices(fresh_force, memoized_force));
+
+  // A perturbed configuration changes the penetration and must produce a
+  // different force, not the memo.
+  q0(0) += 0.01;
+  auto perturbed_kinsol = unique_tree_->doKinematics(q0, v0);
+  const VectorX<double> perturbed_force =
+      compliant_contact_model_->ComputeContactForce(*unique_tree_,
+                                                    perturbed_kinsol);
+  EXPECT_FALSE(::drake::CompareMatrices(fresh_force, perturbed_force, 1e-12));
+}
+
 // Confirms a contact result for two colliding spheres with identical contact
 // material and zero relative velocity.
 TEST_F(CompliantContactModelTestDouble, ModelSingleCollision) {
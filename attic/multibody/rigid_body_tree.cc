@@ -171,6 +171,8 @@ unique_ptr<RigidBodyTree<double>> RigidBodyTree<double>::Clone() const {
   clone->num_velocities_ = this->num_velocities_;
   clone->num_model_instances_ = this->num_model_instances_;
   clone->initialized_ = this->initialized_;
+  clone->num_joint_positions_ = this->num_joint_positions_;
+  clone->num_joint_velocities_ = this->num_joint_velocities_;
 
   // N.B. `add_rigid_body` is not used here because this may change the ordering
   // of frames, and the clone tests require that they maintain their original
@@ -459,6 +461,22 @@ void RigidBodyTree<T>::compile() {
 
   CompileCollisionState();
 
+  // Caches the per-joint position and velocity counts used to size
+  // KinematicsCache objects, so that creating a cache does not have to walk
+  // the joints again.
+  num_joint_positions_.clear();
+  num_joint_velocities_.clear();
+  num_joint_positions_.reserve(bodies_.size());
+  num_joint_velocities_.reserve(bodies_.size());
+  for (const auto& body : bodies_) {
+    const int np =
+        body->has_parent_body() ? body->getJoint().get_num_positions() : 0;
+    const int nv =
+        body->has_parent_body() ? body->getJoint().get_num_velocities() : 0;
+    num_joint_positions_.push_back(np);
+    num_joint_velocities_.push_back(nv);
+  }
+
   initialized_ = true;
 }
 
@@ -1341,19 +1359,10 @@ KinematicsCache<CacheT> RigidBodyTree<T>::CreateKinematicsCacheWithType()
   DRAKE_DEMAND(initialized_ &&
                "This RigidBodyTree was not initialized."
                " RigidBodyTree::compile() must be called first.");
-  std::vector<int> num_joint_positions;
-  std::vector<int> num_joint_velocities;
-  for (const auto& body_unique_ptr : bodies_) {
-    const RigidBody<T>& body = *body_unique_ptr;
-    int num_positions =
-        body.has_parent_body() ? body.getJoint().get_num_positions() : 0;
-    int num_velocities =
-        body.has_parent_body() ? body.getJoint().get_num_velocities() : 0;
-    num_joint_positions.push_back(num_positions);
-    num_joint_velocities.push_back(num_velocities);
-  }
+  // The per-joint counts were cached by compile(), so constructing the cache
+  // sizes its element arena directly from them.
   KinematicsCache<CacheT> cache(get_num_positions(), get_num_velocities(),
-                                num_joint_positions, num_joint_velocities);
+                                num_joint_positions_, num_joint_velocities_);
   return cache;
 }
 
@@ -1405,12 +1414,12 @@ void RigidBodyTree<T>::doKinematics(KinematicsCache<Scalar>& cache,
   cache.setPositionKinematicsCached();
 
   for (int i = 0; i < static_cast<int>(bodies_.size()); ++i) {
-    RigidBody<T>& body = *bodies_[i];
+    const RigidBody<T>& body = *bodies_[i];
     KinematicsCacheElement<Scalar>& element = *cache.get_mutable_element(i);
 
     if (body.has_parent_body()) {
       const KinematicsCacheElement<Scalar>& parent_element =
-          *cache.get_mutable_element(body.get_parent()->get_body_index());
+          cache.get_element(body.get_parent()->get_body_index());
       const DrakeJoint& joint = body.getJoint();
       auto q_body = q.middleRows(body.get_position_start_index(),
                                  joint.get_num_positions());
@@ -317,6 +317,16 @@ class RigidBodyTree {
 
   /// Computes the kinematics on the given @p cache.
   ///
+  /// This method only reads from this %RigidBodyTree and writes exclusively
+  /// into @p cache, so it is safe to call concurrently from multiple threads
+  /// against one shared (const) tree provided that every thread operates on
+  /// its own KinematicsCache.  The same holds for the query methods that take
+  /// a `const KinematicsCache&` (e.g. transformPoints()), with the caveat
+  /// that a single KinematicsCache must not be shared between threads: some
+  /// queries use mutable scratch space inside the cache.  Use
+  /// KinematicsCachePool to obtain per-thread caches without repeated
+  /// allocation.
+  ///
   /// This method is explicitly instantiated in rigid_body_tree.cc for a
   /// small set of supported Scalar types.
   template <typename Scalar>
@@ -1800,6 +1810,12 @@ class RigidBodyTree {
   // etc.) should clear the bit again, requiring another call to compile().
   bool initialized_{false};
 
+  // Per-body position and velocity counts of the mobilizing joints (zero for
+  // bodies with no parent), cached by compile() so that KinematicsCache
+  // objects can be sized without revisiting the joints.
+  std::vector<int> num_joint_positions_;
+  std::vector<int> num_joint_velocities_;
+
   int next_available_clique_ = 0;
 
  private:
@@ -0,0 +1,135 @@
+/* clang-format off to disable clang-format-includes */
+#include "drake/multibody/kinematics_cache_pool.h"
+/* clang-format on */
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/joints/floating_base_types.h"
+#include "drake/multibody/parsers/urdf_parser.h"
+
+namespace drake {
+namespace systems {
+namespace plants {
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+
+class KinematicsCachePoolTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    tree_ = std::make_unique<RigidBodyTree<double>>();
+    parsers::urdf::AddModelInstanceFromUrdfFileToWorld(
+        FindResourceOrThrow("drake/examples/pendulum/Pendulum.urdf"),
+        multibody::joints::kFixed, tree_.get());
+  }
+
+  std::unique_ptr<RigidBodyTree<double>> tree_;
+};
+
+// Checked-out caches are created on demand and retained upon return.
+TEST_F(KinematicsCachePoolTest, CheckOutAndReturn) {
+  KinematicsCachePool<double> pool(*tree_);
+  EXPECT_EQ(0, pool.num_idle());
+  EXPECT_EQ(0, pool.num_created());
+
+  {
+    auto first = pool.CheckOut();
+    auto second = pool.CheckOut();
+    EXPECT_EQ(0, pool.num_idle());
+    EXPECT_EQ(2, pool.num_created());
+    EXPECT_NE(&first.cache(), &second.cache());
+  }
+  // Both caches have returned to the pool.
+  EXPECT_EQ(2, pool.num_idle());
+  EXPECT_EQ(2, pool.num_created());
+
+  // A subsequent checkout reuses a pooled cache rather than creating one.
+  { auto reused = pool.CheckOut(); }
+  EXPECT_EQ(2, pool.num_idle());
+  EXPECT_EQ(2, pool.num_created());
+}
+
+// A pooled cache produces the same kinematics results as a freshly-created
+// one, even when reused after a different configuration.
+TEST_F(KinematicsCachePoolTest, PooledCacheMatchesFreshCache) {
+  KinematicsCachePool<double> pool(*tree_);
+  const int world_index = 0;
+  const int body_index = tree_->get_num_bodies() - 1;
+  const Vector3d point(0.1, 0.2, 0.3);
+
+  VectorXd q(tree_->get_num_positions());
+  for (const double theta : {0., 0.5, -1.2}) {
+    q << theta;
+
+    auto checkout = pool.CheckOut();
+    checkout.cache().initialize(q);
+    tree_->doKinematics(checkout.cache());
+    const Vector3d pooled_result = tree_->transformPoints(
+        checkout.cache(), point, body_index, world_index);
+
+    KinematicsCache<double> fresh_cache = tree_->doKinematics(q);
+    const Vector3d fresh_result =
+        tree_->transformPoints(fresh_cache, point, body_index, world_index);
+
+    EXPECT_TRUE(CompareMatrices(fresh_result, pooled_result, 1e-14));
+  }
+}
+
+// Many threads hammering one shared const tree through the pool agree with
+// the single-threaded answers.
+TEST_F(KinematicsCachePoolTest, ParallelKinematics) {
+  KinematicsCachePool<double> pool(*tree_);
+  const int kNumThreads = 16;
+  const int kNumRepsPerThread = 50;
+  const int world_index = 0;
+  const int body_index = tree_->get_num_bodies() - 1;
+  const Vector3d point(0., 0., -0.5);
+
+  // Single-threaded reference answers, one configuration per thread.
+  std::vector<Vector3d> expected(kNumThreads);
+  for (int i = 0; i < kNumThreads; ++i) {
+    VectorXd q(tree_->get_num_positions());
+    q << 0.1 * i;
+    KinematicsCache<double> cache = tree_->doKinematics(q);
+    expected[i] = tree_->transformPoints(cache, point, body_index, world_index);
+  }
+
+  std::vector<Vector3d> actual(kNumThreads);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([this, &pool, &actual, point, i, world_index,
+                          body_index]() {
+      VectorXd q(tree_->get_num_positions());
+      q << 0.1 * i;
+      for (int rep = 0; rep < kNumRepsPerThread; ++rep) {
+        auto checkout = pool.CheckOut();
+        checkout.cache().initialize(q);
+        tree_->doKinematics(checkout.cache());
+        actual[i] = tree_->transformPoints(checkout.cache(), point, body_index,
+                                           world_index);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (int i = 0; i < kNumThreads; ++i) {
+    EXPECT_TRUE(CompareMatrices(expected[i], actual[i], 1e-14));
+  }
+  // No more caches exist than were simultaneously checked out.
+  EXPECT_GE(kNumThreads, pool.num_created());
+  EXPECT_EQ(pool.num_created(), pool.num_idle());
+}
+
+}  // namespace
+}  // namespace plants
+}  // namespace systems
+}  // namespace drake
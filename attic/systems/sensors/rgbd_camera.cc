@@ -205,6 +205,16 @@ void RgbdCamera::UpdateModelPoses(
     const BasicVector<double>& input_vector) const {
   const Eigen::VectorXd q =
       input_vector.CopyToVector().head(tree_.get_num_positions());
+
+  // The color, depth, and label output ports all require the same scene
+  // poses, so rendering all three at one time step would otherwise repeat
+  // this kinematics pass and the per-visual renderer updates three times.
+  // Skip the update when the configuration is unchanged since the last one.
+  if (q_last_rendered_.size() == q.size() && q_last_rendered_ == q) {
+    return;
+  }
+  q_last_rendered_ = q;
+
   KinematicsCache<double> cache = tree_.doKinematics(q);
 
   if (!camera_fixed_) {
@@ -335,6 +335,9 @@ class RgbdCamera final : public LeafSystem<double> {
          Eigen::AngleAxisd(M_PI_2, Eigen::Vector3d::UnitY()))};
 
   std::unique_ptr<RgbdRenderer> renderer_;
+  // The generalized positions used for the most recent UpdateModelPoses()
+  // call; empty until the first render.  See the note in UpdateModelPoses().
+  mutable Eigen::VectorXd q_last_rendered_;
 };
 
 /**
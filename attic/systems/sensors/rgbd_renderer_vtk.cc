@@ -191,6 +191,10 @@ class RgbdRendererVTK::Impl : private ModuleInitVtkRenderingOpenGL2 {
   // SDF / URDF.
   std::map<int, std::array<ActorCollection, 3>> id_object_maps_;
 
+  // Scratch buffer for reading back the encoded depth and label renderings;
+  // allocated once here rather than per frame in the render methods.
+  mutable ImageRgba8U readback_scratch_;
+
   vtkNew<ShaderCallback> uniform_setting_callback_;
 };
 
@@ -288,7 +292,7 @@ void RgbdRendererVTK::Impl::ImplRenderDepthImage(
     ImageDepth32F* depth_image_out) const {
   const int width = parent_->config().width;
   const int height = parent_->config().height;
-  ImageRgba8U image(width, height);
+  ImageRgba8U& image = readback_scratch_;
 
   // TODO(sherm1) Should evaluate VTK cache entry.
   PerformVTKUpdate(pipelines_[ImageType::kDepth]);
@@ -322,11 +326,11 @@ void RgbdRendererVTK::Impl::ImplRenderLabelImage(
     ImageLabel16I* label_image_out) const {
   const int width = parent_->config().width;
   const int height = parent_->config().height;
-  ImageRgba8U image(width, height);
+  const ImageRgba8U& image = readback_scratch_;
 
   // TODO(sherm1) Should evaluate VTK cache entry.
   PerformVTKUpdate(pipelines_[ImageType::kLabel]);
-  pipelines_[ImageType::kLabel]->exporter->Export(image.at(0, 0));
+  pipelines_[ImageType::kLabel]->exporter->Export(readback_scratch_.at(0, 0));
 
   ColorI color;
   for (int v = 0; v < height; ++v) {
@@ -347,7 +351,8 @@ RgbdRendererVTK::Impl::Impl(RgbdRendererVTK* parent,
       pipelines_{{
           std::make_unique<RenderingPipeline>(),
           std::make_unique<RenderingPipeline>(),
-          std::make_unique<RenderingPipeline>()}} {
+          std::make_unique<RenderingPipeline>()}},
+      readback_scratch_(parent->config().width, parent->config().height) {
   if (parent_->config().show_window) {
     pipelines_[ImageType::kColor]->window->SetWindowName("Color Image");
     pipelines_[ImageType::kLabel]->window->SetWindowName("Label Image");
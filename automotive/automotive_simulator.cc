@@ -743,10 +743,12 @@ template <typename T>
 PoseBundle<T> AutomotiveSimulator<T>::GetCurrentPoses() const {
   DRAKE_DEMAND(has_started());
   const auto& context = simulator_->get_context();
-  std::unique_ptr<SystemOutput<T>> system_output = diagram_->AllocateOutput();
-  diagram_->CalcOutput(context, system_output.get());
-  DRAKE_DEMAND(system_output->get_num_ports() == 1);
-  const AbstractValue* abstract_value = system_output->get_data(0);
+  if (pose_output_ == nullptr) {
+    pose_output_ = diagram_->AllocateOutput();
+  }
+  diagram_->CalcOutput(context, pose_output_.get());
+  DRAKE_DEMAND(pose_output_->get_num_ports() == 1);
+  const AbstractValue* abstract_value = pose_output_->get_data(0);
   const PoseBundle<T>& pose_bundle =
       abstract_value->GetValueOrThrow<PoseBundle<T>>();
   return pose_bundle;
@@ -325,6 +325,14 @@ class AutomotiveSimulator {
   /// Returns whether the automotive simulator has started.
   bool has_started() const { return simulator_ != nullptr; }
 
+  /// Returns the internal Simulator, e.g., to query its statistics.
+  ///
+  /// @pre Start() has been called.
+  const systems::Simulator<T>& GetSimulator() const {
+    DRAKE_DEMAND(simulator_ != nullptr);
+    return *simulator_;
+  }
+
   /// Advances simulated time by the given @p time_step increment in seconds.
   void StepBy(const T& time_step);
 
@@ -408,6 +416,10 @@ class AutomotiveSimulator {
   // For simulation.
   std::unique_ptr<systems::Diagram<T>> diagram_{};
   std::unique_ptr<systems::Simulator<T>> simulator_{};
+
+  // Scratch output for GetCurrentPoses(), allocated on first use so that
+  // per-step pose snapshots do not re-allocate the diagram's output.
+  mutable std::unique_ptr<systems::SystemOutput<T>> pose_output_{};
 };
 
 }  // namespace automotive
@@ -0,0 +1,116 @@
+#include "drake/automotive/batch_planner.h"
+
+#include <cmath>
+#include <limits>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace automotive {
+namespace {
+
+// Arbitrarily-large acceleration used to disincentivize lane changes, matching
+// MobilPlanner::kDefaultLargeAccel.
+constexpr double kDefaultLargeAccel{1e6};  // m/s^2
+
+}  // namespace
+
+Eigen::ArrayXd BatchPlanner::EvaluateIdm(
+    const IdmPlannerParameters<double>& params,
+    const Eigen::ArrayXd& ego_velocity, const Eigen::ArrayXd& target_distance,
+    const Eigen::ArrayXd& target_distance_dot) {
+  DRAKE_DEMAND(params.IsValid());
+  DRAKE_DEMAND(target_distance.size() == ego_velocity.size());
+  DRAKE_DEMAND(target_distance_dot.size() == ego_velocity.size());
+
+  const double v_ref = params.v_ref();
+  const double a = params.a();
+  const double b = params.b();
+  const double s_0 = params.s_0();
+  const double time_headway = params.time_headway();
+  const double delta = params.delta();
+
+  DRAKE_DEMAND(a > 0.);
+  DRAKE_DEMAND(b > 0.);
+  DRAKE_DEMAND((target_distance > 0.).all());
+
+  // Compute the interaction acceleration terms; cars with an infinite target
+  // distance see no interaction (free-road behavior).
+  const Eigen::ArrayXd closing_term =
+      ego_velocity * target_distance_dot / (2 * std::sqrt(a * b));
+  const Eigen::ArrayXd too_close_term = s_0 + ego_velocity * time_headway;
+  const Eigen::ArrayXd accel_interaction =
+      (target_distance < std::numeric_limits<double>::infinity())
+          .select(((closing_term + too_close_term) / target_distance).square(),
+                  0.);
+
+  // Compute the free-road acceleration terms.
+  const Eigen::ArrayXd accel_free_road = (ego_velocity.max(0.) / v_ref).pow(
+      delta);
+
+  // Compute the resultant accelerations (IDM equation).
+  return a * (1. - accel_free_road - accel_interaction);
+}
+
+Eigen::ArrayXd BatchPlanner::SaturateNetDistance(
+    const IdmPlannerParameters<double>& params,
+    const Eigen::ArrayXd& headway_distance) {
+  DRAKE_DEMAND(params.IsValid());
+
+  const double bloat_diameter = params.bloat_diameter();
+  const double distance_lower_limit = params.distance_lower_limit();
+  const Eigen::ArrayXd net_ahead =
+      (headway_distance - bloat_diameter).max(distance_lower_limit);
+  const Eigen::ArrayXd net_behind =
+      (headway_distance + bloat_diameter).min(-distance_lower_limit);
+  return (headway_distance >= 0.).select(net_ahead, net_behind);
+}
+
+Eigen::ArrayXd BatchPlanner::ComputeIncentives(
+    const MobilPlannerParameters<double>& mobil_params,
+    const Eigen::ArrayXd& ego_old_accel, const Eigen::ArrayXd& ego_new_accel,
+    const Eigen::ArrayXd& trailing_delta_accel_this,
+    const Eigen::ArrayXd& trailing_old_accel_other,
+    const Eigen::ArrayXd& trailing_new_accel_other) {
+  DRAKE_DEMAND(mobil_params.IsValid());
+  const int num_cars = static_cast<int>(ego_old_accel.size());
+  DRAKE_DEMAND(ego_new_accel.size() == num_cars);
+  DRAKE_DEMAND(trailing_delta_accel_this.size() == num_cars);
+  DRAKE_DEMAND(trailing_old_accel_other.size() == num_cars);
+  DRAKE_DEMAND(trailing_new_accel_other.size() == num_cars);
+
+  const Eigen::ArrayXd ego_delta_accel = ego_new_accel - ego_old_accel;
+  const Eigen::ArrayXd trailing_delta_accel_other =
+      trailing_new_accel_other - trailing_old_accel_other;
+
+  // Compute the incentives as weighted sums of the net accelerations for the
+  // ego and each immediate neighbor, disincentivizing any lane change that
+  // discomforts the candidate lane's trailing car too much.
+  const Eigen::ArrayXd incentives =
+      ego_delta_accel +
+      mobil_params.p() *
+          (trailing_delta_accel_other + trailing_delta_accel_this);
+  return (trailing_new_accel_other < -mobil_params.max_deceleration())
+      .select(-kDefaultLargeAccel, incentives);
+}
+
+Eigen::ArrayXi BatchPlanner::SelectLaneChanges(
+    const MobilPlannerParameters<double>& mobil_params,
+    const Eigen::ArrayXd& incentive_left,
+    const Eigen::ArrayXd& incentive_right) {
+  DRAKE_DEMAND(mobil_params.IsValid());
+  DRAKE_DEMAND(incentive_right.size() == incentive_left.size());
+
+  // Switch to the lane with the highest incentive score greater than the
+  // threshold, staying in the current lane otherwise.  Ties go to the left
+  // lane, as in MobilPlanner.
+  const double threshold = mobil_params.threshold();
+  const Eigen::Array<bool, Eigen::Dynamic, 1> left_wins =
+      incentive_left >= incentive_right;
+  return (left_wins && (incentive_left > threshold))
+      .select(1, (!left_wins && (incentive_right > threshold))
+                     .select(-1, Eigen::ArrayXi::Zero(incentive_left.size())));
+}
+
+}  // namespace automotive
+}  // namespace drake
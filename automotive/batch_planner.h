@@ -0,0 +1,93 @@
+#pragma once
+
+#include "drake/automotive/gen/idm_planner_parameters.h"
+#include "drake/automotive/gen/mobil_planner_parameters.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace automotive {
+
+/// BatchPlanner evaluates the IDM equation and the MOBIL incentive criterion
+/// for an entire population of vehicles at once.  All inputs are laid out in
+/// structure-of-arrays form — one Eigen array per kinematic quantity, indexed
+/// by car — so a step over thousands of background vehicles reduces to a
+/// handful of vectorized array expressions instead of one System evaluation
+/// per car.
+///
+/// Each kernel matches its scalar counterpart exactly:
+///
+/// - EvaluateIdm() is IdmPlanner::Evaluate() applied elementwise.
+/// - SaturateNetDistance() is the headway saturation that
+///   MobilPlanner::EvaluateIdm() applies before invoking the IDM equation.
+/// - ComputeIncentives() is the MOBIL weighted-sum incentive, including the
+///   trailing-car comfort gate.
+/// - SelectLaneChanges() applies MobilPlanner's threshold and tie-breaking
+///   rules to a pair of incentive arrays.
+///
+/// Neighbor lookups (leading/trailing headway distances and closing speeds)
+/// are the caller's responsibility; TrafficPoseIndex provides them with a
+/// per-lane binary search.
+///
+/// Only double is supported: background-crowd simulation has no use for
+/// derivatives or symbolic analysis, and the scalar planners remain available
+/// for ego vehicles that need them.
+class BatchPlanner {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BatchPlanner)
+  BatchPlanner() = delete;
+
+  /// Evaluates the IDM equation elementwise over a population of cars, given
+  /// per-car velocities @p ego_velocity, net distances to the respective lead
+  /// cars @p target_distance, and closing velocities @p target_distance_dot.
+  /// Entries of @p target_distance at infinity contribute no interaction term
+  /// (free-road behavior).  All arrays must have the same size; the returned
+  /// array holds one longitudinal acceleration per car.
+  static Eigen::ArrayXd EvaluateIdm(const IdmPlannerParameters<double>& params,
+                                    const Eigen::ArrayXd& ego_velocity,
+                                    const Eigen::ArrayXd& target_distance,
+                                    const Eigen::ArrayXd& target_distance_dot);
+
+  /// Converts raw headway distances into the saturated net distances expected
+  /// by EvaluateIdm(), elementwise: subtracts the bloat diameter and keeps
+  /// each magnitude at least distance_lower_limit() away from zero to prevent
+  /// near-singular IDM solutions, preserving sign.
+  static Eigen::ArrayXd SaturateNetDistance(
+      const IdmPlannerParameters<double>& params,
+      const Eigen::ArrayXd& headway_distance);
+
+  /// Computes the MOBIL incentive for one candidate lane, elementwise over a
+  /// population of cars.  Inputs are the per-car accelerations produced by
+  /// EvaluateIdm():
+  ///
+  /// - @p ego_old_accel / @p ego_new_accel: the ego acceleration in its
+  ///   current lane and in the candidate lane.
+  /// - @p trailing_delta_accel_this: acceleration delta of the trailing car
+  ///   in the ego's current lane were the ego to leave it.
+  /// - @p trailing_old_accel_other / @p trailing_new_accel_other: the
+  ///   candidate lane's trailing-car acceleration without and with the ego
+  ///   in that lane.
+  ///
+  /// Cars whose lane change would force the candidate lane's trailing car
+  /// below the comfortable deceleration bound receive a large disincentive,
+  /// as in MobilPlanner.
+  static Eigen::ArrayXd ComputeIncentives(
+      const MobilPlannerParameters<double>& mobil_params,
+      const Eigen::ArrayXd& ego_old_accel, const Eigen::ArrayXd& ego_new_accel,
+      const Eigen::ArrayXd& trailing_delta_accel_this,
+      const Eigen::ArrayXd& trailing_old_accel_other,
+      const Eigen::ArrayXd& trailing_new_accel_other);
+
+  /// Resolves per-car lane-change decisions from left- and right-lane
+  /// incentives, elementwise: +1 selects the left lane, -1 the right lane and
+  /// 0 keeps the current lane.  The higher incentive wins (ties go left, as
+  /// in MobilPlanner) and must exceed the MOBIL threshold.  Cars without a
+  /// neighboring lane should be given -infinity for that side.
+  static Eigen::ArrayXi SelectLaneChanges(
+      const MobilPlannerParameters<double>& mobil_params,
+      const Eigen::ArrayXd& incentive_left,
+      const Eigen::ArrayXd& incentive_right);
+};
+
+}  // namespace automotive
+}  // namespace drake
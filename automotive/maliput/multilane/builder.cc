@@ -1,6 +1,7 @@
 #include "drake/automotive/maliput/multilane/builder.h"
 
 #include <cmath>
+#include <functional>
 #include <utility>
 
 #include "drake/automotive/maliput/multilane/arc_road_curve.h"
@@ -11,6 +12,7 @@
 #include "drake/automotive/maliput/multilane/road_geometry.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/text_logging.h"
+#include "drake/systems/framework/thread_pool.h"
 
 namespace drake {
 namespace maliput {
@@ -484,10 +486,8 @@ void Builder::AttachBranchPoint(
 }
 
 
-std::vector<Lane*> Builder::BuildConnection(
-    const Connection* const conn, Junction* const junction,
-    RoadGeometry* const road_geometry,
-    std::map<Endpoint, BranchPoint*, EndpointFuzzyOrder>* const bp_map) const {
+std::vector<Lane*> Builder::BuildConnection(const Connection* const conn,
+                                            Junction* const junction) const {
   Segment* segment = junction->NewSegment(
       api::SegmentId{std::string("s:") + conn->id()}, conn->CreateRoadCurve(),
       conn->r_min(), conn->r_max(), elevation_bounds_);
@@ -497,16 +497,25 @@ std::vector<Lane*> Builder::BuildConnection(
         segment->NewLane(api::LaneId{std::string("l:") + conn->id() +
                                      std::string("_") + std::to_string(i)},
                          conn->lane_offset(i),
-                         {-conn->lane_width() / 2., conn->lane_width() / 2.});
-    AttachBranchPoint(conn->LaneStart(i), lane, api::LaneEnd::kStart,
-                      road_geometry, bp_map);
-    AttachBranchPoint(conn->LaneEnd(i), lane, api::LaneEnd::kFinish,
-                      road_geometry, bp_map);
+                         {-conn->lane_width() / 2., conn->lane_width() / 2.},
+                         true /* defer_curve_tables */);
     lanes.push_back(lane);
   }
   return lanes;
 }
 
+void Builder::AttachConnectionBranchPoints(
+    const Connection* const conn, const std::vector<Lane*>& lanes,
+    RoadGeometry* const road_geometry,
+    std::map<Endpoint, BranchPoint*, EndpointFuzzyOrder>* const bp_map) const {
+  for (int i = 0; i < conn->num_lanes(); i++) {
+    AttachBranchPoint(conn->LaneStart(i), lanes[i], api::LaneEnd::kStart,
+                      road_geometry, bp_map);
+    AttachBranchPoint(conn->LaneEnd(i), lanes[i], api::LaneEnd::kFinish,
+                      road_geometry, bp_map);
+  }
+}
+
 std::unique_ptr<const api::RoadGeometry> Builder::Build(
     const api::RoadGeometryId& id) const {
   auto road_geometry = std::make_unique<RoadGeometry>(
@@ -515,11 +524,15 @@ std::unique_ptr<const api::RoadGeometry> Builder::Build(
       (EndpointFuzzyOrder(linear_tolerance_)));
   std::map<const Connection*, std::vector<Lane*>> lane_map;
   std::map<const Connection*, bool> connection_was_built;
+  std::vector<const Connection*> build_order;
 
   for (const std::unique_ptr<Connection>& connection : connections_) {
     connection_was_built.emplace(connection.get(), false);
   }
 
+  // Creates the junctions, segments, and lanes serially; each lane's curve
+  // tables are deferred so that the expensive precomputation can be sharded
+  // across worker threads below.
   for (const std::unique_ptr<Group>& group : groups_) {
     Junction* junction =
         road_geometry->NewJunction(
@@ -528,8 +541,8 @@ std::unique_ptr<const api::RoadGeometry> Builder::Build(
     for (auto& connection : group->connections()) {
       drake::log()->debug("connection: {}", connection->id());
       DRAKE_DEMAND(!connection_was_built[connection]);
-      lane_map[connection] = BuildConnection(
-          connection, junction, road_geometry.get(), &bp_map);
+      lane_map[connection] = BuildConnection(connection, junction);
+      build_order.push_back(connection);
       connection_was_built[connection] = true;
     }
   }
@@ -543,9 +556,38 @@ std::unique_ptr<const api::RoadGeometry> Builder::Build(
             api::JunctionId{std::string("j:") + connection->id()});
     drake::log()->debug("junction: {}", junction->id().string());
     drake::log()->debug("connection: {}", connection->id());
-    lane_map[connection.get()] =
-        BuildConnection(connection.get(),
-                        junction, road_geometry.get(), &bp_map);
+    lane_map[connection.get()] = BuildConnection(connection.get(), junction);
+    build_order.push_back(connection.get());
+  }
+
+  // Precomputes the lanes' curve tables with one task per connection;
+  // connections are mutually independent, but the lanes of one connection
+  // share a RoadCurve whose optimization entry points are not thread-safe,
+  // so they stay within a single task.
+  if (build_order.size() > 1) {
+    std::vector<std::function<void()>> tasks;
+    tasks.reserve(build_order.size());
+    for (const Connection* connection : build_order) {
+      const std::vector<Lane*>& lanes = lane_map[connection];
+      tasks.push_back([&lanes]() {
+        for (Lane* lane : lanes) {
+          lane->PrecomputeCurveTables();
+        }
+      });
+    }
+    systems::internal::ThreadPool(0 /* hardware concurrency */)
+        .RunInParallel(tasks);
+  } else if (build_order.size() == 1) {
+    for (Lane* lane : lane_map[build_order.front()]) {
+      lane->PrecomputeCurveTables();
+    }
+  }
+
+  // Attaches the branch points serially, in construction order, now that
+  // every lane can answer length and bounds queries.
+  for (const Connection* connection : build_order) {
+    AttachConnectionBranchPoints(connection, lane_map[connection],
+                                 road_geometry.get(), &bp_map);
   }
 
   for (const DefaultBranch& def : default_branches_) {
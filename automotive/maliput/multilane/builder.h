@@ -701,10 +701,19 @@ class Builder : public BuilderBase {
     api::LaneEnd::Which out_end{};
   };
 
-  std::vector<Lane*> BuildConnection(
-      const Connection* const cnx, Junction* const junction,
+  // Creates the given connection's segment and lanes within `junction`. The
+  // lanes' curve tables are deferred; Build() precomputes them in parallel
+  // before attaching branch points.
+  std::vector<Lane*> BuildConnection(const Connection* const cnx,
+                                     Junction* const junction) const;
+
+  // Attaches both ends of every lane of `cnx` to branch points.
+  // @pre The lanes' curve tables have been precomputed.
+  void AttachConnectionBranchPoints(
+      const Connection* const cnx, const std::vector<Lane*>& lanes,
       RoadGeometry* const rg,
-      std::map<Endpoint, BranchPoint*, EndpointFuzzyOrder>* const bp_map) const;
+      std::map<Endpoint, BranchPoint*, EndpointFuzzyOrder>* const bp_map)
+      const;
 
   BranchPoint* FindOrCreateBranchPoint(
       const Endpoint& point,
@@ -83,6 +83,21 @@ api::LanePosition Lane::DoToLanePosition(
       const api::GeoPosition& geo_position,
       api::GeoPosition* nearest_position,
       double* distance) const {
+  // An exact repeat of the previous query short-circuits to the memoized
+  // result. The memo is copied out under the lock; see its declaration.
+  {
+    std::lock_guard<std::mutex> lock(memo_mutex_);
+    if (memo_.valid && geo_position.xyz() == memo_.query_xyz) {
+      if (nearest_position != nullptr) {
+        *nearest_position = memo_.nearest_position;
+      }
+      if (distance != nullptr) {
+        *distance = memo_.distance;
+      }
+      return memo_.lane_position;
+    }
+  }
+
   // Computes the lateral extents of the surface in terms of the definition of
   // the reference curve. It implies a translation of the driveable bounds
   // center by the lane by r0 distance.
@@ -93,19 +108,37 @@ api::LanePosition Lane::DoToLanePosition(
   // coordinate because of the offset.
   const V3 lane_position_in_segment_curve_frame = road_curve_->ToCurveFrame(
       geo_position.xyz(), r_min, r_max, elevation_bounds_);
-  const double s = s_from_p_at_r0_(lane_position_in_segment_curve_frame[0]);
+  const double p = lane_position_in_segment_curve_frame[0];
+  const double s = s_from_p_at_r0_(p);
   const api::LanePosition lane_position = api::LanePosition(
       s,
       lane_position_in_segment_curve_frame[1] - r0_,
       lane_position_in_segment_curve_frame[2]);
 
-  const api::GeoPosition nearest = ToGeoPosition(lane_position);
+  // Maps the nearest point back to world coordinates directly from the curve
+  // parameter p already in hand, rather than round-tripping through
+  // ToGeoPosition() (which would re-invert p from s).
+  const V3 nearest_xyz =
+      road_curve_->W_of_prh(p, lane_position_in_segment_curve_frame[1],
+                            lane_position_in_segment_curve_frame[2]);
+  const api::GeoPosition nearest{nearest_xyz.x(), nearest_xyz.y(),
+                                 nearest_xyz.z()};
   if (nearest_position != nullptr) {
     *nearest_position = nearest;
   }
 
+  const double nearest_distance = (nearest.xyz() - geo_position.xyz()).norm();
   if (distance != nullptr) {
-    *distance = (nearest.xyz() - geo_position.xyz()).norm();
+    *distance = nearest_distance;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(memo_mutex_);
+    memo_.valid = true;
+    memo_.query_xyz = geo_position.xyz();
+    memo_.lane_position = lane_position;
+    memo_.nearest_position = nearest;
+    memo_.distance = nearest_distance;
   }
 
   return lane_position;
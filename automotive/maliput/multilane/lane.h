@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 
 #include "drake/automotive/maliput/api/branch_point.h"
 #include "drake/automotive/maliput/api/lane.h"
@@ -64,6 +65,16 @@ class Lane : public api::Lane {
     DRAKE_DEMAND(lane_bounds_.min() >= driveable_bounds_.min());
     DRAKE_DEMAND(lane_bounds_.max() <= driveable_bounds_.max());
     DRAKE_DEMAND(road_curve != nullptr);
+  }
+
+  /// Precomputes this lane's curve tables: the optimized s <-> p mapping
+  /// functions and the lane length derived from them. Segment::NewLane()
+  /// calls this by default; it is deferrable only so that Builder::Build()
+  /// can shard the precomputation of many lanes across worker threads. Must
+  /// be called exactly once, before any query on this lane; lanes sharing a
+  /// RoadCurve must not precompute concurrently.
+  void PrecomputeCurveTables() {
+    DRAKE_DEMAND(s_from_p_at_r0_ == nullptr);
     s_from_p_at_r0_ = road_curve_->OptimizeCalcSFromP(r0_);
     p_from_s_at_r0_ = road_curve_->OptimizeCalcPFromS(r0_);
     lane_length_ = s_from_p_at_r0_(1.0);
@@ -168,6 +179,24 @@ class Lane : public api::Lane {
   std::function<double(double)> s_from_p_at_r0_;
   std::function<double(double)> p_from_s_at_r0_;
   double lane_length_;
+
+  // Single-entry memo for DoToLanePosition().  Planner stacks (e.g.
+  // IdmController and MobilPlanner instances sharing a pose bundle) probe the
+  // same world points against the same lanes repeatedly within a step; an
+  // exact repeat of the previous query skips the inverse-geometry evaluation
+  // entirely.  Those very systems may also probe one shared Lane
+  // concurrently (e.g. from a parallel diagram evaluation), so the memo is
+  // guarded by a mutex; it is read and written whole under the lock so that
+  // concurrent queries never observe a torn entry.
+  struct ToLanePositionMemo {
+    bool valid{false};
+    V3 query_xyz;
+    api::LanePosition lane_position;
+    api::GeoPosition nearest_position;
+    double distance{};
+  };
+  mutable std::mutex memo_mutex_;
+  mutable ToLanePositionMemo memo_;
 };
 
 
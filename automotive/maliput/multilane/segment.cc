@@ -9,7 +9,8 @@ const api::Junction* Segment::do_junction() const {
 }
 
 Lane* Segment::NewLane(api::LaneId id, double r0,
-                       const api::RBounds& lane_bounds) {
+                       const api::RBounds& lane_bounds,
+                       bool defer_curve_tables) {
   const int index = lanes_.size();
   DRAKE_DEMAND(r_min_ <= r0 && r0 <= r_max_);
   if (lanes_.size() != 0) {
@@ -23,6 +24,9 @@ Lane* Segment::NewLane(api::LaneId id, double r0,
                              elevation_bounds_, road_curve_.get(), r0);
   lanes_.push_back(std::move(lane_));
   Lane* result = lanes_.back().get();
+  if (!defer_curve_tables) {
+    result->PrecomputeCurveTables();
+  }
   register_lane_(result);
   return result;
 }
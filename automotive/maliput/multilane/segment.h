@@ -76,8 +76,13 @@ class Segment : public api::Segment {
   /// @param lane_bounds Nominal bounds of the lane, uniform along the entire
   /// reference path. It must fit inside segments bounds when those are
   /// translated to `r0` offset distance.
+  /// @param defer_curve_tables If true, the new Lane's curve tables are not
+  /// precomputed; the caller must invoke Lane::PrecomputeCurveTables() before
+  /// querying the lane. Used by Builder::Build() to shard the precomputation
+  /// of many lanes across worker threads.
   /// @return A Lane object.
-  Lane* NewLane(api::LaneId id, double r0, const api::RBounds& lane_bounds);
+  Lane* NewLane(api::LaneId id, double r0, const api::RBounds& lane_bounds,
+                bool defer_curve_tables = false);
 
   ~Segment() override = default;
 
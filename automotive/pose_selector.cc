@@ -319,6 +319,115 @@ ClosestPose<T> FindSingleClosestInDefaultPath(
   return default_result;
 }
 
+// Index-based variant of FindSingleClosestInDefaultPath(): instead of probing
+// every traffic pose against every scanned lane, consults the `s`-sorted
+// per-lane entries of @p traffic_index, locating the neighbor in the first
+// lane by binary search and taking the nearest entry of each ongoing lane
+// directly.  The candidate-selection rules (direction of travel, equal-`s`
+// ties counted as behind, and discarding the ego's own pose) match the
+// exhaustive scan.
+template <typename T>
+ClosestPose<T> FindSingleClosestInDefaultPathIndexed(
+    const Lane* lane, const PoseVector<T>& ego_pose,
+    const PoseBundle<T>& traffic_poses,
+    const TrafficPoseIndex<T>& traffic_index, const T& scan_distance,
+    const AheadOrBehind side) {
+  using Entry = typename TrafficPoseIndex<T>::Entry;
+
+  DRAKE_DEMAND(lane != nullptr);
+
+  const GeoPositionT<T> ego_geo_position =
+      GeoPositionT<T>::FromXyz(ego_pose.get_isometry().translation());
+  const LanePositionT<T> ego_lane_position =
+      lane->ToLanePositionT<T>(ego_geo_position, nullptr, nullptr);
+  LaneDirection lane_direction =
+      CalcLaneDirection<T>(lane, ego_lane_position, ego_pose.get_rotation(),
+                           side);
+
+  ClosestPose<T> result;
+  result.odometry = MakeInfiniteOdometry<T>(lane_direction, ego_pose);
+  result.distance = MakeInfiniteDistance<T>(ego_pose);
+  const ClosestPose<T> default_result = result;
+
+  const T ego_s = CalcLaneProgress<T>(lane_direction, ego_lane_position);
+  const double ego_s_raw = ExtractDoubleOrThrow(ego_lane_position.s());
+  T distance_scanned = T(-ego_s);
+  bool in_first_lane = true;
+
+  while (distance_scanned < scan_distance) {
+    const std::vector<Entry>& entries =
+        traffic_index.entries_in_lane(lane_direction.lane);
+    const bool with_s = lane_direction.with_s;
+
+    // Walk the lane's entries in order of increasing progress along the scan
+    // direction, starting (in the first lane) at the entry nearest the ego.
+    // The first entry passing the selection rules is the lane's closest
+    // candidate.
+    const Entry* candidate{nullptr};
+    T candidate_progress{};
+    auto consider = [&](const Entry& entry) {
+      const T progress =
+          CalcLaneProgress<T>(lane_direction, entry.lane_position);
+      if (in_first_lane) {
+        const T s_delta = progress - ego_s;
+        // Cars with identical s-values as the ego but shifted laterally are
+        // treated as `kBehind` cars.
+        if (s_delta < 0.) return false;
+        if (side == AheadOrBehind::kAhead && s_delta == 0.) return false;
+        if (ego_geo_position == entry.geo_position) return false;
+      }
+      candidate = &entry;
+      candidate_progress = progress;
+      return true;
+    };
+    if (with_s) {
+      auto it = entries.begin();
+      if (in_first_lane) {
+        it = std::lower_bound(
+            entries.begin(), entries.end(), ego_s_raw,
+            [](const Entry& entry, double s) { return entry.s < s; });
+      }
+      for (; it != entries.end(); ++it) {
+        if (consider(*it)) break;
+      }
+    } else {
+      auto it = entries.end();
+      if (in_first_lane) {
+        it = std::upper_bound(
+            entries.begin(), entries.end(), ego_s_raw,
+            [](double s, const Entry& entry) { return s < entry.s; });
+      }
+      while (it != entries.begin()) {
+        --it;
+        if (consider(*it)) break;
+      }
+    }
+
+    if (candidate != nullptr) {
+      if (distance_scanned + candidate_progress < scan_distance) {
+        result.odometry = RoadOdometry<T>(
+            lane_direction.lane, candidate->lane_position,
+            traffic_poses.get_velocity(candidate->pose_index));
+        result.distance = distance_scanned + candidate_progress;
+        return result;
+      }
+      // The nearest car along the path lies beyond scan_distance; any farther
+      // lane can only do worse.
+      return default_result;
+    }
+
+    // Increment distance_scanned and obtain the next lane_direction in the
+    // scanned sequence.
+    distance_scanned += T(lane_direction.lane->length());
+    in_first_lane = false;
+    GetDefaultOrFirstOngoingLane(&lane_direction);
+    if (lane_direction.lane == nullptr) {
+      return default_result;
+    }
+  }
+  return default_result;
+}
+
 // Returns true if `lane0` has an equal identifier as `lane1`, and false
 // otherwise.  The result is trivially false if either is nullptr.
 bool IsEqual(const Lane* lane0, const Lane* lane1) {
@@ -523,6 +632,51 @@ std::map<AheadOrBehind, const ClosestPose<T>> PoseSelector<T>::FindClosestPair(
   return result;
 }
 
+template <typename T>
+std::map<AheadOrBehind, const ClosestPose<T>> PoseSelector<T>::FindClosestPair(
+    const Lane* lane, const PoseVector<T>& ego_pose,
+    const PoseBundle<T>& traffic_poses,
+    const TrafficPoseIndex<T>& traffic_index, const T& scan_distance,
+    ScanStrategy path_or_branches) {
+  std::map<AheadOrBehind, const ClosestPose<T>> result;
+  for (auto side : {AheadOrBehind::kAhead, AheadOrBehind::kBehind}) {
+    result.insert(std::make_pair(
+        side,
+        FindSingleClosestPose(lane, ego_pose, traffic_poses, traffic_index,
+                              scan_distance, side, path_or_branches)));
+  }
+  return result;
+}
+
+template <typename T>
+ClosestPose<T> PoseSelector<T>::FindSingleClosestPose(
+    const Lane* lane, const PoseVector<T>& ego_pose,
+    const PoseBundle<T>& traffic_poses,
+    const TrafficPoseIndex<T>& traffic_index, const T& scan_distance,
+    const AheadOrBehind side, ScanStrategy path_or_branches) {
+  // Find any leading traffic cars along the same default path as the ego
+  // vehicle, using the index's per-lane sorted entries.
+  const ClosestPose<T> result_in_path = FindSingleClosestInDefaultPathIndexed(
+      lane, ego_pose, traffic_poses, traffic_index, scan_distance, side);
+  if (path_or_branches == ScanStrategy::kPath) return result_in_path;
+
+  const std::vector<LaneEndDistance<T>> branches =
+      FindConfluentBranches(lane, ego_pose, scan_distance, side);
+  if (branches.size() == 0) return result_in_path;
+
+  // Find any leading traffic cars in lanes leading into the ego vehicle's
+  // default path.  The branch scan traverses lane sequences per traffic car,
+  // which the per-lane index does not accelerate; fall back to the
+  // exhaustive scan.
+  const ClosestPose<T> result_in_branch = FindSingleClosestInBranches(
+      lane, ego_pose, traffic_poses, scan_distance, side, branches);
+
+  if (result_in_path.distance <= result_in_branch.distance) {
+    return result_in_path;
+  }
+  return result_in_branch;
+}
+
 template <typename T>
 ClosestPose<T> PoseSelector<T>::FindSingleClosestPose(
     const Lane* lane, const PoseVector<T>& ego_pose,
@@ -11,6 +11,7 @@
 #include "drake/automotive/maliput/api/lane_data.h"
 #include "drake/automotive/maliput/api/road_geometry.h"
 #include "drake/automotive/road_odometry.h"
+#include "drake/automotive/traffic_pose_index.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/systems/rendering/pose_bundle.h"
 #include "drake/systems/rendering/pose_vector.h"
@@ -117,6 +118,21 @@ class PoseSelector {
       const systems::rendering::PoseBundle<T>& traffic_poses,
       const T& scan_distance, ScanStrategy path_or_branches);
 
+  /// Variant of FindClosestPair() that consults a prebuilt TrafficPoseIndex
+  /// over @p traffic_poses instead of re-scanning the whole bundle per lane.
+  /// With the index, the default-path scan locates neighbors within each lane
+  /// by binary search over that lane's `s`-sorted entries, so the cost per
+  /// query is logarithmic in the number of cars sharing a lane.  Build the
+  /// index once per PoseBundle per time step and share it among all selector
+  /// queries against that bundle.  ScanStrategy::kBranches queries fall back
+  /// to the exhaustive branch scan for traffic in confluent lanes.
+  static std::map<AheadOrBehind, const ClosestPose<T>> FindClosestPair(
+      const maliput::api::Lane* lane,
+      const systems::rendering::PoseVector<T>& ego_pose,
+      const systems::rendering::PoseBundle<T>& traffic_poses,
+      const TrafficPoseIndex<T>& traffic_index, const T& scan_distance,
+      ScanStrategy path_or_branches);
+
   /// Same as PoseSelector::FindClosestPair() except that it returns a single
   /// ClosestPose for either the vehicle ahead (AheadOrBehind::kAhead) or behind
   /// (AheadOrBehind::kBehind).
@@ -137,6 +153,16 @@ class PoseSelector {
       const T& scan_distance, const AheadOrBehind side,
       ScanStrategy path_or_branches);
 
+  /// Variant of FindSingleClosestPose() that consults a prebuilt
+  /// TrafficPoseIndex; see the indexed FindClosestPair() overload for the
+  /// sharing and complexity discussion.
+  static ClosestPose<T> FindSingleClosestPose(
+      const maliput::api::Lane* lane,
+      const systems::rendering::PoseVector<T>& ego_pose,
+      const systems::rendering::PoseBundle<T>& traffic_poses,
+      const TrafficPoseIndex<T>& traffic_index, const T& scan_distance,
+      const AheadOrBehind side, ScanStrategy path_or_branches);
+
   /// Extracts the vehicle's `s`-direction velocity based on its RoadOdometry @p
   /// road_odometry in the Lane coordinate frame.  Assumes the road has zero
   /// elevation and superelevation.
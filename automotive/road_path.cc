@@ -1,13 +1,19 @@
 #include "drake/automotive/road_path.h"
 
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <string>
 #include <vector>
 
 #include "drake/automotive/maliput/api/branch_point.h"
+#include "drake/automotive/maliput/api/junction.h"
 #include "drake/automotive/maliput/api/lane.h"
 #include "drake/automotive/maliput/api/lane_data.h"
+#include "drake/automotive/maliput/api/segment.h"
 #include "drake/common/cond.h"
 #include "drake/common/drake_assert.h"
-#include "drake/common/unused.h"
+#include "drake/common/never_destroyed.h"
 #include "drake/math/saturate.h"
 
 namespace drake {
@@ -20,17 +26,68 @@ using maliput::api::LaneEndSet;
 using maliput::api::RoadGeometry;
 using trajectories::PiecewisePolynomial;
 
+namespace {
+
+// Iteration cap and convergence threshold for the Newton refinement in
+// GetClosestPathPosition().
+constexpr int kMaxNewtonIterations{8};
+constexpr double kNewtonTolerance{1e-9};
+
+}  // namespace
+
 template <typename T>
 RoadPath<T>::RoadPath(const LaneDirection& initial_lane_direction,
                       const T& step_size, int num_breaks)
     : path_(MakePiecewisePolynomial(initial_lane_direction, step_size,
                                     num_breaks)),
       path_prime_(path_.derivative(1 /* 1st derivative */)),
-      path_double_prime_(path_.derivative(2 /* 2nd derivative */)) {}
+      path_double_prime_(path_.derivative(2 /* 2nd derivative */)) {
+  // Sample the path at each break and at segment midpoints, so that the
+  // nearest sample is never more than a quarter of a step away from the true
+  // projection of a nearby query point.
+  const std::vector<double>& breaks = path_.get_segment_times();
+  for (int i = 0; i < static_cast<int>(breaks.size()); ++i) {
+    s_samples_.emplace_back(T(breaks[i]));
+    if (i + 1 < static_cast<int>(breaks.size())) {
+      s_samples_.emplace_back(T(0.5 * (breaks[i] + breaks[i + 1])));
+    }
+  }
+  for (const T& s : s_samples_) {
+    xyz_samples_.emplace_back(Vector3<T>(path_.value(s)));
+  }
+}
 
 template <typename T>
 RoadPath<T>::~RoadPath() {}
 
+template <typename T>
+std::shared_ptr<const RoadPath<T>> RoadPath<T>::MakeShared(
+    const LaneDirection& initial_lane_direction, const T& step_size,
+    int num_breaks) {
+  DRAKE_DEMAND(initial_lane_direction.lane != nullptr);
+  const RoadGeometry* road = initial_lane_direction.lane->segment()
+                                 ->junction()
+                                 ->road_geometry();
+  // Key the cache on everything MakePiecewisePolynomial() depends upon.
+  const std::string key =
+      road->id().string() + "|" + initial_lane_direction.lane->id().string() +
+      "|" + (initial_lane_direction.with_s ? "+s" : "-s") + "|" +
+      std::to_string(step_size) + "|" + std::to_string(num_breaks);
+
+  static never_destroyed<std::mutex> mutex;
+  static never_destroyed<
+      std::map<std::string, std::weak_ptr<const RoadPath<T>>>>
+      cache;
+  std::lock_guard<std::mutex> lock(mutex.access());
+  std::shared_ptr<const RoadPath<T>> path = cache.access()[key].lock();
+  if (path == nullptr) {
+    path = std::make_shared<const RoadPath<T>>(initial_lane_direction,
+                                               step_size, num_breaks);
+    cache.access()[key] = path;
+  }
+  return path;
+}
+
 template <typename T>
 const PiecewisePolynomial<T>& RoadPath<T>::get_path() const {
   return path_;
@@ -39,8 +96,36 @@ const PiecewisePolynomial<T>& RoadPath<T>::get_path() const {
 template <typename T>
 const T RoadPath<T>::GetClosestPathPosition(const Vector3<T>& geo_pos,
                                             const T& s_guess) const {
-  unused(geo_pos, s_guess);
-  DRAKE_ABORT();
+  const T s_min{T(path_.start_time())};
+  const T s_max{T(path_.end_time())};
+
+  // Seed the search from the precomputed sample table, or from s_guess when
+  // it is already closer, so that no global iterative projection is needed.
+  T s_best{math::saturate(s_guess, s_min, s_max)};
+  T distance_squared_best{
+      (Vector3<T>(path_.value(s_best)) - geo_pos).squaredNorm()};
+  for (int i = 0; i < static_cast<int>(s_samples_.size()); ++i) {
+    const T distance_squared{(xyz_samples_[i] - geo_pos).squaredNorm()};
+    if (distance_squared < distance_squared_best) {
+      distance_squared_best = distance_squared;
+      s_best = s_samples_[i];
+    }
+  }
+
+  // Refine the seed with Newton steps on the squared-distance objective
+  // 0.5 * |W(s) - geo_pos|², whose gradient is W'(s)·(W(s) - geo_pos).
+  for (int i = 0; i < kMaxNewtonIterations; ++i) {
+    const Vector3<T> W{path_.value(s_best)};
+    const Vector3<T> W_prime{path_prime_.value(s_best)};
+    const Vector3<T> W_double_prime{path_double_prime_.value(s_best)};
+    const T gradient{W_prime.dot(W - geo_pos)};
+    const T hessian{W_prime.squaredNorm() + W_double_prime.dot(W - geo_pos)};
+    if (hessian <= T(0.)) break;  // Not locally convex; keep the seed.
+    const T step{-gradient / hessian};
+    s_best = math::saturate(s_best + step, s_min, s_max);
+    if (std::abs(step) < kNewtonTolerance) break;
+  }
+  return s_best;
 }
 
 template <typename T>
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "drake/automotive/lane_direction.h"
 #include "drake/automotive/maliput/api/road_geometry.h"
 #include "drake/common/drake_copyable.h"
@@ -43,11 +46,23 @@ class RoadPath {
            int num_breaks);
   ~RoadPath();
 
+  /// Returns a shared, immutable RoadPath for the given route parameters,
+  /// constructing it on first use.  Paths are cached by road geometry, initial
+  /// lane, direction of travel, step size and number of breaks, so that many
+  /// agents following the same route share a single instance instead of each
+  /// building an identical copy.  The cache holds weak references; a path is
+  /// rebuilt if all of its prior users have released it.
+  static std::shared_ptr<const RoadPath<T>> MakeShared(
+      const LaneDirection& initial_lane_direction, const T& step_size,
+      int num_breaks);
+
   const trajectories::PiecewisePolynomial<T>& get_path() const;
 
-  /// Computes the closest `s`-position on the path to an arbitrary point in
-  /// the world frame of the provided Maliput Lanes.  (Not yet implemented)
-  // TODO(jadecastro): Implement this.
+  /// Computes the closest `s`-position on the path to an arbitrary point
+  /// @p geo_position in the world frame.  The search is seeded from a table of
+  /// path samples precomputed at construction (or from @p s_guess, whichever
+  /// is closer) and then refined with a few Newton steps, so no global
+  /// iterative projection is performed per query.
   const T GetClosestPathPosition(const Vector3<T>& geo_position,
                                  const T& s_guess) const;
 
@@ -71,6 +86,11 @@ class RoadPath {
 
   // Second derivative of path_.
   trajectories::PiecewisePolynomial<T> path_double_prime_;
+
+  // Arc-length-to-position lookup table sampled along path_ at construction,
+  // used to seed GetClosestPathPosition() queries.
+  std::vector<T> s_samples_;
+  std::vector<Vector3<T>> xyz_samples_;
 };
 
 }  // namespace automotive
@@ -0,0 +1,111 @@
+#include "drake/automotive/batch_planner.h"
+
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include "drake/automotive/idm_planner.h"
+
+namespace drake {
+namespace automotive {
+namespace {
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+// The batch IDM kernel must agree elementwise with the scalar planner across
+// free-road, closing and near-singular regimes.
+GTEST_TEST(BatchPlannerTest, EvaluateIdmMatchesScalar) {
+  const IdmPlannerParameters<double> params;  // Default parameters.
+
+  Eigen::ArrayXd ego_velocity(5);
+  Eigen::ArrayXd target_distance(5);
+  Eigen::ArrayXd target_distance_dot(5);
+  ego_velocity << 0., 5., 10., 15., 8.;
+  target_distance << 1., 6., 30., kInf, 2.;
+  target_distance_dot << 0., -2., 3., 0., -5.;
+
+  const Eigen::ArrayXd batch_accel = BatchPlanner::EvaluateIdm(
+      params, ego_velocity, target_distance, target_distance_dot);
+
+  ASSERT_EQ(5, batch_accel.size());
+  for (int i = 0; i < batch_accel.size(); ++i) {
+    const double scalar_accel = IdmPlanner<double>::Evaluate(
+        params, ego_velocity(i), target_distance(i), target_distance_dot(i));
+    EXPECT_DOUBLE_EQ(scalar_accel, batch_accel(i)) << "car index " << i;
+  }
+}
+
+// The headway saturation must subtract the bloat diameter, keep magnitudes
+// away from zero and preserve the sign of the headway.
+GTEST_TEST(BatchPlannerTest, SaturateNetDistance) {
+  IdmPlannerParameters<double> params;  // Default parameters.
+  const double bloat = params.bloat_diameter();
+  const double lower = params.distance_lower_limit();
+
+  Eigen::ArrayXd headway(4);
+  headway << bloat + 10., 0.5 * lower, -0.5 * lower, -(bloat + 10.);
+  const Eigen::ArrayXd net = BatchPlanner::SaturateNetDistance(params, headway);
+
+  ASSERT_EQ(4, net.size());
+  EXPECT_DOUBLE_EQ(10., net(0));       // Far ahead: bloat subtracted.
+  EXPECT_DOUBLE_EQ(lower, net(1));     // Nearly touching ahead: clamped.
+  EXPECT_DOUBLE_EQ(-lower, net(2));    // Nearly touching behind: clamped.
+  EXPECT_DOUBLE_EQ(-10., net(3));      // Far behind: bloat added back.
+}
+
+// The incentive is the MOBIL weighted sum, except where the candidate lane's
+// trailing car would be forced below the comfortable deceleration bound.
+GTEST_TEST(BatchPlannerTest, ComputeIncentives) {
+  MobilPlannerParameters<double> mobil_params;  // Default parameters.
+  const double p = mobil_params.p();
+
+  Eigen::ArrayXd ego_old(2);
+  Eigen::ArrayXd ego_new(2);
+  Eigen::ArrayXd trailing_delta_this(2);
+  Eigen::ArrayXd trailing_old_other(2);
+  Eigen::ArrayXd trailing_new_other(2);
+  ego_old << 1., 1.;
+  ego_new << 2., 2.;
+  trailing_delta_this << 0.5, 0.5;
+  trailing_old_other << 0., 0.;
+  // The second car's lane change discomforts the trailing car too much.
+  trailing_new_other << -1., -mobil_params.max_deceleration() - 1.;
+
+  const Eigen::ArrayXd incentives = BatchPlanner::ComputeIncentives(
+      mobil_params, ego_old, ego_new, trailing_delta_this, trailing_old_other,
+      trailing_new_other);
+
+  ASSERT_EQ(2, incentives.size());
+  EXPECT_DOUBLE_EQ((2. - 1.) + p * (-1. + 0.5), incentives(0));
+  EXPECT_GT(-1e5, incentives(1));  // Gated: large disincentive.
+}
+
+// Lane selection must honor the threshold and break ties toward the left
+// lane, as MobilPlanner does.
+GTEST_TEST(BatchPlannerTest, SelectLaneChanges) {
+  MobilPlannerParameters<double> mobil_params;  // Default parameters.
+  const double threshold = mobil_params.threshold();
+
+  Eigen::ArrayXd incentive_left(4);
+  Eigen::ArrayXd incentive_right(4);
+  // Car 0: left wins and exceeds the threshold.
+  // Car 1: right wins and exceeds the threshold.
+  // Car 2: both below the threshold.
+  // Car 3: a tie above the threshold goes left.
+  incentive_left << threshold + 1., -kInf, 0.5 * threshold, threshold + 1.;
+  incentive_right << threshold + 0.5, threshold + 1., 0.5 * threshold,
+      threshold + 1.;
+
+  const Eigen::ArrayXi changes = BatchPlanner::SelectLaneChanges(
+      mobil_params, incentive_left, incentive_right);
+
+  ASSERT_EQ(4, changes.size());
+  EXPECT_EQ(1, changes(0));
+  EXPECT_EQ(-1, changes(1));
+  EXPECT_EQ(0, changes(2));
+  EXPECT_EQ(1, changes(3));
+}
+
+}  // namespace
+}  // namespace automotive
+}  // namespace drake
@@ -198,6 +198,56 @@ GTEST_TEST(IdmControllerTest, ConstructConfluentSegments) {
   EXPECT_TRUE(CompareMatrices(expected_value, actual_value, 1e-3));
 }
 
+GTEST_TEST(IdmControllerTest, GetClosestPathPosition) {
+  const double kStepSize{0.5};
+  auto road_opposing = MakeTwoLaneRoad(true);
+  const LaneDirection initial_lane_dir =
+      LaneDirection(GetLaneById(*road_opposing, "j:0_fwd"), /* lane */
+                    true);                                  /* with_s */
+  const auto path =
+      RoadPath<double>(initial_lane_dir, /* initial_lane_direction */
+                       kStepSize,        /* step_size */
+                       100);             /* num_breaks */
+
+  // A point on the straight segment projects back to its own s-coordinate,
+  // regardless of the quality of the guess.
+  const Vector3<double> on_path{4., 0., 0.};
+  EXPECT_NEAR(4., path.GetClosestPathPosition(on_path, 0.), 1e-3);
+  EXPECT_NEAR(4., path.GetClosestPathPosition(on_path, kTotalRoadLength), 1e-3);
+
+  // A point off to the side of the straight segment projects laterally.
+  const Vector3<double> off_path{4., 2., 0.};
+  EXPECT_NEAR(4., path.GetClosestPathPosition(off_path, 0.), 1e-3);
+
+  // A point radially outward from the middle of the arc projects onto the
+  // middle of the arc.
+  const Vector3<double> outside_arc{
+      kStraightRoadLength + 14. * std::cos(-M_PI_4),
+      kCurvedRoadRadius + 14. * std::sin(-M_PI_4), 0.};
+  EXPECT_NEAR(kStraightRoadLength + 0.5 * kCurvedRoadLength,
+              path.GetClosestPathPosition(outside_arc, 0.), 1e-2);
+}
+
+GTEST_TEST(IdmControllerTest, MakeSharedCachesByRoute) {
+  const double kStepSize{0.5};
+  auto road_opposing = MakeTwoLaneRoad(true);
+  const LaneDirection initial_lane_dir =
+      LaneDirection(GetLaneById(*road_opposing, "j:0_fwd"), /* lane */
+                    true);                                  /* with_s */
+
+  // Identical route parameters yield the same instance.
+  const auto path_a =
+      RoadPath<double>::MakeShared(initial_lane_dir, kStepSize, 100);
+  const auto path_b =
+      RoadPath<double>::MakeShared(initial_lane_dir, kStepSize, 100);
+  EXPECT_EQ(path_a.get(), path_b.get());
+
+  // Differing parameters yield a distinct instance.
+  const auto path_c =
+      RoadPath<double>::MakeShared(initial_lane_dir, kStepSize, 50);
+  EXPECT_NE(path_a.get(), path_c.get());
+}
+
 }  // namespace
 }  // namespace automotive
 }  // namespace drake
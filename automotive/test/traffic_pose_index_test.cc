@@ -0,0 +1,141 @@
+#include "drake/automotive/traffic_pose_index.h"
+
+#include <limits>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "drake/automotive/maliput/dragway/road_geometry.h"
+#include "drake/automotive/pose_selector.h"
+
+namespace drake {
+namespace automotive {
+namespace {
+
+using maliput::api::Lane;
+using systems::rendering::PoseBundle;
+using systems::rendering::PoseVector;
+
+constexpr double kLaneLength{100.};
+constexpr double kLaneWidth{2.};
+constexpr double kEgoSPosition{10.};
+constexpr double kScanDistance{60.};
+
+class TrafficPoseIndexTest : public ::testing::Test {
+ protected:
+  void MakeDragway(int num_lanes) {
+    road_.reset(new maliput::dragway::RoadGeometry(
+        maliput::api::RoadGeometryId("Test Dragway"), num_lanes, kLaneLength,
+        kLaneWidth, 0. /* shoulder width */, 5. /* maximum_height */,
+        std::numeric_limits<double>::epsilon() /* linear_tolerance */,
+        std::numeric_limits<double>::epsilon() /* angular_tolerance */));
+  }
+
+  // Returns the r-coordinate of the centerline of the `lane_index`-th lane.
+  double LaneCenterY(int lane_index) const {
+    const int num_lanes = road_->junction(0)->segment(0)->num_lanes();
+    return (lane_index - 0.5 * (num_lanes - 1)) * kLaneWidth;
+  }
+
+  std::unique_ptr<maliput::dragway::RoadGeometry> road_;
+};
+
+TEST_F(TrafficPoseIndexTest, EntriesSortedByS) {
+  MakeDragway(2 /* num_lanes */);
+
+  // Three cars in lane 0 (out of s-order) and one car in lane 1.
+  PoseBundle<double> traffic_poses(4);
+  traffic_poses.set_pose(
+      0, Isometry3<double>(Translation3<double>(40., LaneCenterY(0), 0.)));
+  traffic_poses.set_pose(
+      1, Isometry3<double>(Translation3<double>(5., LaneCenterY(0), 0.)));
+  traffic_poses.set_pose(
+      2, Isometry3<double>(Translation3<double>(20., LaneCenterY(0), 0.)));
+  traffic_poses.set_pose(
+      3, Isometry3<double>(Translation3<double>(50., LaneCenterY(1), 0.)));
+
+  const TrafficPoseIndex<double> index(*road_, traffic_poses);
+  EXPECT_EQ(index.num_poses(), 4);
+
+  const Lane* lane_0 = road_->junction(0)->segment(0)->lane(0);
+  const Lane* lane_1 = road_->junction(0)->segment(0)->lane(1);
+
+  const auto& entries_0 = index.entries_in_lane(lane_0);
+  ASSERT_EQ(entries_0.size(), 3u);
+  EXPECT_EQ(entries_0[0].pose_index, 1);
+  EXPECT_EQ(entries_0[1].pose_index, 2);
+  EXPECT_EQ(entries_0[2].pose_index, 0);
+  EXPECT_EQ(entries_0[0].s, 5.);
+  EXPECT_EQ(entries_0[1].s, 20.);
+  EXPECT_EQ(entries_0[2].s, 40.);
+
+  const auto& entries_1 = index.entries_in_lane(lane_1);
+  ASSERT_EQ(entries_1.size(), 1u);
+  EXPECT_EQ(entries_1[0].pose_index, 3);
+}
+
+TEST_F(TrafficPoseIndexTest, EmptyLane) {
+  MakeDragway(2 /* num_lanes */);
+  const PoseBundle<double> traffic_poses(0);
+  const TrafficPoseIndex<double> index(*road_, traffic_poses);
+  EXPECT_EQ(index.num_poses(), 0);
+  const Lane* lane_0 = road_->junction(0)->segment(0)->lane(0);
+  EXPECT_EQ(index.entries_in_lane(lane_0).size(), 0u);
+}
+
+// The indexed FindClosestPair() must agree with the exhaustive scan.
+TEST_F(TrafficPoseIndexTest, MatchesExhaustiveScan) {
+  MakeDragway(2 /* num_lanes */);
+  const Lane* lane_0 = road_->junction(0)->segment(0)->lane(0);
+
+  PoseVector<double> ego_pose;
+  ego_pose.set_translation(
+      Translation3<double>(kEgoSPosition, LaneCenterY(0), 0.));
+
+  // Cars ahead and behind the ego in its lane, plus distractors in the
+  // neighboring lane.
+  PoseBundle<double> traffic_poses(5);
+  traffic_poses.set_pose(
+      0, Isometry3<double>(Translation3<double>(31., LaneCenterY(0), 0.)));
+  traffic_poses.set_pose(
+      1, Isometry3<double>(Translation3<double>(35., LaneCenterY(0), 0.)));
+  traffic_poses.set_pose(
+      2, Isometry3<double>(Translation3<double>(7., LaneCenterY(0), 0.)));
+  traffic_poses.set_pose(
+      3, Isometry3<double>(Translation3<double>(12., LaneCenterY(1), 0.)));
+  traffic_poses.set_pose(
+      4, Isometry3<double>(Translation3<double>(9., LaneCenterY(1), 0.)));
+
+  const TrafficPoseIndex<double> index(*road_, traffic_poses);
+
+  const auto expected = PoseSelector<double>::FindClosestPair(
+      lane_0, ego_pose, traffic_poses, kScanDistance, ScanStrategy::kPath);
+  const auto actual = PoseSelector<double>::FindClosestPair(
+      lane_0, ego_pose, traffic_poses, index, kScanDistance,
+      ScanStrategy::kPath);
+
+  for (const auto side : {AheadOrBehind::kAhead, AheadOrBehind::kBehind}) {
+    EXPECT_EQ(actual.at(side).distance, expected.at(side).distance);
+    EXPECT_EQ(actual.at(side).odometry.pos.s(),
+              expected.at(side).odometry.pos.s());
+    EXPECT_EQ(actual.at(side).odometry.lane, expected.at(side).odometry.lane);
+  }
+  // Sanity-check the concrete values: car 0 leads by 21, car 2 trails by 3.
+  EXPECT_EQ(actual.at(AheadOrBehind::kAhead).distance, 21.);
+  EXPECT_EQ(actual.at(AheadOrBehind::kBehind).distance, 3.);
+
+  // With no cars in scan range, both sides come back at infinity.
+  PoseBundle<double> empty_poses(0);
+  const TrafficPoseIndex<double> empty_index(*road_, empty_poses);
+  const auto none = PoseSelector<double>::FindClosestPair(
+      lane_0, ego_pose, empty_poses, empty_index, kScanDistance,
+      ScanStrategy::kPath);
+  EXPECT_EQ(none.at(AheadOrBehind::kAhead).distance,
+            std::numeric_limits<double>::infinity());
+  EXPECT_EQ(none.at(AheadOrBehind::kBehind).distance,
+            std::numeric_limits<double>::infinity());
+}
+
+}  // namespace
+}  // namespace automotive
+}  // namespace drake
@@ -0,0 +1,65 @@
+#include "drake/automotive/traffic_pose_index.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_assert.h"
+#include "drake/common/extract_double.h"
+#include "drake/common/never_destroyed.h"
+
+namespace drake {
+namespace automotive {
+
+using maliput::api::GeoPosition;
+using maliput::api::GeoPositionT;
+using maliput::api::Lane;
+using maliput::api::RoadGeometry;
+using systems::rendering::PoseBundle;
+
+template <typename T>
+TrafficPoseIndex<T>::TrafficPoseIndex(const RoadGeometry& road,
+                                      const PoseBundle<T>& traffic_poses)
+    : num_poses_(traffic_poses.get_num_poses()) {
+  for (int i = 0; i < num_poses_; ++i) {
+    const Isometry3<T>& isometry = traffic_poses.get_pose(i);
+    const GeoPositionT<T> geo_position =
+        GeoPositionT<T>::FromXyz(isometry.translation());
+    const GeoPosition geo_position_double{
+        ExtractDoubleOrThrow(geo_position.x()),
+        ExtractDoubleOrThrow(geo_position.y()),
+        ExtractDoubleOrThrow(geo_position.z())};
+    const Lane* const lane =
+        road.ToRoadPosition(geo_position_double, nullptr, nullptr, nullptr)
+            .lane;
+    if (lane == nullptr) continue;
+
+    Entry entry;
+    entry.pose_index = i;
+    entry.lane_position =
+        lane->ToLanePositionT<T>(geo_position, nullptr, nullptr);
+    entry.geo_position = geo_position;
+    entry.s = ExtractDoubleOrThrow(entry.lane_position.s());
+    lane_entries_[lane->id()].emplace_back(std::move(entry));
+  }
+  for (auto& id_and_entries : lane_entries_) {
+    std::sort(id_and_entries.second.begin(), id_and_entries.second.end(),
+              [](const Entry& a, const Entry& b) { return a.s < b.s; });
+  }
+}
+
+template <typename T>
+const std::vector<typename TrafficPoseIndex<T>::Entry>&
+TrafficPoseIndex<T>::entries_in_lane(const Lane* lane) const {
+  DRAKE_DEMAND(lane != nullptr);
+  static const never_destroyed<std::vector<Entry>> empty_entries{};
+  const auto it = lane_entries_.find(lane->id());
+  if (it == lane_entries_.end()) return empty_entries.access();
+  return it->second;
+}
+
+}  // namespace automotive
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::automotive::TrafficPoseIndex)
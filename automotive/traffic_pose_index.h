@@ -0,0 +1,73 @@
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "drake/automotive/maliput/api/lane.h"
+#include "drake/automotive/maliput/api/lane_data.h"
+#include "drake/automotive/maliput/api/road_geometry.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/rendering/pose_bundle.h"
+
+namespace drake {
+namespace automotive {
+
+/// TrafficPoseIndex organizes the poses of a PoseBundle by the maliput lane
+/// each pose occupies, with the entries of every lane sorted by ascending
+/// `s`-coordinate.  The expensive RoadGeometry::ToRoadPosition() and
+/// Lane::ToLanePosition() probes are performed exactly once per pose at
+/// construction time; PoseSelector queries against the index then locate
+/// neighbors within a lane by binary search instead of re-scanning the whole
+/// bundle.  Build one index per PoseBundle per time step and share it across
+/// all the planners (e.g. IdmController, MobilPlanner instances) evaluating
+/// against that bundle.
+///
+/// Note that the index assigns each pose to the single nearest lane reported
+/// by RoadGeometry::ToRoadPosition(); a pose lying exactly on a lane boundary
+/// (within `linear_tolerance()` of two lanes) is indexed under only one of
+/// them.
+///
+/// Instantiated templates for the following kinds of T's are provided:
+///
+/// - double
+/// - AutoDiffXd
+///
+/// They are already available to link against in the containing library.
+template <typename T>
+class TrafficPoseIndex {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(TrafficPoseIndex)
+
+  /// The indexed data for one traffic pose.
+  struct Entry {
+    /// The index of the pose within the source PoseBundle.
+    int pose_index{};
+    /// The pose expressed in the coordinates of the lane it occupies.
+    maliput::api::LanePositionT<T> lane_position;
+    /// The pose's world position, used to discard the ego's own pose.
+    maliput::api::GeoPositionT<T> geo_position;
+    /// ExtractDoubleOrThrow(lane_position.s()), the per-lane sort key.
+    double s{};
+  };
+
+  /// Indexes every pose of @p traffic_poses against @p road.  Poses that do
+  /// not map to any lane are omitted from the index.
+  TrafficPoseIndex(const maliput::api::RoadGeometry& road,
+                   const systems::rendering::PoseBundle<T>& traffic_poses);
+
+  /// Returns the entries occupying @p lane sorted by ascending `s`, or an
+  /// empty vector if no indexed pose occupies it.  @p lane must not be
+  /// nullptr.
+  const std::vector<Entry>& entries_in_lane(
+      const maliput::api::Lane* lane) const;
+
+  /// Returns the number of poses in the bundle this index was built from.
+  int num_poses() const { return num_poses_; }
+
+ private:
+  std::map<maliput::api::LaneId, std::vector<Entry>> lane_entries_;
+  int num_poses_{0};
+};
+
+}  // namespace automotive
+}  // namespace drake
@@ -21,6 +21,15 @@ namespace drake {
 /// An autodiff variable with a dynamic number of partials.
 using AutoDiffXd = Eigen::AutoDiffScalar<Eigen::VectorXd>;
 
+/// An autodiff variable with a dynamic number of partials, up to a maximum
+/// of 16. Unlike AutoDiffXd, whose derivative vector is heap-allocated per
+/// scalar, the derivative storage here lives inline in the scalar itself, so
+/// arithmetic on this type never touches the allocator. Prefer it for
+/// gradient workloads whose number of independent variables is known to be
+/// small, such as differentiating dynamics with respect to a single robot's
+/// state or a handful of parameters.
+using AutoDiffUpTo16d = Eigen::AutoDiffScalar<VectorUpTo16<double>>;
+
 // TODO(hongkai-dai): Recursive template to get arbitrary gradient order.
 
 /// An autodiff variable with `num_vars` partials.
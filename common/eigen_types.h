@@ -54,6 +54,12 @@ using VectorX = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
 template <typename Scalar>
 using VectorUpTo6 = Eigen::Matrix<Scalar, Eigen::Dynamic, 1, 0, 6, 1>;
 
+/// A vector of dynamic size templated on scalar type, up to a maximum of 16
+/// elements. The storage lives inline in the object, so no heap allocation
+/// occurs for any permitted size.
+template <typename Scalar>
+using VectorUpTo16 = Eigen::Matrix<Scalar, Eigen::Dynamic, 1, 0, 16, 1>;
+
 /// A row vector of size 2, templated on scalar type.
 template <typename Scalar>
 using RowVector2 = Eigen::Matrix<Scalar, 1, 2>;
@@ -122,6 +128,11 @@ template <typename Scalar>
 using MatrixUpTo6 =
 Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, 0, 6, 6>;
 
+/// A matrix of 6 rows and dynamic column size, up to a maximum of 6 columns,
+/// templated on scalar type.
+template <typename Scalar>
+using Matrix6xUpTo6 = Eigen::Matrix<Scalar, 6, Eigen::Dynamic, 0, 6, 6>;
+
 /// A quaternion templated on scalar type.
 template <typename Scalar>
 using Quaternion = Eigen::Quaternion<Scalar>;
@@ -0,0 +1,375 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include <Eigen/Core>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+
+/// A scalar type that packs `N` independent double-precision values ("lanes")
+/// and applies every arithmetic operation to all lanes in lockstep. Code
+/// templated on a scalar type- an integrator tableau, a dynamics evaluation,
+/// an Eigen expression- can be instantiated with EnsembleScalar to advance `N`
+/// perturbed rollouts simultaneously; the per-lane loops in this class are
+/// trivially auto-vectorizable, so with `N` chosen to match the platform's
+/// SIMD width (e.g., four or eight lanes) each arithmetic operation compiles
+/// down to a handful of vector instructions.
+///
+/// Lockstep evaluation requires that all lanes follow the same control flow.
+/// The ordinary comparison operators therefore return `true` only when the
+/// relation holds for *every* lane ("uniform" comparisons); note that, as a
+/// consequence, `!(a < b)` does not imply `a >= b`. Lane-divergent decisions
+/// must instead be expressed value-wise, using the lane-wise comparison
+/// functions (e.g., lane_less()) together with if_then_else(), in the same
+/// manner that branch-free code is written for symbolic::Expression.
+///
+/// This type is deliberately not part of Drake's default scalar set: framework
+/// and multibody code branch on scalar comparisons in ways that have no
+/// lockstep interpretation. It is intended for use with self-contained,
+/// branch-free numerical kernels.
+template <int N>
+class EnsembleScalar {
+ public:
+  static_assert(N > 0, "An ensemble requires at least one lane.");
+
+  /// A lane-wise boolean, as produced by the lane-wise comparison functions
+  /// and consumed by if_then_else().
+  using Mask = std::array<bool, N>;
+
+  /// Constructs an ensemble with all lanes zero.
+  EnsembleScalar() { lanes_.fill(0.0); }
+
+  /// Constructs an ensemble with every lane set to @p value (broadcast).
+  // NOLINTNEXTLINE(runtime/explicit) This conversion is desirable.
+  EnsembleScalar(double value) { lanes_.fill(value); }
+
+  /// Constructs an ensemble from per-lane values.
+  explicit EnsembleScalar(const std::array<double, N>& lanes)
+      : lanes_(lanes) {}
+
+  /// Returns the number of lanes.
+  static constexpr int num_lanes() { return N; }
+
+  /// Returns the value in lane @p i.
+  double lane(int i) const {
+    DRAKE_ASSERT(i >= 0 && i < N);
+    return lanes_[i];
+  }
+
+  /// Sets the value in lane @p i.
+  void set_lane(int i, double value) {
+    DRAKE_ASSERT(i >= 0 && i < N);
+    lanes_[i] = value;
+  }
+
+  EnsembleScalar& operator+=(const EnsembleScalar& rhs) {
+    for (int i = 0; i < N; ++i) lanes_[i] += rhs.lanes_[i];
+    return *this;
+  }
+
+  EnsembleScalar& operator-=(const EnsembleScalar& rhs) {
+    for (int i = 0; i < N; ++i) lanes_[i] -= rhs.lanes_[i];
+    return *this;
+  }
+
+  EnsembleScalar& operator*=(const EnsembleScalar& rhs) {
+    for (int i = 0; i < N; ++i) lanes_[i] *= rhs.lanes_[i];
+    return *this;
+  }
+
+  EnsembleScalar& operator/=(const EnsembleScalar& rhs) {
+    for (int i = 0; i < N; ++i) lanes_[i] /= rhs.lanes_[i];
+    return *this;
+  }
+
+  EnsembleScalar operator-() const {
+    EnsembleScalar result;
+    for (int i = 0; i < N; ++i) result.lanes_[i] = -lanes_[i];
+    return result;
+  }
+
+  /// Applies @p f to every lane, returning the lane-wise results.
+  template <typename UnaryOp>
+  EnsembleScalar Map(UnaryOp f) const {
+    EnsembleScalar result;
+    for (int i = 0; i < N; ++i) result.lanes_[i] = f(lanes_[i]);
+    return result;
+  }
+
+  /// Applies @p f to every lane of this and @p rhs, returning the lane-wise
+  /// results.
+  template <typename BinaryOp>
+  EnsembleScalar Map(const EnsembleScalar& rhs, BinaryOp f) const {
+    EnsembleScalar result;
+    for (int i = 0; i < N; ++i) result.lanes_[i] = f(lanes_[i], rhs.lanes_[i]);
+    return result;
+  }
+
+ private:
+  std::array<double, N> lanes_;
+};
+
+template <int N>
+EnsembleScalar<N> operator+(EnsembleScalar<N> lhs,
+                            const EnsembleScalar<N>& rhs) {
+  lhs += rhs;
+  return lhs;
+}
+
+template <int N>
+EnsembleScalar<N> operator-(EnsembleScalar<N> lhs,
+                            const EnsembleScalar<N>& rhs) {
+  lhs -= rhs;
+  return lhs;
+}
+
+template <int N>
+EnsembleScalar<N> operator*(EnsembleScalar<N> lhs,
+                            const EnsembleScalar<N>& rhs) {
+  lhs *= rhs;
+  return lhs;
+}
+
+template <int N>
+EnsembleScalar<N> operator/(EnsembleScalar<N> lhs,
+                            const EnsembleScalar<N>& rhs) {
+  lhs /= rhs;
+  return lhs;
+}
+
+/// @name Mixed ensemble/double arithmetic
+/// The double operand broadcasts to every lane. (These overloads are needed
+/// because implicit conversions do not participate in template argument
+/// deduction for the ensemble/ensemble operators above.)
+//@{
+template <int N>
+EnsembleScalar<N> operator+(EnsembleScalar<N> lhs, double rhs) {
+  lhs += EnsembleScalar<N>(rhs);
+  return lhs;
+}
+
+template <int N>
+EnsembleScalar<N> operator+(double lhs, EnsembleScalar<N> rhs) {
+  rhs += EnsembleScalar<N>(lhs);
+  return rhs;
+}
+
+template <int N>
+EnsembleScalar<N> operator-(EnsembleScalar<N> lhs, double rhs) {
+  lhs -= EnsembleScalar<N>(rhs);
+  return lhs;
+}
+
+template <int N>
+EnsembleScalar<N> operator-(double lhs, const EnsembleScalar<N>& rhs) {
+  return EnsembleScalar<N>(lhs) - rhs;
+}
+
+template <int N>
+EnsembleScalar<N> operator*(EnsembleScalar<N> lhs, double rhs) {
+  lhs *= EnsembleScalar<N>(rhs);
+  return lhs;
+}
+
+template <int N>
+EnsembleScalar<N> operator*(double lhs, EnsembleScalar<N> rhs) {
+  rhs *= EnsembleScalar<N>(lhs);
+  return rhs;
+}
+
+template <int N>
+EnsembleScalar<N> operator/(EnsembleScalar<N> lhs, double rhs) {
+  lhs /= EnsembleScalar<N>(rhs);
+  return lhs;
+}
+
+template <int N>
+EnsembleScalar<N> operator/(double lhs, const EnsembleScalar<N>& rhs) {
+  return EnsembleScalar<N>(lhs) / rhs;
+}
+//@}
+
+/// @name Uniform comparisons
+/// Each operator returns `true` only if the relation holds for every lane.
+//@{
+template <int N>
+bool operator<(const EnsembleScalar<N>& lhs, const EnsembleScalar<N>& rhs) {
+  for (int i = 0; i < N; ++i)
+    if (!(lhs.lane(i) < rhs.lane(i))) return false;
+  return true;
+}
+
+template <int N>
+bool operator<=(const EnsembleScalar<N>& lhs, const EnsembleScalar<N>& rhs) {
+  for (int i = 0; i < N; ++i)
+    if (!(lhs.lane(i) <= rhs.lane(i))) return false;
+  return true;
+}
+
+template <int N>
+bool operator>(const EnsembleScalar<N>& lhs, const EnsembleScalar<N>& rhs) {
+  return rhs < lhs;
+}
+
+template <int N>
+bool operator>=(const EnsembleScalar<N>& lhs, const EnsembleScalar<N>& rhs) {
+  return rhs <= lhs;
+}
+
+template <int N>
+bool operator==(const EnsembleScalar<N>& lhs, const EnsembleScalar<N>& rhs) {
+  for (int i = 0; i < N; ++i)
+    if (!(lhs.lane(i) == rhs.lane(i))) return false;
+  return true;
+}
+
+template <int N>
+bool operator!=(const EnsembleScalar<N>& lhs, const EnsembleScalar<N>& rhs) {
+  return !(lhs == rhs);
+}
+//@}
+
+/// @name Lane-wise comparisons
+/// Each function returns a per-lane mask for use with if_then_else().
+//@{
+template <int N>
+typename EnsembleScalar<N>::Mask lane_less(const EnsembleScalar<N>& lhs,
+                                           const EnsembleScalar<N>& rhs) {
+  typename EnsembleScalar<N>::Mask mask;
+  for (int i = 0; i < N; ++i) mask[i] = lhs.lane(i) < rhs.lane(i);
+  return mask;
+}
+
+template <int N>
+typename EnsembleScalar<N>::Mask lane_less_equal(const EnsembleScalar<N>& lhs,
+                                                 const EnsembleScalar<N>& rhs) {
+  typename EnsembleScalar<N>::Mask mask;
+  for (int i = 0; i < N; ++i) mask[i] = lhs.lane(i) <= rhs.lane(i);
+  return mask;
+}
+
+template <int N>
+typename EnsembleScalar<N>::Mask lane_greater(const EnsembleScalar<N>& lhs,
+                                              const EnsembleScalar<N>& rhs) {
+  return lane_less(rhs, lhs);
+}
+
+template <int N>
+typename EnsembleScalar<N>::Mask lane_greater_equal(
+    const EnsembleScalar<N>& lhs, const EnsembleScalar<N>& rhs) {
+  return lane_less_equal(rhs, lhs);
+}
+//@}
+
+/// Selects, lane-wise, the value from @p e_then where @p mask is `true` and
+/// from @p e_else otherwise (the lane-divergent analogue of the if_then_else
+/// overloads for double and AutoDiffXd).
+template <int N>
+EnsembleScalar<N> if_then_else(const typename EnsembleScalar<N>::Mask& mask,
+                               const EnsembleScalar<N>& e_then,
+                               const EnsembleScalar<N>& e_else) {
+  EnsembleScalar<N> result;
+  for (int i = 0; i < N; ++i)
+    result.set_lane(i, mask[i] ? e_then.lane(i) : e_else.lane(i));
+  return result;
+}
+
+/// @name Lane-wise elementary functions
+//@{
+template <int N>
+EnsembleScalar<N> abs(const EnsembleScalar<N>& e) {
+  return e.Map([](double v) { return std::abs(v); });
+}
+
+template <int N>
+EnsembleScalar<N> sqrt(const EnsembleScalar<N>& e) {
+  return e.Map([](double v) { return std::sqrt(v); });
+}
+
+template <int N>
+EnsembleScalar<N> exp(const EnsembleScalar<N>& e) {
+  return e.Map([](double v) { return std::exp(v); });
+}
+
+template <int N>
+EnsembleScalar<N> log(const EnsembleScalar<N>& e) {
+  return e.Map([](double v) { return std::log(v); });
+}
+
+template <int N>
+EnsembleScalar<N> sin(const EnsembleScalar<N>& e) {
+  return e.Map([](double v) { return std::sin(v); });
+}
+
+template <int N>
+EnsembleScalar<N> cos(const EnsembleScalar<N>& e) {
+  return e.Map([](double v) { return std::cos(v); });
+}
+
+template <int N>
+EnsembleScalar<N> tan(const EnsembleScalar<N>& e) {
+  return e.Map([](double v) { return std::tan(v); });
+}
+
+template <int N>
+EnsembleScalar<N> pow(const EnsembleScalar<N>& base,
+                      const EnsembleScalar<N>& exponent) {
+  return base.Map(exponent,
+                  [](double b, double e) { return std::pow(b, e); });
+}
+
+template <int N>
+EnsembleScalar<N> min(const EnsembleScalar<N>& lhs,
+                      const EnsembleScalar<N>& rhs) {
+  return lhs.Map(rhs, [](double a, double b) { return a < b ? a : b; });
+}
+
+template <int N>
+EnsembleScalar<N> max(const EnsembleScalar<N>& lhs,
+                      const EnsembleScalar<N>& rhs) {
+  return lhs.Map(rhs, [](double a, double b) { return a < b ? b : a; });
+}
+
+template <int N>
+EnsembleScalar<N> floor(const EnsembleScalar<N>& e) {
+  return e.Map([](double v) { return std::floor(v); });
+}
+
+template <int N>
+EnsembleScalar<N> ceil(const EnsembleScalar<N>& e) {
+  return e.Map([](double v) { return std::ceil(v); });
+}
+//@}
+
+/// An ensemble sized to one AVX register of doubles.
+using Ensemble4 = EnsembleScalar<4>;
+
+/// An ensemble sized to two AVX registers (or one AVX-512 register) of
+/// doubles.
+using Ensemble8 = EnsembleScalar<8>;
+
+}  // namespace drake
+
+namespace Eigen {
+
+/// Enables the use of EnsembleScalar in Eigen expressions.
+template <int N>
+struct NumTraits<drake::EnsembleScalar<N>> : NumTraits<double> {
+  using Real = drake::EnsembleScalar<N>;
+  using NonInteger = drake::EnsembleScalar<N>;
+  using Nested = drake::EnsembleScalar<N>;
+  using Literal = double;
+
+  enum {
+    RequireInitialization = 1,
+    ReadCost = N,
+    AddCost = N,
+    MulCost = N,
+  };
+};
+
+}  // namespace Eigen
@@ -1,6 +1,10 @@
 #include "drake/common/find_resource.h"
 
 #include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -261,6 +265,21 @@ std::vector<string>& GetMutableResourceSearchPaths() {
   static never_destroyed<std::vector<string>> search_paths;
   return search_paths.access();
 }
+
+// The process-wide resource cache: successful lookups are memoized in
+// `found_paths`, and `manifest` holds entries loaded by
+// LoadResourceManifest().  Both maps are keyed on the resource path (e.g.,
+// "drake/common/foo.txt") and guarded by `mutex`.
+struct ResourceCache {
+  std::mutex mutex;
+  std::unordered_map<string, string> found_paths;
+  std::unordered_map<string, string> manifest;
+};
+
+ResourceCache& GetResourceCache() {
+  static never_destroyed<ResourceCache> cache;
+  return cache.access();
+}
 }  // namespace
 
 std::vector<string> GetResourceSearchPaths() {
@@ -271,6 +290,60 @@ void AddResourceSearchPath(string search_path) {
   // Throw an error if path is relative.
   DRAKE_THROW_UNLESS(!IsRelativePath(search_path));
   GetMutableResourceSearchPaths().push_back(std::move(search_path));
+  // The new path can change which directory takes priority for a resource,
+  // so memoized lookups are no longer valid.
+  ResourceCache& cache = GetResourceCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.found_paths.clear();
+}
+
+void LoadResourceManifest(const string& manifest_path) {
+  std::ifstream manifest_file(manifest_path);
+  if (!manifest_file.is_open()) {
+    throw std::runtime_error("LoadResourceManifest: cannot open '" +
+                             manifest_path + "' for reading");
+  }
+  std::unordered_map<string, string> entries;
+  string line;
+  int line_number = 0;
+  while (std::getline(manifest_file, line)) {
+    ++line_number;
+    if (line.empty() || line[0] == '#') { continue; }
+    std::istringstream tokens(line);
+    string resource_path;
+    string absolute_path;
+    string excess;
+    if (!(tokens >> resource_path >> absolute_path) || (tokens >> excess)) {
+      throw std::runtime_error(
+          "LoadResourceManifest: malformed line " +
+          std::to_string(line_number) + " of '" + manifest_path + "'");
+    }
+    if (!StartsWith(resource_path, "drake/")) {
+      throw std::runtime_error(
+          "LoadResourceManifest: resource path '" + resource_path +
+          "' does not start with drake/ (line " +
+          std::to_string(line_number) + " of '" + manifest_path + "')");
+    }
+    if (IsRelativePath(absolute_path)) {
+      throw std::runtime_error(
+          "LoadResourceManifest: path '" + absolute_path +
+          "' is not absolute (line " + std::to_string(line_number) + " of '" +
+          manifest_path + "')");
+    }
+    entries[std::move(resource_path)] = std::move(absolute_path);
+  }
+  ResourceCache& cache = GetResourceCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  for (auto& entry : entries) {
+    cache.manifest[entry.first] = std::move(entry.second);
+  }
+}
+
+void ClearFindResourceCacheForTesting() {
+  ResourceCache& cache = GetResourceCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.found_paths.clear();
+  cache.manifest.clear();
 }
 
 Result FindResource(string resource_path) {
@@ -293,6 +366,29 @@ Result FindResource(string resource_path) {
   }
   const std::string resource_path_substr = resource_path.substr(prefix.size());
 
+  // Consult the process-wide cache before probing any directories: first the
+  // memoized results of prior lookups, then any manifest entries.  A manifest
+  // entry whose file has vanished is ignored (the normal search below will
+  // re-resolve the resource).
+  {
+    ResourceCache& cache = GetResourceCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    const auto found_iter = cache.found_paths.find(resource_path);
+    if (found_iter != cache.found_paths.end()) {
+      return Result::make_success(std::move(resource_path),
+                                  found_iter->second);
+    }
+    const auto manifest_iter = cache.manifest.find(resource_path);
+    if (manifest_iter != cache.manifest.end()) {
+      const spruce::path file_query(manifest_iter->second);
+      if (file_query.exists()) {
+        cache.found_paths.emplace(resource_path, manifest_iter->second);
+        return Result::make_success(std::move(resource_path),
+                                    manifest_iter->second);
+      }
+    }
+  }
+
   // Collect a list of (priority-ordered) directories to check.  Candidate
   // paths will already end with "drake" as their final path element, or
   // possibly a related name like "drake2"; that is, they will contain files
@@ -336,6 +432,9 @@ Result FindResource(string resource_path) {
   // See which (if any) candidate contains the requested resource.
   for (const auto& candidate_dir : candidate_dirs) {
     if (auto absolute_path = FileExists(candidate_dir, resource_path_substr)) {
+      ResourceCache& cache = GetResourceCache();
+      std::lock_guard<std::mutex> lock(cache.mutex);
+      cache.found_paths.emplace(resource_path, *absolute_path);
       return Result::make_success(
           std::move(resource_path), std::move(*absolute_path));
     }
@@ -347,6 +446,11 @@ Result FindResource(string resource_path) {
   // the attic should be installed without the "attic/" portion of their path.
   const Result attic_result = MaybeFindResourceInAttic(resource_path);
   if (attic_result.get_absolute_path() != nullopt) {
+    // Memoize under the original (non-attic) resource path as well.
+    ResourceCache& cache = GetResourceCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.found_paths.emplace(resource_path,
+                              *attic_result.get_absolute_path());
     return attic_result;
   }
 
@@ -83,6 +83,26 @@ void AddResourceSearchPath(std::string root_directory);
 /// Gets current root directory value from a persistent variable.
 std::vector<std::string> GetResourceSearchPaths();
 
+/// Loads a prebuilt manifest of resource locations into the process-wide
+/// resource cache.  Each non-empty line of @p manifest_path that does not
+/// start with `#` must have the form `<resource_path> <absolute_path>`,
+/// e.g.,
+/// `drake/examples/pendulum/Pendulum.urdf /opt/drake/share/drake/examples/pendulum/Pendulum.urdf`.
+/// Manifest entries are consulted by FindResource() before any directory
+/// probing (an entry whose file no longer exists is ignored), so a manifest
+/// generated at install or deploy time reduces cold-start resource
+/// resolution to a hash lookup.  May be called more than once; later
+/// manifests override earlier entries for the same resource path.
+/// @throws std::runtime_error if the file cannot be opened, a line is
+/// malformed, a resource path does not start with `drake/`, or an absolute
+/// path is not actually absolute.
+void LoadResourceManifest(const std::string& manifest_path);
+
+/// (Intended for tests.)  Clears the process-wide FindResource() memoization
+/// cache along with any entries loaded by LoadResourceManifest(), so that
+/// subsequent calls re-probe the search directories.
+void ClearFindResourceCacheForTesting();
+
 /// Attempts to locate a Drake resource named by the given @p resource_path.
 /// The @p resource_path refers to the relative path within the Drake source
 /// repository, prepended with `drake/`.  For example, to find the source
@@ -99,6 +119,12 @@ std::vector<std::string> GetResourceSearchPaths();
 ///
 /// If all of these are unavailable, or do not have the resource, then it will
 /// return a failed result.
+///
+/// Successful lookups are memoized in a process-wide cache (as are entries
+/// loaded by LoadResourceManifest()), so repeated queries for the same
+/// resource do not re-probe the filesystem.  The cache is cleared by
+/// AddResourceSearchPath(), since adding a path can change which directory
+/// takes priority for a resource.
 FindResourceResult FindResource(std::string resource_path);
 
 /// Convenient wrapper for querying FindResource(resource_path) followed by
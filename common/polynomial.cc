@@ -1,9 +1,12 @@
 #include "drake/common/polynomial.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <limits>
 #include <set>
 #include <stdexcept>
+#include <utility>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_throw.h"
@@ -15,6 +18,120 @@ using std::runtime_error;
 using std::string;
 using std::vector;
 
+namespace {
+
+// Below this many multiplies (the direct algorithm's cost, i.e. the product
+// of the factors' coefficient counts) dense univariate products use direct
+// convolution; above it they use the FFT.
+constexpr int64_t kFftCrossover = int64_t{1} << 14;
+
+// Dense-coefficient arithmetic only pays off on polynomials whose monomials
+// fill a reasonable fraction of the coefficient range.  Beyond this slack
+// factor the sparse-term representation stays in effect, so e.g.
+// (x**1000 + 1)**2 never materializes thousands of zero coefficients.
+constexpr int kDenseSlack = 4;
+
+// True iff dense-coefficient arithmetic is worthwhile for a univariate
+// polynomial with the given degree and monomial count.
+bool IsDenseEnough(int degree, int num_monomials) {
+  return degree < kDenseSlack * num_monomials;
+}
+
+// An in-place iterative radix-2 Cooley-Tukey FFT (inverse transform iff
+// inverse is true); data->size() must be a power of two.
+template <typename RealScalar>
+void RadixTwoFft(vector<std::complex<RealScalar>>* data, bool inverse) {
+  vector<std::complex<RealScalar>>& x = *data;
+  const size_t n = x.size();
+  DRAKE_ASSERT(n > 0 && (n & (n - 1)) == 0);
+  // Bit-reversal permutation.
+  for (size_t i = 1, j = 0; i < n; ++i) {
+    size_t bit = n >> 1;
+    for (; j & bit; bit >>= 1) {
+      j ^= bit;
+    }
+    j ^= bit;
+    if (i < j) std::swap(x[i], x[j]);
+  }
+  const RealScalar sign = inverse ? RealScalar{1} : RealScalar{-1};
+  for (size_t len = 2; len <= n; len <<= 1) {
+    const RealScalar angle =
+        sign * RealScalar{2 * M_PI} / static_cast<RealScalar>(len);
+    const std::complex<RealScalar> w_len(std::cos(angle), std::sin(angle));
+    for (size_t start = 0; start < n; start += len) {
+      std::complex<RealScalar> w{1};
+      for (size_t k = 0; k < len / 2; ++k) {
+        const std::complex<RealScalar> even = x[start + k];
+        const std::complex<RealScalar> odd = x[start + k + len / 2] * w;
+        x[start + k] = even + odd;
+        x[start + k + len / 2] = even - odd;
+        w *= w_len;
+      }
+    }
+  }
+  if (inverse) {
+    for (auto& value : x) {
+      value /= static_cast<RealScalar>(n);
+    }
+  }
+}
+
+// Convolves the dense coefficient vectors a and b into product (which must
+// not alias either input), choosing direct convolution or the FFT by cost.
+// The FFT scratch is thread_local so that repeated high-degree products
+// reuse their allocations.
+template <typename CoefficientType>
+void ConvolveCoefficients(const vector<CoefficientType>& a,
+                          const vector<CoefficientType>& b,
+                          vector<CoefficientType>* product) {
+  typedef typename Eigen::NumTraits<CoefficientType>::Real RealScalar;
+  DRAKE_ASSERT(!a.empty() && !b.empty());
+  const size_t product_size = a.size() + b.size() - 1;
+  if (static_cast<int64_t>(a.size()) * static_cast<int64_t>(b.size()) <=
+      kFftCrossover) {
+    product->assign(product_size, CoefficientType{0});
+    for (size_t i = 0; i < a.size(); ++i) {
+      for (size_t j = 0; j < b.size(); ++j) {
+        (*product)[i + j] += a[i] * b[j];
+      }
+    }
+    return;
+  }
+  size_t n = 1;
+  while (n < product_size) n <<= 1;
+  thread_local vector<std::complex<RealScalar>> fft_a;
+  thread_local vector<std::complex<RealScalar>> fft_b;
+  fft_a.assign(n, std::complex<RealScalar>{0});
+  fft_b.assign(n, std::complex<RealScalar>{0});
+  std::copy(a.begin(), a.end(), fft_a.begin());
+  std::copy(b.begin(), b.end(), fft_b.begin());
+  RadixTwoFft(&fft_a, false);
+  RadixTwoFft(&fft_b, false);
+  for (size_t i = 0; i < n; ++i) {
+    fft_a[i] *= fft_b[i];
+  }
+  RadixTwoFft(&fft_a, true);
+  product->resize(product_size);
+  for (size_t i = 0; i < product_size; ++i) {
+    (*product)[i] = static_cast<CoefficientType>(fft_a[i].real());
+  }
+}
+
+// Accumulates scale times p's monomials into the dense univariate
+// coefficient vector (constant term first), which must already be at least
+// degree + 1 long.
+template <typename CoefficientType>
+void AccumulateDenseCoefficients(const Polynomial<CoefficientType>& p,
+                                 const CoefficientType& scale,
+                                 vector<CoefficientType>* coefficients) {
+  for (const auto& monomial : p.GetMonomials()) {
+    const int power = monomial.terms.empty() ? 0 : monomial.terms[0].power;
+    (*coefficients)[power] += scale * monomial.coefficient;
+  }
+}
+
+}  // namespace
+
 template <typename CoefficientType>
 bool Polynomial<CoefficientType>::Monomial::HasSameExponents(
     const Monomial& other) const {
@@ -331,6 +448,30 @@ bool Polynomial<CoefficientType>::operator==(
 template <typename CoefficientType>
 Polynomial<CoefficientType>& Polynomial<CoefficientType>::operator+=(
     const Polynomial<CoefficientType>& other) {
+  // When both addends are univariate in the same variable and dense in
+  // their coefficients, accumulate coefficient-wise instead of
+  // concatenating monomial lists and re-merging duplicates (which is
+  // quadratic in the term count).
+  VarType this_var{};
+  VarType other_var{};
+  if (GetUnivariateVariable(&this_var) &&
+      other.GetUnivariateVariable(&other_var) &&
+      (this_var == 0 || other_var == 0 || this_var == other_var)) {
+    const int this_degree = GetDegree();
+    const int other_degree = other.GetDegree();
+    if (IsDenseEnough(this_degree, GetNumberOfCoefficients()) &&
+        IsDenseEnough(other_degree, other.GetNumberOfCoefficients())) {
+      thread_local vector<CoefficientType> scratch;
+      scratch.assign(std::max(this_degree, other_degree) + 1,
+                     CoefficientType{0});
+      AccumulateDenseCoefficients(*this, CoefficientType{1}, &scratch);
+      AccumulateDenseCoefficients(other, CoefficientType{1}, &scratch);
+      SetFromUnivariateCoefficients(scratch,
+                                    (this_var != 0) ? this_var : other_var);
+      return *this;
+    }
+  }
+
   for (const auto& iter : other.monomials_) {
     monomials_.push_back(iter);
   }
@@ -341,6 +482,27 @@ Polynomial<CoefficientType>& Polynomial<CoefficientType>::operator+=(
 template <typename CoefficientType>
 Polynomial<CoefficientType>& Polynomial<CoefficientType>::operator-=(
     const Polynomial<CoefficientType>& other) {
+  // See the dense fast-path rationale in operator+=.
+  VarType this_var{};
+  VarType other_var{};
+  if (GetUnivariateVariable(&this_var) &&
+      other.GetUnivariateVariable(&other_var) &&
+      (this_var == 0 || other_var == 0 || this_var == other_var)) {
+    const int this_degree = GetDegree();
+    const int other_degree = other.GetDegree();
+    if (IsDenseEnough(this_degree, GetNumberOfCoefficients()) &&
+        IsDenseEnough(other_degree, other.GetNumberOfCoefficients())) {
+      thread_local vector<CoefficientType> scratch;
+      scratch.assign(std::max(this_degree, other_degree) + 1,
+                     CoefficientType{0});
+      AccumulateDenseCoefficients(*this, CoefficientType{1}, &scratch);
+      AccumulateDenseCoefficients(other, CoefficientType{-1}, &scratch);
+      SetFromUnivariateCoefficients(scratch,
+                                    (this_var != 0) ? this_var : other_var);
+      return *this;
+    }
+  }
+
   for (const auto& iter : other.monomials_) {
     monomials_.push_back(iter);
     monomials_.back().coefficient *= CoefficientType{-1};
@@ -352,6 +514,33 @@ Polynomial<CoefficientType>& Polynomial<CoefficientType>::operator-=(
 template <typename CoefficientType>
 Polynomial<CoefficientType>& Polynomial<CoefficientType>::operator*=(
     const Polynomial<CoefficientType>& other) {
+  // Univariate products of dense factors are formed by dense coefficient
+  // convolution (FFT-based at high degree; see ConvolveCoefficients)
+  // instead of the all-pairs monomial product below.
+  VarType this_var{};
+  VarType other_var{};
+  if (!monomials_.empty() && !other.monomials_.empty() &&
+      GetUnivariateVariable(&this_var) &&
+      other.GetUnivariateVariable(&other_var) &&
+      (this_var == 0 || other_var == 0 || this_var == other_var)) {
+    const int this_degree = GetDegree();
+    const int other_degree = other.GetDegree();
+    if (IsDenseEnough(this_degree, GetNumberOfCoefficients()) &&
+        IsDenseEnough(other_degree, other.GetNumberOfCoefficients())) {
+      thread_local vector<CoefficientType> dense_this;
+      thread_local vector<CoefficientType> dense_other;
+      thread_local vector<CoefficientType> dense_product;
+      dense_this.assign(this_degree + 1, CoefficientType{0});
+      AccumulateDenseCoefficients(*this, CoefficientType{1}, &dense_this);
+      dense_other.assign(other_degree + 1, CoefficientType{0});
+      AccumulateDenseCoefficients(other, CoefficientType{1}, &dense_other);
+      ConvolveCoefficients(dense_this, dense_other, &dense_product);
+      SetFromUnivariateCoefficients(dense_product,
+                                    (this_var != 0) ? this_var : other_var);
+      return *this;
+    }
+  }
+
   vector<Monomial> new_monomials;
 
   for (const auto& iter : monomials_) {
@@ -610,6 +799,40 @@ void Polynomial<CoefficientType>::MakeMonomialsUnique(void) {
   }
 }
 
+template <typename CoefficientType>
+bool Polynomial<CoefficientType>::GetUnivariateVariable(VarType* var) const {
+  DRAKE_ASSERT(var != nullptr);
+  if (!is_univariate_) return false;
+  *var = 0;
+  for (const Monomial& monomial : monomials_) {
+    if (!monomial.terms.empty()) {
+      *var = monomial.terms[0].var;
+      break;
+    }
+  }
+  return true;
+}
+
+template <typename CoefficientType>
+void Polynomial<CoefficientType>::SetFromUnivariateCoefficients(
+    const std::vector<CoefficientType>& coefficients, VarType var) {
+  monomials_.clear();
+  for (size_t i = 0; i < coefficients.size(); ++i) {
+    if (coefficients[i] == CoefficientType{0}) continue;
+    Monomial m;
+    m.coefficient = coefficients[i];
+    if (i > 0) {
+      DRAKE_ASSERT(var != 0);
+      Term t;
+      t.var = var;
+      t.power = static_cast<PowerType>(i);
+      m.terms.push_back(t);
+    }
+    monomials_.push_back(m);
+  }
+  is_univariate_ = true;
+}
+
 template class Polynomial<double>;
 
 // template class Polynomial<std::complex<double>>;
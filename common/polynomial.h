@@ -297,10 +297,19 @@ class Polynomial {
 
   bool operator==(const Polynomial& other) const;
 
+  /// Adds other to this Polynomial in place.  When both addends are
+  /// univariate in the same variable and dense in their coefficients, the
+  /// sum is accumulated coefficient-wise instead of concatenating the
+  /// monomial lists and re-merging duplicates.
   Polynomial& operator+=(const Polynomial& other);
 
   Polynomial& operator-=(const Polynomial& other);
 
+  /// Multiplies this Polynomial by other in place.  Univariate products of
+  /// sufficiently dense factors are formed by dense coefficient convolution
+  /// (FFT-based above a size crossover) instead of the all-pairs monomial
+  /// product; FFT-computed coefficients are exact only up to floating-point
+  /// rounding.
   Polynomial& operator*=(const Polynomial& other);
 
   Polynomial& operator+=(const CoefficientType& scalar);
@@ -444,6 +453,17 @@ class Polynomial {
  private:
   /// Sorts through Monomial list and merges any that have the same powers.
   void MakeMonomialsUnique(void);
+
+  /// If this Polynomial has at most one distinct variable, writes it to var
+  /// (writing 0 if this Polynomial is constant) and returns true; returns
+  /// false for multivariate Polynomials.
+  bool GetUnivariateVariable(VarType* var) const;
+
+  /// Overwrites this Polynomial with the given dense univariate coefficient
+  /// vector (constant term first) in the variable var; Monomials are created
+  /// only for nonzero coefficients, preserving sparse structure.
+  void SetFromUnivariateCoefficients(
+      const std::vector<CoefficientType>& coefficients, VarType var);
 };
 
 /** Provides power function for Polynomial. */
@@ -125,7 +125,7 @@ void PublishCallMatlab(const MatlabRPC& message) {
 
 void PublishCall(
     google::protobuf::io::FileOutputStream* praw_output,
-    const MatlabRPC& message) {
+    const MatlabRPC& message, bool flush) {
   DRAKE_DEMAND(praw_output);
   auto& raw_output = *praw_output;
 
@@ -148,7 +148,9 @@ void PublishCall(
     }
   }
 
-  raw_output.Flush();
+  if (flush) {
+    raw_output.Flush();
+  }
 }
 
 }  // namespace internal
@@ -90,9 +90,12 @@ void AssembleCallMatlabMsg(MatlabRPC* msg, T first, Types... args) {
 std::unique_ptr<google::protobuf::io::FileOutputStream>
 CreateOutputStream(const std::string& filename);
 
+// Serializes @p message into @p praw_output.  When @p flush is true the
+// stream is flushed to the pipe afterwards; batching callers may pass false
+// and flush once at the end instead.
 void PublishCall(
     google::protobuf::io::FileOutputStream* praw_output,
-    const MatlabRPC& message);
+    const MatlabRPC& message, bool flush = true);
 
 // Simple wrapper to prevent the outside world from needing to worry about
 // creating a the i/o stream object.
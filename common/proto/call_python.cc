@@ -1,6 +1,7 @@
 #include "drake/common/proto/call_python.h"
 
 #include <memory>
+#include <stdexcept>
 
 #include "drake/common/proto/matlab_rpc.pb.h"
 #include "drake/common/proto/rpc_pipe_temp_directory.h"
@@ -47,14 +48,31 @@ auto GetPythonOutputStream(const std::string* filename = nullptr) {
   return raw_output.get();
 }
 
+// Depth of the currently open CallPythonBeginBatch/CallPythonEndBatch
+// nesting; the pipe is flushed only when the outermost batch closes.
+int py_batch_depth = 0;
+
 }  // namespace
 
 void CallPythonInit(const std::string& filename) {
   GetPythonOutputStream(&filename);
 }
 
+void CallPythonBeginBatch() { ++py_batch_depth; }
+
+void CallPythonEndBatch() {
+  if (py_batch_depth == 0) {
+    throw std::runtime_error(
+        "`CallPythonEndBatch` called without a matching "
+        "`CallPythonBeginBatch`");
+  }
+  if (--py_batch_depth == 0) {
+    GetPythonOutputStream()->Flush();
+  }
+}
+
 void internal::PublishCallPython(const MatlabRPC& message) {
-  PublishCall(GetPythonOutputStream(), message);
+  PublishCall(GetPythonOutputStream(), message, py_batch_depth == 0);
 }
 
 }  // namespace common
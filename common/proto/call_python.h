@@ -201,6 +201,19 @@ void PublishCallPython(const MatlabRPC& msg);
 /// already been called.
 void CallPythonInit(const std::string& filename);
 
+/// Begins a batch of `CallPython` invocations.  While a batch is open each
+/// call is still serialized immediately, but the underlying pipe is only
+/// flushed when the matching `CallPythonEndBatch` closes the outermost batch,
+/// so plotting a large trace costs one flush instead of one per call.
+/// (Matrix arguments always travel as a single raw byte block, batched or
+/// not.)  Batches may be nested.
+void CallPythonBeginBatch();
+
+/// Ends a batch started with `CallPythonBeginBatch`, flushing all buffered
+/// calls once the outermost batch closes.
+/// @throws std::runtime_error if no batch is open.
+void CallPythonEndBatch();
+
 /// Calls a Python client with a given function and arguments, returning
 /// a handle to the result.
 template <typename... Types>
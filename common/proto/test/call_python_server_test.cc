@@ -70,6 +70,21 @@ GTEST_TEST(TestCallPython, DispEigenMatrix) {
   CallPython("print", b);
 }
 
+GTEST_TEST(TestCallPython, BatchedCalls) {
+  // The batched calls must arrive at the client in order, with the pipe
+  // flushed only once at EndBatch.
+  CallPythonBeginBatch();
+  for (int i = 0; i < 5; ++i) {
+    CallPython("print", i);
+  }
+  Eigen::VectorXd trace = Eigen::VectorXd::LinSpaced(100, 0., 1.);
+  CallPython("print", trace.sum());
+  CallPythonEndBatch();
+
+  // Unmatched EndBatch throws.
+  EXPECT_THROW(CallPythonEndBatch(), std::runtime_error);
+}
+
 GTEST_TEST(TestCallPython, RemoteVarTest) {
   auto magic = CallPython("magic", 3);
   // N.B. `var.slice(x, y, ...)` and `var[x][y]...` should be interchangeable if
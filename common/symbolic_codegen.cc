@@ -5,6 +5,10 @@
 
 #include <fmt/format.h>
 
+#define DRAKE_COMMON_SYMBOLIC_DETAIL_HEADER
+#include "drake/common/symbolic_expression_cell.h"
+#undef DRAKE_COMMON_SYMBOLIC_DETAIL_HEADER
+
 namespace drake {
 namespace symbolic {
 
@@ -21,7 +25,21 @@ CodeGenVisitor::CodeGenVisitor(const vector<Variable>& parameters) {
   }
 }
 
+CodeGenVisitor::CodeGenVisitor(
+    const vector<Variable>& parameters,
+    const std::unordered_map<const ExpressionCell*, string>* substitutions)
+    : CodeGenVisitor{parameters} {
+  substitutions_ = substitutions;
+}
+
 string CodeGenVisitor::CodeGen(const Expression& e) const {
+  if (substitutions_ != nullptr) {
+    const auto it{
+        substitutions_->find(internal::GetExpressionCellPointer(e))};
+    if (it != substitutions_->end()) {
+      return it->second;
+    }
+  }
   return VisitExpression<string>(this, e);
 }
 
@@ -177,6 +195,38 @@ string CodeGenVisitor::VisitUninterpretedFunction(const Expression&) const {
   throw runtime_error("Codegen does not support uninterpreted functions.");
 }
 
+namespace internal {
+const ExpressionCell* GetExpressionCellPointer(const Expression& e) {
+  switch (e.get_kind()) {
+    case ExpressionKind::Constant:
+      return to_constant(e).get();
+    case ExpressionKind::Var:
+      return to_variable(e).get();
+    case ExpressionKind::Add:
+      return to_addition(e).get();
+    case ExpressionKind::Mul:
+      return to_multiplication(e).get();
+    case ExpressionKind::Div:
+    case ExpressionKind::Pow:
+    case ExpressionKind::Atan2:
+    case ExpressionKind::Min:
+    case ExpressionKind::Max:
+      return to_binary(e).get();
+    case ExpressionKind::IfThenElse:
+      return to_if_then_else(e).get();
+    case ExpressionKind::UninterpretedFunction:
+      return to_uninterpreted_function(e).get();
+    case ExpressionKind::NaN:
+      // No cell accessor exists for NaN; callers treat nullptr as "never
+      // shared".
+      return nullptr;
+    default:
+      // The remaining kinds are all unary.
+      return to_unary(e).get();
+  }
+}
+}  // namespace internal
+
 string CodeGen(const string& function_name, const vector<Variable>& parameters,
                const Expression& e) {
   ostringstream oss;
@@ -28,6 +28,16 @@ class CodeGenVisitor {
   /// parameters.
   explicit CodeGenVisitor(const std::vector<Variable>& parameters);
 
+  /// Constructs a visitor which additionally replaces subexpressions: an
+  /// expression whose cell appears as a key of @p substitutions is emitted as
+  /// the mapped C identifier instead of being generated recursively. This is
+  /// used to emit common subexpressions as named temporaries. The map is
+  /// aliased, not copied, so later insertions are visible to this visitor; it
+  /// must outlive the visitor.
+  CodeGenVisitor(const std::vector<Variable>& parameters,
+                 const std::unordered_map<const ExpressionCell*, std::string>*
+                     substitutions);
+
   /// Generates C expression for the expression @p e.
   std::string CodeGen(const Expression& e) const;
 
@@ -68,8 +78,18 @@ class CodeGenVisitor {
                                                   const Expression&);
 
   IdToIndexMap id_to_idx_map_;
+  const std::unordered_map<const ExpressionCell*, std::string>* substitutions_{
+      nullptr};
 };
 
+namespace internal {
+// Returns the address of the cell backing @p e, to be used as an identity key
+// when detecting common subexpressions (structurally identical expressions
+// share a single interned cell). Returns nullptr for the rare kinds that have
+// no public cell accessor; such expressions are never shared by the caller.
+const ExpressionCell* GetExpressionCellPointer(const Expression& e);
+}  // namespace internal
+
 /// @defgroup codegen Code Generation
 /// @{
 /// Provides `CodeGen` functions which generate C99 code to evaluate symbolic
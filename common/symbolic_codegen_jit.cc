@@ -0,0 +1,234 @@
+#include "drake/common/symbolic_codegen_jit.h"
+
+#include <dlfcn.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/temp_directory.h"
+
+namespace drake {
+namespace symbolic {
+namespace {
+
+// Calls @p f on every immediate subexpression of @p e.
+template <typename F>
+void ForEachSubexpression(const Expression& e, const F& f) {
+  switch (e.get_kind()) {
+    case ExpressionKind::Constant:
+    case ExpressionKind::Var:
+    case ExpressionKind::NaN:
+      break;
+    case ExpressionKind::Add:
+      for (const auto& p : get_expr_to_coeff_map_in_addition(e)) {
+        f(p.first);
+      }
+      break;
+    case ExpressionKind::Mul:
+      for (const auto& p : get_base_to_exponent_map_in_multiplication(e)) {
+        f(p.first);
+        f(p.second);
+      }
+      break;
+    case ExpressionKind::Div:
+    case ExpressionKind::Pow:
+    case ExpressionKind::Atan2:
+    case ExpressionKind::Min:
+    case ExpressionKind::Max:
+      f(get_first_argument(e));
+      f(get_second_argument(e));
+      break;
+    case ExpressionKind::IfThenElse:
+    case ExpressionKind::UninterpretedFunction:
+      // CodeGenVisitor rejects these kinds; leave them to it.
+      break;
+    default:
+      // The remaining kinds are all unary.
+      f(get_argument(e));
+      break;
+  }
+}
+
+// Returns true if hoisting @p e into a named temporary saves work; constants
+// and variables are cheaper to re-emit inline.
+bool IsWorthHoisting(const Expression& e) {
+  switch (e.get_kind()) {
+    case ExpressionKind::Constant:
+    case ExpressionKind::Var:
+    case ExpressionKind::NaN:
+    case ExpressionKind::IfThenElse:
+    case ExpressionKind::UninterpretedFunction:
+      return false;
+    default:
+      return true;
+  }
+}
+
+// Counts how often each distinct subexpression occurs across the DAG rooted
+// at @p e. Thanks to cell interning, structurally identical subexpressions
+// share one cell, so identity is just the cell address. Children are only
+// descended into on the first visit.
+void CountOccurrences(
+    const Expression& e,
+    std::unordered_map<const ExpressionCell*, int>* const counts) {
+  const ExpressionCell* const cell{internal::GetExpressionCellPointer(e)};
+  if (cell == nullptr) {
+    return;
+  }
+  if (++(*counts)[cell] > 1) {
+    return;
+  }
+  ForEachSubexpression(
+      e, [counts](const Expression& child) { CountOccurrences(child, counts); });
+}
+
+// Emits, in dependency order, a `const double t<k> = ...;` statement for
+// every subexpression under @p e that occurs more than once, registering the
+// name in @p names so that later emissions (including those of enclosing
+// temporaries) refer to it.
+void EmitTemporaries(
+    const Expression& e,
+    const std::unordered_map<const ExpressionCell*, int>& counts,
+    const CodeGenVisitor& visitor,
+    std::unordered_set<const ExpressionCell*>* const visited,
+    std::unordered_map<const ExpressionCell*, std::string>* const names,
+    std::ostream* const os) {
+  const ExpressionCell* const cell{internal::GetExpressionCellPointer(e)};
+  if (cell == nullptr || !visited->insert(cell).second) {
+    return;
+  }
+  ForEachSubexpression(e, [&](const Expression& child) {
+    EmitTemporaries(child, counts, visitor, visited, names, os);
+  });
+  if (counts.at(cell) > 1 && IsWorthHoisting(e)) {
+    // Generate the definition before naming the cell, so that the definition
+    // refers to child temporaries but not to itself.
+    const std::string definition{visitor.CodeGen(e)};
+    const std::string name{"t" + std::to_string(names->size())};
+    (*os) << "    const double " << name << " = " << definition << ";\n";
+    names->emplace(cell, name);
+  }
+}
+
+// Generates the C source for the dense matrix @p M with explicit
+// common-subexpression elimination: shared subtrees become named temporaries
+// computed once, which keeps the emitted source (and the C compiler's work)
+// proportional to the size of the expression DAG rather than its tree
+// expansion.
+std::string CodeGenWithCse(const std::string& function_name,
+                           const std::vector<Variable>& parameters,
+                           const MatrixX<Expression>& M) {
+  std::unordered_map<const ExpressionCell*, int> counts;
+  for (int i = 0; i < M.size(); ++i) {
+    CountOccurrences(M.data()[i], &counts);
+  }
+  std::unordered_map<const ExpressionCell*, std::string> names;
+  const CodeGenVisitor visitor{parameters, &names};
+  std::ostringstream body;
+  std::unordered_set<const ExpressionCell*> visited;
+  for (int i = 0; i < M.size(); ++i) {
+    EmitTemporaries(M.data()[i], counts, visitor, &visited, &names, &body);
+  }
+  for (int i = 0; i < M.size(); ++i) {
+    body << "    m[" << i << "] = " << visitor.CodeGen(M.data()[i]) << ";\n";
+  }
+  std::ostringstream source;
+  source << "void " << function_name << "(const double* p, double* m) {\n"
+         << body.str() << "}\n";
+  // Note: CodeGenDenseMeta() is not reused here because the braced return
+  // statement it emits is C++-only; this function body must compile as C99.
+  source << "typedef struct {\n"
+            "    /* p: input, vector */\n"
+            "    struct { int size; } p;\n"
+            "    /* m: output, matrix */\n"
+            "    struct { int rows; int cols; } m;\n"
+            "} "
+         << function_name << "_meta_t;\n"
+         << function_name << "_meta_t " << function_name << "_meta() {\n"
+         << "    const " << function_name << "_meta_t meta = {{"
+         << parameters.size() << "}, {" << M.rows() << ", " << M.cols()
+         << "}};\n"
+            "    return meta;\n"
+            "}\n";
+  return source.str();
+}
+
+}  // namespace
+
+JitCompiledFunction::JitCompiledFunction(
+    const std::string& function_name, const std::vector<Variable>& parameters,
+    const MatrixX<Expression>& M)
+    : parameter_size_(static_cast<int>(parameters.size())),
+      rows_(static_cast<int>(M.rows())),
+      cols_(static_cast<int>(M.cols())) {
+  DRAKE_THROW_UNLESS(!function_name.empty());
+  // Each instance gets its own subdirectory: temp_directory() returns the
+  // same directory on every call when TEST_TMPDIR is set, and dlopen()
+  // caches libraries by path, so reusing a path would silently load a
+  // previously compiled function.
+  std::string directory = temp_directory() + "/codegen_jit_XXXXXX";
+  DRAKE_THROW_UNLESS(::mkdtemp(&directory[0]) != nullptr);
+  const std::string source_path = directory + "/" + function_name + ".c";
+  const std::string library_path = directory + "/" + function_name + ".so";
+  {
+    std::ofstream source(source_path);
+    if (!source.is_open()) {
+      throw std::runtime_error(
+          fmt::format("JitCompiledFunction: cannot write source file '{}'.",
+                      source_path));
+    }
+    // The code emitted by CodeGen() may call functions declared in <math.h>.
+    source << "#include <math.h>\n\n"
+           << CodeGenWithCse(function_name, parameters, M);
+  }
+  // -O2 lets the C compiler perform common-subexpression elimination over the
+  // generated straight-line code; -fno-math-errno additionally allows calls
+  // such as sqrt() to be treated as pure so that repeated calls with the same
+  // argument collapse to one.
+  const std::string command =
+      fmt::format("cc -std=c99 -O2 -fno-math-errno -fPIC -shared -o '{}' '{}'",
+                  library_path, source_path);
+  if (std::system(command.c_str()) != 0) {
+    throw std::runtime_error(fmt::format(
+        "JitCompiledFunction: compilation of '{}' failed. The compile "
+        "command was: {}",
+        source_path, command));
+  }
+  library_handle_ = dlopen(library_path.c_str(), RTLD_NOW | RTLD_LOCAL);
+  if (library_handle_ == nullptr) {
+    throw std::runtime_error(fmt::format(
+        "JitCompiledFunction: dlopen of '{}' failed: {}", library_path,
+        dlerror()));
+  }
+  function_ = reinterpret_cast<GeneratedFunction>(
+      dlsym(library_handle_, function_name.c_str()));
+  if (function_ == nullptr) {
+    throw std::runtime_error(fmt::format(
+        "JitCompiledFunction: cannot resolve symbol '{}' in '{}'.",
+        function_name, library_path));
+  }
+}
+
+JitCompiledFunction::~JitCompiledFunction() {
+  if (library_handle_ != nullptr) dlclose(library_handle_);
+}
+
+void JitCompiledFunction::Eval(const Eigen::Ref<const Eigen::VectorXd>& p,
+                               EigenPtr<Eigen::MatrixXd> m) const {
+  DRAKE_THROW_UNLESS(static_cast<int>(p.size()) == parameter_size_);
+  DRAKE_DEMAND(m != nullptr);
+  DRAKE_THROW_UNLESS(m->rows() == rows_ && m->cols() == cols_);
+  function_(p.data(), m->data());
+}
+
+}  // namespace symbolic
+}  // namespace drake
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/symbolic.h"
+
+namespace drake {
+namespace symbolic {
+
+/// Compiles the C99 code produced by CodeGen() into a shared library at
+/// runtime and loads the generated function with `dlopen()` so that it can be
+/// called directly.
+///
+/// Before emitting C, subexpressions shared between (or within) matrix
+/// entries are eliminated: every subtree that occurs more than once becomes a
+/// named temporary computed exactly once, so the generated source stays
+/// proportional to the size of the expression DAG rather than its tree
+/// expansion. The result is compiled with `-O2`, which additionally performs
+/// register allocation and local optimization across the emitted statements.
+/// For expressions that are evaluated many times with different parameter
+/// values (e.g. the dynamics of a fixed model inside a rollout or optimization
+/// loop) this is typically much faster than interpreting the expression trees
+/// with Evaluate().
+///
+/// The generated source file and shared library are placed under
+/// temp_directory(); the library is unloaded when this object is destroyed.
+class JitCompiledFunction {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(JitCompiledFunction)
+
+  /// Generates code for the symbolic matrix @p M (see CodeGen()), compiles it
+  /// with the system C compiler, and loads the resulting function.
+  ///
+  /// @param[in] function_name Name of the generated C function. It must be a
+  ///                          valid C identifier.
+  /// @param[in] parameters    Vector of variables providing the ordering of
+  ///                          the input parameters.
+  /// @param[in] M             Symbolic matrix to compile. All variables in
+  ///                          @p M must appear in @p parameters.
+  /// @throws std::runtime_error if code generation, compilation, or loading
+  /// of the shared library fails.
+  JitCompiledFunction(const std::string& function_name,
+                      const std::vector<Variable>& parameters,
+                      const MatrixX<Expression>& M);
+
+  ~JitCompiledFunction();
+
+  /// Returns the number of input parameters taken by the compiled function.
+  int parameter_size() const { return parameter_size_; }
+
+  /// Returns the number of rows of the compiled matrix function.
+  int rows() const { return rows_; }
+
+  /// Returns the number of columns of the compiled matrix function.
+  int cols() const { return cols_; }
+
+  /// Evaluates the compiled function at the parameter values @p p and writes
+  /// the result into the preallocated buffer @p m; no memory is allocated on
+  /// this path, so it is safe to call in tight rollout loops.
+  /// @throws std::runtime_error if `p.size() != parameter_size()` or @p m is
+  /// not of size `rows()` x `cols()`.
+  void Eval(const Eigen::Ref<const Eigen::VectorXd>& p,
+            EigenPtr<Eigen::MatrixXd> m) const;
+
+ private:
+  // Signature of the function emitted by CodeGen() for a dense matrix.
+  using GeneratedFunction = void (*)(const double* p, double* m);
+
+  int parameter_size_{0};
+  int rows_{0};
+  int cols_{0};
+  void* library_handle_{nullptr};
+  GeneratedFunction function_{nullptr};
+};
+
+}  // namespace symbolic
+}  // namespace drake
@@ -1,13 +1,20 @@
 // NOLINTNEXTLINE(build/include): Its header file is included in symbolic.h.
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstddef>
+#include <exception>
+#include <functional>
 #include <ios>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <Eigen/Core>
@@ -43,16 +50,16 @@ bool operator<(ExpressionKind k1, ExpressionKind k2) {
 
 namespace {
 // This function is used in Expression(const double d) constructor. It turns out
-// a ternary expression "std::isnan(d) ? make_shared<const ExpressionNaN>() :
-// make_shared<const ExpressionConstant>()" does not work due to C++'s
+// a ternary expression "std::isnan(d) ? MakeExpressionCell<ExpressionNaN>() :
+// MakeExpressionCell<ExpressionConstant>()" does not work due to C++'s
 // type-system. It throws "Incompatible operand types when using ternary
 // conditional operator" error. Related S&O entry:
 // http://stackoverflow.com/questions/29842095/incompatible-operand-types-when-using-ternary-conditional-operator.
 shared_ptr<const ExpressionCell> make_cell(const double d) {
   if (std::isnan(d)) {
-    return make_shared<const ExpressionNaN>();
+    return MakeExpressionCell<ExpressionNaN>();
   }
-  return make_shared<const ExpressionConstant>(d);
+  return MakeExpressionCell<ExpressionConstant>(d);
 }
 
 // Negates an addition expression.
@@ -71,10 +78,146 @@ Expression NegateMultiplication(const Expression& e) {
 }  // namespace
 
 Expression::Expression(const Variable& var)
-    : ptr_{make_shared<const ExpressionVar>(var)} {}
-Expression::Expression(const double d) : ptr_{make_cell(d)} {}
+    : ptr_{Intern(MakeExpressionCell<ExpressionVar>(var))} {}
+Expression::Expression(const double d) : ptr_{Intern(make_cell(d))} {}
 Expression::Expression(std::shared_ptr<const ExpressionCell> ptr)
-    : ptr_{std::move(ptr)} {}
+    : ptr_{Intern(std::move(ptr))} {}
+
+namespace internal {
+
+void* ExpressionArenaMemory::Allocate(std::size_t size,
+                                      const std::size_t alignment) {
+  DRAKE_ASSERT(alignment <= alignof(std::max_align_t));
+  // Round the size up so that successive allocations stay aligned.
+  constexpr std::size_t granule = alignof(std::max_align_t);
+  size = (size + granule - 1) & ~(granule - 1);
+  if (remaining_ < size) {
+    next_block_size_ = std::max(next_block_size_, size);
+    blocks_.push_back(std::make_unique<char[]>(next_block_size_));
+    head_ = blocks_.back().get();
+    remaining_ = next_block_size_;
+    // Grow geometrically so that large expression graphs settle into a small
+    // number of big blocks.
+    next_block_size_ *= 2;
+  }
+  void* const result = head_;
+  head_ += size;
+  remaining_ -= size;
+  bytes_allocated_ += size;
+  return result;
+}
+
+std::shared_ptr<ExpressionArenaMemory>& GetThreadLocalExpressionArenaMemory() {
+  static thread_local std::shared_ptr<ExpressionArenaMemory> memory;
+  return memory;
+}
+
+}  // namespace internal
+
+ExpressionArena::ExpressionArena()
+    : memory_{std::make_shared<internal::ExpressionArenaMemory>()},
+      previous_{internal::GetThreadLocalExpressionArenaMemory()} {
+  internal::GetThreadLocalExpressionArenaMemory() = memory_;
+}
+
+ExpressionArena::~ExpressionArena() {
+  internal::GetThreadLocalExpressionArenaMemory() = previous_;
+}
+
+namespace {
+// 64-bit variant of the boost::hash_combine mixing function.
+size_t CombineHash(const size_t lhs, const size_t rhs) {
+  return lhs ^ (rhs + 0x9e3779b97f4a7c15ULL + (lhs << 6) + (lhs >> 2));
+}
+}  // namespace
+
+shared_ptr<const ExpressionCell> Expression::Intern(
+    shared_ptr<const ExpressionCell> ptr) {
+  const ExpressionKind kind{ptr->get_kind()};
+  // Cells whose payload includes a Formula or an uninterpreted function are
+  // rare enough that sharing them is not worth hashing their payloads here.
+  if (kind == ExpressionKind::IfThenElse ||
+      kind == ExpressionKind::UninterpretedFunction) {
+    return ptr;
+  }
+
+  // Hash the cell shallowly: immediate payloads by value, subexpressions by
+  // cell address. Interning guarantees that structurally equal subexpressions
+  // already share one cell, so a child's address identifies its structure and
+  // the hash costs O(arity) instead of a full traversal.
+  const auto hash_child = [](const Expression& e) {
+    return std::hash<const void*>{}(e.ptr_.get());
+  };
+  const auto hash_double = [](const double v) { return std::hash<double>{}(v); };
+  size_t h{CombineHash(0, static_cast<size_t>(kind))};
+  switch (kind) {
+    case ExpressionKind::Constant:
+      h = CombineHash(h, hash_double(to_constant(ptr)->get_value()));
+      break;
+    case ExpressionKind::Var:
+      h = CombineHash(h, std::hash<Variable::Id>{}(
+                             to_variable(ptr)->get_variable().get_id()));
+      break;
+    case ExpressionKind::Add: {
+      const auto add = to_addition(ptr);
+      h = CombineHash(h, hash_double(add->get_constant()));
+      for (const auto& p : add->get_expr_to_coeff_map()) {
+        h = CombineHash(h, hash_child(p.first));
+        h = CombineHash(h, hash_double(p.second));
+      }
+      break;
+    }
+    case ExpressionKind::Mul: {
+      const auto mul = to_multiplication(ptr);
+      h = CombineHash(h, hash_double(mul->get_constant()));
+      for (const auto& p : mul->get_base_to_exponent_map()) {
+        h = CombineHash(h, hash_child(p.first));
+        h = CombineHash(h, hash_child(p.second));
+      }
+      break;
+    }
+    case ExpressionKind::Div:
+    case ExpressionKind::Pow:
+    case ExpressionKind::Atan2:
+    case ExpressionKind::Min:
+    case ExpressionKind::Max: {
+      const auto binary = to_binary(ptr);
+      h = CombineHash(h, hash_child(binary->get_first_argument()));
+      h = CombineHash(h, hash_child(binary->get_second_argument()));
+      break;
+    }
+    case ExpressionKind::NaN:
+      // All NaN cells are structurally equal; the kind alone identifies them.
+      break;
+    default:
+      // The remaining kinds are all unary.
+      h = CombineHash(h, hash_child(to_unary(ptr)->get_argument()));
+      break;
+  }
+
+  // The table holds weak references so that interning does not keep otherwise
+  // unreferenced cells alive; expired entries are pruned as buckets are
+  // traversed.
+  static never_destroyed<std::mutex> mutex;
+  static never_destroyed<std::unordered_map<
+      size_t, std::vector<std::weak_ptr<const ExpressionCell>>>>
+      table;
+  std::lock_guard<std::mutex> lock{mutex.access()};
+  std::vector<std::weak_ptr<const ExpressionCell>>& bucket{table.access()[h]};
+  for (auto it = bucket.begin(); it != bucket.end();) {
+    shared_ptr<const ExpressionCell> existing{it->lock()};
+    if (existing == nullptr) {
+      it = bucket.erase(it);
+      continue;
+    }
+    if (existing->get_kind() == kind && existing->EqualTo(*ptr)) {
+      return existing;
+    }
+    ++it;
+  }
+  bucket.push_back(ptr);
+  return ptr;
+}
 
 ExpressionKind Expression::get_kind() const {
   DRAKE_ASSERT(ptr_ != nullptr);
@@ -109,7 +252,7 @@ Expression Expression::E() {
 
 Expression Expression::NaN() {
   static const never_destroyed<Expression> nan{
-      Expression{make_shared<const ExpressionNaN>()}};
+      Expression{MakeExpressionCell<ExpressionNaN>()}};
   return nan.access();
 }
 
@@ -206,13 +349,91 @@ Expression Expression::Substitute(const Substitution& s) const {
   return *this;
 }
 
+namespace {
+// Memoization table for Differentiate() results, keyed by (cell, variable).
+// Interning guarantees that structurally equal subexpressions share a single
+// cell, so the cell address identifies a subtree; holding the shared_ptr in
+// the key keeps that address valid for the lifetime of the table.
+class DifferentiationCache {
+ public:
+  const Expression* Find(const shared_ptr<const ExpressionCell>& cell,
+                         const Variable::Id id) const {
+    const auto it = map_.find({cell.get(), id});
+    return (it != map_.end()) ? &it->second : nullptr;
+  }
+
+  void Insert(const shared_ptr<const ExpressionCell>& cell,
+              const Variable::Id id, const Expression& derivative) {
+    map_.emplace(Key{cell.get(), id}, derivative);
+    keep_alive_.push_back(cell);
+  }
+
+ private:
+  using Key = pair<const ExpressionCell*, Variable::Id>;
+  struct KeyHash {
+    size_t operator()(const Key& key) const {
+      return CombineHash(std::hash<const void*>{}(key.first),
+                         std::hash<Variable::Id>{}(key.second));
+    }
+  };
+  std::unordered_map<Key, Expression, KeyHash> map_;
+  vector<shared_ptr<const ExpressionCell>> keep_alive_;
+};
+
+DifferentiationCache*& GetThreadLocalDifferentiationCache() {
+  static thread_local DifferentiationCache* cache{nullptr};
+  return cache;
+}
+
+// Activates a DifferentiationCache on the current thread for the lifetime of
+// this object, so that nested Differentiate() calls share the results of
+// common subtrees. Scopes do not nest; the cache is only installed when the
+// thread does not already have one.
+class ScopedDifferentiationCache {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ScopedDifferentiationCache)
+
+  ScopedDifferentiationCache() {
+    DifferentiationCache*& thread_cache = GetThreadLocalDifferentiationCache();
+    if (thread_cache == nullptr) {
+      thread_cache = &cache_;
+      active_ = true;
+    }
+  }
+
+  ~ScopedDifferentiationCache() {
+    if (active_) {
+      GetThreadLocalDifferentiationCache() = nullptr;
+    }
+  }
+
+ private:
+  DifferentiationCache cache_;
+  bool active_{false};
+};
+}  // namespace
+
 Expression Expression::Differentiate(const Variable& x) const {
   DRAKE_ASSERT(ptr_ != nullptr);
-  return ptr_->Differentiate(x);
+  DifferentiationCache* const cache = GetThreadLocalDifferentiationCache();
+  if (cache == nullptr) {
+    return ptr_->Differentiate(x);
+  }
+  if (const Expression* const cached = cache->Find(ptr_, x.get_id())) {
+    return *cached;
+  }
+  // Note: differentiating a cell only recurses into its subexpressions, so
+  // the recursion below cannot reach this (cell, variable) pair again.
+  const Expression result{ptr_->Differentiate(x)};
+  cache->Insert(ptr_, x.get_id(), result);
+  return result;
 }
 
 RowVectorX<Expression> Expression::Jacobian(
     const Eigen::Ref<const VectorX<Variable>>& vars) const {
+  // Sharing differentiation results of common subtrees across the columns
+  // avoids re-deriving them once per variable.
+  ScopedDifferentiationCache cache;
   RowVectorX<Expression> J(vars.size());
   for (VectorX<Variable>::Index i = 0; i < vars.size(); ++i) {
     J(i) = Differentiate(vars(i));
@@ -520,7 +741,7 @@ Expression& operator/=(Expression& lhs, const Expression& rhs) {
     lhs = Expression::One();
     return lhs;
   }
-  lhs.ptr_ = make_shared<const ExpressionDiv>(lhs, rhs);
+  lhs.ptr_ = Expression::Intern(MakeExpressionCell<ExpressionDiv>(lhs, rhs));
   return lhs;
 }
 
@@ -556,7 +777,7 @@ Expression log(const Expression& e) {
     ExpressionLog::check_domain(v);
     return Expression{std::log(v)};
   }
-  return Expression{make_shared<const ExpressionLog>(e)};
+  return Expression{MakeExpressionCell<ExpressionLog>(e)};
 }
 
 Expression abs(const Expression& e) {
@@ -564,7 +785,7 @@ Expression abs(const Expression& e) {
   if (is_constant(e)) {
     return Expression{std::fabs(get_constant_value(e))};
   }
-  return Expression{make_shared<const ExpressionAbs>(e)};
+  return Expression{MakeExpressionCell<ExpressionAbs>(e)};
 }
 
 Expression exp(const Expression& e) {
@@ -572,7 +793,7 @@ Expression exp(const Expression& e) {
   if (is_constant(e)) {
     return Expression{std::exp(get_constant_value(e))};
   }
-  return Expression{make_shared<const ExpressionExp>(e)};
+  return Expression{MakeExpressionCell<ExpressionExp>(e)};
 }
 
 Expression sqrt(const Expression& e) {
@@ -588,7 +809,7 @@ Expression sqrt(const Expression& e) {
       return abs(get_first_argument(e));
     }
   }
-  return Expression{make_shared<const ExpressionSqrt>(e)};
+  return Expression{MakeExpressionCell<ExpressionSqrt>(e)};
 }
 
 Expression pow(const Expression& e1, const Expression& e2) {
@@ -616,9 +837,9 @@ Expression pow(const Expression& e1, const Expression& e2) {
     // pow(base, exponent) ^ e2 => pow(base, exponent * e2)
     const Expression& base{get_first_argument(e1)};
     const Expression& exponent{get_second_argument(e1)};
-    return Expression{make_shared<const ExpressionPow>(base, exponent * e2)};
+    return Expression{MakeExpressionCell<ExpressionPow>(base, exponent * e2)};
   }
-  return Expression{make_shared<const ExpressionPow>(e1, e2)};
+  return Expression{MakeExpressionCell<ExpressionPow>(e1, e2)};
 }
 
 Expression sin(const Expression& e) {
@@ -626,7 +847,7 @@ Expression sin(const Expression& e) {
   if (is_constant(e)) {
     return Expression{std::sin(get_constant_value(e))};
   }
-  return Expression{make_shared<const ExpressionSin>(e)};
+  return Expression{MakeExpressionCell<ExpressionSin>(e)};
 }
 
 Expression cos(const Expression& e) {
@@ -635,7 +856,7 @@ Expression cos(const Expression& e) {
     return Expression{std::cos(get_constant_value(e))};
   }
 
-  return Expression{make_shared<const ExpressionCos>(e)};
+  return Expression{MakeExpressionCell<ExpressionCos>(e)};
 }
 
 Expression tan(const Expression& e) {
@@ -643,7 +864,7 @@ Expression tan(const Expression& e) {
   if (is_constant(e)) {
     return Expression{std::tan(get_constant_value(e))};
   }
-  return Expression{make_shared<const ExpressionTan>(e)};
+  return Expression{MakeExpressionCell<ExpressionTan>(e)};
 }
 
 Expression asin(const Expression& e) {
@@ -653,7 +874,7 @@ Expression asin(const Expression& e) {
     ExpressionAsin::check_domain(v);
     return Expression{std::asin(v)};
   }
-  return Expression{make_shared<const ExpressionAsin>(e)};
+  return Expression{MakeExpressionCell<ExpressionAsin>(e)};
 }
 
 Expression acos(const Expression& e) {
@@ -663,7 +884,7 @@ Expression acos(const Expression& e) {
     ExpressionAcos::check_domain(v);
     return Expression{std::acos(v)};
   }
-  return Expression{make_shared<const ExpressionAcos>(e)};
+  return Expression{MakeExpressionCell<ExpressionAcos>(e)};
 }
 
 Expression atan(const Expression& e) {
@@ -671,7 +892,7 @@ Expression atan(const Expression& e) {
   if (is_constant(e)) {
     return Expression{std::atan(get_constant_value(e))};
   }
-  return Expression{make_shared<const ExpressionAtan>(e)};
+  return Expression{MakeExpressionCell<ExpressionAtan>(e)};
 }
 
 Expression atan2(const Expression& e1, const Expression& e2) {
@@ -680,7 +901,7 @@ Expression atan2(const Expression& e1, const Expression& e2) {
     return Expression{
         std::atan2(get_constant_value(e1), get_constant_value(e2))};
   }
-  return Expression{make_shared<const ExpressionAtan2>(e1, e2)};
+  return Expression{MakeExpressionCell<ExpressionAtan2>(e1, e2)};
 }
 
 Expression sinh(const Expression& e) {
@@ -688,7 +909,7 @@ Expression sinh(const Expression& e) {
   if (is_constant(e)) {
     return Expression{std::sinh(get_constant_value(e))};
   }
-  return Expression{make_shared<const ExpressionSinh>(e)};
+  return Expression{MakeExpressionCell<ExpressionSinh>(e)};
 }
 
 Expression cosh(const Expression& e) {
@@ -696,7 +917,7 @@ Expression cosh(const Expression& e) {
   if (is_constant(e)) {
     return Expression{std::cosh(get_constant_value(e))};
   }
-  return Expression{make_shared<const ExpressionCosh>(e)};
+  return Expression{MakeExpressionCell<ExpressionCosh>(e)};
 }
 
 Expression tanh(const Expression& e) {
@@ -704,7 +925,7 @@ Expression tanh(const Expression& e) {
   if (is_constant(e)) {
     return Expression{std::tanh(get_constant_value(e))};
   }
-  return Expression{make_shared<const ExpressionTanh>(e)};
+  return Expression{MakeExpressionCell<ExpressionTanh>(e)};
 }
 
 Expression min(const Expression& e1, const Expression& e2) {
@@ -716,7 +937,7 @@ Expression min(const Expression& e1, const Expression& e2) {
   if (is_constant(e1) && is_constant(e2)) {
     return Expression{std::min(get_constant_value(e1), get_constant_value(e2))};
   }
-  return Expression{make_shared<const ExpressionMin>(e1, e2)};
+  return Expression{MakeExpressionCell<ExpressionMin>(e1, e2)};
 }
 
 Expression max(const Expression& e1, const Expression& e2) {
@@ -728,7 +949,7 @@ Expression max(const Expression& e1, const Expression& e2) {
   if (is_constant(e1) && is_constant(e2)) {
     return Expression{std::max(get_constant_value(e1), get_constant_value(e2))};
   }
-  return Expression{make_shared<const ExpressionMax>(e1, e2)};
+  return Expression{MakeExpressionCell<ExpressionMax>(e1, e2)};
 }
 
 Expression ceil(const Expression& e) {
@@ -736,7 +957,7 @@ Expression ceil(const Expression& e) {
   if (is_constant(e)) {
     return Expression{std::ceil(get_constant_value(e))};
   }
-  return Expression{make_shared<const ExpressionCeiling>(e)};
+  return Expression{MakeExpressionCell<ExpressionCeiling>(e)};
 }
 
 Expression floor(const Expression& e) {
@@ -744,7 +965,7 @@ Expression floor(const Expression& e) {
   if (is_constant(e)) {
     return Expression{std::floor(get_constant_value(e))};
   }
-  return Expression{make_shared<const ExpressionFloor>(e)};
+  return Expression{MakeExpressionCell<ExpressionFloor>(e)};
 }
 
 Expression if_then_else(const Formula& f_cond, const Expression& e_then,
@@ -758,11 +979,11 @@ Expression if_then_else(const Formula& f_cond, const Expression& e_then,
     return e_else;
   }
   return Expression{
-      make_shared<const ExpressionIfThenElse>(f_cond, e_then, e_else)};
+      MakeExpressionCell<ExpressionIfThenElse>(f_cond, e_then, e_else)};
 }
 
 Expression uninterpreted_function(string name, vector<Expression> arguments) {
-  return Expression{make_shared<const ExpressionUninterpretedFunction>(
+  return Expression{MakeExpressionCell<ExpressionUninterpretedFunction>(
       std::move(name), std::move(arguments))};
 }
 
@@ -873,16 +1094,61 @@ VectorX<Variable> GetVariableVector(
   return vec;
 }
 
+namespace {
+// The number of Jacobian entries below which the parallel path is not worth
+// its thread start-up cost.
+constexpr int kMinParallelJacobianSize{64};
+}  // namespace
+
 MatrixX<Expression> Jacobian(const Eigen::Ref<const VectorX<Expression>>& f,
                              const vector<Variable>& vars) {
   DRAKE_DEMAND(!vars.empty());
-  const Eigen::Ref<const VectorX<Expression>>::Index n{f.size()};
-  const size_t m{vars.size()};
+  const int n{static_cast<int>(f.size())};
+  const int m{static_cast<int>(vars.size())};
   MatrixX<Expression> J(n, m);
-  for (int i = 0; i < n; ++i) {
-    for (size_t j = 0; j < m; ++j) {
-      J(i, j) = f[i].Differentiate(vars[j]);
+
+  // Every entry is independent, so the (row, column) work items are handed
+  // out to workers through a shared counter; each worker keeps a per-thread
+  // differentiation cache so that common subtrees are differentiated once.
+  // Cell construction is thread-safe (interning is mutex-protected), and the
+  // intern table deduplicates cells produced concurrently by different
+  // workers.
+  std::atomic<int> next_item{0};
+  std::mutex exception_mutex;
+  std::exception_ptr first_exception;
+  const auto work = [&]() {
+    ScopedDifferentiationCache cache;
+    for (int k = next_item++; k < n * m; k = next_item++) {
+      try {
+        J(k / m, k % m) = f[k / m].Differentiate(vars[k % m]);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock{exception_mutex};
+        if (first_exception == nullptr) {
+          first_exception = std::current_exception();
+        }
+      }
     }
+  };
+
+  const int hardware_threads{
+      static_cast<int>(std::thread::hardware_concurrency())};
+  const int num_threads{std::min(std::max(hardware_threads, 1), n * m)};
+  if (num_threads <= 1 || n * m < kMinParallelJacobianSize) {
+    work();
+  } else {
+    // The calling thread participates as one of the workers.
+    vector<std::thread> workers;
+    workers.reserve(num_threads - 1);
+    for (int i = 0; i < num_threads - 1; ++i) {
+      workers.emplace_back(work);
+    }
+    work();
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+  }
+  if (first_exception != nullptr) {
+    std::rethrow_exception(first_exception);
   }
   return J;
 }
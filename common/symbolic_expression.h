@@ -499,12 +499,86 @@ class Expression {
   explicit Expression(std::shared_ptr<const ExpressionCell> ptr);
   void HashAppend(DelegatingHasher* hasher) const;
 
+  // Returns the canonical cell for @p ptr from a process-wide intern table,
+  // so that structurally identical subexpressions share a single cell. This
+  // keeps the memory footprint of large expressions proportional to the
+  // number of distinct subexpressions and lets the pointer-equality fast path
+  // in EqualTo() and Less() fire for shared subtrees.
+  static std::shared_ptr<const ExpressionCell> Intern(
+      std::shared_ptr<const ExpressionCell> ptr);
+
   // Note: We use "const" ExpressionCell type here because an ExpressionCell
   // object can be shared by multiple expressions, an expression should _not_ be
   // able to change the cell that it points to.
   std::shared_ptr<const ExpressionCell> ptr_;
 };
 
+namespace internal {
+
+/** Bump-pointer storage backing an ExpressionArena. The storage is shared:
+ * every cell allocated from it keeps it alive through the allocator copy
+ * stored in its shared_ptr control block, so the blocks are released
+ * wholesale only once the arena scope has ended _and_ the last cell
+ * referencing them is gone. This type is an implementation detail; use
+ * ExpressionArena. */
+class ExpressionArenaMemory {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ExpressionArenaMemory)
+
+  ExpressionArenaMemory() = default;
+
+  /** Returns @p size bytes of storage with at least @p alignment. */
+  void* Allocate(std::size_t size, std::size_t alignment);
+
+  /** Returns the total number of bytes handed out so far. */
+  std::size_t bytes_allocated() const { return bytes_allocated_; }
+
+ private:
+  std::vector<std::unique_ptr<char[]>> blocks_;
+  char* head_{nullptr};
+  std::size_t remaining_{0};
+  std::size_t next_block_size_{4096};
+  std::size_t bytes_allocated_{0};
+};
+
+/** Returns this thread's active arena storage, or nullptr when no
+ * ExpressionArena is in scope. */
+std::shared_ptr<ExpressionArenaMemory>& GetThreadLocalExpressionArenaMemory();
+
+}  // namespace internal
+
+/** Provides scoped bulk allocation for symbolic-expression cells. While an
+ * instance of this class is alive, every ExpressionCell created on the same
+ * thread is carved out of large arena blocks with a bump-pointer allocator
+ * instead of being allocated individually, which removes the allocator from
+ * the critical path of large symbolic computations (e.g. building the
+ * dynamics of a plant with @c Expression scalars).
+ *
+ * Reference counting is preserved: cells are destroyed normally when their
+ * last Expression goes away, and expressions may safely outlive the arena
+ * scope -- the underlying blocks are only reclaimed once the arena has been
+ * destroyed and no cell allocated from it remains alive.
+ *
+ * Arenas nest; the innermost live arena on the current thread receives the
+ * allocations. */
+class ExpressionArena {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ExpressionArena)
+
+  /** Activates this arena for the current thread. */
+  ExpressionArena();
+
+  /** Deactivates this arena, restoring the previously active one (if any). */
+  ~ExpressionArena();
+
+  /** Returns the total number of bytes handed out by this arena so far. */
+  std::size_t bytes_allocated() const { return memory_->bytes_allocated(); }
+
+ private:
+  std::shared_ptr<internal::ExpressionArenaMemory> memory_;
+  std::shared_ptr<internal::ExpressionArenaMemory> previous_;
+};
+
 Expression operator+(Expression lhs, const Expression& rhs);
 // NOLINTNEXTLINE(runtime/references) per C++ standard signature.
 Expression& operator+=(Expression& lhs, const Expression& rhs);
@@ -1276,6 +1350,10 @@ VectorX<Variable> GetVariableVector(
 ///    | 2 * x             0|
 ///  </pre>
 ///
+/// Large Jacobians are evaluated in parallel: the entries are independent and
+/// are distributed over hardware threads, with differentiation results of
+/// common subexpressions shared through per-thread memoization.
+///
 /// @pre {@p vars is non-empty}.
 MatrixX<Expression> Jacobian(const Eigen::Ref<const VectorX<Expression>>& f,
                              const std::vector<Variable>& vars);
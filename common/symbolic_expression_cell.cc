@@ -3,18 +3,23 @@
 #undef DRAKE_COMMON_SYMBOLIC_DETAIL_HEADER
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <exception>
 #include <functional>
 #include <iomanip>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <ostream>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/hash.h"
@@ -521,23 +526,99 @@ double ExpressionAdd::Evaluate(const Environment& env) const {
       });
 }
 
+namespace {
+
+// Additions with at least this many terms fan their per-term work out across
+// threads; smaller ones are not worth the thread start-up cost.
+constexpr int kMinParallelAddTerms{64};
+
+// True while the current thread is a worker of ParallelMapTerms, so that
+// nested additions are processed inline instead of spawning more threads.
+thread_local bool g_inside_parallel_map_terms{false};
+
+// Computes op(term) for every term of @p expr_to_coeff_map. Large maps are
+// partitioned across a temporary pool of threads, with each per-term result
+// written to its own slot and merged by the caller; this is safe because
+// expression cells are immutable and both the intern table and the arena
+// are thread-aware. Small maps, and calls made from inside a worker, run
+// inline.
+std::vector<Expression> ParallelMapTerms(
+    const std::map<Expression, double>& expr_to_coeff_map,
+    const std::function<Expression(const std::pair<const Expression, double>&)>&
+        op) {
+  std::vector<const std::pair<const Expression, double>*> terms;
+  terms.reserve(expr_to_coeff_map.size());
+  for (const auto& p : expr_to_coeff_map) {
+    terms.push_back(&p);
+  }
+  const int n = static_cast<int>(terms.size());
+  std::vector<Expression> results(n);
+  const int num_workers =
+      std::min<int>(n, std::max<int>(1, std::thread::hardware_concurrency()));
+  if (g_inside_parallel_map_terms || n < kMinParallelAddTerms ||
+      num_workers <= 1) {
+    for (int i = 0; i < n; ++i) {
+      results[i] = op(*terms[i]);
+    }
+    return results;
+  }
+  std::atomic<int> next{0};
+  std::mutex exception_mutex;
+  std::exception_ptr first_exception;
+  auto work = [&]() {
+    g_inside_parallel_map_terms = true;
+    try {
+      for (int i = next++; i < n; i = next++) {
+        results[i] = op(*terms[i]);
+      }
+    } catch (const std::exception&) {
+      std::lock_guard<std::mutex> lock{exception_mutex};
+      if (first_exception == nullptr) {
+        first_exception = std::current_exception();
+      }
+    }
+    g_inside_parallel_map_terms = false;
+  };
+  std::vector<std::thread> workers;
+  for (int i = 0; i < num_workers; ++i) {
+    workers.emplace_back(work);
+  }
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+  if (first_exception != nullptr) {
+    std::rethrow_exception(first_exception);
+  }
+  return results;
+}
+
+}  // namespace
+
 Expression ExpressionAdd::Expand() const {
   //   (c0 + c1 * e_1 + ... + c_n * e_n).Expand()
   // =  c0 + c1 * e_1.Expand() + ... + c_n * e_n.Expand()
+  // The terms are independent, so they are expanded in parallel and merged.
+  const std::vector<Expression> expanded{ParallelMapTerms(
+      expr_to_coeff_map_, [](const pair<const Expression, double>& p) {
+        return ExpandMultiplication(p.first.Expand(), p.second);
+      })};
   ExpressionAddFactory fac{constant_, {}};
-  for (const pair<const Expression, double>& p : expr_to_coeff_map_) {
-    fac.AddExpression(ExpandMultiplication(p.first.Expand(), p.second));
+  for (const Expression& e : expanded) {
+    fac.AddExpression(e);
   }
   return fac.GetExpression();
 }
 
 Expression ExpressionAdd::Substitute(const Substitution& s) const {
-  return accumulate(
-      expr_to_coeff_map_.begin(), expr_to_coeff_map_.end(),
-      Expression{constant_},
-      [&s](const Expression& init, const pair<const Expression, double>& p) {
-        return init + p.first.Substitute(s) * p.second;
-      });
+  const std::vector<Expression> substituted{ParallelMapTerms(
+      expr_to_coeff_map_, [&s](const pair<const Expression, double>& p) {
+        return p.first.Substitute(s) * p.second;
+      })};
+  ExpressionAddFactory fac{constant_, {}};
+  for (const Expression& e : substituted) {
+    fac.AddExpression(e);
+  }
+  return fac.GetExpression();
 }
 
 Expression ExpressionAdd::Differentiate(const Variable& x) const {
@@ -652,7 +733,7 @@ Expression ExpressionAddFactory::GetExpression() const {
     return it->first * it->second;
   }
   return Expression{
-      make_shared<const ExpressionAdd>(constant_, expr_to_coeff_map_)};
+      MakeExpressionCell<ExpressionAdd>(constant_, expr_to_coeff_map_)};
 }
 
 void ExpressionAddFactory::AddConstant(const double constant) {
@@ -952,7 +1033,7 @@ Expression ExpressionMulFactory::GetExpression() const {
     return pow(it->first, it->second);
   }
   return Expression{
-      make_shared<const ExpressionMul>(constant_, base_to_exponent_map_)};
+      MakeExpressionCell<ExpressionMul>(constant_, base_to_exponent_map_)};
 }
 
 void ExpressionMulFactory::AddConstant(const double constant) {
@@ -17,6 +17,7 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <Eigen/Core>
@@ -38,6 +39,68 @@ bool is_positive_integer(double v);
 // Checks if @p v contains a non-negative integer value.
 bool is_non_negative_integer(double v);
 
+/** An allocator for expression cells that draws from the thread's active
+ * ExpressionArena when one is in scope and from the global heap otherwise.
+ * The allocator copy that std::allocate_shared stores in each control block
+ * keeps the arena storage alive until the cell and its weak references are
+ * gone, so arena-backed expressions may safely outlive the arena scope. */
+template <typename T>
+class ExpressionCellAllocator {
+ public:
+  using value_type = T;
+
+  ExpressionCellAllocator()
+      : memory_{internal::GetThreadLocalExpressionArenaMemory()} {}
+
+  template <typename U>
+  // NOLINTNEXTLINE(runtime/explicit) per std::allocator converting-ctor rules.
+  ExpressionCellAllocator(const ExpressionCellAllocator<U>& other)
+      : memory_{other.memory()} {}
+
+  T* allocate(const std::size_t n) {
+    if (memory_ != nullptr) {
+      return static_cast<T*>(memory_->Allocate(n * sizeof(T), alignof(T)));
+    }
+    return static_cast<T*>(::operator new(n * sizeof(T)));
+  }
+
+  void deallocate(T* p, std::size_t) {
+    // Arena storage is reclaimed wholesale once the arena and every cell
+    // allocated from it are gone; only heap-backed cells are freed here.
+    if (memory_ == nullptr) {
+      ::operator delete(p);
+    }
+  }
+
+  const std::shared_ptr<internal::ExpressionArenaMemory>& memory() const {
+    return memory_;
+  }
+
+ private:
+  std::shared_ptr<internal::ExpressionArenaMemory> memory_;
+};
+
+template <typename T, typename U>
+bool operator==(const ExpressionCellAllocator<T>& lhs,
+                const ExpressionCellAllocator<U>& rhs) {
+  return lhs.memory() == rhs.memory();
+}
+
+template <typename T, typename U>
+bool operator!=(const ExpressionCellAllocator<T>& lhs,
+                const ExpressionCellAllocator<U>& rhs) {
+  return !(lhs == rhs);
+}
+
+/** Creates a reference-counted expression cell of type @p ExprCellType,
+ * drawing storage from the thread's active ExpressionArena if one is in
+ * scope. All expression-cell allocations should go through this function. */
+template <typename ExprCellType, typename... Args>
+std::shared_ptr<const ExprCellType> MakeExpressionCell(Args&&... args) {
+  return std::allocate_shared<const ExprCellType>(
+      ExpressionCellAllocator<ExprCellType>{}, std::forward<Args>(args)...);
+}
+
 /** Represents an abstract class which is the base of concrete
  * symbolic-expression classes.
  *
@@ -0,0 +1,167 @@
+#include "drake/common/ensemble_scalar.h"
+
+#include <array>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace {
+
+GTEST_TEST(EnsembleScalarTest, LanesAndBroadcast) {
+  const Ensemble4 zero;
+  for (int i = 0; i < 4; ++i)
+    EXPECT_EQ(zero.lane(i), 0.0);
+
+  const Ensemble4 broadcast(1.5);
+  for (int i = 0; i < 4; ++i)
+    EXPECT_EQ(broadcast.lane(i), 1.5);
+
+  Ensemble4 lanes(std::array<double, 4>{{1.0, 2.0, 3.0, 4.0}});
+  EXPECT_EQ(lanes.lane(2), 3.0);
+  lanes.set_lane(2, -3.0);
+  EXPECT_EQ(lanes.lane(2), -3.0);
+  EXPECT_EQ(Ensemble4::num_lanes(), 4);
+}
+
+// Arithmetic on the ensemble must agree, lane for lane, with the same
+// arithmetic carried out in double precision.
+GTEST_TEST(EnsembleScalarTest, LockstepArithmetic) {
+  const std::array<double, 4> a_lanes{{1.0, -2.0, 0.5, 8.0}};
+  const std::array<double, 4> b_lanes{{3.0, 7.0, -0.25, 2.0}};
+  const Ensemble4 a(a_lanes);
+  const Ensemble4 b(b_lanes);
+
+  const Ensemble4 sum = a + b;
+  const Ensemble4 diff = a - b;
+  const Ensemble4 prod = a * b;
+  const Ensemble4 quot = a / b;
+  const Ensemble4 neg = -a;
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(sum.lane(i), a_lanes[i] + b_lanes[i]);
+    EXPECT_EQ(diff.lane(i), a_lanes[i] - b_lanes[i]);
+    EXPECT_EQ(prod.lane(i), a_lanes[i] * b_lanes[i]);
+    EXPECT_EQ(quot.lane(i), a_lanes[i] / b_lanes[i]);
+    EXPECT_EQ(neg.lane(i), -a_lanes[i]);
+  }
+
+  // Doubles broadcast into mixed expressions.
+  const Ensemble4 scaled = a * 2.0 + 1.0;
+  for (int i = 0; i < 4; ++i)
+    EXPECT_EQ(scaled.lane(i), a_lanes[i] * 2.0 + 1.0);
+}
+
+GTEST_TEST(EnsembleScalarTest, UniformComparisons) {
+  const Ensemble4 low(std::array<double, 4>{{1.0, 2.0, 3.0, 4.0}});
+  const Ensemble4 high(std::array<double, 4>{{2.0, 3.0, 4.0, 5.0}});
+  const Ensemble4 mixed(std::array<double, 4>{{2.0, 1.0, 4.0, 5.0}});
+
+  // Comparisons are true only when every lane satisfies the relation.
+  EXPECT_TRUE(low < high);
+  EXPECT_TRUE(high > low);
+  EXPECT_FALSE(low < mixed);
+  // Note that a failed uniform comparison does not imply its complement.
+  EXPECT_FALSE(low >= mixed);
+  EXPECT_TRUE(low == low);
+  EXPECT_TRUE(low != high);
+}
+
+GTEST_TEST(EnsembleScalarTest, LaneWiseSelect) {
+  const Ensemble4 a(std::array<double, 4>{{1.0, 5.0, 2.0, 7.0}});
+  const Ensemble4 b(std::array<double, 4>{{4.0, 3.0, 2.0, 9.0}});
+
+  const Ensemble4::Mask mask = lane_less(a, b);
+  EXPECT_TRUE(mask[0]);
+  EXPECT_FALSE(mask[1]);
+  EXPECT_FALSE(mask[2]);
+  EXPECT_TRUE(mask[3]);
+
+  // if_then_else() with lane_less() computes the lane-wise minimum.
+  const Ensemble4 selected = if_then_else(mask, a, b);
+  for (int i = 0; i < 4; ++i)
+    EXPECT_EQ(selected.lane(i), std::min(a.lane(i), b.lane(i)));
+  const Ensemble4 lane_min = min(a, b);
+  EXPECT_TRUE(selected == lane_min);
+}
+
+GTEST_TEST(EnsembleScalarTest, ElementaryFunctions) {
+  const std::array<double, 4> lanes{{0.25, 1.0, 2.5, 9.0}};
+  const Ensemble4 e(lanes);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(abs(-e).lane(i), lanes[i]);
+    EXPECT_EQ(sqrt(e).lane(i), std::sqrt(lanes[i]));
+    EXPECT_EQ(exp(e).lane(i), std::exp(lanes[i]));
+    EXPECT_EQ(log(e).lane(i), std::log(lanes[i]));
+    EXPECT_EQ(sin(e).lane(i), std::sin(lanes[i]));
+    EXPECT_EQ(cos(e).lane(i), std::cos(lanes[i]));
+    EXPECT_EQ(tan(e).lane(i), std::tan(lanes[i]));
+    EXPECT_EQ(pow(e, Ensemble4(2.0)).lane(i), std::pow(lanes[i], 2.0));
+    EXPECT_EQ(floor(e).lane(i), std::floor(lanes[i]));
+    EXPECT_EQ(ceil(e).lane(i), std::ceil(lanes[i]));
+  }
+}
+
+// Eigen expressions instantiated with the ensemble evaluate all lanes in
+// lockstep; the result must agree with evaluating the same expression once
+// per lane in double precision.
+GTEST_TEST(EnsembleScalarTest, EigenLockstep) {
+  using MatrixE = Eigen::Matrix<Ensemble4, 2, 2>;
+  using VectorE = Eigen::Matrix<Ensemble4, 2, 1>;
+
+  MatrixE A;
+  A(0, 0) = Ensemble4(std::array<double, 4>{{1.0, 1.1, 1.2, 1.3}});
+  A(0, 1) = Ensemble4(std::array<double, 4>{{0.0, 0.1, 0.2, 0.3}});
+  A(1, 0) = Ensemble4(std::array<double, 4>{{-1.0, -1.1, -1.2, -1.3}});
+  A(1, 1) = Ensemble4(std::array<double, 4>{{2.0, 2.1, 2.2, 2.3}});
+  VectorE x;
+  x(0) = Ensemble4(std::array<double, 4>{{1.0, 2.0, 3.0, 4.0}});
+  x(1) = Ensemble4(std::array<double, 4>{{-1.0, -2.0, -3.0, -4.0}});
+
+  const VectorE y = A * x;
+  for (int lane = 0; lane < 4; ++lane) {
+    Eigen::Matrix2d A_lane;
+    Eigen::Vector2d x_lane;
+    for (int i = 0; i < 2; ++i) {
+      x_lane(i) = x(i).lane(lane);
+      for (int j = 0; j < 2; ++j)
+        A_lane(i, j) = A(i, j).lane(lane);
+    }
+    const Eigen::Vector2d y_lane = A_lane * x_lane;
+    for (int i = 0; i < 2; ++i)
+      EXPECT_EQ(y(i).lane(lane), y_lane(i));
+  }
+}
+
+// Advances eight perturbed rollouts of the forced decay ẋ = -k x + sin(t) in
+// lockstep with explicit Euler, and verifies bitwise agreement with eight
+// sequential double-precision rollouts.
+GTEST_TEST(EnsembleScalarTest, LockstepRollout) {
+  const double k = 3.0;
+  const double h = 1e-3;
+  const int n_steps = 1000;
+
+  std::array<double, 8> x0_lanes;
+  for (int i = 0; i < 8; ++i)
+    x0_lanes[i] = 1.0 + 0.01 * i;
+
+  // Batched rollout.
+  Ensemble8 x(x0_lanes);
+  Ensemble8 t(0.0);
+  for (int step = 0; step < n_steps; ++step) {
+    x += Ensemble8(h) * (Ensemble8(-k) * x + sin(t));
+    t += Ensemble8(h);
+  }
+
+  // Per-lane rollouts.
+  for (int i = 0; i < 8; ++i) {
+    double x_lane = x0_lanes[i];
+    double t_lane = 0.0;
+    for (int step = 0; step < n_steps; ++step) {
+      x_lane += h * (-k * x_lane + std::sin(t_lane));
+      t_lane += h;
+    }
+    EXPECT_EQ(x.lane(i), x_lane);
+  }
+}
+
+}  // namespace
+}  // namespace drake
@@ -14,6 +14,7 @@
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_path.h"
 #include "drake/common/drake_throw.h"
+#include "drake/common/temp_directory.h"
 
 using std::string;
 
@@ -92,6 +93,63 @@ GTEST_TEST(FindResourceTest, FoundDeclaredData) {
   EXPECT_EQ(FindResourceOrThrow(relpath), absolute_path);
 }
 
+// Repeated lookups are memoized; the cached answer matches the probed one,
+// and clearing the cache re-probes successfully.
+GTEST_TEST(FindResourceTest, MemoizedLookup) {
+  ClearFindResourceCacheForTesting();
+  const string relpath = "drake/common/test/find_resource_test_data.txt";
+  const string probed = FindResourceOrThrow(relpath);
+  EXPECT_EQ(FindResourceOrThrow(relpath), probed);
+  ClearFindResourceCacheForTesting();
+  EXPECT_EQ(FindResourceOrThrow(relpath), probed);
+}
+
+// A manifest resolves resources without directory probing; stale entries fall
+// back to the normal search; malformed manifests are rejected.
+GTEST_TEST(FindResourceTest, Manifest) {
+  ClearFindResourceCacheForTesting();
+  const auto guard = std::shared_ptr<void>(
+      nullptr, [](void*) { ClearFindResourceCacheForTesting(); });
+
+  // Map a made-up resource path onto the real test data file.
+  const string target =
+      FindResourceOrThrow("drake/common/test/find_resource_test_data.txt");
+  const string manifest_path = temp_directory() + "/manifest.txt";
+  {
+    std::ofstream manifest(manifest_path);
+    manifest << "# A comment, then a blank line.\n\n";
+    manifest << "drake/no_such_dir/fake_resource.txt " << target << "\n";
+    manifest << "drake/no_such_dir/stale_resource.txt /no/such/file\n";
+  }
+  LoadResourceManifest(manifest_path);
+  EXPECT_EQ(FindResourceOrThrow("drake/no_such_dir/fake_resource.txt"),
+            target);
+
+  // The stale entry's file does not exist, so the normal search runs (and
+  // also fails).
+  EXPECT_FALSE(FindResource("drake/no_such_dir/stale_resource.txt")
+                   .get_absolute_path());
+
+  // Clearing the cache forgets the manifest entries.
+  ClearFindResourceCacheForTesting();
+  EXPECT_FALSE(FindResource("drake/no_such_dir/fake_resource.txt")
+                   .get_absolute_path());
+
+  // Missing and malformed manifests are rejected.
+  EXPECT_THROW(LoadResourceManifest("/no/such/manifest.txt"),
+               std::runtime_error);
+  const string bad_manifest_path = temp_directory() + "/bad_manifest.txt";
+  for (const string& bad_line :
+       {string("too many tokens here"),
+        string("not_drake/foo.txt /abs/path"),
+        string("drake/foo.txt relative/path")}) {
+    std::ofstream bad_manifest(bad_manifest_path);
+    bad_manifest << bad_line << "\n";
+    bad_manifest.close();
+    EXPECT_THROW(LoadResourceManifest(bad_manifest_path), std::runtime_error);
+  }
+}
+
 // Check that adding a relative resource path fails on purpose.
 GTEST_TEST(FindResourceTest, RelativeResourcePathShouldFail) {
   // Test `AddResourceSearchPath()` with a relative path. It is expected to
@@ -128,6 +186,10 @@ GTEST_TEST(FindResourceTest, FindUsingTestSrcdir) {
   const string relpath = "drake/common/test/find_resource_test_data.txt";
   EXPECT_TRUE(FindResource(relpath).get_absolute_path());
 
+  // The checks below must re-probe the filesystem, not hit the process-wide
+  // memoization cache.
+  ClearFindResourceCacheForTesting();
+
   // If we defeat both (1) the "look in current working directory" heuristic
   // and (2) the "look in TEST_SRCDIR" heuristic, then we should no longer be
   // able to find the resource.
@@ -357,6 +357,58 @@ GTEST_TEST(PolynomialTest, Conversion) {
   Polynomial<double> z = 3;
 }
 
+GTEST_TEST(PolynomialTest, DenseUnivariateArithmetic) {
+  // High-degree univariate sums and products take the dense-coefficient code
+  // path (direct convolution at the smaller size, FFT at the larger); check
+  // them against the naive convolution of the coefficient vectors.
+  for (int degree : {40, 255}) {
+    const VectorXd coeff1 = VectorXd::Random(degree + 1);
+    const VectorXd coeff2 = VectorXd::Random(degree);
+    const Polynomial<double> poly1(coeff1);
+    const Polynomial<double> poly2(coeff2);
+
+    VectorXd expected_sum = coeff1;
+    expected_sum.head(coeff2.size()) += coeff2;
+    const Polynomial<double> sum = poly1 + poly2;
+    EXPECT_TRUE(CompareMatrices(sum.GetCoefficients(), expected_sum, 1e-10,
+                                MatrixCompareType::absolute));
+
+    VectorXd expected_product =
+        VectorXd::Zero(coeff1.size() + coeff2.size() - 1);
+    for (int i = 0; i < coeff1.size(); ++i) {
+      for (int j = 0; j < coeff2.size(); ++j) {
+        expected_product[i + j] += coeff1[i] * coeff2[j];
+      }
+    }
+    const Polynomial<double> product = poly1 * poly2;
+    EXPECT_TRUE(CompareMatrices(product.GetCoefficients(), expected_product,
+                                1e-10, MatrixCompareType::absolute));
+
+    // An aliased in-place product works too.
+    VectorXd expected_square = VectorXd::Zero(2 * coeff1.size() - 1);
+    for (int i = 0; i < coeff1.size(); ++i) {
+      for (int j = 0; j < coeff1.size(); ++j) {
+        expected_square[i + j] += coeff1[i] * coeff1[j];
+      }
+    }
+    Polynomial<double> square = poly1;
+    square *= square;
+    EXPECT_TRUE(CompareMatrices(square.GetCoefficients(), expected_square,
+                                1e-10, MatrixCompareType::absolute));
+  }
+}
+
+GTEST_TEST(PolynomialTest, SparseHighDegreeProduct) {
+  // A sparse high-degree polynomial stays on the sparse-term strategy: the
+  // square of (x**1000 + 1) has three monomials, not thousands of zeros.
+  Polynomiald x("x");
+  const Polynomiald p = pow(x, 1000) + 1;
+  const Polynomiald p_squared = p * p;
+  EXPECT_EQ(p_squared.GetNumberOfCoefficients(), 3);
+  EXPECT_EQ(p_squared.GetDegree(), 2000);
+  EXPECT_TRUE(p_squared == pow(x, 2000) + 2 * pow(x, 1000) + 1);
+}
+
 GTEST_TEST(PolynomialTest, EvaluatePartial) {
   Polynomiald x = Polynomiald("x");
   Polynomiald y = Polynomiald("y");
@@ -0,0 +1,86 @@
+#include "drake/common/symbolic_codegen_jit.h"
+
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace symbolic {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector2d;
+
+class SymbolicCodeGenJitTest : public ::testing::Test {
+ protected:
+  const Variable x_{"x"};
+  const Variable y_{"y"};
+};
+
+TEST_F(SymbolicCodeGenJitTest, Matrix) {
+  MatrixX<Expression> M(2, 2);
+  M(0, 0) = 1.0;
+  M(1, 0) = 3 + x_ + y_;
+  M(0, 1) = 4 * y_;
+  M(1, 1) = sin(x_) * cos(y_);
+  const JitCompiledFunction f("f", {x_, y_}, M);
+
+  EXPECT_EQ(f.parameter_size(), 2);
+  EXPECT_EQ(f.rows(), 2);
+  EXPECT_EQ(f.cols(), 2);
+
+  // The compiled function must agree with interpreted evaluation.
+  const Vector2d p(-1.2, 3.4);
+  const Environment env{{x_, p(0)}, {y_, p(1)}};
+  MatrixXd evaluated(2, 2);
+  f.Eval(p, &evaluated);
+  const MatrixXd expected = Evaluate(M, env);
+  EXPECT_TRUE(CompareMatrices(evaluated, expected, 1e-15));
+}
+
+TEST_F(SymbolicCodeGenJitTest, PreallocatedOutput) {
+  MatrixX<Expression> M(3, 1);
+  M << x_, y_, x_ * y_;
+  const JitCompiledFunction f("g", {x_, y_}, M);
+  MatrixXd evaluated(3, 1);  // Eval() writes into the preallocated buffer.
+  f.Eval(Vector2d(2.0, 5.0), &evaluated);
+  EXPECT_TRUE(
+      CompareMatrices(evaluated, Eigen::Vector3d(2.0, 5.0, 10.0), 1e-15));
+
+  MatrixXd wrong_size(2, 2);
+  EXPECT_THROW(f.Eval(Vector2d(2.0, 5.0), &wrong_size), std::runtime_error);
+}
+
+TEST_F(SymbolicCodeGenJitTest, CommonSubexpressions) {
+  // Shared subtrees (within one entry and across entries) are hoisted into
+  // temporaries; the compiled result must still match interpreted evaluation.
+  const Expression shared{sin(x_ + y_) * cos(x_ + y_)};
+  MatrixX<Expression> M(2, 2);
+  M(0, 0) = shared + pow(shared, 2);
+  M(1, 0) = shared - x_;
+  M(0, 1) = sqrt(2.0 + shared);
+  M(1, 1) = shared * shared;
+  const JitCompiledFunction f("cse", {x_, y_}, M);
+
+  const Vector2d p(0.7, -0.3);
+  const Environment env{{x_, p(0)}, {y_, p(1)}};
+  MatrixXd evaluated(2, 2);
+  f.Eval(p, &evaluated);
+  EXPECT_TRUE(CompareMatrices(evaluated, Evaluate(M, env), 1e-15));
+}
+
+TEST_F(SymbolicCodeGenJitTest, WrongParameterSizeThrows) {
+  MatrixX<Expression> M(1, 1);
+  M(0, 0) = x_ + y_;
+  const JitCompiledFunction f("h", {x_, y_}, M);
+  MatrixXd evaluated;
+  EXPECT_THROW(f.Eval(Eigen::VectorXd::Zero(3), &evaluated),
+               std::runtime_error);
+}
+
+}  // namespace
+}  // namespace symbolic
+}  // namespace drake
@@ -285,6 +285,17 @@ TEST_F(SymbolicExpansionTest, DivideByConstant) {
                -12 * x_ * y_ / x_);
 }
 
+TEST_F(SymbolicExpansionTest, ManyTerms) {
+  // An addition with enough terms to be expanded across threads must give
+  // the same result as serial term-by-term expansion.
+  Expression e{0.0};
+  for (int i = 1; i <= 200; ++i) {
+    e += i * pow(x_ + y_, 2) * sin(i * z_);
+  }
+  EXPECT_TRUE(CheckExpandPreserveEvaluation(e, 1e-8));
+  EXPECT_TRUE(CheckExpandIsFixpoint(e));
+}
+
 }  // namespace
 }  // namespace symbolic
 }  // namespace drake
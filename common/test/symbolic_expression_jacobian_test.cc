@@ -110,6 +110,25 @@ TEST_F(SymbolicExpressionJacobianTest, Test5) {
   EXPECT_EQ(Jacobian(f, Vector2<Variable>{x_, z_}), expected);
 }
 
+TEST_F(SymbolicExpressionJacobianTest, LargeJacobian) {
+  // A Jacobian large enough to take the parallel evaluation path. Every entry
+  // must match a serial per-entry Differentiate().
+  const int n{20};
+  VectorX<Expression> f(n);
+  for (int i = 0; i < n; ++i) {
+    f(i) = pow(x_, i) * sin(y_ * z_) + cos(x_ * y_) / (1 + pow(z_, 2));
+  }
+  const std::vector<Variable> vars{x_, y_, z_};
+  const MatrixX<Expression> J{Jacobian(f, vars)};
+  ASSERT_EQ(J.rows(), n);
+  ASSERT_EQ(J.cols(), 3);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      EXPECT_TRUE(J(i, j).EqualTo(f(i).Differentiate(vars[j])));
+    }
+  }
+}
+
 }  // namespace
 }  // namespace symbolic
 }  // namespace drake
@@ -2613,6 +2613,34 @@ TEST_F(SymbolicExpressionTest, EvaluateExpressionsIncludingRandomVariables) {
   }
 }
 
+TEST_F(SymbolicExpressionTest, Arena) {
+  const Environment env{{var_x_, 1.0}, {var_y_, 2.0}};
+  Expression escaped;
+  {
+    ExpressionArena arena;
+    Expression e{zero_};
+    for (int i = 0; i < 100; ++i) {
+      e += sin(x_ * i) * cos(y_ + i);
+    }
+    EXPECT_GT(arena.bytes_allocated(), 0u);
+    escaped = e;
+  }
+  // Expressions may outlive the arena scope; the cells stay valid until the
+  // last reference is gone.
+  EXPECT_NO_THROW(escaped.Evaluate(env));
+  EXPECT_PRED2(ExprEqual, escaped, escaped.Expand().Expand());
+  {
+    // Arenas nest; expressions from different scopes mix freely.
+    ExpressionArena outer;
+    const Expression a{x_ + y_};
+    {
+      ExpressionArena inner;
+      EXPECT_DOUBLE_EQ((a * a).Evaluate(env), 9.0);
+    }
+    EXPECT_DOUBLE_EQ(a.Evaluate(env), 3.0);
+  }
+}
+
 }  // namespace
 }  // namespace symbolic
 }  // namespace drake
@@ -0,0 +1,167 @@
+#include "drake/common/text_logging_async.h"
+
+#include <atomic>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#ifdef HAVE_SPDLOG
+#include <spdlog/sinks/ostream_sink.h>
+#endif  // HAVE_SPDLOG
+
+namespace drake {
+namespace logging {
+namespace {
+
+#ifdef HAVE_SPDLOG
+
+using testing::HasSubstr;
+
+// A sink wrapper that can be paused, so tests can deterministically fill the
+// AsyncSink's ring buffer.
+class PausableSink final : public spdlog::sinks::sink {
+ public:
+  explicit PausableSink(spdlog::sink_ptr wrapped)
+      : wrapped_(std::move(wrapped)) {}
+
+  void log(const spdlog::details::log_msg& msg) override {
+    while (paused_.load()) {
+      std::this_thread::yield();
+    }
+    wrapped_->log(msg);
+  }
+
+  void flush() override { wrapped_->flush(); }
+  void set_pattern(const std::string& pattern) override {
+    wrapped_->set_pattern(pattern);
+  }
+  void set_formatter(
+      std::unique_ptr<spdlog::formatter> sink_formatter) override {
+    wrapped_->set_formatter(std::move(sink_formatter));
+  }
+
+  void set_paused(bool paused) { paused_.store(paused); }
+
+ private:
+  const spdlog::sink_ptr wrapped_;
+  std::atomic<bool> paused_{false};
+};
+
+// Messages pass through to the wrapped sink, in order, after flush().
+GTEST_TEST(TextLoggingAsyncTest, PassThrough) {
+  std::ostringstream stream;
+  auto ostream_sink =
+      std::make_shared<spdlog::sinks::ostream_sink_mt>(stream);
+  auto async = std::make_shared<AsyncSink>(
+      std::vector<spdlog::sink_ptr>{ostream_sink});
+  spdlog::logger logger("async_test", async);
+
+  logger.info("one {}", 1);
+  logger.warn("two {}", 2);
+  async->flush();
+
+  const std::string output = stream.str();
+  EXPECT_THAT(output, HasSubstr("one 1"));
+  EXPECT_THAT(output, HasSubstr("two 2"));
+  EXPECT_LT(output.find("one 1"), output.find("two 2"));
+  EXPECT_EQ(async->dropped_count(), 0);
+}
+
+// When the ring buffer is full, messages are dropped and counted instead of
+// blocking the producer.
+GTEST_TEST(TextLoggingAsyncTest, BoundedLoss) {
+  std::ostringstream stream;
+  auto ostream_sink =
+      std::make_shared<spdlog::sinks::ostream_sink_mt>(stream);
+  auto pausable = std::make_shared<PausableSink>(ostream_sink);
+  const size_t capacity = 8;
+  auto async = std::make_shared<AsyncSink>(
+      std::vector<spdlog::sink_ptr>{pausable}, capacity);
+  spdlog::logger logger("async_test", async);
+
+  // With the downstream sink paused, overfilling the queue must not block.
+  pausable->set_paused(true);
+  const int num_messages = 100;
+  for (int i = 0; i < num_messages; ++i) {
+    logger.info("message {}", i);
+  }
+  EXPECT_GE(async->dropped_count(), num_messages - static_cast<int>(capacity));
+
+  pausable->set_paused(false);
+  async->flush();
+
+  // Every message was either delivered or counted as dropped.
+  int num_delivered = 0;
+  std::string::size_type offset = 0;
+  const std::string output = stream.str();
+  while ((offset = output.find("message ", offset)) != std::string::npos) {
+    ++num_delivered;
+    offset += 1;
+  }
+  EXPECT_EQ(num_delivered + async->dropped_count(), num_messages);
+  // The first message was queued before the buffer filled.
+  EXPECT_THAT(output, HasSubstr("message 0"));
+}
+
+// Concurrent producers do not lose messages when the buffer has room.
+GTEST_TEST(TextLoggingAsyncTest, MultipleProducers) {
+  std::ostringstream stream;
+  auto ostream_sink =
+      std::make_shared<spdlog::sinks::ostream_sink_mt>(stream);
+  auto async = std::make_shared<AsyncSink>(
+      std::vector<spdlog::sink_ptr>{ostream_sink}, 4096);
+  spdlog::logger logger("async_test", async);
+
+  const int num_threads = 4;
+  const int messages_per_thread = 500;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < num_threads; ++i) {
+    threads.emplace_back([&logger, i]() {
+      for (int j = 0; j < messages_per_thread; ++j) {
+        logger.info("thread {} message {}", i, j);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  async->flush();
+
+  int num_delivered = 0;
+  std::string::size_type offset = 0;
+  const std::string output = stream.str();
+  while ((offset = output.find("message ", offset)) != std::string::npos) {
+    ++num_delivered;
+    offset += 1;
+  }
+  EXPECT_EQ(num_delivered + async->dropped_count(),
+            num_threads * messages_per_thread);
+}
+
+// A bad queue capacity is rejected.
+GTEST_TEST(TextLoggingAsyncTest, BadCapacity) {
+  EXPECT_THROW(AsyncSink(std::vector<spdlog::sink_ptr>{}, 3),
+               std::runtime_error);
+  EXPECT_THROW(AsyncSink(std::vector<spdlog::sink_ptr>{}, 0),
+               std::runtime_error);
+}
+
+#else  // HAVE_SPDLOG
+
+// Without spdlog, the stub must still exist.
+GTEST_TEST(TextLoggingAsyncTest, Stub) {
+  AsyncSink async;
+  async.flush();
+  EXPECT_EQ(async.dropped_count(), 0);
+}
+
+#endif  // HAVE_SPDLOG
+
+}  // namespace
+}  // namespace logging
+}  // namespace drake
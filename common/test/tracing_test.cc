@@ -0,0 +1,60 @@
+// Enable the tracepoint macro for this translation unit; it is compiled out
+// by default.
+#define DRAKE_ENABLE_TRACING
+#include "drake/common/tracing.h"
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace trace {
+namespace {
+
+std::string Dump() {
+  std::ostringstream out;
+  DumpTrace(&out);
+  return out.str();
+}
+
+GTEST_TEST(TracingTest, RecordsAndDumps) {
+  ClearTrace();
+  {
+    DRAKE_TRACEPOINT("tracing_test_outer");
+    DRAKE_TRACEPOINT("tracing_test_inner");
+  }
+  const std::string json = Dump();
+  EXPECT_NE(json.find("\"traceEvents\""), std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"tracing_test_outer\""), std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"tracing_test_inner\""), std::string::npos);
+  EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+}
+
+GTEST_TEST(TracingTest, ClearDiscardsRecords) {
+  {
+    DRAKE_TRACEPOINT("tracing_test_cleared");
+  }
+  ClearTrace();
+  EXPECT_EQ(Dump().find("tracing_test_cleared"), std::string::npos);
+}
+
+GTEST_TEST(TracingTest, PerThreadBuffers) {
+  ClearTrace();
+  std::thread worker([]() {
+    DRAKE_TRACEPOINT("tracing_test_worker");
+  });
+  worker.join();
+  {
+    DRAKE_TRACEPOINT("tracing_test_main");
+  }
+  const std::string json = Dump();
+  // Both threads' records are present, on distinct tids.
+  EXPECT_NE(json.find("tracing_test_worker"), std::string::npos);
+  EXPECT_NE(json.find("tracing_test_main"), std::string::npos);
+}
+
+}  // namespace
+}  // namespace trace
+}  // namespace drake
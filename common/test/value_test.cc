@@ -230,6 +230,54 @@ TYPED_TEST(TypedValueTest, Mutation) {
   EXPECT_EQ(10, erased.GetValue<T>());
 }
 
+// The move-aware SetFrom variants must transfer the stored value when the
+// concrete types match, rather than copying or cloning it, and must fall back
+// to the copying variants on a type mismatch.
+TYPED_TEST(TypedValueTest, MoveAwareSetFrom) {
+  using T = TypeParam;
+  Value<T> value(3);
+  AbstractValue& erased = value;
+
+  // The copying overloads still handle lvalue sources.
+  const Value<T> source(9);
+  erased.SetFrom(source);
+  EXPECT_EQ(9, erased.GetValue<T>());
+  const Value<T> source2(10);
+  erased.SetFromOrThrow(source2);
+  EXPECT_EQ(10, erased.GetValue<T>());
+
+  // An rvalue source takes the move path. The donor must still hold a valid
+  // value object afterward, though its contents are unspecified.
+  Value<T> donor(11);
+  erased.SetFrom(std::move(donor));
+  EXPECT_EQ(11, erased.GetValue<T>());
+  EXPECT_NO_THROW(donor.get_value());
+
+  Value<T> donor2(12);
+  erased.SetFromOrThrow(std::move(donor2));
+  EXPECT_EQ(12, erased.GetValue<T>());
+  EXPECT_NO_THROW(donor2.get_value());
+
+  // Mismatched types are still rejected.
+  EXPECT_THROW(erased.SetFromOrThrow(Value<std::string>("hi")),
+               std::logic_error);
+}
+
+// For clone-only types, the move-aware SetFrom must swap the stored objects
+// rather than cloning, so no allocation occurs and the donor remains valid.
+GTEST_TEST(ValueTest, MoveAwareSetFromIsCloneFree) {
+  Value<CloneableInt> source(7);
+  const CloneableInt* const stored = &source.get_value();
+  Value<CloneableInt> dest(1);
+  AbstractValue& erased = dest;
+  erased.SetFrom(std::move(source));
+  EXPECT_EQ(dest.get_value().data, 7);
+  // The stored object was transferred, not cloned.
+  EXPECT_EQ(&dest.get_value(), stored);
+  // The donor received dest's old object in exchange.
+  EXPECT_EQ(source.get_value().data, 1);
+}
+
 TYPED_TEST(TypedValueTest, BadCast) {
   using T = TypeParam;
   Value<double> value(4);
@@ -0,0 +1,155 @@
+#include "drake/common/test_utilities/limit_malloc.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+// Functions that are called during dlopen / dlsym resolution and our own
+// monitoring machinery must not use the replaced allocation functions, so we
+// call the glibc implementations directly when passing through.
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t count, size_t size);
+extern "C" void* __libc_realloc(void* ptr, size_t size);
+extern "C" void __libc_free(void* ptr);
+
+namespace drake {
+namespace test {
+namespace {
+
+// This class and its instance below are the per-process state of the malloc
+// monitor.  When armed (i.e., when a LimitMalloc guard is alive), each call
+// to an allocation function is counted and checked against the limits.
+class Monitor {
+ public:
+  Monitor(const LimitMalloc* owner, LimitMallocParams args)
+      : owner_(owner), args_(std::move(args)) {}
+
+  const LimitMalloc* owner() const { return owner_; }
+  const LimitMallocParams& params() const { return args_; }
+  int num_allocations() const { return observed_num_allocations_.load(); }
+
+  // To be called by our overriding implementations of the allocation
+  // functions below.
+  void ObserveAllocation();
+
+ private:
+  const LimitMalloc* const owner_{};
+  const LimitMallocParams args_{};
+  std::atomic<int> observed_num_allocations_{0};
+};
+
+// The currently-armed monitor, or nullptr when no guard is active.  This is
+// a raw pointer (not unique_ptr) because the malloc overrides below must not
+// themselves allocate or deallocate while consulting it.
+std::atomic<Monitor*> g_monitor{nullptr};
+
+void Monitor::ObserveAllocation() {
+  const int num = ++observed_num_allocations_;
+  if (args_.max_num_allocations < 0 || num <= args_.max_num_allocations) {
+    return;
+  }
+
+  // Report an error.  Printing and aborting (rather than throwing) keeps us
+  // safely re-entrant with respect to the C allocation functions, and a
+  // debugger breakpoint on the abort finds the offending call site.
+  fprintf(stderr, "abort due to malloc #%d while LimitMalloc(%d) in effect\n",
+          num, args_.max_num_allocations);
+  ::abort();
+}
+
+// Arms the monitor; aborts if one is already armed.
+void InstallMonitor(Monitor* monitor) {
+  Monitor* expected = nullptr;
+  if (!g_monitor.compare_exchange_strong(expected, monitor)) {
+    fprintf(stderr, "only one LimitMalloc may exist at a time\n");
+    ::abort();
+  }
+}
+
+// Disarms the monitor; aborts unless `monitor` was the armed one.
+void RemoveMonitor(Monitor* monitor) {
+  Monitor* expected = monitor;
+  if (!g_monitor.compare_exchange_strong(expected, nullptr)) {
+    fprintf(stderr, "LimitMalloc guards must not overlap\n");
+    ::abort();
+  }
+}
+
+}  // namespace
+
+LimitMalloc::LimitMalloc() : LimitMalloc({.max_num_allocations = 0}) {}
+
+LimitMalloc::LimitMalloc(LimitMallocParams args) {
+  // The monitor's storage must bypass the monitored allocators.
+  void* storage = __libc_malloc(sizeof(Monitor));
+  InstallMonitor(new (storage) Monitor(this, std::move(args)));
+}
+
+LimitMalloc::~LimitMalloc() {
+  Monitor* monitor = g_monitor.load();
+  const int observed = monitor->num_allocations();
+  const LimitMallocParams args = monitor->params();
+  RemoveMonitor(monitor);
+  monitor->~Monitor();
+  __libc_free(monitor);
+
+  // Enforce the minimum now that the guard is fully disarmed.  A destructor
+  // must not throw, so we report and abort just as for the maximum.
+  if (args.min_num_allocations >= 0 && observed < args.min_num_allocations) {
+    fprintf(stderr,
+            "abort due to only %d mallocs while LimitMalloc expected >= %d\n",
+            observed, args.min_num_allocations);
+    ::abort();
+  }
+}
+
+int LimitMalloc::num_allocations() const {
+  Monitor* monitor = g_monitor.load();
+  if (monitor == nullptr || monitor->owner() != this) {
+    throw std::logic_error("LimitMalloc monitoring is not active.");
+  }
+  return monitor->num_allocations();
+}
+
+const LimitMallocParams& LimitMalloc::params() const {
+  Monitor* monitor = g_monitor.load();
+  if (monitor == nullptr || monitor->owner() != this) {
+    throw std::logic_error("LimitMalloc monitoring is not active.");
+  }
+  return monitor->params();
+}
+
+}  // namespace test
+}  // namespace drake
+
+// Define our allocation function overrides.  The glibc implementations are
+// weak symbols, so these definitions take precedence for any test program
+// that links this library.
+extern "C" void* malloc(size_t size) {
+  drake::test::Monitor* monitor = drake::test::g_monitor.load();
+  if (monitor != nullptr) {
+    monitor->ObserveAllocation();
+  }
+  return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t count, size_t size) {
+  drake::test::Monitor* monitor = drake::test::g_monitor.load();
+  if (monitor != nullptr) {
+    monitor->ObserveAllocation();
+  }
+  return __libc_calloc(count, size);
+}
+
+extern "C" void* realloc(void* ptr, size_t size) {
+  void* result = __libc_realloc(ptr, size);
+  drake::test::Monitor* monitor = drake::test::g_monitor.load();
+  if (monitor != nullptr &&
+      !(monitor->params().ignore_realloc_noops && (result == ptr))) {
+    monitor->ObserveAllocation();
+  }
+  return result;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+namespace drake {
+namespace test {
+
+/// Parameters to control malloc limits.
+struct LimitMallocParams {
+  /// Maximum calls to malloc, calloc, or realloc (totaled as one).
+  /// When less than zero, there is no limit on the number of calls.
+  int max_num_allocations{-1};
+
+  /// Minimum calls to malloc, calloc, or realloc (totaled as one).
+  /// When less than zero, there is no limit on the number of calls.
+  int min_num_allocations{-1};
+
+  /// Whether a realloc() that leaves its `ptr` unchanged should be ignored.
+  bool ignore_realloc_noops{false};
+};
+
+/// Instantiate this class in a unit test scope where malloc (and realloc,
+/// etc.) should be disallowed or curtailed.
+///
+/// @note This class is currently a no-op in some build configurations:
+/// - macOS
+/// - memcheck tests
+/// - sanitizer builds
+///
+/// Example:
+/// @code
+/// GTEST_TEST(LimitMallocTest, BasicTest) {
+///   std::vector<double> foo(100);  // Heap allocation is OK.
+///   {
+///     LimitMalloc guard;
+///     // The guarded code goes here.  Heap allocations result in aborts.
+///     std::array<double, 100> stack_storage;
+///   }
+///   std::vector<double> bar(100);  // Heap allocation is OK again.
+/// }
+/// @endcode
+///
+/// Currently, when the device under test violates its allocation limits, the
+/// test program will abort.  In the future, we may add a recovery mode where
+/// exceptions are thrown instead.
+class LimitMalloc final {
+ public:
+  /// Applies malloc limits entirely disallowing heap allocations until this
+  /// object's destructor is run; equivalent to passing a max_num_allocations
+  /// of zero to the other constructor.
+  LimitMalloc();
+
+  /// Applies the given malloc limits until this object's destructor is run.
+  /// Only one instance of this class may exist at a time.
+  explicit LimitMalloc(LimitMallocParams args);
+
+  /// Undoes this object's malloc limits, and checks that any minimum count
+  /// was met.
+  ~LimitMalloc();
+
+  /// Returns the number of allocations observed so far.
+  int num_allocations() const;
+
+  /// Returns the parameters structure used to construct this object.
+  const LimitMallocParams& params() const;
+
+  // We write this out by hand, to avoid depending on Drake *at all*.
+  /// @name  Does not allow copy, move, or assignment
+  //@{
+  LimitMalloc(const LimitMalloc&) = delete;
+  void operator=(const LimitMalloc&) = delete;
+  LimitMalloc(LimitMalloc&&) = delete;
+  void operator=(LimitMalloc&&) = delete;
+  //@}
+};
+
+}  // namespace test
+}  // namespace drake
@@ -0,0 +1,95 @@
+#include "drake/common/test_utilities/limit_malloc.h"
+
+#include <cstdlib>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace test {
+namespace {
+
+// Calls malloc (and returns the result) while remaining invisible to the
+// compiler's optimizer, so that the call is not elided.
+void* CallMalloc() {
+  static volatile size_t g_size = 16;
+  return ::malloc(g_size);
+}
+
+// Calls calloc likewise.
+void* CallCalloc() {
+  static volatile size_t g_count = 1;
+  return ::calloc(g_count, 16);
+}
+
+// Calls realloc likewise.
+void* CallRealloc(void* ptr, size_t size) {
+  static volatile size_t g_slop = 0;
+  return ::realloc(ptr, size + g_slop);
+}
+
+// A guard with no limits in play just counts.
+GTEST_TEST(LimitMallocTest, ObserveTest) {
+  LimitMalloc guard(LimitMallocParams{/* no limits */});
+  EXPECT_EQ(guard.num_allocations(), 0);
+  void* p1 = CallMalloc();
+  EXPECT_EQ(guard.num_allocations(), 1);
+  void* p2 = CallCalloc();
+  EXPECT_EQ(guard.num_allocations(), 2);
+  void* p3 = CallRealloc(p1, 32);
+  EXPECT_EQ(guard.num_allocations(), 3);
+  ::free(p3);
+  ::free(p2);
+  // Freeing is not counted as an allocation.
+  EXPECT_EQ(guard.num_allocations(), 3);
+}
+
+// Allocations made before and after a guard's scope are not counted.
+GTEST_TEST(LimitMallocTest, ScopingTest) {
+  std::vector<double> before(100);
+  {
+    LimitMalloc guard({.max_num_allocations = 1});
+    void* p = CallMalloc();
+    EXPECT_EQ(guard.num_allocations(), 1);
+    ::free(p);
+  }
+  std::vector<double> after(100);
+  EXPECT_EQ(before.size(), after.size());
+}
+
+// A max of zero (the default constructor) aborts upon any allocation.
+GTEST_TEST(LimitMallocDeathTest, MaxLimitTest) {
+  ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+  ASSERT_DEATH(
+      {
+        LimitMalloc guard;
+        CallMalloc();
+      },
+      "abort due to malloc #1 while LimitMalloc\\(0\\) in effect");
+}
+
+// A minimum that is not achieved aborts at the end of the guard's scope.
+GTEST_TEST(LimitMallocDeathTest, MinLimitTest) {
+  ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+  ASSERT_DEATH(
+      { LimitMalloc guard({.min_num_allocations = 1}); },
+      "abort due to only 0 mallocs while LimitMalloc expected >= 1");
+}
+
+// A no-op realloc is ignored when so configured.
+GTEST_TEST(LimitMallocTest, ReallocNoopTest) {
+  void* p = CallMalloc();
+  {
+    LimitMalloc guard({.ignore_realloc_noops = true});
+    // A same-size realloc ordinarily leaves `ptr` unchanged, in which case
+    // it must not be counted; if the allocator did relocate, it counts.
+    void* q = CallRealloc(p, 16);
+    EXPECT_EQ(guard.num_allocations(), (q == p) ? 0 : 1);
+    p = q;
+  }
+  ::free(p);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace drake
@@ -0,0 +1,196 @@
+#include "drake/common/text_logging_async.h"
+
+#ifdef HAVE_SPDLOG
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+/* clang-format off */
+#include <spdlog/version.h>
+/* clang-format on */
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace logging {
+namespace {
+
+// How long the drain thread sleeps when the ring buffer is empty.  Producers
+// never signal the drain thread (a wakeup would cost a syscall on the hot
+// path); instead the drain thread polls at this interval.
+constexpr std::chrono::milliseconds kDrainPollInterval{1};
+
+}  // namespace
+
+AsyncSink::AsyncSink(std::vector<spdlog::sink_ptr> sinks,
+                     size_t queue_capacity)
+    : sinks_(std::move(sinks)),
+      mask_(queue_capacity - 1),
+      slots_(queue_capacity) {
+  DRAKE_THROW_UNLESS(queue_capacity >= 2 &&
+                     (queue_capacity & (queue_capacity - 1)) == 0);
+  // Per the bounded multi-producer queue protocol (Vyukov), a slot is free
+  // for the producer of position `pos` iff its sequence equals `pos`, and
+  // ready for the consumer iff its sequence equals `pos + 1`.
+  for (size_t i = 0; i < slots_.size(); ++i) {
+    slots_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  drain_thread_ = std::thread(&AsyncSink::DrainLoop, this);
+}
+
+AsyncSink::~AsyncSink() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_requested_ = true;
+  }
+  wakeup_.notify_all();
+  drain_thread_.join();
+}
+
+void AsyncSink::log(const spdlog::details::log_msg& msg) {
+  // Claim a slot, or drop the message if the ring buffer is full.
+  size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+  Slot* slot{};
+  for (;;) {
+    slot = &slots_[pos & mask_];
+    const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+    const intptr_t difference =
+        static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+    if (difference == 0) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (difference < 0) {
+      // The slot one lap back has not been consumed yet: the buffer is full.
+      dropped_count_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+
+  // Copy a bounded amount of the message into the slot.
+  slot->level = msg.level;
+  slot->time = msg.time;
+  slot->thread_id = msg.thread_id;
+#if SPDLOG_VERSION >= 10500
+  const char* const name_data = msg.logger_name.data();
+  const size_t name_size = msg.logger_name.size();
+  const char* const text_data = msg.payload.data();
+  const size_t text_size = msg.payload.size();
+#else
+  const char* const name_data =
+      (msg.logger_name != nullptr) ? msg.logger_name->data() : "";
+  const size_t name_size =
+      (msg.logger_name != nullptr) ? msg.logger_name->size() : 0;
+  const char* const text_data = msg.raw.data();
+  const size_t text_size = msg.raw.size();
+#endif
+  slot->name_size = std::min(name_size, kMaxNameSize);
+  std::copy(name_data, name_data + slot->name_size, slot->name);
+  slot->text_size = std::min(text_size, kMaxMessageSize);
+  std::copy(text_data, text_data + slot->text_size, slot->text);
+
+  // Publish the slot to the consumer.
+  slot->sequence.store(pos + 1, std::memory_order_release);
+}
+
+void AsyncSink::flush() {
+  int64_t my_generation{};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    my_generation = ++flush_generation_;
+  }
+  wakeup_.notify_all();
+  std::unique_lock<std::mutex> lock(mutex_);
+  drained_.wait(lock, [this, my_generation]() {
+    return completed_flush_generation_ >= my_generation;
+  });
+}
+
+void AsyncSink::set_pattern(const std::string& pattern) {
+  for (const spdlog::sink_ptr& wrapped : sinks_) {
+    wrapped->set_pattern(pattern);
+  }
+}
+
+void AsyncSink::set_formatter(
+    std::unique_ptr<spdlog::formatter> sink_formatter) {
+  for (const spdlog::sink_ptr& wrapped : sinks_) {
+    wrapped->set_formatter(sink_formatter->clone());
+  }
+}
+
+int AsyncSink::DrainOnce() {
+  int num_forwarded = 0;
+  for (;;) {
+    Slot& slot = slots_[dequeue_pos_ & mask_];
+    const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+    if (sequence != dequeue_pos_ + 1) {
+      // The next slot has not been published yet; the queue is empty (or a
+      // producer is mid-copy, in which case we will pick the message up on
+      // the next pass).
+      break;
+    }
+
+    // Reconstitute the message and forward it to the wrapped sinks.
+    const std::string logger_name(slot.name, slot.name_size);
+#if SPDLOG_VERSION >= 10500
+    spdlog::details::log_msg message(
+        slot.time, spdlog::source_loc{}, logger_name, slot.level,
+        spdlog::string_view_t(slot.text, slot.text_size));
+    message.thread_id = slot.thread_id;
+#else
+    spdlog::details::log_msg message(&logger_name, slot.level);
+    message.time = slot.time;
+    message.thread_id = slot.thread_id;
+    message.raw.append(slot.text, slot.text + slot.text_size);
+#endif
+    for (const spdlog::sink_ptr& wrapped : sinks_) {
+      if (wrapped->should_log(message.level)) {
+        wrapped->log(message);
+      }
+    }
+
+    // Release the slot for the producers' next lap.
+    slot.sequence.store(dequeue_pos_ + mask_ + 1, std::memory_order_release);
+    ++dequeue_pos_;
+    ++num_forwarded;
+  }
+  return num_forwarded;
+}
+
+void AsyncSink::DrainLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  for (;;) {
+    const bool stopping = stop_requested_;
+    const int64_t requested_flush = flush_generation_;
+
+    lock.unlock();
+    DrainOnce();
+    if (requested_flush > completed_flush_generation_) {
+      for (const spdlog::sink_ptr& wrapped : sinks_) {
+        wrapped->flush();
+      }
+    }
+    lock.lock();
+
+    if (requested_flush > completed_flush_generation_) {
+      completed_flush_generation_ = requested_flush;
+      drained_.notify_all();
+    }
+    if (stopping) {
+      return;
+    }
+    wakeup_.wait_for(lock, kDrainPollInterval, [this]() {
+      return stop_requested_ || flush_generation_ > completed_flush_generation_;
+    });
+  }
+}
+
+}  // namespace logging
+}  // namespace drake
+
+#endif  // HAVE_SPDLOG
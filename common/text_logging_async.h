@@ -0,0 +1,162 @@
+#pragma once
+
+/**
+@file
+An asynchronous sink for Drake's text logging, intended for use inside
+real-time loops.  The synchronous default configuration writes to stderr from
+the calling thread, so a single warning inside a high-rate control loop can
+blow its deadline on console I/O.  AsyncSink instead deposits each message
+into a fixed-capacity lock-free ring buffer (a bounded copy plus one
+compare-and-swap on the calling thread) and forwards it to the wrapped sinks
+from a background drain thread.
+
+When the ring buffer is full, further messages are dropped and counted rather
+than blocking the producer (bounded-loss semantics); see dropped_count().
+
+Typical usage redirects all Drake logging through an AsyncSink:
+<pre>
+  auto* dist_sink = dynamic_cast<spdlog::sinks::dist_sink_mt*>(
+      drake::logging::get_dist_sink());
+  auto async = std::make_shared<drake::logging::AsyncSink>(
+      dist_sink->sinks());  // Wrap the current sinks.
+  dist_sink->set_sinks({async});
+</pre>
+*/
+
+#ifndef DRAKE_DOXYGEN_CXX
+#ifdef HAVE_SPDLOG
+/* clang-format off */
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/sink.h>
+/* clang-format on */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#endif  // HAVE_SPDLOG
+#endif  // DRAKE_DOXYGEN_CXX
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/text_logging.h"
+
+namespace drake {
+namespace logging {
+
+#ifdef HAVE_SPDLOG
+
+/// A sink that queues messages in a lock-free ring buffer and forwards them
+/// to a set of wrapped sinks from a background thread.  See the file
+/// documentation for motivation and usage.
+///
+/// The producer side (log()) is safe for concurrent use by any number of
+/// threads and never blocks: when the ring buffer is full the message is
+/// dropped and counted.  flush() blocks the calling thread until every
+/// message deposited before the call has reached the wrapped sinks and the
+/// wrapped sinks themselves have flushed; it is not intended for use on a
+/// real-time thread.
+///
+/// Messages are truncated to an implementation-defined bound (512 bytes) when
+/// queued.
+class AsyncSink final : public spdlog::sinks::sink {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(AsyncSink)
+
+  /// Constructs a sink forwarding to @p sinks, with a ring buffer able to
+  /// hold @p queue_capacity messages.
+  /// @pre queue_capacity is a power of two.
+  explicit AsyncSink(std::vector<spdlog::sink_ptr> sinks,
+                     size_t queue_capacity = 1024);
+
+  /// Drains any queued messages to the wrapped sinks, then stops the drain
+  /// thread.
+  ~AsyncSink() override;
+
+  /// (Producer side; lock-free.)  Queues @p msg for the drain thread, or
+  /// drops it when the ring buffer is full.
+  void log(const spdlog::details::log_msg& msg) override;
+
+  /// Blocks until all previously queued messages have been forwarded and the
+  /// wrapped sinks have flushed.  (A message whose log() call is still in
+  /// progress on another thread may be forwarded later instead.)
+  void flush() override;
+
+  void set_pattern(const std::string& pattern) override;
+  void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter)
+      override;
+
+  /// Returns the number of messages dropped so far because the ring buffer
+  /// was full.
+  int64_t dropped_count() const {
+    return dropped_count_.load(std::memory_order_relaxed);
+  }
+
+  /// Returns the wrapped sinks.
+  const std::vector<spdlog::sink_ptr>& sinks() const { return sinks_; }
+
+ private:
+  // Upper bounds for the copied-into-slot message text and logger name.
+  static constexpr size_t kMaxMessageSize = 512;
+  static constexpr size_t kMaxNameSize = 64;
+
+  // One ring-buffer entry.  The sequence number implements the bounded
+  // multi-producer single-consumer protocol (see text_logging_async.cc); the
+  // remaining fields are a bounded copy of one log message.
+  struct Slot {
+    std::atomic<size_t> sequence;
+    spdlog::level::level_enum level;
+    spdlog::log_clock::time_point time;
+    size_t thread_id;
+    size_t name_size;
+    size_t text_size;
+    char name[kMaxNameSize];
+    char text[kMaxMessageSize];
+  };
+
+  // The body of the drain thread.
+  void DrainLoop();
+
+  // Forwards every currently queued message to the wrapped sinks; returns
+  // the number forwarded.  Only the drain thread may call this.
+  int DrainOnce();
+
+  const std::vector<spdlog::sink_ptr> sinks_;
+  const size_t mask_;
+  std::vector<Slot> slots_;
+  std::atomic<size_t> enqueue_pos_{0};
+  size_t dequeue_pos_{0};  // Touched only by the drain thread.
+  std::atomic<int64_t> dropped_count_{0};
+
+  // Coordination between flush()/the destructor and the drain thread.
+  std::mutex mutex_;
+  std::condition_variable wakeup_;
+  std::condition_variable drained_;
+  bool stop_requested_{false};
+  int64_t flush_generation_{0};
+  int64_t completed_flush_generation_{0};
+
+  std::thread drain_thread_;
+};
+
+#else  // HAVE_SPDLOG
+
+/// A stubbed-out version of AsyncSink, for when spdlog is disabled.
+class AsyncSink final : public sink {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(AsyncSink)
+
+  AsyncSink() = default;
+
+  void flush() {}
+
+  int64_t dropped_count() const { return 0; }
+};
+
+#endif  // HAVE_SPDLOG
+
+}  // namespace logging
+}  // namespace drake
@@ -0,0 +1,117 @@
+#include "drake/common/tracing.h"
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+#include "drake/common/never_destroyed.h"
+
+namespace drake {
+namespace trace {
+namespace {
+
+// Ring capacity per thread.  At 24 bytes per record this is 1.5 MiB per
+// traced thread, enough to hold several simulation substeps' worth of events.
+constexpr int kRingCapacity = 1 << 16;
+
+struct Record {
+  const char* name{};
+  std::int64_t start_ns{};
+  std::int64_t duration_ns{};
+};
+
+// One ring buffer per thread.  Only the owning thread writes; DumpTrace()
+// and ClearTrace() read and reset under the registry mutex, which is safe
+// because their contract forbids concurrently active tracepoints.
+struct ThreadBuffer {
+  explicit ThreadBuffer(std::uint64_t thread_id_in)
+      : thread_id(thread_id_in), records(kRingCapacity) {}
+
+  const std::uint64_t thread_id;
+  std::vector<Record> records;
+  // Total number of records ever pushed; the ring index is count % capacity.
+  std::int64_t count{0};
+};
+
+struct Registry {
+  std::mutex mutex;
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+  std::uint64_t next_thread_id{0};
+};
+
+Registry& GetRegistry() {
+  static never_destroyed<Registry> registry;
+  return registry.access();
+}
+
+// Returns the calling thread's buffer, registering it on first use.  The
+// registry holds a shared_ptr so that records survive thread exit until
+// they are dumped or cleared.
+ThreadBuffer& GetThreadBuffer() {
+  thread_local std::shared_ptr<ThreadBuffer> buffer = []() {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto result = std::make_shared<ThreadBuffer>(registry.next_thread_id++);
+    registry.buffers.push_back(result);
+    return result;
+  }();
+  return *buffer;
+}
+
+std::int64_t NowNanoseconds() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
+ScopedTracepoint::ScopedTracepoint(const char* name)
+    : name_(name), start_ns_(NowNanoseconds()) {}
+
+ScopedTracepoint::~ScopedTracepoint() {
+  const std::int64_t duration_ns = NowNanoseconds() - start_ns_;
+  ThreadBuffer& buffer = GetThreadBuffer();
+  Record& record = buffer.records[buffer.count % kRingCapacity];
+  record.name = name_;
+  record.start_ns = start_ns_;
+  record.duration_ns = duration_ns;
+  ++buffer.count;
+}
+
+void DumpTrace(std::ostream* out) {
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  *out << "{\"traceEvents\":[";
+  bool first = true;
+  for (const auto& buffer : registry.buffers) {
+    const std::int64_t stored =
+        buffer->count < kRingCapacity ? buffer->count : kRingCapacity;
+    const std::int64_t begin = buffer->count - stored;
+    for (std::int64_t i = begin; i < buffer->count; ++i) {
+      const Record& record = buffer->records[i % kRingCapacity];
+      if (!first) *out << ",";
+      first = false;
+      // The chrome://tracing "complete" event; timestamps are microseconds.
+      *out << "{\"name\":\"" << record.name << "\",\"ph\":\"X\",\"pid\":0"
+           << ",\"tid\":" << buffer->thread_id
+           << ",\"ts\":" << record.start_ns / 1e3
+           << ",\"dur\":" << record.duration_ns / 1e3 << "}";
+    }
+  }
+  *out << "]}\n";
+}
+
+void ClearTrace() {
+  Registry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (const auto& buffer : registry.buffers) {
+    buffer->count = 0;
+  }
+}
+
+}  // namespace trace
+}  // namespace drake
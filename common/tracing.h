@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+
+#include "drake/common/drake_copyable.h"
+
+/// @file
+/// Provides a lightweight scoped-tracepoint facility.  A tracepoint is an
+/// RAII object that records (name, thread, start time, duration) into a
+/// per-thread ring buffer when it goes out of scope; the accumulated records
+/// can be dumped as chrome://tracing JSON to visualize a timeline of where
+/// the wall-clock time of a slow run went.
+///
+/// Instrumentation sites use the DRAKE_TRACEPOINT() macro, which expands to
+/// nothing unless the code is compiled with -DDRAKE_ENABLE_TRACING, so the
+/// pre-placed tracepoints throughout Drake cost nothing by default.  When
+/// enabled, each tracepoint costs two monotonic clock reads and a ring-buffer
+/// store; no locks are taken on the recording path.
+
+namespace drake {
+namespace trace {
+
+/// An RAII tracepoint.  Records one trace event, spanning the lifetime of
+/// this object, into the calling thread's ring buffer.  Prefer the
+/// DRAKE_TRACEPOINT() macro over using this class directly so that the
+/// instrumentation compiles away by default.
+class ScopedTracepoint {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ScopedTracepoint)
+
+  /// Begins a trace event named @p name.  The record stores only the pointer,
+  /// so @p name must outlive any later DumpTrace() call; in practice it
+  /// should be a string literal.
+  explicit ScopedTracepoint(const char* name);
+
+  /// Ends the trace event and commits it to the per-thread ring buffer.
+  ~ScopedTracepoint();
+
+ private:
+  const char* const name_;
+  std::int64_t start_ns_{};
+};
+
+/// Writes every recorded trace event, across all threads, to @p out in the
+/// chrome://tracing JSON format (load the output via chrome://tracing or
+/// https://ui.perfetto.dev).  Each per-thread ring buffer holds the most
+/// recent 64Ki events recorded by that thread; older events are overwritten.
+/// This function must not be called concurrently with active tracepoints in
+/// other threads.
+void DumpTrace(std::ostream* out);
+
+/// Discards every recorded trace event, across all threads.  This function
+/// must not be called concurrently with active tracepoints in other threads.
+void ClearTrace();
+
+}  // namespace trace
+}  // namespace drake
+
+#ifdef DRAKE_ENABLE_TRACING
+#define DRAKE_TRACEPOINT_CONCAT_IMPL(x, y) x##y
+#define DRAKE_TRACEPOINT_CONCAT(x, y) DRAKE_TRACEPOINT_CONCAT_IMPL(x, y)
+/// Records a trace event named @p name spanning the rest of the enclosing
+/// scope.  @p name must be a string literal.  Expands to nothing unless
+/// compiled with -DDRAKE_ENABLE_TRACING.
+#define DRAKE_TRACEPOINT(name)                                 \
+  const ::drake::trace::ScopedTracepoint DRAKE_TRACEPOINT_CONCAT( \
+      drake_tracepoint_, __LINE__)(name)
+#else
+#define DRAKE_TRACEPOINT(name) static_cast<void>(0)
+#endif
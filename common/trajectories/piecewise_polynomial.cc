@@ -126,6 +126,69 @@ PiecewisePolynomial<T>::value(double t) const {
   return ret;
 }
 
+template <typename T>
+MatrixX<T>
+PiecewisePolynomial<T>::value(double t, int* segment_index_hint) const {
+  DRAKE_DEMAND(segment_index_hint != nullptr);
+  const int segment_index = this->get_segment_index(t, *segment_index_hint);
+  *segment_index_hint = segment_index;
+  t = std::min(std::max(t, this->start_time()), this->end_time());
+  Eigen::Matrix<double, PolynomialMatrix::RowsAtCompileTime,
+                PolynomialMatrix::ColsAtCompileTime>
+      ret(rows(), cols());
+  for (Eigen::Index row = 0; row < rows(); row++) {
+    for (Eigen::Index col = 0; col < cols(); col++) {
+      ret(row, col) = segmentValueAtGlobalAbscissa(segment_index, t, row, col);
+    }
+  }
+  return ret;
+}
+
+template <typename T>
+void PiecewisePolynomial<T>::EvalValue(double t,
+                                       EigenPtr<MatrixX<T>> value) const {
+  DRAKE_DEMAND(value != nullptr);
+  DRAKE_DEMAND(value->rows() == rows() && value->cols() == cols());
+  const int segment_index = this->get_segment_index(t);
+  t = std::min(std::max(t, this->start_time()), this->end_time());
+  for (Eigen::Index row = 0; row < rows(); row++) {
+    for (Eigen::Index col = 0; col < cols(); col++) {
+      (*value)(row, col) =
+          segmentValueAtGlobalAbscissa(segment_index, t, row, col);
+    }
+  }
+}
+
+template <typename T>
+void PiecewisePolynomial<T>::BatchValue(
+    const Eigen::Ref<const Eigen::VectorXd>& times,
+    EigenPtr<MatrixX<T>> values) const {
+  DRAKE_DEMAND(values != nullptr);
+  if (cols() != 1) {
+    throw std::runtime_error(
+        "BatchValue only supports PiecewisePolynomials with cols() == 1.");
+  }
+  if (values->rows() != rows() || values->cols() != times.size()) {
+    throw std::runtime_error(
+        "BatchValue output matrix must be preallocated to rows() x "
+        "times.size().");
+  }
+  int segment_index = 0;
+  for (Eigen::Index k = 0; k < times.size(); k++) {
+    if (k > 0 && times[k] < times[k - 1]) {
+      throw std::runtime_error(
+          "BatchValue times must be monotonically non-decreasing.");
+    }
+    const double t =
+        std::min(std::max(times[k], this->start_time()), this->end_time());
+    segment_index = this->get_segment_index(t, segment_index);
+    for (Eigen::Index row = 0; row < rows(); row++) {
+      (*values)(row, k) =
+          segmentValueAtGlobalAbscissa(segment_index, t, row, 0);
+    }
+  }
+}
+
 template <typename T>
 const typename PiecewisePolynomial<T>::PolynomialMatrix&
 PiecewisePolynomial<T>::getPolynomialMatrix(
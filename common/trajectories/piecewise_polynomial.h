@@ -370,6 +370,45 @@ class PiecewisePolynomial final : public PiecewiseTrajectory<T> {
    */
   MatrixX<T> value(double t) const override;
 
+  /**
+   * Variant of value() for sequential access patterns. On entry
+   * `*segment_index_hint` holds the segment index returned by an earlier
+   * evaluation (or 0 for the first call); on return it holds the segment
+   * index used for this evaluation. When consecutive calls stay in the same
+   * or a neighboring segment — the common case when sampling at a fixed rate
+   * — the segment lookup is O(1) instead of a binary search over the breaks.
+   *
+   * @param t The time at which to evaluate the PiecewisePolynomial.
+   * @param segment_index_hint In/out segment index cache; must not be null.
+   * @return The matrix of evaluated values.
+   */
+  MatrixX<T> value(double t, int* segment_index_hint) const;
+
+  /**
+   * Evaluates the PiecewisePolynomial at the given time \p t, writing the
+   * result into the preallocated \p value (of size rows() x cols()) instead
+   * of returning a temporary.
+   *
+   * @param t The time at which to evaluate the PiecewisePolynomial.
+   * @param value The preallocated output; must not be null.
+   */
+  void EvalValue(double t, EigenPtr<MatrixX<T>> value) const override;
+
+  /**
+   * Evaluates this PiecewisePolynomial at every entry of @p times, walking
+   * the segments once, and writes the result for `times[k]` into column `k`
+   * of `*values`.
+   *
+   * @param times The times at which to evaluate; must be monotonically
+   * non-decreasing.
+   * @param values Preallocated output of size rows() x `times.size()`.
+   * @throws std::runtime_error if this PiecewisePolynomial does not have
+   * cols() == 1, if @p times is not sorted, or if @p values has the wrong
+   * size.
+   */
+  void BatchValue(const Eigen::Ref<const Eigen::VectorXd>& times,
+                  EigenPtr<MatrixX<T>> values) const;
+
   const PolynomialMatrix& getPolynomialMatrix(int segment_index) const;
 
   const PolynomialType& getPolynomial(int segment_index, Eigen::Index row = 0,
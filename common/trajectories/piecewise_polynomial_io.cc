@@ -0,0 +1,233 @@
+#include "drake/common/trajectories/piecewise_polynomial_io.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include "drake/common/drake_assert.h"
+
+using std::runtime_error;
+using std::string;
+using std::vector;
+
+namespace drake {
+namespace trajectories {
+namespace {
+
+// Identifies the file format; bump kFormatVersion on layout changes.
+constexpr char kMagic[8] = {'D', 'R', 'A', 'K', 'E', 'P', 'P', '\0'};
+constexpr uint32_t kFormatVersion = 1;
+
+struct Header {
+  char magic[8];
+  uint32_t version;
+  int64_t num_segments;
+  int64_t rows;
+  int64_t cols;
+  // Number of coefficients stored per matrix element (maximum degree in the
+  // trajectory plus one); lower-degree elements are zero-padded so that every
+  // segment block has the same size.
+  int64_t num_coefficients;
+};
+
+void WriteRaw(const void* data, size_t size, std::ostream* out) {
+  out->write(static_cast<const char*>(data), size);
+  if (!out->good()) {
+    throw runtime_error("WritePiecewisePolynomial: stream write failed.");
+  }
+}
+
+void ReadRaw(std::istream* in, void* data, size_t size) {
+  in->read(static_cast<char*>(data), size);
+  if (!in->good()) {
+    throw runtime_error(
+        "ReadPiecewisePolynomial: stream read failed (truncated or invalid "
+        "file).");
+  }
+}
+
+Header ReadAndValidateHeader(std::istream* in) {
+  Header header;
+  ReadRaw(in, &header, sizeof(header));
+  if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+    throw runtime_error(
+        "ReadPiecewisePolynomial: bad magic; not a PiecewisePolynomial "
+        "file.");
+  }
+  if (header.version != kFormatVersion) {
+    throw runtime_error("ReadPiecewisePolynomial: unsupported format version.");
+  }
+  if (header.num_segments < 1 || header.rows < 1 || header.cols < 1 ||
+      header.num_coefficients < 1) {
+    throw runtime_error("ReadPiecewisePolynomial: corrupt header.");
+  }
+  return header;
+}
+
+}  // namespace
+
+void WritePiecewisePolynomial(const PiecewisePolynomial<double>& trajectory,
+                              std::ostream* out) {
+  DRAKE_DEMAND(out != nullptr);
+  const int num_segments = trajectory.get_number_of_segments();
+  if (num_segments < 1) {
+    throw runtime_error(
+        "WritePiecewisePolynomial: cannot write an empty trajectory.");
+  }
+
+  int64_t num_coefficients = 1;
+  for (int i = 0; i < num_segments; ++i) {
+    for (Eigen::Index row = 0; row < trajectory.rows(); ++row) {
+      for (Eigen::Index col = 0; col < trajectory.cols(); ++col) {
+        num_coefficients = std::max<int64_t>(
+            num_coefficients,
+            trajectory.getSegmentPolynomialDegree(i, row, col) + 1);
+      }
+    }
+  }
+
+  Header header{};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kFormatVersion;
+  header.num_segments = num_segments;
+  header.rows = trajectory.rows();
+  header.cols = trajectory.cols();
+  header.num_coefficients = num_coefficients;
+  WriteRaw(&header, sizeof(header), out);
+
+  const vector<double>& breaks = trajectory.get_segment_times();
+  WriteRaw(breaks.data(), breaks.size() * sizeof(double), out);
+
+  // Stream the segments one at a time, zero-padding each element's
+  // coefficients up to num_coefficients.
+  vector<double> block(trajectory.rows() * trajectory.cols() *
+                       num_coefficients);
+  for (int i = 0; i < num_segments; ++i) {
+    std::fill(block.begin(), block.end(), 0.0);
+    double* element = block.data();
+    for (Eigen::Index row = 0; row < trajectory.rows(); ++row) {
+      for (Eigen::Index col = 0; col < trajectory.cols(); ++col) {
+        const Eigen::VectorXd coefficients =
+            trajectory.getPolynomial(i, row, col).GetCoefficients();
+        std::copy(coefficients.data(),
+                  coefficients.data() + coefficients.size(), element);
+        element += num_coefficients;
+      }
+    }
+    WriteRaw(block.data(), block.size() * sizeof(double), out);
+  }
+}
+
+void WritePiecewisePolynomial(const PiecewisePolynomial<double>& trajectory,
+                              const string& filename) {
+  std::ofstream out(filename, std::ios::binary);
+  if (!out.is_open()) {
+    throw runtime_error("WritePiecewisePolynomial: cannot open '" + filename +
+                        "' for writing.");
+  }
+  WritePiecewisePolynomial(trajectory, &out);
+}
+
+PiecewisePolynomial<double> ReadPiecewisePolynomial(std::istream* in) {
+  DRAKE_DEMAND(in != nullptr);
+  const Header header = ReadAndValidateHeader(in);
+
+  vector<double> breaks(header.num_segments + 1);
+  ReadRaw(in, breaks.data(), breaks.size() * sizeof(double));
+
+  typedef PiecewisePolynomial<double>::PolynomialMatrix PolynomialMatrix;
+  vector<PolynomialMatrix> polynomials;
+  polynomials.reserve(header.num_segments);
+  vector<double> block(header.rows * header.cols * header.num_coefficients);
+  for (int64_t i = 0; i < header.num_segments; ++i) {
+    ReadRaw(in, block.data(), block.size() * sizeof(double));
+    PolynomialMatrix matrix(header.rows, header.cols);
+    const double* element = block.data();
+    for (int64_t row = 0; row < header.rows; ++row) {
+      for (int64_t col = 0; col < header.cols; ++col) {
+        matrix(row, col) = Polynomial<double>(
+            Eigen::Map<const Eigen::VectorXd>(element,
+                                              header.num_coefficients));
+        element += header.num_coefficients;
+      }
+    }
+    polynomials.push_back(std::move(matrix));
+  }
+  return PiecewisePolynomial<double>(polynomials, breaks);
+}
+
+PiecewisePolynomial<double> ReadPiecewisePolynomial(const string& filename) {
+  std::ifstream in(filename, std::ios::binary);
+  if (!in.is_open()) {
+    throw runtime_error("ReadPiecewisePolynomial: cannot open '" + filename +
+                        "' for reading.");
+  }
+  return ReadPiecewisePolynomial(&in);
+}
+
+LazyPiecewisePolynomial::LazyPiecewisePolynomial(const string& filename)
+    : filename_(filename), file_(filename, std::ios::binary) {
+  if (!file_.is_open()) {
+    throw runtime_error("LazyPiecewisePolynomial: cannot open '" + filename +
+                        "' for reading.");
+  }
+  const Header header = ReadAndValidateHeader(&file_);
+  rows_ = header.rows;
+  cols_ = header.cols;
+  num_coefficients_ = header.num_coefficients;
+
+  vector<double> breaks(header.num_segments + 1);
+  ReadRaw(&file_, breaks.data(), breaks.size() * sizeof(double));
+  this->get_mutable_breaks() = breaks;
+
+  segments_offset_ = file_.tellg();
+  cached_coefficients_.resize(rows_ * cols_ * num_coefficients_);
+}
+
+MatrixX<double> LazyPiecewisePolynomial::value(double t) const {
+  const int segment_index = this->get_segment_index(
+      t, cached_segment_index_ >= 0 ? cached_segment_index_ : 0);
+  LoadSegment(segment_index);
+  t = std::min(std::max(t, start_time()), end_time());
+  const double local_t = t - start_time(segment_index);
+
+  MatrixX<double> ret(rows_, cols_);
+  const double* element = cached_coefficients_.data();
+  for (Eigen::Index row = 0; row < rows_; ++row) {
+    for (Eigen::Index col = 0; col < cols_; ++col) {
+      // Evaluate the zero-padded coefficients by Horner's method.
+      double element_value = 0.0;
+      for (int64_t k = num_coefficients_ - 1; k >= 0; --k) {
+        element_value = element_value * local_t + element[k];
+      }
+      ret(row, col) = element_value;
+      element += num_coefficients_;
+    }
+  }
+  return ret;
+}
+
+std::unique_ptr<Trajectory<double>> LazyPiecewisePolynomial::Clone() const {
+  return std::make_unique<LazyPiecewisePolynomial>(filename_);
+}
+
+std::unique_ptr<Trajectory<double>> LazyPiecewisePolynomial::MakeDerivative(
+    int derivative_order) const {
+  const PiecewisePolynomial<double> materialized =
+      ReadPiecewisePolynomial(filename_);
+  return materialized.MakeDerivative(derivative_order);
+}
+
+void LazyPiecewisePolynomial::LoadSegment(int segment_index) const {
+  if (segment_index == cached_segment_index_) return;
+  segment_number_range_check(segment_index);
+  const std::streamoff block_size =
+      cached_coefficients_.size() * sizeof(double);
+  file_.seekg(segments_offset_ + segment_index * block_size);
+  ReadRaw(&file_, cached_coefficients_.data(), block_size);
+  cached_segment_index_ = segment_index;
+}
+
+}  // namespace trajectories
+}  // namespace drake
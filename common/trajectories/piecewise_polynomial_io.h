@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/trajectories/piecewise_polynomial.h"
+#include "drake/common/trajectories/piecewise_trajectory.h"
+#include "drake/common/trajectories/trajectory.h"
+
+namespace drake {
+namespace trajectories {
+
+/// @name Binary serialization for PiecewisePolynomial
+///
+/// The format is a fixed-size header (magic, version, segment count, matrix
+/// dimensions, and the per-element coefficient count), followed by the breaks,
+/// followed by one fixed-size coefficient block per segment. Coefficient
+/// blocks are zero-padded to the maximum degree appearing in the trajectory,
+/// so the file offset of any segment is computable in O(1) — which is what
+/// lets LazyPiecewisePolynomial load segments on demand. Data is written in
+/// the host byte order.
+/// @{
+
+/// Writes @p trajectory to @p out. Segments are streamed in order, using
+/// working memory proportional to a single segment.
+/// @throws std::runtime_error if any polynomial in @p trajectory is not
+/// univariate, or on a stream failure.
+void WritePiecewisePolynomial(const PiecewisePolynomial<double>& trajectory,
+                              std::ostream* out);
+
+/// Convenience overload that writes to the file named @p filename.
+void WritePiecewisePolynomial(const PiecewisePolynomial<double>& trajectory,
+                              const std::string& filename);
+
+/// Reads a trajectory written by WritePiecewisePolynomial(), materializing
+/// every segment in memory. For sampling large files without full
+/// materialization, use LazyPiecewisePolynomial instead.
+/// @throws std::runtime_error if @p in does not hold a valid trajectory.
+PiecewisePolynomial<double> ReadPiecewisePolynomial(std::istream* in);
+
+/// Convenience overload that reads from the file named @p filename.
+PiecewisePolynomial<double> ReadPiecewisePolynomial(
+    const std::string& filename);
+
+/// @}
+
+/// A Trajectory backed by a file written by WritePiecewisePolynomial() that
+/// loads coefficient data lazily: construction reads only the header and the
+/// breaks, and value() seeks to the containing segment's coefficient block,
+/// caching the most recently used segment. Sequential sampling therefore
+/// touches each segment once, and a multi-gigabyte logged trajectory can be
+/// evaluated (and shared between processes through the file) without ever
+/// being materialized in memory.
+class LazyPiecewisePolynomial final : public PiecewiseTrajectory<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(LazyPiecewisePolynomial)
+
+  /// Opens @p filename and reads its header and breaks.
+  /// @throws std::runtime_error if the file cannot be opened or does not
+  /// hold a valid trajectory.
+  explicit LazyPiecewisePolynomial(const std::string& filename);
+
+  ~LazyPiecewisePolynomial() override = default;
+
+  Eigen::Index rows() const override { return rows_; }
+
+  Eigen::Index cols() const override { return cols_; }
+
+  MatrixX<double> value(double t) const override;
+
+  /// Returns a new LazyPiecewisePolynomial reading the same file.
+  std::unique_ptr<Trajectory<double>> Clone() const override;
+
+  /// Materializes the full trajectory (as if by ReadPiecewisePolynomial())
+  /// and differentiates it; the result is an ordinary in-memory
+  /// PiecewisePolynomial.
+  std::unique_ptr<Trajectory<double>> MakeDerivative(
+      int derivative_order = 1) const override;
+
+ private:
+  // Reads segment @p segment_index's coefficient block into the cache (a
+  // no-op when it is already cached).
+  void LoadSegment(int segment_index) const;
+
+  std::string filename_;
+  mutable std::ifstream file_;
+  Eigen::Index rows_{0};
+  Eigen::Index cols_{0};
+  int64_t num_coefficients_{0};
+  std::streamoff segments_offset_{0};
+  // The most recently used segment; value() updates these.
+  mutable int cached_segment_index_{-1};
+  mutable std::vector<double> cached_coefficients_;
+};
+
+}  // namespace trajectories
+}  // namespace drake
@@ -1,8 +1,10 @@
 #include "drake/common/trajectories/piecewise_quaternion.h"
 
 #include <algorithm>
+#include <cmath>
 #include <stdexcept>
 
+#include "drake/common/drake_assert.h"
 #include "drake/math/quaternion.h"
 
 namespace drake {
@@ -37,13 +39,19 @@ void PiecewiseQuaternionSlerp<T>::ComputeAngularVelocities() {
   if (quaternions_.empty()) return;
 
   angular_velocities_.resize(quaternions_.size() - 1);
+  segment_axes_.resize(quaternions_.size() - 1);
+  segment_angles_.resize(quaternions_.size() - 1);
 
   AngleAxis<T> angle_axis_diff;
   // Computes q[t+1] = q_delta * q[t] first, turn q_delta into an axis, which
-  // turns into an angular velocity.
+  // turns into an angular velocity. The axis and angle are also retained so
+  // that orientation() can assemble the interpolant directly instead of
+  // re-deriving the relative rotation per call.
   for (size_t i = 1; i < quaternions_.size(); ++i) {
     angle_axis_diff =
         AngleAxis<T>(quaternions_[i] * quaternions_[i - 1].inverse());
+    segment_axes_[i - 1] = angle_axis_diff.axis();
+    segment_angles_[i - 1] = angle_axis_diff.angle();
     angular_velocities_[i - 1] = angle_axis_diff.axis() *
                                  angle_axis_diff.angle() /
                                  this->duration(i - 1);
@@ -122,16 +130,55 @@ double PiecewiseQuaternionSlerp<T>::ComputeInterpTime(int segment_index,
 }
 
 template <typename T>
-Quaternion<T> PiecewiseQuaternionSlerp<T>::orientation(double t) const {
-  int segment_index = this->get_segment_index(t);
-  t = ComputeInterpTime(segment_index, t);
+Quaternion<T> PiecewiseQuaternionSlerp<T>::InterpolateOrientation(
+    int segment_index, double t) const {
+  const double interp = ComputeInterpTime(segment_index, t);
+  // Slerp along the segment's precomputed relative rotation:
+  // q(t) = quat(interp * angle, axis) * q_i. The delta quaternion is
+  // assembled directly from one sin/cos pair; as the product of two unit
+  // quaternions the result is normalized by construction.
+  using std::cos;
+  using std::sin;
+  const T half_angle = 0.5 * interp * segment_angles_[segment_index];
+  const Vector3<T>& axis = segment_axes_[segment_index];
+  const T s = sin(half_angle);
+  const Quaternion<T> q_delta(cos(half_angle), s * axis.x(), s * axis.y(),
+                              s * axis.z());
+  return q_delta * quaternions_[segment_index];
+}
 
-  Quaternion<T> q1 = quaternions_.at(segment_index)
-                              .slerp(t, quaternions_.at(segment_index + 1));
+template <typename T>
+Quaternion<T> PiecewiseQuaternionSlerp<T>::orientation(double t) const {
+  return InterpolateOrientation(this->get_segment_index(t), t);
+}
 
-  q1.normalize();
+template <typename T>
+Quaternion<T> PiecewiseQuaternionSlerp<T>::orientation(
+    double t, int* segment_index_hint) const {
+  DRAKE_DEMAND(segment_index_hint != nullptr);
+  const int segment_index = this->get_segment_index(t, *segment_index_hint);
+  *segment_index_hint = segment_index;
+  return InterpolateOrientation(segment_index, t);
+}
 
-  return q1;
+template <typename T>
+void PiecewiseQuaternionSlerp<T>::BatchOrientation(
+    const std::vector<double>& times,
+    std::vector<Quaternion<T>>* values) const {
+  DRAKE_DEMAND(values != nullptr);
+  if (values->size() != times.size()) {
+    throw std::runtime_error(
+        "BatchOrientation: values must be preallocated to times.size().");
+  }
+  int segment_index = 0;
+  for (size_t k = 0; k < times.size(); ++k) {
+    if (k > 0 && times[k] < times[k - 1]) {
+      throw std::runtime_error(
+          "BatchOrientation: times must be monotonically non-decreasing.");
+    }
+    segment_index = this->get_segment_index(times[k], segment_index);
+    (*values)[k] = InterpolateOrientation(segment_index, times[k]);
+  }
 }
 
 template <typename T>
@@ -81,6 +81,32 @@ class PiecewiseQuaternionSlerp final : public PiecewiseTrajectory<T> {
    */
   Quaternion<T> orientation(double t) const;
 
+  /**
+   * Variant of orientation() for sequential access patterns. The segment
+   * containing `t` is located starting from `*segment_index_hint` (checking
+   * the hinted segment and its neighbors before falling back to a binary
+   * search), and `*segment_index_hint` is updated to the segment that was
+   * used so that the next call can start from it.
+   * @param t Time for interpolation.
+   * @param segment_index_hint On entry, the segment index to try first; on
+   * return, the index of the segment containing `t`. Must not be null.
+   * @return The interpolated quaternion at `t`.
+   */
+  Quaternion<T> orientation(double t, int* segment_index_hint) const;
+
+  /**
+   * Evaluates the orientation at each time in @p times, walking the segments
+   * once rather than performing an independent segment lookup per sample.
+   * @param times Sample times; must be monotonically non-decreasing.
+   * @param values Preallocated output; must have exactly `times.size()`
+   * entries. Entry `k` is set to the interpolated quaternion at `times[k]`.
+   * Must not be null.
+   * @throws std::runtime_error if @p times is not monotonically
+   * non-decreasing, or if @p values has the wrong size.
+   */
+  void BatchOrientation(const std::vector<double>& times,
+                        std::vector<Quaternion<T>>* values) const;
+
   MatrixX<T> value(double t) const override { return orientation(t).matrix(); }
 
   /**
@@ -133,14 +159,23 @@ class PiecewiseQuaternionSlerp final : public PiecewiseTrajectory<T> {
       const std::vector<double>& breaks,
       const std::vector<Quaternion<T>>& quaternions);
 
-  // Computes angular velocity for each segment.
+  // Computes angular velocity and the relative rotation axis / angle tables
+  // for each segment.
   void ComputeAngularVelocities();
 
   // Computes the interpolation time within each segment. Result is in [0, 1].
   double ComputeInterpTime(int segment_index, double time) const;
 
+  // Interpolates within the given segment using the precomputed axis / angle
+  // tables.
+  Quaternion<T> InterpolateOrientation(int segment_index, double t) const;
+
   std::vector<Quaternion<T>> quaternions_;
   std::vector<Vector3<T>> angular_velocities_;
+  // Axis and angle of the relative rotation q[i+1] * q[i]^-1 per segment,
+  // precomputed at construction so orientation() avoids re-deriving them.
+  std::vector<Vector3<T>> segment_axes_;
+  std::vector<T> segment_angles_;
 };
 
 }  // namespace trajectories
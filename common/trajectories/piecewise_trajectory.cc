@@ -78,14 +78,63 @@ int PiecewiseTrajectory<T>::GetSegmentIndexRecursive(double time, int start,
     return mid;
 }
 
+template <typename T>
+void PiecewiseTrajectory<T>::CheckUniformSegmentTimes() const {
+  uniformity_checked_ = true;
+  uniform_duration_ = nullopt;
+  if (get_number_of_segments() < 1) return;
+  const double duration0 = breaks_[1] - breaks_[0];
+  for (int i = 1; i < get_number_of_segments(); ++i) {
+    if (std::abs(breaks_[i + 1] - breaks_[i] - duration0) > kEpsilonTime) {
+      return;
+    }
+  }
+  uniform_duration_ = duration0;
+}
+
 template <typename T>
 int PiecewiseTrajectory<T>::get_segment_index(double t) const {
   if (breaks_.empty()) return 0;
   // clip to min/max times
   t = std::min(std::max(t, start_time()), end_time());
+  if (!uniformity_checked_) CheckUniformSegmentTimes();
+  if (uniform_duration_) {
+    // Uniform spacing: locate the segment by division. The division result
+    // may land one segment off near a break (rounding, or spacing that is
+    // only uniform to within kEpsilonTime), so walk to the exact segment.
+    const int num_segments = get_number_of_segments();
+    int index = static_cast<int>((t - breaks_[0]) / *uniform_duration_);
+    index = std::min(std::max(index, 0), num_segments - 1);
+    while (index > 0 && t < breaks_[index]) --index;
+    while (index < num_segments - 1 && t >= breaks_[index + 1]) ++index;
+    return index;
+  }
   return GetSegmentIndexRecursive(t, 0, static_cast<int>(breaks_.size() - 1));
 }
 
+template <typename T>
+int PiecewiseTrajectory<T>::get_segment_index(
+    double t, int previous_segment_index) const {
+  if (breaks_.empty()) return 0;
+  t = std::min(std::max(t, start_time()), end_time());
+  const int num_segments = get_number_of_segments();
+  if (previous_segment_index >= 0 && previous_segment_index < num_segments) {
+    // Check the previous segment and its immediate neighbors; sequential
+    // sampling almost always lands in one of them.
+    const int candidates[] = {previous_segment_index,
+                              previous_segment_index + 1,
+                              previous_segment_index - 1};
+    for (int index : candidates) {
+      if (index < 0 || index >= num_segments) continue;
+      const bool below_upper_break =
+          (index == num_segments - 1) ? t <= breaks_[index + 1]
+                                      : t < breaks_[index + 1];
+      if (t >= breaks_[index] && below_upper_break) return index;
+    }
+  }
+  return get_segment_index(t);
+}
+
 template <typename T>
 const std::vector<double>& PiecewiseTrajectory<T>::get_segment_times() const {
   return breaks_;
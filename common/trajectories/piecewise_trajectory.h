@@ -6,6 +6,7 @@
 
 #include <Eigen/Core>
 
+#include "drake/common/drake_optional.h"
 #include "drake/common/trajectories/trajectory.h"
 
 namespace drake {
@@ -47,6 +48,15 @@ class PiecewiseTrajectory : public Trajectory<T> {
 
   int get_segment_index(double t) const;
 
+  /**
+   * Variant of get_segment_index() for sequential access patterns: checks
+   * @p previous_segment_index (typically the result of an earlier lookup)
+   * and its immediate neighbors before falling back to the general lookup,
+   * so sampling the trajectory at monotonically advancing times costs O(1)
+   * per query. An out-of-range @p previous_segment_index is ignored.
+   */
+  int get_segment_index(double t, int previous_segment_index) const;
+
   const std::vector<double>& get_segment_times() const;
 
   void segment_number_range_check(int segment_number) const;
@@ -67,12 +77,27 @@ class PiecewiseTrajectory : public Trajectory<T> {
                          double tol = kEpsilonTime) const;
 
   const std::vector<double>& breaks() const { return breaks_; }
-  std::vector<double>& get_mutable_breaks() { return breaks_; }
+  std::vector<double>& get_mutable_breaks() {
+    // The caller may change the break spacing, so the uniformity cache must
+    // be recomputed on the next lookup.
+    uniformity_checked_ = false;
+    return breaks_;
+  }
 
  private:
   int GetSegmentIndexRecursive(double time, int start, int end) const;
 
+  // Determines whether the breaks are uniformly spaced (to within
+  // kEpsilonTime), enabling get_segment_index() to locate a segment by
+  // division instead of binary search.
+  void CheckUniformSegmentTimes() const;
+
   std::vector<double> breaks_;
+
+  // Lazily computed by CheckUniformSegmentTimes(); holds the common segment
+  // duration iff the breaks are uniformly spaced.
+  mutable optional<double> uniform_duration_;
+  mutable bool uniformity_checked_{false};
 };
 
 }  // namespace trajectories
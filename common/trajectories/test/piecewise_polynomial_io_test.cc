@@ -0,0 +1,108 @@
+#include "drake/common/trajectories/piecewise_polynomial_io.h"
+
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/trajectories/test/random_piecewise_polynomial.h"
+
+using std::default_random_engine;
+using std::runtime_error;
+using std::vector;
+
+namespace drake {
+namespace trajectories {
+namespace {
+
+PiecewisePolynomial<double> MakeTestTrajectory(int rows, int num_segments) {
+  default_random_engine generator(123);
+  const vector<double> segment_times =
+      PiecewiseTrajectory<double>::RandomSegmentTimes(num_segments, generator);
+  return test::MakeRandomPiecewisePolynomial<double>(rows, 1, 4,
+                                                     segment_times);
+}
+
+// A write/read round trip through a stream preserves the trajectory.
+GTEST_TEST(PiecewisePolynomialIoTest, StreamRoundTrip) {
+  const PiecewisePolynomial<double> original = MakeTestTrajectory(3, 10);
+
+  std::stringstream stream;
+  WritePiecewisePolynomial(original, &stream);
+  const PiecewisePolynomial<double> read_back =
+      ReadPiecewisePolynomial(&stream);
+
+  EXPECT_TRUE(original.isApprox(read_back, 1e-15));
+}
+
+// A round trip through a file preserves the trajectory, and the lazy reader
+// evaluates it without materializing.
+GTEST_TEST(PiecewisePolynomialIoTest, FileRoundTripAndLazyEvaluation) {
+  const PiecewisePolynomial<double> original = MakeTestTrajectory(2, 20);
+  const std::string filename =
+      temp_directory() + "/piecewise_polynomial_io_test.bin";
+  WritePiecewisePolynomial(original, filename);
+
+  const PiecewisePolynomial<double> read_back =
+      ReadPiecewisePolynomial(filename);
+  EXPECT_TRUE(original.isApprox(read_back, 1e-15));
+
+  const LazyPiecewisePolynomial lazy(filename);
+  EXPECT_EQ(lazy.rows(), original.rows());
+  EXPECT_EQ(lazy.cols(), original.cols());
+  EXPECT_EQ(lazy.start_time(), original.start_time());
+  EXPECT_EQ(lazy.end_time(), original.end_time());
+  EXPECT_EQ(lazy.get_number_of_segments(), original.get_number_of_segments());
+
+  // Sample forward, backward, and outside the time range.
+  for (double t = original.start_time() - 0.1; t <= original.end_time() + 0.1;
+       t += 0.01) {
+    EXPECT_TRUE(CompareMatrices(lazy.value(t), original.value(t), 1e-15,
+                                MatrixCompareType::absolute));
+  }
+  for (double t = original.end_time(); t >= original.start_time(); t -= 0.3) {
+    EXPECT_TRUE(CompareMatrices(lazy.value(t), original.value(t), 1e-15,
+                                MatrixCompareType::absolute));
+  }
+
+  // Clone reads the same file; MakeDerivative materializes.
+  const auto clone = lazy.Clone();
+  const double t_mid = 0.5 * (original.start_time() + original.end_time());
+  EXPECT_TRUE(CompareMatrices(clone->value(t_mid), original.value(t_mid),
+                              1e-15, MatrixCompareType::absolute));
+  const auto derivative = lazy.MakeDerivative();
+  EXPECT_TRUE(CompareMatrices(derivative->value(t_mid),
+                              original.derivative().value(t_mid), 1e-15,
+                              MatrixCompareType::absolute));
+}
+
+// Invalid inputs are rejected with an informative error.
+GTEST_TEST(PiecewisePolynomialIoTest, InvalidInput) {
+  // An empty trajectory cannot be written.
+  std::stringstream stream;
+  EXPECT_THROW(WritePiecewisePolynomial(PiecewisePolynomial<double>(), &stream),
+               runtime_error);
+
+  // Garbage data cannot be read.
+  std::stringstream garbage("this is not a trajectory file");
+  EXPECT_THROW(ReadPiecewisePolynomial(&garbage), runtime_error);
+
+  // A truncated file cannot be read.
+  const PiecewisePolynomial<double> original = MakeTestTrajectory(2, 5);
+  std::stringstream full_stream;
+  WritePiecewisePolynomial(original, &full_stream);
+  std::stringstream truncated(full_stream.str().substr(
+      0, full_stream.str().size() / 2));
+  EXPECT_THROW(ReadPiecewisePolynomial(&truncated), runtime_error);
+
+  // Missing files are reported by name.
+  EXPECT_THROW(ReadPiecewisePolynomial("/no/such/file.bin"), runtime_error);
+  EXPECT_THROW(LazyPiecewisePolynomial("/no/such/file.bin"), runtime_error);
+}
+
+}  // namespace
+}  // namespace trajectories
+}  // namespace drake
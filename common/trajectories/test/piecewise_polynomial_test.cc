@@ -203,6 +203,70 @@ void testValueOutsideOfRange() {
                               1e-10, MatrixCompareType::absolute));
 }
 
+// Tests that the hinted value() overload and BatchValue() agree with plain
+// value() for both uniform and non-uniform break spacing.
+GTEST_TEST(testPiecewisePolynomial, SequentialAndBatchValueTest) {
+  default_random_engine generator;
+  const vector<double> non_uniform_times =
+      PiecewiseTrajectory<double>::RandomSegmentTimes(20, generator);
+  vector<double> uniform_times;
+  for (int i = 0; i <= 20; ++i) {
+    uniform_times.push_back(0.25 * i);
+  }
+
+  for (const vector<double>& segment_times :
+       {uniform_times, non_uniform_times}) {
+    const PiecewisePolynomial<double> piecewise =
+        test::MakeRandomPiecewisePolynomial<double>(3, 1, 4, segment_times);
+
+    // Sequentially sample (including slightly outside the time range); the
+    // hinted overload must match the plain one.
+    vector<double> sample_times;
+    int segment_index_hint = 0;
+    for (double t = piecewise.start_time() - 0.1;
+         t <= piecewise.end_time() + 0.1; t += 0.01) {
+      sample_times.push_back(t);
+      EXPECT_TRUE(CompareMatrices(piecewise.value(t, &segment_index_hint),
+                                  piecewise.value(t), 1e-10,
+                                  MatrixCompareType::absolute));
+    }
+
+    // An out-of-range hint falls back to the general lookup.
+    segment_index_hint = 1000;
+    EXPECT_TRUE(CompareMatrices(
+        piecewise.value(piecewise.start_time(), &segment_index_hint),
+        piecewise.value(piecewise.start_time()), 1e-10,
+        MatrixCompareType::absolute));
+    EXPECT_EQ(segment_index_hint, 0);
+
+    // BatchValue fills one column per sample time.
+    const Eigen::Map<const Eigen::VectorXd> times(sample_times.data(),
+                                                  sample_times.size());
+    Eigen::MatrixXd values(piecewise.rows(), times.size());
+    piecewise.BatchValue(times, &values);
+    for (int k = 0; k < times.size(); ++k) {
+      EXPECT_TRUE(CompareMatrices(values.col(k), piecewise.value(times[k]),
+                                  1e-10, MatrixCompareType::absolute));
+    }
+
+    // Unsorted times and wrongly sized outputs are rejected.
+    Eigen::Vector2d unsorted(piecewise.end_time(), piecewise.start_time());
+    Eigen::MatrixXd unsorted_values(piecewise.rows(), 2);
+    EXPECT_THROW(piecewise.BatchValue(unsorted, &unsorted_values),
+                 runtime_error);
+    Eigen::MatrixXd wrong_size(piecewise.rows() + 1, times.size());
+    EXPECT_THROW(piecewise.BatchValue(times, &wrong_size), runtime_error);
+
+    // EvalValue() writes the same result in place.
+    Eigen::MatrixXd in_place(piecewise.rows(), piecewise.cols());
+    for (const double t : sample_times) {
+      piecewise.EvalValue(t, &in_place);
+      EXPECT_TRUE(CompareMatrices(in_place, piecewise.value(t), 1e-10,
+                                  MatrixCompareType::absolute));
+    }
+  }
+}
+
 // Test the generation of cubic splines with first and second derivatives
 // continuous between the end of the last segment and the beginning of the
 // first.
@@ -169,6 +169,60 @@ GTEST_TEST(TestPiecewiseQuaternionSlerp,
       MatrixCompareType::absolute));
 }
 
+// Tests that the segment-hint overload of orientation() and
+// BatchOrientation() agree with the plain orientation() evaluation.
+GTEST_TEST(TestPiecewiseQuaternionSlerp, TestHintAndBatchOrientation) {
+  std::default_random_engine generator(456);
+  int N = 100;
+  std::vector<double> time =
+      PiecewiseTrajectory<double>::RandomSegmentTimes(N - 1, generator);
+  std::vector<Quaternion<double>> quat =
+      GenerateRandomQuaternions<double>(N, &generator);
+
+  PiecewiseQuaternionSlerp<double> rot_spline(time, quat);
+
+  std::vector<double> sample_times;
+  for (double t = time.front(); t < time.back(); t += 0.01) {
+    sample_times.push_back(t);
+  }
+
+  // Sequential evaluation with a reused hint matches plain evaluation, and
+  // the hint tracks the containing segment.
+  int hint = 0;
+  for (double t : sample_times) {
+    EXPECT_TRUE(CompareMatrices(rot_spline.orientation(t, &hint).coeffs(),
+                                rot_spline.orientation(t).coeffs(), 1e-12,
+                                MatrixCompareType::absolute));
+    EXPECT_EQ(hint, rot_spline.get_segment_index(t));
+  }
+
+  // A stale hint is still handled correctly.
+  hint = rot_spline.get_number_of_segments() - 1;
+  EXPECT_TRUE(CompareMatrices(
+      rot_spline.orientation(sample_times.front(), &hint).coeffs(),
+      rot_spline.orientation(sample_times.front()).coeffs(), 1e-12,
+      MatrixCompareType::absolute));
+  EXPECT_EQ(hint, 0);
+
+  // Batch evaluation matches plain evaluation.
+  std::vector<Quaternion<double>> batch(sample_times.size());
+  rot_spline.BatchOrientation(sample_times, &batch);
+  for (size_t i = 0; i < sample_times.size(); ++i) {
+    EXPECT_TRUE(CompareMatrices(batch[i].coeffs(),
+                                rot_spline.orientation(sample_times[i]).coeffs(),
+                                1e-12, MatrixCompareType::absolute));
+  }
+
+  // Wrong output size and non-monotonic times throw.
+  std::vector<Quaternion<double>> wrong_size(sample_times.size() + 1);
+  EXPECT_THROW(rot_spline.BatchOrientation(sample_times, &wrong_size),
+               std::runtime_error);
+  std::vector<double> unsorted_times = {time.front() + 0.2, time.front() + 0.1};
+  std::vector<Quaternion<double>> unsorted_values(unsorted_times.size());
+  EXPECT_THROW(rot_spline.BatchOrientation(unsorted_times, &unsorted_values),
+               std::runtime_error);
+}
+
 GTEST_TEST(TestPiecewiseQuaternionSlerp, TestIsApprox) {
   std::vector<double> time = {0, 1.6};
   std::vector<double> ang = {-1.3, 1};
@@ -102,6 +102,46 @@ GTEST_TEST(PiecewiseTrajectoryTest, GetIndexTest) {
   TestPiecewiseTrajectoryTimeRelatedGetters(traj, time);
 }
 
+// Uniformly spaced breaks take the divide-instead-of-search path in
+// get_segment_index; the results must be identical.
+GTEST_TEST(PiecewiseTrajectoryTest, UniformGetIndexTest) {
+  std::vector<double> time;
+  for (int i = 0; i <= 10; i++) {
+    time.push_back(-1 + 0.5 * i);
+  }
+
+  PiecewiseTrajectoryTester traj(time);
+
+  TestPiecewiseTrajectoryTimeRelatedGetters(traj, time);
+}
+
+GTEST_TEST(PiecewiseTrajectoryTest, GetIndexWithHintTest) {
+  const std::vector<std::vector<double>> times = {
+      {0, 1, 2, 3.5}, {0, 0.5, 1, 1.5, 2, 2.5}};
+
+  for (const std::vector<double>& time : times) {
+    PiecewiseTrajectoryTester traj(time);
+
+    // Sequential sampling: the hinted lookup must agree with the plain one
+    // everywhere, including at and just below the breaks.
+    int hint = 0;
+    for (double t = time.front() - 0.1; t < time.back() + 0.1; t += 0.003) {
+      hint = traj.get_segment_index(t, hint);
+      EXPECT_EQ(hint, traj.get_segment_index(t));
+    }
+    for (size_t i = 1; i < time.size(); i++) {
+      hint = traj.get_segment_index(time[i] - 1e-10, hint);
+      EXPECT_EQ(hint, traj.get_segment_index(time[i] - 1e-10));
+      hint = traj.get_segment_index(time[i], hint);
+      EXPECT_EQ(hint, traj.get_segment_index(time[i]));
+    }
+
+    // Out-of-range hints are ignored.
+    EXPECT_EQ(traj.get_segment_index(1.25, -5), traj.get_segment_index(1.25));
+    EXPECT_EQ(traj.get_segment_index(1.25, 100), traj.get_segment_index(1.25));
+  }
+}
+
 }  // namespace
 }  // namespace trajectories
 }  // namespace drake
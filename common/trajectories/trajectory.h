@@ -4,6 +4,7 @@
 
 #include <Eigen/Core>
 
+#include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 
@@ -33,6 +34,21 @@ class Trajectory {
    */
   virtual MatrixX<T> value(double t) const = 0;
 
+  /**
+   * Evaluates the trajectory at the given time \p t, writing the result into
+   * the preallocated matrix \p value (which must already have rows() x cols()
+   * shape). The base implementation simply delegates to value(); subclasses
+   * may override it to evaluate in place, avoiding the temporary that
+   * value() returns. Useful in inner loops (e.g. per-step trajectory
+   * sources) where the heap traffic of value() is measurable.
+   * @param t The time at which to evaluate the trajectory.
+   * @param value The preallocated output; must not be null.
+   */
+  virtual void EvalValue(double t, EigenPtr<MatrixX<T>> value) const {
+    DRAKE_DEMAND(value != nullptr);
+    *value = this->value(t);
+  }
+
   /**
    * Takes the derivative of this Trajectory.
    * @param derivative_order The number of times to take the derivative before
@@ -43,6 +43,10 @@ struct ValueTraitsImpl<T, true> {
   static const T& access(const Storage& storage) { return storage; }
   // NOLINTNEXTLINE(runtime/references)
   static T& access(Storage& storage) { return storage; }
+  static void move_storage(Storage* to, Storage* from) {
+    // For copyable-but-not-movable T this quietly degrades to a copy.
+    *to = std::move(*from);
+  }
 };
 
 // For non-copyable types, we store a copyable_unique_ptr<T> so that Value<T>'s
@@ -77,6 +81,11 @@ struct ValueTraitsImpl<T, false> {
   static const T& access(const Storage& storage) { return *storage; }
   // NOLINTNEXTLINE(runtime/references)
   static T& access(Storage& storage) { return *storage; }
+  static void move_storage(Storage* to, Storage* from) {
+    // Swap rather than move so that `from` keeps a valid (though
+    // unspecified) value object instead of becoming empty.
+    std::swap(*to, *from);
+  }
 };
 
 template <typename T>
@@ -117,6 +126,21 @@ class AbstractValue {
   /// Release builds.
   virtual void SetFromOrThrow(const AbstractValue& other) = 0;
 
+  /// Moves the value in @p other to this value when the two concrete types
+  /// match, avoiding any copy or clone. After this call @p other still
+  /// contains a valid value object of its original concrete type, but with
+  /// unspecified contents. On mismatched types this falls back to the copying
+  /// SetFrom() above, including its Debug-build-only type checking.
+  virtual void SetFrom(AbstractValue&& other) {
+    SetFrom(static_cast<const AbstractValue&>(other));
+  }
+
+  /// Like the move-aware SetFrom, but throws std::logic_error on mismatched
+  /// types even in Release builds.
+  virtual void SetFromOrThrow(AbstractValue&& other) {
+    SetFromOrThrow(static_cast<const AbstractValue&>(other));
+  }
+
   /// Returns typeid of the contained object of type T. If T is polymorphic,
   /// this returns the typeid of the most-derived type of the contained object.
   virtual const std::type_info& type_info() const = 0;
@@ -250,6 +274,10 @@ class AbstractValue {
 /// A container class for an arbitrary type T. User-defined classes that
 /// require additional type-erased features should subclass Value<T>, taking
 /// care to define the copy constructors and override Clone().
+///
+/// Copy-constructible types are stored directly within the %Value<T> object,
+/// with no separate heap allocation; only clone-only types are stored behind
+/// an owned pointer.
 /// @tparam T Must be copy-constructible or cloneable.
 template <typename T>
 class Value : public AbstractValue {
@@ -353,6 +381,24 @@ class Value : public AbstractValue {
     value_ = Traits::to_storage(other.GetValueOrThrow<T>());
   }
 
+  void SetFrom(AbstractValue&& other) override {
+    Value<T>* const typed = dynamic_cast<Value<T>*>(&other);
+    if (typed != nullptr) {
+      Traits::move_storage(&value_, &typed->value_);
+    } else {
+      SetFrom(static_cast<const AbstractValue&>(other));
+    }
+  }
+
+  void SetFromOrThrow(AbstractValue&& other) override {
+    Value<T>* const typed = dynamic_cast<Value<T>*>(&other);
+    if (typed != nullptr) {
+      Traits::move_storage(&value_, &typed->value_);
+    } else {
+      SetFromOrThrow(static_cast<const AbstractValue&>(other));
+    }
+  }
+
   const std::type_info& static_type_info() const final {
     return typeid(T);
   }
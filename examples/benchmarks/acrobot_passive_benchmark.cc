@@ -0,0 +1,68 @@
+/// @file
+///
+/// Benchmarks a passive acrobot swing for a fixed simulated horizon and
+/// reports throughput statistics in machine-readable form.  No visualization
+/// or LCM traffic is involved; this measures the plant dynamics and the
+/// integrator only.
+
+#include <chrono>
+
+#include <gflags/gflags.h>
+
+#include "drake/examples/acrobot/acrobot_plant.h"
+#include "drake/examples/acrobot/gen/acrobot_state.h"
+#include "drake/examples/benchmarks/simulation_statistics.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/diagram.h"
+#include "drake/systems/framework/diagram_builder.h"
+
+namespace drake {
+namespace examples {
+namespace benchmarks {
+namespace {
+
+DEFINE_double(simulation_sec, 10.0, "Number of seconds to simulate.");
+
+int DoMain() {
+  systems::DiagramBuilder<double> builder;
+  auto acrobot = builder.AddSystem<acrobot::AcrobotPlant>();
+  acrobot->set_name("acrobot");
+  auto diagram = builder.Build();
+
+  systems::Simulator<double> simulator(*diagram);
+  systems::Context<double>& acrobot_context =
+      diagram->GetMutableSubsystemContext(*acrobot,
+                                          &simulator.get_mutable_context());
+  acrobot_context.FixInputPort(0, Eigen::Matrix<double, 1, 1>::Zero());
+
+  // The same initial condition as examples/acrobot/run_passive.cc:
+  // sufficiently far from the downright fixed point to keep swinging.
+  acrobot::AcrobotState<double>* x0 =
+      dynamic_cast<acrobot::AcrobotState<double>*>(
+          &acrobot_context.get_mutable_continuous_state_vector());
+  DRAKE_DEMAND(x0 != nullptr);
+  x0->set_theta1(1.0);
+  x0->set_theta2(1.0);
+  x0->set_theta1dot(0.0);
+  x0->set_theta2dot(0.0);
+
+  simulator.Initialize();
+  const auto start = std::chrono::steady_clock::now();
+  simulator.StepTo(FLAGS_simulation_sec);
+  const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  PrintSimulationStatistics("acrobot_passive", simulator, FLAGS_simulation_sec,
+                            elapsed.count());
+  return 0;
+}
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace examples
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::examples::benchmarks::DoMain();
+}
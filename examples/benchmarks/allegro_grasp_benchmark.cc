@@ -0,0 +1,114 @@
+/// @file
+///
+/// Benchmarks a discretized MultibodyPlant model of the Allegro hand closing
+/// under a small constant load on every joint.  This mirrors
+/// examples/allegro_hand/run_allegro_constant_load_demo.cc minus the
+/// visualization plumbing, so the time is spent in the plant's discrete
+/// update and the SceneGraph contact queries.
+
+#include <chrono>
+#include <memory>
+#include <utility>
+
+#include <gflags/gflags.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/examples/benchmarks/simulation_statistics.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/uniform_gravity_field_element.h"
+#include "drake/multibody/tree/weld_joint.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/diagram.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/primitives/constant_vector_source.h"
+
+namespace drake {
+namespace examples {
+namespace benchmarks {
+namespace {
+
+using multibody::MultibodyPlant;
+
+DEFINE_double(simulation_sec, 1.0, "Number of seconds to simulate.");
+DEFINE_double(constant_load, 0.01,
+              "The constant load on each joint, unit [Nm].");
+DEFINE_double(max_time_step, 1.0e-4,
+              "Simulation time step used for the discretized plant.");
+
+int DoMain() {
+  systems::DiagramBuilder<double> builder;
+
+  geometry::SceneGraph<double>& scene_graph =
+      *builder.AddSystem<geometry::SceneGraph>();
+  scene_graph.set_name("scene_graph");
+
+  MultibodyPlant<double>& plant =
+      *builder.AddSystem<MultibodyPlant>(FLAGS_max_time_step);
+  plant.RegisterAsSourceForSceneGraph(&scene_graph);
+  const std::string full_name = FindResourceOrThrow(
+      "drake/manipulation/models/allegro_hand_description/sdf/"
+      "allegro_hand_description_right.sdf");
+  multibody::Parser(&plant).AddModelFromFile(full_name);
+
+  // Weld the hand to the world frame.
+  const auto& joint_hand_root = plant.GetBodyByName("hand_root");
+  plant.AddJoint<multibody::WeldJoint>("weld_hand", plant.world_body(), {},
+      joint_hand_root, {}, Isometry3<double>::Identity());
+  plant.AddForceElement<multibody::UniformGravityFieldElement>();
+  plant.Finalize();
+
+  DRAKE_DEMAND(plant.num_actuators() == 16);
+
+  auto& constant_source =
+      *builder.AddSystem<systems::ConstantVectorSource<double>>(
+          VectorX<double>::Ones(plant.num_actuators()) * FLAGS_constant_load);
+  constant_source.set_name("constant_source");
+  builder.Connect(constant_source.get_output_port(),
+                  plant.get_actuation_input_port());
+
+  DRAKE_DEMAND(!!plant.get_source_id());
+  builder.Connect(
+      plant.get_geometry_poses_output_port(),
+      scene_graph.get_source_pose_port(plant.get_source_id().value()));
+  builder.Connect(scene_graph.get_query_output_port(),
+                  plant.get_geometry_query_input_port());
+
+  std::unique_ptr<systems::Diagram<double>> diagram = builder.Build();
+
+  std::unique_ptr<systems::Context<double>> diagram_context =
+      diagram->CreateDefaultContext();
+  systems::Context<double>& plant_context =
+      diagram->GetMutableSubsystemContext(plant, diagram_context.get());
+
+  // The same arbitrary initial finger bend as the constant-load demo.
+  plant.GetJointByName<multibody::RevoluteJoint>("joint_1")
+      .set_angle(&plant_context, 0.5);
+  plant.GetJointByName<multibody::RevoluteJoint>("joint_6")
+      .set_angle(&plant_context, -0.1);
+  plant.GetJointByName<multibody::RevoluteJoint>("joint_11")
+      .set_angle(&plant_context, 0.5);
+
+  systems::Simulator<double> simulator(*diagram, std::move(diagram_context));
+  simulator.Initialize();
+  const auto start = std::chrono::steady_clock::now();
+  simulator.StepTo(FLAGS_simulation_sec);
+  const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  PrintSimulationStatistics("allegro_grasp", simulator, FLAGS_simulation_sec,
+                            elapsed.count());
+  return 0;
+}
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace examples
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::examples::benchmarks::DoMain();
+}
@@ -0,0 +1,78 @@
+/// @file
+///
+/// Benchmarks the automotive onramp-merge scenario with IDM-controlled
+/// railcars.  LCM traffic goes to a mock interface, so this measures the
+/// AutomotiveSimulator diagram itself: the vehicle dynamics, the IDM
+/// planners, and the exhaustive road-position searches they perform.
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <gflags/gflags.h>
+
+#include "drake/automotive/automotive_simulator.h"
+#include "drake/automotive/gen/maliput_railcar_params.h"
+#include "drake/automotive/gen/maliput_railcar_state.h"
+#include "drake/automotive/lane_direction.h"
+#include "drake/automotive/multilane_onramp_merge.h"
+#include "drake/examples/benchmarks/simulation_statistics.h"
+#include "drake/lcm/drake_mock_lcm.h"
+
+namespace drake {
+namespace examples {
+namespace benchmarks {
+namespace {
+
+DEFINE_double(simulation_sec, 10.0, "Number of seconds to simulate.");
+DEFINE_int32(num_cars, 4, "The number of IDM-controlled railcars to add.");
+DEFINE_double(base_speed, 25.0, "The initial speed of each railcar [m/s].");
+
+int DoMain() {
+  auto simulator = std::make_unique<automotive::AutomotiveSimulator<double>>(
+      std::make_unique<lcm::DrakeMockLcm>());
+  simulator->SetRoadGeometry(
+      automotive::MultilaneOnrampMerge().BuildOnramp());
+
+  // Alternate cars between the onramp and the main road, spaced back from the
+  // merge point, as in automotive_demo's onramp scenario.
+  const double kRowSpacing = 15.;
+  for (int i = 0; i < FLAGS_num_cars; ++i) {
+    const std::string lane_name =
+        (i % 2 == 0) ? "l:onramp0_0" : "l:pre0_0";
+    const automotive::LaneDirection lane_direction(
+        simulator->FindLane(lane_name), false /* with_s */);
+    automotive::MaliputRailcarParams<double> params;
+    params.set_r(0);
+    params.set_h(0);
+    automotive::MaliputRailcarState<double> state;
+    state.set_speed(FLAGS_base_speed);
+    state.set_s(lane_direction.lane->length() - kRowSpacing * (i / 2));
+    DRAKE_DEMAND(state.s() > 0.);
+    simulator->AddIdmControlledPriusMaliputRailcar(
+        "IdmControlledMaliputRailcar" + std::to_string(i), lane_direction,
+        automotive::ScanStrategy::kPath,
+        automotive::RoadPositionStrategy::kExhaustiveSearch,
+        0. /* time period (unused) */, params, state);
+  }
+
+  simulator->Start(0.0 /* target_realtime_rate */);
+  const auto start = std::chrono::steady_clock::now();
+  simulator->StepBy(FLAGS_simulation_sec);
+  const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  PrintSimulationStatistics("automotive_onramp", simulator->GetSimulator(),
+                            FLAGS_simulation_sec, elapsed.count());
+  return 0;
+}
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace examples
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::examples::benchmarks::DoMain();
+}
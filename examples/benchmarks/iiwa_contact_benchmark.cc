@@ -0,0 +1,77 @@
+/// @file
+///
+/// Benchmarks a RigidBodyPlant contact scenario: an unactuated IIWA arm
+/// collapses under gravity onto flat terrain, so the latter part of the
+/// horizon exercises the compliant contact model.  No visualization or LCM
+/// traffic is involved.
+
+#include <chrono>
+#include <memory>
+#include <utility>
+
+#include <gflags/gflags.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/examples/benchmarks/simulation_statistics.h"
+#include "drake/multibody/parsers/urdf_parser.h"
+#include "drake/multibody/rigid_body_plant/rigid_body_plant.h"
+#include "drake/multibody/rigid_body_tree_construction.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/diagram.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/primitives/constant_vector_source.h"
+
+namespace drake {
+namespace examples {
+namespace benchmarks {
+namespace {
+
+DEFINE_double(simulation_sec, 2.0, "Number of seconds to simulate.");
+
+const char kIiwaUrdf[] =
+    "drake/manipulation/models/iiwa_description/urdf/"
+    "iiwa14_polytope_collision.urdf";
+
+int DoMain() {
+  systems::DiagramBuilder<double> builder;
+
+  auto tree_ptr = std::make_unique<RigidBodyTree<double>>();
+  parsers::urdf::AddModelInstanceFromUrdfFile(
+      FindResourceOrThrow(kIiwaUrdf),
+      multibody::joints::kFixed, nullptr /* weld to frame */, tree_ptr.get());
+  multibody::AddFlatTerrainToWorld(tree_ptr.get(), 100., 10.);
+
+  auto& plant = *builder.AddSystem<systems::RigidBodyPlant<double>>(
+      std::move(tree_ptr));
+  plant.set_name("plant");
+
+  // No actuation: the arm falls freely and settles against the terrain.
+  auto& torque_source =
+      *builder.AddSystem<systems::ConstantVectorSource<double>>(
+          VectorX<double>::Zero(plant.get_num_actuators()));
+  torque_source.set_name("torque_source");
+  builder.Connect(torque_source.get_output_port(), plant.get_input_port(0));
+
+  auto diagram = builder.Build();
+
+  systems::Simulator<double> simulator(*diagram);
+  simulator.Initialize();
+  const auto start = std::chrono::steady_clock::now();
+  simulator.StepTo(FLAGS_simulation_sec);
+  const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  PrintSimulationStatistics("iiwa_contact", simulator, FLAGS_simulation_sec,
+                            elapsed.count());
+  return 0;
+}
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace examples
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  return drake::examples::benchmarks::DoMain();
+}
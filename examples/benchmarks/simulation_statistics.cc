@@ -0,0 +1,41 @@
+#include "drake/examples/benchmarks/simulation_statistics.h"
+
+#include <cstdint>
+#include <cstdio>
+
+#include <sys/resource.h>
+
+#include "drake/systems/analysis/integrator_base.h"
+
+namespace drake {
+namespace examples {
+namespace benchmarks {
+
+void PrintSimulationStatistics(const std::string& benchmark_name,
+                               const systems::Simulator<double>& simulator,
+                               double simulated_sec, double wall_clock_sec) {
+  const systems::IntegratorBase<double>* integrator =
+      simulator.get_integrator();
+  const int64_t derivative_evaluations =
+      integrator != nullptr ? integrator->get_num_derivative_evaluations() : 0;
+
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+
+  const char* name = benchmark_name.c_str();
+  std::printf("%s.simulated_sec=%.6f\n", name, simulated_sec);
+  std::printf("%s.wall_clock_sec=%.6f\n", name, wall_clock_sec);
+  std::printf("%s.real_time_factor=%.6f\n", name,
+              simulated_sec / wall_clock_sec);
+  std::printf("%s.steps_taken=%lld\n", name,
+              static_cast<long long>(simulator.get_num_steps_taken()));
+  std::printf("%s.derivative_evaluations=%lld\n", name,
+              static_cast<long long>(derivative_evaluations));
+  // On Linux ru_maxrss is reported in kibibytes.
+  std::printf("%s.peak_rss_kb=%lld\n", name,
+              static_cast<long long>(usage.ru_maxrss));
+}
+
+}  // namespace benchmarks
+}  // namespace examples
+}  // namespace drake
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+
+#include "drake/systems/analysis/simulator.h"
+
+namespace drake {
+namespace examples {
+namespace benchmarks {
+
+/// Prints the throughput statistics of a completed simulation run, one
+/// `<benchmark_name>.<metric>=<value>` line per metric on stdout, so that
+/// trend-tracking tools can scrape the output without parsing prose.
+///
+/// The metrics are:
+/// - `simulated_sec`: the simulated horizon, as supplied by the caller.
+/// - `wall_clock_sec`: the elapsed wall-clock time, as supplied by the caller.
+/// - `real_time_factor`: simulated_sec / wall_clock_sec.
+/// - `steps_taken`: Simulator::get_num_steps_taken().
+/// - `derivative_evaluations`: the integrator's
+///   get_num_derivative_evaluations() (zero for purely discrete systems).
+/// - `peak_rss_kb`: the process's peak resident set size, in kibibytes.
+void PrintSimulationStatistics(const std::string& benchmark_name,
+                               const systems::Simulator<double>& simulator,
+                               double simulated_sec, double wall_clock_sec);
+
+}  // namespace benchmarks
+}  // namespace examples
+}  // namespace drake
@@ -6,6 +6,7 @@
 #include <fmt/ostream.h>
 
 #include "drake/common/autodiff.h"
+#include "drake/common/drake_assert.h"
 #include "drake/common/symbolic.h"
 
 namespace drake {
@@ -34,6 +35,7 @@ FrameKinematicsVector<KinematicsValue>::FrameKinematicsVector(
 template <typename KinematicsValue>
 void FrameKinematicsVector<KinematicsValue>::clear() {
   ++version_;
+  aliased_values_ = nullptr;
 }
 
 template <typename KinematicsValue>
@@ -55,6 +57,49 @@ void FrameKinematicsVector<KinematicsValue>::set_value(
   values_[id].value = value;
 }
 
+template <typename KinematicsValue>
+void FrameKinematicsVector<KinematicsValue>::SetAliasedValues(
+    const std::vector<FrameId>& ids, const std::vector<int>& indices,
+    const KinematicsValue* values) {
+  using std::to_string;
+
+  DRAKE_DEMAND(values != nullptr);
+  if (ids.size() != indices.size()) {
+    throw std::runtime_error(fmt::format(
+        "Mismatched alias tables; {} frame ids but {} buffer indices.",
+        ids.size(), indices.size()));
+  }
+  // The common case re-submits the same tables every step; the per-id
+  // validation (and hashing) below only runs when the tables change.
+  if (ids != alias_ids_ || indices != alias_indices_) {
+    if (static_cast<int>(ids.size()) != size()) {
+      throw std::runtime_error(fmt::format(
+          "Disagreement in expected number of frames ({}) and the given "
+          "number of aliased frames ({}).",
+          size(), ids.size()));
+    }
+    ++version_;
+    for (size_t i = 0; i < ids.size(); ++i) {
+      auto it = values_.find(ids[i]);
+      if (it == values_.end()) {
+        throw std::runtime_error(
+            "Trying to alias a kinematics value for a frame id that does not "
+            "belong to the kinematics vector: " + to_string(ids[i]));
+      }
+      if (it->second.version == version_) {
+        throw std::runtime_error(
+            "Trying to alias kinematics values for the same id (" +
+            to_string(ids[i]) + ") multiple times.");
+      }
+      it->second.version = version_;
+      it->second.index = indices[i];
+    }
+    alias_ids_ = ids;
+    alias_indices_ = indices;
+  }
+  aliased_values_ = values;
+}
+
 template <typename KinematicsValue>
 const KinematicsValue& FrameKinematicsVector<KinematicsValue>::value(
     FrameId id) const {
@@ -63,6 +108,9 @@ const KinematicsValue& FrameKinematicsVector<KinematicsValue>::value(
     throw std::runtime_error("Can't acquire value for id " + to_string(id) +
                              ". It is not part of the kinematics data id set.");
   }
+  if (aliased_values_ != nullptr) {
+    return aliased_values_[values_.at(id).index];
+  }
   return values_.at(id).value;
 }
 
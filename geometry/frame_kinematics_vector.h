@@ -211,6 +211,28 @@ class FrameKinematicsVector {
    lead to a subsequent exception when SceneGraph consumes the data. */
   void set_value(FrameId id, const KinematicsValue& value);
 
+  /** Bulk, zero-copy alternative to the clear()/set_value() protocol.
+   Records an alias into the producer-owned `values` buffer: the value
+   reported for `ids[i]` becomes `values[indices[i]]`, with no per-frame
+   copy. This is intended for producers (e.g., MultibodyPlant) that already
+   own all of their kinematics values in one contiguous buffer and hand them
+   off every step.
+
+   `ids` must consist of exactly the frame ids provided at construction and
+   `indices` must have the same length as `ids`. The id/index tables are
+   validated on first use and recognized cheaply (no hashing) when the same
+   tables are re-submitted on subsequent calls.
+
+   The buffer must remain valid -- and its contents current -- for as long as
+   this vector may be read from; a subsequent clear(), assignment, or call to
+   this method releases the alias. Note that copies of this vector share the
+   alias.
+   @throws std::runtime_error if the tables don't match the construction
+                              id set.  */
+  void SetAliasedValues(const std::vector<FrameId>& ids,
+                        const std::vector<int>& indices,
+                        const KinematicsValue* values);
+
   SourceId source_id() const { return source_id_; }
 
   /** Returns the constructed size of this vector -- the number of FrameId
@@ -244,6 +266,9 @@ class FrameKinematicsVector {
     }
     int64_t version{0};
     KinematicsValue value;
+    // When values are aliased (see SetAliasedValues()), the index into the
+    // aliased buffer holding this frame's value; unused otherwise.
+    int index{-1};
   };
 
   // The source id for the geometry source reporting data in this vector
@@ -256,6 +281,16 @@ class FrameKinematicsVector {
   // The current version tag -- used to detect if values have been properly
   // updated.
   int64_t version_{0};
+
+  // When non-null, values are read from this producer-owned buffer (indexed
+  // through FlaggedValue::index) instead of from the map entries. See
+  // SetAliasedValues().
+  const KinematicsValue* aliased_values_{nullptr};
+
+  // The most recently validated alias tables; re-submission of identical
+  // tables skips the per-id validation.
+  std::vector<FrameId> alias_ids_;
+  std::vector<int> alias_indices_;
 };
 
 /** Class for communicating _pose_ information to SceneGraph for registered
@@ -113,6 +113,8 @@ GeometryState<T>::GeometryState()
   frame_index_to_id_map_.push_back(world);
   X_WF_.push_back(Isometry3<T>::Identity());
   X_PF_.push_back(Isometry3<T>::Identity());
+  // The world frame's world pose is trivially valid.
+  X_WF_valid_.push_back(true);
 
   source_frame_id_map_[self_source_] = {world};
   source_root_frame_map_[self_source_] = {world};
@@ -448,6 +450,7 @@ FrameId GeometryState<T>::RegisterFrame(SourceId source_id, FrameId parent_id,
   FrameIndex index(X_PF_.size());
   X_PF_.emplace_back(frame.pose());
   X_WF_.emplace_back(Isometry3<double>::Identity());
+  X_WF_valid_.push_back(false);
   frame_index_to_id_map_.push_back(frame_id);
   f_set.insert(frame_id);
   int clique = GeometryStateCollisionFilterAttorney::get_next_clique(
@@ -455,6 +458,8 @@ FrameId GeometryState<T>::RegisterFrame(SourceId source_id, FrameId parent_id,
   frames_.emplace(frame_id, InternalFrame(source_id, frame_id, frame.name(),
                                           frame.frame_group(), index,
                                           parent_id, clique));
+  pose_update_plan_valid_ = false;
+  BumpVisualizationVersion(frame_id);
   return frame_id;
 }
 
@@ -511,6 +516,8 @@ GeometryId GeometryState<T>::RegisterGeometry(
                       InternalGeometry(source_id, geometry->release_shape(),
                                        frame_id, geometry_id, geometry->name(),
                                        geometry->pose(), index));
+  pose_update_plan_valid_ = false;
+  BumpVisualizationVersion(frame_id);
 
   // Any roles defined on the geometry instance propagate through automatically.
   if (geometry->illustration_properties()) {
@@ -682,6 +689,7 @@ void GeometryState<T>::AssignRole(SourceId source_id,
   AssignRoleInternal(source_id, geometry_id, std::move(properties),
                      Role::kIllustration);
   // NOTE: No need to assign to any engines.
+  BumpVisualizationVersion(geometries_.at(geometry_id).frame_id());
 }
 
 template <typename T>
@@ -763,12 +771,49 @@ void GeometryState<T>::SetFramePoses(const FramePoseVector<T>& poses) {
   // TODO(SeanCurtis-TRI): Down the road, make this validation depend on
   // ASSERT_ARMED.
   ValidateFrameIds(poses);
+  if (!pose_update_plan_valid_) RebuildPoseUpdatePlan();
   const Isometry3<T> world_pose = Isometry3<T>::Identity();
   for (auto frame_id : source_root_frame_map_[poses.source_id()]) {
-    UpdatePosesRecursively(frames_[frame_id], world_pose, poses);
+    UpdatePosesRecursively(frames_[frame_id].index(), world_pose, poses,
+                           false /* parent_changed */);
   }
 }
 
+template <typename T>
+void GeometryState<T>::RebuildPoseUpdatePlan() {
+  const int frame_count = static_cast<int>(frame_index_to_id_map_.size());
+  frame_child_frame_indices_.assign(frame_count, {});
+  frame_child_geometry_indices_.assign(frame_count, {});
+  X_FG_.assign(geometry_index_to_id_map_.size(),
+               Isometry3<double>::Identity());
+  for (const auto& id_frame_pair : frames_) {
+    const InternalFrame& frame = id_frame_pair.second;
+    std::vector<FrameIndex>& child_frames =
+        frame_child_frame_indices_[frame.index()];
+    for (FrameId child_id : frame.child_frames()) {
+      child_frames.push_back(frames_.at(child_id).index());
+    }
+    std::vector<GeometryIndex>& child_geometries =
+        frame_child_geometry_indices_[frame.index()];
+    for (GeometryId child_id : frame.child_geometries()) {
+      const InternalGeometry& geometry = geometries_.at(child_id);
+      child_geometries.push_back(geometry.index());
+      // TODO(SeanCurtis-TRI): See note in UpdatePosesRecursively about
+      // replacing this when we have a transform that supports
+      // autodiff * double; the affine completion happens once here rather
+      // than on every update.
+      Isometry3<double> X_FG(geometry.X_FG());
+      X_FG.makeAffine();
+      X_FG_[geometry.index()] = X_FG;
+    }
+    // The child sets hash by id; sort so that traversal (and thus any
+    // accumulated round-off) is independent of hash iteration order.
+    std::sort(child_frames.begin(), child_frames.end());
+    std::sort(child_geometries.begin(), child_geometries.end());
+  }
+  pose_update_plan_valid_ = true;
+}
+
 template <typename T>
 template <typename ValueType>
 void GeometryState<T>::ValidateFrameIds(
@@ -810,6 +855,9 @@ template <typename T>
 void GeometryState<T>::RemoveGeometryUnchecked(GeometryId geometry_id,
                                                RemoveGeometryOrigin caller) {
   const InternalGeometry& geometry = GetValueOrThrow(geometry_id, geometries_);
+  // The frame id must be captured up front; `geometry` dies with the erase()
+  // below.
+  const FrameId frame_id = geometry.frame_id();
 
   // TODO(SeanCurtis-TRI): When this gets invoked by RemoveFrame(), this
   // recursive action will not be necessary, as all child geometries will
@@ -891,41 +939,76 @@ void GeometryState<T>::RemoveGeometryUnchecked(GeometryId geometry_id,
 
   // Remove from the geometries.
   geometries_.erase(geometry_id);
+  pose_update_plan_valid_ = false;
+  BumpVisualizationVersion(frame_id);
+}
+
+namespace {
+
+// Reports true iff the two poses are verifiably bit-identical, so that the
+// owning frame's world-pose update may be skipped. Only the double scalar
+// opts in: for AutoDiffXd (and Expression) Eigen's coefficient-wise equality
+// compares values while ignoring derivatives (resp. expression structure),
+// so an "unchanged" verdict could wrongly skip frames whose derivatives
+// changed.
+bool PoseIsUnchanged(const Isometry3<double>& X_new,
+                     const Isometry3<double>& X_old) {
+  return X_new.matrix() == X_old.matrix();
 }
 
+template <typename T>
+bool PoseIsUnchanged(const Isometry3<T>&, const Isometry3<T>&) {
+  return false;
+}
+
+}  // namespace
+
 template <typename T>
 void GeometryState<T>::UpdatePosesRecursively(
-    const internal::InternalFrame& frame, const Isometry3<T>& X_WP,
-    const FramePoseVector<T>& poses) {
-  const auto frame_id = frame.id();
+    FrameIndex index, const Isometry3<T>& X_WP,
+    const FramePoseVector<T>& poses, bool parent_changed) {
+  // All of the topology touched here comes from the flat, index-keyed
+  // mirrors built by RebuildPoseUpdatePlan() -- the per-step recursion does
+  // no id hashing.
+  const FrameId frame_id = frame_index_to_id_map_[index];
   const auto& X_PF = poses.value(frame_id);
+
+  // If no ancestor has moved and this frame's parent-relative pose is
+  // unchanged, its cached world pose (and those of its geometries) is still
+  // valid. Children must still be visited -- their own parent-relative poses
+  // may have changed.
+  if (!parent_changed && X_WF_valid_[index] &&
+      PoseIsUnchanged(X_PF, X_PF_[index])) {
+    const Isometry3<T>& X_WF_cached = X_WF_[index];
+    for (FrameIndex child_index : frame_child_frame_indices_[index]) {
+      UpdatePosesRecursively(child_index, X_WF_cached, poses, false);
+    }
+    return;
+  }
+
   // Cache this transform for later use.
-  X_PF_[frame.index()] = X_PF;
+  X_PF_[index] = X_PF;
   Isometry3<T> X_WF = X_WP * X_PF;
   // TODO(SeanCurtis-TRI): Replace this when we have a transform object that
   // allows proper multiplication between an AutoDiff type and a double type.
   // For now, it allows me to perform the multiplication by multiplying the
   // fully-defined transformation (with [0 0 0 1] on the bottom row).
   X_WF.makeAffine();
-  X_WF_[frame.index()] = X_WF;
-  // Update the geometry which belong to *this* frame.
-  for (auto child_id : frame.child_geometries()) {
-    auto& child_geometry = geometries_[child_id];
-    auto child_index = child_geometry.index();
-    // TODO(SeanCurtis-TRI): See note above about replacing this when we have a
-    // transform that supports autodiff * double.
-    Isometry3<double> X_FG(child_geometry.X_FG());
-    X_FG.makeAffine();
-    // TODO(SeanCurtis-TRI): These matrix() shenanigans are here because I can't
-    // assign a an Isometry3<double> to an Isometry3<AutoDiffXd>. Replace this
-    // when I can.
-    X_WG_[child_index].matrix() = X_WF.matrix() * X_FG.matrix();
-  }
-
-  // Update each child frame.
-  for (auto child_id : frame.child_frames()) {
-    auto& child_frame = frames_[child_id];
-    UpdatePosesRecursively(child_frame, X_WF, poses);
+  X_WF_[index] = X_WF;
+  X_WF_valid_[index] = true;
+  // Update the geometry which belong to *this* frame. X_FG_ entries are
+  // already affine-completed (see RebuildPoseUpdatePlan()).
+  for (GeometryIndex child_index : frame_child_geometry_indices_[index]) {
+    // TODO(SeanCurtis-TRI): These matrix() shenanigans are here because I
+    // can't assign a an Isometry3<double> to an Isometry3<AutoDiffXd>.
+    // Replace this when I can.
+    X_WG_[child_index].matrix() = X_WF.matrix() * X_FG_[child_index].matrix();
+  }
+
+  // Update each child frame. This frame moved, so every child's world pose
+  // must be recomposed regardless of its own parent-relative pose.
+  for (FrameIndex child_index : frame_child_frame_indices_[index]) {
+    UpdatePosesRecursively(child_index, X_WF, poses, true);
   }
 }
 
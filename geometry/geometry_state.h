@@ -1,5 +1,6 @@
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -115,6 +116,13 @@ class GeometryState {
     return geometry_index_to_id_map_;
   }
 
+  /** Returns a monotonically increasing version number that changes whenever
+   the state's _visualizable_ content changes: frame or geometry registration,
+   geometry removal, or assignment of the illustration role. Consumers (e.g.,
+   visualization) can compare versions to cheaply detect that previously
+   built artifacts are still current.  */
+  int64_t visualization_version() const { return visualization_version_; }
+
   /** Implementation of SceneGraphInspector::NumGeometriesWithRole().  */
   int GetNumGeometriesWithRole(Role role) const;
 
@@ -423,9 +431,10 @@ class GeometryState {
    * objects.
    */
   std::vector<SignedDistancePair<double>>
-  ComputeSignedDistancePairwiseClosestPoints() const {
+  ComputeSignedDistancePairwiseClosestPoints(
+      double max_distance = std::numeric_limits<double>::infinity()) const {
     return geometry_engine_->ComputeSignedDistancePairwiseClosestPoints(
-        geometry_index_to_id_map_);
+        geometry_index_to_id_map_, max_distance);
   }
 
   /** Performs work in support of QueryObject::ComputeSignedDistanceToPoint().
@@ -437,6 +446,24 @@ class GeometryState {
     return geometry_engine_->ComputeSignedDistanceToPoint(
         p_WQ, geometry_index_to_id_map_, threshold);
   }
+
+  /** Performs work in support of QueryObject::ComputeSignedDistanceToPoints().
+   */
+  std::vector<std::vector<SignedDistanceToPoint<double>>>
+  ComputeSignedDistanceToPoints(
+      const Eigen::Ref<const Matrix3X<double>>& p_WQs,
+      const double threshold) const {
+    return geometry_engine_->ComputeSignedDistanceToPoints(
+        p_WQs, geometry_index_to_id_map_, threshold);
+  }
+
+  /** Performs work in support of QueryObject::CastRays().  */
+  void CastRays(const Eigen::Ref<const Matrix3X<double>>& p_WOs,
+                const Eigen::Ref<const Matrix3X<double>>& ds_W,
+                double max_range, RayCastResults* results) const {
+    geometry_engine_->CastRays(p_WOs, ds_W, max_range,
+                               geometry_index_to_id_map_, results);
+  }
   //@}
 
   /** @name Scalar conversion  */
@@ -483,6 +510,14 @@ class GeometryState {
     convert(source.X_PF_, &X_PF_);
     convert(source.X_WG_, &X_WG_);
     convert(source.X_WF_, &X_WF_);
+    X_WF_valid_ = source.X_WF_valid_;
+    // The pose-update plan is scalar independent; carry it over as is.
+    frame_child_frame_indices_ = source.frame_child_frame_indices_;
+    frame_child_geometry_indices_ = source.frame_child_geometry_indices_;
+    X_FG_ = source.X_FG_;
+    pose_update_plan_valid_ = source.pose_update_plan_valid_;
+    visualization_version_ = source.visualization_version_;
+    frame_visualization_versions_ = source.frame_visualization_versions_;
   }
 
   // NOTE: This friend class is responsible for evaluating the internals of
@@ -568,10 +603,28 @@ class GeometryState {
 
   // Recursively updates the frame and geometry _pose_ information for the tree
   // rooted at the given frame, whose parent's pose in the world frame is given
-  // as `X_WP`.
-  void UpdatePosesRecursively(const internal::InternalFrame& frame,
+  // as `X_WP`. `parent_changed` reports whether any ancestor's pose changed
+  // in this update; when it is false and this frame's own parent-relative
+  // pose is verifiably unchanged, the frame's cached world pose (and those of
+  // its geometries) is left untouched and only the children are visited.
+  void UpdatePosesRecursively(FrameIndex index,
                               const Isometry3<T>& X_WP,
-                              const FramePoseVector<T>& poses);
+                              const FramePoseVector<T>& poses,
+                              bool parent_changed);
+
+  // Rebuilds the flat, index-keyed topology mirrors consumed by
+  // UpdatePosesRecursively() (frame_child_frame_indices_,
+  // frame_child_geometry_indices_, X_FG_) from frames_ and geometries_.
+  // Invoked lazily from SetFramePoses() after any topology change; see
+  // pose_update_plan_valid_.
+  void RebuildPoseUpdatePlan();
+
+  // Records a change to the visualizable content of the given frame; bumps
+  // the state-wide visualization version and stamps the frame with it.
+  void BumpVisualizationVersion(FrameId frame_id) {
+    ++visualization_version_;
+    frame_visualization_versions_[frame_id] = visualization_version_;
+  }
 
   // Reports true if the given id refers to a _dynamic_ geometry. Assumes the
   // precondition that id refers to a valid geometry in the state.
@@ -698,6 +751,32 @@ class GeometryState {
   // frame i to the world frame.
   std::vector<Isometry3<T>> X_WF_;
 
+  // Whether X_WF_[i] (and the X_WG_ entries of frame i's geometries) has been
+  // computed from input poses at least once. Until then, the "unchanged pose"
+  // fast path in UpdatePosesRecursively() must not skip the frame -- at
+  // registration X_WF_ is seeded with identity, which is not generally
+  // consistent with the registered X_PF_.
+  std::vector<bool> X_WF_valid_;
+
+  // Flat, index-keyed mirrors of the frame/geometry topology held in frames_
+  // and geometries_, so that the per-step pose propagation walks plain
+  // vectors instead of hashing ids. They are rebuilt lazily (see
+  // RebuildPoseUpdatePlan()) whenever registration or removal invalidates
+  // them. Entry i of the first two is keyed by FrameIndex (aligned with
+  // X_WF_); X_FG_ is keyed by GeometryIndex (aligned with X_WG_) and stores
+  // each geometry's (affine-completed) pose in its frame.
+  std::vector<std::vector<FrameIndex>> frame_child_frame_indices_;
+  std::vector<std::vector<GeometryIndex>> frame_child_geometry_indices_;
+  std::vector<Isometry3<double>> X_FG_;
+  bool pose_update_plan_valid_{false};
+
+  // Monotonic counter of changes to visualizable content (see
+  // visualization_version()) and, per frame, the version at which that
+  // frame's visualizable content last changed. Together they let consumers
+  // rebuild only the artifacts for frames that actually changed.
+  int64_t visualization_version_{0};
+  std::unordered_map<FrameId, int64_t> frame_visualization_versions_;
+
   // The underlying geometry engine. The topology of the engine does _not_
   // change with respect to time. But its values do. This straddles the two
   // worlds, maintaining its own persistent topological state and derived
@@ -2,9 +2,11 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/never_destroyed.h"
 #include "drake/geometry/geometry_state.h"
@@ -139,97 +141,128 @@ lcmt_viewer_geometry_data MakeGeometryData(const Shape& shape,
 
 namespace internal {
 
-lcmt_viewer_load_robot GeometryVisualizationImpl::BuildLoadMessage(
+std::vector<std::pair<FrameId, int>>
+GeometryVisualizationImpl::CollectIllustratedFrames(
     const GeometryState<double>& state) {
   using internal::InternalFrame;
-  using internal::InternalGeometry;
 
-  lcmt_viewer_load_robot message{};
-  // Populate the message.
-
-  // Collect the dynamic frames that actually have illustration geometry. These
-  // (plus possibly the world frame) are the frames that will be broadcast in
-  // the message.
-  std::vector<std::pair<FrameId, int>> dynamic_frames;
+  std::vector<std::pair<FrameId, int>> frames;
+  // The world frame comes first if it has geometries with illustration role.
+  const int anchored_count = state.NumGeometriesWithRole(
+      InternalFrame::world_frame_id(), Role::kIllustration);
+  if (anchored_count > 0) {
+    frames.push_back({InternalFrame::world_frame_id(), anchored_count});
+  }
+  // Collect the dynamic frames that actually have illustration geometry.
   for (const auto& pair : state.frames_) {
     const FrameId frame_id = pair.first;
-    // We'll handle the world frame special.
+    // The world frame has already been handled.
     if (frame_id == InternalFrame::world_frame_id()) continue;
     const int count =
         state.NumGeometriesWithRole(frame_id, Role::kIllustration);
     if (count > 0) {
-      dynamic_frames.push_back({frame_id, count});
+      frames.push_back({frame_id, count});
     }
   }
-  // Add the world frame if it has geometries with illustration role.
-  const int anchored_count = state.NumGeometriesWithRole(
-      InternalFrame::world_frame_id(), Role::kIllustration);
-  const int frame_count = static_cast<int>(dynamic_frames.size()) +
-      (anchored_count > 0 ? 1 : 0);
+  return frames;
+}
 
-  message.num_links = frame_count;
-  message.link.resize(frame_count);
+lcmt_viewer_link_data GeometryVisualizationImpl::BuildLinkData(
+    const GeometryState<double>& state, FrameId frame_id, int geometry_count) {
+  using internal::InternalFrame;
+  using internal::InternalGeometry;
 
   const Eigen::Vector4d default_color({0.9, 0.9, 0.9, 1.0});
 
-  int link_index = 0;
-  // Load anchored geometry into the world frame.
-  if (anchored_count) {
-    message.link[0].name = "world";
-    message.link[0].robot_num = 0;
-    message.link[0].num_geom = anchored_count;
-    message.link[0].geom.resize(anchored_count);
-    int geom_index = 0;
-    const InternalFrame& world_frame =
-        state.frames_.at(InternalFrame::world_frame_id());
-    for (const GeometryId id : world_frame.child_geometries()) {
-      const InternalGeometry& geometry = state.geometries_.at(id);
-      const IllustrationProperties* props = geometry.illustration_properties();
-      if (props != nullptr) {
-        const Shape& shape = geometry.shape();
-        const Eigen::Vector4d& color = props->GetPropertyOrDefault(
-            "phong", "diffuse", default_color);
-        message.link[0].geom[geom_index] = MakeGeometryData(
-            shape, geometry.X_FG(), color);
-        ++geom_index;
-      }
-    }
-    link_index = 1;
-  }
-
-  // Load dynamic geometry into their own frames.
-  for (const auto& pair : dynamic_frames) {
-    const FrameId frame_id = pair.first;
-    const int geometry_count = pair.second;
-    const internal::InternalFrame& frame = state.frames_.at(frame_id);
+  lcmt_viewer_link_data link{};
+  const InternalFrame& frame = state.frames_.at(frame_id);
+  if (frame_id == InternalFrame::world_frame_id()) {
+    // Anchored geometry is loaded into the world frame.
+    link.name = "world";
+    link.robot_num = 0;
+  } else {
     SourceId s_id = state.get_source_id(frame.id());
     const std::string& src_name = state.get_source_name(s_id);
     // TODO(SeanCurtis-TRI): The name in the load message *must* match the name
     // in the update message. Make sure this code and the SceneGraph output
     // use a common code-base to translate (source_id, frame) -> name.
-    message.link[link_index].name = src_name + "::" + frame.name();
-    message.link[link_index].robot_num = frame.frame_group();
-    message.link[link_index].num_geom = geometry_count;
-    message.link[link_index].geom.resize(geometry_count);
-    int geom_index = 0;
-    for (GeometryId geom_id : frame.child_geometries()) {
-      const InternalGeometry& geometry = state.geometries_.at(geom_id);
-      const IllustrationProperties* props = geometry.illustration_properties();
-      if (props != nullptr) {
-        const Shape& shape = geometry.shape();
-        const Eigen::Vector4d& color = props->GetPropertyOrDefault(
-            "phong", "diffuse", default_color);
-        message.link[link_index].geom[geom_index] =
-            MakeGeometryData(shape, geometry.X_FG(), color);
-        ++geom_index;
-      }
+    link.name = src_name + "::" + frame.name();
+    link.robot_num = frame.frame_group();
+  }
+  link.num_geom = geometry_count;
+  link.geom.resize(geometry_count);
+  int geom_index = 0;
+  for (const GeometryId id : frame.child_geometries()) {
+    const InternalGeometry& geometry = state.geometries_.at(id);
+    const IllustrationProperties* props = geometry.illustration_properties();
+    if (props != nullptr) {
+      const Shape& shape = geometry.shape();
+      const Eigen::Vector4d& color = props->GetPropertyOrDefault(
+          "phong", "diffuse", default_color);
+      link.geom[geom_index] = MakeGeometryData(shape, geometry.X_FG(), color);
+      ++geom_index;
     }
-    ++link_index;
   }
+  return link;
+}
 
+lcmt_viewer_load_robot GeometryVisualizationImpl::BuildLoadMessage(
+    const GeometryState<double>& state) {
+  lcmt_viewer_load_robot message{};
+  const std::vector<std::pair<FrameId, int>> frames =
+      CollectIllustratedFrames(state);
+  message.num_links = static_cast<int>(frames.size());
+  message.link.resize(frames.size());
+  for (size_t i = 0; i < frames.size(); ++i) {
+    message.link[i] = BuildLinkData(state, frames[i].first, frames[i].second);
+  }
   return message;
 }
 
+bool GeometryVisualizationImpl::UpdateLoadMessage(
+    const GeometryState<double>& state, LoadMessageCache* cache) {
+  DRAKE_DEMAND(cache != nullptr);
+  if (cache->state_version == state.visualization_version()) return false;
+
+  // Index the cached links by frame so unchanged ones can be carried over.
+  std::unordered_map<FrameId, std::pair<int64_t, int>> cached_links;
+  for (size_t i = 0; i < cache->link_versions.size(); ++i) {
+    cached_links[cache->link_versions[i].first] = {
+        cache->link_versions[i].second, static_cast<int>(i)};
+  }
+
+  const std::vector<std::pair<FrameId, int>> frames =
+      CollectIllustratedFrames(state);
+  lcmt_viewer_load_robot message{};
+  message.num_links = static_cast<int>(frames.size());
+  message.link.resize(frames.size());
+  std::vector<std::pair<FrameId, int64_t>> link_versions(frames.size());
+  for (size_t i = 0; i < frames.size(); ++i) {
+    const FrameId frame_id = frames[i].first;
+    const auto version_iter =
+        state.frame_visualization_versions_.find(frame_id);
+    const int64_t frame_version =
+        version_iter != state.frame_visualization_versions_.end()
+            ? version_iter->second
+            : 0;
+    const auto cache_iter = cached_links.find(frame_id);
+    if (cache_iter != cached_links.end() &&
+        cache_iter->second.first == frame_version) {
+      // This frame's content hasn't changed since the cache was built; its
+      // link data can be moved over wholesale.
+      message.link[i] =
+          std::move(cache->message.link[cache_iter->second.second]);
+    } else {
+      message.link[i] = BuildLinkData(state, frame_id, frames[i].second);
+    }
+    link_versions[i] = {frame_id, frame_version};
+  }
+  cache->message = std::move(message);
+  cache->link_versions = std::move(link_versions);
+  cache->state_version = state.visualization_version();
+  return true;
+}
+
 }  // namespace internal
 
 // TODO(sherm1) Per Sean Curtis, the load message should take its geometry
@@ -245,6 +278,18 @@ void DispatchLoadMessage(const SceneGraph<double>& scene_graph,
   Publish(lcm, "DRAKE_VIEWER_LOAD_ROBOT", message);
 }
 
+void DispatchLoadMessage(const SceneGraph<double>& scene_graph,
+                         lcm::DrakeLcmInterface* lcm,
+                         internal::LoadMessageCache* cache) {
+  DRAKE_DEMAND(cache != nullptr);
+  // Only ship a message when the registered geometry actually changed; the
+  // update rebuilds only the links whose frames changed.
+  if (internal::GeometryVisualizationImpl::UpdateLoadMessage(
+          *scene_graph.initial_state_, cache)) {
+    Publish(lcm, "DRAKE_VIEWER_LOAD_ROBOT", cache->message);
+  }
+}
+
 systems::lcm::LcmPublisherSystem* ConnectDrakeVisualizer(
     systems::DiagramBuilder<double>* builder,
     const SceneGraph<double>& scene_graph,
@@ -4,9 +4,14 @@
 
 #pragma once
 
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 #include "drake/geometry/geometry_state.h"
 #include "drake/geometry/scene_graph.h"
 #include "drake/lcm/drake_lcm_interface.h"
+#include "drake/lcmt_viewer_link_data.hpp"
 #include "drake/lcmt_viewer_load_robot.hpp"
 #include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/lcm/lcm_publisher_system.h"
@@ -17,6 +22,17 @@ namespace geometry {
 #ifndef DRAKE_DOXYGEN_CXX
 namespace internal {
 
+// The record of a previously dispatched load message: the message itself, the
+// geometry-state version it reflects and, per link, the frame it describes
+// and the version of that frame's visualizable content. Used by the
+// incremental DispatchLoadMessage() overload; a default-constructed cache
+// means "nothing dispatched yet".
+struct LoadMessageCache {
+  int64_t state_version{-1};
+  std::vector<std::pair<FrameId, int64_t>> link_versions;
+  lcmt_viewer_load_robot message;
+};
+
 // Simple class declared as a friend to GeometryState to facilitate the creation
 // of visualization artifacts directly from the contents of GeometryState.
 class GeometryVisualizationImpl {
@@ -25,6 +41,26 @@ class GeometryVisualizationImpl {
   // to load the state's geometry.
   static lcmt_viewer_load_robot BuildLoadMessage(
       const GeometryState<double>& state);
+
+  // Brings `cache->message` up to date with `state`: links whose frames'
+  // visualizable content is unchanged since the cache was last updated are
+  // carried over verbatim, so only the changed frames pay the shape
+  // conversion cost. Returns true if the message changed (i.e., it should be
+  // re-published).
+  static bool UpdateLoadMessage(const GeometryState<double>& state,
+                                LoadMessageCache* cache);
+
+ private:
+  // The frames to broadcast as links -- the world frame first (when it has
+  // illustration geometry), then the dynamic frames that do -- paired with
+  // their illustration geometry counts.
+  static std::vector<std::pair<FrameId, int>> CollectIllustratedFrames(
+      const GeometryState<double>& state);
+
+  // Builds the link data for a single frame's illustration geometries.
+  static lcmt_viewer_link_data BuildLinkData(
+      const GeometryState<double>& state, FrameId frame_id,
+      int geometry_count);
 };
 
 }  // namespace internal
@@ -123,5 +159,23 @@ IllustrationProperties MakeDrakeVisualizerProperties(
 void DispatchLoadMessage(
     const SceneGraph<double>& scene_graph, lcm::DrakeLcmInterface* lcm);
 
+/** (Advanced) Variant of DispatchLoadMessage() for scenes whose registered
+ geometry changes over time. The given `cache` records what was last
+ dispatched: when nothing visualizable has changed since then, no message is
+ sent at all; otherwise, only the links whose frames actually changed are
+ rebuilt before the load message is re-sent, so the dispatch cost is
+ proportional to the change rather than to the size of the scene. Reuse the
+ same (default-constructed) cache instance across calls for a given
+ `scene_graph`.
+
+ Note that mesh geometry is referenced by filename in the message; the mesh
+ payload itself is loaded by the visualizer out-of-band, so re-sending the
+ load message does not re-transmit mesh data.
+
+ @see geometry::DispatchLoadMessage() */
+void DispatchLoadMessage(const SceneGraph<double>& scene_graph,
+                         lcm::DrakeLcmInterface* lcm,
+                         internal::LoadMessageCache* cache);
+
 }  // namespace geometry
 }  // namespace drake
@@ -1,11 +1,17 @@
 #include "drake/geometry/proximity_engine.h"
 
 #include <algorithm>
+#include <atomic>
+#include <bitset>
 #include <cctype>
 #include <cmath>
 #include <cstdint>
+#include <fstream>
 #include <iterator>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 
@@ -20,7 +26,9 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_variant.h"
-#include "drake/common/sorted_vectors_have_intersection.h"
+#include "drake/common/tracing.h"
+#include "drake/common/hash.h"
+#include "drake/common/sorted_pair.h"
 #include "drake/geometry/utilities.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/math/rotation_matrix.h"
@@ -137,8 +145,12 @@ class EncodedData {
 };
 
 // A simple class for providing collision filtering functionality similar to
-// that found in RigidBodyTree but made compatible with fcl. The majority of
-// this code is lifted verbatim from drake/multibody/collision/element.{h, cc}.
+// that found in RigidBodyTree but made compatible with fcl. The semantics are
+// lifted from drake/multibody/collision/element.{h, cc}, but clique
+// membership is compiled into per-geometry bitsets (one bit per clique id) as
+// cliques are added, so that the per-candidate-pair CanCollideWith() test in
+// the narrowphase hot path reduces to a word-wise AND of two masks instead of
+// a sorted-vector intersection.
 //
 // Note: I'm using uintptr_t instead of EncodedData directly to avoid having
 // to hash EncodedData.
@@ -151,7 +163,7 @@ class CollisionFilterLegacy {
   CollisionFilterLegacy() = default;
 
   void AddGeometry(uintptr_t id) {
-    collision_cliques_.insert({id, std::vector<int>()});
+    collision_cliques_.insert({id, std::vector<uint64_t>()});
   }
 
   // NOTE: This assumes that `id_A` and `id_B` will *never* both be anchored
@@ -163,31 +175,36 @@ class CollisionFilterLegacy {
     DRAKE_ASSERT(collision_cliques_.count(id_A) == 1);
     DRAKE_ASSERT(collision_cliques_.count(id_B) == 1);
 
-    bool excluded = id_A == id_B ||
-                    SortedVectorsHaveIntersection(collision_cliques_.at(id_A),
-                                                  collision_cliques_.at(id_B));
-
-    return !excluded;
+    if (id_A == id_B) return false;
+    const std::vector<uint64_t>& mask_A = collision_cliques_.at(id_A);
+    const std::vector<uint64_t>& mask_B = collision_cliques_.at(id_B);
+    // A shared clique shows up as a shared set bit; for the typical case of
+    // fewer than 64 cliques this is a single AND.
+    const size_t common_words = std::min(mask_A.size(), mask_B.size());
+    for (size_t w = 0; w < common_words; ++w) {
+      if (mask_A[w] & mask_B[w]) return false;
+    }
+    return true;
   }
 
   void AddToCollisionClique(uintptr_t geometry_id, int clique_id) {
     DRAKE_ASSERT(collision_cliques_.count(geometry_id) == 1);
 
-    std::vector<int>& cliques = collision_cliques_[geometry_id];
-    // Order(N) insertion.
-    // `cliques` is a sorted vector so that checking if two collision elements
-    // belong to a common group can be performed efficiently in order N.
-    // See Element::CanCollideWith() and Element::collision_cliques_ for
-    // explanation.
-    auto it = std::lower_bound(cliques.begin(), cliques.end(), clique_id);
-
-    // This test prevents duplicate clique ids from being added.
-    if (it == cliques.end() || clique_id < *it) cliques.insert(it, clique_id);
+    std::vector<uint64_t>& mask = collision_cliques_[geometry_id];
+    const size_t word = clique_id / 64;
+    if (word >= mask.size()) mask.resize(word + 1, 0);
+    // Setting a bit is idempotent, so duplicate clique additions are benign
+    // and the compiled representation stays current incrementally.
+    mask[word] |= uint64_t{1} << (clique_id % 64);
   }
 
   int num_cliques(uintptr_t geometry_id) const {
     DRAKE_ASSERT(collision_cliques_.count(geometry_id) == 1);
-    return static_cast<int>(collision_cliques_.at(geometry_id).size());
+    int count = 0;
+    for (uint64_t word : collision_cliques_.at(geometry_id)) {
+      count += static_cast<int>(std::bitset<64>(word).count());
+    }
+    return count;
   }
 
   // This method is not thread safe.
@@ -205,27 +222,31 @@ class CollisionFilterLegacy {
 
  private:
   // A map between the EncodedData::encoded_data() value for a geometry and
-  // its set of cliques.
-  std::unordered_map<uintptr_t, std::vector<int>> collision_cliques_;
+  // its clique-membership bitset (bit i is set iff the geometry belongs to
+  // clique i), stored as packed 64-bit words.
+  std::unordered_map<uintptr_t, std::vector<uint64_t>> collision_cliques_;
   int next_available_clique_{0};
 };
 
-// Struct for use in DistanceCallback(). Contains the distance request
-// and accumulates result in a drake::geometry::SignedDistancePair vector.
-struct DistanceData {
-  DistanceData(const std::vector<GeometryId>* geometry_map_in,
-               const CollisionFilterLegacy* collision_filter_in)
-      : geometry_map(*geometry_map_in),
-        collision_filter(*collision_filter_in) {}
-  // Maps so the distance call back can map from engine index to geometry id.
-  const std::vector<GeometryId>& geometry_map;
+// Struct for use in CollectPairsCallback() and CollectPairsDistanceCallback().
+// Accumulates the collision-filtered candidate pairs reported by the
+// broadphase so that narrowphase evaluation can subsequently be dispatched
+// over them -- serially or across worker threads.
+struct PairCollectionData {
+  explicit PairCollectionData(const CollisionFilterLegacy* collision_filter_in)
+      : collision_filter(*collision_filter_in) {}
+
+  // The collision filter used to cull candidate pairs.
   const CollisionFilterLegacy& collision_filter;
 
-  // Distance request
-  fcl::DistanceRequestd request;
+  // For distance queries, the bound beyond which pairs are ignored. The
+  // broadphase prunes pairs whose bounding boxes are farther apart than this.
+  double max_distance{std::numeric_limits<double>::infinity()};
 
-  // Vectors of distance results
-  std::vector<SignedDistancePair<double>>* nearest_pairs{};
+  // The surviving candidate pairs, in broadphase traversal order.
+  std::vector<std::pair<const fcl::CollisionObjectd*,
+                        const fcl::CollisionObjectd*>>
+      pairs;
 };
 
 // Struct for use in DistanceFromPointCallback(). Contains the distance request
@@ -253,24 +274,6 @@ struct DistanceFromPointCallbackData {
   std::vector<SignedDistanceToPoint<double>>* distances;
 };
 
-// Struct for use in SingleCollisionCallback(). Contains the collision request
-// and accumulates results in a drake::multibody::collision::PointPair vector.
-struct CollisionData {
-  CollisionData(const std::vector<GeometryId>* geometry_map_in,
-                const CollisionFilterLegacy* collision_filter_in)
-      : geometry_map(*geometry_map_in),
-        collision_filter(*collision_filter_in) {}
-  // Maps so the penetration call back can map from engine index to geometry id.
-  const std::vector<GeometryId>& geometry_map;
-  const CollisionFilterLegacy& collision_filter;
-
-  // Collision request
-  fcl::CollisionRequestd request;
-
-  // Vector of distance results
-  std::vector<PenetrationAsPointPair<double>>* contacts{};
-};
-
 // An internal functor to support DistanceFromPointCallback() and
 // ComputeNearphaseDistance(). It computes the signed distance to a query
 // point from a supported geometry. Each overload to the call operator
@@ -455,7 +458,7 @@ void DistancePairGeometry::operator()(const fcl::Boxd* box_A,
   result_->update(distance, box_A, sphere_B, -1, -1, p_WNa, p_WNb);
 }
 
-// Helps DistanceCallback(). Do it in closed forms for sphere-sphere or
+// Helps CalcNarrowphaseDistance(). Do it in closed forms for sphere-sphere or
 // sphere-box. Otherwise, use FCL GJK/EPA.
 void ComputeNearphaseDistance(const fcl::CollisionObjectd* a,
                               const fcl::CollisionObjectd* b,
@@ -512,75 +515,123 @@ void ComputeNearphaseDistance(const fcl::CollisionObjectd* a,
   }
 }
 
-// The callback function in fcl::distance request. The final unnamed parameter
-// is `dist`, which is used in fcl::distance, that if the distance between two
-// geometries is proved to be greater than `dist` (for example, the smallest
-// distance between the bounding boxes containing object A and object B is
-// greater than `dist`), then fcl::distance will skip this callback. In our
-// case, as we want to compute the distance between any pair of geometries, we
-// leave `dist` unchanged as its default value (max_double). So the last
-// parameter is merely a placeholder, and not being used or updated in the
-// callback.
-bool DistanceCallback(fcl::CollisionObjectd* fcl_object_A_ptr,
-                      fcl::CollisionObjectd* fcl_object_B_ptr,
-                      // NOLINTNEXTLINE
-                      void* callback_data, double&) {
+// Computes the signed distance result for a single candidate pair produced
+// by the broadphase. The pair is assumed to have already passed collision
+// filtering.
+SignedDistancePair<double> CalcNarrowphaseDistance(
+    const fcl::CollisionObjectd& fcl_object_A,
+    const fcl::CollisionObjectd& fcl_object_B,
+    const std::vector<GeometryId>& geometry_map,
+    const fcl::DistanceRequestd& request) {
+  fcl::DistanceResultd result;
+
+  ComputeNearphaseDistance(&fcl_object_A, &fcl_object_B,
+                           geometry_map, request, &result);
+
+  SignedDistancePair<double> nearest_pair;
+  nearest_pair.id_A = EncodedData(fcl_object_A).id(geometry_map);
+  nearest_pair.id_B = EncodedData(fcl_object_B).id(geometry_map);
+
+  // Note: The result of FCL's distance query is in the *world* frame, the
+  // SignedDistancePair reports in geometry frame.
+  nearest_pair.p_ACa =
+      fcl_object_A.getTransform().inverse() * result.nearest_points[0];
+  nearest_pair.p_BCb =
+      fcl_object_B.getTransform().inverse() * result.nearest_points[1];
+  nearest_pair.distance = result.min_distance;
+  // Guarantee fixed ordering of pair (A, B). Swap the ids and points on
+  // surfaces and then flip the normal.
+  if (nearest_pair.id_B < nearest_pair.id_A) {
+    std::swap(nearest_pair.id_A, nearest_pair.id_B);
+    std::swap(nearest_pair.p_ACa, nearest_pair.p_BCb);
+  }
+  return nearest_pair;
+}
+
+// Broadphase callback for fcl's collide() traversal. Applies the collision
+// filter and records the surviving candidate pair for later narrowphase
+// evaluation.
+bool CollectPairsCallback(fcl::CollisionObjectd* fcl_object_A_ptr,
+                          fcl::CollisionObjectd* fcl_object_B_ptr,
+                          void* callback_data) {
   // NOTE: Although this function *takes* non-const pointers to satisfy the
   // fcl api, it should not exploit the non-constness to modify the collision
-  // objects. We insure this by immediately assigning to a const version and
-  // not directly using the provided parameters.
-  const fcl::CollisionObjectd& fcl_object_A = *fcl_object_A_ptr;
-  const fcl::CollisionObjectd& fcl_object_B = *fcl_object_B_ptr;
-
-  auto& collision_data = *static_cast<DistanceData*>(callback_data);
-
-  // Extract the collision filter keys from the fcl collision objects. These
-  // keys will also be used to map the fcl collision object back to the Drake
-  // GeometryId for colliding geometries.
-  EncodedData encoding_A(fcl_object_A);
-  EncodedData encoding_B(fcl_object_B);
+  // objects; the candidate pair is recorded through const pointers.
+  auto& collection_data = *static_cast<PairCollectionData*>(callback_data);
 
-  const bool can_collide = collision_data.collision_filter.CanCollideWith(
-      encoding_A.encoded_data(), encoding_B.encoded_data());
+  // Extract the collision filter keys from the fcl collision objects.
+  EncodedData encoding_A(*fcl_object_A_ptr);
+  EncodedData encoding_B(*fcl_object_B_ptr);
 
-  if (can_collide) {
-    // Unpack the callback data
-    auto& distance_data = *static_cast<DistanceData*>(callback_data);
-    const fcl::DistanceRequestd& request = distance_data.request;
-    const std::vector<GeometryId>& geometry_map = distance_data.geometry_map;
-
-    fcl::DistanceResultd result;
-
-    ComputeNearphaseDistance(&fcl_object_A, &fcl_object_B,
-                             geometry_map, request, &result);
-
-    SignedDistancePair<double> nearest_pair;
-    nearest_pair.id_A = EncodedData(fcl_object_A).id(geometry_map);
-    nearest_pair.id_B = EncodedData(fcl_object_B).id(geometry_map);
-
-    // Note: The result of FCL's distance query is in the *world* frame, the
-    // SignedDistancePair reports in geometry frame.
-    nearest_pair.p_ACa =
-        fcl_object_A.getTransform().inverse() * result.nearest_points[0];
-    nearest_pair.p_BCb =
-        fcl_object_B.getTransform().inverse() * result.nearest_points[1];
-    nearest_pair.distance = result.min_distance;
-    // Guarantee fixed ordering of pair (A, B). Swap the ids and points on
-    // surfaces and then flip the normal.
-    if (nearest_pair.id_B < nearest_pair.id_A) {
-      std::swap(nearest_pair.id_A, nearest_pair.id_B);
-      std::swap(nearest_pair.p_ACa, nearest_pair.p_BCb);
-    }
-
-    distance_data.nearest_pairs->emplace_back(std::move(nearest_pair));
+  if (collection_data.collision_filter.CanCollideWith(
+          encoding_A.encoded_data(), encoding_B.encoded_data())) {
+    collection_data.pairs.emplace_back(fcl_object_A_ptr, fcl_object_B_ptr);
   }
 
   // Returning true would tell the broadphase manager to terminate early. Since
-  // we want to find all the signed distance present in the model's current
+  // we want to find all the candidate pairs present in the model's current
   // configuration, we return false.
   return false;
 }
 
+// Broadphase callback for fcl's distance() traversal; forwards to
+// CollectPairsCallback(). The final parameter is `dist`, which is used by
+// fcl::distance as a traversal bound: if the distance between two geometries
+// is proved to be greater than `dist` (for example, the smallest distance
+// between the bounding boxes containing object A and object B is greater
+// than `dist`), then fcl::distance will skip this callback. We set it to the
+// query's max_distance so that broadphase pruning culls distant pairs; for
+// the default bound of infinity every pair is visited, as before.
+bool CollectPairsDistanceCallback(fcl::CollisionObjectd* fcl_object_A_ptr,
+                                  fcl::CollisionObjectd* fcl_object_B_ptr,
+                                  void* callback_data, double& dist) {
+  dist = static_cast<PairCollectionData*>(callback_data)->max_distance;
+  return CollectPairsCallback(fcl_object_A_ptr, fcl_object_B_ptr,
+                              callback_data);
+}
+
+// Evaluates `calc_pair` over every collected candidate pair using up to
+// `num_threads` threads (the calling thread plus spawned workers). Each
+// thread appends to its own result buffer and the buffers are merged
+// afterwards, so threads never contend on shared state. The merged results
+// reflect thread scheduling; callers restore determinism by sorting on the
+// (id_A, id_B) pair.
+template <typename Result, typename CalcPair>
+std::vector<Result> EvaluateNarrowphase(
+    const std::vector<std::pair<const fcl::CollisionObjectd*,
+                                const fcl::CollisionObjectd*>>& pairs,
+    int num_threads, const CalcPair& calc_pair) {
+  const int num_workers = std::max(
+      1, std::min(num_threads, static_cast<int>(pairs.size())));
+  std::vector<std::vector<Result>> buffers(num_workers);
+  if (num_workers == 1) {
+    for (const auto& pair : pairs) {
+      calc_pair(*pair.first, *pair.second, &buffers[0]);
+    }
+  } else {
+    // Workers claim the next unevaluated pair through a shared atomic cursor
+    // so that expensive pairs (e.g., convex-convex) do not serialize a
+    // statically partitioned batch.
+    std::atomic<size_t> cursor{0};
+    auto work = [&pairs, &buffers, &cursor, &calc_pair](int worker) {
+      for (size_t i = cursor++; i < pairs.size(); i = cursor++) {
+        calc_pair(*pairs[i].first, *pairs[i].second, &buffers[worker]);
+      }
+    };
+    std::vector<std::thread> workers;
+    for (int w = 1; w < num_workers; ++w) workers.emplace_back(work, w);
+    work(0);
+    for (auto& thread : workers) thread.join();
+  }
+  std::vector<Result> results = std::move(buffers[0]);
+  for (int w = 1; w < num_workers; ++w) {
+    results.insert(results.end(),
+                   std::make_move_iterator(buffers[w].begin()),
+                   std::make_move_iterator(buffers[w].end()));
+  }
+  return results;
+}
+
 // Overload for Sphere.
 SignedDistanceToPoint<double> DistanceToPoint::operator()(
     const fcl::Sphered& sphere) {
@@ -756,88 +807,223 @@ bool DistanceFromPointCallback(fcl::CollisionObjectd* fcl_object_A_ptr,
   return false;  // Returning false tells fcl to continue to other objects.
 }
 
-// Callback function for FCL's collide() function for retrieving a *single*
-// contact.
-bool SingleCollisionCallback(fcl::CollisionObjectd* fcl_object_A_ptr,
-                             fcl::CollisionObjectd* fcl_object_B_ptr,
-                             void* callback_data) {
-  // NOTE: Although this function *takes* non-const pointers to satisfy the
-  // fcl api, it should not exploit the non-constness to modify the collision
-  // objects. We insure this by immediately assigning to a const version and
-  // not directly using the provided parameters.
-  const fcl::CollisionObjectd& fcl_object_A = *fcl_object_A_ptr;
-  const fcl::CollisionObjectd& fcl_object_B = *fcl_object_B_ptr;
-
-  auto& collision_data = *static_cast<CollisionData*>(callback_data);
-
-  // Extract the collision filter keys from the fcl collision objects. These
-  // keys will also be used to map the fcl collision object back to the Drake
-  // GeometryId for colliding geometries.
-  EncodedData encoding_A(fcl_object_A);
-  EncodedData encoding_B(fcl_object_B);
-
-  const bool can_collide = collision_data.collision_filter.CanCollideWith(
-      encoding_A.encoded_data(), encoding_B.encoded_data());
-
-  if (can_collide) {
-    // Unpack the callback data
-    const fcl::CollisionRequestd& request = collision_data.request;
-
-    // This callback only works for a single contact, this confirms a request
-    // hasn't been made for more contacts.
-    DRAKE_ASSERT(request.num_max_contacts == 1);
-    fcl::CollisionResultd result;
-
-    // Perform nearphase collision detection
-    fcl::collide(&fcl_object_A, &fcl_object_B, request, result);
-
-    // Process the contact points
-    if (result.isCollision()) {
-      // NOTE: This assumes that the request is configured to use a single
-      // contact.
-      const fcl::Contactd& contact = result.getContact(0);
-      //  By convention, Drake requires the contact normal to point out of B and
-      //  into A. FCL uses the opposite convention.
-      Vector3d drake_normal = -contact.normal;
-
-      // Signed distance is negative when penetration depth is positive.
-      double depth = contact.penetration_depth;
-
-      // FCL returns a single contact point centered between the two penetrating
-      // surfaces. PenetrationAsPointPair expects
-      // two, one on the surface of body A (Ac) and one on the surface of body B
-      // (Bc). Choose points along the line defined by the contact point and
-      // normal, equidistant to the contact point. Recall that signed_distance
-      // is strictly non-positive, so signed_distance * drake_normal points out
-      // of A and into B.
-      Vector3d p_WAc = contact.pos - 0.5 * depth * drake_normal;
-      Vector3d p_WBc = contact.pos + 0.5 * depth * drake_normal;
-
-      PenetrationAsPointPair<double> penetration;
-      penetration.depth = depth;
-      // The engine doesn't know geometry ids; it returns engine indices. The
-      // caller must map engine indices to geometry ids.
-      const std::vector<GeometryId>& geometry_map = collision_data.geometry_map;
-      penetration.id_A = encoding_A.id(geometry_map);
-      penetration.id_B = encoding_B.id(geometry_map);
-      penetration.p_WCa = p_WAc;
-      penetration.p_WCb = p_WBc;
-      penetration.nhat_BA_W = drake_normal;
-      // Guarantee fixed ordering of pair (A, B). Swap the ids and points on
-      // surfaces and then flip the normal.
-      if (penetration.id_B < penetration.id_A) {
-        std::swap(penetration.id_A, penetration.id_B);
-        std::swap(penetration.p_WCa, penetration.p_WCb);
-        penetration.nhat_BA_W = -penetration.nhat_BA_W;
+// Computes the penetration (if any) for a single candidate pair produced by
+// the broadphase, retrieving a *single* contact. The pair is assumed to have
+// already passed collision filtering.
+optional<PenetrationAsPointPair<double>> CalcNarrowphasePenetration(
+    const fcl::CollisionObjectd& fcl_object_A,
+    const fcl::CollisionObjectd& fcl_object_B,
+    const std::vector<GeometryId>& geometry_map,
+    const fcl::CollisionRequestd& request) {
+  // This function only works for a single contact, this confirms a request
+  // hasn't been made for more contacts.
+  DRAKE_ASSERT(request.num_max_contacts == 1);
+  fcl::CollisionResultd result;
+
+  // Perform nearphase collision detection
+  fcl::collide(&fcl_object_A, &fcl_object_B, request, result);
+
+  if (!result.isCollision()) return nullopt;
+
+  // NOTE: This assumes that the request is configured to use a single
+  // contact.
+  const fcl::Contactd& contact = result.getContact(0);
+  //  By convention, Drake requires the contact normal to point out of B and
+  //  into A. FCL uses the opposite convention.
+  Vector3d drake_normal = -contact.normal;
+
+  // Signed distance is negative when penetration depth is positive.
+  double depth = contact.penetration_depth;
+
+  // FCL returns a single contact point centered between the two penetrating
+  // surfaces. PenetrationAsPointPair expects
+  // two, one on the surface of body A (Ac) and one on the surface of body B
+  // (Bc). Choose points along the line defined by the contact point and
+  // normal, equidistant to the contact point. Recall that signed_distance
+  // is strictly non-positive, so signed_distance * drake_normal points out
+  // of A and into B.
+  Vector3d p_WAc = contact.pos - 0.5 * depth * drake_normal;
+  Vector3d p_WBc = contact.pos + 0.5 * depth * drake_normal;
+
+  PenetrationAsPointPair<double> penetration;
+  penetration.depth = depth;
+  // The engine doesn't know geometry ids; it returns engine indices. The
+  // caller must map engine indices to geometry ids.
+  penetration.id_A = EncodedData(fcl_object_A).id(geometry_map);
+  penetration.id_B = EncodedData(fcl_object_B).id(geometry_map);
+  penetration.p_WCa = p_WAc;
+  penetration.p_WCb = p_WBc;
+  penetration.nhat_BA_W = drake_normal;
+  // Guarantee fixed ordering of pair (A, B). Swap the ids and points on
+  // surfaces and then flip the normal.
+  if (penetration.id_B < penetration.id_A) {
+    std::swap(penetration.id_A, penetration.id_B);
+    std::swap(penetration.p_WCa, penetration.p_WCb);
+    penetration.nhat_BA_W = -penetration.nhat_BA_W;
+  }
+  return penetration;
+}
+
+// Returns an upper bound on how far any point of `fcl_object_B` can have
+// moved, measured in object A's frame, between the two relative poses. Points
+// of A are fixed in A's frame, so this bounds the worst-case decrease of the
+// separation distance between the two objects. The bound combines the
+// translation of B's origin with the arc swept by B's farthest point: for a
+// rotation by angle θ, a point at radius r moves by a chord of length
+// 2r·sin(θ/2) ≤ rθ.
+double RelativeMotionUpperBound(const Isometry3d& X_AB_old,
+                                const Isometry3d& X_AB_new,
+                                const fcl::CollisionObjectd& fcl_object_B) {
+  const double translation =
+      (X_AB_new.translation() - X_AB_old.translation()).norm();
+  const Eigen::AngleAxisd rotation(X_AB_old.linear().transpose() *
+                                   X_AB_new.linear());
+  // The farthest point of B from its origin lies within the sphere of radius
+  // aabb_radius centered at aabb_center (both precomputed by fcl).
+  const fcl::CollisionGeometryd& geometry_B =
+      *fcl_object_B.collisionGeometry();
+  const double radius_B =
+      geometry_B.aabb_center.norm() + geometry_B.aabb_radius;
+  return translation + rotation.angle() * radius_B;
+}
+
+// Batch ray casting.  --------------------------------------------------------
+//
+// Analytic ray-vs-primitive intersection kernels used by CastRays(). Each
+// kernel takes the ray origin and unit-length direction expressed in the
+// geometry's frame G and returns the parametric distance t >= 0 along the ray
+// to the first surface intersection, or nullopt on a miss. A ray whose origin
+// lies inside the shape reports t = 0 (the behavior of a range sensor
+// embedded in geometry).
+
+optional<double> RayHitSphere(const Vector3d& p_GO, const Vector3d& d_G,
+                              double radius) {
+  // Solve |p_GO + t·d_G|² = r²; the geometry frame origin is the center.
+  const double b = p_GO.dot(d_G);
+  const double c = p_GO.squaredNorm() - radius * radius;
+  if (c <= 0) return 0.0;
+  const double discriminant = b * b - c;
+  if (discriminant < 0) return nullopt;
+  const double t = -b - std::sqrt(discriminant);
+  if (t < 0) return nullopt;  // The sphere lies behind the origin.
+  return t;
+}
+
+optional<double> RayHitBox(const Vector3d& p_GO, const Vector3d& d_G,
+                           const Vector3d& side) {
+  // The classic slab test; the box spans ±side/2 in its own frame. The
+  // running [t_min, t_max] interval starts at [0, ∞) so a hit behind the
+  // origin is rejected and an interior origin yields t_min = 0.
+  double t_min = 0.0;
+  double t_max = std::numeric_limits<double>::infinity();
+  for (int i = 0; i < 3; ++i) {
+    const double half = side[i] / 2;
+    if (d_G[i] == 0.0) {
+      if (p_GO[i] < -half || p_GO[i] > half) return nullopt;
+      continue;
+    }
+    double t0 = (-half - p_GO[i]) / d_G[i];
+    double t1 = (half - p_GO[i]) / d_G[i];
+    if (t0 > t1) std::swap(t0, t1);
+    t_min = std::max(t_min, t0);
+    t_max = std::min(t_max, t1);
+    if (t_min > t_max) return nullopt;
+  }
+  return t_min;
+}
+
+optional<double> RayHitCylinder(const Vector3d& p_GO, const Vector3d& d_G,
+                                double radius, double length) {
+  const double half = length / 2;
+  const double radial_sq = p_GO.x() * p_GO.x() + p_GO.y() * p_GO.y();
+  const double radius_sq = radius * radius;
+  if (radial_sq <= radius_sq && std::abs(p_GO.z()) <= half) return 0.0;
+
+  double best = std::numeric_limits<double>::infinity();
+  // The caps: where the ray crosses z = ±half within the radius.
+  if (d_G.z() != 0.0) {
+    for (const double z : {-half, half}) {
+      const double t = (z - p_GO.z()) / d_G.z();
+      if (t < 0) continue;
+      const double x = p_GO.x() + t * d_G.x();
+      const double y = p_GO.y() + t * d_G.y();
+      if (x * x + y * y <= radius_sq) best = std::min(best, t);
+    }
+  }
+  // The barrel: the first root of the radial quadratic, if it lies within
+  // the cylinder's height. (The second root is an exit, never an entry.)
+  const double a = d_G.x() * d_G.x() + d_G.y() * d_G.y();
+  if (a > 0) {
+    const double b = p_GO.x() * d_G.x() + p_GO.y() * d_G.y();
+    const double c = radial_sq - radius_sq;
+    const double discriminant = b * b - a * c;
+    if (discriminant >= 0) {
+      const double t = (-b - std::sqrt(discriminant)) / a;
+      if (t >= 0 && std::abs(p_GO.z() + t * d_G.z()) <= half) {
+        best = std::min(best, t);
       }
-      collision_data.contacts->emplace_back(std::move(penetration));
     }
   }
+  if (best == std::numeric_limits<double>::infinity()) return nullopt;
+  return best;
+}
 
-  // Returning true would tell the broadphase manager to terminate early. Since
-  // we want to find all the collisions present in the model's current
-  // configuration, we return false.
-  return false;
+// Dispatches the given world-frame ray to the kernel for the object's shape.
+// Shapes without a kernel (convex meshes) are transparent to rays.
+// TODO(SeanCurtis-TRI): Add a ray-triangle kernel so convex (and eventually
+// mesh) geometry participates in ray casts.
+optional<double> RayHitObject(const fcl::CollisionObjectd& object,
+                              const Vector3d& p_WO, const Vector3d& d_W) {
+  const fcl::CollisionGeometryd* geometry = object.collisionGeometry().get();
+  // Express the ray in the geometry's frame.
+  const Isometry3d X_GW(object.getTransform().inverse());
+  const Vector3d p_GO = X_GW * p_WO;
+  const Vector3d d_G = X_GW.linear() * d_W;
+  switch (geometry->getNodeType()) {
+    case fcl::GEOM_SPHERE:
+      return RayHitSphere(p_GO, d_G,
+                          static_cast<const fcl::Sphered*>(geometry)->radius);
+    case fcl::GEOM_BOX:
+      return RayHitBox(p_GO, d_G,
+                       static_cast<const fcl::Boxd*>(geometry)->side);
+    case fcl::GEOM_CYLINDER: {
+      const auto* cylinder = static_cast<const fcl::Cylinderd*>(geometry);
+      return RayHitCylinder(p_GO, d_G, cylinder->radius, cylinder->lz);
+    }
+    case fcl::GEOM_HALFSPACE: {
+      // The half space is the region n·p ≤ d in the geometry frame.
+      const auto* half_space = static_cast<const fcl::Halfspaced*>(geometry);
+      const double signed_offset = half_space->n.dot(p_GO) - half_space->d;
+      if (signed_offset <= 0) return 0.0;
+      const double denominator = half_space->n.dot(d_G);
+      if (denominator >= 0) return nullopt;  // Pointing away or parallel.
+      return -signed_offset / denominator;
+    }
+    default:
+      return nullopt;
+  }
+}
+
+// A conservative slab test of the world-frame ray against the object's world
+// AABB; returns false only if the ray provably cannot hit the box closer
+// than `t_bound`.
+bool RayMayHitAabb(const fcl::AABB<double>& aabb, const Vector3d& p_WO,
+                   const Vector3d& d_W, double t_bound) {
+  double t_min = 0.0;
+  double t_max = t_bound;
+  for (int i = 0; i < 3; ++i) {
+    if (d_W[i] == 0.0) {
+      if (p_WO[i] < aabb.min_[i] || p_WO[i] > aabb.max_[i]) return false;
+      continue;
+    }
+    double t0 = (aabb.min_[i] - p_WO[i]) / d_W[i];
+    double t1 = (aabb.max_[i] - p_WO[i]) / d_W[i];
+    if (t0 > t1) std::swap(t0, t1);
+    t_min = std::max(t_min, t0);
+    t_max = std::min(t_max, t1);
+    if (t_min > t_max) return false;
+  }
+  return true;
 }
 
 // Returns a copy of the given fcl collision geometry; throws an exception for
@@ -927,6 +1113,198 @@ void BuildTreeFromReference(
   }
 }
 
+// On-disk cache for preprocessed Convex geometry.  ---------------------------
+//
+// Parsing an .obj file with tiny_obj_loader and converting the result into the
+// vertex and face arrays that fcl::Convex consumes dominates the cost of
+// registering a Convex shape. Those arrays depend only on the bytes of the
+// .obj file and the scale factor, so they are memoized on disk in a binary
+// side file written next to the source mesh. The cache is keyed by a hash of
+// the .obj contents; editing the mesh invalidates the cache and the arrays
+// are rebuilt (and the cache rewritten) transparently. Cache writes are best
+// effort -- a read-only mesh directory simply forgoes the warm-start benefit.
+//
+// The file layout is: magic, content hash, scale, vertex count, face-array
+// size, face count (all fixed-width), followed by the raw vertex and face
+// arrays. The cache is a machine-local artifact; no attempt is made to make
+// it portable across architectures.
+
+// Identifies the convex cache file format; bump this value when the layout
+// changes so stale files from older builds are simply rebuilt.
+constexpr uint64_t kConvexCacheMagic = 0x4452414b43565831;  // "DRAKCVX1"
+
+// Returns the path of the cache file that accompanies the given mesh file.
+std::string ConvexCachePath(const std::string& mesh_filename) {
+  return mesh_filename + ".proximity_cache";
+}
+
+// Returns the FNV1a hash of the raw bytes of the named file, or nullopt if
+// the file cannot be read.
+optional<uint64_t> HashFileContents(const std::string& filename) {
+  std::ifstream file(filename, std::ios::binary);
+  if (!file) return nullopt;
+  std::string contents((std::istreambuf_iterator<char>(file)),
+                       std::istreambuf_iterator<char>());
+  if (!file) return nullopt;
+  DefaultHasher hasher;
+  hasher(contents.data(), contents.size());
+  return static_cast<uint64_t>(static_cast<size_t>(hasher));
+}
+
+// Attempts to populate the convex data arrays from the cache file associated
+// with `mesh_filename`. Returns false (leaving the outputs in an unspecified
+// state) if the cache file is missing, was built from different mesh contents
+// or scale, or is corrupt; the caller should then rebuild from the .obj.
+bool ReadConvexCache(const std::string& mesh_filename, uint64_t content_hash,
+                     double scale, std::vector<Vector3d>* vertices,
+                     int* num_faces, std::vector<int>* faces) {
+  std::ifstream file(ConvexCachePath(mesh_filename), std::ios::binary);
+  if (!file) return false;
+
+  uint64_t magic{}, cached_hash{}, vertex_count{}, face_array_size{};
+  int64_t face_count{};
+  double cached_scale{};
+  file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+  file.read(reinterpret_cast<char*>(&cached_hash), sizeof(cached_hash));
+  file.read(reinterpret_cast<char*>(&cached_scale), sizeof(cached_scale));
+  file.read(reinterpret_cast<char*>(&vertex_count), sizeof(vertex_count));
+  file.read(reinterpret_cast<char*>(&face_array_size),
+            sizeof(face_array_size));
+  file.read(reinterpret_cast<char*>(&face_count), sizeof(face_count));
+  if (!file || magic != kConvexCacheMagic || cached_hash != content_hash ||
+      cached_scale != scale) {
+    return false;
+  }
+
+  vertices->resize(vertex_count);
+  faces->resize(face_array_size);
+  *num_faces = static_cast<int>(face_count);
+  file.read(reinterpret_cast<char*>(vertices->data()),
+            vertex_count * sizeof(Vector3d));
+  file.read(reinterpret_cast<char*>(faces->data()),
+            face_array_size * sizeof(int));
+  // A short read means the file was truncated; treat it as a cache miss.
+  return static_cast<bool>(file);
+}
+
+// Writes the convex data arrays to the cache file associated with
+// `mesh_filename`. Failure to write (e.g., a read-only directory) is benign;
+// the partial file (if any) will fail validation on the next read.
+void WriteConvexCache(const std::string& mesh_filename, uint64_t content_hash,
+                      double scale, const std::vector<Vector3d>& vertices,
+                      int num_faces, const std::vector<int>& faces) {
+  std::ofstream file(ConvexCachePath(mesh_filename),
+                     std::ios::binary | std::ios::trunc);
+  if (!file) return;
+
+  const uint64_t vertex_count = vertices.size();
+  const uint64_t face_array_size = faces.size();
+  const int64_t face_count = num_faces;
+  file.write(reinterpret_cast<const char*>(&kConvexCacheMagic),
+             sizeof(kConvexCacheMagic));
+  file.write(reinterpret_cast<const char*>(&content_hash),
+             sizeof(content_hash));
+  file.write(reinterpret_cast<const char*>(&scale), sizeof(scale));
+  file.write(reinterpret_cast<const char*>(&vertex_count),
+             sizeof(vertex_count));
+  file.write(reinterpret_cast<const char*>(&face_array_size),
+             sizeof(face_array_size));
+  file.write(reinterpret_cast<const char*>(&face_count), sizeof(face_count));
+  file.write(reinterpret_cast<const char*>(vertices.data()),
+             vertex_count * sizeof(Vector3d));
+  file.write(reinterpret_cast<const char*>(faces.data()),
+             face_array_size * sizeof(int));
+}
+
+// Simplifies the given convex vertex/face arrays down to (at most)
+// `vertex_budget` vertices using uniform-grid vertex clustering: vertices
+// falling in the same grid cell merge to their centroid and the faces are
+// re-indexed, dropping any face left with fewer than three distinct
+// vertices. The grid starts finer than the budget would strictly allow
+// (occupied cells are usually much sparser than the full grid) and coarsens
+// until the cluster count fits, so the geometric error is bounded by the
+// final cell diagonal. No-op when the mesh already fits the budget.
+void DecimateConvexData(int vertex_budget, std::vector<Vector3d>* vertices,
+                        int* num_faces, std::vector<int>* faces) {
+  const int num_vertices = static_cast<int>(vertices->size());
+  if (num_vertices <= vertex_budget) return;
+
+  Vector3d min_corner = (*vertices)[0];
+  Vector3d max_corner = (*vertices)[0];
+  for (const Vector3d& vertex : *vertices) {
+    min_corner = min_corner.cwiseMin(vertex);
+    max_corner = max_corner.cwiseMax(vertex);
+  }
+  // Guard against degenerate (flat) extents; the cell index math divides.
+  const Vector3d extent =
+      (max_corner - min_corner).cwiseMax(Vector3d::Constant(1e-12));
+
+  std::vector<int> vertex_to_cluster(num_vertices);
+  std::vector<Vector3d> clustered;
+  const int initial_cells =
+      static_cast<int>(std::cbrt(8.0 * vertex_budget)) + 1;
+  for (int cells = initial_cells; cells >= 1; --cells) {
+    std::unordered_map<int64_t, int> cell_to_cluster;
+    std::vector<int> cluster_sizes;
+    clustered.clear();
+    for (int i = 0; i < num_vertices; ++i) {
+      const Vector3d& vertex = (*vertices)[i];
+      int64_t key = 0;
+      for (int axis = 0; axis < 3; ++axis) {
+        const int cell = std::min(
+            static_cast<int>((vertex[axis] - min_corner[axis]) /
+                             extent[axis] * cells),
+            cells - 1);
+        key = key * (cells + 1) + cell;
+      }
+      const auto result =
+          cell_to_cluster.emplace(key, static_cast<int>(clustered.size()));
+      if (result.second) {
+        clustered.push_back(Vector3d::Zero());
+        cluster_sizes.push_back(0);
+      }
+      const int cluster = result.first->second;
+      vertex_to_cluster[i] = cluster;
+      clustered[cluster] += vertex;
+      ++cluster_sizes[cluster];
+    }
+    if (static_cast<int>(clustered.size()) <= vertex_budget) {
+      for (size_t c = 0; c < clustered.size(); ++c) {
+        clustered[c] /= cluster_sizes[c];
+      }
+      break;
+    }
+    // A single cell merges everything, so the loop always terminates with a
+    // cluster count within the budget.
+  }
+
+  // Re-index the faces against the clusters, dropping degenerate faces.
+  std::vector<int> new_faces;
+  int new_num_faces = 0;
+  size_t cursor = 0;
+  std::vector<int> polygon;
+  for (int f = 0; f < *num_faces; ++f) {
+    const int count = (*faces)[cursor++];
+    polygon.clear();
+    for (int v = 0; v < count; ++v) {
+      const int cluster = vertex_to_cluster[(*faces)[cursor++]];
+      if (std::find(polygon.begin(), polygon.end(), cluster) ==
+          polygon.end()) {
+        polygon.push_back(cluster);
+      }
+    }
+    if (static_cast<int>(polygon.size()) >= 3) {
+      new_faces.push_back(static_cast<int>(polygon.size()));
+      new_faces.insert(new_faces.end(), polygon.begin(), polygon.end());
+      ++new_num_faces;
+    }
+  }
+
+  *vertices = std::move(clustered);
+  *num_faces = new_num_faces;
+  *faces = std::move(new_faces);
+}
+
 }  // namespace
 
 // The implementation class for the fcl engine. Each of these functions
@@ -955,7 +1333,11 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     // Build new AABB trees from the input AABB trees.
     BuildTreeFromReference(other.dynamic_tree_, object_map, &dynamic_tree_);
     BuildTreeFromReference(other.anchored_tree_, object_map, &anchored_tree_);
+    // The reference build registers objects one at a time; re-pack lazily.
+    anchored_tree_needs_bake_ = true;
     collision_filter_ = other.collision_filter_;
+    narrowphase_thread_count_ = other.narrowphase_thread_count_;
+    convex_vertex_budget_ = other.convex_vertex_budget_;
   }
 
   // Only the copy constructor is used to facilitate copying of the parent
@@ -979,10 +1361,14 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     CopyFclObjectsOrThrow(dynamic_objects_, &engine->dynamic_objects_,
                           &object_map);
     engine->collision_filter_ = this->collision_filter_;
+    engine->narrowphase_thread_count_ = this->narrowphase_thread_count_;
+    engine->convex_vertex_budget_ = this->convex_vertex_budget_;
 
     // Build new AABB trees from the input AABB trees.
     BuildTreeFromReference(dynamic_tree_, object_map, &engine->dynamic_tree_);
     BuildTreeFromReference(anchored_tree_, object_map, &engine->anchored_tree_);
+    // The reference build registers objects one at a time; re-pack lazily.
+    engine->anchored_tree_needs_bake_ = true;
 
     return engine;
   }
@@ -1013,6 +1399,9 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     shape.Reify(this, &fcl_object);
     fcl_object->setTransform(X_WG);
     anchored_tree_.registerObject(fcl_object.get());
+    // The tree will be rebuilt in packed form on the next query; see
+    // BakeAnchoredTreeIfNeeded().
+    anchored_tree_needs_bake_ = true;
     ProximityIndex proximity_index(static_cast<int>(anchored_objects_.size()));
     EncodedData encoding(index, false /* is dynamic */);
     encoding.store_in(fcl_object.get());
@@ -1035,9 +1424,14 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
   optional<GeometryIndex> RemoveGeometry(ProximityIndex index,
                                          bool is_dynamic) {
+    // Removal reuses encoded indices (the last object is moved into the
+    // vacated slot), which would leave the witness cache keyed to the wrong
+    // geometry. Start it cold; it repopulates on the next query.
+    witness_cache_.clear();
     if (is_dynamic) {
       return RemoveGeometry(index, &dynamic_tree_, &dynamic_objects_);
     } else {
+      anchored_tree_needs_bake_ = true;
       return RemoveGeometry(index, &anchored_tree_, &anchored_objects_);
     }
   }
@@ -1056,6 +1450,53 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
   double distance_tolerance() const { return distance_tolerance_; }
 
+  void set_narrowphase_thread_count(int count) {
+    DRAKE_DEMAND(count > 0);
+    narrowphase_thread_count_ = count;
+  }
+
+  int narrowphase_thread_count() const { return narrowphase_thread_count_; }
+
+  void set_convex_vertex_budget(int budget) {
+    // Four vertices (a tetrahedron) is the smallest solid approximation.
+    DRAKE_DEMAND(budget == 0 || budget >= 4);
+    convex_vertex_budget_ = budget;
+  }
+
+  int convex_vertex_budget() const { return convex_vertex_budget_; }
+
+  // Rebuilds the anchored broadphase tree if anchored geometry has been added
+  // or removed since the last query. Anchored objects never move, so instead
+  // of keeping the incrementally grown tree (whose shape reflects the
+  // registration order), the objects are re-registered in one batch, which
+  // triggers fcl's bottom-up bulk construction and yields a tightly packed,
+  // balanced static BVH. Pose updates never touch this tree, so the bake
+  // happens only when the anchored geometry actually changes. Queries
+  // traverse it dynamic-vs-static only; anchored-vs-anchored pairs are never
+  // generated (see the existing dynamic/anchored tree split).
+  // A copied engine starts un-baked (see the copy constructor), so baked
+  // snapshots queried from multiple threads can reach this concurrently from
+  // their first queries; the mutex makes the lazy bake single-writer, and
+  // the atomic flag lets the already-baked steady state skip the lock.
+  void BakeAnchoredTreeIfNeeded() const {
+    if (!anchored_tree_needs_bake_.load(std::memory_order_acquire)) return;
+    std::lock_guard<std::mutex> lock(anchored_tree_bake_mutex_);
+    if (!anchored_tree_needs_bake_.load(std::memory_order_relaxed)) return;
+    auto& tree = const_cast<fcl::DynamicAABBTreeCollisionManager<double>&>(
+        anchored_tree_);
+    tree.clear();
+    if (!anchored_objects_.empty()) {
+      std::vector<fcl::CollisionObject<double>*> objects;
+      objects.reserve(anchored_objects_.size());
+      for (const auto& object : anchored_objects_) {
+        objects.push_back(object.get());
+      }
+      tree.registerObjects(objects);
+      tree.setup();
+    }
+    anchored_tree_needs_bake_.store(false, std::memory_order_release);
+  }
+
   // TODO(SeanCurtis-TRI): I could do things here differently a number of ways:
   //  1. I could make this move semantics (or swap semantics).
   //  2. I could simply have a method that returns a mutable reference to such
@@ -1063,11 +1504,21 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   void UpdateWorldPoses(const std::vector<Isometry3<T>>& X_WG,
                         const std::vector<GeometryIndex>& indices) {
     DRAKE_DEMAND(indices.size() == dynamic_objects_.size());
+    // Incremental broadphase maintenance: each fcl object already stores its
+    // current pose, so geometries whose poses are unchanged are skipped and
+    // only the moved leaves are refit in the AABB tree. When nothing has
+    // moved the tree update is elided entirely, making the cost of a pose
+    // update proportional to scene *motion* rather than scene *size*.
+    std::vector<fcl::CollisionObject<double>*> moved;
     for (size_t i = 0; i < indices.size(); ++i) {
-      dynamic_objects_[i]->setTransform(convert(X_WG[indices[i]]));
-      dynamic_objects_[i]->computeAABB();
+      const Isometry3<double> X_WG_d = convert(X_WG[indices[i]]);
+      fcl::CollisionObject<double>& object = *dynamic_objects_[i];
+      if (object.getTransform().matrix() == X_WG_d.matrix()) continue;
+      object.setTransform(X_WG_d);
+      object.computeAABB();
+      moved.push_back(&object);
     }
-    dynamic_tree_.update();
+    if (!moved.empty()) dynamic_tree_.update(moved);
   }
 
   // Implementation of ShapeReifier interface
@@ -1178,54 +1629,85 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   }
 
   void ImplementGeometry(const Convex& convex, void* user_data) override {
-    // We use tiny_obj_loader to read the .obj file of the convex shape.
-    tinyobj::attrib_t attrib;
-    std::vector<tinyobj::shape_t> shapes;
-    std::vector<tinyobj::material_t> materials;
-    std::string err;
-    // We keep polygonal faces without triangulating them. Some algorithms for
-    // convex geometry perform better with fewer faces.
-    bool do_tinyobj_triangulation = false;
-    // We use default value (NULL) for the base directory of .mtl file (material
-    // description), so it will be searched from the working directory.
-    const char* mtl_basedir = nullptr;
-    bool ret = tinyobj::LoadObj(&attrib, &shapes, &materials, &err,
-        convex.filename().c_str(), mtl_basedir, do_tinyobj_triangulation);
-    if (!ret || !err.empty()) {
-      throw std::runtime_error("Error parsing file '" + convex.filename() +
-          "' : " + err);
-    }
+    std::vector<Vector3d> vertices;
+    int num_faces{};
+    std::vector<int> faces;
 
-    // TODO(DamrongGuoy) Check that the input is a valid convex polyhedron.
-    // 1. Each face is a planar polygon.
-    // 2. Each face is a convex polygon.
-    // 3. The polyhedron is convex.
+    // The preprocessed vertex and face arrays are cached on disk next to the
+    // .obj file so that warm restarts skip the parse entirely; see the cache
+    // helpers above. If the .obj cannot be read, the hash comes back empty
+    // and we fall through to the parse below for its error message.
+    const optional<uint64_t> content_hash =
+        HashFileContents(convex.filename());
+    const bool cache_hit =
+        content_hash &&
+        ReadConvexCache(convex.filename(), *content_hash, convex.scale(),
+                        &vertices, &num_faces, &faces);
+
+    if (!cache_hit) {
+      // We use tiny_obj_loader to read the .obj file of the convex shape.
+      tinyobj::attrib_t attrib;
+      std::vector<tinyobj::shape_t> shapes;
+      std::vector<tinyobj::material_t> materials;
+      std::string err;
+      // We keep polygonal faces without triangulating them. Some algorithms
+      // for convex geometry perform better with fewer faces.
+      bool do_tinyobj_triangulation = false;
+      // We use default value (NULL) for the base directory of .mtl file
+      // (material description), so it will be searched from the working
+      // directory.
+      const char* mtl_basedir = nullptr;
+      bool ret = tinyobj::LoadObj(&attrib, &shapes, &materials, &err,
+          convex.filename().c_str(), mtl_basedir, do_tinyobj_triangulation);
+      if (!ret || !err.empty()) {
+        throw std::runtime_error("Error parsing file '" + convex.filename() +
+            "' : " + err);
+      }
 
-    //
-    // Now we convert tinyobj data for fcl::Convex.
-    //
+      // TODO(DamrongGuoy) Check that the input is a valid convex polyhedron.
+      // 1. Each face is a planar polygon.
+      // 2. Each face is a convex polygon.
+      // 3. The polyhedron is convex.
 
-    if (shapes.size() != 1) {
-      throw std::runtime_error("For Convex geometry, the .obj file must have "
-                               "one and only one object defined in it.");
-    }
+      //
+      // Now we convert tinyobj data for fcl::Convex.
+      //
 
-    std::vector<Vector3d> vertices =
-        TinyObjToFclVertices(attrib, convex.scale());
+      if (shapes.size() != 1) {
+        throw std::runtime_error("For Convex geometry, the .obj file must "
+                                 "have one and only one object defined in "
+                                 "it.");
+      }
 
-    const tinyobj::mesh_t& mesh = shapes[0].mesh;
+      vertices = TinyObjToFclVertices(attrib, convex.scale());
 
-    // We will have `faces.size()` larger than the number of faces. For each
-    // face_i, the vector `faces` contains both the number and indices of its
-    // vertices:
-    //     faces = { n0, v0_0,v0_1,...,v0_n0-1,
-    //               n1, v1_0,v1_1,...,v1_n1-1,
-    //               n2, v2_0,v2_1,...,v2_n2-1,
-    //               ...}
-    // where n_i is the number of vertices of face_i.
-    //
-    std::vector<int> faces;
-    int num_faces = TinyObjToFclFaces(mesh, &faces);
+      const tinyobj::mesh_t& mesh = shapes[0].mesh;
+
+      // We will have `faces.size()` larger than the number of faces. For each
+      // face_i, the vector `faces` contains both the number and indices of
+      // its vertices:
+      //     faces = { n0, v0_0,v0_1,...,v0_n0-1,
+      //               n1, v1_0,v1_1,...,v1_n1-1,
+      //               n2, v2_0,v2_1,...,v2_n2-1,
+      //               ...}
+      // where n_i is the number of vertices of face_i.
+      //
+      num_faces = TinyObjToFclFaces(mesh, &faces);
+
+      if (content_hash) {
+        WriteConvexCache(convex.filename(), *content_hash, convex.scale(),
+                         vertices, num_faces, faces);
+      }
+    }
+
+    // Proximity geometry doesn't need visual fidelity. When a vertex budget
+    // has been configured, oversized meshes are decimated here, at
+    // registration, so the narrowphase pays for the budget rather than for
+    // the source asset. (The disk cache above stores the full-resolution
+    // arrays; clustering is linear and cheap relative to the parse.)
+    if (convex_vertex_budget_ > 0) {
+      DecimateConvexData(convex_vertex_budget_, &vertices, &num_faces, &faces);
+    }
 
     convex_objects_.emplace_back(move(vertices), num_faces, move(faces));
     ConvexData& object = convex_objects_.back();
@@ -1244,20 +1726,54 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
   std::vector<SignedDistancePair<double>>
   ComputeSignedDistancePairwiseClosestPoints(
-      const std::vector<GeometryId>& geometry_map) const {
-    std::vector<SignedDistancePair<double>> witness_pairs;
-    DistanceData distance_data{&geometry_map, &collision_filter_};
-    distance_data.nearest_pairs = &witness_pairs;
-    distance_data.request.enable_nearest_points = true;
-    distance_data.request.enable_signed_distance = true;
-    distance_data.request.gjk_solver_type = fcl::GJKSolverType::GST_LIBCCD;
-    distance_data.request.distance_tolerance = distance_tolerance_;
-
-    dynamic_tree_.distance(&distance_data, DistanceCallback);
+      const std::vector<GeometryId>& geometry_map,
+      double max_distance) const {
+    fcl::DistanceRequestd request;
+    request.enable_nearest_points = true;
+    request.enable_signed_distance = true;
+    request.gjk_solver_type = fcl::GJKSolverType::GST_LIBCCD;
+    request.distance_tolerance = distance_tolerance_;
+
+    // First collect the collision-filtered candidate pairs from the
+    // broadphase, then dispatch the narrowphase work over them (in parallel
+    // when a thread count greater than one has been configured).
+    BakeAnchoredTreeIfNeeded();
+    PairCollectionData candidates(&collision_filter_);
+    candidates.max_distance = max_distance;
+    dynamic_tree_.distance(&candidates, CollectPairsDistanceCallback);
     dynamic_tree_.distance(
         const_cast<fcl::DynamicAABBTreeCollisionManager<double>*>(
             &anchored_tree_),
-        &distance_data, DistanceCallback);
+        &candidates, CollectPairsDistanceCallback);
+
+    std::vector<SignedDistancePair<double>> witness_pairs =
+        EvaluateNarrowphase<SignedDistancePair<double>>(
+            candidates.pairs, narrowphase_thread_count_,
+            [this, &geometry_map, &request, max_distance](
+                const fcl::CollisionObjectd& fcl_object_A,
+                const fcl::CollisionObjectd& fcl_object_B,
+                std::vector<SignedDistancePair<double>>* buffer) {
+              CalcDistanceWithWitnessCache(fcl_object_A, fcl_object_B,
+                                           geometry_map, request, max_distance,
+                                           buffer);
+            });
+    // The broadphase AABB prune is conservative; drop any survivors whose
+    // exact distance still exceeds the bound.
+    if (max_distance < std::numeric_limits<double>::infinity()) {
+      witness_pairs.erase(
+          std::remove_if(witness_pairs.begin(), witness_pairs.end(),
+                         [max_distance](const SignedDistancePair<double>& p) {
+                           return p.distance > max_distance;
+                         }),
+          witness_pairs.end());
+    }
+    // Guarantee a deterministic result ordering regardless of broadphase
+    // traversal order or thread scheduling.
+    std::sort(witness_pairs.begin(), witness_pairs.end(),
+              [](const SignedDistancePair<double>& a,
+                 const SignedDistancePair<double>& b) {
+                return std::tie(a.id_A, a.id_B) < std::tie(b.id_A, b.id_B);
+              });
     return witness_pairs;
   }
 
@@ -1276,41 +1792,164 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     DistanceFromPointCallbackData data{&query_point, &geometry_map,
                                        threshold, &distances};
 
+    BakeAnchoredTreeIfNeeded();
     anchored_tree_.distance(&query_point, &data, DistanceFromPointCallback);
     dynamic_tree_.distance(&query_point, &data, DistanceFromPointCallback);
 
     return distances;
   }
 
+  std::vector<std::vector<SignedDistanceToPoint<double>>>
+  ComputeSignedDistanceToPoints(
+      const Eigen::Ref<const Matrix3X<double>>& p_WQs,
+      const std::vector<GeometryId>& geometry_map,
+      const double threshold) const {
+    const int num_points = static_cast<int>(p_WQs.cols());
+    std::vector<std::vector<SignedDistanceToPoint<double>>> distances(
+        num_points);
+    const int num_workers =
+        std::max(1, std::min(narrowphase_thread_count_, num_points));
+    if (num_workers == 1) {
+      for (int i = 0; i < num_points; ++i) {
+        distances[i] = ComputeSignedDistanceToPoint(p_WQs.col(i), geometry_map,
+                                                    threshold);
+      }
+      return distances;
+    }
+
+    // Workers claim points through an atomic cursor (matching the candidate
+    // pair dispatch in EvaluateNarrowphase()) and write to disjoint result
+    // slots, so the output is identical to the serial loop above. The AABB
+    // tree traversals are read-only and safe to run concurrently.
+    std::atomic<int> cursor{0};
+    auto work = [&]() {
+      while (true) {
+        const int i = cursor.fetch_add(1);
+        if (i >= num_points) break;
+        distances[i] = ComputeSignedDistanceToPoint(p_WQs.col(i), geometry_map,
+                                                    threshold);
+      }
+    };
+    std::vector<std::thread> workers;
+    workers.reserve(num_workers);
+    for (int i = 0; i < num_workers; ++i) workers.emplace_back(work);
+    for (std::thread& worker : workers) worker.join();
+    return distances;
+  }
+
+  void CastRays(const Eigen::Ref<const Matrix3X<double>>& p_WOs,
+                const Eigen::Ref<const Matrix3X<double>>& ds_W,
+                double max_range,
+                const std::vector<GeometryId>& geometry_map,
+                RayCastResults* results) const {
+    DRAKE_DEMAND(results != nullptr);
+    DRAKE_DEMAND(p_WOs.cols() == ds_W.cols());
+    DRAKE_DEMAND(max_range > 0);
+    const int num_rays = static_cast<int>(p_WOs.cols());
+    results->Resize(num_rays);
+
+    // Gather the scene's collision objects once; each ray prunes with a slab
+    // test against the objects' world AABBs (tightened by the best hit so
+    // far) before running the analytic kernel.
+    std::vector<const fcl::CollisionObjectd*> objects;
+    objects.reserve(dynamic_objects_.size() + anchored_objects_.size());
+    for (const auto& object : dynamic_objects_) objects.push_back(object.get());
+    for (const auto& object : anchored_objects_) {
+      objects.push_back(object.get());
+    }
+
+    auto cast_one = [this, &p_WOs, &ds_W, max_range, &geometry_map, &objects,
+                     results](int i) {
+      const Vector3d p_WO = p_WOs.col(i);
+      const Vector3d d_W = ds_W.col(i).normalized();
+      double best = max_range;
+      const fcl::CollisionObjectd* best_object = nullptr;
+      for (const fcl::CollisionObjectd* object : objects) {
+        if (!RayMayHitAabb(object->getAABB(), p_WO, d_W, best)) continue;
+        const optional<double> t = RayHitObject(*object, p_WO, d_W);
+        if (t && *t < best) {
+          best = *t;
+          best_object = object;
+        }
+      }
+      if (best_object != nullptr) {
+        results->distances[i] = best;
+        results->geometry_ids[i] = EncodedData(*best_object).id(geometry_map);
+      }
+    };
+
+    // Rays write to disjoint result slots, so dispatching them across the
+    // configured narrowphase threads (same atomic-cursor scheme as the other
+    // batched queries) produces output identical to the serial loop.
+    const int num_workers =
+        std::max(1, std::min(narrowphase_thread_count_, num_rays));
+    if (num_workers == 1) {
+      for (int i = 0; i < num_rays; ++i) cast_one(i);
+      return;
+    }
+    std::atomic<int> cursor{0};
+    auto work = [&cast_one, &cursor, num_rays]() {
+      while (true) {
+        const int i = cursor.fetch_add(1);
+        if (i >= num_rays) break;
+        cast_one(i);
+      }
+    };
+    std::vector<std::thread> workers;
+    workers.reserve(num_workers);
+    for (int i = 0; i < num_workers; ++i) workers.emplace_back(work);
+    for (std::thread& worker : workers) worker.join();
+  }
+
 
   std::vector<PenetrationAsPointPair<double>> ComputePointPairPenetration(
       const std::vector<GeometryId>& geometry_map) const {
-    std::vector<PenetrationAsPointPair<double>> contacts;
-    // CollisionData stores references to the provided data structures.
-    CollisionData collision_data{&geometry_map, &collision_filter_};
-    collision_data.contacts = &contacts;
-    collision_data.request.num_max_contacts = 1;
-    collision_data.request.enable_contact = true;
+    fcl::CollisionRequestd request;
+    request.num_max_contacts = 1;
+    request.enable_contact = true;
     // NOTE: As of 5/1/2018 the GJK implementation of Libccd appears to be
     // superior to FCL's "independent" implementation. Furthermore, libccd
     // appears to behave badly if its gjk tolerance is much tighter than
     // 2e-12. Until this changes, we explicitly specify these parameters rather
     // than relying on FCL's defaults.
-    collision_data.request.gjk_tolerance = 2e-12;
-    collision_data.request.gjk_solver_type = fcl::GJKSolverType::GST_LIBCCD;
+    request.gjk_tolerance = 2e-12;
+    request.gjk_solver_type = fcl::GJKSolverType::GST_LIBCCD;
 
-    dynamic_tree_.collide(&collision_data, SingleCollisionCallback);
+    // First collect the collision-filtered candidate pairs from the
+    // broadphase, then dispatch the narrowphase work over them (in parallel
+    // when a thread count greater than one has been configured).
+    BakeAnchoredTreeIfNeeded();
+    PairCollectionData candidates(&collision_filter_);
+    dynamic_tree_.collide(&candidates, CollectPairsCallback);
 
     // NOTE: The interface to DynamicAABBTreeCollisionManager::collide
     // requires the input collision manager pointer to be *non* const.
     // As of 02/06/2018, it appears the only opportunity for modification
     // of the AABB tree (and its contents) occurs in the callback provided.
-    // See the definition of SingleCollisionCallback above to see that no
+    // See the definition of CollectPairsCallback above to see that no
     // modification takes place.
     dynamic_tree_.collide(
         const_cast<fcl::DynamicAABBTreeCollisionManager<double>*>(
             &anchored_tree_),
-        &collision_data, SingleCollisionCallback);
+        &candidates, CollectPairsCallback);
+
+    std::vector<PenetrationAsPointPair<double>> contacts =
+        EvaluateNarrowphase<PenetrationAsPointPair<double>>(
+            candidates.pairs, narrowphase_thread_count_,
+            [this, &geometry_map, &request](
+                const fcl::CollisionObjectd& fcl_object_A,
+                const fcl::CollisionObjectd& fcl_object_B,
+                std::vector<PenetrationAsPointPair<double>>* buffer) {
+              CalcPenetrationWithWitnessCache(fcl_object_A, fcl_object_B,
+                                              geometry_map, request, buffer);
+            });
+    // Guarantee a deterministic result ordering regardless of broadphase
+    // traversal order or thread scheduling.
+    std::sort(contacts.begin(), contacts.end(),
+              [](const PenetrationAsPointPair<double>& a,
+                 const PenetrationAsPointPair<double>& b) {
+                return std::tie(a.id_A, a.id_B) < std::tie(b.id_A, b.id_B);
+              });
     return contacts;
   }
 
@@ -1488,6 +2127,143 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   template <typename>
   friend class ProximityEngine;
 
+  // A per-pair witness record exploiting temporal coherence: if a pair was
+  // separated by `distance` when the relative pose was `X_AB`, and the
+  // relative motion since then (see RelativeMotionUpperBound()) is smaller
+  // than that separation, the pair provably cannot be in contact and the
+  // narrowphase call can be skipped outright.
+  struct WitnessEntry {
+    double distance{};
+    Isometry3d X_AB;
+  };
+
+  // Canonical view of a candidate pair for witness-cache bookkeeping. The
+  // broadphase may hand the same pair in either order from step to step, so
+  // the relative pose is always expressed with the lower encoding as the
+  // reference frame.
+  struct WitnessQuery {
+    SortedPair<uintptr_t> key;
+    Isometry3d X_AB;  // Pose of the second object in the first one's frame.
+    const fcl::CollisionObjectd* second{};
+  };
+
+  static WitnessQuery MakeWitnessQuery(
+      const fcl::CollisionObjectd& fcl_object_A,
+      const fcl::CollisionObjectd& fcl_object_B) {
+    const uintptr_t encoding_A = EncodedData(fcl_object_A).encoded_data();
+    const uintptr_t encoding_B = EncodedData(fcl_object_B).encoded_data();
+    const fcl::CollisionObjectd* first = &fcl_object_A;
+    const fcl::CollisionObjectd* second = &fcl_object_B;
+    if (encoding_B < encoding_A) std::swap(first, second);
+    return WitnessQuery{
+        SortedPair<uintptr_t>(encoding_A, encoding_B),
+        first->getTransform().inverse() * second->getTransform(), second};
+  }
+
+  // Returns the witness entry recorded for the given pair, if any. Safe to
+  // call concurrently with StoreWitnessEntry() from the narrowphase workers.
+  optional<WitnessEntry> FindWitnessEntry(
+      const SortedPair<uintptr_t>& key) const {
+    std::lock_guard<std::mutex> lock(witness_cache_mutex_);
+    auto iter = witness_cache_.find(key);
+    if (iter == witness_cache_.end()) return nullopt;
+    return iter->second;
+  }
+
+  // Records (or refreshes) the witness entry for the given pair.
+  void StoreWitnessEntry(const SortedPair<uintptr_t>& key, double distance,
+                         const Isometry3d& X_AB) const {
+    std::lock_guard<std::mutex> lock(witness_cache_mutex_);
+    witness_cache_[key] = WitnessEntry{distance, X_AB};
+  }
+
+  // Narrowphase penetration for a single candidate pair, consulting (and
+  // maintaining) the witness cache. A cache hit whose separation exceeds the
+  // worst-case relative motion skips fcl entirely. On a narrowphase miss the
+  // separation is measured once so that subsequent steps can keep skipping
+  // the pair until the relative motion could have closed the gap; pairs that
+  // hover just outside contact pay for that measurement, but in coherent
+  // scenes the skipped steps dominate.
+  void CalcPenetrationWithWitnessCache(
+      const fcl::CollisionObjectd& fcl_object_A,
+      const fcl::CollisionObjectd& fcl_object_B,
+      const std::vector<GeometryId>& geometry_map,
+      const fcl::CollisionRequestd& request,
+      std::vector<PenetrationAsPointPair<double>>* buffer) const {
+    const WitnessQuery query = MakeWitnessQuery(fcl_object_A, fcl_object_B);
+    const optional<WitnessEntry> witness = FindWitnessEntry(query.key);
+    if (witness && witness->distance > 0 &&
+        RelativeMotionUpperBound(witness->X_AB, query.X_AB, *query.second) <
+            witness->distance) {
+      return;
+    }
+
+    optional<PenetrationAsPointPair<double>> penetration =
+        CalcNarrowphasePenetration(fcl_object_A, fcl_object_B, geometry_map,
+                                   request);
+    if (penetration) {
+      // A non-positive "separation" never triggers the skip; storing it
+      // simply keeps the relative-pose reference fresh.
+      StoreWitnessEntry(query.key, -penetration->depth, query.X_AB);
+      buffer->emplace_back(std::move(*penetration));
+      return;
+    }
+
+    // Half spaces are excluded: fcl has no distance support for them, so a
+    // meaningful separation cannot be recorded and those pairs simply run
+    // the full narrowphase every step, as before.
+    if (fcl_object_A.collisionGeometry()->getNodeType() ==
+            fcl::GEOM_HALFSPACE ||
+        fcl_object_B.collisionGeometry()->getNodeType() ==
+            fcl::GEOM_HALFSPACE) {
+      return;
+    }
+    fcl::DistanceRequestd distance_request;
+    distance_request.enable_nearest_points = true;
+    distance_request.enable_signed_distance = true;
+    distance_request.gjk_solver_type = fcl::GJKSolverType::GST_LIBCCD;
+    distance_request.distance_tolerance = distance_tolerance_;
+    fcl::DistanceResultd result;
+    ComputeNearphaseDistance(&fcl_object_A, &fcl_object_B, geometry_map,
+                             distance_request, &result);
+    StoreWitnessEntry(query.key, result.min_distance, query.X_AB);
+  }
+
+  // Narrowphase signed distance for a single candidate pair, consulting (and
+  // maintaining) the witness cache. The cache can only prune work when a
+  // finite `max_distance` is in play: a pair whose cached separation minus
+  // the worst-case relative motion still exceeds the bound would be culled
+  // from the results anyway.
+  void CalcDistanceWithWitnessCache(
+      const fcl::CollisionObjectd& fcl_object_A,
+      const fcl::CollisionObjectd& fcl_object_B,
+      const std::vector<GeometryId>& geometry_map,
+      const fcl::DistanceRequestd& request, double max_distance,
+      std::vector<SignedDistancePair<double>>* buffer) const {
+    const WitnessQuery query = MakeWitnessQuery(fcl_object_A, fcl_object_B);
+    if (max_distance < std::numeric_limits<double>::infinity()) {
+      const optional<WitnessEntry> witness = FindWitnessEntry(query.key);
+      if (witness &&
+          witness->distance - RelativeMotionUpperBound(
+                                  witness->X_AB, query.X_AB, *query.second) >
+              max_distance) {
+        return;
+      }
+    }
+
+    SignedDistancePair<double> witness_pair = CalcNarrowphaseDistance(
+        fcl_object_A, fcl_object_B, geometry_map, request);
+    // See CalcPenetrationWithWitnessCache() for why half spaces are excluded
+    // from the cache.
+    if (fcl_object_A.collisionGeometry()->getNodeType() !=
+            fcl::GEOM_HALFSPACE &&
+        fcl_object_B.collisionGeometry()->getNodeType() !=
+            fcl::GEOM_HALFSPACE) {
+      StoreWitnessEntry(query.key, witness_pair.distance, query.X_AB);
+    }
+    buffer->emplace_back(std::move(witness_pair));
+  }
+
   // Removes the geometry with the given proximity index from the given tree. It
   // potentially moves another object to take its slot in the vector of objects
   // to maintain a contiguous memory block.
@@ -1543,9 +2319,19 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // source owns a _contiguous_ block of engine indices.
   std::vector<std::unique_ptr<fcl::CollisionObject<double>>> dynamic_objects_;
 
-  // The tree containing all of the anchored geometry.
+  // The tree containing all of the anchored geometry. Because anchored
+  // geometry never moves, the tree is baked into a packed, bottom-up built
+  // BVH on the first query after the anchored geometry set changes; see
+  // BakeAnchoredTreeIfNeeded().
   fcl::DynamicAABBTreeCollisionManager<double> anchored_tree_;
 
+  // Whether anchored geometry has been added or removed since the anchored
+  // tree was last baked. Atomic, and the bake itself mutex-guarded, because
+  // const queries running concurrently on a copied engine race to perform
+  // the first bake; see BakeAnchoredTreeIfNeeded().
+  mutable std::atomic<bool> anchored_tree_needs_bake_{false};
+  mutable std::mutex anchored_tree_bake_mutex_;
+
   // All of the *anchored* collision elements (spanning *all* sources). Their
   // AnchoredGeometryIndex maps to their position in *this* vector.
   std::vector<std::unique_ptr<fcl::CollisionObject<double>>> anchored_objects_;
@@ -1573,6 +2359,24 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // The tolerance that determines when the iterative process would terminate.
   // @see ProximityEngine::set_distance_tolerance() for more details.
   double distance_tolerance_{1E-6};
+
+  // The number of threads across which narrowphase evaluation is dispatched.
+  // @see ProximityEngine::set_narrowphase_thread_count() for more details.
+  int narrowphase_thread_count_{1};
+
+  // The vertex budget applied to convex meshes at registration (zero
+  // disables decimation). @see ProximityEngine::set_convex_vertex_budget().
+  int convex_vertex_budget_{0};
+
+  // Warm-start state for the narrowphase, keyed by the encoded data of the
+  // two objects in a candidate pair (see WitnessEntry). This is purely an
+  // optimization -- it never changes query results -- so it is not copied
+  // with the engine and is discarded wholesale when geometry is removed
+  // (removal reuses encoded indices, which would otherwise leave stale
+  // entries behind). The mutex serializes access from narrowphase workers.
+  mutable std::unordered_map<SortedPair<uintptr_t>, WitnessEntry>
+      witness_cache_;
+  mutable std::mutex witness_cache_mutex_;
 };
 
 template <typename T>
@@ -1666,6 +2470,26 @@ double ProximityEngine<T>::distance_tolerance() const {
   return impl_->distance_tolerance();
 }
 
+template <typename T>
+void ProximityEngine<T>::set_narrowphase_thread_count(int count) {
+  impl_->set_narrowphase_thread_count(count);
+}
+
+template <typename T>
+int ProximityEngine<T>::narrowphase_thread_count() const {
+  return impl_->narrowphase_thread_count();
+}
+
+template <typename T>
+void ProximityEngine<T>::set_convex_vertex_budget(int budget) {
+  impl_->set_convex_vertex_budget(budget);
+}
+
+template <typename T>
+int ProximityEngine<T>::convex_vertex_budget() const {
+  return impl_->convex_vertex_budget();
+}
+
 template <typename T>
 std::unique_ptr<ProximityEngine<AutoDiffXd>> ProximityEngine<T>::ToAutoDiffXd()
     const {
@@ -1683,8 +2507,10 @@ void ProximityEngine<T>::UpdateWorldPoses(
 template <typename T>
 std::vector<SignedDistancePair<double>>
 ProximityEngine<T>::ComputeSignedDistancePairwiseClosestPoints(
-    const std::vector<GeometryId>& geometry_map) const {
-  return impl_->ComputeSignedDistancePairwiseClosestPoints(geometry_map);
+    const std::vector<GeometryId>& geometry_map, double max_distance) const {
+  DRAKE_TRACEPOINT("ProximityEngine::ComputeSignedDistancePairwiseClosest");
+  return impl_->ComputeSignedDistancePairwiseClosestPoints(geometry_map,
+                                                           max_distance);
 }
 
 template <typename T>
@@ -1696,11 +2522,31 @@ ProximityEngine<T>::ComputeSignedDistanceToPoint(
   return impl_->ComputeSignedDistanceToPoint(query, geometry_map, threshold);
 }
 
+template <typename T>
+std::vector<std::vector<SignedDistanceToPoint<double>>>
+ProximityEngine<T>::ComputeSignedDistanceToPoints(
+    const Eigen::Ref<const Matrix3X<double>>& p_WQs,
+    const std::vector<GeometryId>& geometry_map,
+    const double threshold) const {
+  return impl_->ComputeSignedDistanceToPoints(p_WQs, geometry_map, threshold);
+}
+
+template <typename T>
+void ProximityEngine<T>::CastRays(
+    const Eigen::Ref<const Matrix3X<double>>& p_WOs,
+    const Eigen::Ref<const Matrix3X<double>>& ds_W,
+    double max_range,
+    const std::vector<GeometryId>& geometry_map,
+    RayCastResults* results) const {
+  impl_->CastRays(p_WOs, ds_W, max_range, geometry_map, results);
+}
+
 
 template <typename T>
 std::vector<PenetrationAsPointPair<double>>
 ProximityEngine<T>::ComputePointPairPenetration(
     const std::vector<GeometryId>& geometry_map) const {
+  DRAKE_TRACEPOINT("ProximityEngine::ComputePointPairPenetration");
   return impl_->ComputePointPairPenetration(geometry_map);
 }
 
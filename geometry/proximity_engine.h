@@ -10,6 +10,7 @@
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/geometry_index.h"
 #include "drake/geometry/query_results/penetration_as_point_pair.h"
+#include "drake/geometry/query_results/ray_cast_results.h"
 #include "drake/geometry/query_results/signed_distance_pair.h"
 #include "drake/geometry/query_results/signed_distance_to_point.h"
 #include "drake/geometry/shape_specification.h"
@@ -133,6 +134,28 @@ class ProximityEngine {
 
   double distance_tolerance() const;
 
+  /** Sets the number of threads across which narrowphase evaluation of the
+   candidate pairs surviving the broadphase is dispatched (for penetration and
+   pairwise signed distance queries). The default of one evaluates all pairs
+   on the calling thread. Result ordering is deterministic (sorted by pair
+   ids) regardless of the thread count. Must be strictly positive.  */
+  void set_narrowphase_thread_count(int count);
+
+  int narrowphase_thread_count() const;
+
+  /** Sets the vertex budget applied to convex meshes at registration.
+   Proximity geometry rarely needs the fidelity of the visual asset it is
+   derived from: when a budget is set, any Convex shape registered
+   _afterwards_ whose mesh exceeds it is automatically decimated (by grid
+   vertex clustering) down to at most `budget` vertices, bounding the cost
+   of every narrowphase evaluation against it. The decimated shape is a
+   nearby approximation of the source mesh, with error bounded by the
+   clustering cell size. The default of zero disables decimation; otherwise
+   the budget must be at least four (a tetrahedron).  */
+  void set_convex_vertex_budget(int budget);
+
+  int convex_vertex_budget() const;
+
   //@}
 
   /** Updates the poses for all of the dynamic geometries in the engine. It
@@ -167,6 +190,11 @@ class ProximityEngine {
 
    @param[in] geometry_map      A map from geometry _index_ to the corresponding
                                 global geometry identifier.
+   @param[in] max_distance      Pairs whose distance exceeds this bound are
+                                omitted from the results; the broadphase uses
+                                it to prune distant pairs, so tight bounds
+                                make the query local rather than all-pairs.
+                                Defaults to infinity (report every pair).
    @retval signed_distances     A vector populated with per-object-pair signed
                                 distance values (and supporting data).
                                 Note: For a geometry pair (A, B), the supporting
@@ -178,7 +206,8 @@ class ProximityEngine {
    */
   std::vector<SignedDistancePair<double>>
   ComputeSignedDistancePairwiseClosestPoints(
-      const std::vector<GeometryId>& geometry_map) const;
+      const std::vector<GeometryId>& geometry_map,
+      double max_distance = std::numeric_limits<double>::infinity()) const;
 
   /** Performs work in support of GeometryState::ComputeSignedDistanceToPoint().
    @param[in] p_WQ            Position of a query point Q in world frame W.
@@ -194,6 +223,49 @@ class ProximityEngine {
       const Vector3<double>& p_WQ,
       const std::vector<GeometryId>& geometry_map,
       const double threshold = std::numeric_limits<double>::infinity()) const;
+
+  /** Performs work in support of
+   GeometryState::ComputeSignedDistanceToPoints(). Batched variant of
+   ComputeSignedDistanceToPoint(): evaluates one query per column of `p_WQs`,
+   dispatching the points across the configured narrowphase thread count (see
+   set_narrowphase_thread_count()).
+   @param[in] p_WQs           Positions of the query points in world frame W,
+                              one per column.
+   @param[in] geometry_map    A map from geometry _index_ to the corresponding
+                              global geometry identifier.
+   @param[in] threshold       Ignore any object beyond this distance.
+   @retval signed_distances   One result vector per query point, ordered like
+                              the input columns; the i-th entry is exactly
+                              what ComputeSignedDistanceToPoint() would report
+                              for column i.
+   */
+  std::vector<std::vector<SignedDistanceToPoint<double>>>
+  ComputeSignedDistanceToPoints(
+      const Eigen::Ref<const Matrix3X<double>>& p_WQs,
+      const std::vector<GeometryId>& geometry_map,
+      const double threshold = std::numeric_limits<double>::infinity()) const;
+
+  /** Performs work in support of GeometryState::CastRays(). Casts a batch of
+   rays against the scene's geometry, reporting the distance to (and identity
+   of) the first surface each ray strikes. The rays are dispatched across the
+   configured narrowphase thread count (see set_narrowphase_thread_count()).
+   Convex mesh geometry does not yet participate and is transparent to rays.
+   @param[in]  p_WOs         Ray origins in the world frame, one per column.
+   @param[in]  ds_W          Ray directions in the world frame, one per
+                             column, pairwise with `p_WOs`. They need not be
+                             unit length, but must be nonzero.
+   @param[in]  max_range     Hits at or beyond this distance are misses.
+   @param[in]  geometry_map  A map from geometry _index_ to the corresponding
+                             global geometry identifier.
+   @param[out] results       The per-ray hit distances and geometry ids; its
+                             arrays are resized to the number of rays. See
+                             RayCastResults.
+   */
+  void CastRays(const Eigen::Ref<const Matrix3X<double>>& p_WOs,
+                const Eigen::Ref<const Matrix3X<double>>& ds_W,
+                double max_range,
+                const std::vector<GeometryId>& geometry_map,
+                RayCastResults* results) const;
   //@}
 
   //----------------------------------------------------------------------------
@@ -1,5 +1,7 @@
 #include "drake/geometry/query_object.h"
 
+#include <memory>
+
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_assert.h"
 #include "drake/geometry/scene_graph.h"
@@ -8,36 +10,62 @@ namespace drake {
 namespace geometry {
 
 template <typename T>
-QueryObject<T>::QueryObject(const QueryObject&)
-    : context_{nullptr}, scene_graph_{nullptr} {}
+QueryObject<T>::QueryObject(const QueryObject& other)
+    : context_{nullptr},
+      scene_graph_{nullptr},
+      baked_state_{other.baked_state_} {
+  // Copying a "live" query object produces a default (dead) one; copying a
+  // "baked" query object shares its immutable snapshot.
+  if (baked_state_ != nullptr) inspector_.set(baked_state_.get());
+}
 
 template <typename T>
-QueryObject<T>& QueryObject<T>::operator=(const QueryObject<T>&) {
+QueryObject<T>& QueryObject<T>::operator=(const QueryObject<T>& other) {
   context_ = nullptr;
   scene_graph_ = nullptr;
+  baked_state_ = other.baked_state_;
+  if (baked_state_ != nullptr) inspector_.set(baked_state_.get());
   return *this;
 }
 
+template <typename T>
+QueryObject<T> QueryObject<T>::MakeBaked() const {
+  ThrowIfDefault();
+
+  QueryObject<T> baked;
+  if (baked_state_ != nullptr) {
+    // Baking a baked object simply shares the existing snapshot.
+    baked.baked_state_ = baked_state_;
+  } else {
+    scene_graph_->FullPoseUpdate(*context_);
+    baked.baked_state_ = std::make_shared<const GeometryState<T>>(
+        context_->get_geometry_state());
+  }
+  baked.inspector_.set(baked.baked_state_.get());
+  return baked;
+}
+
 template <typename T>
 std::vector<PenetrationAsPointPair<double>>
 QueryObject<T>::ComputePointPairPenetration() const {
   ThrowIfDefault();
 
   // TODO(SeanCurtis-TRI): Modify this when the cache system is in place.
-  scene_graph_->FullPoseUpdate(*context_);
+  FullPoseUpdate();
   const GeometryState<T>& state = geometry_state();
   return state.ComputePointPairPenetration();
 }
 
 template <typename T>
 std::vector<SignedDistancePair<double>>
-QueryObject<T>::ComputeSignedDistancePairwiseClosestPoints() const {
+QueryObject<T>::ComputeSignedDistancePairwiseClosestPoints(
+    double max_distance) const {
   ThrowIfDefault();
 
   // TODO(SeanCurtis-TRI): Modify this when the cache system is in place.
-  scene_graph_->FullPoseUpdate(*context_);
-  const GeometryState<T>& state = context_->get_geometry_state();
-  return state.ComputeSignedDistancePairwiseClosestPoints();
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  return state.ComputeSignedDistancePairwiseClosestPoints(max_distance);
 }
 
 template <typename T>
@@ -47,19 +75,49 @@ QueryObject<T>::ComputeSignedDistanceToPoint(
     const double threshold) const {
   ThrowIfDefault();
 
-  scene_graph_->FullPoseUpdate(*context_);
-  const GeometryState<T>& state = context_->get_geometry_state();
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
   return state.ComputeSignedDistanceToPoint(p_WQ, threshold);
 }
 
+template <typename T>
+std::vector<std::vector<SignedDistanceToPoint<double>>>
+QueryObject<T>::ComputeSignedDistanceToPoints(
+    const Eigen::Ref<const Matrix3X<double>>& p_WQs,
+    const double threshold) const {
+  ThrowIfDefault();
+
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  return state.ComputeSignedDistanceToPoints(p_WQs, threshold);
+}
+
+template <typename T>
+void QueryObject<T>::CastRays(
+    const Eigen::Ref<const Matrix3X<double>>& p_WOs,
+    const Eigen::Ref<const Matrix3X<double>>& ds_W,
+    double max_range, RayCastResults* results) const {
+  ThrowIfDefault();
+
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  state.CastRays(p_WOs, ds_W, max_range, results);
+}
+
 template <typename T>
 const GeometryState<T>& QueryObject<T>::geometry_state() const {
-  // TODO(SeanCurtis-TRI): Handle the "baked" query object case.
+  if (baked_state_ != nullptr) return *baked_state_;
   DRAKE_DEMAND(scene_graph_ != nullptr);
   DRAKE_DEMAND(context_ != nullptr);
   return context_->get_geometry_state();
 }
 
+template <typename T>
+void QueryObject<T>::FullPoseUpdate() const {
+  if (baked_state_ != nullptr) return;
+  scene_graph_->FullPoseUpdate(*context_);
+}
+
 }  // namespace geometry
 }  // namespace drake
 
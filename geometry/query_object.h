@@ -7,6 +7,7 @@
 
 #include "drake/geometry/geometry_context.h"
 #include "drake/geometry/query_results/penetration_as_point_pair.h"
+#include "drake/geometry/query_results/ray_cast_results.h"
 #include "drake/geometry/query_results/signed_distance_pair.h"
 #include "drake/geometry/query_results/signed_distance_to_point.h"
 #include "drake/geometry/scene_graph_inspector.h"
@@ -40,7 +41,8 @@ class SceneGraph;
  In addition to not persisting the reference from the output port, the
  %QueryObject shouldn't be copied. Strictly speaking, it is an allowed
  operation, but the result is not live, and any geometry query performed on the
- copy will throw an exception.
+ copy will throw an exception. To capture a persistent, queryable snapshot of
+ the world's geometry, use MakeBaked() instead.
 
  A %QueryObject _cannot_ be converted to a different scalar type. A %QueryObject
  of scalar type S can only be acquired from the output port of a SceneGraph
@@ -63,15 +65,31 @@ class QueryObject {
 
 #ifndef DRAKE_DOXYGEN_CXX
   // NOTE: The copy semantics are provided to be compatible with AbstractValue.
-  // The result will always be a "default" QueryObject (i.e., all pointers are
-  // null). The SceneGraph is responsible for guaranteeing the returned
-  // QueryObject is "live" (via CalcQueryObject()).
+  // Copying a "live" QueryObject produces a "default" QueryObject (i.e., all
+  // pointers are null); the SceneGraph is responsible for guaranteeing the
+  // returned QueryObject is "live" (via CalcQueryObject()). Copying a "baked"
+  // QueryObject (see MakeBaked()) shares its immutable snapshot.
   QueryObject(const QueryObject& other);
   QueryObject& operator=(const QueryObject&);
   // NOTE: The move semantics are implicitly deleted by the copy semantics.
   // There is no sense in "moving" a query object.
 #endif  // DRAKE_DOXYGEN_CXX
 
+  /** Returns a "baked" copy of `this` %QueryObject: a standalone snapshot of
+   the world's geometry whose poses have been fully updated from the current
+   context. The baked object is immutable and detached from the context and
+   SceneGraph -- it remains valid after they change or are destroyed -- and
+   its queries may be invoked from multiple threads concurrently with no
+   external synchronization. Copies of a baked object share the same
+   underlying snapshot, so they are cheap to hand out to worker threads.
+
+   This is the intended mechanism for parallel collision checking: e.g., a
+   sampling-based planner issuing ComputePointPairPenetration() from many
+   threads against a single scene snapshot.
+
+   @throws std::runtime_error if `this` is a default (or dead) %QueryObject. */
+  QueryObject<T> MakeBaked() const;
+
   // Note to developers on adding queries:
   //  All queries should call ThrowIfDefault() before taking any action.
   //  Furthermore, an invocation of that query method should be included in
@@ -176,13 +194,18 @@ class QueryObject {
    filter. We report the distance between dynamic objects, and between dynamic
    and anchored objects. We DO NOT report the distance between two anchored
    objects.
-   @retval near_pairs The signed distance for all unfiltered geometry pairs.
+   @param max_distance Pairs whose signed distance exceeds this bound are
+                       omitted from the results. The bound is also used to
+                       prune distant pairs in the broadphase, so a tight
+                       bound (e.g., a clearance threshold) turns the
+                       all-pairs query into a local one. Defaults to
+                       infinity, i.e., every unfiltered pair is reported.
+   @retval near_pairs The signed distance for all unfiltered geometry pairs
+                      within `max_distance`.
   */
-  // TODO(hongkai.dai): add a distance bound as an optional input, such that the
-  // function doesn't return the pairs whose signed distance is larger than the
-  // distance bound.
   std::vector<SignedDistancePair<double>>
-  ComputeSignedDistancePairwiseClosestPoints() const;
+  ComputeSignedDistancePairwiseClosestPoints(
+      double max_distance = std::numeric_limits<double>::infinity()) const;
 
   // TODO(DamrongGuoy): Improve and refactor documentation of
   // ComputeSignedDistanceToPoint(). Move the common sections into Signed
@@ -258,6 +281,52 @@ class QueryObject {
   ComputeSignedDistanceToPoint(const Vector3<double> &p_WQ,
                                const double threshold
                                = std::numeric_limits<double>::infinity()) const;
+
+  /**
+   Batched variant of ComputeSignedDistanceToPoint(): computes the signed
+   distances from every query point (one per column of `p_WQs`) to each
+   geometry in the world. The points are evaluated in parallel across the
+   proximity engine's configured narrowphase threads, which is the preferred
+   way to evaluate large point samplings (e.g., distance fields) in one call.
+
+   @param[in] p_WQs           Positions of the query points in world frame W,
+                              one per column.
+   @param[in] threshold       We ignore any object beyond this distance.
+                              By default, it is infinity, so we report
+                              distances from every query point to every
+                              object.
+   @retval signed_distances   One result vector per query point, ordered like
+                              the input columns; the i-th entry is exactly
+                              what ComputeSignedDistanceToPoint() would
+                              report for column i.
+   */
+  std::vector<std::vector<SignedDistanceToPoint<double>>>
+  ComputeSignedDistanceToPoints(
+      const Eigen::Ref<const Matrix3X<double>>& p_WQs,
+      const double threshold
+      = std::numeric_limits<double>::infinity()) const;
+
+  /**
+   Casts a batch of rays against the geometry in the world, reporting for
+   each ray the distance to (and the id of) the first surface it strikes.
+   This is the intended entry point for simulated range sensors (lidar,
+   sonar): the rays are evaluated in parallel across the proximity engine's
+   configured narrowphase threads, and the structure-of-arrays result can be
+   preallocated by the caller and reused from scan to scan. Convex mesh
+   geometry does not yet participate and is transparent to rays.
+
+   @param[in]  p_WOs      Ray origins in the world frame, one per column.
+   @param[in]  ds_W       Ray directions in the world frame, one per column,
+                          pairwise with `p_WOs`. They need not be unit
+                          length, but must be nonzero.
+   @param[in]  max_range  Hits at or beyond this distance are misses.
+   @param[out] results    The per-ray hit distances and geometry ids; its
+                          arrays are resized to the number of rays. See
+                          RayCastResults.
+   */
+  void CastRays(const Eigen::Ref<const Matrix3X<double>>& p_WOs,
+                const Eigen::Ref<const Matrix3X<double>>& ds_W,
+                double max_range, RayCastResults* results) const;
   //@}
 
  private:
@@ -268,15 +337,20 @@ class QueryObject {
 
   const GeometryState<T>& geometry_state() const;
 
+  // Flushes pending pose updates into the live context. A baked query object
+  // has no context to flush; its state is fully updated by construction.
+  void FullPoseUpdate() const;
+
   void set(const GeometryContext<T>* context,
            const SceneGraph<T>* scene_graph) {
+    baked_state_.reset();
     context_ = context;
     scene_graph_ = scene_graph;
     inspector_.set(&geometry_state());
   }
 
   void ThrowIfDefault() const {
-    if (!(context_ && scene_graph_)) {
+    if (!(context_ && scene_graph_) && baked_state_ == nullptr) {
       throw std::runtime_error(
           "Attempting to perform query on invalid QueryObject. "
           "Did you copy the QueryObject?");
@@ -308,6 +382,12 @@ class QueryObject {
   // context).
   const GeometryContext<T>* context_{nullptr};
   const SceneGraph<T>* scene_graph_{nullptr};
+
+  // The contents of a "baked" query object (see MakeBaked()): an immutable,
+  // fully pose-updated snapshot of the geometry state, shared among all
+  // copies of the baked object. Null for default and "live" query objects.
+  std::shared_ptr<const GeometryState<T>> baked_state_;
+
   SceneGraphInspector<T> inspector_;
 };
 
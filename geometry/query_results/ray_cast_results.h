@@ -0,0 +1,44 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/geometry/geometry_ids.h"
+
+namespace drake {
+namespace geometry {
+
+/** The results of a batched ray-cast query, stored in structure-of-arrays
+  form so that a caller issuing many rays per cycle (e.g., a simulated lidar)
+  can preallocate the result once and reuse it across queries. The i-th entry
+  of each array corresponds to the i-th input ray.
+
+  A ray that hits geometry reports the distance from the ray origin to the
+  first (nearest) surface intersection in `distances[i]` and the id of the
+  geometry struck in `geometry_ids[i]`. A ray that strikes nothing within the
+  query's range reports an infinite distance and a default-constructed (i.e.,
+  invalid) GeometryId. A ray whose origin lies inside a geometry reports a
+  zero distance against that geometry. */
+struct RayCastResults {
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RayCastResults)
+
+  RayCastResults() = default;
+
+  /** Resizes the arrays to hold `ray_count` results, resetting every entry
+   to the "miss" state. Existing capacity is reused where possible. */
+  void Resize(int ray_count) {
+    distances.assign(ray_count, std::numeric_limits<double>::infinity());
+    geometry_ids.assign(ray_count, GeometryId());
+  }
+
+  /** The distance from each ray's origin to the nearest struck surface;
+   infinity for rays that miss. */
+  std::vector<double> distances;
+
+  /** The id of the geometry each ray struck first; invalid for misses. */
+  std::vector<GeometryId> geometry_ids;
+};
+
+}  // namespace geometry
+}  // namespace drake
@@ -25,6 +25,12 @@ namespace geometry {
 
 class GeometryInstance;
 
+#ifndef DRAKE_DOXYGEN_CXX
+namespace internal {
+struct LoadMessageCache;
+}  // namespace internal
+#endif
+
 template <typename T>
 class GeometryContext;
 
@@ -583,9 +589,12 @@ class SceneGraph final : public systems::LeafSystem<T> {
   // Helper class to register input ports for a source id.
   void MakeSourcePorts(SourceId source_id);
 
-  // Allow the load dispatch to peek into SceneGraph.
+  // Allow the load dispatches to peek into SceneGraph.
   friend void DispatchLoadMessage(const SceneGraph<double>&,
                                   lcm::DrakeLcmInterface*);
+  friend void DispatchLoadMessage(const SceneGraph<double>&,
+                                  lcm::DrakeLcmInterface*,
+                                  internal::LoadMessageCache*);
 
   // Sets the context into the output port value so downstream consumers can
   // perform queries.
@@ -105,6 +105,66 @@ GTEST_TEST(FrameKinematicsVector, WorkingWithValues) {
                               "of the kinematics data id set.")
 }
 
+GTEST_TEST(FrameKinematicsVector, AliasedValues) {
+  SourceId source_id = SourceId::get_new_id();
+  const int kPoseCount = 3;
+  std::vector<FrameId> ids;
+  for (int i = 0; i < kPoseCount; ++i) ids.push_back(FrameId::get_new_id());
+  FramePoseVector<double> poses(source_id, ids);
+
+  // A producer-owned buffer with an extra (unreported) leading entry, to
+  // exercise non-trivial buffer indices. Frame ids[i] maps to buffer slot
+  // i + 1.
+  std::vector<Isometry3<double>> buffer(kPoseCount + 1,
+                                        Isometry3<double>::Identity());
+  for (int i = 0; i < kPoseCount; ++i) {
+    buffer[i + 1].translation() << i, i, i;
+  }
+  std::vector<int> indices{1, 2, 3};
+
+  poses.SetAliasedValues(ids, indices, buffer.data());
+  for (int i = 0; i < kPoseCount; ++i) {
+    EXPECT_TRUE(
+        CompareMatrices(poses.value(ids[i]).matrix(), buffer[i + 1].matrix()));
+  }
+
+  // Zero-copy: mutating the producer's buffer is visible without another
+  // hand-off call.
+  buffer[1].translation() << -1, -1, -1;
+  EXPECT_TRUE(
+      CompareMatrices(poses.value(ids[0]).matrix(), buffer[1].matrix()));
+
+  // Re-submitting the same tables (the steady-state fast path) works.
+  EXPECT_NO_THROW(poses.SetAliasedValues(ids, indices, buffer.data()));
+
+  // Mismatched table lengths throw.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      poses.SetAliasedValues(ids, {1, 2}, buffer.data()), std::runtime_error,
+      "Mismatched alias tables; 3 frame ids but 2 buffer indices.");
+
+  // A table that doesn't cover the constructed id set throws.
+  std::vector<FrameId> wrong_ids{ids[0], ids[1], FrameId::get_new_id()};
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      poses.SetAliasedValues(wrong_ids, indices, buffer.data()),
+      std::runtime_error,
+      "Trying to alias a kinematics value for a frame id that does not "
+      "belong to the kinematics vector: \\d+");
+
+  // A duplicated id throws.
+  std::vector<FrameId> duplicate_ids{ids[0], ids[1], ids[0]};
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      poses.SetAliasedValues(duplicate_ids, indices, buffer.data()),
+      std::runtime_error,
+      "Trying to alias kinematics values for the same id .* multiple times.");
+
+  // clear() releases the alias and returns to the per-frame protocol.
+  poses.clear();
+  Isometry3<double> pose = Isometry3<double>::Identity();
+  pose.translation() << 10, 20, 30;
+  poses.set_value(ids[0], pose);
+  EXPECT_TRUE(CompareMatrices(poses.value(ids[0]).matrix(), pose.matrix()));
+}
+
 GTEST_TEST(FrameKinematicsVector, AutoDiffInstantiation) {
   SourceId source_id = SourceId::get_new_id();
   std::vector<FrameId> ids{FrameId::get_new_id(), FrameId::get_new_id()};
@@ -1209,6 +1209,25 @@ TEST_F(GeometryStateTest, RemoveGeometry) {
   // Confirm that, post removal, updating poses still works.
   EXPECT_NO_THROW(gs_tester_.FinalizePoseUpdate());
 
+  // A full pose update must account for the removal (the internal index-keyed
+  // update plan is rebuilt); confirm a recomputed world pose lands in the
+  // right slot for a geometry that survived the removal.
+  Isometry3<double> offset = Isometry3<double>::Identity();
+  offset.translation() << 0.5, 0, 0;
+  poses.clear();
+  for (int f = 0; f < static_cast<int>(frames_.size()); ++f) {
+    poses.set_value(frames_[f], f == 0 ? offset * X_PF_[f] : X_PF_[f]);
+  }
+  gs_tester_.SetFramePoses(poses);
+  const auto& survivor = gs_tester_.get_geometries().at(geometries_[1]);
+  Isometry3<double> X_WF_moved = offset * X_PF_[0];
+  X_WF_moved.makeAffine();
+  Isometry3<double> X_FG_survivor(X_FG_[1]);
+  X_FG_survivor.makeAffine();
+  EXPECT_TRUE(CompareMatrices(
+      gs_tester_.get_geometry_world_poses()[survivor.index()].matrix(),
+      X_WF_moved.matrix() * X_FG_survivor.matrix()));
+
   // Adding a new geometry should bring the number of total geometries back to
   // the original count.
   GeometryId added_id = geometry_state_.RegisterGeometry(
@@ -1600,6 +1619,30 @@ TEST_F(GeometryStateTest, SetFramePoses) {
         world_poses[i].matrix().block<3, 4>(0, 0),
         (offset * offset * X_FG_[i].matrix()).block<3, 4>(0, 0)));
   }
+
+  // Case 4: Move only the second root frame (f1). Both f0 and f2 report
+  // unchanged poses in their parent frames, but f2's subtree must still track
+  // its moved parent while f0's subtree keeps its previous world poses.
+  Isometry3<double> offset2 = Isometry3<double>::Identity();
+  offset2.translation() << 2, 0, 0;
+  frame_poses[1] = offset2;
+  FramePoseVector<double> poses4 = make_pose_vector();
+  gs_tester_.SetFramePoses(poses4);
+  for (int i = 0; i < kGeometryCount; ++i) {
+    EXPECT_TRUE(
+        CompareMatrices(world_poses[i].matrix().block<3, 4>(0, 0),
+                        (offset * X_FG_[i].matrix()).block<3, 4>(0, 0)));
+  }
+  for (int i = kGeometryCount; i < 2 * kGeometryCount; ++i) {
+    EXPECT_TRUE(
+        CompareMatrices(world_poses[i].matrix().block<3, 4>(0, 0),
+                        (offset2 * X_FG_[i].matrix()).block<3, 4>(0, 0)));
+  }
+  for (int i = 2 * kGeometryCount; i < kFrameCount * kGeometryCount; ++i) {
+    EXPECT_TRUE(CompareMatrices(
+        world_poses[i].matrix().block<3, 4>(0, 0),
+        (offset2 * offset * X_FG_[i].matrix()).block<3, 4>(0, 0)));
+  }
 }
 
 // Test various frame property queries.
@@ -87,6 +87,59 @@ GTEST_TEST(GeometryVisualization, SimpleScene) {
   EXPECT_EQ(geometry.color[3], a);
 }
 
+// Confirms the incremental update: the first call builds the full message,
+// repeat calls against an unchanged scene report "no change", and, after the
+// scene grows, the updated message agrees with a from-scratch build.
+GTEST_TEST(GeometryVisualization, IncrementalLoadMessage) {
+  SceneGraph<double> scene_graph;
+  SourceId source_id = scene_graph.RegisterSource("source");
+  FrameId frame_id = scene_graph.RegisterFrame(
+      source_id, GeometryFrame("frame", Isometry3d::Identity()));
+  GeometryId sphere_id = scene_graph.RegisterGeometry(
+      source_id, frame_id,
+      make_unique<GeometryInstance>(Isometry3d::Identity(),
+                                    make_unique<Sphere>(0.5), "sphere"));
+  scene_graph.AssignRole(source_id, sphere_id,
+                         MakeDrakeVisualizerProperties(Vector4d{1, 0, 0, 1}));
+
+  internal::LoadMessageCache cache;
+  {
+    unique_ptr<Context<double>> context = scene_graph.AllocateContext();
+    const GeometryState<double>& state =
+        dynamic_cast<GeometryContext<double>&>(*context).get_geometry_state();
+    EXPECT_TRUE(GeometryVisualizationImpl::UpdateLoadMessage(state, &cache));
+    ASSERT_EQ(cache.message.num_links, 1);
+    EXPECT_EQ(cache.message.link[0].name, "source::frame");
+    // Nothing has changed since the cache was updated.
+    EXPECT_FALSE(GeometryVisualizationImpl::UpdateLoadMessage(state, &cache));
+  }
+
+  // Grow the scene by one illustrated frame; the update must report a change
+  // and produce the same message a from-scratch build would.
+  FrameId frame2_id = scene_graph.RegisterFrame(
+      source_id, GeometryFrame("frame2", Isometry3d::Identity()));
+  GeometryId box_id = scene_graph.RegisterGeometry(
+      source_id, frame2_id,
+      make_unique<GeometryInstance>(Isometry3d::Identity(),
+                                    make_unique<Box>(1, 1, 1), "box"));
+  scene_graph.AssignRole(source_id, box_id,
+                         MakeDrakeVisualizerProperties(Vector4d{0, 1, 0, 1}));
+  {
+    unique_ptr<Context<double>> context = scene_graph.AllocateContext();
+    const GeometryState<double>& state =
+        dynamic_cast<GeometryContext<double>&>(*context).get_geometry_state();
+    EXPECT_TRUE(GeometryVisualizationImpl::UpdateLoadMessage(state, &cache));
+    const lcmt_viewer_load_robot expected =
+        GeometryVisualizationImpl::BuildLoadMessage(state);
+    ASSERT_EQ(cache.message.num_links, expected.num_links);
+    for (int i = 0; i < expected.num_links; ++i) {
+      EXPECT_EQ(cache.message.link[i].name, expected.link[i].name);
+      EXPECT_EQ(cache.message.link[i].num_geom, expected.link[i].num_geom);
+    }
+    EXPECT_FALSE(GeometryVisualizationImpl::UpdateLoadMessage(state, &cache));
+  }
+}
+
 }  // namespace
 }  // namespace geometry
 }  // namespace drake
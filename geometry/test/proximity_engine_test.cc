@@ -1,5 +1,8 @@
 #include "drake/geometry/proximity_engine.h"
 
+#include <cmath>
+#include <fstream>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -7,6 +10,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/geometry/shape_specification.h"
@@ -209,6 +213,132 @@ GTEST_TEST(ProximityEngineTests, ExceptionTwoObjectsInObjFileForConvex) {
       std::runtime_error, ".*one and only one object.*");
 }
 
+// Tests the on-disk cache of preprocessed Convex data. The first registration
+// of a mesh parses the .obj and writes a cache file next to it; subsequent
+// registrations load the cache and must produce the same geometry. A corrupt
+// cache file must be ignored (and rebuilt), not trusted.
+GTEST_TEST(ProximityEngineTests, ConvexCacheRoundTrip) {
+  // Copy the mesh into a writable directory so the engine can put its cache
+  // file next to it (the resource directory may be read only).
+  const std::string source =
+      drake::FindResourceOrThrow("drake/geometry/test/quad_cube.obj");
+  const std::string mesh_path = temp_directory() + "/quad_cube.obj";
+  {
+    std::ifstream in(source, std::ios::binary);
+    std::ofstream out(mesh_path, std::ios::binary);
+    out << in.rdbuf();
+    ASSERT_TRUE(out.good());
+  }
+
+  // Measures the distance from the convex cube (at the origin) to an anchored
+  // sphere using a freshly constructed engine.
+  auto query_distance = [&mesh_path]() {
+    ProximityEngine<double> engine;
+    engine.AddDynamicGeometry(Convex{mesh_path, 1.0}, GeometryIndex(0));
+    Isometry3<double> sphere_pose = Isometry3<double>::Identity();
+    sphere_pose.translation() << 4, 0, 0;
+    engine.AddAnchoredGeometry(Sphere{0.5}, sphere_pose, GeometryIndex(1));
+    std::vector<Isometry3<double>> poses{Isometry3<double>::Identity()};
+    std::vector<GeometryIndex> indices{GeometryIndex(0)};
+    engine.UpdateWorldPoses(poses, indices);
+    std::vector<GeometryId> geometry_map{GeometryId::get_new_id(),
+                                         GeometryId::get_new_id()};
+    const auto results =
+        engine.ComputeSignedDistancePairwiseClosestPoints(geometry_map);
+    EXPECT_EQ(results.size(), 1);
+    return results.empty() ? std::numeric_limits<double>::quiet_NaN()
+                           : results[0].distance;
+  };
+
+  // Cold start: the .obj is parsed and the cache file written.
+  const double cold_distance = query_distance();
+  // The cube spans x ∈ [-1, 1]; the sphere surface sits at x = 3.5.
+  EXPECT_NEAR(cold_distance, 2.5, 1e-6);
+  const std::string cache_path = mesh_path + ".proximity_cache";
+  EXPECT_TRUE(std::ifstream(cache_path).good());
+
+  // Warm start: the cache is loaded instead of the .obj being re-parsed; the
+  // arrays were written verbatim, so the result must match bit for bit.
+  EXPECT_EQ(query_distance(), cold_distance);
+
+  // A corrupt cache file is detected and rebuilt from the .obj.
+  {
+    std::ofstream spoil(cache_path, std::ios::binary | std::ios::trunc);
+    spoil << "not a cache file";
+  }
+  EXPECT_EQ(query_distance(), cold_distance);
+}
+
+// Tests registration-time decimation of convex proximity meshes: a budget the
+// mesh already satisfies leaves the geometry untouched, and an oversized mesh
+// is reduced to a nearby approximation that still answers queries.
+GTEST_TEST(ProximityEngineTests, ConvexVertexBudget) {
+  // Write a 16-gon prism (32 vertices, well over small budgets) into the temp
+  // directory.
+  const std::string mesh_path = temp_directory() + "/prism.obj";
+  const int n = 16;
+  {
+    std::ofstream obj(mesh_path);
+    for (int ring = 0; ring < 2; ++ring) {
+      const double z = ring == 0 ? -0.5 : 0.5;
+      for (int i = 0; i < n; ++i) {
+        const double theta = 2.0 * M_PI * i / n;
+        obj << "v " << std::cos(theta) << " " << std::sin(theta) << " " << z
+            << "\n";
+      }
+    }
+    // Bottom cap (wound to face -z), top cap, and the side quads.
+    obj << "f";
+    for (int i = n; i >= 1; --i) obj << " " << i;
+    obj << "\n";
+    obj << "f";
+    for (int i = n + 1; i <= 2 * n; ++i) obj << " " << i;
+    obj << "\n";
+    for (int i = 0; i < n; ++i) {
+      const int j = (i + 1) % n;
+      obj << "f " << i + 1 << " " << j + 1 << " " << j + n + 1 << " "
+          << i + n + 1 << "\n";
+    }
+    ASSERT_TRUE(obj.good());
+  }
+
+  // Measures the distance from the prism (at the origin) to a sphere whose
+  // surface sits at x = 4.5, using a freshly constructed engine with the
+  // given budget (zero leaves decimation off).
+  auto query_distance = [&mesh_path](int budget) {
+    ProximityEngine<double> engine;
+    if (budget > 0) engine.set_convex_vertex_budget(budget);
+    engine.AddDynamicGeometry(Convex{mesh_path, 1.0}, GeometryIndex(0));
+    Isometry3<double> sphere_pose = Isometry3<double>::Identity();
+    sphere_pose.translation() << 5, 0, 0;
+    engine.AddAnchoredGeometry(Sphere{0.5}, sphere_pose, GeometryIndex(1));
+    std::vector<Isometry3<double>> poses{Isometry3<double>::Identity()};
+    std::vector<GeometryIndex> indices{GeometryIndex(0)};
+    engine.UpdateWorldPoses(poses, indices);
+    std::vector<GeometryId> geometry_map{GeometryId::get_new_id(),
+                                         GeometryId::get_new_id()};
+    const auto results =
+        engine.ComputeSignedDistancePairwiseClosestPoints(geometry_map);
+    EXPECT_EQ(results.size(), 1);
+    return results.empty() ? std::numeric_limits<double>::quiet_NaN()
+                           : results[0].distance;
+  };
+
+  // The prism has unit radius; its +x vertex is at x = 1.
+  const double full_distance = query_distance(0);
+  EXPECT_NEAR(full_distance, 3.5, 1e-6);
+
+  // A budget the mesh already fits is a no-op: bit-identical result.
+  EXPECT_EQ(query_distance(64), full_distance);
+
+  // An oversized mesh is decimated. Clustering moves vertices by no more
+  // than a cell diagonal, so the answer stays in the neighborhood of the
+  // full-resolution one.
+  const double decimated_distance = query_distance(8);
+  EXPECT_FALSE(std::isnan(decimated_distance));
+  EXPECT_NEAR(decimated_distance, full_distance, 1.5);
+}
+
 // Tests for copy/move semantics.  ---------------------------------------------
 
 // Tests the copy semantics of the ProximityEngine -- the copy is a complete,
@@ -641,7 +771,120 @@ INSTANTIATE_TEST_CASE_P(
     TransformInsideBoxUnique, SignedDistanceToPointTest,
     testing::ValuesIn(GenDistTestTransformInsideBoxUnique()));
 
+// The batched point query must agree, point for point, with the scalar query,
+// regardless of how many worker threads evaluate it.
+GTEST_TEST(ProximityEngineTests, SignedDistanceToPointsBatchMatchesScalar) {
+  ProximityEngine<double> engine;
+  std::vector<GeometryId> geometry_map;
+  Isometry3<double> pose = Isometry3<double>::Identity();
+  engine.AddAnchoredGeometry(Sphere{0.7}, pose, GeometryIndex(0));
+  geometry_map.push_back(GeometryId::get_new_id());
+  pose.translation() << 2, 0, 0;
+  engine.AddAnchoredGeometry(Box{1, 1, 1}, pose, GeometryIndex(1));
+  geometry_map.push_back(GeometryId::get_new_id());
+
+  // A small grid of query points surrounding both shapes.
+  Matrix3X<double> p_WQs(3, 27);
+  int col = 0;
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      for (int k = 0; k < 3; ++k) {
+        p_WQs.col(col++) << -2.0 + 2.0 * i, -2.0 + 2.0 * j, -2.0 + 2.0 * k;
+      }
+    }
+  }
+
+  for (int thread_count : {1, 4}) {
+    engine.set_narrowphase_thread_count(thread_count);
+    const std::vector<std::vector<SignedDistanceToPoint<double>>> batched =
+        engine.ComputeSignedDistanceToPoints(p_WQs, geometry_map);
+    ASSERT_EQ(static_cast<int>(batched.size()), p_WQs.cols());
+    for (int c = 0; c < p_WQs.cols(); ++c) {
+      const std::vector<SignedDistanceToPoint<double>> scalar =
+          engine.ComputeSignedDistanceToPoint(p_WQs.col(c), geometry_map);
+      ASSERT_EQ(batched[c].size(), scalar.size());
+      for (size_t m = 0; m < scalar.size(); ++m) {
+        EXPECT_EQ(batched[c][m].id_G, scalar[m].id_G);
+        EXPECT_EQ(batched[c][m].distance, scalar[m].distance);
+        EXPECT_TRUE(CompareMatrices(batched[c][m].p_GN, scalar[m].p_GN));
+        EXPECT_TRUE(CompareMatrices(batched[c][m].grad_W, scalar[m].grad_W));
+      }
+    }
+  }
+}
 
+// Casts rays against the supported primitives and confirms the analytically
+// expected hit distances and ids, regardless of how many worker threads
+// evaluate the batch.
+GTEST_TEST(ProximityEngineTests, CastRaysAgainstPrimitives) {
+  ProximityEngine<double> engine;
+  std::vector<GeometryId> geometry_map;
+  auto add_anchored = [&](const Shape& shape, const Isometry3<double>& pose) {
+    engine.AddAnchoredGeometry(shape, pose,
+                               GeometryIndex(geometry_map.size()));
+    GeometryId id = GeometryId::get_new_id();
+    geometry_map.push_back(id);
+    return id;
+  };
+
+  Isometry3<double> pose = Isometry3<double>::Identity();
+  const GeometryId sphere_id = add_anchored(Sphere{1.0}, pose);
+  pose.translation() << 10, 0, 0;
+  const GeometryId box_id = add_anchored(Box{2, 2, 2}, pose);
+  pose.translation() << 0, 10, 0;
+  const GeometryId cylinder_id = add_anchored(Cylinder{1, 2}, pose);
+  pose.translation() << 0, 0, -5;
+  const GeometryId half_space_id = add_anchored(HalfSpace{}, pose);
+
+  const int kRayCount = 6;
+  Matrix3X<double> p_WOs(3, kRayCount);
+  Matrix3X<double> ds_W(3, kRayCount);
+  // Ray 0: hits the unit sphere from x = -3; distance 2.
+  p_WOs.col(0) << -3, 0, 0;
+  ds_W.col(0) << 1, 0, 0;
+  // Ray 1: hits the box face at x = 9 from x = 5; distance 4. A non-unit
+  // direction exercises the normalization.
+  p_WOs.col(1) << 5, 0, 0;
+  ds_W.col(1) << 2, 0, 0;
+  // Ray 2: hits the cylinder barrel at y = 9 from y = 5; distance 4.
+  p_WOs.col(2) << 0, 5, 0;
+  ds_W.col(2) << 0, 1, 0;
+  // Ray 3: hits the half space boundary at z = -5 from z = -2; distance 3.
+  p_WOs.col(3) << 20, 20, -2;
+  ds_W.col(3) << 0, 0, -1;
+  // Ray 4: points away from everything; miss.
+  p_WOs.col(4) << 20, -20, 20;
+  ds_W.col(4) << 0, -1, 1;
+  // Ray 5: originates inside the sphere; distance 0.
+  p_WOs.col(5) << 0, 0, 0;
+  ds_W.col(5) << 0, 0, 1;
+
+  const double kInf = std::numeric_limits<double>::infinity();
+  for (int thread_count : {1, 4}) {
+    engine.set_narrowphase_thread_count(thread_count);
+    RayCastResults results;
+    engine.CastRays(p_WOs, ds_W, 100.0, geometry_map, &results);
+    ASSERT_EQ(static_cast<int>(results.distances.size()), kRayCount);
+    const double kEps = 4 * std::numeric_limits<double>::epsilon();
+    EXPECT_NEAR(results.distances[0], 2.0, kEps);
+    EXPECT_EQ(results.geometry_ids[0], sphere_id);
+    EXPECT_NEAR(results.distances[1], 4.0, kEps);
+    EXPECT_EQ(results.geometry_ids[1], box_id);
+    EXPECT_NEAR(results.distances[2], 4.0, kEps);
+    EXPECT_EQ(results.geometry_ids[2], cylinder_id);
+    EXPECT_NEAR(results.distances[3], 3.0, kEps);
+    EXPECT_EQ(results.geometry_ids[3], half_space_id);
+    EXPECT_EQ(results.distances[4], kInf);
+    EXPECT_FALSE(results.geometry_ids[4].is_valid());
+    EXPECT_EQ(results.distances[5], 0.0);
+    EXPECT_EQ(results.geometry_ids[5], sphere_id);
+
+    // A hit beyond max_range is a miss.
+    engine.CastRays(p_WOs, ds_W, 1.5, geometry_map, &results);
+    EXPECT_EQ(results.distances[0], kInf);
+    EXPECT_FALSE(results.geometry_ids[0].is_valid());
+  }
+}
 
 // Penetration tests -- testing data flow; not testing the value of the query.
 
@@ -952,6 +1195,183 @@ TEST_F(SimplePenetrationTest, PenetrationDynamicAndDynamicSingleSource) {
   ExpectPenetration(origin_id, collide_id, ad_engine.get());
 }
 
+// Confirms that the max_distance bound on the pairwise signed distance query
+// culls pairs beyond the bound (and only those).
+GTEST_TEST(ProximityEngineTests, SignedDistanceMaxDistanceCulling) {
+  ProximityEngine<double> engine;
+  const double radius = 0.5;
+
+  // Three spheres on the x-axis at x = 0, 2, and 10. Surface-to-surface
+  // distances: (0, 1) -> 1, (1, 2) -> 7, (0, 2) -> 9.
+  const std::vector<double> x_positions{0, 2, 10};
+  std::vector<GeometryId> geometry_map;
+  std::vector<Isometry3<double>> poses;
+  std::vector<GeometryIndex> indices;
+  for (int i = 0; i < 3; ++i) {
+    engine.AddDynamicGeometry(Sphere{radius}, GeometryIndex(i));
+    geometry_map.push_back(GeometryId::get_new_id());
+    poses.push_back(Isometry3<double>(Translation3d{x_positions[i], 0, 0}));
+    indices.push_back(GeometryIndex(i));
+  }
+  engine.UpdateWorldPoses(poses, indices);
+
+  // The default bound reports every pair.
+  EXPECT_EQ(
+      engine.ComputeSignedDistancePairwiseClosestPoints(geometry_map).size(),
+      3u);
+
+  // A bound of 2 admits only the nearest pair.
+  const std::vector<SignedDistancePair<double>> near_pairs =
+      engine.ComputeSignedDistancePairwiseClosestPoints(geometry_map, 2.0);
+  ASSERT_EQ(near_pairs.size(), 1u);
+  EXPECT_EQ(near_pairs[0].id_A, geometry_map[0]);
+  EXPECT_EQ(near_pairs[0].id_B, geometry_map[1]);
+  EXPECT_NEAR(near_pairs[0].distance, 1.0,
+              std::numeric_limits<double>::epsilon());
+
+  // A bound smaller than every separation reports nothing.
+  EXPECT_EQ(engine.ComputeSignedDistancePairwiseClosestPoints(geometry_map, 0.5)
+                .size(),
+            0u);
+}
+
+// Confirms that dispatching narrowphase evaluation across multiple worker
+// threads produces exactly the same, deterministically ordered results as the
+// serial path.
+GTEST_TEST(ProximityEngineTests, ParallelNarrowphaseDispatch) {
+  ProximityEngine<double> engine;
+  const double radius = 0.5;
+
+  // A chain of spheres along the x-axis, spaced so that each sphere overlaps
+  // only its immediate neighbors. The penetration query produces one contact
+  // per adjacent pair; the signed distance query reports every pair.
+  const int sphere_count = 8;
+  std::vector<GeometryId> geometry_map;
+  std::vector<Isometry3<double>> poses;
+  std::vector<GeometryIndex> indices;
+  for (int i = 0; i < sphere_count; ++i) {
+    engine.AddDynamicGeometry(Sphere{radius}, GeometryIndex(i));
+    geometry_map.push_back(GeometryId::get_new_id());
+    poses.push_back(
+        Isometry3<double>(Translation3d{i * 1.5 * radius, 0, 0}));
+    indices.push_back(GeometryIndex(i));
+  }
+  engine.UpdateWorldPoses(poses, indices);
+
+  EXPECT_EQ(engine.narrowphase_thread_count(), 1);
+  const std::vector<PenetrationAsPointPair<double>> serial_contacts =
+      engine.ComputePointPairPenetration(geometry_map);
+  const std::vector<SignedDistancePair<double>> serial_distances =
+      engine.ComputeSignedDistancePairwiseClosestPoints(geometry_map);
+  ASSERT_EQ(static_cast<int>(serial_contacts.size()), sphere_count - 1);
+  ASSERT_EQ(static_cast<int>(serial_distances.size()),
+            sphere_count * (sphere_count - 1) / 2);
+
+  engine.set_narrowphase_thread_count(4);
+  const std::vector<PenetrationAsPointPair<double>> parallel_contacts =
+      engine.ComputePointPairPenetration(geometry_map);
+  const std::vector<SignedDistancePair<double>> parallel_distances =
+      engine.ComputeSignedDistancePairwiseClosestPoints(geometry_map);
+
+  // Each pair's narrowphase result is computed by the same code in both
+  // paths, so the parallel results must match the serial results bit for bit
+  // and in the same (sorted) order.
+  ASSERT_EQ(parallel_contacts.size(), serial_contacts.size());
+  for (size_t i = 0; i < serial_contacts.size(); ++i) {
+    EXPECT_EQ(parallel_contacts[i].id_A, serial_contacts[i].id_A);
+    EXPECT_EQ(parallel_contacts[i].id_B, serial_contacts[i].id_B);
+    EXPECT_EQ(parallel_contacts[i].depth, serial_contacts[i].depth);
+    EXPECT_TRUE(CompareMatrices(parallel_contacts[i].p_WCa,
+                                serial_contacts[i].p_WCa));
+    EXPECT_TRUE(CompareMatrices(parallel_contacts[i].p_WCb,
+                                serial_contacts[i].p_WCb));
+    EXPECT_TRUE(CompareMatrices(parallel_contacts[i].nhat_BA_W,
+                                serial_contacts[i].nhat_BA_W));
+  }
+  ASSERT_EQ(parallel_distances.size(), serial_distances.size());
+  for (size_t i = 0; i < serial_distances.size(); ++i) {
+    EXPECT_EQ(parallel_distances[i].id_A, serial_distances[i].id_A);
+    EXPECT_EQ(parallel_distances[i].id_B, serial_distances[i].id_B);
+    EXPECT_EQ(parallel_distances[i].distance, serial_distances[i].distance);
+    EXPECT_TRUE(CompareMatrices(parallel_distances[i].p_ACa,
+                                serial_distances[i].p_ACa));
+    EXPECT_TRUE(CompareMatrices(parallel_distances[i].p_BCb,
+                                serial_distances[i].p_BCb));
+  }
+}
+
+// Confirms that the incremental broadphase maintenance in UpdateWorldPoses
+// (refitting only moved leaves and skipping the tree update when no geometry
+// has moved) produces the same query results as a full rebuild would.
+TEST_F(SimplePenetrationTest, IncrementalPoseUpdates) {
+  ProximityIndex origin_index =
+      engine_.AddDynamicGeometry(sphere_, GeometryIndex(0));
+  GeometryId origin_id = GeometryId::get_new_id();
+  geometry_map_.push_back(origin_id);
+  EXPECT_EQ(origin_index, 0);
+
+  ProximityIndex collide_index =
+      engine_.AddDynamicGeometry(sphere_, GeometryIndex(1));
+  GeometryId collide_id = GeometryId::get_new_id();
+  geometry_map_.push_back(collide_id);
+  EXPECT_EQ(collide_index, 1);
+
+  // Move only the second sphere into collision; the first sphere's pose is
+  // unchanged, so only one broadphase leaf is refit.
+  MoveDynamicSphere(collide_index, true /* colliding */);
+  ExpectPenetration(origin_id, collide_id, &engine_);
+
+  // Re-issuing identical poses skips the broadphase update entirely; queries
+  // must still report the same result.
+  MoveDynamicSphere(collide_index, true /* colliding */);
+  ExpectPenetration(origin_id, collide_id, &engine_);
+
+  // Moving the sphere back out of collision refits its leaf again.
+  MoveDynamicSphere(collide_index, false /* not colliding */);
+  ExpectNoPenetration(origin_id, collide_id, &engine_);
+}
+
+// The narrowphase witness cache must never change what queries report: a pair
+// skipped on the strength of its cached separation still counts as "no
+// penetration", and any motion large enough to produce contact must defeat
+// the skip.
+TEST_F(SimplePenetrationTest, WitnessCacheCoherence) {
+  ProximityIndex origin_index =
+      engine_.AddDynamicGeometry(sphere_, GeometryIndex(0));
+  GeometryId origin_id = GeometryId::get_new_id();
+  geometry_map_.push_back(origin_id);
+  EXPECT_EQ(origin_index, 0);
+
+  ProximityIndex collide_index =
+      engine_.AddDynamicGeometry(sphere_, GeometryIndex(1));
+  GeometryId collide_id = GeometryId::get_new_id();
+  geometry_map_.push_back(collide_id);
+  EXPECT_EQ(collide_index, 1);
+
+  // Separated: the first query measures the gap and seeds the cache.
+  MoveDynamicSphere(collide_index, false /* not colliding */);
+  ExpectNoPenetration(origin_id, collide_id, &engine_);
+
+  // Same pose, so zero relative motion; the cached separation skips the
+  // narrowphase but the answer is unchanged.
+  ExpectNoPenetration(origin_id, collide_id, &engine_);
+
+  // The move into contact exceeds the cached separation, so the skip cannot
+  // fire and the contact is reported.
+  MoveDynamicSphere(collide_index, true /* colliding */);
+  ExpectPenetration(origin_id, collide_id, &engine_);
+
+  // Repeated colliding queries keep reporting the contact (a non-positive
+  // cached "separation" never skips).
+  ExpectPenetration(origin_id, collide_id, &engine_);
+
+  // Back out of contact: the gap is re-measured and repeat queries skip
+  // again without changing the answer.
+  MoveDynamicSphere(collide_index, false /* not colliding */);
+  ExpectNoPenetration(origin_id, collide_id, &engine_);
+  ExpectNoPenetration(origin_id, collide_id, &engine_);
+}
+
 // Invokes ExcludeCollisionsWithin in various scenarios which will and won't
 // generate cliques.
 TEST_F(SimplePenetrationTest, ExcludeCollisionsWithinCliqueGeneration) {
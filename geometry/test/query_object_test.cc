@@ -1,6 +1,8 @@
 #include "drake/geometry/query_object.h"
 
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -138,6 +140,62 @@ GTEST_TEST(QueryObjectInspectTest, CreateValidInspector) {
   EXPECT_EQ(inspector.GetFrameId(geometry_id), frame_id);
 }
 
+// Confirms the "baked" query object: it snapshots the scene, outlives the
+// context it was baked from, shares its snapshot across copies, and supports
+// concurrent queries.
+GTEST_TEST(QueryObjectBakeTest, BakedQueriesMatchLive) {
+  SceneGraph<double> scene_graph;
+  SourceId source_id = scene_graph.RegisterSource("source");
+  auto identity = Isometry3<double>::Identity();
+  scene_graph.RegisterAnchoredGeometry(
+      source_id, make_unique<GeometryInstance>(
+                     identity, make_unique<Sphere>(1.0), "sphere"));
+  unique_ptr<Context<double>> context = scene_graph.AllocateContext();
+  auto geo_context = dynamic_cast<GeometryContext<double>*>(context.get());
+  unique_ptr<QueryObject<double>> query_object =
+      QueryObjectTester::MakeQueryObject<double>(geo_context, &scene_graph);
+
+  const Vector3<double> p_WQ{0, 0, 3};
+  const std::vector<SignedDistanceToPoint<double>> live_results =
+      query_object->ComputeSignedDistanceToPoint(p_WQ);
+  ASSERT_EQ(live_results.size(), 1u);
+
+  const QueryObject<double> baked = query_object->MakeBaked();
+  std::vector<SignedDistanceToPoint<double>> baked_results =
+      baked.ComputeSignedDistanceToPoint(p_WQ);
+  ASSERT_EQ(baked_results.size(), 1u);
+  EXPECT_EQ(baked_results[0].distance, live_results[0].distance);
+
+  // A copy of a baked object shares the snapshot and remains queryable --
+  // unlike a copy of a live object.
+  const QueryObject<double> copy{baked};
+  EXPECT_EQ(copy.ComputeSignedDistanceToPoint(p_WQ)[0].distance,
+            live_results[0].distance);
+
+  // The snapshot is independent of the context it was baked from.
+  context.reset();
+  EXPECT_EQ(baked.ComputeSignedDistanceToPoint(p_WQ)[0].distance,
+            live_results[0].distance);
+
+  // Queries on the shared snapshot are safe and consistent across threads.
+  const int kThreadCount = 4;
+  std::vector<int> mismatches(kThreadCount, 0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreadCount; ++t) {
+    threads.emplace_back([&baked, &p_WQ, &live_results, &mismatches, t]() {
+      for (int i = 0; i < 25; ++i) {
+        const auto results = baked.ComputeSignedDistanceToPoint(p_WQ);
+        if (results.size() != 1u ||
+            results[0].distance != live_results[0].distance) {
+          ++mismatches[t];
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  for (int t = 0; t < kThreadCount; ++t) EXPECT_EQ(mismatches[t], 0);
+}
+
 }  // namespace
 }  // namespace geometry
 }  // namespace drake
@@ -1,5 +1,6 @@
 #include "drake/lcm/drake_lcm.h"
 
+#include <stdexcept>
 #include <utility>
 
 #include "drake/common/drake_assert.h"
@@ -27,7 +28,10 @@ DrakeLcm::DrakeLcm(std::string lcm_url)
     : requested_lcm_url_(std::move(lcm_url)),
       lcm_(requested_lcm_url_) {}
 
-DrakeLcm::~DrakeLcm() { receive_thread_.reset(); }
+DrakeLcm::~DrakeLcm() {
+  shard_receive_threads_.clear();
+  receive_thread_.reset();
+}
 
 void DrakeLcm::StartReceiveThread() {
   DRAKE_DEMAND(receive_thread_ == nullptr);
@@ -36,12 +40,23 @@ void DrakeLcm::StartReceiveThread() {
   // Without this, ThreadSanitizer builds may report false positives related to
   // the self-test happening concurrently with the LCM publishing.
   lcm_.getFileno();
+  for (auto& shard_lcm : shard_lcms_) {
+    shard_lcm->getFileno();
+  }
 
-  // Now launch the thread.
+  // Now launch the threads, one per shard with at least one subscription.
   receive_thread_ = std::make_unique<LcmReceiveThread>(&lcm_);
+  for (auto& shard_lcm : shard_lcms_) {
+    shard_receive_threads_.push_back(
+        std::make_unique<LcmReceiveThread>(shard_lcm.get()));
+  }
 }
 
 void DrakeLcm::StopReceiveThread() {
+  for (auto& thread : shard_receive_threads_) {
+    thread->Stop();
+  }
+  shard_receive_threads_.clear();
   if (receive_thread_ != nullptr) {
     receive_thread_->Stop();
     receive_thread_.reset();
@@ -62,10 +77,58 @@ void DrakeLcm::Publish(const std::string& channel, const void* data,
 
 void DrakeLcm::Subscribe(const std::string& channel, HandlerFunction handler) {
   DRAKE_THROW_UNLESS(!channel.empty());
-  handlers_.emplace_back(std::move(handler));
+
+  // Wrap the handler so each dispatch bumps this channel's counter.
+  std::atomic<int64_t>* counter{};
+  {
+    std::lock_guard<std::mutex> lock(metrics_mutex_);
+    auto& slot = channel_message_counts_[channel];
+    if (slot == nullptr) {
+      slot = std::make_unique<std::atomic<int64_t>>(0);
+    }
+    counter = slot.get();
+  }
+  handlers_.emplace_back(
+      [counter, inner = std::move(handler)](const void* data, int size) {
+        counter->fetch_add(1, std::memory_order_relaxed);
+        inner(data, size);
+      });
   // The handlers_ is a std::list so that the context pointers remain stable.
   HandlerFunction* const context = &handlers_.back();
-  lcm_.subscribeFunction(channel, &Callback, context)->setQueueCapacity(1);
+  ::lcm::LCM* const instance = GetShardInstance(channel);
+  instance->subscribeFunction(channel, &Callback, context)->setQueueCapacity(1);
+}
+
+void DrakeLcm::SetChannelDispatchShard(const std::string& channel, int shard) {
+  DRAKE_THROW_UNLESS(!channel.empty());
+  DRAKE_THROW_UNLESS(shard >= 0);
+  if (receive_thread_ != nullptr) {
+    throw std::logic_error(
+        "DrakeLcm::SetChannelDispatchShard(): must be called before "
+        "StartReceiveThread().");
+  }
+  channel_shards_[channel] = shard;
+}
+
+int64_t DrakeLcm::get_received_message_count(const std::string& channel) const {
+  std::lock_guard<std::mutex> lock(metrics_mutex_);
+  const auto iter = channel_message_counts_.find(channel);
+  if (iter == channel_message_counts_.end()) {
+    return 0;
+  }
+  return iter->second->load(std::memory_order_relaxed);
+}
+
+::lcm::LCM* DrakeLcm::GetShardInstance(const std::string& channel) {
+  const auto iter = channel_shards_.find(channel);
+  if (iter == channel_shards_.end() || iter->second == 0) {
+    return &lcm_;
+  }
+  const int shard = iter->second;
+  while (static_cast<int>(shard_lcms_.size()) < shard) {
+    shard_lcms_.push_back(std::make_unique<::lcm::LCM>(requested_lcm_url_));
+  }
+  return shard_lcms_[shard - 1].get();
 }
 
 }  // namespace lcm
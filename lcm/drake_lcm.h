@@ -1,8 +1,13 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <list>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include "lcm/lcm-cpp.hpp"
 
@@ -15,6 +20,11 @@ namespace lcm {
 
 /**
  * A wrapper around a *real* LCM instance.
+ *
+ * Subscriptions may optionally be sharded across several receive threads;
+ * see SetChannelDispatchShard(). Each shard is backed by its own underlying
+ * LCM instance (on the same URL) and its own receive thread, so decoding a
+ * large message on one shard never delays dispatch on another.
  */
 class DrakeLcm : public DrakeLcmInterface {
  public:
@@ -82,11 +92,47 @@ class DrakeLcm : public DrakeLcmInterface {
 
   void Subscribe(const std::string&, HandlerFunction) override;
 
+  /**
+   * Assigns @p channel to receive shard @p shard (see the class overview).
+   * Shard 0 is the primary LCM instance; higher shard numbers are created on
+   * demand when a channel assigned to them is subscribed. Give heavy
+   * channels (or a latency-critical channel that must always be drained
+   * promptly) a shard of their own. Must be called before Subscribe() for
+   * @p channel and before StartReceiveThread().
+   *
+   * @pre `shard` is non-negative.
+   * @throws std::logic_error if the receive threads are already running.
+   */
+  void SetChannelDispatchShard(const std::string& channel, int shard) override;
+
+  /**
+   * Returns the number of messages dispatched so far to subscribers of
+   * @p channel, or zero if the channel has no subscription. Useful for
+   * spotting channels whose decode work is starving a shared shard.
+   */
+  int64_t get_received_message_count(const std::string& channel) const;
+
  private:
+  // Returns the underlying LCM instance that services `channel`, creating
+  // its shard on demand.
+  ::lcm::LCM* GetShardInstance(const std::string& channel);
+
   std::string requested_lcm_url_;
   ::lcm::LCM lcm_;
   std::unique_ptr<LcmReceiveThread> receive_thread_{nullptr};
   std::list<HandlerFunction> handlers_;
+
+  // Sharded dispatch state: the channel-to-shard assignments, the extra LCM
+  // instances (index i serves shard i + 1), and their receive threads.
+  std::map<std::string, int> channel_shards_;
+  std::vector<std::unique_ptr<::lcm::LCM>> shard_lcms_;
+  std::vector<std::unique_ptr<LcmReceiveThread>> shard_receive_threads_;
+
+  // Per-channel dispatch counters. The map is guarded by metrics_mutex_;
+  // the counters themselves are atomics bumped from the receive threads.
+  mutable std::mutex metrics_mutex_;
+  std::map<std::string, std::unique_ptr<std::atomic<int64_t>>>
+      channel_message_counts_;
 };
 
 }  // namespace lcm
@@ -10,6 +10,7 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_optional.h"
 #include "drake/common/drake_throw.h"
+#include "drake/common/unused.h"
 
 namespace drake {
 namespace lcm {
@@ -47,6 +48,37 @@ class DrakeLcmInterface {
   virtual void Publish(const std::string& channel, const void* data,
                        int data_size, optional<double> time_sec) = 0;
 
+  /**
+   * One entry for PublishBatch(): a channel name plus the serialized bytes
+   * of the message to publish on it.  The pointed-to data must remain valid
+   * for the duration of the PublishBatch() call.
+   */
+  struct BatchMessage {
+    std::string channel;
+    const void* data{};
+    int data_size{};
+  };
+
+  /**
+   * Publishes several messages, on possibly different channels, as one batch.
+   * The default implementation simply calls Publish() once per entry, in
+   * order; implementations whose transport can coalesce writes may override
+   * this to flush the whole batch at once.  Prefer this over a loop of
+   * Publish() calls when emitting many small messages per simulation step
+   * (e.g. one per visualization channel).
+   *
+   * @param[in] messages The messages to publish.
+   *
+   * @param[in] time_sec Time in seconds when the publish event occurred.
+   * If unknown, use drake::nullopt or a default-constructed optional.
+   */
+  virtual void PublishBatch(const std::vector<BatchMessage>& messages,
+                            optional<double> time_sec) {
+    for (const BatchMessage& message : messages) {
+      Publish(message.channel, message.data, message.data_size, time_sec);
+    }
+  }
+
   /**
    * Subscribes to an LCM channel without automatic message decoding. The
    * handler will be invoked when a message arrives on channel @p channel.
@@ -56,6 +88,24 @@ class DrakeLcmInterface {
    */
   virtual void Subscribe(const std::string& channel, HandlerFunction) = 0;
 
+  /**
+   * Requests that messages on @p channel be dispatched on receive shard
+   * @p shard.  Implementations that service subscriptions with multiple
+   * receive threads use this to isolate heavy channels (e.g. camera images)
+   * from latency-sensitive ones; assigning a channel of small, urgent
+   * messages its own shard ensures it is never queued behind a large decode.
+   * Shard 0 is the default shard that all channels start on.  The base
+   * implementation dispatches everything on a single shard and ignores this
+   * request.  Must be called before Subscribe() for @p channel to have an
+   * effect.
+   *
+   * @pre `shard` is non-negative.
+   */
+  virtual void SetChannelDispatchShard(const std::string& channel, int shard) {
+    DRAKE_THROW_UNLESS(shard >= 0);
+    unused(channel);
+  }
+
  protected:
   DrakeLcmInterface() = default;
 };
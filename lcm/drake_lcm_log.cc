@@ -1,14 +1,42 @@
 #include "drake/lcm/drake_lcm_log.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <limits>
 #include <utility>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/text_logging.h"
 
 namespace drake {
 namespace lcm {
+namespace {
+
+// The LCM log file format: each event is a 28-byte big-endian header (sync
+// word, event number, timestamp in microseconds, channel length, data
+// length), followed by the channel name and the payload bytes.
+constexpr uint32_t kLogMagic = 0xEDA1DA01;
+constexpr uint64_t kHeaderSize = 28;
+
+uint32_t ReadBigEndian32(const uint8_t* bytes) {
+  return (static_cast<uint32_t>(bytes[0]) << 24) |
+         (static_cast<uint32_t>(bytes[1]) << 16) |
+         (static_cast<uint32_t>(bytes[2]) << 8) |
+         static_cast<uint32_t>(bytes[3]);
+}
+
+uint64_t ReadBigEndian64(const uint8_t* bytes) {
+  return (static_cast<uint64_t>(ReadBigEndian32(bytes)) << 32) |
+         ReadBigEndian32(bytes + 4);
+}
+
+}  // namespace
 
 DrakeLcmLog::DrakeLcmLog(const std::string& file_name, bool is_write,
                          bool overwrite_publish_time_with_system_clock)
@@ -17,13 +45,76 @@ DrakeLcmLog::DrakeLcmLog(const std::string& file_name, bool is_write,
           overwrite_publish_time_with_system_clock) {
   if (is_write_) {
     log_ = std::make_unique<::lcm::LogFile>(file_name, "w");
+    if (!log_->good()) {
+      throw std::runtime_error("Failed to open log file: " + file_name);
+    }
   } else {
-    log_ = std::make_unique<::lcm::LogFile>(file_name, "r");
-    next_event_ = log_->readNextEvent();
+    MapAndIndexLog(file_name);
+  }
+}
+
+DrakeLcmLog::~DrakeLcmLog() {
+  if (map_ != nullptr) {
+    ::munmap(map_, map_size_);
   }
-  if (!log_->good()) {
+}
+
+void DrakeLcmLog::MapAndIndexLog(const std::string& file_name) {
+  const int fd = ::open(file_name.c_str(), O_RDONLY);
+  if (fd < 0) {
     throw std::runtime_error("Failed to open log file: " + file_name);
   }
+  struct stat file_info {};
+  if (::fstat(fd, &file_info) != 0) {
+    ::close(fd);
+    throw std::runtime_error("Failed to stat log file: " + file_name);
+  }
+  map_size_ = file_info.st_size;
+  if (map_size_ > 0) {
+    map_ = ::mmap(nullptr, map_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map_ == MAP_FAILED) {
+      map_ = nullptr;
+      ::close(fd);
+      throw std::runtime_error("Failed to memory-map log file: " + file_name);
+    }
+  }
+  // The mapping keeps the file contents alive without the descriptor.
+  ::close(fd);
+
+  // Walk the event headers once to build the index. Only the 28-byte
+  // headers are touched; channel names are interned so index entries can
+  // share them, and payloads are left untouched in the mapping.
+  const uint8_t* const begin = static_cast<const uint8_t*>(map_);
+  uint64_t offset = 0;
+  while (offset + kHeaderSize <= map_size_) {
+    const uint8_t* const header = begin + offset;
+    if (ReadBigEndian32(header) != kLogMagic) {
+      log()->warn(
+          "DrakeLcmLog: malformed event at byte {} of {}; treating the log "
+          "as ending there.", offset, file_name);
+      break;
+    }
+    const uint64_t timestamp = ReadBigEndian64(header + 12);
+    const uint64_t channel_size = ReadBigEndian32(header + 20);
+    const uint64_t data_size = ReadBigEndian32(header + 24);
+    if (offset + kHeaderSize + channel_size + data_size > map_size_) {
+      log()->warn(
+          "DrakeLcmLog: truncated event at byte {} of {}; treating the log "
+          "as ending there.", offset, file_name);
+      break;
+    }
+    EventIndexEntry entry;
+    entry.timestamp = timestamp;
+    entry.channel =
+        &*channel_names_
+              .emplace(reinterpret_cast<const char*>(header + kHeaderSize),
+                       channel_size)
+              .first;
+    entry.data = header + kHeaderSize + channel_size;
+    entry.data_size = static_cast<int>(data_size);
+    index_.push_back(entry);
+    offset += kHeaderSize + channel_size + data_size;
+  }
 }
 
 void DrakeLcmLog::Publish(const std::string& channel, const void* data,
@@ -62,6 +153,15 @@ void DrakeLcmLog::Subscribe(const std::string& channel,
   subscriptions_.emplace(channel, std::move(handler));
 }
 
+void DrakeLcmLog::SkipFilteredEventsLocked() const {
+  if (!skip_unsubscribed_channels_) return;
+  while (cursor_ < index_.size() &&
+         subscriptions_.find(*index_[cursor_].channel) ==
+             subscriptions_.end()) {
+    ++cursor_;
+  }
+}
+
 double DrakeLcmLog::GetNextMessageTime() const {
   if (is_write_) {
     throw std::logic_error(
@@ -69,10 +169,11 @@ double DrakeLcmLog::GetNextMessageTime() const {
   }
 
   std::lock_guard<std::mutex> lock(mutex_);
-  if (next_event_ == nullptr) {
+  SkipFilteredEventsLocked();
+  if (cursor_ >= index_.size()) {
     return std::numeric_limits<double>::infinity();
   }
-  return timestamp_to_second(next_event_->timestamp);
+  return timestamp_to_second(index_[cursor_].timestamp);
 }
 
 void DrakeLcmLog::DispatchMessageAndAdvanceLog(double current_time) {
@@ -82,23 +183,50 @@ void DrakeLcmLog::DispatchMessageAndAdvanceLog(double current_time) {
   }
 
   std::lock_guard<std::mutex> lock(mutex_);
+  SkipFilteredEventsLocked();
   // End of log, do nothing.
-  if (next_event_ == nullptr) return;
+  if (cursor_ >= index_.size()) return;
 
+  const EventIndexEntry& event = index_[cursor_];
   // Do nothing if the call time does not match the event's time.
-  if (current_time != timestamp_to_second(next_event_->timestamp)) {
+  if (current_time != timestamp_to_second(event.timestamp)) {
     return;
   }
 
   // Dispatch message if necessary.
-  const auto& range = subscriptions_.equal_range(next_event_->channel);
+  const auto& range = subscriptions_.equal_range(*event.channel);
   for (auto iter = range.first; iter != range.second; ++iter) {
     const HandlerFunction& handler = iter->second;
-    handler(next_event_->data, next_event_->datalen);
+    handler(event.data, event.data_size);
   }
 
   // Advance log.
-  next_event_ = log_->readNextEvent();
+  ++cursor_;
+}
+
+void DrakeLcmLog::Seek(double time) {
+  if (is_write_) {
+    throw std::logic_error("Seek is only available for log playback.");
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  const uint64_t timestamp = second_to_timestamp(std::max(time, 0.0));
+  const auto iter = std::lower_bound(
+      index_.begin(), index_.end(), timestamp,
+      [](const EventIndexEntry& entry, uint64_t target) {
+        return entry.timestamp < target;
+      });
+  cursor_ = iter - index_.begin();
+}
+
+void DrakeLcmLog::set_skip_unsubscribed_channels(bool enabled) {
+  if (is_write_) {
+    throw std::logic_error(
+        "set_skip_unsubscribed_channels is only available for log playback.");
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  skip_unsubscribed_channels_ = enabled;
 }
 
 }  // namespace lcm
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -22,6 +24,11 @@ namespace lcm {
  * is generated by some external logger (the lcm-logger binary), which uses the
  * unix epoch time clock to record message arrival time, the user needs to
  * offset those timestamps properly to match and the clock used for playback.
+ *
+ * In read mode, the log file is memory-mapped and indexed once at
+ * construction (a header-only walk over the events; no message is decoded),
+ * so Seek() can position playback anywhere in the log in O(log n) and
+ * reading never copies message payloads.
  */
 class DrakeLcmLog : public DrakeLcmInterface {
  public:
@@ -45,6 +52,8 @@ class DrakeLcmLog : public DrakeLcmInterface {
   DrakeLcmLog(const std::string& file_name, bool is_write,
               bool overwrite_publish_time_with_system_clock = false);
 
+  ~DrakeLcmLog() override;
+
   /**
    * Writes an entry occurred at @p timestamp with content @p data to the log
    * file. The current implementation blocks until writing is done.
@@ -94,6 +103,31 @@ class DrakeLcmLog : public DrakeLcmInterface {
    */
   void DispatchMessageAndAdvanceLog(double current_time);
 
+  /**
+   * Positions the log cursor at the first logged event whose occurrence time
+   * is at least @p time (in seconds, as reported by GetNextMessageTime()),
+   * or past the end of the log if no such event exists. This is a binary
+   * search over the event index, so seeking deep into a long log does not
+   * decode or even touch the skipped records.
+   *
+   * @throws std::logic_error if this instance is not constructed in read-only
+   * mode.
+   */
+  void Seek(double time);
+
+  /**
+   * When enabled, events on channels that have no subscriber are skipped
+   * entirely during playback: they are never decoded and do not produce a
+   * GetNextMessageTime() stop. Enable this when playing back a log that
+   * contains many channels of which only a few are of interest. Subscriptions
+   * added after enabling are honored from the current cursor position
+   * onwards.
+   *
+   * @throws std::logic_error if this instance is not constructed in read-only
+   * mode.
+   */
+  void set_skip_unsubscribed_channels(bool enabled);
+
   /**
    * Returns true if this instance is constructed in write-only mode.
    */
@@ -116,6 +150,23 @@ class DrakeLcmLog : public DrakeLcmInterface {
   }
 
  private:
+  // One indexed log event: its timestamp, its (interned) channel name, and
+  // where its payload lives within the memory-mapped log file.
+  struct EventIndexEntry {
+    uint64_t timestamp{};
+    const std::string* channel{};
+    const uint8_t* data{};
+    int data_size{};
+  };
+
+  // Memory-maps the log file and walks the event headers once to build
+  // index_; called from the constructor in read mode.
+  void MapAndIndexLog(const std::string& file_name);
+
+  // Advances cursor_ past events on unsubscribed channels, when that
+  // filtering is enabled. Callers must hold mutex_.
+  void SkipFilteredEventsLocked() const;
+
   const bool is_write_;
   const bool overwrite_publish_time_with_system_clock_;
 
@@ -126,8 +177,19 @@ class DrakeLcmLog : public DrakeLcmInterface {
   // This mutes guards access to all of the below member fields.
   mutable std::mutex mutex_;
   std::multimap<std::string, DrakeLcmInterface::HandlerFunction> subscriptions_;
+
+  // Write mode only.
   std::unique_ptr<::lcm::LogFile> log_;
-  const ::lcm::LogEvent* next_event_{nullptr};
+
+  // Read mode only: the memory-mapped log file, the per-event index built
+  // once at construction, the interned channel names the index points into,
+  // and the playback cursor (an index into index_).
+  void* map_{nullptr};
+  uint64_t map_size_{0};
+  std::vector<EventIndexEntry> index_;
+  std::set<std::string> channel_names_;
+  mutable uint64_t cursor_{0};
+  bool skip_unsubscribed_channels_{false};
 };
 
 }  // namespace lcm
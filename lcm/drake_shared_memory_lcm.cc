@@ -0,0 +1,350 @@
+#include "drake/lcm/drake_shared_memory_lcm.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace lcm {
+namespace {
+
+// Identifies a segment created by this transport (and this layout version).
+constexpr uint32_t kMagic = 0x444c534d;  // "DLSM"
+
+// The fixed part of a channel's shared-memory segment. The slots follow,
+// each one a SlotHeader plus slot_capacity payload bytes, aligned to a cache
+// line so that concurrent writers and readers of neighboring slots do not
+// false-share.
+struct SegmentHeader {
+  std::atomic<uint32_t> magic{};
+  uint32_t num_slots{};
+  uint32_t slot_capacity{};
+  // The number of messages claimed on this channel so far. A publisher
+  // claims sequence number `next_sequence.fetch_add(1)` and writes into slot
+  // `sequence % num_slots`.
+  std::atomic<uint64_t> next_sequence{};
+};
+
+struct SlotHeader {
+  // Per-slot seqlock stamp: `2 * sequence + 1` while the message with that
+  // sequence number is being written, `2 * sequence + 2` once it has been
+  // committed. A reader must observe the same committed stamp before and
+  // after copying the payload, otherwise the slot was overwritten.
+  std::atomic<uint64_t> stamp{};
+  uint32_t data_size{};
+};
+
+constexpr size_t kCacheLine = 64;
+
+size_t RoundUpToCacheLine(size_t size) {
+  return (size + kCacheLine - 1) / kCacheLine * kCacheLine;
+}
+
+// Parses "shmem://<name>" and returns <name>.
+std::string ParseUrl(const std::string& url) {
+  const std::string scheme = "shmem://";
+  if (url.compare(0, scheme.size(), scheme) != 0 ||
+      url.size() == scheme.size()) {
+    throw std::invalid_argument(
+        "DrakeSharedMemoryLcm: the url must take the form shmem://<name>, "
+        "not '" + url + "'.");
+  }
+  return url.substr(scheme.size());
+}
+
+// Returns the shm_open() name for `channel` of the instance named `name`.
+// Slashes are not allowed in shm names, so any appearing in the channel are
+// replaced.
+std::string SegmentName(const std::string& name, const std::string& channel) {
+  std::string result = "/" + name + "." + channel;
+  for (size_t i = 1; i < result.size(); ++i) {
+    if (result[i] == '/') result[i] = '_';
+  }
+  return result;
+}
+
+}  // namespace
+
+// One channel's mapping: a SegmentHeader followed by the ring of slots. The
+// same physical pages are mapped by every process publishing or subscribing
+// to the channel; all cross-process synchronization happens through the
+// atomics in the headers.
+class DrakeSharedMemoryLcm::Segment {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Segment);
+
+  enum class ReadResult {
+    kSuccess,
+    // The message with this sequence number has not been committed yet.
+    kNotYetAvailable,
+    // The slot has been reused for a newer message; this one is lost.
+    kOverwritten,
+  };
+
+  Segment(const std::string& shm_name, int slot_capacity) {
+    slot_stride_ = RoundUpToCacheLine(sizeof(SlotHeader) + slot_capacity);
+    total_size_ = RoundUpToCacheLine(sizeof(SegmentHeader)) +
+                  kNumSlots * slot_stride_;
+
+    // Try to create the segment; fall back to opening an existing one. The
+    // creator zero-initializes the pages (ftruncate guarantees this) and
+    // publishes the layout by storing the magic number last.
+    bool created = true;
+    int fd = ::shm_open(shm_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0) {
+      created = false;
+      fd = ::shm_open(shm_name.c_str(), O_RDWR, 0644);
+    }
+    if (fd < 0) {
+      throw std::runtime_error(
+          "DrakeSharedMemoryLcm: could not open shared-memory segment '" +
+          shm_name + "'.");
+    }
+    if (created && ::ftruncate(fd, total_size_) != 0) {
+      ::close(fd);
+      ::shm_unlink(shm_name.c_str());
+      throw std::runtime_error(
+          "DrakeSharedMemoryLcm: could not size shared-memory segment '" +
+          shm_name + "'.");
+    }
+    void* const mapping = ::mmap(nullptr, total_size_,
+                                 PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+      throw std::runtime_error(
+          "DrakeSharedMemoryLcm: could not map shared-memory segment '" +
+          shm_name + "'.");
+    }
+    header_ = static_cast<SegmentHeader*>(mapping);
+    slots_ = static_cast<uint8_t*>(mapping) +
+             RoundUpToCacheLine(sizeof(SegmentHeader));
+
+    if (created) {
+      header_->num_slots = kNumSlots;
+      header_->slot_capacity = slot_capacity;
+      header_->magic.store(kMagic, std::memory_order_release);
+    } else {
+      // Another process created the segment; insist that it used the same
+      // layout we expect. (A concurrent creator stores the magic number
+      // after the layout fields, so briefly spin for it.)
+      uint32_t magic{};
+      while ((magic = header_->magic.load(std::memory_order_acquire)) == 0) {
+        // Spin; segment initialization takes well under a microsecond.
+      }
+      if (magic != kMagic ||
+          header_->num_slots != kNumSlots ||
+          header_->slot_capacity != static_cast<uint32_t>(slot_capacity)) {
+        ::munmap(mapping, total_size_);
+        throw std::runtime_error(
+            "DrakeSharedMemoryLcm: shared-memory segment '" + shm_name +
+            "' exists with an incompatible layout; remove it with Unlink() "
+            "or use matching parameters.");
+      }
+    }
+  }
+
+  ~Segment() { ::munmap(header_, total_size_); }
+
+  // Publishes one message: claims the next sequence number, serializes the
+  // bytes in place into the claimed slot, and commits it by stamp.
+  void Write(const void* data, int data_size) {
+    const uint64_t sequence =
+        header_->next_sequence.fetch_add(1, std::memory_order_acq_rel);
+    SlotHeader* const slot = slot_header(sequence % kNumSlots);
+    slot->stamp.store(2 * sequence + 1, std::memory_order_release);
+    slot->data_size = data_size;
+    std::memcpy(payload(slot), data, data_size);
+    slot->stamp.store(2 * sequence + 2, std::memory_order_release);
+  }
+
+  // Copies the message with the given sequence number out of its slot.
+  ReadResult Read(uint64_t sequence, std::vector<uint8_t>* data) const {
+    const SlotHeader* const slot = slot_header(sequence % kNumSlots);
+    const uint64_t committed = 2 * sequence + 2;
+    const uint64_t stamp = slot->stamp.load(std::memory_order_acquire);
+    if (stamp < committed) return ReadResult::kNotYetAvailable;
+    if (stamp > committed) return ReadResult::kOverwritten;
+    const uint32_t data_size = slot->data_size;
+    if (data_size > header_->slot_capacity) return ReadResult::kOverwritten;
+    data->resize(data_size);
+    std::memcpy(data->data(), payload(slot), data_size);
+    // Confirm the slot was not reused while we were copying.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot->stamp.load(std::memory_order_relaxed) != committed) {
+      return ReadResult::kOverwritten;
+    }
+    return ReadResult::kSuccess;
+  }
+
+  // The sequence number one past the newest claimed message.
+  uint64_t head() const {
+    return header_->next_sequence.load(std::memory_order_acquire);
+  }
+
+ private:
+  SlotHeader* slot_header(uint64_t slot_index) const {
+    return reinterpret_cast<SlotHeader*>(slots_ + slot_index * slot_stride_);
+  }
+
+  static uint8_t* payload(SlotHeader* slot) {
+    return reinterpret_cast<uint8_t*>(slot) + sizeof(SlotHeader);
+  }
+  static const uint8_t* payload(const SlotHeader* slot) {
+    return reinterpret_cast<const uint8_t*>(slot) + sizeof(SlotHeader);
+  }
+
+  size_t slot_stride_{};
+  size_t total_size_{};
+  SegmentHeader* header_{};
+  uint8_t* slots_{};
+};
+
+constexpr int DrakeSharedMemoryLcm::kNumSlots;
+
+DrakeSharedMemoryLcm::DrakeSharedMemoryLcm(std::string url, int slot_capacity)
+    : url_(std::move(url)),
+      name_(ParseUrl(url_)),
+      slot_capacity_(slot_capacity) {
+  DRAKE_THROW_UNLESS(slot_capacity > 0);
+}
+
+DrakeSharedMemoryLcm::~DrakeSharedMemoryLcm() {
+  if (receive_thread_ != nullptr) {
+    StopReceiveThread();
+  }
+}
+
+void DrakeSharedMemoryLcm::StartReceiveThread() {
+  DRAKE_DEMAND(receive_thread_ == nullptr);
+  stop_requested_ = false;
+  receive_thread_ =
+      std::make_unique<std::thread>(&DrakeSharedMemoryLcm::ReceiveLoop, this);
+}
+
+void DrakeSharedMemoryLcm::StopReceiveThread() {
+  DRAKE_DEMAND(receive_thread_ != nullptr);
+  stop_requested_ = true;
+  receive_thread_->join();
+  receive_thread_.reset();
+}
+
+std::string DrakeSharedMemoryLcm::get_requested_url() const { return url_; }
+
+DrakeSharedMemoryLcm::Segment* DrakeSharedMemoryLcm::GetOrCreateSegment(
+    const std::string& channel) {
+  auto iter = segments_.find(channel);
+  if (iter == segments_.end()) {
+    iter = segments_.emplace(
+        channel, std::make_unique<Segment>(SegmentName(name_, channel),
+                                           slot_capacity_)).first;
+  }
+  return iter->second.get();
+}
+
+void DrakeSharedMemoryLcm::Publish(const std::string& channel,
+                                   const void* data, int data_size,
+                                   optional<double>) {
+  DRAKE_THROW_UNLESS(!channel.empty());
+  DRAKE_THROW_UNLESS(data_size >= 0);
+  if (data_size > slot_capacity_) {
+    throw std::runtime_error(
+        "DrakeSharedMemoryLcm: a message of " + std::to_string(data_size) +
+        " bytes on channel '" + channel + "' exceeds the slot capacity of " +
+        std::to_string(slot_capacity_) + " bytes.");
+  }
+  Segment* segment{};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    segment = GetOrCreateSegment(channel);
+  }
+  // The write itself is synchronized through the segment's atomics, not our
+  // mutex, so concurrent publishers (or other processes) never serialize on
+  // this instance.
+  segment->Write(data, data_size);
+}
+
+void DrakeSharedMemoryLcm::Subscribe(const std::string& channel,
+                                     HandlerFunction handler) {
+  DRAKE_THROW_UNLESS(!channel.empty());
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = subscriptions_.find(channel);
+  if (iter == subscriptions_.end()) {
+    iter = subscriptions_.emplace(channel, ChannelSubscriptions{}).first;
+    // Deliver only messages published from now on, as a socket would.
+    iter->second.next_sequence = GetOrCreateSegment(channel)->head();
+  }
+  iter->second.handlers.push_back(std::move(handler));
+}
+
+void DrakeSharedMemoryLcm::ReceiveLoop() {
+  std::vector<uint8_t> buffer;
+  while (!stop_requested_.load()) {
+    bool dispatched = false;
+    // Snapshot the subscribed channel names; handlers may add more.
+    std::vector<std::string> channels;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto& name_subscriptions : subscriptions_) {
+        channels.push_back(name_subscriptions.first);
+      }
+    }
+    for (const std::string& channel : channels) {
+      // Drain every message committed so far on this channel.
+      while (true) {
+        Segment* segment{};
+        uint64_t sequence{};
+        std::vector<HandlerFunction> handlers;
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          ChannelSubscriptions& subscriptions = subscriptions_[channel];
+          segment = GetOrCreateSegment(channel);
+          const uint64_t head = segment->head();
+          if (subscriptions.next_sequence >= head) break;
+          // If we have fallen behind by more than a full ring, everything
+          // older has been overwritten; skip to the oldest survivor.
+          if (head - subscriptions.next_sequence > kNumSlots) {
+            subscriptions.next_sequence = head - kNumSlots;
+          }
+          sequence = subscriptions.next_sequence;
+          handlers = subscriptions.handlers;
+        }
+        const Segment::ReadResult result = segment->Read(sequence, &buffer);
+        if (result == Segment::ReadResult::kNotYetAvailable) {
+          // The publisher has claimed this sequence number but has not
+          // committed it yet; try again on the next pass.
+          break;
+        }
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          subscriptions_[channel].next_sequence = sequence + 1;
+        }
+        if (result == Segment::ReadResult::kSuccess) {
+          dispatched = true;
+          for (const HandlerFunction& handler : handlers) {
+            handler(buffer.data(), static_cast<int>(buffer.size()));
+          }
+        }
+      }
+    }
+    if (!dispatched) {
+      // Nothing new anywhere; sleep briefly rather than burn the core.
+      ::usleep(50);
+    }
+  }
+}
+
+void DrakeSharedMemoryLcm::Unlink(const std::string& url,
+                                  const std::string& channel) {
+  ::shm_unlink(SegmentName(ParseUrl(url), channel).c_str());
+}
+
+}  // namespace lcm
+}  // namespace drake
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/drake_optional.h"
+#include "drake/lcm/drake_lcm_interface.h"
+
+namespace drake {
+namespace lcm {
+
+/**
+ * A shared-memory transport implementing DrakeLcmInterface, for processes
+ * co-located on a single host. Unlike DrakeLcm, no socket, syscall, or
+ * kernel copy is involved per message: each channel is backed by a
+ * shared-memory ring buffer of fixed-capacity message slots, publishers
+ * write the serialized bytes directly into the mapped slot and commit it
+ * with a sequence stamp, and subscribers map the same pages and poll the
+ * stamps. This makes intra-host exchange of large messages (e.g. images or
+ * point clouds) orders of magnitude cheaper than the UDP multicast
+ * transport.
+ *
+ * URLs take the form `shmem://<name>`; instances constructed with the same
+ * URL, in this process or in others, exchange messages. A channel's ring
+ * holds kNumSlots messages of up to `slot_capacity` bytes each; Publish()
+ * throws if a message exceeds the slot capacity, and a subscriber that
+ * falls more than kNumSlots messages behind loses the overwritten messages
+ * (exactly as it would under UDP), never blocking the publisher.
+ *
+ * As with DrakeLcm, subscriber callbacks are invoked on the receive thread;
+ * StartReceiveThread() must be called for subscribers to receive messages.
+ * The shared-memory segments persist after the publishing process exits
+ * (like files); use Unlink() to remove a channel's segment from the host.
+ */
+class DrakeSharedMemoryLcm : public DrakeLcmInterface {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DrakeSharedMemoryLcm);
+
+  /// The number of message slots in each channel's ring buffer.
+  static constexpr int kNumSlots = 8;
+
+  /// Constructs using the given URL, which must take the form
+  /// `shmem://<name>`.
+  ///
+  /// @param slot_capacity The maximum size in bytes of a single message on
+  /// any channel of this instance. Processes sharing a URL must use the same
+  /// slot capacity.
+  explicit DrakeSharedMemoryLcm(std::string url,
+                                int slot_capacity = 4 * 1024 * 1024);
+
+  /**
+   * A destructor that forces the receive thread to be stopped. The
+   * shared-memory segments themselves are left in place for other processes.
+   */
+  ~DrakeSharedMemoryLcm() override;
+
+  /**
+   * Starts the receive thread. This must be called for subscribers to
+   * receive any messages.
+   *
+   * @pre StartReceiveThread() was not called.
+   */
+  void StartReceiveThread();
+
+  /**
+   * Stops the receive thread. This must be called prior to any subscribers
+   * being destroyed. Note that the receive thread will be automatically
+   * stopped by this class's destructor.
+   *
+   * @pre StartReceiveThread() was called.
+   */
+  void StopReceiveThread();
+
+  /**
+   * Indicates that the receiving thread is running.
+   */
+  bool IsReceiveThreadRunning() const { return receive_thread_ != nullptr; }
+
+  /**
+   * Returns the URL passed into the constructor.
+   */
+  std::string get_requested_url() const;
+
+  void Publish(const std::string& channel, const void* data, int data_size,
+               optional<double> time_sec) override;
+
+  void Subscribe(const std::string& channel, HandlerFunction) override;
+
+  /**
+   * Removes the shared-memory segment backing @p channel of the instance(s)
+   * named by @p url from the host, as if it had never been published or
+   * subscribed to. Active mappings in running processes stay valid. Mostly
+   * useful for tests and for cleaning up after crashed processes.
+   */
+  static void Unlink(const std::string& url, const std::string& channel);
+
+ private:
+  class Segment;
+
+  // State for all the subscriptions on one channel. The handlers share a
+  // single read cursor so that each message is dispatched once per handler.
+  struct ChannelSubscriptions {
+    std::vector<HandlerFunction> handlers;
+    uint64_t next_sequence{0};
+  };
+
+  // Returns the mapped segment for `channel`, opening or creating it on
+  // demand. The caller must hold mutex_.
+  Segment* GetOrCreateSegment(const std::string& channel);
+
+  // The body of the receive thread: polls every subscribed channel's ring
+  // for newly committed messages and dispatches them to the handlers.
+  void ReceiveLoop();
+
+  const std::string url_;
+  // The <name> parsed from url_, used to derive segment names.
+  const std::string name_;
+  const int slot_capacity_;
+
+  // Guards segments_ and subscriptions_. Handlers are invoked without
+  // holding this mutex, so that they may call Publish() or Subscribe().
+  mutable std::mutex mutex_;
+  std::map<std::string, std::unique_ptr<Segment>> segments_;
+  std::map<std::string, ChannelSubscriptions> subscriptions_;
+
+  std::atomic<bool> stop_requested_{false};
+  std::unique_ptr<std::thread> receive_thread_;
+};
+
+}  // namespace lcm
+}  // namespace drake
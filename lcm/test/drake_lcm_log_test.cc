@@ -1,7 +1,10 @@
 #include "drake/lcm/drake_lcm_log.h"
 
+#include <cmath>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -53,6 +56,45 @@ GTEST_TEST(LcmLogTest, LcmLogTestSaveAndRead) {
   }
 }
 
+// Exercises Seek() and unsubscribed-channel filtering on a log that
+// interleaves two channels.
+GTEST_TEST(LcmLogTest, SeekAndChannelFilterTest) {
+  auto w_log = std::make_unique<DrakeLcmLog>("test_seek.log", true);
+  drake::lcmt_drake_signal msg{};
+  msg.dim = 1;
+  msg.val.push_back(0.0);
+  msg.coord.push_back("test");
+  for (int i = 0; i < 10; ++i) {
+    msg.timestamp = i;
+    msg.val[0] = i;
+    Publish(w_log.get(), (i % 2 == 0) ? "even" : "odd", msg, i * 1.0);
+  }
+  w_log.reset();
+
+  DrakeLcmLog r_log("test_seek.log", false);
+  std::vector<double> received;
+  Subscribe<drake::lcmt_drake_signal>(
+      &r_log, "even",
+      [&received](const auto& message) { received.push_back(message.val[0]); });
+
+  // Seek into the middle of the log: playback resumes at t = 6.
+  r_log.Seek(5.5);
+  EXPECT_EQ(r_log.GetNextMessageTime(), 6.0);
+
+  // With filtering enabled, the odd channel never even produces a stop.
+  r_log.set_skip_unsubscribed_channels(true);
+  double time = r_log.GetNextMessageTime();
+  while (!std::isinf(time)) {
+    r_log.DispatchMessageAndAdvanceLog(time);
+    time = r_log.GetNextMessageTime();
+  }
+  EXPECT_EQ(received, std::vector<double>({6.0, 8.0}));
+
+  // Seeking backwards rewinds the cursor.
+  r_log.Seek(0.0);
+  EXPECT_EQ(r_log.GetNextMessageTime(), 0.0);
+}
+
 }  // namespace
 }  // namespace lcm
 }  // namespace drake
@@ -43,6 +43,25 @@ GTEST_TEST(DrakeMockLcmTest, PublishTest) {
   EXPECT_EQ(dut.get_last_publication_time(channel_name).value_or(-1.0), 1.23);
 }
 
+// Tests the default (loop over Publish) implementation of PublishBatch.
+GTEST_TEST(DrakeMockLcmTest, PublishBatchTest) {
+  const vector<uint8_t> first_bytes = {1, 2, 3};
+  const vector<uint8_t> second_bytes = {4, 5};
+
+  DrakeMockLcm dut;
+  dut.PublishBatch(
+      {{"batch_channel_0", first_bytes.data(),
+        static_cast<int>(first_bytes.size())},
+       {"batch_channel_1", second_bytes.data(),
+        static_cast<int>(second_bytes.size())}},
+      4.56);
+
+  EXPECT_EQ(dut.get_last_published_message("batch_channel_0"), first_bytes);
+  EXPECT_EQ(dut.get_last_published_message("batch_channel_1"), second_bytes);
+  EXPECT_EQ(dut.get_last_publication_time("batch_channel_0").value_or(-1.0),
+            4.56);
+}
+
 // Tests DrakeMockLcm::DecodeLastPublishedMessageAs() using an lcmt_drake_signal
 // message.
 GTEST_TEST(DrakeMockLcmTest, DecodeLastPublishedMessageAsTest) {
@@ -0,0 +1,141 @@
+#include "drake/lcm/drake_shared_memory_lcm.h"
+
+#include <unistd.h>
+
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/lcm/lcmt_drake_signal_utils.h"
+#include "drake/lcmt_drake_signal.hpp"
+
+namespace drake {
+namespace lcm {
+namespace {
+
+using std::chrono::milliseconds;
+using std::this_thread::sleep_for;
+
+// How long the tests below are willing to wait for a message to cross the
+// transport before declaring failure.
+constexpr int kMaxPollCount = 1000;
+
+// This is a test fixture that defines a `drake::lcmt_drake_signal` message
+// and a uniquely named shared-memory url, so that concurrent test runs on
+// one machine do not collide.
+class DrakeSharedMemoryLcmTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    url_ = "shmem://drake_shm_lcm_test_pid" + std::to_string(::getpid());
+
+    message_.dim = 2;
+    message_.val.push_back(0.3739558136);
+    message_.val.push_back(0.2801694990);
+    message_.coord.push_back("artin's constant");
+    message_.coord.push_back("bernstein's constant");
+    message_.timestamp = 142857;
+  }
+
+  void TearDown() override {
+    for (const std::string& channel : used_channels_) {
+      DrakeSharedMemoryLcm::Unlink(url_, channel);
+    }
+  }
+
+  // Encodes message_ and publishes it on `channel` of `dut`.
+  void PublishMessage(DrakeSharedMemoryLcm* dut, const std::string& channel) {
+    used_channels_.push_back(channel);
+    const int num_bytes = message_.getEncodedSize();
+    std::vector<uint8_t> bytes(num_bytes);
+    message_.encode(bytes.data(), 0, num_bytes);
+    dut->Publish(channel, bytes.data(), num_bytes, {});
+  }
+
+  std::string url_;
+  std::vector<std::string> used_channels_;
+  drake::lcmt_drake_signal message_;
+};
+
+// Tests that a message published on a channel arrives at a subscriber of
+// that channel on another instance sharing the url.
+TEST_F(DrakeSharedMemoryLcmTest, PublishSubscribeTest) {
+  const std::string channel = "drake_shm_lcm_test_channel";
+  DrakeSharedMemoryLcm publisher(url_);
+  DrakeSharedMemoryLcm subscriber(url_);
+
+  std::mutex mutex;
+  drake::lcmt_drake_signal received{};
+  int received_count = 0;
+  subscriber.Subscribe(channel, [&](const void* data, int size) {
+    std::lock_guard<std::mutex> lock(mutex);
+    received.decode(data, 0, size);
+    ++received_count;
+  });
+  EXPECT_FALSE(subscriber.IsReceiveThreadRunning());
+  subscriber.StartReceiveThread();
+  EXPECT_TRUE(subscriber.IsReceiveThreadRunning());
+
+  // Publishes until the subscriber confirms receipt; the very first message
+  // already exists in the ring before the receive thread's first poll, so a
+  // single publish would suffice, but polling keeps the test robust.
+  bool done = false;
+  for (int i = 0; i < kMaxPollCount && !done; ++i) {
+    PublishMessage(&publisher, channel);
+    sleep_for(milliseconds(1));
+    std::lock_guard<std::mutex> lock(mutex);
+    done = (received_count > 0);
+  }
+  ASSERT_TRUE(done);
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_TRUE(CompareLcmtDrakeSignalMessages(received, message_));
+  }
+  subscriber.StopReceiveThread();
+  EXPECT_FALSE(subscriber.IsReceiveThreadRunning());
+}
+
+// Tests that subscriptions are per channel: a message on another channel is
+// not dispatched.
+TEST_F(DrakeSharedMemoryLcmTest, ChannelIsolationTest) {
+  DrakeSharedMemoryLcm dut(url_);
+
+  int right_count = 0;
+  int wrong_count = 0;
+  dut.Subscribe("drake_shm_lcm_test_right",
+                [&](const void*, int) { ++right_count; });
+  dut.Subscribe("drake_shm_lcm_test_wrong",
+                [&](const void*, int) { ++wrong_count; });
+  dut.StartReceiveThread();
+
+  bool done = false;
+  for (int i = 0; i < kMaxPollCount && !done; ++i) {
+    PublishMessage(&dut, "drake_shm_lcm_test_right");
+    sleep_for(milliseconds(1));
+    done = (right_count > 0);
+  }
+  ASSERT_TRUE(done);
+  EXPECT_EQ(wrong_count, 0);
+}
+
+// Tests that an oversized message and a malformed url are rejected.
+TEST_F(DrakeSharedMemoryLcmTest, ErrorHandlingTest) {
+  const int kCapacity = 64;
+  DrakeSharedMemoryLcm dut(url_, kCapacity);
+  used_channels_.push_back("drake_shm_lcm_test_tiny");
+  const std::vector<uint8_t> bytes(kCapacity + 1, 0);
+  EXPECT_THROW(
+      dut.Publish("drake_shm_lcm_test_tiny", bytes.data(), kCapacity + 1, {}),
+      std::runtime_error);
+
+  EXPECT_THROW(DrakeSharedMemoryLcm("udpm://239.255.76.67:7667"),
+               std::invalid_argument);
+}
+
+}  // namespace
+}  // namespace lcm
+}  // namespace drake
@@ -19,6 +19,9 @@ BarycentricMesh<T>::BarycentricMesh(MeshGrid input_grid)
       stride_(input_grid_.size()),
       num_interpolants_{1} {
   DRAKE_DEMAND(input_grid_.size() > 0);
+  coordinates_.resize(get_input_size());
+  inverse_spacing_.resize(get_input_size());
+  cached_interval_.assign(get_input_size(), 0);
   for (int i = 0; i < get_input_size(); i++) {
     // Must define at least one mesh point per dimension.
     DRAKE_DEMAND(!input_grid_[i].empty());
@@ -27,6 +30,15 @@ BarycentricMesh<T>::BarycentricMesh(MeshGrid input_grid)
     if (input_grid_[i].size() > 1) num_interpolants_++;
 
     stride_[i] = (i == 0) ? 1 : input_grid_[i - 1].size() * stride_[i - 1];
+
+    // Flatten the (sorted) grid coordinates and precompute the reciprocal of
+    // each cell width for the interpolation fast path.
+    coordinates_[i].assign(input_grid_[i].begin(), input_grid_[i].end());
+    const std::vector<double>& coords = coordinates_[i];
+    inverse_spacing_[i].reserve(coords.size() - 1);
+    for (size_t k = 0; k + 1 < coords.size(); k++) {
+      inverse_spacing_[i].push_back(1.0 / (coords[k + 1] - coords[k]));
+    }
   }
 }
 
@@ -79,9 +91,13 @@ void BarycentricMesh<T>::EvalBarycentricWeights(
   // the case of triangular meshes, there is one interpolant for every
   // non-singular dimension + one additional, so num_interpolants-1 is the size
   // we need.
-  std::vector<std::pair<T, int>> relative_position(num_interpolants_ - 1);
+  // The workspace vectors are thread_local so that repeated queries do not
+  // reallocate them.
+  thread_local std::vector<std::pair<T, int>> relative_position;
+  relative_position.assign(num_interpolants_ - 1, {});
   // Bounding box on the input grid containing the sample input.
-  std::vector<bool> has_volume(get_input_size());
+  thread_local std::vector<bool> has_volume;
+  has_volume.assign(get_input_size(), false);
 
   int current_index = 0;
 
@@ -89,40 +105,51 @@ void BarycentricMesh<T>::EvalBarycentricWeights(
   // indices.  Set current_index to the "top right" corner index.
   int count = 0;
   for (int i = 0; i < get_input_size(); i++) {
-    const auto& coords = input_grid_[i];
+    const std::vector<double>& coords = coordinates_[i];
+    const int num_coords = static_cast<int>(coords.size());
 
     // Skip over singleton dimensions.
-    if (coords.size() == 1) continue;
+    if (num_coords == 1) continue;
 
     // Tag the positions with the dimension index.
     relative_position[count].second = i;
 
-    // Find the right side of the bounding box.
-    // Recall that lower_bound returns the first grid element that is NOT less
-    // than the sample.
-    auto right_iter = coords.lower_bound(input[i]);
+    // Find the right side of the bounding box, which is the first grid
+    // element that is NOT less than the sample (so that a sample exactly at
+    // an interior grid point uses the cell to its left, as the original
+    // std::set::lower_bound formulation did).
     int right_index = 0;
 
-    if (right_iter == coords.end()) {
-      // ... then input is off the right end of the grid;
-      // move it to the right boundary.
-      has_volume[i] = false;
-      right_index = coords.size() - 1;
-      relative_position[count].first = T(1.);
-    } else if (right_iter == coords.begin()) {
+    if (input[i] <= coords[0]) {
       // ... then input is at the first element or left of it;
       // move it to the left boundary.
       has_volume[i] = false;
       right_index = 0;
       relative_position[count].first = T(1.);
+    } else if (input[i] > coords[num_coords - 1]) {
+      // ... then input is off the right end of the grid;
+      // move it to the right boundary.
+      has_volume[i] = false;
+      right_index = num_coords - 1;
+      relative_position[count].first = T(1.);
     } else {
-      // ... then input is inside the grid.
+      // ... then input is inside the grid; find the interval k such that
+      // coords[k] < input[i] <= coords[k+1], probing the last query's
+      // interval before falling back to binary search.
       has_volume[i] = true;
-      right_index = std::distance(coords.begin(), right_iter);
-      const T& right_value = *(right_iter);
-      const T& left_value = *(std::prev(right_iter));
+      int interval = cached_interval_[i];
+      if (!(coords[interval] < input[i] && input[i] <= coords[interval + 1])) {
+        interval = static_cast<int>(
+                       std::distance(coords.begin(),
+                                     std::lower_bound(coords.begin(),
+                                                      coords.end(),
+                                                      input[i]))) -
+                   1;
+        cached_interval_[i] = interval;
+      }
+      right_index = interval + 1;
       relative_position[count].first =
-          (input[i] - left_value) / (right_value - left_value);
+          (input[i] - coords[interval]) * inverse_spacing_[i][interval];
     }
 
     current_index += stride_[i] * right_index;
@@ -169,6 +196,28 @@ VectorX<T> BarycentricMesh<T>::Eval(
   return EvalWithMixedScalars<T>(mesh_values, input);
 }
 
+template <typename T>
+void BarycentricMesh<T>::EvalBatch(
+    const Eigen::Ref<const MatrixX<T>>& mesh_values,
+    const Eigen::Ref<const MatrixX<T>>& inputs,
+    EigenPtr<MatrixX<T>> outputs) const {
+  DRAKE_DEMAND(inputs.rows() == get_input_size());
+  DRAKE_DEMAND(mesh_values.cols() == get_num_mesh_points());
+  DRAKE_DEMAND(outputs->rows() == mesh_values.rows());
+  DRAKE_DEMAND(outputs->cols() == inputs.cols());
+
+  Eigen::VectorXi mesh_indices(num_interpolants_);
+  VectorX<T> weights(num_interpolants_);
+
+  for (int j = 0; j < inputs.cols(); j++) {
+    EvalBarycentricWeights(inputs.col(j), &mesh_indices, &weights);
+    outputs->col(j) = weights[0] * mesh_values.col(mesh_indices[0]);
+    for (int i = 1; i < num_interpolants_; i++) {
+      outputs->col(j) += weights[i] * mesh_values.col(mesh_indices[i]);
+    }
+  }
+}
+
 template <typename T>
 MatrixX<T> BarycentricMesh<T>::MeshValuesFrom(
     const std::function<VectorX<T>(const Eigen::Ref<const VectorX<T>>&)>&
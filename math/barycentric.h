@@ -96,6 +96,12 @@ class BarycentricMesh {
   /// get_num_interpolants().
   /// @param weights is a vector of coefficients (which sum to 1) of length
   /// get_num_interpolants().
+  ///
+  /// Each dimension's grid interval is located first by probing the interval
+  /// used by the previous query, so sequential queries that move slowly
+  /// through the input space skip the binary search entirely.  Because of
+  /// that cache, concurrent queries on a single BarycentricMesh must be
+  /// externally synchronized.
   void EvalBarycentricWeights(const Eigen::Ref<const VectorX<T>>& input,
                               EigenPtr<Eigen::VectorXi> mesh_indices,
                               EigenPtr<VectorX<T>> weights) const;
@@ -123,6 +129,21 @@ class BarycentricMesh {
   VectorX<T> Eval(const Eigen::Ref<const MatrixX<T>>& mesh_values,
                   const Eigen::Ref<const VectorX<T>>& input) const;
 
+  /// Evaluates the function at each column of @p inputs in one pass, reusing
+  /// the interpolation workspace across queries.  Columns that land in (or
+  /// near) the same grid cell as their predecessor benefit from the cached
+  /// cell lookup, so batches of sequential samples (e.g. along a trajectory)
+  /// are substantially cheaper than repeated calls to Eval().
+  ///
+  /// @param mesh_values is a num_outputs by get_num_mesh_points() matrix
+  /// containing the points to interpolate between.
+  /// @param inputs must be a get_num_inputs() by num_queries matrix.
+  /// @param outputs must be a num_outputs by num_queries matrix; column i is
+  /// set to the interpolated value at column i of @p inputs.
+  void EvalBatch(const Eigen::Ref<const MatrixX<T>>& mesh_values,
+                 const Eigen::Ref<const MatrixX<T>>& inputs,
+                 EigenPtr<MatrixX<T>> outputs) const;
+
   /// Performs Eval, but with the possibility of the values on the mesh
   /// having a different scalar type than the values defining the mesh
   /// (symbolic::Expression containing decision variables for an optimization
@@ -176,6 +197,19 @@ class BarycentricMesh {
   std::vector<int> stride_;  // The number of elements to skip to arrive at the
                              // next value (per input dimension)
   int num_interpolants_{1};  // The number of points used in any interpolation.
+
+  // Contiguous copies of input_grid_, one vector per dimension, for O(1)
+  // indexed access during interpolation (std::set iteration is a pointer
+  // chase per element).
+  std::vector<std::vector<double>> coordinates_;
+
+  // inverse_spacing_[i][k] is 1 / (coordinates_[i][k+1] - coordinates_[i][k]),
+  // so the fractional position within a cell is a multiply, not a divide.
+  std::vector<std::vector<double>> inverse_spacing_;
+
+  // The grid interval used by the most recent query, per dimension; probed
+  // before falling back to binary search (see EvalBarycentricWeights).
+  mutable std::vector<int> cached_interval_;
 };
 
 }  // namespace math
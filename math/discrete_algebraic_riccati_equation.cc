@@ -1,5 +1,8 @@
 #include "drake/math/discrete_algebraic_riccati_equation.h"
 
+#include <algorithm>
+#include <stdexcept>
+
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_throw.h"
 #include "drake/common/is_approx_equal_abstol.h"
@@ -31,6 +34,28 @@ void check_stabilizable(const Eigen::Ref<const Eigen::MatrixXd>& A,
     DRAKE_THROW_UNLESS(qr.rank() == n);
   }
 }
+// Validates the dimensions and definiteness requirements shared by both
+// solver paths: Q must be symmetric positive semi-definite and R symmetric
+// positive definite.
+void validate_inputs(const Eigen::Ref<const Eigen::MatrixXd>& A,
+                     const Eigen::Ref<const Eigen::MatrixXd>& B,
+                     const Eigen::Ref<const Eigen::MatrixXd>& Q,
+                     const Eigen::Ref<const Eigen::MatrixXd>& R) {
+  int n = B.rows(), m = B.cols();
+  DRAKE_DEMAND(m <= n);
+  DRAKE_DEMAND(A.rows() == n && A.cols() == n);
+  DRAKE_DEMAND(Q.rows() == n && Q.cols() == n);
+  DRAKE_DEMAND(R.rows() == m && R.cols() == m);
+  DRAKE_DEMAND(is_approx_equal_abstol(Q, Q.transpose(), 1e-10));
+  Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> es(Q);
+  for (int i = 0; i < n; i++) {
+    DRAKE_THROW_UNLESS(es.eigenvalues()[i] >= 0);
+  }
+  DRAKE_DEMAND(is_approx_equal_abstol(R, R.transpose(), 1e-10));
+  Eigen::LLT<Eigen::MatrixXd> R_cholesky(R);
+  DRAKE_THROW_UNLESS(R_cholesky.info() == Eigen::Success);
+}
+
 void check_detectable(const Eigen::Ref<const Eigen::MatrixXd>& A,
                       const Eigen::Ref<const Eigen::MatrixXd>& Q) {
   // This function check if (A,C) is a detectable pair, where Q = C' * C.
@@ -347,7 +372,7 @@ void reorder_eigen(Eigen::Ref<Eigen::MatrixXd> S, Eigen::Ref<Eigen::MatrixXd> T,
 }  // namespace
 
 /**
- * DiscreteAlgebraicRiccatiEquation function
+ * DiscreteAlgebraicRiccatiEquationSchur function
  * computes the unique stabilizing solution X to the discrete-time algebraic
  * Riccati equation:
  * \f[
@@ -372,25 +397,14 @@ void reorder_eigen(Eigen::Ref<Eigen::MatrixXd> S, Eigen::Ref<Eigen::MatrixXd> T,
  * accuracy, together with more thorough tests.
  */
 
-Eigen::MatrixXd DiscreteAlgebraicRiccatiEquation(
+Eigen::MatrixXd DiscreteAlgebraicRiccatiEquationSchur(
     const Eigen::Ref<const Eigen::MatrixXd>& A,
     const Eigen::Ref<const Eigen::MatrixXd>& B,
     const Eigen::Ref<const Eigen::MatrixXd>& Q,
     const Eigen::Ref<const Eigen::MatrixXd>& R) {
-  int n = B.rows(), m = B.cols();
+  int n = B.rows();
 
-  DRAKE_DEMAND(m <= n);
-  DRAKE_DEMAND(A.rows() == n && A.cols() == n);
-  DRAKE_DEMAND(Q.rows() == n && Q.cols() == n);
-  DRAKE_DEMAND(R.rows() == m && R.cols() == m);
-  DRAKE_DEMAND(is_approx_equal_abstol(Q, Q.transpose(), 1e-10));
-  Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> es(Q);
-  for (int i = 0; i < n; i++) {
-    DRAKE_THROW_UNLESS(es.eigenvalues()[i] >= 0);
-  }
-  DRAKE_DEMAND(is_approx_equal_abstol(R, R.transpose(), 1e-10));
-  Eigen::LLT<Eigen::MatrixXd> R_cholesky(R);
-  DRAKE_THROW_UNLESS(R_cholesky.info() == Eigen::Success);
+  validate_inputs(A, B, Q, R);
   check_stabilizable(A, B);
   check_detectable(A, Q);
 
@@ -424,5 +438,68 @@ Eigen::MatrixXd DiscreteAlgebraicRiccatiEquation(
   return X;
 }
 
+Eigen::MatrixXd DiscreteAlgebraicRiccatiEquation(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R) {
+  // The eigenvalue reordering in the Schur Vector method moves one block at
+  // a time with full-width Givens rotations, so its cost grows roughly
+  // quartically with n; past the crossover the doubling iteration is much
+  // faster.
+  if (B.rows() >= kDareDoublingCrossoverSize) {
+    return DiscreteAlgebraicRiccatiEquationDoubling(A, B, Q, R);
+  }
+  return DiscreteAlgebraicRiccatiEquationSchur(A, B, Q, R);
+}
+
+Eigen::MatrixXd DiscreteAlgebraicRiccatiEquationDoubling(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R) {
+  int n = B.rows();
+
+  validate_inputs(A, B, Q, R);
+
+  // Structure-preserving doubling (SDA1): with
+  //   G_0 = B R⁻¹ Bᵀ,  H_0 = Q,  A_0 = A,
+  // iterate
+  //   A_{k+1} = A_k (I + G_k H_k)⁻¹ A_k,
+  //   G_{k+1} = G_k + A_k (I + G_k H_k)⁻¹ G_k A_kᵀ,
+  //   H_{k+1} = H_k + A_kᵀ H_k (I + G_k H_k)⁻¹ A_k.
+  // A_k represents the 2^k-step closed-loop dynamics, so H_k converges
+  // quadratically to the stabilizing solution X.
+  Eigen::LLT<Eigen::MatrixXd> R_cholesky(R);
+  Eigen::MatrixXd Ak = A;
+  Eigen::MatrixXd G = B * R_cholesky.solve(B.transpose());
+  Eigen::MatrixXd H = Q;
+
+  // Quadratic convergence means the iteration count stays modest even at
+  // very tight tolerances; failure to converge within the bound indicates a
+  // problem without a stabilizing solution.
+  const int kMaxIterations = 100;
+  const double kRelativeTolerance = 1e-13;
+  for (int iteration = 0; iteration < kMaxIterations; ++iteration) {
+    Eigen::PartialPivLU<Eigen::MatrixXd> lu(
+        Eigen::MatrixXd::Identity(n, n) + G * H);
+    const Eigen::MatrixXd W_inv_Ak = lu.solve(Ak);
+    const Eigen::MatrixXd W_inv_G = lu.solve(G);
+    Eigen::MatrixXd H_next = H + Ak.transpose() * (H * W_inv_Ak);
+    H_next = ((H_next + H_next.transpose()) / 2.0).eval();
+    G = G + Ak * (W_inv_G * Ak.transpose());
+    G = ((G + G.transpose()) / 2.0).eval();
+    Ak = (Ak * W_inv_Ak).eval();
+    const double update_norm = (H_next - H).norm();
+    H = H_next;
+    if (update_norm <= kRelativeTolerance * std::max(1.0, H.norm())) {
+      return H;
+    }
+  }
+  throw std::runtime_error(
+      "DiscreteAlgebraicRiccatiEquationDoubling failed to converge; check "
+      "that (A, B) is stabilizable and (A, Q) is detectable");
+}
+
 }  // namespace math
 }  // namespace drake
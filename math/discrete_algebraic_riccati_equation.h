@@ -22,11 +22,55 @@ namespace math {
 /// "On the Numerical Solution of the Discrete-Time Algebraic Riccati Equation"
 /// by Thrasyvoulos Pappas, Alan J. Laub, and Nils R. Sandell
 ///
+/// For large problems (more than kDareDoublingCrossoverSize states) this
+/// dispatches to DiscreteAlgebraicRiccatiEquationDoubling, whose cost scales
+/// far more gently with the state dimension.
 Eigen::MatrixXd DiscreteAlgebraicRiccatiEquation(
     const Eigen::Ref<const Eigen::MatrixXd>& A,
     const Eigen::Ref<const Eigen::MatrixXd>& B,
     const Eigen::Ref<const Eigen::MatrixXd>& Q,
     const Eigen::Ref<const Eigen::MatrixXd>& R);
+
+/// The state dimension at and above which DiscreteAlgebraicRiccatiEquation
+/// switches from the Schur Vector method to the doubling iteration.
+constexpr int kDareDoublingCrossoverSize = 75;
+
+/// Variant of DiscreteAlgebraicRiccatiEquation that always uses the Schur
+/// Vector method, regardless of problem size.  Prefer the dispatching
+/// DiscreteAlgebraicRiccatiEquation; this entry point exists for comparison
+/// against DiscreteAlgebraicRiccatiEquationDoubling.
+Eigen::MatrixXd DiscreteAlgebraicRiccatiEquationSchur(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R);
+
+/// Computes the unique stabilizing solution X to the discrete-time algebraic
+/// Riccati equation (see DiscreteAlgebraicRiccatiEquation for the equation)
+/// using the structure-preserving doubling algorithm.
+///
+/// Each iteration squares the closed-loop dynamics, so the iterate converges
+/// quadratically to the stabilizing solution in a few tens of passes, each
+/// costing one dense LU factorization and a handful of matrix products.  The
+/// low rank of B enters only through the initial B R⁻¹ Bᵀ product, so this
+/// method remains practical at state dimensions (n ≈ 2000) where the
+/// eigenvalue reordering in the Schur Vector method becomes prohibitive.
+///
+/// @throws std::runtime_error if Q is not positive semi-definite.
+/// @throws std::runtime_error if R is not positive definite.
+/// @throws std::runtime_error if the iteration fails to converge (e.g.
+/// because (A, B) is not stabilizable or (A, Q) is not detectable); unlike
+/// the Schur Vector path, those properties are not verified up front because
+/// doing so costs more than the solve itself at large n.
+///
+/// Based on the SDA1 algorithm of "Structure-Preserving Algorithms for
+/// Periodic Discrete-Time Algebraic Riccati Equations" by Eric King-Wah Chu,
+/// Hung-Yuan Fan, and Wen-Wei Lin.
+Eigen::MatrixXd DiscreteAlgebraicRiccatiEquationDoubling(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R);
 }  // namespace math
 }  // namespace drake
 
@@ -1,9 +1,15 @@
 #pragma once
 
+#include <algorithm>
+#include <numeric>
+#include <thread>
 #include <vector>
 
 #include <Eigen/SparseCore>
 
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
+
 namespace drake {
 namespace math {
 /**
@@ -81,5 +87,126 @@ void SparseMatrixToRowColumnValueVectors(
     }
   }
 }
+/**
+ * Assembles sparse matrices that share a fixed sparsity pattern, without
+ * re-sorting or reallocating per assembly.
+ *
+ * setFromTriplets() sorts and compresses the triplet list on every call,
+ * which dominates the cost of re-assembling a matrix (e.g. a KKT matrix in
+ * model-predictive control) whose pattern never changes.  This class analyzes
+ * the pattern once at construction, computing for each triplet the index of
+ * its destination slot in the compressed value array.  Refilling the numeric
+ * values is then a single O(nnz) scatter with no allocation; duplicate
+ * triplets accumulate, exactly as with setFromTriplets().
+ *
+ * @tparam Scalar the scalar type of the assembled matrix.
+ */
+template <typename Scalar>
+class SparseMatrixAssembler {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(SparseMatrixAssembler);
+
+  /**
+   * Analyzes the sparsity pattern defined by @p triplets for a @p num_rows by
+   * @p num_cols matrix.  The values in @p triplets provide the initial
+   * contents of matrix(); only the row/column structure is retained for
+   * subsequent Fill() calls.
+   */
+  SparseMatrixAssembler(int num_rows, int num_cols,
+                        const std::vector<Eigen::Triplet<Scalar>>& triplets)
+      : matrix_(num_rows, num_cols), scatter_(triplets.size()) {
+    matrix_.setFromTriplets(triplets.begin(), triplets.end());
+    matrix_.makeCompressed();
+
+    // Locate each triplet's slot in the compressed value array by binary
+    // search within its column.
+    const int* const outer = matrix_.outerIndexPtr();
+    const int* const inner = matrix_.innerIndexPtr();
+    for (int k = 0; k < num_triplets(); k++) {
+      const int col = triplets[k].col();
+      const int* const begin = inner + outer[col];
+      const int* const end = inner + outer[col + 1];
+      const int* const slot = std::lower_bound(begin, end, triplets[k].row());
+      DRAKE_ASSERT(slot != end && *slot == triplets[k].row());
+      scatter_[k] = static_cast<int>(slot - inner);
+    }
+
+    // Order the triplets by destination slot, so that parallel Fill() can
+    // hand each thread a contiguous, disjoint range of slots.
+    order_.resize(num_triplets());
+    std::iota(order_.begin(), order_.end(), 0);
+    std::sort(order_.begin(), order_.end(),
+              [this](int a, int b) { return scatter_[a] < scatter_[b]; });
+  }
+
+  /**
+   * Overwrites the numeric values of matrix() with a scatter of @p values,
+   * where values[k] corresponds to the k-th triplet passed to the
+   * constructor; duplicates accumulate.  Performs no allocation or sorting.
+   *
+   * @param values must have one entry per constructor triplet.
+   * @param num_threads number of threads used for the scatter; if <= 0, uses
+   * std::thread::hardware_concurrency().  The default (1) is fastest unless
+   * the matrix is large (hundreds of thousands of non-zeros).
+   */
+  void Fill(const std::vector<Scalar>& values, int num_threads = 1) {
+    DRAKE_DEMAND(static_cast<int>(values.size()) == num_triplets());
+    Scalar* const dest = matrix_.valuePtr();
+    if (num_threads <= 0) {
+      num_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (num_threads == 1) {
+      std::fill(dest, dest + matrix_.nonZeros(), Scalar(0));
+      for (int k = 0; k < num_triplets(); k++) {
+        dest[scatter_[k]] += values[k];
+      }
+      return;
+    }
+
+    // Partition the slot-ordered triplets into contiguous chunks, never
+    // splitting a slot across chunks, so each worker owns a disjoint range
+    // of the value array and no synchronization is needed.
+    auto worker = [&](int chunk_begin, int chunk_end) {
+      const int slot_begin = scatter_[order_[chunk_begin]];
+      const int slot_end = scatter_[order_[chunk_end - 1]] + 1;
+      std::fill(dest + slot_begin, dest + slot_end, Scalar(0));
+      for (int i = chunk_begin; i < chunk_end; i++) {
+        dest[scatter_[order_[i]]] += values[order_[i]];
+      }
+    };
+    std::vector<std::thread> threads;
+    int chunk_begin = 0;
+    for (int t = 0; t < num_threads && chunk_begin < num_triplets(); t++) {
+      int chunk_end = std::min<int>(
+          num_triplets(), (num_triplets() * (t + 1)) / num_threads);
+      while (chunk_end < num_triplets() &&
+             scatter_[order_[chunk_end]] == scatter_[order_[chunk_end - 1]]) {
+        chunk_end++;
+      }
+      if (chunk_end > chunk_begin) {
+        threads.emplace_back(worker, chunk_begin, chunk_end);
+        chunk_begin = chunk_end;
+      }
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+  }
+
+  /// Returns the assembled matrix (compressed column storage).
+  const Eigen::SparseMatrix<Scalar>& matrix() const { return matrix_; }
+
+  /// Returns the number of triplets in the pattern (>= matrix().nonZeros(),
+  /// with equality when there are no duplicates).
+  int num_triplets() const { return static_cast<int>(scatter_.size()); }
+
+ private:
+  Eigen::SparseMatrix<Scalar> matrix_;
+  // scatter_[k] is the index into matrix_.valuePtr() of the k-th triplet.
+  std::vector<int> scatter_;
+  // Triplet indices sorted by destination slot (see Fill).
+  std::vector<int> order_;
+};
+
 }  // namespace math
 }  // namespace drake
@@ -2,10 +2,15 @@
 
 #include <algorithm>
 #include <cmath>
+#include <exception>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <Eigen/Dense>
 
 #include "drake/common/autodiff.h"
+#include "drake/common/drake_assert.h"
 
 namespace drake {
 namespace math {
@@ -136,6 +141,135 @@ decltype(auto) jacobian(F &&f, Arg &&x) {
   return ret;
 }
 
+/** Computes the same result as ::jacobian, but evaluates the derivative
+   chunks on multiple threads.
+
+   The derivative directions are partitioned into chunks of up to
+   @p MaxChunkSize (see ::jacobian), and the chunks are distributed across
+   @p num_threads worker threads.  For functions that are expensive to
+   evaluate (e.g. full rigid body dynamics) with many inputs, the speedup is
+   close to linear in the number of threads.
+
+   @p f is invoked concurrently from several threads, each with its own
+   argument chunk; it must therefore be safe to call concurrently (e.g. it
+   only reads any shared state).  The serial ::jacobian has no such
+   requirement.
+
+   @param f function; must be safe to invoke concurrently.
+   @param x function argument value at which Jacobian will be evaluated.
+   @param num_threads number of worker threads; if <= 0 (the default), uses
+   std::thread::hardware_concurrency().
+   @return AutoDiffScalar matrix corresponding to the Jacobian of f evaluated
+   at x.
+ */
+template <int MaxChunkSize = 10, class F, class Arg>
+decltype(auto) parallel_jacobian(F &&f, Arg &&x, int num_threads = 0) {
+  using Eigen::AutoDiffScalar;
+  using Eigen::Index;
+  using Eigen::Matrix;
+
+  using ArgNoRef = typename std::remove_reference<Arg>::type;
+  using ArgScalar = typename ArgNoRef::Scalar;
+
+  using ReturnArgDerType = Matrix<ArgScalar, ArgNoRef::SizeAtCompileTime, 1, 0,
+                                  ArgNoRef::MaxSizeAtCompileTime, 1>;
+  using ReturnArgAutoDiffScalar = AutoDiffScalar<ReturnArgDerType>;
+  using ReturnArgAutoDiffType =
+      decltype(x.template cast<ReturnArgAutoDiffScalar>().eval());
+  using ReturnType = decltype(f(std::declval<ReturnArgAutoDiffType>()));
+
+  using ChunkArgDerType =
+      Matrix<ArgScalar, Eigen::Dynamic, 1, 0, MaxChunkSize, 1>;
+  using ChunkArgAutoDiffScalar = AutoDiffScalar<ChunkArgDerType>;
+  using ChunkArgType = typename std::decay<decltype(
+      x.template cast<ChunkArgAutoDiffScalar>().eval())>::type;
+  using ChunkReturnType =
+      typename std::decay<decltype(f(std::declval<ChunkArgType>()))>::type;
+
+  constexpr Index kMaxChunkSize = MaxChunkSize;
+  const Index num_derivs = x.size();
+  const Index num_chunks =
+      (num_derivs + kMaxChunkSize - 1) / kMaxChunkSize;
+
+  if (num_threads <= 0) {
+    num_threads = std::max(1, static_cast<int>(
+                                  std::thread::hardware_concurrency()));
+  }
+  num_threads = std::min<Index>(num_threads, num_chunks);
+
+  // With a single chunk (or a single thread) there is nothing to farm out.
+  if (num_threads <= 1) {
+    return jacobian<MaxChunkSize>(std::forward<F>(f), std::forward<Arg>(x));
+  }
+
+  // Evaluate the chunks across the worker threads.  Each worker takes every
+  // num_threads-th chunk, so the work is spread evenly even when f's cost
+  // varies with the derivative direction.
+  std::vector<ChunkReturnType> chunk_results(num_chunks);
+  std::vector<std::exception_ptr> errors(num_threads);
+  auto worker = [&](int thread_num) {
+    try {
+      for (Index chunk = thread_num; chunk < num_chunks;
+           chunk += num_threads) {
+        const Index deriv_num_start = chunk * kMaxChunkSize;
+        const Index chunk_size =
+            std::min(kMaxChunkSize, num_derivs - deriv_num_start);
+
+        ChunkArgType chunk_arg =
+            x.template cast<ChunkArgAutoDiffScalar>().eval();
+        for (Index i = 0; i < x.size(); i++) {
+          chunk_arg(i).derivatives().setZero(chunk_size);
+        }
+        for (Index i = 0; i < chunk_size; i++) {
+          chunk_arg(deriv_num_start + i).derivatives()(i) = ArgScalar(1);
+        }
+
+        chunk_results[chunk] = f(chunk_arg);
+      }
+    } catch (...) {
+      errors[thread_num] = std::current_exception();
+    }
+  };
+  std::vector<std::thread> threads;
+  for (int i = 1; i < num_threads; i++) {
+    threads.emplace_back(worker, i);
+  }
+  worker(0);
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  for (const std::exception_ptr &error : errors) {
+    if (error) std::rethrow_exception(error);
+  }
+
+  // Assemble the Jacobian from the per-chunk results, exactly as the serial
+  // implementation does.
+  ReturnType ret;
+  ret.resize(chunk_results[0].rows(), chunk_results[0].cols());
+  for (Index i = 0; i < ret.size(); i++) {
+    ret(i).value() = chunk_results[0](i).value();
+    ret(i).derivatives().resize(num_derivs);
+  }
+  for (Index chunk = 0; chunk < num_chunks; chunk++) {
+    const Index deriv_num_start = chunk * kMaxChunkSize;
+    const Index chunk_size =
+        std::min(kMaxChunkSize, num_derivs - deriv_num_start);
+    const ChunkReturnType &chunk_result = chunk_results[chunk];
+    DRAKE_ASSERT(chunk_result.rows() == ret.rows() &&
+                 chunk_result.cols() == ret.cols());
+    for (Index i = 0; i < chunk_result.size(); i++) {
+      // Assign each element individually, making use of conversion
+      // constructors (see the comment in ::jacobian).
+      for (Index j = 0; j < chunk_size; j++) {
+        ret(i).derivatives()(deriv_num_start + j) =
+            chunk_result(i).derivatives()(j);
+      }
+    }
+  }
+
+  return ret;
+}
+
 /** Computes a matrix of AutoDiffScalars from which the value, Jacobian,
    and Hessian of a function
    @f[
@@ -0,0 +1,228 @@
+#include "drake/math/reverse_autodiff.h"
+
+#include <cmath>
+
+namespace drake {
+namespace math {
+namespace {
+
+// The active tape for the calling thread, or nullptr when no ReverseAdTape is
+// in scope. Operations on constants are legal without an active tape; they
+// simply produce constants.
+thread_local ReverseAdTape* g_active_tape{nullptr};
+
+}  // namespace
+
+// Records a node for a unary operation whose result has the given value and
+// whose local partial with respect to @p a is @p partial. When @p a is a
+// constant the result is a constant and nothing is recorded.
+ReverseAd RecordUnaryOp(double value, const ReverseAd& a, double partial) {
+  if (a.index_ < 0) {
+    return ReverseAd{value};
+  }
+  DRAKE_ASSERT(g_active_tape != nullptr);
+  return ReverseAd{value,
+                   g_active_tape->Record(a.index_, partial, -1, 0.0)};
+}
+
+// Records a node for a binary operation. Constant operands contribute no
+// parent edge; when both operands are constants the result is a constant.
+ReverseAd RecordBinaryOp(double value, const ReverseAd& a, double partial_a,
+                         const ReverseAd& b, double partial_b) {
+  if (a.index_ < 0 && b.index_ < 0) {
+    return ReverseAd{value};
+  }
+  DRAKE_ASSERT(g_active_tape != nullptr);
+  return ReverseAd{value, g_active_tape->Record(a.index_, partial_a, b.index_,
+                                                partial_b)};
+}
+
+ReverseAd& ReverseAd::operator+=(const ReverseAd& rhs) {
+  *this = *this + rhs;
+  return *this;
+}
+
+ReverseAd& ReverseAd::operator-=(const ReverseAd& rhs) {
+  *this = *this - rhs;
+  return *this;
+}
+
+ReverseAd& ReverseAd::operator*=(const ReverseAd& rhs) {
+  *this = *this * rhs;
+  return *this;
+}
+
+ReverseAd& ReverseAd::operator/=(const ReverseAd& rhs) {
+  *this = *this / rhs;
+  return *this;
+}
+
+ReverseAd operator+(const ReverseAd& a, const ReverseAd& b) {
+  return RecordBinaryOp(a.value() + b.value(), a, 1.0, b, 1.0);
+}
+
+ReverseAd operator-(const ReverseAd& a, const ReverseAd& b) {
+  return RecordBinaryOp(a.value() - b.value(), a, 1.0, b, -1.0);
+}
+
+ReverseAd operator*(const ReverseAd& a, const ReverseAd& b) {
+  return RecordBinaryOp(a.value() * b.value(), a, b.value(), b, a.value());
+}
+
+ReverseAd operator/(const ReverseAd& a, const ReverseAd& b) {
+  const double inv_b = 1.0 / b.value();
+  return RecordBinaryOp(a.value() * inv_b, a, inv_b, b,
+                        -a.value() * inv_b * inv_b);
+}
+
+ReverseAd operator+(const ReverseAd& a) { return a; }
+
+ReverseAd operator-(const ReverseAd& a) {
+  return RecordUnaryOp(-a.value(), a, -1.0);
+}
+
+ReverseAd sin(const ReverseAd& a) {
+  return RecordUnaryOp(std::sin(a.value()), a, std::cos(a.value()));
+}
+
+ReverseAd cos(const ReverseAd& a) {
+  return RecordUnaryOp(std::cos(a.value()), a, -std::sin(a.value()));
+}
+
+ReverseAd tan(const ReverseAd& a) {
+  const double c = std::cos(a.value());
+  return RecordUnaryOp(std::tan(a.value()), a, 1.0 / (c * c));
+}
+
+ReverseAd asin(const ReverseAd& a) {
+  return RecordUnaryOp(std::asin(a.value()), a,
+                       1.0 / std::sqrt(1.0 - a.value() * a.value()));
+}
+
+ReverseAd acos(const ReverseAd& a) {
+  return RecordUnaryOp(std::acos(a.value()), a,
+                       -1.0 / std::sqrt(1.0 - a.value() * a.value()));
+}
+
+ReverseAd atan(const ReverseAd& a) {
+  return RecordUnaryOp(std::atan(a.value()), a,
+                       1.0 / (1.0 + a.value() * a.value()));
+}
+
+ReverseAd atan2(const ReverseAd& a, const ReverseAd& b) {
+  const double r2 = a.value() * a.value() + b.value() * b.value();
+  return RecordBinaryOp(std::atan2(a.value(), b.value()), a, b.value() / r2, b,
+                        -a.value() / r2);
+}
+
+ReverseAd exp(const ReverseAd& a) {
+  const double v = std::exp(a.value());
+  return RecordUnaryOp(v, a, v);
+}
+
+ReverseAd log(const ReverseAd& a) {
+  return RecordUnaryOp(std::log(a.value()), a, 1.0 / a.value());
+}
+
+ReverseAd sqrt(const ReverseAd& a) {
+  const double v = std::sqrt(a.value());
+  return RecordUnaryOp(v, a, 0.5 / v);
+}
+
+ReverseAd pow(const ReverseAd& a, double p) {
+  return RecordUnaryOp(std::pow(a.value(), p), a,
+                       p * std::pow(a.value(), p - 1));
+}
+
+ReverseAd abs(const ReverseAd& a) {
+  return RecordUnaryOp(std::abs(a.value()), a, a.value() < 0.0 ? -1.0 : 1.0);
+}
+
+ReverseAd min(const ReverseAd& a, const ReverseAd& b) {
+  return a.value() <= b.value() ? a : b;
+}
+
+ReverseAd max(const ReverseAd& a, const ReverseAd& b) {
+  return a.value() >= b.value() ? a : b;
+}
+
+std::ostream& operator<<(std::ostream& os, const ReverseAd& a) {
+  return os << a.value();
+}
+
+ReverseAdTape::ReverseAdTape() : previous_{g_active_tape} {
+  g_active_tape = this;
+}
+
+ReverseAdTape::~ReverseAdTape() {
+  DRAKE_DEMAND(g_active_tape == this);
+  g_active_tape = previous_;
+}
+
+ReverseAd ReverseAdTape::NewVariable(double value) {
+  DRAKE_DEMAND(g_active_tape == this);
+  return ReverseAd{value, Record(-1, 0.0, -1, 0.0)};
+}
+
+VectorX<ReverseAd> ReverseAdTape::NewVariables(
+    const Eigen::Ref<const Eigen::VectorXd>& values) {
+  VectorX<ReverseAd> result{values.size()};
+  for (int i = 0; i < values.size(); ++i) {
+    result[i] = NewVariable(values[i]);
+  }
+  return result;
+}
+
+int ReverseAdTape::Record(int parent0, double partial0, int parent1,
+                          double partial1) {
+  nodes_.push_back(Node{{parent0, parent1}, {partial0, partial1}});
+  return static_cast<int>(nodes_.size()) - 1;
+}
+
+Eigen::VectorXd ReverseAdTape::ComputeGradient(
+    const ReverseAd& y, const VectorX<ReverseAd>& x) const {
+  Eigen::VectorXd gradient{Eigen::VectorXd::Zero(x.size())};
+  if (y.index_ < 0) {
+    return gradient;  // y is a constant.
+  }
+  DRAKE_DEMAND(y.index_ < size());
+  // Backward sweep: the adjoint of a node is ∂y/∂node, accumulated from the
+  // nodes that consume it. Nodes are recorded in evaluation order, so a single
+  // reverse pass visits every consumer before its operands.
+  Eigen::VectorXd adjoint{Eigen::VectorXd::Zero(size())};
+  adjoint[y.index_] = 1.0;
+  for (int i = y.index_; i >= 0; --i) {
+    const double a = adjoint[i];
+    if (a == 0.0) {
+      continue;
+    }
+    const Node& node = nodes_[i];
+    for (int k = 0; k < 2; ++k) {
+      if (node.parent[k] >= 0) {
+        adjoint[node.parent[k]] += a * node.partial[k];
+      }
+    }
+  }
+  for (int j = 0; j < x.size(); ++j) {
+    if (x[j].index_ >= 0) {
+      DRAKE_DEMAND(x[j].index_ < size());
+      gradient[j] = adjoint[x[j].index_];
+    }
+  }
+  return gradient;
+}
+
+Eigen::VectorXd ComputeGradientReverseMode(
+    const std::function<ReverseAd(const VectorX<ReverseAd>&)>& f,
+    const Eigen::Ref<const Eigen::VectorXd>& x, double* value) {
+  ReverseAdTape tape;
+  const VectorX<ReverseAd> vars = tape.NewVariables(x);
+  const ReverseAd y = f(vars);
+  if (value != nullptr) {
+    *value = y.value();
+  }
+  return tape.ComputeGradient(y, vars);
+}
+
+}  // namespace math
+}  // namespace drake
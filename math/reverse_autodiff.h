@@ -0,0 +1,218 @@
+/// @file
+/// Reverse-mode (tape-based) automatic differentiation for scalar-valued
+/// functions of many variables.
+///
+/// Forward-mode autodiff (AutoDiffXd) propagates one derivative column per
+/// independent variable, so differentiating a scalar cost over n decision
+/// variables costs O(n) arithmetic per operation. Reverse mode records the
+/// computation on a tape during a single forward evaluation and then obtains
+/// the full gradient with one backward sweep, independent of n. Prefer it for
+/// scalar objectives over large decision vectors, such as trajectory
+/// optimization costs.
+
+#pragma once
+
+#include <functional>
+#include <ostream>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace math {
+
+class ReverseAdTape;
+
+/// A scalar participating in reverse-mode automatic differentiation. Every
+/// arithmetic operation on a non-constant ReverseAd records one node on the
+/// thread's active ReverseAdTape. A default-constructed ReverseAd (or one
+/// converted from double) is a constant with zero derivative and records
+/// nothing.
+///
+/// Independent variables are created with ReverseAdTape::NewVariable() or
+/// ReverseAdTape::NewVariables() while the tape is active; mixing variables
+/// from different tapes is undefined behavior.
+class ReverseAd {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ReverseAd)
+
+  /// Constructs a constant (zero-derivative) scalar.
+  // NOLINTNEXTLINE(runtime/explicit): This conversion is desirable.
+  ReverseAd(double value = 0.0) : value_(value) {}
+
+  /// Returns the numeric value of this scalar.
+  double value() const { return value_; }
+
+  ReverseAd& operator+=(const ReverseAd& rhs);
+  ReverseAd& operator-=(const ReverseAd& rhs);
+  ReverseAd& operator*=(const ReverseAd& rhs);
+  ReverseAd& operator/=(const ReverseAd& rhs);
+
+ private:
+  friend class ReverseAdTape;
+  friend ReverseAd RecordUnaryOp(double value, const ReverseAd& a,
+                                 double partial);
+  friend ReverseAd RecordBinaryOp(double value, const ReverseAd& a,
+                                  double partial_a, const ReverseAd& b,
+                                  double partial_b);
+
+  ReverseAd(double value, int index) : value_(value), index_(index) {}
+
+  double value_{0.0};
+  // Index of this scalar's node on the active tape, or -1 for a constant.
+  int index_{-1};
+};
+
+ReverseAd operator+(const ReverseAd& a, const ReverseAd& b);
+ReverseAd operator-(const ReverseAd& a, const ReverseAd& b);
+ReverseAd operator*(const ReverseAd& a, const ReverseAd& b);
+ReverseAd operator/(const ReverseAd& a, const ReverseAd& b);
+ReverseAd operator+(const ReverseAd& a);
+ReverseAd operator-(const ReverseAd& a);
+
+ReverseAd sin(const ReverseAd& a);
+ReverseAd cos(const ReverseAd& a);
+ReverseAd tan(const ReverseAd& a);
+ReverseAd asin(const ReverseAd& a);
+ReverseAd acos(const ReverseAd& a);
+ReverseAd atan(const ReverseAd& a);
+ReverseAd atan2(const ReverseAd& a, const ReverseAd& b);
+ReverseAd exp(const ReverseAd& a);
+ReverseAd log(const ReverseAd& a);
+ReverseAd sqrt(const ReverseAd& a);
+ReverseAd pow(const ReverseAd& a, double p);
+ReverseAd abs(const ReverseAd& a);
+ReverseAd min(const ReverseAd& a, const ReverseAd& b);
+ReverseAd max(const ReverseAd& a, const ReverseAd& b);
+
+// Comparisons look only at values; they never record on the tape.
+inline bool operator<(const ReverseAd& a, const ReverseAd& b) {
+  return a.value() < b.value();
+}
+inline bool operator<=(const ReverseAd& a, const ReverseAd& b) {
+  return a.value() <= b.value();
+}
+inline bool operator>(const ReverseAd& a, const ReverseAd& b) {
+  return a.value() > b.value();
+}
+inline bool operator>=(const ReverseAd& a, const ReverseAd& b) {
+  return a.value() >= b.value();
+}
+inline bool operator==(const ReverseAd& a, const ReverseAd& b) {
+  return a.value() == b.value();
+}
+inline bool operator!=(const ReverseAd& a, const ReverseAd& b) {
+  return a.value() != b.value();
+}
+
+std::ostream& operator<<(std::ostream& os, const ReverseAd& a);
+
+/// A tape of elementary operations for reverse-mode differentiation.
+/// Constructing a ReverseAdTape makes it the active tape for the current
+/// thread; its destructor restores the previously active tape, so tapes may
+/// nest (within one thread) like scopes.
+///
+/// Typical usage:
+/// @code
+/// ReverseAdTape tape;
+/// const VectorX<ReverseAd> x = tape.NewVariables(x_values);
+/// const ReverseAd y = MyCost(x);  // One forward evaluation.
+/// const Eigen::VectorXd dydx = tape.ComputeGradient(y, x);
+/// @endcode
+class ReverseAdTape {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ReverseAdTape)
+
+  ReverseAdTape();
+  ~ReverseAdTape();
+
+  /// Creates an independent variable with the given value. This tape must be
+  /// the active tape on the calling thread.
+  ReverseAd NewVariable(double value);
+
+  /// Creates one independent variable per entry of @p values.
+  VectorX<ReverseAd> NewVariables(const Eigen::Ref<const Eigen::VectorXd>& values);
+
+  /// Computes ∂y/∂x for every entry of @p x with a single backward sweep over
+  /// the tape. @p y and @p x must have been computed on this tape (entries of
+  /// @p x that are constants get a zero gradient entry, as does everything
+  /// when @p y is a constant).
+  Eigen::VectorXd ComputeGradient(const ReverseAd& y,
+                                  const VectorX<ReverseAd>& x) const;
+
+  /// Returns the number of nodes recorded so far.
+  int size() const { return static_cast<int>(nodes_.size()); }
+
+ private:
+  friend ReverseAd RecordUnaryOp(double value, const ReverseAd& a,
+                                 double partial);
+  friend ReverseAd RecordBinaryOp(double value, const ReverseAd& a,
+                                  double partial_a, const ReverseAd& b,
+                                  double partial_b);
+
+  // One elementary operation: up to two parents with the local partial
+  // derivative of this node's value with respect to each.
+  struct Node {
+    int parent[2];
+    double partial[2];
+  };
+
+  int Record(int parent0, double partial0, int parent1, double partial1);
+
+  std::vector<Node> nodes_;
+  ReverseAdTape* previous_{nullptr};
+};
+
+/// Evaluates the scalar-valued function @p f at @p x on a fresh tape and
+/// returns its gradient via one backward sweep. If @p value is non-null, the
+/// function value is stored there as well.
+Eigen::VectorXd ComputeGradientReverseMode(
+    const std::function<ReverseAd(const VectorX<ReverseAd>&)>& f,
+    const Eigen::Ref<const Eigen::VectorXd>& x, double* value = nullptr);
+
+}  // namespace math
+}  // namespace drake
+
+#if !defined(DRAKE_DOXYGEN_CXX)
+// Define Eigen traits needed for Matrix<drake::math::ReverseAd>.
+namespace Eigen {
+template <>
+struct NumTraits<drake::math::ReverseAd>
+    : GenericNumTraits<drake::math::ReverseAd> {
+  typedef drake::math::ReverseAd Real;
+  typedef drake::math::ReverseAd NonInteger;
+  typedef drake::math::ReverseAd Nested;
+  typedef double Literal;
+  static inline Real epsilon() { return NumTraits<double>::epsilon(); }
+  static inline Real dummy_precision() {
+    return NumTraits<double>::dummy_precision();
+  }
+  static inline int digits10() { return NumTraits<double>::digits10(); }
+  enum {
+    IsComplex = 0,
+    IsInteger = 0,
+    IsSigned = 1,
+    RequireInitialization = 1,
+    ReadCost = 1,
+    AddCost = 1,
+    MulCost = 1,
+  };
+};
+
+// Informs Eigen that ReverseAd op double (and vice versa) gets ReverseAd.
+template <typename BinaryOp>
+struct ScalarBinaryOpTraits<drake::math::ReverseAd, double, BinaryOp> {
+  enum { Defined = 1 };
+  typedef drake::math::ReverseAd ReturnType;
+};
+template <typename BinaryOp>
+struct ScalarBinaryOpTraits<double, drake::math::ReverseAd, BinaryOp> {
+  enum { Defined = 1 };
+  typedef drake::math::ReverseAd ReturnType;
+};
+}  // namespace Eigen
+#endif  // !defined(DRAKE_DOXYGEN_CXX)
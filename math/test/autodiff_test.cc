@@ -198,8 +198,6 @@ GTEST_TEST(AdditionalAutodiffTest, CastToAutoDiff) {
   EXPECT_EQ(dynamic_gradients.rows(), 2);
   EXPECT_EQ(dynamic_gradients.cols(), 0);
 
-  using VectorUpTo16d = Eigen::Matrix<double, Eigen::Dynamic, 1, 0, 16, 1>;
-  using AutoDiffUpTo16d = Eigen::AutoDiffScalar<VectorUpTo16d>;
   Vector2<AutoDiffUpTo16d> dynamic_max =
       Vector2d::Ones().cast<AutoDiffUpTo16d>();
   const auto dynamic_max_gradients = autoDiffToGradientMatrix(dynamic_max);
@@ -214,6 +212,26 @@ GTEST_TEST(AdditionalAutodiffTest, CastToAutoDiff) {
   EXPECT_TRUE(fixed_gradients.isZero(0.));
 }
 
+// The inline-storage scalar must produce the same values and gradients as
+// AutoDiffXd; only the derivative storage differs.
+GTEST_TEST(AdditionalAutodiffTest, UpTo16MatchesXd) {
+  const Vector3d point{0.3, -1.2, 2.5};
+
+  VectorX<AutoDiffXd> x_xd(3);
+  VectorX<AutoDiffUpTo16d> x_16(3);
+  for (int i = 0; i < 3; ++i) {
+    x_xd[i] = AutoDiffXd(point[i], VectorXd::Unit(3, i));
+    x_16[i] = AutoDiffUpTo16d(point[i], VectorUpTo16<double>::Unit(3, i));
+  }
+
+  const AutoDiffXd y_xd = x_xd[0] * sin(x_xd[1]) + exp(x_xd[2]) / x_xd[0];
+  const AutoDiffUpTo16d y_16 = x_16[0] * sin(x_16[1]) + exp(x_16[2]) / x_16[0];
+
+  EXPECT_DOUBLE_EQ(y_16.value(), y_xd.value());
+  EXPECT_TRUE(CompareMatrices(VectorXd{y_16.derivatives()}, y_xd.derivatives(),
+                              1e-14, MatrixCompareType::absolute));
+}
+
 }  // namespace
 }  // namespace math
 }  // namespace drake
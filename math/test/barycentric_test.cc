@@ -184,6 +184,51 @@ GTEST_TEST(BarycentricTest, MultidimensionalOutput) {
   EXPECT_TRUE(CompareMatrices(value, Vector2d{2.75, 6.75}, 1e-8));
 }
 
+GTEST_TEST(BarycentricTest, EvalBatch) {
+  BarycentricMesh<double> bary{{{0.0, 0.5, 1.0},  // BR
+                                {2.0},            // BR
+                                {0.0, 1.0, 3.0}}};
+
+  const int kNumOutputs = 2;
+  MatrixXd mesh_values(kNumOutputs, bary.get_num_mesh_points());
+  for (int i = 0; i < bary.get_num_mesh_points(); i++) {
+    const Vector3d point = bary.get_mesh_point(i);
+    mesh_values(0, i) = std::sin(point[0]) + point[2];
+    mesh_values(1, i) = point[0] * point[2] - 2.;
+  }
+
+  // A sweep through the input space, including points outside the grid, on
+  // cell boundaries, and exactly at grid points; consecutive columns often
+  // land in the same cell, exercising the cached interval.
+  const int kNumQueries = 25;
+  MatrixXd inputs(3, kNumQueries);
+  for (int j = 0; j < kNumQueries; j++) {
+    inputs.col(j) = Vector3d{-0.2 + 0.06 * j, 2.0, -0.5 + 0.17 * j};
+  }
+  inputs.col(10) = Vector3d{0.5, 2.0, 1.0};  // Exactly at a grid point.
+
+  MatrixXd outputs(kNumOutputs, kNumQueries);
+  bary.EvalBatch(mesh_values, inputs, &outputs);
+
+  Vector2d value;
+  for (int j = 0; j < kNumQueries; j++) {
+    bary.Eval(mesh_values, inputs.col(j), &value);
+    EXPECT_TRUE(CompareMatrices(outputs.col(j), value, 1e-14));
+  }
+
+  // A jump backwards (invalidating the cached interval) still evaluates
+  // correctly.
+  MatrixXd zigzag(3, 2);
+  zigzag.col(0) = Vector3d{0.9, 2.0, 2.5};
+  zigzag.col(1) = Vector3d{0.1, 2.0, 0.25};
+  outputs.resize(kNumOutputs, 2);
+  bary.EvalBatch(mesh_values, zigzag, &outputs);
+  for (int j = 0; j < 2; j++) {
+    bary.Eval(mesh_values, zigzag.col(j), &value);
+    EXPECT_TRUE(CompareMatrices(outputs.col(j), value, 1e-14));
+  }
+}
+
 Vector1d my_sine(const Eigen::Ref<const Vector1d>& x) {
   return Vector1d(std::sin(x[0]));
 }
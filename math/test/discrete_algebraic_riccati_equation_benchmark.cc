@@ -0,0 +1,76 @@
+/// @file
+/// Timing comparison between the Schur Vector and doubling-iteration solvers
+/// for the discrete-time algebraic Riccati equation, over a range of state
+/// dimensions with low-rank B.  Run it when tuning the dispatch crossover or
+/// changing either solver:
+///
+///   bazel run //math:discrete_algebraic_riccati_equation_benchmark
+///
+/// Each row reports the wall-clock solve time and the Frobenius norm of the
+/// Riccati residual; the Schur Vector method is skipped at sizes where it
+/// takes minutes.
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include <Eigen/Dense>
+#include <fmt/format.h>
+
+#include "drake/math/discrete_algebraic_riccati_equation.h"
+
+namespace drake {
+namespace math {
+namespace {
+
+using Eigen::MatrixXd;
+
+// Returns the Frobenius norm of the DARE residual for the solution X.
+double Residual(const MatrixXd& A, const MatrixXd& B, const MatrixXd& Q,
+                const MatrixXd& R, const MatrixXd& X) {
+  return (A.transpose() * X * A - X -
+          A.transpose() * X * B * (B.transpose() * X * B + R).inverse() *
+              B.transpose() * X * A +
+          Q)
+      .norm();
+}
+
+template <typename Solver>
+void RunOne(const std::string& name, const Solver& solver, const MatrixXd& A,
+            const MatrixXd& B, const MatrixXd& Q, const MatrixXd& R) {
+  using clock = std::chrono::steady_clock;
+  const clock::time_point start = clock::now();
+  const MatrixXd X = solver(A, B, Q, R);
+  const double elapsed_ms =
+      std::chrono::duration<double, std::milli>(clock::now() - start).count();
+  std::cout << fmt::format("  {:<10} {:>12.1f} ms   residual {:.2e}\n", name,
+                           elapsed_ms, Residual(A, B, Q, R, X));
+}
+
+int DoMain() {
+  const int m = 4;
+  for (int n : {50, 100, 200, 400, 800}) {
+    // A random system scaled to spectral radius 0.9, so that (A, B) is
+    // trivially stabilizable.
+    MatrixXd A = MatrixXd::Random(n, n);
+    Eigen::EigenSolver<MatrixXd> es(A, /* computeEigenvectors = */ false);
+    A *= 0.9 / es.eigenvalues().cwiseAbs().maxCoeff();
+    const MatrixXd B = MatrixXd::Random(n, m);
+    const MatrixXd Q = MatrixXd::Identity(n, n);
+    const MatrixXd R = MatrixXd::Identity(m, m);
+
+    std::cout << fmt::format("n = {}, m = {}\n", n, m);
+    RunOne("doubling", &DiscreteAlgebraicRiccatiEquationDoubling, A, B, Q, R);
+    if (n <= 100) {
+      // Above 100 states the Schur eigenvalue reordering takes minutes.
+      RunOne("schur", &DiscreteAlgebraicRiccatiEquationSchur, A, B, Q, R);
+    }
+  }
+  return 0;
+}
+
+}  // namespace
+}  // namespace math
+}  // namespace drake
+
+int main() { return drake::math::DoMain(); }
@@ -32,6 +32,16 @@ void SolveDAREandVerify(const Eigen::Ref<const MatrixXd>& A,
                               MatrixCompareType::absolute));
 }
 
+// Returns a random system whose A matrix is scaled to the given spectral
+// radius, so that (A, B) is trivially stabilizable when radius < 1.
+void MakeRandomStableSystem(int n, int m, double radius, MatrixXd* A,
+                            MatrixXd* B) {
+  *A = MatrixXd::Random(n, n);
+  Eigen::EigenSolver<MatrixXd> es(*A, /* computeEigenvectors = */ false);
+  *A *= radius / es.eigenvalues().cwiseAbs().maxCoeff();
+  *B = MatrixXd::Random(n, m);
+}
+
 GTEST_TEST(DARE, SolveDAREandVerify) {
   // Test 1: non-invertible A
   // Example 2 of "On the Numerical Solution of the Discrete-Time Algebraic
@@ -52,6 +62,43 @@ GTEST_TEST(DARE, SolveDAREandVerify) {
   R2 << 0.3;
   SolveDAREandVerify(A2, B2, Q2, R2);
 }
+
+GTEST_TEST(DARE, DoublingMatchesSchur) {
+  // The doubling solver agrees with the Schur Vector solver on the same
+  // small examples as above (including the non-invertible A).
+  int n1 = 4, m1 = 1;
+  MatrixXd A1(n1, n1), B1(n1, m1), Q1(n1, n1), R1(m1, m1);
+  A1 << 0.5, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0;
+  B1 << 0, 0, 0, 1;
+  Q1 << 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0;
+  R1 << 0.25;
+  EXPECT_TRUE(CompareMatrices(
+      DiscreteAlgebraicRiccatiEquationDoubling(A1, B1, Q1, R1),
+      DiscreteAlgebraicRiccatiEquation(A1, B1, Q1, R1), 1E-10,
+      MatrixCompareType::absolute));
+
+  int n2 = 2, m2 = 1;
+  MatrixXd A2(n2, n2), B2(n2, m2), Q2(n2, n2), R2(m2, m2);
+  A2 << 1, 1, 0, 1;
+  B2 << 0, 1;
+  Q2 << 1, 0, 0, 0;
+  R2 << 0.3;
+  EXPECT_TRUE(CompareMatrices(
+      DiscreteAlgebraicRiccatiEquationDoubling(A2, B2, Q2, R2),
+      DiscreteAlgebraicRiccatiEquation(A2, B2, Q2, R2), 1E-10,
+      MatrixCompareType::absolute));
+}
+
+GTEST_TEST(DARE, LargeScaleDispatchesToDoubling) {
+  // Above the crossover size the main entry point dispatches to the doubling
+  // iteration; verify the solution on a random stable system with low-rank B.
+  const int n = kDareDoublingCrossoverSize + 45, m = 4;
+  MatrixXd A, B;
+  MakeRandomStableSystem(n, m, 0.9, &A, &B);
+  const MatrixXd Q = MatrixXd::Identity(n, n);
+  const MatrixXd R = MatrixXd::Identity(m, m);
+  SolveDAREandVerify(A, B, Q, R);
+}
 }  // namespace
 }  // namespace math
 }  // namespace drake
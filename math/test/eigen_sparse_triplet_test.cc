@@ -1,5 +1,7 @@
 #include "drake/math/eigen_sparse_triplet.h"
 
+#include <cstdlib>
+
 #include <gtest/gtest.h>
 
 namespace drake {
@@ -73,6 +75,70 @@ GTEST_TEST(testEigenSparseTriplet, sparseToTriplet) {
   sp_mat4.setFromTriplets(triplets.begin(), triplets.end());
   checkTriplet(sp_mat4);
 }
+
+/**
+ * Test that SparseMatrixAssembler reproduces setFromTriplets (including the
+ * accumulation of duplicate triplets) on the initial assembly and on refills,
+ * both serial and parallel.
+ */
+GTEST_TEST(testEigenSparseTriplet, sparseMatrixAssembler) {
+  std::vector<Eigen::Triplet<double>> triplets;
+  triplets.push_back(Eigen::Triplet<double>(0, 0, 1.0));
+  triplets.push_back(Eigen::Triplet<double>(0, 1, 2.0));
+  triplets.push_back(Eigen::Triplet<double>(1, 1, 3.0));
+  triplets.push_back(Eigen::Triplet<double>(2, 2, 4.0));
+  // A duplicate entry; its values should accumulate.
+  triplets.push_back(Eigen::Triplet<double>(0, 1, 5.0));
+
+  SparseMatrixAssembler<double> assembler(3, 3, triplets);
+  EXPECT_EQ(assembler.num_triplets(), 5);
+  EXPECT_EQ(assembler.matrix().nonZeros(), 4);
+
+  Eigen::SparseMatrix<double> expected(3, 3);
+  expected.setFromTriplets(triplets.begin(), triplets.end());
+  EXPECT_TRUE(assembler.matrix().isApprox(expected));
+
+  // Refill with new values, keeping the same pattern.
+  std::vector<double> values{10., 20., 30., 40., 50.};
+  for (int k = 0; k < 5; k++) {
+    triplets[k] = Eigen::Triplet<double>(triplets[k].row(), triplets[k].col(),
+                                         values[k]);
+  }
+  expected.setFromTriplets(triplets.begin(), triplets.end());
+
+  assembler.Fill(values);
+  EXPECT_TRUE(assembler.matrix().isApprox(expected));
+
+  // The parallel scatter produces the same matrix.
+  assembler.Fill(std::vector<double>(5, 0.), 2);
+  assembler.Fill(values, 2);
+  EXPECT_TRUE(assembler.matrix().isApprox(expected));
+
+  // A larger random pattern, refilled with several thread counts.
+  std::srand(42);
+  triplets.clear();
+  const int n = 40;
+  for (int k = 0; k < 300; k++) {
+    triplets.push_back(Eigen::Triplet<double>(
+        std::rand() % n, std::rand() % n, 0.1 * k - 7.));
+  }
+  SparseMatrixAssembler<double> big(n, n, triplets);
+  expected.resize(n, n);
+  expected.setFromTriplets(triplets.begin(), triplets.end());
+  EXPECT_TRUE(big.matrix().isApprox(expected));
+  std::vector<double> big_values;
+  for (int k = 0; k < 300; k++) big_values.push_back(3. - 0.2 * k);
+  for (int k = 0; k < 300; k++) {
+    triplets[k] = Eigen::Triplet<double>(triplets[k].row(), triplets[k].col(),
+                                         big_values[k]);
+  }
+  expected.setFromTriplets(triplets.begin(), triplets.end());
+  for (int num_threads : {1, 3, 0}) {
+    big.Fill(std::vector<double>(300, 0.));
+    big.Fill(big_values, num_threads);
+    EXPECT_TRUE(big.matrix().isApprox(expected));
+  }
+}
 }  // namespace
 }  // namespace math
 }  // namespace drake
@@ -78,6 +78,43 @@ TEST_F(AutodiffJacobianTest, QuadraticForm) {
       CompareMatrices(jac_expected, jac, 1e-12, MatrixCompareType::absolute));
 }
 
+TEST_F(AutodiffJacobianTest, ParallelMatchesSerial) {
+  using Eigen::MatrixXd;
+  using Eigen::VectorXd;
+
+  const int n = 37;  // Not a multiple of the chunk size.
+  MatrixXd A(n, n);
+  FillWithNumbersIncreasingFromZero(A);
+
+  // Work around GCC 5.4 Wshadow bug; the bug is fixed as of GCC 6.1.
+  // https://gcc.gnu.org/bugzilla/show_bug.cgi?id=67273.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wshadow"
+  auto quadratic_form = [&](const auto& x) {
+#pragma GCC diagnostic pop
+    using Scalar = typename std::remove_reference<decltype(x)>::type::Scalar;
+    return (x.transpose() * A.cast<Scalar>().eval() * x).eval();
+  };
+
+  VectorXd x(n);
+  FillWithNumbersIncreasingFromZero(x);
+
+  auto jac_serial = jacobian(quadratic_form, x);
+  auto jac_parallel = parallel_jacobian(quadratic_form, x);
+  auto jac_two_threads = parallel_jacobian<4>(quadratic_form, x, 2);
+  auto jac_one_thread = parallel_jacobian(quadratic_form, x, 1);
+
+  // Ensure that the parallel mode has no effect on output type.
+  static_assert(
+      std::is_same<decltype(jac_serial), decltype(jac_parallel)>::value,
+      "jacobian output type mismatch");
+
+  // Ensure that the results are the same.
+  EXPECT_TRUE(jac_serial == jac_parallel);
+  EXPECT_TRUE(jac_serial == jac_two_threads);
+  EXPECT_TRUE(jac_serial == jac_one_thread);
+}
+
 class AutoDiffHessianTest : public ::testing::Test {};
 
 // Example: quadratic function
@@ -0,0 +1,146 @@
+#include "drake/math/reverse_autodiff.h"
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace math {
+namespace {
+
+using Eigen::VectorXd;
+
+// Differentiates a function with a hand-computed gradient.
+GTEST_TEST(ReverseAutodiffTest, BasicGradient) {
+  ReverseAdTape tape;
+  const ReverseAd x = tape.NewVariable(0.7);
+  const ReverseAd y = tape.NewVariable(-1.3);
+
+  // f = x * sin(y) + exp(x) / y.
+  const ReverseAd f = x * sin(y) + exp(x) / y;
+  EXPECT_DOUBLE_EQ(f.value(),
+                   0.7 * std::sin(-1.3) + std::exp(0.7) / -1.3);
+
+  VectorX<ReverseAd> vars{2};
+  vars << x, y;
+  const VectorXd gradient = tape.ComputeGradient(f, vars);
+
+  // ∂f/∂x = sin(y) + exp(x) / y.
+  // ∂f/∂y = x * cos(y) - exp(x) / y².
+  VectorXd expected{2};
+  expected << std::sin(-1.3) + std::exp(0.7) / -1.3,
+      0.7 * std::cos(-1.3) - std::exp(0.7) / (1.3 * 1.3);
+  EXPECT_TRUE(CompareMatrices(gradient, expected, 1e-14,
+                              MatrixCompareType::absolute));
+}
+
+// A constant result has a zero gradient, and constant subexpressions do not
+// grow the tape.
+GTEST_TEST(ReverseAutodiffTest, Constants) {
+  ReverseAdTape tape;
+  const VectorX<ReverseAd> x = tape.NewVariables(VectorXd::Ones(3));
+  const int size_after_variables = tape.size();
+
+  const ReverseAd c = ReverseAd{2.0} * 3.0 + sin(ReverseAd{0.5});
+  EXPECT_EQ(tape.size(), size_after_variables);
+
+  const VectorXd gradient = tape.ComputeGradient(c, x);
+  EXPECT_TRUE(CompareMatrices(gradient, VectorXd::Zero(3)));
+}
+
+// The gradient of a scalar cost over a long decision vector matches the
+// forward-difference estimate. This is the trajectory-optimization shape that
+// motivates reverse mode: one backward sweep instead of one forward pass per
+// variable.
+GTEST_TEST(ReverseAutodiffTest, LongDecisionVector) {
+  const int n = 600;
+  VectorXd x_value{n};
+  for (int i = 0; i < n; ++i) {
+    x_value[i] = std::sin(0.1 * i);
+  }
+
+  // A smooth penalty coupling neighboring knots, as in a running cost.
+  const auto cost = [](const VectorX<ReverseAd>& x) {
+    ReverseAd result{0.0};
+    for (int i = 0; i + 1 < x.size(); ++i) {
+      const ReverseAd diff = x[i + 1] - x[i];
+      result += diff * diff + 0.01 * cos(x[i]);
+    }
+    return result;
+  };
+
+  double value{};
+  const VectorXd gradient = ComputeGradientReverseMode(cost, x_value, &value);
+  ASSERT_EQ(gradient.size(), n);
+
+  // Analytic gradient: ∂/∂xᵢ = -2(xᵢ₊₁-xᵢ) + 2(xᵢ-xᵢ₋₁) - 0.01 sin(xᵢ),
+  // with the boundary terms dropped as appropriate.
+  VectorXd expected{VectorXd::Zero(n)};
+  for (int i = 0; i + 1 < n; ++i) {
+    const double diff = x_value[i + 1] - x_value[i];
+    expected[i] += -2 * diff - 0.01 * std::sin(x_value[i]);
+    expected[i + 1] += 2 * diff;
+  }
+  EXPECT_TRUE(CompareMatrices(gradient, expected, 1e-12,
+                              MatrixCompareType::absolute));
+}
+
+// Tapes nest like scopes; the inner tape does not disturb the outer one.
+GTEST_TEST(ReverseAutodiffTest, NestedTapes) {
+  ReverseAdTape outer;
+  const ReverseAd x = outer.NewVariable(2.0);
+  const ReverseAd y = x * x;
+
+  double inner_value{};
+  const VectorXd inner_gradient = ComputeGradientReverseMode(
+      [](const VectorX<ReverseAd>& z) { return z[0] * z[0] * z[0]; },
+      Vector1<double>{3.0}, &inner_value);
+  EXPECT_DOUBLE_EQ(inner_value, 27.0);
+  EXPECT_DOUBLE_EQ(inner_gradient[0], 27.0);
+
+  // The outer tape still differentiates correctly.
+  VectorX<ReverseAd> vars{1};
+  vars << x;
+  const VectorXd gradient = outer.ComputeGradient(y, vars);
+  EXPECT_DOUBLE_EQ(gradient[0], 4.0);
+}
+
+// min/max/abs propagate the derivative of the active branch.
+GTEST_TEST(ReverseAutodiffTest, NonSmoothFunctions) {
+  ReverseAdTape tape;
+  const ReverseAd x = tape.NewVariable(-2.0);
+  const ReverseAd y = tape.NewVariable(5.0);
+  VectorX<ReverseAd> vars{2};
+  vars << x, y;
+
+  const VectorXd d_min = tape.ComputeGradient(min(x, y), vars);
+  EXPECT_DOUBLE_EQ(d_min[0], 1.0);
+  EXPECT_DOUBLE_EQ(d_min[1], 0.0);
+
+  const VectorXd d_max = tape.ComputeGradient(max(x, y), vars);
+  EXPECT_DOUBLE_EQ(d_max[0], 0.0);
+  EXPECT_DOUBLE_EQ(d_max[1], 1.0);
+
+  const VectorXd d_abs = tape.ComputeGradient(abs(x), vars);
+  EXPECT_DOUBLE_EQ(d_abs[0], -1.0);
+  EXPECT_DOUBLE_EQ(d_abs[1], 0.0);
+}
+
+// Eigen expressions over VectorX<ReverseAd> work through NumTraits.
+GTEST_TEST(ReverseAutodiffTest, EigenInterop) {
+  ReverseAdTape tape;
+  const VectorX<ReverseAd> x = tape.NewVariables(Eigen::Vector3d{1., 2., 3.});
+  const ReverseAd squared_norm = x.dot(x);
+  EXPECT_DOUBLE_EQ(squared_norm.value(), 14.0);
+
+  const VectorXd gradient = tape.ComputeGradient(squared_norm, x);
+  EXPECT_TRUE(CompareMatrices(gradient, Eigen::Vector3d{2., 4., 6.}, 1e-14,
+                              MatrixCompareType::absolute));
+}
+
+}  // namespace
+}  // namespace math
+}  // namespace drake
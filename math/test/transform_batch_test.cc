@@ -0,0 +1,138 @@
+#include "drake/math/transform_batch.h"
+
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace math {
+namespace {
+
+using Eigen::MatrixX3d;
+using Eigen::Vector3d;
+
+const double kTolerance = 8 * std::numeric_limits<double>::epsilon();
+
+// Returns a batch of n distinct non-trivial transforms.
+std::vector<RigidTransformd> MakeTestTransforms(int n, double seed) {
+  std::vector<RigidTransformd> result;
+  for (int i = 0; i < n; ++i) {
+    const double theta = seed + 0.1 * i;
+    result.push_back(
+        RigidTransformd(RotationMatrixd::MakeZRotation(theta) *
+                            RotationMatrixd::MakeXRotation(2 * theta),
+                        Vector3d(std::sin(theta), std::cos(2 * theta),
+                                 0.3 * i - 1.0)));
+  }
+  return result;
+}
+
+GTEST_TEST(TransformBatchTest, PackRoundTrip) {
+  const std::vector<RigidTransformd> X = MakeTestTransforms(7, 0.5);
+  const RigidTransformBatch batch(X);
+  ASSERT_EQ(batch.size(), 7);
+  const std::vector<RigidTransformd> unpacked = batch.ToVector();
+  for (int i = 0; i < batch.size(); ++i) {
+    EXPECT_TRUE(CompareMatrices(unpacked[i].rotation().matrix(),
+                                X[i].rotation().matrix()));
+    EXPECT_TRUE(CompareMatrices(unpacked[i].translation(),
+                                X[i].translation()));
+  }
+
+  // A size-constructed batch holds identities.
+  const RigidTransformBatch identities(3);
+  EXPECT_TRUE(CompareMatrices(identities.GetTransform(1).GetAsMatrix4(),
+                              Eigen::Matrix4d::Identity()));
+}
+
+GTEST_TEST(TransformBatchTest, ComposeAllRotations) {
+  const int n = 33;  // Not a multiple of the vector width.
+  std::vector<RotationMatrixd> R_AB, R_BC;
+  for (const RigidTransformd& X : MakeTestTransforms(n, 0.1)) {
+    R_AB.push_back(X.rotation());
+  }
+  for (const RigidTransformd& X : MakeTestTransforms(n, 2.7)) {
+    R_BC.push_back(X.rotation());
+  }
+
+  RotationMatrixBatch R_AC_batch(n);
+  ComposeAll(RotationMatrixBatch(R_AB), RotationMatrixBatch(R_BC),
+             &R_AC_batch);
+  std::vector<RotationMatrixd> R_AC_aos;
+  ComposeAll(R_AB, R_BC, &R_AC_aos);
+  for (int i = 0; i < n; ++i) {
+    const RotationMatrixd expected = R_AB[i] * R_BC[i];
+    EXPECT_TRUE(CompareMatrices(R_AC_batch.GetRotation(i).matrix(),
+                                expected.matrix(), kTolerance));
+    EXPECT_TRUE(CompareMatrices(R_AC_aos[i].matrix(), expected.matrix()));
+  }
+}
+
+GTEST_TEST(TransformBatchTest, ComposeAllTransforms) {
+  const int n = 33;
+  const std::vector<RigidTransformd> X_AB = MakeTestTransforms(n, 0.3);
+  const std::vector<RigidTransformd> X_BC = MakeTestTransforms(n, 1.9);
+
+  RigidTransformBatch X_AC_batch(n);
+  ComposeAll(RigidTransformBatch(X_AB), RigidTransformBatch(X_BC),
+             &X_AC_batch);
+  std::vector<RigidTransformd> X_AC_aos;
+  ComposeAll(X_AB, X_BC, &X_AC_aos);
+  for (int i = 0; i < n; ++i) {
+    const RigidTransformd expected = X_AB[i] * X_BC[i];
+    EXPECT_TRUE(CompareMatrices(X_AC_batch.GetTransform(i).GetAsMatrix4(),
+                                expected.GetAsMatrix4(), kTolerance));
+    EXPECT_TRUE(CompareMatrices(X_AC_aos[i].GetAsMatrix4(),
+                                expected.GetAsMatrix4()));
+  }
+}
+
+GTEST_TEST(TransformBatchTest, RotateAndTransformAll) {
+  const int n = 19;
+  const std::vector<RigidTransformd> X_AB = MakeTestTransforms(n, 0.8);
+  const RigidTransformBatch X_batch(X_AB);
+  std::vector<RotationMatrixd> rotations;
+  for (const RigidTransformd& X : X_AB) rotations.push_back(X.rotation());
+  const RotationMatrixBatch R_batch(rotations);
+
+  MatrixX3d v_B(n, 3);
+  for (int i = 0; i < n; ++i) {
+    v_B.row(i) = Vector3d(0.1 * i, 1.0 - 0.2 * i, std::sin(0.3 * i));
+  }
+
+  MatrixX3d v_A(n, 3);
+  RotateAll(R_batch, v_B, &v_A);
+  MatrixX3d p_A(n, 3);
+  TransformAll(X_batch, v_B, &p_A);
+  for (int i = 0; i < n; ++i) {
+    const Vector3d v_B_i = v_B.row(i);
+    EXPECT_TRUE(CompareMatrices(Vector3d(v_A.row(i)),
+                                rotations[i] * v_B_i, kTolerance));
+    EXPECT_TRUE(CompareMatrices(Vector3d(p_A.row(i)), X_AB[i] * v_B_i,
+                                kTolerance));
+  }
+}
+
+GTEST_TEST(TransformBatchTest, SizeMismatchThrows) {
+  const RigidTransformBatch X_3(3);
+  const RigidTransformBatch X_4(4);
+  RigidTransformBatch X_out(3);
+  EXPECT_THROW(ComposeAll(X_3, X_4, &X_out), std::runtime_error);
+  EXPECT_THROW(ComposeAll(X_4, X_4, &X_out), std::runtime_error);
+
+  MatrixX3d wrong_size(4, 3);
+  MatrixX3d out(3, 3);
+  EXPECT_THROW(TransformAll(X_3, wrong_size, &out), std::runtime_error);
+
+  std::vector<RigidTransformd> aos_out;
+  EXPECT_THROW(ComposeAll(MakeTestTransforms(3, 0.0),
+                          MakeTestTransforms(4, 0.0), &aos_out),
+               std::runtime_error);
+}
+
+}  // namespace
+}  // namespace math
+}  // namespace drake
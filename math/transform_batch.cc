@@ -0,0 +1,180 @@
+#include "drake/math/transform_batch.h"
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace math {
+
+RotationMatrixBatch::RotationMatrixBatch(int size) {
+  DRAKE_THROW_UNLESS(size >= 0);
+  lanes_.setZero(9, size);
+  lanes_.row(0).setOnes();
+  lanes_.row(4).setOnes();
+  lanes_.row(8).setOnes();
+}
+
+RotationMatrixBatch::RotationMatrixBatch(const std::vector<RotationMatrixd>& R)
+    : lanes_(9, R.size()) {
+  for (int i = 0; i < size(); ++i) {
+    const Eigen::Matrix3d& matrix = R[i].matrix();
+    for (int r = 0; r < 3; ++r) {
+      for (int c = 0; c < 3; ++c) {
+        lanes_(3 * r + c, i) = matrix(r, c);
+      }
+    }
+  }
+}
+
+RotationMatrixd RotationMatrixBatch::GetRotation(int i) const {
+  DRAKE_THROW_UNLESS(i >= 0 && i < size());
+  Eigen::Matrix3d matrix;
+  for (int r = 0; r < 3; ++r) {
+    for (int c = 0; c < 3; ++c) {
+      matrix(r, c) = lanes_(3 * r + c, i);
+    }
+  }
+  return RotationMatrixd(matrix);
+}
+
+std::vector<RotationMatrixd> RotationMatrixBatch::ToVector() const {
+  std::vector<RotationMatrixd> result;
+  result.reserve(size());
+  for (int i = 0; i < size(); ++i) {
+    result.push_back(GetRotation(i));
+  }
+  return result;
+}
+
+RigidTransformBatch::RigidTransformBatch(int size) {
+  DRAKE_THROW_UNLESS(size >= 0);
+  lanes_.setZero(12, size);
+  lanes_.row(0).setOnes();
+  lanes_.row(4).setOnes();
+  lanes_.row(8).setOnes();
+}
+
+RigidTransformBatch::RigidTransformBatch(const std::vector<RigidTransformd>& X)
+    : lanes_(12, X.size()) {
+  for (int i = 0; i < size(); ++i) {
+    const Eigen::Matrix3d& matrix = X[i].rotation().matrix();
+    for (int r = 0; r < 3; ++r) {
+      for (int c = 0; c < 3; ++c) {
+        lanes_(3 * r + c, i) = matrix(r, c);
+      }
+    }
+    lanes_.template block<3, 1>(9, i) = X[i].translation();
+  }
+}
+
+RigidTransformd RigidTransformBatch::GetTransform(int i) const {
+  DRAKE_THROW_UNLESS(i >= 0 && i < size());
+  Eigen::Matrix3d matrix;
+  for (int r = 0; r < 3; ++r) {
+    for (int c = 0; c < 3; ++c) {
+      matrix(r, c) = lanes_(3 * r + c, i);
+    }
+  }
+  return RigidTransformd(RotationMatrixd(matrix),
+                         lanes_.template block<3, 1>(9, i));
+}
+
+std::vector<RigidTransformd> RigidTransformBatch::ToVector() const {
+  std::vector<RigidTransformd> result;
+  result.reserve(size());
+  for (int i = 0; i < size(); ++i) {
+    result.push_back(GetTransform(i));
+  }
+  return result;
+}
+
+void ComposeAll(const RotationMatrixBatch& R_AB,
+                const RotationMatrixBatch& R_BC, RotationMatrixBatch* R_AC) {
+  DRAKE_DEMAND(R_AC != nullptr);
+  DRAKE_DEMAND(R_AC != &R_AB && R_AC != &R_BC);
+  DRAKE_THROW_UNLESS(R_AB.size() == R_BC.size() &&
+                     R_AC->size() == R_AB.size());
+  // Each output lane is an elementwise product-sum of whole input lanes, so
+  // Eigen streams it through the vector units.
+  for (int r = 0; r < 3; ++r) {
+    for (int c = 0; c < 3; ++c) {
+      R_AC->mutable_lane(3 * r + c).array() =
+          R_AB.lane(3 * r).array() * R_BC.lane(c).array() +
+          R_AB.lane(3 * r + 1).array() * R_BC.lane(3 + c).array() +
+          R_AB.lane(3 * r + 2).array() * R_BC.lane(6 + c).array();
+    }
+  }
+}
+
+void ComposeAll(const RigidTransformBatch& X_AB,
+                const RigidTransformBatch& X_BC, RigidTransformBatch* X_AC) {
+  DRAKE_DEMAND(X_AC != nullptr);
+  DRAKE_DEMAND(X_AC != &X_AB && X_AC != &X_BC);
+  DRAKE_THROW_UNLESS(X_AB.size() == X_BC.size() &&
+                     X_AC->size() == X_AB.size());
+  for (int r = 0; r < 3; ++r) {
+    for (int c = 0; c < 3; ++c) {
+      X_AC->mutable_lane(3 * r + c).array() =
+          X_AB.lane(3 * r).array() * X_BC.lane(c).array() +
+          X_AB.lane(3 * r + 1).array() * X_BC.lane(3 + c).array() +
+          X_AB.lane(3 * r + 2).array() * X_BC.lane(6 + c).array();
+    }
+    // p_AC = R_AB * p_BC + p_AB, lane-wise.
+    X_AC->mutable_lane(9 + r).array() =
+        X_AB.lane(3 * r).array() * X_BC.lane(9).array() +
+        X_AB.lane(3 * r + 1).array() * X_BC.lane(10).array() +
+        X_AB.lane(3 * r + 2).array() * X_BC.lane(11).array() +
+        X_AB.lane(9 + r).array();
+  }
+}
+
+void ComposeAll(const std::vector<RotationMatrixd>& R_AB,
+                const std::vector<RotationMatrixd>& R_BC,
+                std::vector<RotationMatrixd>* R_AC) {
+  DRAKE_DEMAND(R_AC != nullptr);
+  DRAKE_THROW_UNLESS(R_AB.size() == R_BC.size());
+  R_AC->resize(R_AB.size());
+  for (size_t i = 0; i < R_AB.size(); ++i) {
+    (*R_AC)[i] = R_AB[i] * R_BC[i];
+  }
+}
+
+void ComposeAll(const std::vector<RigidTransformd>& X_AB,
+                const std::vector<RigidTransformd>& X_BC,
+                std::vector<RigidTransformd>* X_AC) {
+  DRAKE_DEMAND(X_AC != nullptr);
+  DRAKE_THROW_UNLESS(X_AB.size() == X_BC.size());
+  X_AC->resize(X_AB.size());
+  for (size_t i = 0; i < X_AB.size(); ++i) {
+    (*X_AC)[i] = X_AB[i] * X_BC[i];
+  }
+}
+
+void RotateAll(const RotationMatrixBatch& R_AB, const Eigen::MatrixX3d& v_B,
+               EigenPtr<Eigen::MatrixX3d> v_A) {
+  DRAKE_DEMAND(v_A != nullptr);
+  DRAKE_THROW_UNLESS(v_B.rows() == R_AB.size() && v_A->rows() == R_AB.size());
+  for (int r = 0; r < 3; ++r) {
+    v_A->col(r).array() =
+        R_AB.lane(3 * r).transpose().array() * v_B.col(0).array() +
+        R_AB.lane(3 * r + 1).transpose().array() * v_B.col(1).array() +
+        R_AB.lane(3 * r + 2).transpose().array() * v_B.col(2).array();
+  }
+}
+
+void TransformAll(const RigidTransformBatch& X_AB,
+                  const Eigen::MatrixX3d& p_BoQ_B,
+                  EigenPtr<Eigen::MatrixX3d> p_AoQ_A) {
+  DRAKE_DEMAND(p_AoQ_A != nullptr);
+  DRAKE_THROW_UNLESS(p_BoQ_B.rows() == X_AB.size() &&
+                     p_AoQ_A->rows() == X_AB.size());
+  for (int r = 0; r < 3; ++r) {
+    p_AoQ_A->col(r).array() =
+        X_AB.lane(3 * r).transpose().array() * p_BoQ_B.col(0).array() +
+        X_AB.lane(3 * r + 1).transpose().array() * p_BoQ_B.col(1).array() +
+        X_AB.lane(3 * r + 2).transpose().array() * p_BoQ_B.col(2).array() +
+        X_AB.lane(9 + r).transpose().array();
+  }
+}
+
+}  // namespace math
+}  // namespace drake
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/math/rotation_matrix.h"
+
+namespace drake {
+namespace math {
+
+/// A structure-of-arrays (SoA) packing of a batch of RotationMatrix<double>.
+/// Lane i is a contiguous row of length size() holding element
+/// `R(i / 3, i % 3)` of every rotation in the batch, so the batch kernels in
+/// this file stream whole lanes through the CPU's vector units instead of
+/// composing one 3x3 matrix at a time.  Pack once, run many kernels, and
+/// unpack only when conventional RotationMatrix objects are needed again.
+class RotationMatrixBatch {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RotationMatrixBatch)
+
+  /// Creates a batch of @p size identity rotations.
+  explicit RotationMatrixBatch(int size);
+
+  /// Packs the array-of-structures rotation list @p R into SoA form.
+  explicit RotationMatrixBatch(const std::vector<RotationMatrixd>& R);
+
+  /// Returns the number of rotations in the batch.
+  int size() const { return static_cast<int>(lanes_.cols()); }
+
+  /// Returns rotation @p i in conventional form.
+  RotationMatrixd GetRotation(int i) const;
+
+  /// Unpacks the whole batch back to array-of-structures form.
+  std::vector<RotationMatrixd> ToVector() const;
+
+  /// (Advanced)  Returns lane @p i, i.e. element `(i / 3, i % 3)` of every
+  /// rotation in the batch as a contiguous row vector.
+  Eigen::Ref<const Eigen::RowVectorXd> lane(int i) const {
+    return lanes_.row(i);
+  }
+
+  /// (Advanced)  Mutable version of lane().
+  Eigen::Ref<Eigen::RowVectorXd> mutable_lane(int i) { return lanes_.row(i); }
+
+ private:
+  // Row-major so that each lane (row) is contiguous in memory.
+  Eigen::Matrix<double, 9, Eigen::Dynamic, Eigen::RowMajor> lanes_;
+};
+
+/// A structure-of-arrays packing of a batch of RigidTransform<double>,
+/// analogous to RotationMatrixBatch.  Lanes 0..8 hold the rotation elements
+/// `R(i / 3, i % 3)` and lanes 9..11 hold the translation components.
+class RigidTransformBatch {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RigidTransformBatch)
+
+  /// Creates a batch of @p size identity transforms.
+  explicit RigidTransformBatch(int size);
+
+  /// Packs the array-of-structures transform list @p X into SoA form.
+  explicit RigidTransformBatch(const std::vector<RigidTransformd>& X);
+
+  /// Returns the number of transforms in the batch.
+  int size() const { return static_cast<int>(lanes_.cols()); }
+
+  /// Returns transform @p i in conventional form.
+  RigidTransformd GetTransform(int i) const;
+
+  /// Unpacks the whole batch back to array-of-structures form.
+  std::vector<RigidTransformd> ToVector() const;
+
+  /// (Advanced)  Returns lane @p i (see the class overview for the layout)
+  /// as a contiguous row vector.
+  Eigen::Ref<const Eigen::RowVectorXd> lane(int i) const {
+    return lanes_.row(i);
+  }
+
+  /// (Advanced)  Mutable version of lane().
+  Eigen::Ref<Eigen::RowVectorXd> mutable_lane(int i) { return lanes_.row(i); }
+
+ private:
+  Eigen::Matrix<double, 12, Eigen::Dynamic, Eigen::RowMajor> lanes_;
+};
+
+/// Composes `R_AC[i] = R_AB[i] * R_BC[i]` for every i in the batch with
+/// vectorized lane arithmetic.
+/// @throws std::runtime_error unless all three batches have the same size.
+/// @pre R_AC does not alias R_AB or R_BC.
+void ComposeAll(const RotationMatrixBatch& R_AB,
+                const RotationMatrixBatch& R_BC, RotationMatrixBatch* R_AC);
+
+/// Composes `X_AC[i] = X_AB[i] * X_BC[i]` for every i in the batch with
+/// vectorized lane arithmetic.
+/// @throws std::runtime_error unless all three batches have the same size.
+/// @pre X_AC does not alias X_AB or X_BC.
+void ComposeAll(const RigidTransformBatch& X_AB,
+                const RigidTransformBatch& X_BC, RigidTransformBatch* X_AC);
+
+/// Convenience array-of-structures form of ComposeAll; for peak throughput
+/// in hot loops prefer packing into RotationMatrixBatch once and composing
+/// in SoA form.  X_AC is resized as needed and may alias either input.
+/// @throws std::runtime_error unless X_AB and X_BC have the same size.
+void ComposeAll(const std::vector<RotationMatrixd>& R_AB,
+                const std::vector<RotationMatrixd>& R_BC,
+                std::vector<RotationMatrixd>* R_AC);
+
+/// Convenience array-of-structures form of ComposeAll for rigid transforms;
+/// see the RotationMatrixd overload for details.
+void ComposeAll(const std::vector<RigidTransformd>& X_AB,
+                const std::vector<RigidTransformd>& X_BC,
+                std::vector<RigidTransformd>* X_AC);
+
+/// Rotates one vector per batch entry: `v_A[i] = R_AB[i] * v_B[i]`.  The
+/// vectors are stored SoA as size()-by-3 matrices whose columns are the
+/// (contiguous) x, y, and z lanes.
+/// @throws std::runtime_error unless v_B and v_A are size()-by-3.
+/// @pre v_A does not alias v_B.
+void RotateAll(const RotationMatrixBatch& R_AB, const Eigen::MatrixX3d& v_B,
+               EigenPtr<Eigen::MatrixX3d> v_A);
+
+/// Transforms one position vector per batch entry:
+/// `p_AoQ_A[i] = X_AB[i] * p_BoQ_B[i]`, with the same SoA vector layout as
+/// RotateAll.
+/// @throws std::runtime_error unless p_BoQ_B and p_AoQ_A are size()-by-3.
+/// @pre p_AoQ_A does not alias p_BoQ_B.
+void TransformAll(const RigidTransformBatch& X_AB,
+                  const Eigen::MatrixX3d& p_BoQ_B,
+                  EigenPtr<Eigen::MatrixX3d> p_AoQ_A);
+
+}  // namespace math
+}  // namespace drake
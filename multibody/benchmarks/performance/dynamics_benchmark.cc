@@ -0,0 +1,188 @@
+/// @file
+/// Timing micro-benchmarks for the multibody dynamics kernels that dominate
+/// simulation cost: position kinematics, mass-matrix computation, inverse
+/// dynamics, and the discrete contact update (which exercises the
+/// ImplicitStribeckSolver end to end). Run it before and after a change to
+/// spot regressions:
+///
+///   bazel run //multibody/benchmarks/performance:dynamics_benchmark
+///
+/// Each benchmark is calibrated to run for at least half a second and
+/// reports nanoseconds per iteration. Configurations alternate between two
+/// position vectors each iteration so that caching never short-circuits the
+/// computation being measured.
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/diagram_builder.h"
+
+namespace drake {
+namespace multibody {
+namespace benchmarks {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using geometry::HalfSpace;
+using geometry::Sphere;
+using systems::Context;
+
+// Runs `body` repeatedly, doubling the iteration count until the total
+// elapsed time reaches half a second, and returns the measured cost in
+// nanoseconds per iteration.
+double MeasureNsPerIteration(const std::function<void()>& body) {
+  using clock = std::chrono::steady_clock;
+  const double kMinElapsedNs = 0.5e9;
+  int64_t iterations = 1;
+  for (;;) {
+    const clock::time_point start = clock::now();
+    for (int64_t i = 0; i < iterations; ++i) body();
+    const double elapsed_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() -
+                                                             start)
+            .count();
+    if (elapsed_ns >= kMinElapsedNs) {
+      return elapsed_ns / iterations;
+    }
+    iterations *= 2;
+  }
+}
+
+void Report(const std::string& name, double ns_per_iteration) {
+  std::cout << fmt::format("{:<48} {:>14.1f} ns/iter\n", name,
+                           ns_per_iteration);
+}
+
+// Benchmarks position kinematics, mass matrix, and inverse dynamics on the
+// articulated model loaded from `resource_path`, labeling each benchmark
+// with `label`.
+void RunArticulatedModelBenchmarks(const std::string& label,
+                                   const std::string& resource_path) {
+  MultibodyPlant<double> plant;
+  Parser(&plant).AddModelFromFile(FindResourceOrThrow(resource_path));
+  plant.Finalize();
+  std::unique_ptr<Context<double>> context = plant.CreateDefaultContext();
+
+  // Two distinct configurations, alternated each iteration so that position
+  // kinematics cannot be reused from the previous iteration.
+  const VectorXd q0 = plant.GetPositions(*context);
+  const VectorXd q1 =
+      q0 + VectorXd::Constant(plant.num_positions(), 1e-3);
+  bool flip = false;
+
+  const Body<double>& last_body =
+      plant.get_body(BodyIndex(plant.num_bodies() - 1));
+  Report(label + "/PositionKinematics", MeasureNsPerIteration([&]() {
+           flip = !flip;
+           plant.SetPositions(context.get(), flip ? q1 : q0);
+           plant.EvalBodyPoseInWorld(*context, last_body);
+         }));
+
+  MatrixXd H(plant.num_velocities(), plant.num_velocities());
+  Report(label + "/MassMatrixViaInverseDynamics",
+         MeasureNsPerIteration([&]() {
+           flip = !flip;
+           plant.SetPositions(context.get(), flip ? q1 : q0);
+           plant.CalcMassMatrixViaInverseDynamics(*context, &H);
+         }));
+
+  const VectorXd known_vdot = VectorXd::Zero(plant.num_velocities());
+  const MultibodyForces<double> external_forces(plant);
+  VectorXd tau(plant.num_velocities());
+  Report(label + "/InverseDynamics", MeasureNsPerIteration([&]() {
+           flip = !flip;
+           plant.SetPositions(context.get(), flip ? q1 : q0);
+           tau = plant.CalcInverseDynamics(*context, known_vdot,
+                                           external_forces);
+         }));
+}
+
+// Benchmarks the discrete TAMSI contact update — and with it the
+// ImplicitStribeckSolver — by stepping a time-stepping plant with several
+// bodies in persistent contact with a ground plane.
+void RunContactSolverBenchmark() {
+  const double kTimeStep = 1e-3;
+  const double kRadius = 0.05;
+  const double kMass = 0.5;
+  const int kNumBodies = 4;
+  const CoulombFriction<double> surface_friction(0.9, 0.6);
+
+  systems::DiagramBuilder<double> builder;
+  auto items = AddMultibodyPlantSceneGraph(
+      &builder, std::make_unique<MultibodyPlant<double>>(kTimeStep));
+  MultibodyPlant<double>& plant = items.plant;
+
+  plant.RegisterCollisionGeometry(
+      plant.world_body(),
+      HalfSpace::MakePose(Vector3d::UnitZ(), Vector3d::Zero()), HalfSpace(),
+      "ground_collision", surface_friction);
+
+  for (int i = 0; i < kNumBodies; ++i) {
+    const UnitInertia<double> G_Bcm = UnitInertia<double>::SolidSphere(kRadius);
+    const SpatialInertia<double> M_Bcm(kMass, Vector3d::Zero(), G_Bcm);
+    const RigidBody<double>& body =
+        plant.AddRigidBody(fmt::format("body{}", i), M_Bcm);
+    plant.RegisterCollisionGeometry(body, Isometry3<double>::Identity(),
+                                    Sphere(kRadius), "collision",
+                                    surface_friction);
+  }
+  plant.Finalize();
+
+  std::unique_ptr<systems::Diagram<double>> diagram = builder.Build();
+  std::unique_ptr<Context<double>> diagram_context =
+      diagram->CreateDefaultContext();
+  Context<double>& plant_context =
+      diagram->GetMutableSubsystemContext(plant, diagram_context.get());
+
+  // Rests every body on the plane with a slight penetration so that each
+  // step solves a contact problem with all bodies active.
+  for (int i = 0; i < kNumBodies; ++i) {
+    const math::RigidTransformd X_WB(
+        Vector3d(4 * kRadius * i, 0.0, kRadius - 1e-5));
+    plant.SetFreeBodyPose(&plant_context,
+                          plant.GetBodyByName(fmt::format("body{}", i)),
+                          X_WB.GetAsIsometry3());
+  }
+
+  systems::Simulator<double> simulator(*diagram, std::move(diagram_context));
+  simulator.Initialize();
+  double time = 0.0;
+  Report("BodiesOnPlane/DiscreteContactStep", MeasureNsPerIteration([&]() {
+           time += kTimeStep;
+           simulator.StepTo(time);
+         }));
+}
+
+int DoMain() {
+  RunArticulatedModelBenchmarks(
+      "Iiwa",
+      "drake/manipulation/models/iiwa_description/sdf/"
+      "iiwa14_no_collision.sdf");
+  RunArticulatedModelBenchmarks(
+      "AllegroHand",
+      "drake/manipulation/models/allegro_hand_description/sdf/"
+      "allegro_hand_description_right.sdf");
+  RunContactSolverBenchmark();
+  return 0;
+}
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace multibody
+}  // namespace drake
+
+int main() { return drake::multibody::benchmarks::DoMain(); }
@@ -34,10 +34,16 @@ AngleBetweenVectorsConstraint::AngleBetweenVectorsConstraint(
 
 void AngleBetweenVectorsConstraint::DoEval(
     const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y) const {
-  // TODO(avalenzu): Re-work to avoid round-trip through AutoDiffXd (#10205).
-  AutoDiffVecXd y_t;
-  Eval(math::initializeAutoDiff(x), &y_t);
-  *y = math::autoDiffToValueMatrix(y_t);
+  // Evaluates the constraint value g(q) = a_unit_Aᵀ * R_AB(q) * b_unit_B
+  // directly, without computing gradients (and hence without the Jacobian
+  // needed by the AutoDiffXd overload).
+  y->resize(1);
+  UpdateContextConfiguration(context_, plant_, x);
+  const Frame<double>& frameA = plant_.get_frame(frameA_index_);
+  const Frame<double>& frameB = plant_.get_frame(frameB_index_);
+  const Matrix3<double> R_AB =
+      plant_.CalcRelativeTransform(*context_, frameA, frameB).linear();
+  (*y)(0) = a_unit_A_.dot(R_AB * b_unit_B_);
 }
 
 void AngleBetweenVectorsConstraint::DoEval(
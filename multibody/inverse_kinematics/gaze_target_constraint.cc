@@ -38,10 +38,20 @@ GazeTargetConstraint::GazeTargetConstraint(
 
 void GazeTargetConstraint::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
                                   Eigen::VectorXd* y) const {
-  // TODO(avalenzu): Re-work to avoid round-trip through AutoDiffXd (#10205).
-  AutoDiffVecXd y_t;
-  Eval(math::initializeAutoDiff(x), &y_t);
-  *y = math::autoDiffToValueMatrix(y_t);
+  // Evaluates the constraint value directly, without computing gradients
+  // (and hence without the Jacobian needed by the AutoDiffXd overload). See
+  // that overload for the definition of g(q).
+  y->resize(2);
+  UpdateContextConfiguration(context_, plant_, x);
+  const Frame<double>& frameA = plant_.get_frame(frameA_index_);
+  const Frame<double>& frameB = plant_.get_frame(frameB_index_);
+  Vector3<double> p_AT;
+  plant_.CalcPointsPositions(*context_, frameB, p_BT_, frameA, &p_AT);
+  const Vector3<double> p_ST_A = p_AT - p_AS_;
+  const double p_dot_n = p_ST_A.dot(n_A_);
+  (*y)(0) = p_dot_n;
+  (*y)(1) = p_dot_n * p_dot_n -
+            std::pow(cos_cone_half_angle_, 2) * p_ST_A.squaredNorm();
 }
 
 void GazeTargetConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
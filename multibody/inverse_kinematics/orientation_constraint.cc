@@ -30,10 +30,18 @@ OrientationConstraint::OrientationConstraint(
 
 void OrientationConstraint::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
                                    Eigen::VectorXd* y) const {
-  // TODO(avalenzu): Re-work to avoid round-trip through AutoDiffXd (#10205).
-  AutoDiffVecXd y_t;
-  Eval(math::initializeAutoDiff(x), &y_t);
-  *y = math::autoDiffToValueMatrix(y_t);
+  // Evaluates the constraint value g(q) = tr(R_AB(q)) directly, without
+  // computing gradients (and hence without the Jacobian needed by the
+  // AutoDiffXd overload).
+  y->resize(1);
+  UpdateContextConfiguration(context_, plant_, x);
+  const Frame<double>& frameAbar = plant_.get_frame(frameAbar_index_);
+  const Frame<double>& frameBbar = plant_.get_frame(frameBbar_index_);
+  const Matrix3<double> R_AbarBbar =
+      plant_.CalcRelativeTransform(*context_, frameAbar, frameBbar).linear();
+  const Matrix3<double> R_AB =
+      R_AbarA_.inverse().matrix() * R_AbarBbar * R_BbarB_.matrix();
+  (*y)(0) = R_AB.trace();
 }
 
 void OrientationConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
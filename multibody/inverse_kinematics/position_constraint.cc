@@ -27,10 +27,15 @@ PositionConstraint::PositionConstraint(
 
 void PositionConstraint::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
                                 Eigen::VectorXd* y) const {
-  // TODO(avalenzu): Re-work to avoid round-trip through AutoDiffXd (#10205).
-  AutoDiffVecXd y_t;
-  Eval(math::initializeAutoDiff(x), &y_t);
-  *y = math::autoDiffToValueMatrix(y_t);
+  // Evaluates the constraint value directly, without computing gradients
+  // (and hence without the Jacobian needed by the AutoDiffXd overload).
+  y->resize(3);
+  UpdateContextConfiguration(context_, plant_, x);
+  const Frame<double>& frameA = plant_.get_frame(frameA_index_);
+  const Frame<double>& frameB = plant_.get_frame(frameB_index_);
+  Eigen::Vector3d p_AQ{};
+  plant_.CalcPointsPositions(*context_, frameB, p_BQ_, frameA, &p_AQ);
+  *y = p_AQ;
 }
 
 void PositionConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
@@ -5,6 +5,7 @@
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
+#include "drake/multibody/math/spatial_kernels.h"
 #include "drake/multibody/math/spatial_vector.h"
 
 namespace drake {
@@ -193,6 +194,19 @@ class SpatialForce : public SpatialVector<SpatialForce, T> {
   T dot(const SpatialVelocity<T>& V_IBp_E) const;
 };
 
+#ifndef DRAKE_DOXYGEN_CXX
+// For T = double this hot composition dispatches to the kernels in
+// spatial_kernels.h, which select an explicitly vectorized implementation
+// at runtime when the CPU supports it. Results are bit-identical to the
+// generic implementation above.
+template <>
+inline SpatialForce<double>& SpatialForce<double>::ShiftInPlace(
+    const Vector3<double>& p_BpBq_E) {
+  internal::ShiftSpatialForceInPlace(p_BpBq_E.data(), this->mutable_data());
+  return *this;
+}
+#endif
+
 /// Computes the resultant spatial force as the addition of two spatial forces
 /// `F1_Sp_E` and `F2_Sp_E` on a same system or body S, at the same point P and
 /// expressed in the same frame E.
@@ -0,0 +1,71 @@
+#include "drake/multibody/math/spatial_kernels.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+bool DetectAvx2Support() {
+#if defined(__x86_64__) || defined(__i386__)
+  return Avx2KernelsAreCompiled() && __builtin_cpu_supports("avx2");
+#else
+  return false;
+#endif
+}
+
+}  // namespace
+
+// The portable scalar kernels below spell out the component formulas so that
+// they match the vectorized kernels operation for operation; see the file
+// comment in spatial_kernels.h regarding bit-identical results.
+
+bool SpatialKernelsUseAvx2() {
+  static const bool use_avx2 = DetectAvx2Support();
+  return use_avx2;
+}
+
+void ShiftSpatialVelocityInPlace(const double* p_BpBq_E, double* V) {
+  if (SpatialKernelsUseAvx2()) {
+    ShiftSpatialVelocityInPlaceAvx2(p_BpBq_E, V);
+    return;
+  }
+  // v += w × p.
+  V[3] += V[1] * p_BpBq_E[2] - V[2] * p_BpBq_E[1];
+  V[4] += V[2] * p_BpBq_E[0] - V[0] * p_BpBq_E[2];
+  V[5] += V[0] * p_BpBq_E[1] - V[1] * p_BpBq_E[0];
+}
+
+void ComposeShiftedSpatialVelocity(const double* V_WP, const double* p_PoBo_E,
+                                   const double* V_PB, double* V_WB) {
+  if (SpatialKernelsUseAvx2()) {
+    ComposeShiftedSpatialVelocityAvx2(V_WP, p_PoBo_E, V_PB, V_WB);
+    return;
+  }
+  // w_WB = w_WP + w_PB.
+  V_WB[0] = V_WP[0] + V_PB[0];
+  V_WB[1] = V_WP[1] + V_PB[1];
+  V_WB[2] = V_WP[2] + V_PB[2];
+  // v_WB = (v_WP + w_WP × p) + v_PB.
+  V_WB[3] = (V_WP[3] + (V_WP[1] * p_PoBo_E[2] - V_WP[2] * p_PoBo_E[1])) +
+            V_PB[3];
+  V_WB[4] = (V_WP[4] + (V_WP[2] * p_PoBo_E[0] - V_WP[0] * p_PoBo_E[2])) +
+            V_PB[4];
+  V_WB[5] = (V_WP[5] + (V_WP[0] * p_PoBo_E[1] - V_WP[1] * p_PoBo_E[0])) +
+            V_PB[5];
+}
+
+void ShiftSpatialForceInPlace(const double* p_BpBq_E, double* F) {
+  if (SpatialKernelsUseAvx2()) {
+    ShiftSpatialForceInPlaceAvx2(p_BpBq_E, F);
+    return;
+  }
+  // tau -= p × f.
+  const double* f = F + 3;
+  F[0] -= p_BpBq_E[1] * f[2] - p_BpBq_E[2] * f[1];
+  F[1] -= p_BpBq_E[2] * f[0] - p_BpBq_E[0] * f[2];
+  F[2] -= p_BpBq_E[0] * f[1] - p_BpBq_E[1] * f[0];
+}
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
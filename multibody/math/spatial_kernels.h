@@ -0,0 +1,61 @@
+#pragma once
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+/// @file
+/// (Internal use only) Double-precision kernels for the spatial algebra
+/// compositions that dominate the inner loops of the multibody kinematics
+/// and dynamics sweeps: SpatialVelocity::ShiftInPlace(),
+/// SpatialVelocity::ComposeWithMovingFrameVelocity() and
+/// SpatialForce::ShiftInPlace(). On x86 hosts with AVX2 an explicitly
+/// vectorized implementation is selected at runtime via CPU feature
+/// detection; everywhere else a portable scalar implementation is used.
+/// Both implementations perform the same arithmetic operations in the same
+/// order (in particular, no FMA contraction), so results are bit-identical
+/// across the two paths.
+///
+/// All 6-element arrays below are spatial vectors stored with the rotational
+/// component in elements [0, 3) and the translational component in elements
+/// [3, 6), matching SpatialVector's layout; 3-element arrays are position
+/// vectors. Arrays may be unaligned; no allocation is performed.
+
+/// Returns true iff the AVX2 kernels were compiled in and the host CPU
+/// supports them. Exposed for testing; the kernels below dispatch on this
+/// internally.
+bool SpatialKernelsUseAvx2();
+
+/// In-place shift of a spatial velocity `V` = [w, v] by `p_BpBq_E`:
+/// `v += w × p_BpBq_E`, with `w` unchanged. See
+/// SpatialVelocity::ShiftInPlace().
+void ShiftSpatialVelocityInPlace(const double* p_BpBq_E, double* V);
+
+/// Composition of the spatial velocity `V_WP` = [w_WP, v_WP] of a frame P
+/// with the spatial velocity `V_PB` of a frame B moving on P, with B's
+/// origin shifted by `p_PoBo_E` from P's origin:
+///   V_WB = [w_WP + w_PB, (v_WP + w_WP × p_PoBo_E) + v_PB].
+/// `V_WB` must not alias the inputs. See
+/// SpatialVelocity::ComposeWithMovingFrameVelocity().
+void ComposeShiftedSpatialVelocity(const double* V_WP, const double* p_PoBo_E,
+                                   const double* V_PB, double* V_WB);
+
+/// In-place shift of a spatial force `F` = [tau, f] by `p_BpBq_E`:
+/// `tau -= p_BpBq_E × f`, with `f` unchanged. See
+/// SpatialForce::ShiftInPlace().
+void ShiftSpatialForceInPlace(const double* p_BpBq_E, double* F);
+
+// The AVX2 variants of the kernels above, defined in
+// spatial_kernels_avx2.cc, which is the only translation unit compiled with
+// AVX2 code generation enabled. Never call these directly; they abort when
+// Avx2KernelsAreCompiled() is false.
+bool Avx2KernelsAreCompiled();
+void ShiftSpatialVelocityInPlaceAvx2(const double* p_BpBq_E, double* V);
+void ComposeShiftedSpatialVelocityAvx2(const double* V_WP,
+                                       const double* p_PoBo_E,
+                                       const double* V_PB, double* V_WB);
+void ShiftSpatialForceInPlaceAvx2(const double* p_BpBq_E, double* F);
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,99 @@
+// This is the only translation unit compiled with AVX2 code generation
+// enabled (see the copts of the :spatial_kernels_avx2 target). It must
+// contain only the AVX2 kernel bodies: callers reach them exclusively
+// through the dispatch in spatial_kernels.cc, which first checks CPU
+// support at runtime so that no AVX2 instruction ever executes on an
+// unsupported host.
+
+#include "drake/multibody/math/spatial_kernels.h"
+
+#include "drake/common/drake_assert.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+// Mask selecting the first three lanes of a 256-bit vector of doubles, used
+// to load/store 3-element arrays without touching memory past their end.
+__m256i Mask3() { return _mm256_setr_epi64x(-1, -1, -1, 0); }
+
+__m256d Load3(const double* p) { return _mm256_maskload_pd(p, Mask3()); }
+
+void Store3(double* p, __m256d v) { _mm256_maskstore_pd(p, Mask3(), v); }
+
+// Cross product of the vectors in lanes [0, 3) of `a` and `b`, leaving the
+// result in lanes [0, 3). Lane 3 of the inputs must be finite or zero; lane
+// 3 of the result is garbage and relies on Store3() above to be discarded.
+// Uses the standard formulation c = (a * b_yzx - a_yzx * b)_yzx, which
+// performs exactly the multiplies and subtractions of the scalar component
+// formulas (no FMA), keeping results bit-identical to the portable path.
+__m256d Cross3(__m256d a, __m256d b) {
+  const __m256d a_yzx = _mm256_permute4x64_pd(a, _MM_SHUFFLE(3, 0, 2, 1));
+  const __m256d b_yzx = _mm256_permute4x64_pd(b, _MM_SHUFFLE(3, 0, 2, 1));
+  const __m256d c =
+      _mm256_sub_pd(_mm256_mul_pd(a, b_yzx), _mm256_mul_pd(a_yzx, b));
+  return _mm256_permute4x64_pd(c, _MM_SHUFFLE(3, 0, 2, 1));
+}
+
+}  // namespace
+
+bool Avx2KernelsAreCompiled() { return true; }
+
+void ShiftSpatialVelocityInPlaceAvx2(const double* p_BpBq_E, double* V) {
+  const __m256d w = Load3(V);
+  const __m256d p = Load3(p_BpBq_E);
+  const __m256d v = Load3(V + 3);
+  Store3(V + 3, _mm256_add_pd(v, Cross3(w, p)));
+}
+
+void ComposeShiftedSpatialVelocityAvx2(const double* V_WP,
+                                       const double* p_PoBo_E,
+                                       const double* V_PB, double* V_WB) {
+  const __m256d w_WP = Load3(V_WP);
+  Store3(V_WB, _mm256_add_pd(w_WP, Load3(V_PB)));
+  const __m256d v_WPb =
+      _mm256_add_pd(Load3(V_WP + 3), Cross3(w_WP, Load3(p_PoBo_E)));
+  Store3(V_WB + 3, _mm256_add_pd(v_WPb, Load3(V_PB + 3)));
+}
+
+void ShiftSpatialForceInPlaceAvx2(const double* p_BpBq_E, double* F) {
+  const __m256d p = Load3(p_BpBq_E);
+  const __m256d f = Load3(F + 3);
+  const __m256d tau = Load3(F);
+  Store3(F, _mm256_sub_pd(tau, Cross3(p, f)));
+}
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
+
+#else  // defined(__AVX2__)
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+bool Avx2KernelsAreCompiled() { return false; }
+
+void ShiftSpatialVelocityInPlaceAvx2(const double*, double*) {
+  DRAKE_ABORT_MSG("AVX2 kernels are not compiled in this build.");
+}
+
+void ComposeShiftedSpatialVelocityAvx2(const double*, const double*,
+                                       const double*, double*) {
+  DRAKE_ABORT_MSG("AVX2 kernels are not compiled in this build.");
+}
+
+void ShiftSpatialForceInPlaceAvx2(const double*, double*) {
+  DRAKE_ABORT_MSG("AVX2 kernels are not compiled in this build.");
+}
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
+
+#endif  // defined(__AVX2__)
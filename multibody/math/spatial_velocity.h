@@ -5,6 +5,7 @@
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
+#include "drake/multibody/math/spatial_kernels.h"
 #include "drake/multibody/math/spatial_vector.h"
 
 namespace drake {
@@ -233,6 +234,31 @@ class SpatialVelocity : public SpatialVector<SpatialVelocity, T> {
   T dot(const SpatialMomentum<T>& L_NBp_E) const;
 };
 
+#ifndef DRAKE_DOXYGEN_CXX
+// For T = double these hot compositions dispatch to the kernels in
+// spatial_kernels.h, which select an explicitly vectorized implementation
+// at runtime when the CPU supports it. Results are bit-identical to the
+// generic implementations above.
+template <>
+inline SpatialVelocity<double>& SpatialVelocity<double>::ShiftInPlace(
+    const Vector3<double>& p_BpBq_E) {
+  internal::ShiftSpatialVelocityInPlace(p_BpBq_E.data(), this->mutable_data());
+  return *this;
+}
+
+template <>
+inline SpatialVelocity<double>
+SpatialVelocity<double>::ComposeWithMovingFrameVelocity(
+    const Vector3<double>& p_PoBo_E,
+    const SpatialVelocity<double>& V_PB_E) const {
+  SpatialVelocity<double> V_WB_E;
+  internal::ComposeShiftedSpatialVelocity(this->data(), p_PoBo_E.data(),
+                                          V_PB_E.data(),
+                                          V_WB_E.mutable_data());
+  return V_WB_E;
+}
+#endif
+
 /// Performs the addition of two spatial velocities. This operator
 /// returns the spatial velocity that results from adding the operands as if
 /// they were 6-dimensional vectors. In other words, the resulting spatial
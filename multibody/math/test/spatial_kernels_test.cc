@@ -0,0 +1,85 @@
+#include "drake/multibody/math/spatial_kernels.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/multibody/math/spatial_force.h"
+#include "drake/multibody/math/spatial_velocity.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+// The kernels are specified to be bit-identical to the generic Eigen
+// expressions used by the templated SpatialVector methods. We therefore
+// compare the double specializations (which dispatch into the kernels)
+// against manually computed generic formulas with exact equality, on
+// whichever code path (AVX2 or portable) this host selects at runtime.
+
+GTEST_TEST(SpatialKernelsTest, ShiftSpatialVelocity) {
+  const Vector3<double> w(0.1, -2.3, 4.5);
+  const Vector3<double> v(-1.2, 7.7, 0.3);
+  const Vector3<double> p(2.0, -3.0, 0.5);
+  SpatialVelocity<double> V(w, v);
+  V.ShiftInPlace(p);
+  // Generic formula: the rotational component is unchanged while the
+  // translational component shifts by w × p.
+  const Vector3<double> v_expected = v + w.cross(p);
+  EXPECT_EQ(V.rotational(), w);
+  EXPECT_EQ(V.translational(), v_expected);
+}
+
+GTEST_TEST(SpatialKernelsTest, ComposeWithMovingFrameVelocity) {
+  const SpatialVelocity<double> V_WP(Vector3<double>(1.5, -0.25, 3.0),
+                                     Vector3<double>(0.1, 0.2, -0.3));
+  const SpatialVelocity<double> V_PB(Vector3<double>(-2.0, 0.5, 1.0),
+                                     Vector3<double>(4.0, -5.0, 6.0));
+  const Vector3<double> p_PoBo(0.7, 0.8, -0.9);
+  const SpatialVelocity<double> V_WB =
+      V_WP.ComposeWithMovingFrameVelocity(p_PoBo, V_PB);
+  // Generic formula: V_WB = V_WP.Shift(p_PoBo) + V_PB.
+  const Vector3<double> w_expected = V_WP.rotational() + V_PB.rotational();
+  const Vector3<double> v_expected =
+      (V_WP.translational() + V_WP.rotational().cross(p_PoBo)) +
+      V_PB.translational();
+  EXPECT_EQ(V_WB.rotational(), w_expected);
+  EXPECT_EQ(V_WB.translational(), v_expected);
+}
+
+GTEST_TEST(SpatialKernelsTest, ShiftSpatialForce) {
+  const Vector3<double> tau(3.1, -4.1, 5.9);
+  const Vector3<double> f(2.6, -5.3, 0.0);
+  const Vector3<double> p(-1.0, 2.0, -3.0);
+  SpatialForce<double> F(tau, f);
+  F.ShiftInPlace(p);
+  // Generic formula: the force component is unchanged while the torque
+  // component shifts by -p × f.
+  const Vector3<double> tau_expected = tau - p.cross(f);
+  EXPECT_EQ(F.rotational(), tau_expected);
+  EXPECT_EQ(F.translational(), f);
+}
+
+// Exercises the raw kernel entry points directly, including the dispatch
+// query, so that both the portable and (when available) AVX2 bodies get
+// coverage on the hosts that run this test.
+GTEST_TEST(SpatialKernelsTest, RawKernels) {
+  // Whether AVX2 is in use depends on the host; the call itself must not
+  // crash and must be stable across invocations.
+  const bool use_avx2 = SpatialKernelsUseAvx2();
+  EXPECT_EQ(SpatialKernelsUseAvx2(), use_avx2);
+
+  const double p[3] = {0.5, -1.5, 2.5};
+  double V[6] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+  ShiftSpatialVelocityInPlace(p, V);
+  const Vector3<double> w(1.0, 2.0, 3.0);
+  const Vector3<double> v_expected =
+      Vector3<double>(4.0, 5.0, 6.0) + w.cross(Vector3<double>(p));
+  EXPECT_EQ(Vector3<double>(V[3], V[4], V[5]), v_expected);
+  // The rotational component must be untouched.
+  EXPECT_EQ(Vector3<double>(V[0], V[1], V[2]), w);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
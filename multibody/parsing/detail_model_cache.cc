@@ -0,0 +1,55 @@
+#include "drake/multibody/parsing/detail_model_cache.h"
+
+#include <fstream>
+#include <stdexcept>
+
+#include "drake/common/never_destroyed.h"
+
+namespace drake {
+namespace multibody {
+namespace detail {
+
+uint64_t HashFileContents(const std::string& file_name) {
+  std::ifstream file(file_name, std::ios::binary);
+  if (!file.is_open()) {
+    throw std::runtime_error(
+        "HashFileContents(): cannot read file " + file_name);
+  }
+  // 64-bit FNV-1a over the raw bytes of the file.
+  uint64_t hash = 0xcbf29ce484222325u;
+  char buffer[4096];
+  while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0) {
+    const std::streamsize count = file.gcount();
+    for (std::streamsize i = 0; i < count; ++i) {
+      hash ^= static_cast<unsigned char>(buffer[i]);
+      hash *= 0x100000001b3u;
+    }
+  }
+  return hash;
+}
+
+std::shared_ptr<void> ParsedModelCache::Find(
+    const std::string& full_path, uint64_t content_hash) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto it = cache_.find(full_path);
+  if (it == cache_.end() || it->second.first != content_hash) {
+    return nullptr;
+  }
+  return it->second.second;
+}
+
+void ParsedModelCache::Insert(const std::string& full_path,
+                              uint64_t content_hash,
+                              std::shared_ptr<void> document) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  cache_[full_path] = std::make_pair(content_hash, std::move(document));
+}
+
+ParsedModelCache& GetParsedModelCache() {
+  static never_destroyed<ParsedModelCache> cache;
+  return cache.access();
+}
+
+}  // namespace detail
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace multibody {
+namespace detail {
+
+/// Computes a 64-bit FNV-1a hash of the contents of the file named in
+/// @p file_name. The hash depends only on the file's bytes, not on its name
+/// or metadata, so it identifies a particular revision of a model file.
+///
+/// @throws std::runtime_error if the file cannot be read.
+uint64_t HashFileContents(const std::string& file_name);
+
+/// Process-wide cache of parsed model descriptions, keyed by source file
+/// path and a hash of the file's contents. The parsers consult this cache so
+/// that loading the same SDF or URDF file repeatedly — e.g. instantiating
+/// many copies of a fixture model when building up a large scene — performs
+/// file I/O and XML parsing only once per distinct file revision.
+///
+/// Values are stored as `shared_ptr<void>`; each parser knows the concrete
+/// document type it stored for a given file (the file's extension determines
+/// which parser owns its entry, so entries are never read back as the wrong
+/// type). Cached documents are shared across lookups and must be treated as
+/// immutable by all readers.
+///
+/// A stale entry for a path is replaced when the file's contents change.
+/// Note that only the named file's bytes participate in the key: for SDF
+/// files, content referenced via `<include>` is expanded into the cached
+/// document, so editing an included file without touching its includer will
+/// not invalidate the entry within a running process.
+///
+/// This class is thread-safe.
+class ParsedModelCache {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ParsedModelCache)
+
+  ParsedModelCache() = default;
+
+  /// Returns the document cached for @p full_path at revision
+  /// @p content_hash, or nullptr if there is no such entry.
+  std::shared_ptr<void> Find(const std::string& full_path,
+                             uint64_t content_hash) const;
+
+  /// Stores @p document for @p full_path at revision @p content_hash,
+  /// replacing any previous entry for the same path.
+  void Insert(const std::string& full_path, uint64_t content_hash,
+              std::shared_ptr<void> document);
+
+ private:
+  mutable std::mutex mutex_;
+  // Maps a full file path to the content hash and parsed document of the
+  // most recently loaded revision of that file. Keeping only the latest
+  // revision per path bounds the cache's footprint by the number of
+  // distinct model files loaded by the process.
+  std::map<std::string, std::pair<uint64_t, std::shared_ptr<void>>> cache_;
+};
+
+/// Returns the singleton ParsedModelCache for this process.
+ParsedModelCache& GetParsedModelCache();
+
+}  // namespace detail
+}  // namespace multibody
+}  // namespace drake
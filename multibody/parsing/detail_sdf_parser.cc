@@ -10,6 +10,7 @@
 #include "drake/geometry/geometry_instance.h"
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/parsing/detail_ignition.h"
+#include "drake/multibody/parsing/detail_model_cache.h"
 #include "drake/multibody/parsing/detail_path_utils.h"
 #include "drake/multibody/parsing/detail_scene_graph.h"
 #include "drake/multibody/tree/fixed_offset_frame.h"
@@ -314,33 +315,43 @@ void AddJointFromSpecification(
 }
 
 // Helper method to load an SDF file and read the contents into an sdf::Root
-// object.
-std::string LoadSdf(
-    sdf::Root* root,
-    const std::string& file_name) {
+// object. Reuses a previously parsed root from the process-wide model cache
+// when the file's contents are unchanged; the returned root must therefore
+// only be read, never modified. On return `root_dir` contains the directory
+// holding the SDF file, to be used as the root directory in which to search
+// for files referenced within it.
+std::shared_ptr<sdf::Root> LoadSdf(
+    const std::string& file_name, std::string* root_dir) {
 
   const std::string full_path = GetFullPath(file_name);
 
-  // Load the SDF file.
-  sdf::Errors errors = root->Load(full_path);
+  const uint64_t content_hash = HashFileContents(full_path);
+  auto root = std::static_pointer_cast<sdf::Root>(
+      GetParsedModelCache().Find(full_path, content_hash));
+  if (root == nullptr) {
+    root = std::make_shared<sdf::Root>();
+
+    // Load the SDF file.
+    sdf::Errors errors = root->Load(full_path);
+
+    // Check for any errors.
+    if (!errors.empty()) {
+      std::string error_accumulation("From AddModelFromSdfFile():\n");
+      for (const auto& e : errors)
+        error_accumulation += "Error: " + e.Message() + "\n";
+      throw std::runtime_error(error_accumulation);
+    }
 
-  // Check for any errors.
-  if (!errors.empty()) {
-    std::string error_accumulation("From AddModelFromSdfFile():\n");
-    for (const auto& e : errors)
-      error_accumulation += "Error: " + e.Message() + "\n";
-    throw std::runtime_error(error_accumulation);
+    GetParsedModelCache().Insert(full_path, content_hash, root);
   }
 
-  // Uses the directory holding the SDF to be the root directory
-  // in which to search for files referenced within the SDF file.
-  std::string root_dir = ".";
+  *root_dir = ".";
   size_t found = full_path.find_last_of("/\\");
   if (found != std::string::npos) {
-    root_dir = full_path.substr(0, found);
+    *root_dir = full_path.substr(0, found);
   }
 
-  return root_dir;
+  return root;
 }
 
 // Helper method to add a model to a MultibodyPlant given an sdf::Model
@@ -517,16 +528,15 @@ ModelInstanceIndex AddModelFromSdfFile(
   DRAKE_THROW_UNLESS(plant != nullptr);
   DRAKE_THROW_UNLESS(!plant->is_finalized());
 
-  sdf::Root root;
+  std::string root_dir;
+  const std::shared_ptr<sdf::Root> root = LoadSdf(file_name, &root_dir);
 
-  std::string root_dir = LoadSdf(&root, file_name);
-
-  if (root.ModelCount() != 1) {
+  if (root->ModelCount() != 1) {
     throw std::runtime_error("File must have a single <model> element.");
   }
 
   // Get the only model in the file.
-  const sdf::Model& model = *root.ModelByIndex(0);
+  const sdf::Model& model = *root->ModelByIndex(0);
 
   if (scene_graph != nullptr && !plant->geometry_source_is_registered()) {
     plant->RegisterAsSourceForSceneGraph(scene_graph);
@@ -547,24 +557,23 @@ std::vector<ModelInstanceIndex> AddModelsFromSdfFile(
   DRAKE_THROW_UNLESS(plant != nullptr);
   DRAKE_THROW_UNLESS(!plant->is_finalized());
 
-  sdf::Root root;
-
-  std::string root_dir = LoadSdf(&root, file_name);
+  std::string root_dir;
+  const std::shared_ptr<sdf::Root> root = LoadSdf(file_name, &root_dir);
 
   // Throw an error if there are no models or worlds.
-  if (root.ModelCount() == 0 && root.WorldCount() == 0) {
+  if (root->ModelCount() == 0 && root->WorldCount() == 0) {
     throw std::runtime_error(
         "File must have at least one <model>, or <world> with one "
         "child <model> element.");
   }
 
   // Only one world in an SDF file is allowed.
-  if (root.WorldCount() > 1) {
+  if (root->WorldCount() > 1) {
     throw std::runtime_error("File must contain only one <world>.");
   }
 
   // Do not allow a <world> to have a <model> sibling.
-  if (root.ModelCount() > 0 && root.WorldCount() > 0) {
+  if (root->ModelCount() > 0 && root->WorldCount() > 0) {
     throw std::runtime_error("A <world> and <model> cannot be siblings.");
   }
 
@@ -576,17 +585,17 @@ std::vector<ModelInstanceIndex> AddModelsFromSdfFile(
 
   // At this point there should be only Models or a single World at the Root
   // levelt.
-  if (root.ModelCount() > 0) {
+  if (root->ModelCount() > 0) {
     // Load all the models at the root level.
-    for (uint64_t i = 0; i < root.ModelCount(); ++i) {
+    for (uint64_t i = 0; i < root->ModelCount(); ++i) {
       // Get the model.
-      const sdf::Model& model = *root.ModelByIndex(i);
+      const sdf::Model& model = *root->ModelByIndex(i);
       model_instances.push_back(AddModelFromSpecification(
             model, model.Name(), plant, scene_graph, package_map, root_dir));
     }
   } else {
     // Load the world and all the models in the world.
-    const sdf::World& world = *root.WorldByIndex(0);
+    const sdf::World& world = *root->WorldByIndex(0);
 
     for (uint64_t model_index = 0; model_index < world.ModelCount();
         ++model_index) {
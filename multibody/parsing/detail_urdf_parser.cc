@@ -8,6 +8,7 @@
 #include <tinyxml2.h>
 
 #include "drake/math/rotation_matrix.h"
+#include "drake/multibody/parsing/detail_model_cache.h"
 #include "drake/multibody/parsing/detail_path_utils.h"
 #include "drake/multibody/parsing/detail_tinyxml.h"
 #include "drake/multibody/parsing/detail_urdf_geometry.h"
@@ -504,12 +505,21 @@ ModelInstanceIndex AddModelFromUrdfFile(
 
   const std::string full_path = GetFullPath(file_name);
 
-  // Opens the URDF file and feeds it into the XML parser.
-  XMLDocument xml_doc;
-  xml_doc.LoadFile(full_path.c_str());
-  if (xml_doc.ErrorID()) {
-    throw std::runtime_error("Failed to parse XML in file " + full_path +
-                             "\n" + xml_doc.ErrorName());
+  // Opens the URDF file and feeds it into the XML parser, reusing a
+  // previously parsed document from the process-wide model cache when the
+  // file's contents are unchanged. ParseUrdf() below only traverses the
+  // document; it never mutates it.
+  const uint64_t content_hash = HashFileContents(full_path);
+  auto xml_doc = std::static_pointer_cast<XMLDocument>(
+      GetParsedModelCache().Find(full_path, content_hash));
+  if (xml_doc == nullptr) {
+    xml_doc = std::make_shared<XMLDocument>();
+    xml_doc->LoadFile(full_path.c_str());
+    if (xml_doc->ErrorID()) {
+      throw std::runtime_error("Failed to parse XML in file " + full_path +
+                               "\n" + xml_doc->ErrorName());
+    }
+    GetParsedModelCache().Insert(full_path, content_hash, xml_doc);
   }
 
   // Uses the directory holding the URDF to be the root directory
@@ -525,7 +535,7 @@ ModelInstanceIndex AddModelFromUrdfFile(
   }
 
   return ParseUrdf(model_name_in, package_map, root_dir,
-                   &xml_doc, plant, scene_graph);
+                   xml_doc.get(), plant, scene_graph);
 }
 
 }  // namespace detail
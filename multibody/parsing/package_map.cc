@@ -1,7 +1,10 @@
 #include "drake/multibody/parsing/package_map.h"
 
+#include <sys/stat.h>
+
 #include <algorithm>
 #include <cstdlib>
+#include <fstream>
 #include <sstream>
 #include <utility>
 #include <vector>
@@ -11,6 +14,7 @@
 #include <tinyxml2.h>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_optional.h"
 #include "drake/common/drake_path.h"
 #include "drake/common/drake_throw.h"
 #include "drake/common/text_logging.h"
@@ -28,7 +32,39 @@ using std::vector;
 using tinyxml2::XMLDocument;
 using tinyxml2::XMLElement;
 
-PackageMap::PackageMap() {}
+constexpr char PackageMap::kManifestEnvironmentVariable[];
+
+namespace {
+
+// Returns the modification time of the package.xml file within
+// package_path, or nullopt if it cannot be stat'ed.
+optional<int64_t> GetPackageXmlMtime(const string& package_path) {
+  spruce::path xml_path(package_path);
+  xml_path.append("package.xml");
+  struct stat buffer;
+  if (::stat(xml_path.getStr().c_str(), &buffer) != 0) {
+    return nullopt;
+  }
+  return static_cast<int64_t>(buffer.st_mtime);
+}
+
+}  // namespace
+
+PackageMap::PackageMap() {
+  const char* manifests = getenv(kManifestEnvironmentVariable);
+  if (manifests != nullptr && *manifests != '\0') {
+    istringstream iss{string(manifests)};
+    string manifest_file;
+    while (getline(iss, manifest_file, ':')) {
+      if (manifest_file.empty()) continue;
+      if (!LoadManifest(manifest_file, false /* validate */)) {
+        drake::log()->warn(
+            "PackageMap: could not preload manifest \"{}\" named by {}.",
+            manifest_file, kManifestEnvironmentVariable);
+      }
+    }
+  }
+}
 
 void PackageMap::Add(const string& package_name, const string& package_path) {
   DRAKE_DEMAND(map_.find(package_name) == map_.end());
@@ -58,6 +94,99 @@ void PackageMap::PopulateFromFolder(const string& path) {
   CrawlForPackages(path);
 }
 
+void PackageMap::PopulateFromFolderCached(const string& path,
+                                          const string& manifest_file) {
+  DRAKE_DEMAND(!path.empty());
+  DRAKE_DEMAND(!manifest_file.empty());
+  if (PopulateFromManifest(manifest_file)) {
+    return;
+  }
+  CrawlForPackages(path);
+  WriteManifest(manifest_file);
+}
+
+bool PackageMap::PopulateFromManifest(const string& manifest_file) {
+  DRAKE_DEMAND(!manifest_file.empty());
+  return LoadManifest(manifest_file, true /* validate */);
+}
+
+bool PackageMap::LoadManifest(const string& manifest_file, bool validate) {
+  std::ifstream file(manifest_file);
+  if (!file.is_open()) {
+    return false;
+  }
+
+  // Parse (and when requested, validate) every entry before committing any
+  // of them, so that a stale or corrupt manifest leaves this map unchanged.
+  std::map<string, string> entries;
+  string line;
+  while (getline(file, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    const size_t first_tab = line.find('\t');
+    const size_t second_tab =
+        (first_tab == string::npos) ? string::npos
+                                    : line.find('\t', first_tab + 1);
+    if (second_tab == string::npos) {
+      return false;
+    }
+    const string package_name = line.substr(0, first_tab);
+    const string mtime_string =
+        line.substr(first_tab + 1, second_tab - first_tab - 1);
+    const string package_path = line.substr(second_tab + 1);
+    if (package_name.empty() || package_path.empty()) {
+      return false;
+    }
+    if (validate) {
+      if (mtime_string == "-") {
+        // The entry was added manually, without a package.xml file; only
+        // the directory's existence can be checked.
+        if (!spruce::path(package_path).exists()) {
+          return false;
+        }
+      } else {
+        const optional<int64_t> mtime = GetPackageXmlMtime(package_path);
+        if (!mtime || std::to_string(*mtime) != mtime_string) {
+          return false;
+        }
+      }
+    }
+    entries.emplace(package_name, package_path);
+  }
+
+  for (const auto& entry : entries) {
+    if (!Contains(entry.first)) {
+      // Inserts directly instead of calling Add(): validated entries have
+      // already been checked, and trusted preloads must not touch the
+      // filesystem at all.
+      map_.insert(entry);
+    } else {
+      drake::log()->warn("Package \"{}\" was found more than once in the "
+                         "search space.", entry.first);
+    }
+  }
+  return true;
+}
+
+void PackageMap::WriteManifest(const string& manifest_file) const {
+  DRAKE_DEMAND(!manifest_file.empty());
+  std::ofstream file(manifest_file);
+  if (!file.is_open()) {
+    throw std::runtime_error(
+        "PackageMap::WriteManifest(): cannot write file \"" +
+        manifest_file + "\".");
+  }
+  file << "# PackageMap manifest. Format: name<TAB>mtime<TAB>path, where "
+          "mtime is the\n"
+       << "# modification time of the package's package.xml file, or '-' "
+          "if it has none.\n";
+  for (const auto& entry : map_) {
+    const optional<int64_t> mtime = GetPackageXmlMtime(entry.second);
+    const string mtime_string = mtime ? std::to_string(*mtime) : string("-");
+    file << entry.first << '\t' << mtime_string << '\t' << entry.second
+         << '\n';
+  }
+}
+
 void PackageMap::PopulateFromEnvironment(const string& environment_variable) {
   DRAKE_DEMAND(!environment_variable.empty());
   const char* path_char = getenv(environment_variable.c_str());
@@ -16,9 +16,21 @@ class PackageMap {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PackageMap)
 
-  /// A constructor that initializes an empty map.
+  /// A constructor that initializes an empty map. If the environment
+  /// variable named by kManifestEnvironmentVariable is set, the manifest
+  /// file(s) it names (multiple files may be separated by ':') are
+  /// preloaded into the new map. Preloaded entries are trusted as-is, with
+  /// no filesystem validation at all, so that `package://` URIs resolve
+  /// without ever touching the directory trees; this is intended for batch
+  /// deployments where the package layout is known to be fixed and the
+  /// filesystem (e.g. NFS) is slow.
   PackageMap();
 
+  /// The name of the environment variable consulted by the constructor for
+  /// manifest files to preload; see the constructor documentation.
+  static constexpr char kManifestEnvironmentVariable[] =
+      "DRAKE_PACKAGE_MAP_MANIFEST";
+
   /// Adds package @p package_name and its path, @p package_path. Aborts if
   /// @p package_name is already present in this PackageMap, or if
   /// @p package_path does not exist.
@@ -41,6 +53,35 @@ class PackageMap {
   /// directory's path is the value.
   void PopulateFromFolder(const std::string& path);
 
+  /// Populates this PackageMap from the manifest file named in
+  /// @p manifest_file when it exists and is still valid, and otherwise
+  /// crawls the directory tree at @p path as in PopulateFromFolder() and
+  /// (re)writes the manifest with the result. Use this to amortize the
+  /// cost of crawling large or slow (e.g. networked) directory trees
+  /// across process launches.
+  ///
+  /// The manifest is refreshed whenever any recorded package is moved,
+  /// removed, or has its `package.xml` modified. A package *added* to the
+  /// tree after the manifest was written is not detected; delete the
+  /// manifest file to force a fresh crawl in that case.
+  void PopulateFromFolderCached(const std::string& path,
+                                const std::string& manifest_file);
+
+  /// Loads the manifest file named in @p manifest_file, previously written
+  /// by WriteManifest(), into this PackageMap. Each entry is validated
+  /// against the filesystem: the package's `package.xml` must still exist
+  /// with the modification time recorded in the manifest. Returns true iff
+  /// the manifest was read and every entry passed validation; otherwise
+  /// returns false and leaves this PackageMap unchanged, in which case the
+  /// caller should fall back to crawling.
+  bool PopulateFromManifest(const std::string& manifest_file);
+
+  /// Writes the entries of this PackageMap to the manifest file named in
+  /// @p manifest_file, recording each package's current `package.xml`
+  /// modification time for later validation by PopulateFromManifest().
+  /// Throws std::runtime_error if the file cannot be written.
+  void WriteManifest(const std::string& manifest_file) const;
+
   /// Obtains one or more paths from environment variable
   /// @p environment_variable. Crawls downward through the directory tree(s)
   /// starting from the path(s) searching for `package.xml` files. For each of
@@ -72,6 +113,13 @@ class PackageMap {
   // three different paths.
   void CrawlForPackages(const std::string& path);
 
+  // Loads the manifest file named in manifest_file, validating each entry
+  // against the filesystem unless validate is false (the trusted preload
+  // mode used by the constructor, which performs no filesystem access).
+  // Returns true iff the whole manifest was accepted; on failure this
+  // PackageMap is left unchanged.
+  bool LoadManifest(const std::string& manifest_file, bool validate);
+
   // This method is the same as Add() except it first checks to ensure that
   // package_name is not already in this PackageMap. If it is not, this
   // method prints a warning and returns.
@@ -0,0 +1,64 @@
+#include "drake/multibody/parsing/detail_model_cache.h"
+
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+
+namespace drake {
+namespace multibody {
+namespace detail {
+namespace {
+
+// Writes `contents` to a file named `file_name` in the temp directory and
+// returns the file's full path.
+std::string WriteFile(const std::string& file_name,
+                      const std::string& contents) {
+  const std::string path = temp_directory() + "/" + file_name;
+  std::ofstream file(path);
+  file << contents;
+  return path;
+}
+
+GTEST_TEST(HashFileContentsTest, DependsOnlyOnContents) {
+  const std::string path_a = WriteFile("a.urdf", "<robot name='a'/>");
+  const std::string path_b = WriteFile("b.urdf", "<robot name='a'/>");
+  const std::string path_c = WriteFile("c.urdf", "<robot name='c'/>");
+  // Identical contents hash identically, regardless of the file's name.
+  EXPECT_EQ(HashFileContents(path_a), HashFileContents(path_b));
+  // Different contents hash differently.
+  EXPECT_NE(HashFileContents(path_a), HashFileContents(path_c));
+  // Unreadable files throw.
+  EXPECT_THROW(HashFileContents("/no/such/file.urdf"), std::runtime_error);
+}
+
+GTEST_TEST(ParsedModelCacheTest, FindInsertReplace) {
+  ParsedModelCache cache;
+  auto document = std::make_shared<int>(22);
+
+  // An empty cache misses.
+  EXPECT_EQ(cache.Find("/some/path", 1), nullptr);
+
+  // An inserted entry is found only under its exact path and hash.
+  cache.Insert("/some/path", 1, document);
+  EXPECT_EQ(cache.Find("/some/path", 1), document);
+  EXPECT_EQ(cache.Find("/some/path", 2), nullptr);
+  EXPECT_EQ(cache.Find("/other/path", 1), nullptr);
+
+  // Inserting a new revision for the same path replaces the old entry; the
+  // stale hash no longer hits.
+  auto new_document = std::make_shared<int>(23);
+  cache.Insert("/some/path", 2, new_document);
+  EXPECT_EQ(cache.Find("/some/path", 2), new_document);
+  EXPECT_EQ(cache.Find("/some/path", 1), nullptr);
+}
+
+GTEST_TEST(ParsedModelCacheTest, SingletonIsStable) {
+  EXPECT_EQ(&GetParsedModelCache(), &GetParsedModelCache());
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace multibody
+}  // namespace drake
@@ -1,11 +1,14 @@
 #include "drake/multibody/parsing/package_map.h"
 
 #include <algorithm>
+#include <cstdlib>
+#include <fstream>
 
 #include <gtest/gtest.h>
 #include <spruce.hh>
 
 #include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
 
 using std::map;
 using std::string;
@@ -124,6 +127,91 @@ GTEST_TEST(PackageMapTest, TestPopulateUpstreamToDrake) {
   VerifyMatch(package_map, expected_packages);
 }
 
+// Tests that crawl results can be persisted to a manifest file and
+// reloaded, and that stale or missing manifests are rejected.
+GTEST_TEST(PackageMapTest, TestManifestRoundTrip) {
+  const string root_path = GetTestDataRoot();
+
+  map<string, string> expected_packages = {
+    {"package_map_test_package_a", root_path +
+        "package_map_test_packages/package_map_test_package_a/"},
+    {"package_map_test_package_b", root_path +
+        "package_map_test_packages/package_map_test_package_b/"},
+    {"package_map_test_package_c", root_path +
+        "package_map_test_packages/package_map_test_package_set/"
+        "package_map_test_package_c/"},
+    {"package_map_test_package_d", root_path +
+        "package_map_test_packages/package_map_test_package_set/"
+        "package_map_test_package_d/"},
+    {"box_model", root_path +
+        "box_package/"},
+  };
+
+  PackageMap package_map;
+  package_map.PopulateFromFolder(root_path);
+  const string manifest_file = temp_directory() + "/package_map_manifest";
+  package_map.WriteManifest(manifest_file);
+
+  // A valid manifest reproduces the crawl results.
+  PackageMap from_manifest;
+  EXPECT_TRUE(from_manifest.PopulateFromManifest(manifest_file));
+  VerifyMatch(from_manifest, expected_packages);
+
+  // A missing manifest fails and leaves the map unchanged.
+  PackageMap from_missing;
+  EXPECT_FALSE(from_missing.PopulateFromManifest(manifest_file + ".nope"));
+  EXPECT_EQ(from_missing.size(), 0);
+
+  // A manifest whose recorded modification time no longer matches the
+  // filesystem is rejected in its entirety.
+  const string stale_file = temp_directory() + "/package_map_stale_manifest";
+  {
+    std::ofstream stale(stale_file);
+    stale << "package_map_test_package_a\t1\t" << root_path
+          << "package_map_test_packages/package_map_test_package_a/\n";
+  }
+  PackageMap from_stale;
+  EXPECT_FALSE(from_stale.PopulateFromManifest(stale_file));
+  EXPECT_EQ(from_stale.size(), 0);
+}
+
+// Tests that PopulateFromFolderCached() falls back to crawling when no
+// manifest exists and writes one that satisfies the next launch.
+GTEST_TEST(PackageMapTest, TestPopulateFromFolderCached) {
+  const string root_path = GetTestDataRoot();
+  const string manifest_file = temp_directory() + "/package_map_cache";
+
+  PackageMap first_launch;
+  first_launch.PopulateFromFolderCached(root_path, manifest_file);
+
+  PackageMap crawled;
+  crawled.PopulateFromFolder(root_path);
+  EXPECT_EQ(first_launch.size(), crawled.size());
+
+  // The manifest written by the first launch is valid for the second one.
+  PackageMap second_launch;
+  EXPECT_TRUE(second_launch.PopulateFromManifest(manifest_file));
+  EXPECT_EQ(second_launch.size(), crawled.size());
+}
+
+// Tests that a manifest named by the environment variable is preloaded by
+// the constructor, without validation.
+GTEST_TEST(PackageMapTest, TestEnvironmentManifestPreload) {
+  const string manifest_file = temp_directory() + "/package_map_env_manifest";
+  {
+    std::ofstream manifest(manifest_file);
+    // The path need not exist: preloaded entries are trusted as-is.
+    manifest << "some_preloaded_package\t-\t/no/such/path\n";
+  }
+  ASSERT_EQ(::setenv(PackageMap::kManifestEnvironmentVariable,
+                     manifest_file.c_str(), 1), 0);
+  PackageMap package_map;
+  ::unsetenv(PackageMap::kManifestEnvironmentVariable);
+
+  ASSERT_TRUE(package_map.Contains("some_preloaded_package"));
+  EXPECT_EQ(package_map.GetPath("some_preloaded_package"), "/no/such/path");
+}
+
 // Tests that PackageMap's streaming to-string operator works.
 GTEST_TEST(PackageMapTest, TestStreamingToString) {
   spruce::dir::mkdir(spruce::path("package_foo"));
@@ -46,6 +46,12 @@ ContactResultsToLcmSystem<T>::get_lcm_message_output_port() const {
   return this->get_output_port(message_output_port_index_);
 }
 
+template <typename T>
+void ContactResultsToLcmSystem<T>::set_unchanged_publish_tolerance(
+    double tolerance) {
+  unchanged_publish_tolerance_ = tolerance;
+}
+
 template <typename T>
 void ContactResultsToLcmSystem<T>::CalcLcmContactOutput(
     const Context<T>& context, lcmt_contact_results_for_viz* output) const {
@@ -55,21 +61,54 @@ void ContactResultsToLcmSystem<T>::CalcLcmContactOutput(
           ->template GetValue<ContactResults<T>>();
   auto& msg = *output;
 
+  const int num_contacts = contact_results.num_contacts();
+
+  // The output value persists between calls, so when the opt-in tolerance is
+  // active and every contact matches the previous message within tolerance we
+  // leave the message untouched (timestamps included); a downstream publisher
+  // with change detection then sees identical bytes and skips the publish.
+  if (unchanged_publish_tolerance_ >= 0 && msg.num_contacts == num_contacts) {
+    using std::abs;
+    const double tolerance = unchanged_publish_tolerance_;
+    auto near3 = [tolerance](const Vector3<T>& src, const double* prev) {
+      return abs(ExtractDoubleOrThrow(src(0)) - prev[0]) <= tolerance &&
+             abs(ExtractDoubleOrThrow(src(1)) - prev[1]) <= tolerance &&
+             abs(ExtractDoubleOrThrow(src(2)) - prev[2]) <= tolerance;
+    };
+    bool unchanged = true;
+    for (int i = 0; unchanged && i < num_contacts; ++i) {
+      const lcmt_contact_info_for_viz& info_msg = msg.contact_info[i];
+      const PointPairContactInfo<T>& contact_info =
+          contact_results.contact_info(i);
+      unchanged =
+          info_msg.body1_name == body_names_.at(contact_info.bodyA_index()) &&
+          info_msg.body2_name == body_names_.at(contact_info.bodyB_index()) &&
+          near3(contact_info.contact_point(), info_msg.contact_point) &&
+          near3(contact_info.contact_force(), info_msg.contact_force) &&
+          near3(contact_info.point_pair().nhat_BA_W, info_msg.normal);
+    }
+    if (unchanged) return;
+  }
+
   // Time in microseconds.
   msg.timestamp = static_cast<int64_t>(
       ExtractDoubleOrThrow(context.get_time()) * 1e6);
-  msg.num_contacts = contact_results.num_contacts();
+  msg.num_contacts = num_contacts;
   msg.contact_info.resize(msg.num_contacts);
 
-  for (int i = 0; i < contact_results.num_contacts(); ++i) {
+  for (int i = 0; i < num_contacts; ++i) {
     lcmt_contact_info_for_viz& info_msg = msg.contact_info[i];
     info_msg.timestamp = msg.timestamp;
 
     const PointPairContactInfo<T>& contact_info =
         contact_results.contact_info(i);
 
-    info_msg.body1_name = body_names_.at(contact_info.bodyA_index());
-    info_msg.body2_name = body_names_.at(contact_info.bodyB_index());
+    // The names are interned at construction; skip the string copy when this
+    // slot already names the same body pair.
+    const std::string& name1 = body_names_.at(contact_info.bodyA_index());
+    if (info_msg.body1_name != name1) info_msg.body1_name = name1;
+    const std::string& name2 = body_names_.at(contact_info.bodyB_index());
+    if (info_msg.body2_name != name2) info_msg.body2_name = name2;
 
     auto write_double3 = [](const Vector3<T>& src, double* dest) {
       dest[0] = ExtractDoubleOrThrow(src(0));
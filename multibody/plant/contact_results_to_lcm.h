@@ -47,11 +47,24 @@ class ContactResultsToLcmSystem final : public systems::LeafSystem<T> {
   /** Scalar-converting copy constructor.  */
   template <typename U>
   explicit ContactResultsToLcmSystem(const ContactResultsToLcmSystem<U>& other)
-      : systems::LeafSystem<T>(), body_names_(other.body_names_) {}
+      : systems::LeafSystem<T>(),
+        body_names_(other.body_names_),
+        unchanged_publish_tolerance_(other.unchanged_publish_tolerance_) {}
 
   const systems::InputPort<T>& get_contact_result_input_port() const;
   const systems::OutputPort<T>& get_lcm_message_output_port() const;
 
+  /** (Advanced.) Configures this system to leave its output message (its
+   timestamps included) completely untouched whenever every contact in the
+   input matches the previously computed message within @p tolerance: the same
+   body pair in each slot, and contact point, force, and normal each within
+   @p tolerance component-wise. Because the stale message is then
+   byte-identical to the one already sent, pairing this with
+   LcmPublisherSystem::set_publish_only_on_change() suppresses retransmission
+   of quiescent contact sets entirely. A negative @p tolerance (the default)
+   disables the behavior. */
+  void set_unchanged_publish_tolerance(double tolerance);
+
  private:
   // Allow different specializations to access each other's private data for
   // scalar conversion.
@@ -66,6 +79,10 @@ class ContactResultsToLcmSystem final : public systems::LeafSystem<T> {
 
   // A mapping from body index values to body names.
   std::vector<std::string> body_names_;
+
+  // When non-negative, CalcLcmContactOutput() returns without modifying the
+  // previously computed message if the input is unchanged within tolerance.
+  double unchanged_publish_tolerance_{-1.0};
 };
 
 
@@ -618,9 +618,20 @@ ImplicitStribeckSolverResult ImplicitStribeckSolver<T>::SolveWithGuess(
     auto& v = fixed_size_workspace_.mutable_v();
     // With no friction forces Eq. (3) in the documentation reduces to
     // M vˢ⁺¹ = p*.
-    v = M.ldlt().solve(p_star);
+    if (mass_matrix_ltdl_ != nullptr && mass_matrix_ltdl_->is_factorized()) {
+      // Sparsity exploiting O(nd) solve, d the depth of the kinematic tree.
+      v = mass_matrix_ltdl_->Solve(p_star);
+    } else {
+      v = M.ldlt().solve(p_star);
+    }
     // "One iteration" with exactly "zero" vt_error.
     statistics_.Update(0.0);
+    // Record the solution as a warm start for the next solve.
+    warm_start_.valid = true;
+    warm_start_.nc = 0;
+    warm_start_.v = v;
+    warm_start_.fn.resize(0);
+    warm_start_.ft.resize(0);
     return ImplicitStribeckSolverResult::kSuccess;
   }
 
@@ -694,6 +705,14 @@ ImplicitStribeckSolverResult ImplicitStribeckSolver<T>::SolveWithGuess(
       // Update generalized forces and return.
       tau_f = Jt.transpose() * ft;
       tau = tau_f + Jn.transpose() * fn;
+      // Record the solution as a warm start for the next solve. These are
+      // deep copies; the workspaces aliased by v, fn and ft get overwritten
+      // when new problem data is supplied.
+      warm_start_.valid = true;
+      warm_start_.nc = nc_;
+      warm_start_.v = v;
+      warm_start_.fn = fn;
+      warm_start_.ft = ft;
       return ImplicitStribeckSolverResult::kSuccess;
     }
 
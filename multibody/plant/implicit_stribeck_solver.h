@@ -7,6 +7,7 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_throw.h"
 #include "drake/common/eigen_types.h"
+#include "drake/multibody/tree/sparse_ltdl_factorization.h"
 
 namespace drake {
 namespace multibody {
@@ -606,6 +607,73 @@ class ImplicitStribeckSolver {
       EigenPtr<const VectorX<T>> x0, EigenPtr<const VectorX<T>> stiffness,
       EigenPtr<const VectorX<T>> dissipation, EigenPtr<const VectorX<T>> mu);
 
+  /// (Optional) Supplies a sparsity exploiting factorization of the mass
+  /// matrix `M` supplied with the problem data. When provided, the solver
+  /// uses it for solves against `M` (e.g., for the frictionless case `nc = 0`
+  /// where `M⋅vˢ⁺¹ = p*`) instead of performing a dense factorization.
+  ///
+  /// This class keeps a reference to `ltdl`, which must therefore outlive
+  /// `this` solver or a subsequent call to this method with a different
+  /// factorization (possibly `nullptr` to clear it). It is the caller's
+  /// responsibility to keep `ltdl` factorized in sync with the mass matrix in
+  /// the problem data.
+  void set_mass_matrix_factorization(
+      const internal::SparseLtdlFactorization<T>* ltdl) {
+    mass_matrix_ltdl_ = ltdl;
+  }
+
+  /// Returns `true` if `this` solver stores a valid warm start recorded from
+  /// a previous successful call to SolveWithGuess() for a problem with the
+  /// same number of generalized velocities and with `nc` contact points.
+  /// The warm start consists of the previously converged generalized
+  /// velocities together with the converged normal and friction forces, see
+  /// get_warm_start_normal_forces() and get_warm_start_friction_forces().
+  /// Callers can use these forces to build an initial guess for the next time
+  /// step that already accounts for the contact impulses; in sustained
+  /// contact this typically cuts the iteration count down to one or two
+  /// iterations.
+  /// @warning It is the caller's responsibility to verify that the `nc`
+  /// contact points of the new problem correspond to the same contacts (in
+  /// the same order) of the problem that recorded the warm start. For
+  /// contact sets changing between time steps, matching counts with
+  /// mismatched contacts only affects the quality of the initial guess, not
+  /// the correctness of the converged solution.
+  bool has_warm_start(int nc) const {
+    return warm_start_.valid && warm_start_.nc == nc;
+  }
+
+  /// Invalidates the warm start stored in `this` solver, if any. Subsequent
+  /// calls to has_warm_start() return `false` until SolveWithGuess()
+  /// succeeds again.
+  void reset_warm_start() { warm_start_.valid = false; }
+
+  /// Returns the converged normal forces fₙ, of size `nc`, recorded by the
+  /// last successful call to SolveWithGuess().
+  /// @pre has_warm_start() returns `true` for the recorded number of
+  /// contacts.
+  const VectorX<T>& get_warm_start_normal_forces() const {
+    DRAKE_DEMAND(warm_start_.valid);
+    return warm_start_.fn;
+  }
+
+  /// Returns the converged friction forces fₜ, of size `2nc`, recorded by
+  /// the last successful call to SolveWithGuess().
+  /// @pre has_warm_start() returns `true` for the recorded number of
+  /// contacts.
+  const VectorX<T>& get_warm_start_friction_forces() const {
+    DRAKE_DEMAND(warm_start_.valid);
+    return warm_start_.ft;
+  }
+
+  /// Returns the converged generalized velocities recorded by the last
+  /// successful call to SolveWithGuess().
+  /// @pre has_warm_start() returns `true` for the recorded number of
+  /// contacts.
+  const VectorX<T>& get_warm_start_generalized_velocities() const {
+    DRAKE_DEMAND(warm_start_.valid);
+    return warm_start_.v;
+  }
+
   /// Given an initial guess `v_guess`, this method uses a Newton-Raphson
   /// iteration to find a solution for the generalized velocities satisfying
   /// either Eq. (3) when one-way coupling is used or Eq. (10) when two-way
@@ -1145,12 +1213,29 @@ class ImplicitStribeckSolver {
   mutable FixedSizeWorkspace fixed_size_workspace_;
   mutable VariableSizeWorkspace variable_size_workspace_;
 
+  // Optional sparsity exploiting factorization of the mass matrix, not owned.
+  // See set_mass_matrix_factorization().
+  const internal::SparseLtdlFactorization<T>* mass_matrix_ltdl_{nullptr};
+
   // Precomputed value of cos(theta_max), used by DirectionChangeLimiter.
   double cos_theta_max_{std::cos(parameters_.theta_max)};
 
   // We save solver statistics such as number of iterations and residuals so
   // that we can report them if requested.
   mutable ImplicitStribeckSolverIterationStats statistics_;
+
+  // Solution state recorded after each successful call to SolveWithGuess() so
+  // that callers can warm start the next solve, see has_warm_start().
+  // Unlike the workspaces above, these are deep copies that survive
+  // subsequent calls to the problem data setters.
+  struct WarmStartData {
+    bool valid{false};
+    int nc{-1};    // Number of contacts of the recording problem.
+    VectorX<T> v;   // Converged generalized velocities, of size nv.
+    VectorX<T> fn;  // Converged normal forces, of size nc.
+    VectorX<T> ft;  // Converged friction forces, of size 2nc.
+  };
+  mutable WarmStartData warm_start_;
 };
 
 }  // namespace multibody
@@ -3,10 +3,13 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_throw.h"
+#include "drake/common/tracing.h"
 #include "drake/geometry/frame_kinematics_vector.h"
 #include "drake/geometry/geometry_frame.h"
 #include "drake/geometry/geometry_instance.h"
@@ -628,6 +631,14 @@ void MultibodyPlant<T>::FinalizePlantOnly() {
         stribeck_model_.stiction_tolerance();
     implicit_stribeck_solver_->set_solver_parameters(solver_parameters);
   }
+  // Build the bulk pose hand-off tables used by CalcFramePoseOutput(). The
+  // world body has a frame id but its pose is never reported.
+  for (const auto& it : body_index_to_frame_id_) {
+    if (it.first == world_index()) continue;
+    frame_ids_in_pose_output_.push_back(it.second);
+    frame_pose_pool_indices_.push_back(
+        internal_tree().get_body(it.first).node_index());
+  }
   SetUpJointLimitsParameters();
 }
 
@@ -713,6 +724,33 @@ void MultibodyPlant<T>::ExcludeCollisionsWithVisualGeometry() {
   scene_graph_->ExcludeCollisionsBetween(visual, collision);
 }
 
+namespace {
+// Helper for the contact Jacobian cache below, true iff all entries of `a`
+// and `b` differ by less than `tolerance`. The cache only ever reuses rows
+// for `T = double`; for any other scalar type the second overload is selected
+// and reuse never happens.
+template <typename DerivedA, typename DerivedB>
+typename std::enable_if<
+    std::is_same<typename DerivedA::Scalar, double>::value &&
+        std::is_same<typename DerivedB::Scalar, double>::value,
+    bool>::type
+WithinTolerance(const Eigen::MatrixBase<DerivedA>& a,
+                const Eigen::MatrixBase<DerivedB>& b, double tolerance) {
+  if (a.size() != b.size()) return false;
+  return (a - b).template lpNorm<Eigen::Infinity>() <= tolerance;
+}
+
+template <typename DerivedA, typename DerivedB>
+typename std::enable_if<
+    !std::is_same<typename DerivedA::Scalar, double>::value ||
+        !std::is_same<typename DerivedB::Scalar, double>::value,
+    bool>::type
+WithinTolerance(const Eigen::MatrixBase<DerivedA>&,
+                const Eigen::MatrixBase<DerivedB>&, double) {
+  return false;
+}
+}  // namespace
+
 template<typename T>
 void MultibodyPlant<T>::CalcNormalAndTangentContactJacobians(
     const systems::Context<T>& context,
@@ -732,6 +770,14 @@ void MultibodyPlant<T>::CalcNormalAndTangentContactJacobians(
   auto& Jt = *Jt_ptr;
   Jt.resize(2 * num_contacts, num_velocities());
 
+  // Reuse of previously computed rows is opt-in and only ever performed for
+  // T = double, see set_contact_jacobian_cache_tolerance().
+  const double tolerance = contact_jacobian_cache_tolerance_;
+  const bool use_cache = tolerance > 0 && std::is_same<T, double>::value;
+  VectorX<T> q;
+  if (use_cache) q = this->GetPositions(context);
+  ContactJacobianCache updated_cache;
+
   for (int icontact = 0; icontact < num_contacts; ++icontact) {
     const auto& point_pair = point_pairs_set[icontact];
 
@@ -748,6 +794,42 @@ void MultibodyPlant<T>::CalcNormalAndTangentContactJacobians(
     const Vector3<T>& p_WCa = point_pair.p_WCa;
     const Vector3<T>& p_WCb = point_pair.p_WCb;
 
+    if (use_cache) {
+      const ContactJacobianCache& cache = contact_jacobian_cache_;
+      const auto it = cache.pair_to_row.find(
+          std::make_pair(geometryA_id, geometryB_id));
+      if (it != cache.pair_to_row.end()) {
+        const int row = it->second;
+        // A pair's rows are reused only when the generalized positions and
+        // the pair's geometric data barely moved since the rows were last
+        // computed. The check on q guards against configurations that place
+        // the contact data at the same poses through different joint motions,
+        // which would lead to different Jacobian columns.
+        if (WithinTolerance(q, cache.q_ref[row], tolerance) &&
+            WithinTolerance(p_WCa, cache.p_WCa_ref[row], tolerance) &&
+            WithinTolerance(p_WCb, cache.p_WCb_ref[row], tolerance) &&
+            WithinTolerance(nhat_BA_W, cache.nhat_BA_W_ref[row], tolerance)) {
+          Jn.row(icontact) = cache.Jn.row(row);
+          Jt.row(2 * icontact) = cache.Jt.row(2 * row);
+          Jt.row(2 * icontact + 1) = cache.Jt.row(2 * row + 1);
+          if (R_WC_set != nullptr) {
+            R_WC_set->push_back(cache.R_WC[row]);
+          }
+          // Carry the original reference data forward, rather than the
+          // current one, so that the total drift away from the configuration
+          // the rows were computed at stays bounded by `tolerance`.
+          updated_cache.pair_to_row[std::make_pair(
+              geometryA_id, geometryB_id)] = icontact;
+          updated_cache.q_ref.push_back(cache.q_ref[row]);
+          updated_cache.p_WCa_ref.push_back(cache.p_WCa_ref[row]);
+          updated_cache.p_WCb_ref.push_back(cache.p_WCb_ref[row]);
+          updated_cache.nhat_BA_W_ref.push_back(cache.nhat_BA_W_ref[row]);
+          updated_cache.R_WC.push_back(cache.R_WC[row]);
+          continue;
+        }
+      }
+    }
+
     // TODO(amcastro-tri): Consider using the midpoint between Ac and Bc for
     // stability reasons. Besides that, there is no other reason to use the
     // midpoint (or any other point between Ac and Bc for that matter) since,
@@ -799,6 +881,23 @@ void MultibodyPlant<T>::CalcNormalAndTangentContactJacobians(
     //   vy_AcBc_C = that2⋅v_AcBc = that2ᵀ⋅(Jv_WBc - Jv_WAc)⋅v
     Jt.row(2 * icontact)     = that1_W.transpose() * (Jv_WBc - Jv_WAc);
     Jt.row(2 * icontact + 1) = that2_W.transpose() * (Jv_WBc - Jv_WAc);
+
+    if (use_cache) {
+      // Freshly computed rows become the new reference for this pair.
+      updated_cache.pair_to_row[std::make_pair(
+          geometryA_id, geometryB_id)] = icontact;
+      updated_cache.q_ref.push_back(q);
+      updated_cache.p_WCa_ref.push_back(p_WCa);
+      updated_cache.p_WCb_ref.push_back(p_WCb);
+      updated_cache.nhat_BA_W_ref.push_back(nhat_BA_W);
+      updated_cache.R_WC.push_back(R_WC);
+    }
+  }
+
+  if (use_cache) {
+    updated_cache.Jn = Jn;
+    updated_cache.Jt = Jt;
+    contact_jacobian_cache_ = std::move(updated_cache);
   }
 }
 
@@ -887,6 +986,14 @@ MultibodyPlant<T>::CalcPointPairPenetrations(
   DRAKE_ABORT_MSG("This method only supports T = double.");
 }
 
+template <typename T>
+const std::vector<PenetrationAsPointPair<T>>&
+MultibodyPlant<T>::EvalPointPairPenetrations(
+    const systems::Context<T>& context) const {
+  return this->get_cache_entry(point_pairs_cache_index_)
+      .template Eval<std::vector<PenetrationAsPointPair<T>>>(context);
+}
+
 template<typename T>
 std::vector<CoulombFriction<double>>
 MultibodyPlant<T>::CalcCombinedFrictionCoefficients(
@@ -1179,6 +1286,7 @@ template<typename T>
 void MultibodyPlant<T>::DoCalcTimeDerivatives(
     const systems::Context<T>& context,
     systems::ContinuousState<T>* derivatives) const {
+  DRAKE_TRACEPOINT("MultibodyPlant::DoCalcTimeDerivatives");
   // No derivatives to compute if state is discrete.
   if (is_discrete()) return;
 
@@ -1187,15 +1295,23 @@ void MultibodyPlant<T>::DoCalcTimeDerivatives(
           context.get_continuous_state_vector()).get_value();
   const int nv = this->num_velocities();
 
-  // Allocate workspace. We might want to cache these to avoid allocations.
-  // Mass matrix.
-  MatrixX<T> M(nv, nv);
-  // Forces.
-  MultibodyForces<T> forces(internal_tree());
+  // The workspace belongs to the supplied context, so that concurrent
+  // evaluations on per-thread contexts do not interfere; it was preallocated
+  // at context allocation time so that no heap allocations are performed
+  // here at steady state. It is plain scratch -- overwritten below, never
+  // read across calls -- so it is fetched directly rather than Eval()'ed.
+  TimeDerivativesWorkspace& workspace =
+      this->get_cache_entry(time_derivatives_workspace_index_)
+          .get_mutable_cache_entry_value(context)
+          .template GetMutableValueOrThrow<TimeDerivativesWorkspace>();
+  // Forces. CalcForceElementsContribution() below overwrites (rather than
+  // accumulates into) this workspace, no reset is needed.
+  MultibodyForces<T>& forces = workspace.forces;
   // Bodies' accelerations, ordered by BodyNodeIndex.
-  std::vector<SpatialAcceleration<T>> A_WB_array(internal_tree().num_bodies());
+  std::vector<SpatialAcceleration<T>>& A_WB_array = workspace.A_WB_array;
   // Generalized accelerations.
-  VectorX<T> vdot = VectorX<T>::Zero(nv);
+  VectorX<T>& vdot = workspace.vdot;
+  vdot.setZero();
 
   const internal::PositionKinematicsCache<T>& pc =
       EvalPositionKinematics(context);
@@ -1209,8 +1325,6 @@ void MultibodyPlant<T>::DoCalcTimeDerivatives(
   // If there is any input actuation, add it to the multibody forces.
   AddJointActuationForces(context, &forces);
 
-  internal_tree().CalcMassMatrixViaInverseDynamics(context, &M);
-
   // WARNING: to reduce memory foot-print, we use the input applied arrays also
   // as output arrays. This means that both the array of applied body forces and
   // the array of applied generalized forces get overwritten on output. This is
@@ -1224,8 +1338,8 @@ void MultibodyPlant<T>::DoCalcTimeDerivatives(
 
   // Compute contact forces on each body by penalty method.
   if (num_collision_geometries() > 0) {
-    std::vector<PenetrationAsPointPair<T>> point_pairs =
-        CalcPointPairPenetrations(context);
+    const std::vector<PenetrationAsPointPair<T>>& point_pairs =
+        EvalPointPairPenetrations(context);
     CalcAndAddContactForcesByPenaltyMethod(
         context, pc, vc, point_pairs, &F_BBo_W_array);
   }
@@ -1237,11 +1351,16 @@ void MultibodyPlant<T>::DoCalcTimeDerivatives(
       &F_BBo_W_array, /* Notice these arrays gets overwritten on output. */
       &tau_array);
 
-  vdot = M.ldlt().solve(-tau_array);
+  // O(n) forward dynamics via the articulated body algorithm. The mass
+  // matrix is never formed. The negation is performed in place to avoid an
+  // Eigen temporary.
+  tau_array = -tau_array;
+  internal_tree().SolveMassMatrixViaArticulatedBodyAlgorithm(
+      context, tau_array, &vdot);
 
   auto v = x.bottomRows(nv);
-  VectorX<T> xdot(this->num_multibody_states());
-  VectorX<T> qdot(this->num_positions());
+  VectorX<T>& xdot = workspace.xdot;
+  VectorX<T>& qdot = workspace.qdot;
   internal_tree().MapVelocityToQDot(context, v, &qdot);
   xdot << qdot, vdot;
   derivatives->SetFromVector(xdot);
@@ -1250,6 +1369,7 @@ void MultibodyPlant<T>::DoCalcTimeDerivatives(
 template<typename T>
 ImplicitStribeckSolverResult MultibodyPlant<T>::SolveUsingSubStepping(
     int num_substeps,
+    const internal::SparseLtdlFactorization<T>& M0_ltdl,
     const MatrixX<T>& M0, const MatrixX<T>& Jn, const MatrixX<T>& Jt,
     const VectorX<T>& minus_tau,
     const VectorX<T>& stiffness, const VectorX<T>& damping,
@@ -1265,6 +1385,8 @@ ImplicitStribeckSolverResult MultibodyPlant<T>::SolveUsingSubStepping(
   ImplicitStribeckSolverResult info{
       ImplicitStribeckSolverResult::kMaxIterationsReached};
 
+  const int num_contacts = Jn.rows();
+
   for (int substep = 0; substep < num_substeps; ++substep) {
     // Discrete update before applying friction forces.
     // We denote this state x* = [q*, v*], the "star" state.
@@ -1277,8 +1399,28 @@ ImplicitStribeckSolverResult MultibodyPlant<T>::SolveUsingSubStepping(
         &p_star_substep, &phi0_substep,
         &stiffness, &damping, &mu);
 
-    info = implicit_stribeck_solver_->SolveWithGuess(dt_substep,
-                                                     v0_substep);
+    // Initial guess for the Newton-Raphson iteration. By default we use the
+    // previous (sub)step velocities. When the solver recorded a warm start
+    // with a matching number of contact points (from the previous substep or
+    // from the previous discrete update), we instead predict the velocities
+    // including the previously converged contact impulses,
+    //   v_guess = M₀⁻¹ (p* + dt (Jnᵀ fn₀ + Jtᵀ ft₀)).
+    // In sustained contact this starts the iteration much closer to the
+    // solution than v0 alone, where the applied forces balanced by contact
+    // are still unopposed.
+    VectorX<T> v_guess = v0_substep;
+    if (implicit_stribeck_solver_->has_warm_start(num_contacts) &&
+        num_contacts > 0) {
+      const VectorX<T>& fn0 =
+          implicit_stribeck_solver_->get_warm_start_normal_forces();
+      const VectorX<T>& ft0 =
+          implicit_stribeck_solver_->get_warm_start_friction_forces();
+      v_guess = M0_ltdl.Solve(
+          p_star_substep +
+          dt_substep * (Jn.transpose() * fn0 + Jt.transpose() * ft0));
+    }
+
+    info = implicit_stribeck_solver_->SolveWithGuess(dt_substep, v_guess);
 
     // Break the sub-stepping loop on failure and return the info result.
     if (info != ImplicitStribeckSolverResult::kSuccess) break;
@@ -1301,6 +1443,7 @@ void MultibodyPlant<T>::DoCalcDiscreteVariableUpdates(
     const drake::systems::Context<T>& context0,
     const std::vector<const drake::systems::DiscreteUpdateEvent<T>*>&,
     drake::systems::DiscreteValues<T>* updates) const {
+  DRAKE_TRACEPOINT("MultibodyPlant::DoCalcDiscreteVariableUpdates");
   // Assert this method was called on a context storing discrete state.
   DRAKE_ASSERT(context0.get_num_discrete_state_groups() == 1);
   DRAKE_ASSERT(context0.get_continuous_state().size() == 0);
@@ -1316,10 +1459,20 @@ void MultibodyPlant<T>::DoCalcDiscreteVariableUpdates(
   VectorX<T> q0 = x0.topRows(nq);
   VectorX<T> v0 = x0.bottomRows(nv);
 
-  // Mass matrix and its factorization.
+  // Mass matrix and its factorization. The factorization exploits the
+  // branch-induced sparsity of M0 and remains valid for the entire update
+  // since M0 is only evaluated at q0. The solver uses it whenever it needs
+  // to solve against the mass matrix. The factorization is owned by the
+  // supplied context, not by this plant.
   MatrixX<T> M0(nv, nv);
-  internal_tree().CalcMassMatrixViaInverseDynamics(context0, &M0);
-  auto M0_ldlt = M0.ldlt();
+  internal_tree().CalcMassMatrix(context0, &M0);
+  internal::SparseLtdlFactorization<T>& M0_ltdl =
+      this->get_cache_entry(mass_matrix_ltdl_index_)
+          .get_mutable_cache_entry_value(context0)
+          .template GetMutableValueOrThrow<
+              internal::SparseLtdlFactorization<T>>();
+  M0_ltdl.Factorize(M0);
+  implicit_stribeck_solver_->set_mass_matrix_factorization(&M0_ltdl);
 
   // Forces at the previous time step.
   MultibodyForces<T> forces0(internal_tree());
@@ -1337,9 +1490,8 @@ void MultibodyPlant<T>::DoCalcDiscreteVariableUpdates(
 
   AddJointLimitsPenaltyForces(context0, &forces0);
 
-  // TODO(amcastro-tri): Eval() point_pairs0 when caching lands.
-  const std::vector<PenetrationAsPointPair<T>> point_pairs0 =
-      CalcPointPairPenetrations(context0);
+  const std::vector<PenetrationAsPointPair<T>>& point_pairs0 =
+      EvalPointPairPenetrations(context0);
 
   // Workspace for inverse dynamics:
   // Bodies' accelerations, ordered by BodyNodeIndex.
@@ -1426,7 +1578,8 @@ void MultibodyPlant<T>::DoCalcDiscreteVariableUpdates(
   do {
     ++num_substeps;
     info = SolveUsingSubStepping(
-        num_substeps, M0, Jn, Jt, minus_tau, stiffness, damping, mu, v0, phi0);
+        num_substeps, M0_ltdl, M0, Jn, Jt, minus_tau, stiffness, damping, mu,
+        v0, phi0);
   } while (info != ImplicitStribeckSolverResult::kSuccess &&
            num_substeps < kNumMaxSubTimeSteps);
 
@@ -1495,10 +1648,74 @@ void MultibodyPlant<T>::DeclareStateCacheAndPorts() {
 
   if (is_discrete()) {
     this->DeclarePeriodicDiscreteUpdate(time_step_);
+
+    // Branch-induced sparsity exploiting factorization of the mass matrix
+    // used by the discrete updates. The sparsity pattern is known once the
+    // topology is finalized; the factors themselves are refreshed at the
+    // start of every discrete update. Declaring the factorization as a cache
+    // entry gives every Context its own copy, so that concurrent updates on
+    // per-thread Contexts do not share it; see the "Thread safety" notes in
+    // the System class documentation. The entry is never Eval()'ed -- it is
+    // refactorized and consumed within a single update -- so its calculator
+    // is a no-op and it has no prerequisites.
+    auto& mass_matrix_ltdl_cache_entry = this->DeclareCacheEntry(
+        std::string("mass matrix LTDL factorization"),
+        [this]() {
+          return systems::AbstractValue::Make(
+              internal::SparseLtdlFactorization<T>(
+                  internal_tree().get_topology()));
+        },
+        [](const systems::ContextBase&, systems::AbstractValue*) {},
+        {this->nothing_ticket()});
+    mass_matrix_ltdl_index_ = mass_matrix_ltdl_cache_entry.cache_index();
   }
 
   // TODO(sherm1) Add ContactResults cache entry.
 
+  // Cache entry for the penetration point pairs. All consumers of the
+  // penetration results within a step (contact forces, contact results,
+  // contact Jacobians) share this entry so that the geometry query is
+  // performed only once. The entry tracks the geometry query input port so
+  // that the dependency system invalidates it whenever the query object
+  // changes.
+  auto& point_pairs_cache_entry = this->DeclareCacheEntry(
+      std::string("point pair penetrations"),
+      []() {
+        return systems::AbstractValue::Make(
+            std::vector<geometry::PenetrationAsPointPair<T>>());
+      },
+      [this](const systems::ContextBase& context_base,
+             systems::AbstractValue* cache_value) {
+        auto& context = dynamic_cast<const Context<T>&>(context_base);
+        auto& point_pairs = cache_value->GetMutableValue<
+            std::vector<geometry::PenetrationAsPointPair<T>>>();
+        point_pairs = this->CalcPointPairPenetrations(context);
+      },
+      // Plants without registered geometry never have penetration pairs and
+      // thus the cache entry has no prerequisites.
+      {geometry_query_port_.is_valid()
+           ? this->input_port_ticket(geometry_query_port_)
+           : this->nothing_ticket()});
+  point_pairs_cache_index_ = point_pairs_cache_entry.cache_index();
+
+  // Scratch workspace for DoCalcTimeDerivatives(). Declaring it as a cache
+  // entry gives every Context its own preallocated copy, so that concurrent
+  // derivative evaluations on per-thread Contexts do not interfere; see the
+  // "Thread safety" notes in the System class documentation. The entry is
+  // never Eval()'ed -- the workspace is overwritten on every use and never
+  // read across calls -- so its calculator is a no-op and it has no
+  // prerequisites.
+  auto& time_derivatives_workspace_cache_entry = this->DeclareCacheEntry(
+      std::string("time derivatives workspace"),
+      [this]() {
+        return systems::AbstractValue::Make(
+            TimeDerivativesWorkspace(internal_tree()));
+      },
+      [](const systems::ContextBase&, systems::AbstractValue*) {},
+      {this->nothing_ticket()});
+  time_derivatives_workspace_index_ =
+      time_derivatives_workspace_cache_entry.cache_index();
+
   // Declare per model instance actuation ports.
   int num_actuated_instances = 0;
   ModelInstanceIndex last_actuated_instance;
@@ -1735,19 +1952,14 @@ void MultibodyPlant<T>::CalcFramePoseOutput(
   const internal::PositionKinematicsCache<T>& pc =
       EvalPositionKinematics(context);
 
-  // TODO(amcastro-tri): Make use of Body::EvalPoseInWorld(context) once caching
-  // lands.
-  poses->clear();
-  for (const auto it : body_index_to_frame_id_) {
-    const BodyIndex body_index = it.first;
-    if (body_index == world_index()) continue;
-    const Body<T>& body = internal_tree().get_body(body_index);
-
-    // NOTE: The GeometryFrames for each body were registered in the world
-    // frame, so we report poses in the world frame.
-    poses->set_value(body_index_to_frame_id_.at(body_index),
-                     pc.get_X_WB(body.node_index()));
-  }
+  // NOTE: The GeometryFrames for each body were registered in the world
+  // frame, so we report poses in the world frame. The position kinematics
+  // cache stores X_WB contiguously by body node index, so rather than
+  // copying each pose into the output we hand the whole pool over as an
+  // aliased buffer -- one bulk call per step. The pool lives in the context's
+  // cache and is refreshed in place, so the alias stays current.
+  poses->SetAliasedValues(frame_ids_in_pose_output_, frame_pose_pool_indices_,
+                          &pc.get_X_WB(internal::BodyNodeIndex(0)));
 }
 
 template <typename T>
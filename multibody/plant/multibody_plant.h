@@ -21,6 +21,7 @@
 #include "drake/multibody/tree/multibody_tree.h"
 #include "drake/multibody/tree/multibody_tree_system.h"
 #include "drake/multibody/tree/rigid_body.h"
+#include "drake/multibody/tree/sparse_ltdl_factorization.h"
 #include "drake/multibody/tree/uniform_gravity_field_element.h"
 #include "drake/multibody/tree/weld_joint.h"
 #include "drake/systems/framework/diagram_builder.h"
@@ -2129,6 +2130,31 @@ class MultibodyPlant : public MultibodyTreeSystem<T> {
     internal_tree().CalcMassMatrixViaInverseDynamics(context, H);
   }
 
+  /// Performs the computation of the mass matrix `M(q)` of the model using
+  /// the Composite Rigid Body Algorithm (CRBA), where the generalized
+  /// positions q are stored in `context`.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the model.
+  /// @param[out] H
+  ///   A valid (non-null) pointer to a squared matrix in `ℛⁿˣⁿ` with n the
+  ///   number of generalized velocities (num_velocities()) of the model.
+  ///   This method aborts if H is nullptr or if it does not have the proper
+  ///   size.
+  ///
+  /// The algorithm performs a single tip-to-base sweep accumulating the
+  /// spatial inertia of the composite body formed by each body and its
+  /// outboard bodies, followed by the projection of those composite inertias
+  /// through the hinge matrices along each path to the world. While still
+  /// O(n²) in the worst case (the mass matrix has O(n²) entries), its cost is
+  /// dramatically smaller than that of CalcMassMatrixViaInverseDynamics(),
+  /// which performs a full inverse dynamics sweep per generalized velocity.
+  /// Prefer this method whenever the explicit mass matrix is needed.
+  void CalcMassMatrix(
+      const systems::Context<T>& context, EigenPtr<MatrixX<T>> H) const {
+    internal_tree().CalcMassMatrix(context, H);
+  }
+
   // TODO(amcastro-tri): Add state accessors for free body spatial velocities.
 
   /// @}
@@ -2759,6 +2785,28 @@ class MultibodyPlant : public MultibodyTreeSystem<T> {
   }
   /// @}
 
+  /// Sets the tolerance used to reuse cached contact Jacobian rows across
+  /// discrete steps. When non-zero, the rows of the normal and tangential
+  /// contact Jacobians for a contact pair are reused from the previous
+  /// evaluation whenever the contact set is unchanged, the generalized
+  /// positions moved less than `tolerance` and the pair's contact points and
+  /// normal moved less than `tolerance`. This trades a Jacobian error of
+  /// order `tolerance` for skipping the recomputation of unchanged pairs,
+  /// which is the common case for objects at rest in persistent contact.
+  /// A value of zero (the default) disables reuse. Reuse is only ever
+  /// performed for `T = double`.
+  /// @throws std::exception if `tolerance` is negative.
+  void set_contact_jacobian_cache_tolerance(double tolerance) {
+    DRAKE_THROW_UNLESS(tolerance >= 0);
+    contact_jacobian_cache_tolerance_ = tolerance;
+  }
+
+  /// Returns the tolerance used to reuse cached contact Jacobian rows, see
+  /// set_contact_jacobian_cache_tolerance().
+  double contact_jacobian_cache_tolerance() const {
+    return contact_jacobian_cache_tolerance_;
+  }
+
   /// Sets the `state` so that generalized positions and velocities are zero.
   /// @throws std::exception if called pre-finalize. See Finalize().
   void SetDefaultState(const systems::Context<T>& context,
@@ -2915,6 +2963,7 @@ class MultibodyPlant : public MultibodyTreeSystem<T> {
   // approximated to be constant, a first order approximation.
   ImplicitStribeckSolverResult SolveUsingSubStepping(
       int num_substeps,
+      const internal::SparseLtdlFactorization<T>& M0_ltdl,
       const MatrixX<T>& M0, const MatrixX<T>& Jn, const MatrixX<T>& Jt,
       const VectorX<T>& minus_tau,
       const VectorX<T>& stiffness, const VectorX<T>& damping,
@@ -2995,6 +3044,15 @@ class MultibodyPlant : public MultibodyTreeSystem<T> {
   std::vector<geometry::PenetrationAsPointPair<T>>
   CalcPointPairPenetrations(const systems::Context<T>& context) const;
 
+  // Evaluates the cache entry storing the penetration point pairs for the
+  // current `context`, performing the geometry query only if the cache entry
+  // is out of date. The cache entry tracks the geometry query input port
+  // through the dependency system so that within a step all the consumers of
+  // the penetration results (contact forces, contact results, contact
+  // Jacobians) share a single geometry query.
+  const std::vector<geometry::PenetrationAsPointPair<T>>&
+  EvalPointPairPenetrations(const systems::Context<T>& context) const;
+
   // This helper method combines the friction properties for each pair of
   // contact points in `point_pairs` according to
   // CalcContactFrictionFromSurfaceProperties().
@@ -3079,6 +3137,35 @@ class MultibodyPlant : public MultibodyTreeSystem<T> {
       MatrixX<T>* Jn, MatrixX<T>* Jt,
       std::vector<Matrix3<T>>* R_WC_set = nullptr) const;
 
+  // Storage to reuse contact Jacobian rows across discrete steps, see
+  // set_contact_jacobian_cache_tolerance(). For each contact pair we store
+  // the generalized positions and the pair's geometric data (contact points
+  // and normal) at the time its rows were last computed, together with the
+  // computed rows themselves. Rows are keyed on the pair of GeometryIds so
+  // that pairs surviving a contact set change still reuse their rows.
+  struct ContactJacobianCache {
+    std::map<std::pair<geometry::GeometryId, geometry::GeometryId>, int>
+        pair_to_row;
+    // Reference data for each cached pair, indexed by the row index above.
+    std::vector<VectorX<T>> q_ref;
+    std::vector<Vector3<T>> p_WCa_ref;
+    std::vector<Vector3<T>> p_WCb_ref;
+    std::vector<Vector3<T>> nhat_BA_W_ref;
+    // Cached Jacobian rows and contact frame orientations. The i-th pair owns
+    // row i of Jn and rows 2*i and 2*i+1 of Jt.
+    std::vector<Matrix3<T>> R_WC;
+    MatrixX<T> Jn;
+    MatrixX<T> Jt;
+  };
+  // This cache is mutable so that CalcNormalAndTangentContactJacobians() can
+  // update it from within the (const) discrete update calculations, the same
+  // way implicit_stribeck_solver_ reuses its internal workspace.
+  mutable ContactJacobianCache contact_jacobian_cache_;
+
+  // Tolerance for the reuse of cached contact Jacobian rows. Zero (the
+  // default) disables the cache.
+  double contact_jacobian_cache_tolerance_{0.0};
+
   // The gravity field force element.
   optional<const UniformGravityFieldElement<T>*> gravity_field_;
 
@@ -3184,6 +3271,13 @@ class MultibodyPlant : public MultibodyTreeSystem<T> {
   // Iteration order on this map DOES matter, and therefore we use an std::map.
   std::map<BodyIndex, geometry::FrameId> body_index_to_frame_id_;
 
+  // Bulk pose hand-off tables for CalcFramePoseOutput(): the registered frame
+  // ids and, for each, the body-node index of its body -- i.e. the offset of
+  // its world pose within the contiguous X_WB pool of the position kinematics
+  // cache. Built in FinalizePlantOnly().
+  std::vector<geometry::FrameId> frame_ids_in_pose_output_;
+  std::vector<int> frame_pose_pool_indices_;
+
   // Data to get back from a SceneGraph-reported frame id to its associated
   // body.
   std::unordered_map<geometry::FrameId, BodyIndex> frame_id_to_body_index_;
@@ -3222,6 +3316,10 @@ class MultibodyPlant : public MultibodyTreeSystem<T> {
   systems::InputPortIndex geometry_query_port_;
   systems::OutputPortIndex geometry_pose_port_;
 
+  // Index of the cache entry storing the penetration point pairs, see
+  // EvalPointPairPenetrations().
+  systems::CacheIndex point_pairs_cache_index_;
+
   // For geometry registration with a GS, we save a pointer to the GS instance
   // on which this plants calls RegisterAsSourceForSceneGraph(). This will be
   // set to `nullptr` after finalization, to mirror constraints presented by
@@ -3263,6 +3361,37 @@ class MultibodyPlant : public MultibodyTreeSystem<T> {
   // The solver used when the plant is modeled as a discrete system.
   std::unique_ptr<ImplicitStribeckSolver<T>> implicit_stribeck_solver_;
 
+  // Cache entry holding the branch-induced sparsity exploiting factorization
+  // of the mass matrix used by the discrete updates. Each Context owns its
+  // own factorization (refreshed at the start of every discrete update) so
+  // that concurrent updates on per-thread Contexts do not share it; see the
+  // "Thread safety" notes in the System class documentation. Only valid for
+  // discrete models.
+  systems::CacheIndex mass_matrix_ltdl_index_;
+
+  // Scratch workspace for DoCalcTimeDerivatives(), preallocated at context
+  // allocation time so that steady-state derivative evaluations perform no
+  // heap allocations. It is overwritten on every use and never read across
+  // calls. Each Context owns its own copy (see the cache entry declared in
+  // DeclareStateCacheAndPorts()) so that concurrent derivative evaluations
+  // on per-thread Contexts do not interfere; see the "Thread safety" notes
+  // in the System class documentation.
+  struct TimeDerivativesWorkspace {
+    explicit TimeDerivativesWorkspace(const internal::MultibodyTree<T>& tree)
+        : forces(tree),
+          A_WB_array(tree.num_bodies()),
+          vdot(tree.num_velocities()),
+          qdot(tree.num_positions()),
+          xdot(tree.num_states()) {}
+    MultibodyForces<T> forces;
+    // Bodies' accelerations, ordered by BodyNodeIndex.
+    std::vector<SpatialAcceleration<T>> A_WB_array;
+    VectorX<T> vdot;
+    VectorX<T> qdot;
+    VectorX<T> xdot;
+  };
+  systems::CacheIndex time_derivatives_workspace_index_;
+
   // TODO(sherm1) Add CacheIndex members here for cache entries that belong to
   //              MBPlant, not MBTree.
 
@@ -106,6 +106,70 @@ GTEST_TEST(ContactResultToLcmSystem, NonEmptyMultibodyPlantEmptyContact) {
                   0, MatrixCompareType::absolute);
 }
 
+// Confirm that with a tolerance set, a near-identical input leaves the
+// previously computed message byte-for-byte untouched (timestamp included),
+// and that a larger change refreshes the message as usual.
+GTEST_TEST(ContactResultToLcmSystem, UnchangedPublishTolerance) {
+  const AcrobotParameters parameters;
+  std::unique_ptr<MultibodyPlant<double>> plant =
+      MakeAcrobotPlant(parameters, true /* finalize */);
+
+  ContactResultsToLcmSystem<double> lcm_system(*plant);
+  lcm_system.set_unchanged_publish_tolerance(1e-3);
+
+  const BodyIndex index1 =
+      plant->GetBodyByName(parameters.link1_name()).index();
+  const BodyIndex index2 =
+      plant->GetBodyByName(parameters.link2_name()).index();
+  PenetrationAsPointPair<double> penetration_data;
+  penetration_data.nhat_BA_W << 1, 2, 3;
+  const Vector3<double> f_BC_W{1, 2, 3};
+  const Vector3<double> p_WC{-1, -2, -2};
+
+  auto make_contacts = [&](const Vector3<double>& point) {
+    ContactResults<double> contacts;
+    contacts.AddContactInfo(PointPairContactInfo<double>{
+        index1, index2, f_BC_W, point, 0.25, 0.5, penetration_data});
+    return contacts;
+  };
+
+  auto lcm_context = lcm_system.AllocateContext();
+  const int input_index =
+      lcm_system.get_contact_result_input_port().get_index();
+  lcm_context->FixInputPort(
+      input_index, systems::Value<ContactResults<double>>(make_contacts(p_WC)));
+
+  Value<lcmt_contact_results_for_viz> lcm_message_value;
+  lcm_system.get_lcm_message_output_port().Calc(*lcm_context,
+                                                &lcm_message_value);
+
+  // A perturbation within tolerance at a later time must leave the message
+  // untouched, stale timestamp and all.
+  lcm_context->set_time(0.5);
+  lcm_context->FixInputPort(
+      input_index, systems::Value<ContactResults<double>>(
+                       make_contacts(p_WC + Vector3<double>::Constant(1e-4))));
+  lcm_system.get_lcm_message_output_port().Calc(*lcm_context,
+                                                &lcm_message_value);
+  const lcmt_contact_results_for_viz& lcm_message =
+      lcm_message_value.GetValue<lcmt_contact_results_for_viz>();
+  EXPECT_EQ(lcm_message.timestamp, 0);
+  ASSERT_EQ(lcm_message.num_contacts, 1);
+  CompareMatrices(Vector3<double>(lcm_message.contact_info[0].contact_point),
+                  p_WC, 0, MatrixCompareType::absolute);
+
+  // A perturbation beyond tolerance refreshes the message.
+  const Vector3<double> p_WC_moved = p_WC + Vector3<double>::Constant(0.1);
+  lcm_context->FixInputPort(
+      input_index,
+      systems::Value<ContactResults<double>>(make_contacts(p_WC_moved)));
+  lcm_system.get_lcm_message_output_port().Calc(*lcm_context,
+                                                &lcm_message_value);
+  EXPECT_EQ(lcm_message.timestamp, 500000);
+  CompareMatrices(Vector3<double>(lcm_message.contact_info[0].contact_point),
+                  p_WC_moved, 0, MatrixCompareType::absolute);
+}
+
 // Confirm that the system can be transmogrified to other supported scalars.
 GTEST_TEST(ContactResultToLcmSystem, Transmogrify) {
   MultibodyPlant<double> plant;
@@ -1740,6 +1740,75 @@ TEST_F(MultibodyPlantContactJacobianTests, NormalAndTangentJacobian) {
       D, vt_derivs, kTolerance, MatrixCompareType::relative));
 }
 
+// Verifies the opt-in reuse of contact Jacobian rows across evaluations, see
+// MultibodyPlant::set_contact_jacobian_cache_tolerance().
+TEST_F(MultibodyPlantContactJacobianTests, ContactJacobianCaching) {
+  // Caching is disabled by default; compute a baseline without it.
+  ASSERT_EQ(plant_.contact_jacobian_cache_tolerance(), 0.0);
+  MatrixX<double> N_baseline, D_baseline;
+  std::vector<Matrix3<double>> R_WC_baseline;
+  MultibodyPlantTester::CalcNormalAndTangentContactJacobians(
+      plant_, *context_, penetrations_, &N_baseline, &D_baseline,
+      &R_WC_baseline);
+
+  const double kCacheTolerance = 1.0e-6;
+  plant_.set_contact_jacobian_cache_tolerance(kCacheTolerance);
+  EXPECT_EQ(plant_.contact_jacobian_cache_tolerance(), kCacheTolerance);
+
+  // The first evaluation populates the cache and therefore must match the
+  // baseline bit-exact.
+  MatrixX<double> N, D;
+  std::vector<Matrix3<double>> R_WC_set;
+  MultibodyPlantTester::CalcNormalAndTangentContactJacobians(
+      plant_, *context_, penetrations_, &N, &D, &R_WC_set);
+  EXPECT_TRUE(CompareMatrices(N, N_baseline));
+  EXPECT_TRUE(CompareMatrices(D, D_baseline));
+  const int nc = penetrations_.size();
+  for (int i = 0; i < nc; ++i) {
+    EXPECT_TRUE(CompareMatrices(R_WC_set[i], R_WC_baseline[i]));
+  }
+
+  // Perturbing the contact data well within the tolerance must reuse the
+  // cached rows bit-exact.
+  std::vector<PenetrationAsPointPair<double>> nudged = penetrations_;
+  for (auto& pair : nudged) {
+    pair.p_WCa += Vector3<double>::Constant(0.1 * kCacheTolerance);
+    pair.p_WCb += Vector3<double>::Constant(0.1 * kCacheTolerance);
+  }
+  MatrixX<double> N_nudged, D_nudged;
+  std::vector<Matrix3<double>> R_WC_nudged;
+  MultibodyPlantTester::CalcNormalAndTangentContactJacobians(
+      plant_, *context_, nudged, &N_nudged, &D_nudged, &R_WC_nudged);
+  EXPECT_TRUE(CompareMatrices(N_nudged, N_baseline));
+  EXPECT_TRUE(CompareMatrices(D_nudged, D_baseline));
+  for (int i = 0; i < nc; ++i) {
+    EXPECT_TRUE(CompareMatrices(R_WC_nudged[i], R_WC_baseline[i]));
+  }
+
+  // A perturbation beyond the tolerance must trigger recomputation and match
+  // the result with caching disabled.
+  std::vector<PenetrationAsPointPair<double>> moved = penetrations_;
+  for (auto& pair : moved) {
+    pair.p_WCa += Vector3<double>(0.0, 0.0, 1000 * kCacheTolerance);
+  }
+  MatrixX<double> N_moved, D_moved;
+  std::vector<Matrix3<double>> R_WC_moved;
+  MultibodyPlantTester::CalcNormalAndTangentContactJacobians(
+      plant_, *context_, moved, &N_moved, &D_moved, &R_WC_moved);
+  EXPECT_FALSE(CompareMatrices(N_moved, N_baseline));
+  plant_.set_contact_jacobian_cache_tolerance(0.0);
+  MatrixX<double> N_moved_ref, D_moved_ref;
+  std::vector<Matrix3<double>> R_WC_moved_ref;
+  MultibodyPlantTester::CalcNormalAndTangentContactJacobians(
+      plant_, *context_, moved, &N_moved_ref, &D_moved_ref, &R_WC_moved_ref);
+  EXPECT_TRUE(CompareMatrices(N_moved, N_moved_ref));
+  EXPECT_TRUE(CompareMatrices(D_moved, D_moved_ref));
+
+  // Negative tolerances are rejected.
+  EXPECT_THROW(plant_.set_contact_jacobian_cache_tolerance(-1.0),
+               std::exception);
+}
+
 // Verifies that we can obtain the indexes into the state vector for each joint
 // in the model of a Kuka arm.
 // For this topologically simple model with only one branch of bodies with root
@@ -21,6 +21,8 @@ namespace internal {
 /// - Articulated body inertia `Pplus_PB_W`, which can be thought of as the
 ///   articulated body inertia of parent body P as though it were inertialess,
 ///   but taken about Bo and expressed in W.
+/// - LDLT factorization `ldlt_D_B` of the articulated body hinge inertia.
+/// - Kalman gain `g_PB_W = P_B_W * H_PB_W * D_B⁻¹`.
 ///
 /// @tparam T The mathematical type of the context, which must be a valid Eigen
 ///           scalar.
@@ -59,6 +61,34 @@ class ArticulatedBodyInertiaCache {
     return Pplus_PB_W_[body_node_index];
   }
 
+  /// LDLT factorization `ldlt_D_B` of the articulated body hinge inertia
+  /// `D_B = H_PB_Wᵀ * P_B_W * H_PB_W`.
+  const Eigen::LDLT<MatrixUpTo6<T>>& get_ldlt_D_B(
+      BodyNodeIndex body_node_index) const {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return ldlt_D_B_[body_node_index];
+  }
+
+  /// Mutable version of get_ldlt_D_B().
+  Eigen::LDLT<MatrixUpTo6<T>>& get_mutable_ldlt_D_B(
+      BodyNodeIndex body_node_index) {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return ldlt_D_B_[body_node_index];
+  }
+
+  /// The Kalman gain `g_PB_W = P_B_W * H_PB_W * D_B⁻¹` of the articulated
+  /// body.
+  const Matrix6xUpTo6<T>& get_g_PB_W(BodyNodeIndex body_node_index) const {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return g_PB_W_[body_node_index];
+  }
+
+  /// Mutable version of get_g_PB_W().
+  Matrix6xUpTo6<T>& get_mutable_g_PB_W(BodyNodeIndex body_node_index) {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return g_PB_W_[body_node_index];
+  }
+
  private:
   // The type of the pools for storing articulated body inertias.
   typedef std::vector<ArticulatedBodyInertia<T>> ABI_PoolType;
@@ -66,13 +96,17 @@ class ArticulatedBodyInertiaCache {
   // Allocates resources for this articulated body cache.
   void Allocate() {
     Pplus_PB_W_.resize(num_nodes_);
+    ldlt_D_B_.resize(num_nodes_);
+    g_PB_W_.resize(num_nodes_);
   }
 
   // Number of body nodes in the corresponding MultibodyTree.
   int num_nodes_{0};
 
-  // Pools.
-  ABI_PoolType Pplus_PB_W_{};  // Indexed by BodyNodeIndex.
+  // Pools. All pools are indexed by BodyNodeIndex.
+  ABI_PoolType Pplus_PB_W_{};
+  std::vector<Eigen::LDLT<MatrixUpTo6<T>>> ldlt_D_B_{};
+  std::vector<Matrix6xUpTo6<T>> g_PB_W_{};
 };
 
 }  // namespace internal
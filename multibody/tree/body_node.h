@@ -1016,10 +1016,14 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     MatrixUpTo6<T> D_B(nv, nv);
     D_B.template triangularView<Eigen::Lower>() = HTxP * H_PB_W;
 
-    // Compute the LDLT factorization of D_B as ldlt_D_B.
+    // Compute the LDLT factorization of D_B as ldlt_D_B and store it in the
+    // cache; the factorization is reused by the force and acceleration sweeps
+    // of the articulated body algorithm.
     // TODO(bobbyluig): Test performance against inverse().
-    const auto ldlt_D_B =
-        D_B.template selfadjointView<Eigen::Lower>().ldlt();
+    // Note that Eigen::LDLT only references the lower triangular part of its
+    // argument, which is the part of D_B computed above.
+    Eigen::LDLT<MatrixUpTo6<T>>& ldlt_D_B = get_mutable_ldlt_D_B(abc);
+    ldlt_D_B.compute(D_B);
 
     // Ensure that D_B is not singular.
     // Singularity means that a non-physical hinge mapping matrix was used or
@@ -1035,8 +1039,9 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
       throw std::runtime_error(message.str());
     }
 
-    // Compute the Kalman gain, g_PB_W, using (6).
-    const MatrixUpTo6<T> g_PB_W = ldlt_D_B.solve(HTxP).transpose();
+    // Compute the Kalman gain, g_PB_W, using (6), and store it in the cache.
+    Matrix6xUpTo6<T>& g_PB_W = get_mutable_g_PB_W(abc);
+    g_PB_W = ldlt_D_B.solve(HTxP).transpose();
 
     // Project P_B_W using (7) to obtain Pplus_PB_W, the articulated body
     // inertia of this body B as felt by body P and expressed in frame W.
@@ -1047,6 +1052,139 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
         0.5 * (Pplus_PB_W_mat + Pplus_PB_W_mat.transpose()));
   }
 
+  /// This method is used by MultibodyTree within a tip-to-base loop as the
+  /// second pass of the articulated body algorithm when solving the linear
+  /// system `M(q)⋅x = b`, with `M(q)` the mass matrix. It accumulates the
+  /// articulated body force bias `Zplus_PB_W` for this node, treating the
+  /// segment of `b` corresponding to this node's mobilities as an applied
+  /// generalized force. Since the solve is performed at zero velocities, all
+  /// velocity dependent bias terms are absent and shift operations are purely
+  /// rigid.
+  ///
+  /// @param[in] pc
+  ///   An already updated position kinematics cache in sync with the context.
+  /// @param[in] abc
+  ///   An already updated articulated body inertia cache in sync with the
+  ///   context.
+  /// @param[in] H_PB_W
+  ///   The hinge mapping matrix for this node, see GetJacobianFromArray().
+  /// @param[in] b
+  ///   The right hand side of the linear system, of size
+  ///   MultibodyTree::num_velocities().
+  /// @param[out] Zplus_PB_W_array
+  ///   Projected articulated body force biases, indexed by BodyNodeIndex.
+  /// @param[out] e_B_array
+  ///   The bias projection `e_B = b_B - H_PB_Wᵀ⋅z_B` for each node, indexed
+  ///   by BodyNodeIndex. Consumed by the base-to-tip pass.
+  ///
+  /// @pre CalcArticulatedBodyInertiaCache_TipToBase() was used to update `abc`
+  /// and this method has already been called for all the child nodes of `this`
+  /// node (and, by recursive precondition, all successor nodes in the tree.)
+  ///
+  /// @throws std::exception when called on the _root_ node.
+  void CalcArticulatedBodyForceBias_TipToBase(
+      const PositionKinematicsCache<T>& pc,
+      const ArticulatedBodyInertiaCache<T>& abc,
+      const Eigen::Ref<const MatrixUpTo6<T>>& H_PB_W,
+      const Eigen::Ref<const VectorX<T>>& b,
+      std::vector<SpatialForce<T>>* Zplus_PB_W_array,
+      std::vector<VectorUpTo6<T>>* e_B_array) const {
+    DRAKE_THROW_UNLESS(topology_.body != world_index());
+    DRAKE_THROW_UNLESS(Zplus_PB_W_array != nullptr);
+    DRAKE_THROW_UNLESS(e_B_array != nullptr);
+
+    const Isometry3<T>& X_WB = get_X_WB(pc);
+
+    // Accumulate the projected force biases from all children, shifted to Bo:
+    //   z_B = Σᵢ Φ(p_BCᵢ_W) zplus_Cᵢ.
+    SpatialForce<T> Z_Bo_W = SpatialForce<T>::Zero();
+    for (const BodyNode<T>* child : children_) {
+      const Vector3<T> p_CoBo_W =
+          X_WB.translation() - child->get_X_WB(pc).translation();
+      Z_Bo_W += (*Zplus_PB_W_array)[child->index()].Shift(p_CoBo_W);
+    }
+
+    const int nv = get_num_mobilizer_velocities();
+    SpatialForce<T>& Zplus_PB_W = (*Zplus_PB_W_array)[topology_.index];
+    if (nv > 0) {
+      // e_B = b_B - H_PB_Wᵀ⋅z_B.
+      VectorUpTo6<T>& e_B = (*e_B_array)[topology_.index];
+      e_B = b.segment(topology_.mobilizer_velocities_start_in_v, nv) -
+            H_PB_W.transpose() * Z_Bo_W.get_coeffs();
+      // zplus_B = z_B + g_PB_W⋅e_B.
+      Zplus_PB_W = Z_Bo_W + SpatialForce<T>(get_g_PB_W(abc) * e_B);
+    } else {
+      Zplus_PB_W = Z_Bo_W;
+    }
+  }
+
+  /// This method is used by MultibodyTree within a base-to-tip loop as the
+  /// final pass of the articulated body algorithm when solving the linear
+  /// system `M(q)⋅x = b`, with `M(q)` the mass matrix. It computes the
+  /// segment of the solution `x` corresponding to this node's mobilities
+  /// together with the body spatial acceleration `A_WB` that results from
+  /// `v̇ = x` at zero velocities.
+  ///
+  /// @param[in] pc
+  ///   An already updated position kinematics cache in sync with the context.
+  /// @param[in] abc
+  ///   An already updated articulated body inertia cache in sync with the
+  ///   context.
+  /// @param[in] H_PB_W
+  ///   The hinge mapping matrix for this node, see GetJacobianFromArray().
+  /// @param[in] e_B_array
+  ///   The bias projections computed by
+  ///   CalcArticulatedBodyForceBias_TipToBase(), indexed by BodyNodeIndex.
+  /// @param[in,out] A_WB_array
+  ///   Body spatial accelerations, indexed by BodyNodeIndex. The entry for
+  ///   this node's parent must already be valid; on output the entry for this
+  ///   node is updated.
+  /// @param[out] x
+  ///   The solution of the linear system; only the segment corresponding to
+  ///   this node's mobilities is written.
+  ///
+  /// @pre CalcArticulatedBodyForceBias_TipToBase() was called for all nodes
+  /// and this method has already been called for all ancestor nodes.
+  ///
+  /// @throws std::exception when called on the _root_ node.
+  void CalcArticulatedBodyAccelerations_BaseToTip(
+      const PositionKinematicsCache<T>& pc,
+      const ArticulatedBodyInertiaCache<T>& abc,
+      const Eigen::Ref<const MatrixUpTo6<T>>& H_PB_W,
+      const std::vector<VectorUpTo6<T>>& e_B_array,
+      std::vector<SpatialAcceleration<T>>* A_WB_array,
+      EigenPtr<VectorX<T>> x) const {
+    DRAKE_THROW_UNLESS(topology_.body != world_index());
+    DRAKE_THROW_UNLESS(A_WB_array != nullptr);
+    DRAKE_THROW_UNLESS(x != nullptr);
+
+    // Rigidly shift the parent's spatial acceleration to Bo. Velocity
+    // dependent terms are absent since this solve is performed at zero
+    // velocities.
+    const Vector3<T> p_PoBo_W =
+        get_X_WB(pc).translation() -
+        parent_node_->get_X_WB(pc).translation();
+    const SpatialAcceleration<T>& A_WP =
+        (*A_WB_array)[topology_.parent_body_node];
+    const SpatialAcceleration<T> Aplus_WB(
+        A_WP.rotational(),
+        A_WP.translational() + A_WP.rotational().cross(p_PoBo_W));
+
+    const int nv = get_num_mobilizer_velocities();
+    SpatialAcceleration<T>& A_WB = (*A_WB_array)[topology_.index];
+    if (nv > 0) {
+      // x_B = D_B⁻¹⋅e_B - g_PB_Wᵀ⋅Aplus_WB.
+      const VectorUpTo6<T>& e_B = e_B_array[topology_.index];
+      auto x_B = x->segment(topology_.mobilizer_velocities_start_in_v, nv);
+      x_B = get_ldlt_D_B(abc).solve(e_B) -
+            get_g_PB_W(abc).transpose() * Aplus_WB.get_coeffs();
+      // A_WB = Aplus_WB + H_PB_W⋅x_B.
+      A_WB = SpatialAcceleration<T>(Aplus_WB.get_coeffs() + H_PB_W * x_B);
+    } else {
+      A_WB = Aplus_WB;
+    }
+  }
+
  protected:
   /// Returns the inboard frame F of this node's mobilizer.
   /// @throws std::runtime_error if called on the root node corresponding to
@@ -1222,6 +1360,32 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     return abc->get_mutable_Pplus_PB_W(topology_.index);
   }
 
+  /// Returns a const reference to the LDLT factorization `ldlt_D_B` of the
+  /// articulated body hinge inertia.
+  const Eigen::LDLT<MatrixUpTo6<T>>& get_ldlt_D_B(
+      const ArticulatedBodyInertiaCache<T>& abc) const {
+    return abc.get_ldlt_D_B(topology_.index);
+  }
+
+  /// Mutable version of get_ldlt_D_B().
+  Eigen::LDLT<MatrixUpTo6<T>>& get_mutable_ldlt_D_B(
+      ArticulatedBodyInertiaCache<T>* abc) const {
+    return abc->get_mutable_ldlt_D_B(topology_.index);
+  }
+
+  /// Returns a const reference to the Kalman gain `g_PB_W` of the articulated
+  /// body.
+  const Matrix6xUpTo6<T>& get_g_PB_W(
+      const ArticulatedBodyInertiaCache<T>& abc) const {
+    return abc.get_g_PB_W(topology_.index);
+  }
+
+  /// Mutable version of get_g_PB_W().
+  Matrix6xUpTo6<T>& get_mutable_g_PB_W(
+      ArticulatedBodyInertiaCache<T>* abc) const {
+    return abc->get_mutable_g_PB_W(topology_.index);
+  }
+
   // =========================================================================
   // Per Node Array Accessors.
   // Quantities are ordered by BodyNodeIndex unless otherwise specified.
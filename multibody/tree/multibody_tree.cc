@@ -1,8 +1,11 @@
 #include "drake/multibody/tree/multibody_tree.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <stdexcept>
+#include <thread>
+#include <type_traits>
 #include <unordered_set>
 #include <utility>
 
@@ -10,10 +13,12 @@
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_throw.h"
 #include "drake/common/eigen_types.h"
+#include "drake/math/rotation_matrix.h"
 #include "drake/multibody/tree/body_node_welded.h"
 #include "drake/multibody/tree/quaternion_floating_mobilizer.h"
 #include "drake/multibody/tree/rigid_body.h"
 #include "drake/multibody/tree/spatial_inertia.h"
+#include "drake/multibody/tree/weld_mobilizer.h"
 
 namespace drake {
 namespace multibody {
@@ -30,6 +35,75 @@ using internal::BodyNodeWelded;
 // pre-finalize.
 #define DRAKE_MBT_THROW_IF_NOT_FINALIZED() ThrowIfNotFinalized(__func__)
 
+namespace {
+
+// Applies `op` to every body node index in `nodes`, splitting the work over
+// up to `num_threads` threads (the calling thread plus spawned workers). The
+// nodes of a single level of the tree do not depend on each other's results,
+// which makes this level-scheduled dispatch safe for the base-to-tip and
+// tip-to-base sweeps below: each node only writes cache entries for itself
+// and only reads entries written by previous levels.
+// Workers are deliberately spawned per call rather than kept in a persistent
+// pool: the sweeps are const methods that hold no state between calls (see
+// the "Thread safety" notes in the System class documentation), and a pool
+// would be exactly the kind of shared mutable member that breaks concurrent
+// use of one tree from per-thread Contexts. The spawn cost is therefore part
+// of the deal: more than one thread only pays off for models whose levels
+// are wide enough -- dozens of bodies per level -- that the per-level work
+// dominates the tens of microseconds of thread start-up; for typical
+// serial-chain robots serial execution is faster. See
+// MultibodyTree::set_num_kinematics_threads().
+template <typename Op>
+void LevelScheduledForEach(int num_threads,
+                           const std::vector<BodyNodeIndex>& nodes,
+                           const Op& op) {
+  const int num_nodes = static_cast<int>(nodes.size());
+  if (num_threads <= 1 || num_nodes <= 1) {
+    for (BodyNodeIndex body_node_index : nodes) op(body_node_index);
+    return;
+  }
+  // Interleaved distribution of the level's nodes over the workers. The
+  // zeroth shard runs on the calling thread so that only num_workers - 1
+  // threads are spawned.
+  const int num_workers = std::min(num_threads, num_nodes);
+  std::vector<std::thread> workers;
+  workers.reserve(num_workers - 1);
+  for (int worker = 1; worker < num_workers; ++worker) {
+    workers.emplace_back([&nodes, num_nodes, num_workers, worker, &op]() {
+      for (int i = worker; i < num_nodes; i += num_workers) op(nodes[i]);
+    });
+  }
+  for (int i = 0; i < num_nodes; i += num_workers) op(nodes[i]);
+  for (auto& thread : workers) thread.join();
+}
+
+// Helper for the incremental position kinematics update below, true iff `a`
+// and `b` are bit-wise equal. Incremental reuse is only ever performed for
+// T = double; for any other scalar type the second overload is selected and
+// a full update is performed (AutoDiffXd derivatives and symbolic variables
+// are not inspected by this comparison, so reuse would be unsound).
+template <typename DerivedA, typename DerivedB>
+typename std::enable_if<
+    std::is_same<typename DerivedA::Scalar, double>::value &&
+        std::is_same<typename DerivedB::Scalar, double>::value,
+    bool>::type
+AreBitwiseEqual(const Eigen::MatrixBase<DerivedA>& a,
+                const Eigen::MatrixBase<DerivedB>& b) {
+  return (a.array() == b.array()).all();
+}
+
+template <typename DerivedA, typename DerivedB>
+typename std::enable_if<
+    !std::is_same<typename DerivedA::Scalar, double>::value ||
+        !std::is_same<typename DerivedB::Scalar, double>::value,
+    bool>::type
+AreBitwiseEqual(const Eigen::MatrixBase<DerivedA>&,
+                const Eigen::MatrixBase<DerivedB>&) {
+  return false;
+}
+
+}  // namespace
+
 template <typename T>
 class JointImplementationBuilder {
  public:
@@ -210,9 +284,54 @@ void MultibodyTree<T>::FinalizeInternals() {
     CreateBodyNode(body_node_index);
   }
 
+  CollapseWeldedBodies();
+
   CreateModelInstances();
 }
 
+template <typename T>
+void MultibodyTree<T>::CollapseWeldedBodies() {
+  X_CB_weld_pool_.assign(num_bodies(), Isometry3<T>::Identity());
+  X_PB_weld_pool_.assign(num_bodies(), Isometry3<T>::Identity());
+  X_FM_weld_pool_.assign(num_bodies(), Isometry3<T>::Identity());
+  // Body nodes are in BFT order, therefore the parent of a node (and in
+  // particular its weld-composite data, if the parent is itself welded) is
+  // processed before the node itself.
+  for (BodyNodeIndex node_index(1);
+       node_index < topology_.get_num_body_nodes(); ++node_index) {
+    const BodyNode<T>& node = *body_nodes_[node_index];
+    const BodyNodeTopology& node_topology = node.get_topology();
+    if (!node_topology.is_welded_to_composite()) continue;
+    // Weld mobilizers are the only zero-dof mobilizers in this
+    // implementation; their across-mobilizer transform X_FM is constant.
+    const auto* weld_mobilizer =
+        dynamic_cast<const WeldMobilizer<T>*>(&node.get_mobilizer());
+    DRAKE_DEMAND(weld_mobilizer != nullptr);
+    const Isometry3<T> X_FM =
+        weld_mobilizer->get_X_FM().template cast<T>();
+    // The inboard/outboard frames of a weld mobilizer have a fixed pose in
+    // their respective bodies, so the pose X_PB of body B in its parent P is
+    // constant and can be precomputed here.
+    const Isometry3<T> X_PF =
+        weld_mobilizer->inboard_frame().GetFixedPoseInBodyFrame();
+    const Isometry3<T> X_BM =
+        weld_mobilizer->outboard_frame().GetFixedPoseInBodyFrame();
+    const Isometry3<T> X_PB = X_PF * X_FM * X_BM.inverse();
+    X_FM_weld_pool_[node_index] = X_FM;
+    X_PB_weld_pool_[node_index] = X_PB;
+    // Compose with the parent's pose in the composite body frame C. If the
+    // parent is not welded then it is the composite body itself.
+    const BodyNodeTopology& parent_topology =
+        topology_.get_body_node(node_topology.parent_body_node);
+    if (parent_topology.is_welded_to_composite()) {
+      X_CB_weld_pool_[node_index] =
+          X_CB_weld_pool_[parent_topology.index] * X_PB;
+    } else {
+      X_CB_weld_pool_[node_index] = X_PB;
+    }
+  }
+}
+
 template <typename T>
 void MultibodyTree<T>::Finalize() {
   DRAKE_MBT_THROW_IF_FINALIZED();
@@ -493,21 +612,74 @@ void MultibodyTree<T>::CalcPositionKinematicsCache(
   // Notice this loop can be performed in any order and each X_BQ(qf_B) is
   // independent of all others. This could even be performed in parallel.
 
+  // When `pc` holds the results of a previous update, only the subtrees
+  // rooted at mobilizers whose positions changed need to be recomputed; the
+  // cached poses of all other nodes are still valid. A node must be updated
+  // iff its own mobilizer's positions changed or its parent was updated.
+  // Since the comparison against the previous positions is bit-wise, skipped
+  // nodes hold exactly the poses a full update would compute.
+  const auto q = mbt_context.get_positions();
+  const VectorX<T>& q_last = pc->last_update_positions();
+  const bool incremental = (q_last.size() == q.size());
+  // Indexed by BodyNodeIndex; the world (node 0) is never updated.
+  std::vector<char> node_needs_update(num_bodies(), 1);
+  if (incremental) {
+    // The world's pose never changes.
+    node_needs_update[world_index()] = 0;
+    for (int level = 1; level < tree_height(); ++level) {
+      for (BodyNodeIndex body_node_index : body_node_levels_[level]) {
+        const BodyNodeTopology& node_topology =
+            get_topology().get_body_node(body_node_index);
+        bool needs_update = node_needs_update[node_topology.parent_body_node];
+        if (!needs_update && node_topology.num_mobilizer_positions > 0) {
+          needs_update = !AreBitwiseEqual(
+              q.segment(node_topology.mobilizer_positions_start,
+                        node_topology.num_mobilizer_positions),
+              q_last.segment(node_topology.mobilizer_positions_start,
+                             node_topology.num_mobilizer_positions));
+        }
+        node_needs_update[body_node_index] = needs_update;
+      }
+    }
+  }
+
   // With the kinematics information across mobilizer's and the kinematics
   // information for each body, we are now in position to perform a base-to-tip
   // recursion to update world positions and parent to child body transforms.
   // This skips the world, level = 0.
   for (int level = 1; level < tree_height(); ++level) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[level]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
-
-      DRAKE_ASSERT(node.get_topology().level == level);
-      DRAKE_ASSERT(node.index() == body_node_index);
-
-      // Update per-node kinematics.
-      node.CalcPositionKinematicsCache_BaseToTip(mbt_context, pc);
-    }
+    LevelScheduledForEach(
+        num_kinematics_threads_, body_node_levels_[level],
+        [&](BodyNodeIndex body_node_index) {
+          if (!node_needs_update[body_node_index]) return;
+
+          const BodyNode<T>& node = *body_nodes_[body_node_index];
+
+          DRAKE_ASSERT(node.get_topology().level == level);
+          DRAKE_ASSERT(node.index() == body_node_index);
+
+          // A welded node is carried rigidly by its composite body C, whose
+          // pose was already updated at a lower level. Its constant
+          // transforms were precomputed at Finalize() time, see
+          // CollapseWeldedBodies().
+          const BodyNodeTopology& node_topology = node.get_topology();
+          if (node_topology.is_welded_to_composite()) {
+            pc->get_mutable_X_FM(body_node_index) =
+                X_FM_weld_pool_[body_node_index];
+            pc->get_mutable_X_PB(body_node_index) =
+                X_PB_weld_pool_[body_node_index];
+            pc->get_mutable_X_WB(body_node_index) =
+                pc->get_X_WB(node_topology.composite_body_node) *
+                X_CB_weld_pool_[body_node_index];
+            return;
+          }
+
+          // Update per-node kinematics.
+          node.CalcPositionKinematicsCache_BaseToTip(mbt_context, pc);
+        });
   }
+
+  pc->set_last_update_positions(q);
 }
 
 template <typename T>
@@ -528,25 +700,44 @@ void MultibodyTree<T>::CalcVelocityKinematicsCache(
   // Performs a base-to-tip recursion computing body velocities.
   // This skips the world, depth = 0.
   for (int depth = 1; depth < tree_height(); ++depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
-
-      DRAKE_ASSERT(node.get_topology().level == depth);
-      DRAKE_ASSERT(node.index() == body_node_index);
-
-      // Jacobian matrix for this node. H_PB_W ∈ ℝ⁶ˣⁿᵐ with nm ∈ [0; 6] the
-      // number of mobilities for this node. Therefore, the return is a
-      // MatrixUpTo6 since the number of columns generally changes with the
-      // node.
-      // It is returned as an Eigen::Map to the memory allocated in the
-      // std::vector H_PB_W_cache so that we can work with H_PB_W as with any
-      // other Eigen matrix object.
-      Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
-          node.GetJacobianFromArray(H_PB_W_cache);
-
-      // Update per-node kinematics.
-      node.CalcVelocityKinematicsCache_BaseToTip(mbt_context, pc, H_PB_W, vc);
-    }
+    LevelScheduledForEach(
+        num_kinematics_threads_, body_node_levels_[depth],
+        [&](BodyNodeIndex body_node_index) {
+          const BodyNode<T>& node = *body_nodes_[body_node_index];
+
+          DRAKE_ASSERT(node.get_topology().level == depth);
+          DRAKE_ASSERT(node.index() == body_node_index);
+
+          // A welded node moves rigidly with its composite body C; its
+          // spatial velocity is a plain rigid shift of the composite body's.
+          const BodyNodeTopology& node_topology = node.get_topology();
+          if (node_topology.is_welded_to_composite()) {
+            const BodyNodeIndex composite_node =
+                node_topology.composite_body_node;
+            const Vector3<T> p_CoBo_W =
+                pc.get_X_WB(body_node_index).translation() -
+                pc.get_X_WB(composite_node).translation();
+            vc->get_mutable_V_FM(body_node_index).SetZero();
+            vc->get_mutable_V_PB_W(body_node_index).SetZero();
+            vc->get_mutable_V_WB(body_node_index) =
+                vc->get_V_WB(composite_node).Shift(p_CoBo_W);
+            return;
+          }
+
+          // Jacobian matrix for this node. H_PB_W ∈ ℝ⁶ˣⁿᵐ with nm ∈ [0; 6]
+          // the number of mobilities for this node. Therefore, the return is
+          // a MatrixUpTo6 since the number of columns generally changes with
+          // the node.
+          // It is returned as an Eigen::Map to the memory allocated in the
+          // std::vector H_PB_W_cache so that we can work with H_PB_W as with
+          // any other Eigen matrix object.
+          Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+              node.GetJacobianFromArray(H_PB_W_cache);
+
+          // Update per-node kinematics.
+          node.CalcVelocityKinematicsCache_BaseToTip(
+              mbt_context, pc, H_PB_W, vc);
+        });
   }
 }
 
@@ -574,16 +765,33 @@ void MultibodyTree<T>::CalcSpatialAccelerationsFromVdot(
   // Performs a base-to-tip recursion computing body accelerations.
   // This skips the world, depth = 0.
   for (int depth = 1; depth < tree_height(); ++depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
-
-      DRAKE_ASSERT(node.get_topology().level == depth);
-      DRAKE_ASSERT(node.index() == body_node_index);
-
-      // Update per-node kinematics.
-      node.CalcSpatialAcceleration_BaseToTip(
-          mbt_context, pc, vc, known_vdot, A_WB_array);
-    }
+    LevelScheduledForEach(
+        num_kinematics_threads_, body_node_levels_[depth],
+        [&](BodyNodeIndex body_node_index) {
+          const BodyNode<T>& node = *body_nodes_[body_node_index];
+
+          DRAKE_ASSERT(node.get_topology().level == depth);
+          DRAKE_ASSERT(node.index() == body_node_index);
+
+          // A welded node moves rigidly with its composite body C; its
+          // spatial acceleration is a rigid shift of the composite body's.
+          const BodyNodeTopology& node_topology = node.get_topology();
+          if (node_topology.is_welded_to_composite()) {
+            const BodyNodeIndex composite_node =
+                node_topology.composite_body_node;
+            const Vector3<T> p_CoBo_W =
+                pc.get_X_WB(body_node_index).translation() -
+                pc.get_X_WB(composite_node).translation();
+            const Vector3<T>& w_WC = vc.get_V_WB(composite_node).rotational();
+            (*A_WB_array)[body_node_index] =
+                (*A_WB_array)[composite_node].Shift(p_CoBo_W, w_WC);
+            return;
+          }
+
+          // Update per-node kinematics.
+          node.CalcSpatialAcceleration_BaseToTip(
+              mbt_context, pc, vc, known_vdot, A_WB_array);
+        });
   }
 }
 
@@ -605,6 +813,144 @@ void MultibodyTree<T>::CalcAccelerationKinematicsCache(
   CalcSpatialAccelerationsFromVdot(context, pc, vc, known_vdot, &A_WB_array);
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcBatchInverseDynamics(
+    const Eigen::Ref<const MatrixX<T>>& q_batch,
+    const Eigen::Ref<const MatrixX<T>>& v_batch,
+    const Eigen::Ref<const MatrixX<T>>& vdot_batch,
+    int num_threads,
+    EigenPtr<MatrixX<T>> tau_batch) const {
+  DRAKE_MBT_THROW_IF_NOT_FINALIZED();
+  DRAKE_THROW_UNLESS(num_threads > 0);
+  DRAKE_THROW_UNLESS(tau_batch != nullptr);
+  const int num_samples = static_cast<int>(q_batch.cols());
+  DRAKE_THROW_UNLESS(q_batch.rows() == num_positions());
+  DRAKE_THROW_UNLESS(v_batch.rows() == num_velocities() &&
+                     v_batch.cols() == num_samples);
+  DRAKE_THROW_UNLESS(vdot_batch.rows() == num_velocities() &&
+                     vdot_batch.cols() == num_samples);
+  DRAKE_THROW_UNLESS(tau_batch->rows() == num_velocities() &&
+                     tau_batch->cols() == num_samples);
+  if (num_samples == 0) return;
+
+  // Each worker processes a contiguous range [start, end) of samples reusing
+  // a single scratch context and a single set of kinematics caches and
+  // inverse dynamics temporaries across all of its samples. Workers never
+  // share state; each writes only its own columns of tau_batch.
+  auto process_samples = [&](int start, int end) {
+    std::unique_ptr<systems::LeafContext<T>> context = CreateDefaultContext();
+    PositionKinematicsCache<T> pc(get_topology());
+    VelocityKinematicsCache<T> vc(get_topology());
+    std::vector<SpatialAcceleration<T>> A_WB_array(num_bodies());
+    std::vector<SpatialForce<T>> F_BMo_W_array(num_bodies());
+    VectorX<T> vdot(num_velocities());
+    VectorX<T> tau(num_velocities());
+    for (int i = start; i < end; ++i) {
+      auto x = GetMutablePositionsAndVelocities(context.get());
+      x.head(num_positions()) = q_batch.col(i);
+      x.tail(num_velocities()) = v_batch.col(i);
+      CalcPositionKinematicsCache(*context, &pc);
+      CalcVelocityKinematicsCache(*context, pc, &vc);
+      vdot = vdot_batch.col(i);
+      // No externally applied forces; Fapplied_Bo_W_array and
+      // tau_applied_array are empty.
+      CalcInverseDynamics(*context, pc, vc, vdot, {}, VectorX<T>(),
+                          &A_WB_array, &F_BMo_W_array, &tau);
+      tau_batch->col(i) = tau;
+    }
+  };
+
+  const int num_workers = std::min(num_threads, num_samples);
+  if (num_workers == 1) {
+    process_samples(0, num_samples);
+    return;
+  }
+  // Tile the batch into near-equal contiguous ranges, one per worker.
+  std::vector<std::thread> workers;
+  workers.reserve(num_workers);
+  const int quotient = num_samples / num_workers;
+  const int remainder = num_samples % num_workers;
+  int start = 0;
+  for (int worker = 0; worker < num_workers; ++worker) {
+    const int count = quotient + (worker < remainder ? 1 : 0);
+    workers.emplace_back(process_samples, start, start + count);
+    start += count;
+  }
+  DRAKE_DEMAND(start == num_samples);
+  for (auto& thread : workers) thread.join();
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcInverseDynamicsPartials(
+    const systems::Context<T>& context,
+    const VectorX<T>& known_vdot,
+    EigenPtr<MatrixX<T>> dtau_dq,
+    EigenPtr<MatrixX<T>> dtau_dv,
+    EigenPtr<MatrixX<T>> dtau_dvdot) const {
+  DRAKE_MBT_THROW_IF_NOT_FINALIZED();
+  const int nq = num_positions();
+  const int nv = num_velocities();
+  DRAKE_THROW_UNLESS(known_vdot.size() == nv);
+  DRAKE_THROW_UNLESS(dtau_dq != nullptr &&
+                     dtau_dq->rows() == nv && dtau_dq->cols() == nq);
+  DRAKE_THROW_UNLESS(dtau_dv != nullptr &&
+                     dtau_dv->rows() == nv && dtau_dv->cols() == nv);
+  DRAKE_THROW_UNLESS(dtau_dvdot != nullptr &&
+                     dtau_dvdot->rows() == nv && dtau_dvdot->cols() == nv);
+
+  // The partial with respect to v̇ is exactly the mass matrix; compute it
+  // analytically with the Composite Rigid Body Algorithm.
+  CalcMassMatrix(context, dtau_dvdot);
+
+  // Scratch context and temporaries reused across all the perturbed
+  // evaluations below.
+  std::unique_ptr<systems::LeafContext<T>> context_prime =
+      CreateDefaultContext();
+  PositionKinematicsCache<T> pc(get_topology());
+  VelocityKinematicsCache<T> vc(get_topology());
+  std::vector<SpatialAcceleration<T>> A_WB_array(num_bodies());
+  std::vector<SpatialForce<T>> F_BMo_W_array(num_bodies());
+  VectorX<T> tau_plus(nv), tau_minus(nv);
+
+  const VectorX<T> x0 = GetPositionsAndVelocities(context);
+
+  // Computes inverse dynamics at the state currently stored in context_prime
+  // with no externally applied forces.
+  auto calc_inverse_dynamics = [&](VectorX<T>* tau) {
+    CalcPositionKinematicsCache(*context_prime, &pc);
+    CalcVelocityKinematicsCache(*context_prime, pc, &vc);
+    CalcInverseDynamics(*context_prime, pc, vc, known_vdot, {}, VectorX<T>(),
+                        &A_WB_array, &F_BMo_W_array, tau);
+  };
+
+  // Sets the scratch state to x0 with its j-th entry replaced by value.
+  // The state is written through the context so that stale cache entries,
+  // e.g. the across-node Jacobian H_PB_W, get invalidated.
+  auto set_perturbed_state = [&](int j, const T& value) {
+    auto x = GetMutablePositionsAndVelocities(context_prime.get());
+    x = x0;
+    x(j) = value;
+  };
+
+  // Step size for the O(h²) central differences, scaled per coordinate.
+  using std::abs;
+  using std::max;
+  const double cbrt_eps = std::cbrt(std::numeric_limits<double>::epsilon());
+  for (int j = 0; j < nq + nv; ++j) {
+    const T& xj = x0(j);
+    const T h = cbrt_eps * max(T(1.0), abs(xj));
+    set_perturbed_state(j, xj + h);
+    calc_inverse_dynamics(&tau_plus);
+    set_perturbed_state(j, xj - h);
+    calc_inverse_dynamics(&tau_minus);
+    if (j < nq) {
+      dtau_dq->col(j) = (tau_plus - tau_minus) / (2.0 * h);
+    } else {
+      dtau_dv->col(j - nq) = (tau_plus - tau_minus) / (2.0 * h);
+    }
+  }
+}
+
 template <typename T>
 VectorX<T> MultibodyTree<T>::CalcInverseDynamics(
     const systems::Context<T>& context,
@@ -813,6 +1159,114 @@ void MultibodyTree<T>::DoCalcMassMatrixViaInverseDynamics(
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcMassMatrix(
+    const systems::Context<T>& context, EigenPtr<MatrixX<T>> H) const {
+  DRAKE_DEMAND(H != nullptr);
+  DRAKE_DEMAND(H->rows() == num_velocities());
+  DRAKE_DEMAND(H->cols() == num_velocities());
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  DoCalcMassMatrix(context, pc, H);
+}
+
+template <typename T>
+void MultibodyTree<T>::DoCalcMassMatrix(
+    const systems::Context<T>& context,
+    const PositionKinematicsCache<T>& pc,
+    EigenPtr<MatrixX<T>> H) const {
+  // The algorithm below is the Composite Rigid Body Algorithm, see
+  // [Featherstone, 2008, §6.2], formulated with all quantities expressed in
+  // the world frame W so that we can reuse the hinge matrices H_PB_W already
+  // available in the cache.
+  const auto& mbt_context =
+      dynamic_cast<const MultibodyTreeContext<T>&>(context);
+
+  const std::vector<Vector6<T>>& H_PB_W_cache =
+      tree_system_->EvalAcrossNodeGeometricJacobianExpressedInWorld(context);
+
+  // Compute the composite body inertia Mc_B_W of the subtree rooted at each
+  // body B, about Bo and expressed in W, with a single tip-to-base sweep.
+  // The world's entry is left uninitialized; it is never used below.
+  std::vector<SpatialInertia<T>> Mc_B_W_all(num_bodies());
+  for (int depth = tree_height() - 1; depth > 0; --depth) {
+    for (BodyNodeIndex node_index : body_node_levels_[depth]) {
+      const BodyNode<T>& node = *body_nodes_[node_index];
+      const Isometry3<T>& X_WB = pc.get_X_WB(node_index);
+      // Spatial inertia of body B about Bo, expressed in W.
+      SpatialInertia<T>& Mc_B_W = Mc_B_W_all[node_index];
+      Mc_B_W =
+          node.body().CalcSpatialInertiaInBodyFrame(mbt_context).ReExpress(
+              math::RotationMatrix<T>(X_WB.linear()));
+      // Shift and accumulate the composite inertias of the children, which
+      // were already computed in this tip-to-base sweep.
+      for (BodyNodeIndex child_index : node.get_topology().child_nodes) {
+        const Vector3<T> p_CoBo_W =
+            X_WB.translation() - pc.get_X_WB(child_index).translation();
+        Mc_B_W += Mc_B_W_all[child_index].Shift(p_CoBo_W);
+      }
+    }
+  }
+
+  // Fill in the mass matrix, one block of columns per body node B. The
+  // diagonal block is H_PB_Wᵀ⋅Mc_B_W⋅H_PB_W. Off-diagonal blocks couple B
+  // with each of its ancestors and are obtained by shifting the spatial
+  // forces Fm = Mc_B_W⋅H_PB_W up the path from B to the world.
+  H->setZero();
+  // Spatial forces, one column per mobility of the node being processed.
+  Eigen::Matrix<T, 6, Eigen::Dynamic, 0, 6, 6> Fm_CBo_W(6, 6);
+  for (int depth = tree_height() - 1; depth > 0; --depth) {
+    for (BodyNodeIndex node_index : body_node_levels_[depth]) {
+      const BodyNode<T>& node = *body_nodes_[node_index];
+      const BodyNodeTopology& node_topology = node.get_topology();
+      const int B_start = node_topology.mobilizer_velocities_start_in_v;
+      const int B_nv = node_topology.num_mobilizer_velocities;
+      if (B_nv == 0) continue;  // Skip welded bodies.
+
+      Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+          node.GetJacobianFromArray(H_PB_W_cache);
+      Fm_CBo_W.resize(6, B_nv);
+      for (int m = 0; m < B_nv; ++m) {
+        // Unit spatial acceleration along the m-th mobility of this node.
+        const SpatialAcceleration<T> Am_WB(H_PB_W.col(m));
+        Fm_CBo_W.col(m) = (Mc_B_W_all[node_index] * Am_WB).get_coeffs();
+      }
+
+      // Diagonal block corresponding to the mobilities of body B.
+      H->block(B_start, B_start, B_nv, B_nv).noalias() =
+          H_PB_W.transpose() * Fm_CBo_W;
+
+      // Walk up to the world filling in the off-diagonal blocks that couple
+      // body B with each ancestor body P along the way.
+      const BodyNodeTopology* child_topology = &node_topology;
+      while (child_topology->parent_body_node.is_valid() &&
+             child_topology->level > 1) {
+        const BodyNodeIndex parent_index = child_topology->parent_body_node;
+        const BodyNode<T>& parent_node = *body_nodes_[parent_index];
+        const BodyNodeTopology& parent_topology = parent_node.get_topology();
+        // Shift the spatial forces to be about the parent body's origin Po.
+        const Vector3<T> p_CoPo_W =
+            pc.get_X_WB(parent_index).translation() -
+            pc.get_X_WB(child_topology->index).translation();
+        for (int m = 0; m < B_nv; ++m) {
+          Fm_CBo_W.col(m) =
+              SpatialForce<T>(Fm_CBo_W.col(m)).Shift(p_CoPo_W).get_coeffs();
+        }
+        const int P_nv = parent_topology.num_mobilizer_velocities;
+        if (P_nv > 0) {
+          const int P_start = parent_topology.mobilizer_velocities_start_in_v;
+          Eigen::Map<const MatrixUpTo6<T>> H_GP_W =
+              parent_node.GetJacobianFromArray(H_PB_W_cache);
+          H->block(P_start, B_start, P_nv, B_nv).noalias() =
+              H_GP_W.transpose() * Fm_CBo_W;
+          H->block(B_start, P_start, B_nv, P_nv) =
+              H->block(P_start, B_start, P_nv, B_nv).transpose();
+        }
+        child_topology = &parent_topology;
+      }
+    }
+  }
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcBiasTerm(
     const systems::Context<T>& context, EigenPtr<VectorX<T>> Cv) const {
@@ -834,22 +1288,73 @@ VectorX<T> MultibodyTree<T>::CalcGravityGeneralizedForces(
   return VectorX<T>::Zero(num_velocities());
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcBiasTerm(
+    const systems::Context<T>& context,
+    std::vector<SpatialAcceleration<T>>* Ab_WB_scratch,
+    std::vector<SpatialForce<T>>* F_BMo_W_scratch,
+    EigenPtr<VectorX<T>> Cv) const {
+  DRAKE_DEMAND(Cv != nullptr);
+  DRAKE_DEMAND(Cv->rows() == num_velocities());
+  DRAKE_DEMAND(Cv->cols() == 1);
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  const VelocityKinematicsCache<T>& vc = EvalVelocityKinematics(context);
+  DoCalcBiasTerm(context, pc, vc, Ab_WB_scratch, F_BMo_W_scratch, Cv);
+}
+
 template <typename T>
 void MultibodyTree<T>::DoCalcBiasTerm(
     const systems::Context<T>& context,
     const PositionKinematicsCache<T>& pc,
     const VelocityKinematicsCache<T>& vc,
     EigenPtr<VectorX<T>> Cv) const {
-  const int nv = num_velocities();
-  const VectorX<T> vdot = VectorX<T>::Zero(nv);
-
-  // Auxiliary arrays used by inverse dynamics.
-  std::vector<SpatialAcceleration<T>> A_WB_array(num_bodies());
+  // Auxiliary arrays used by the bias term kernel.
+  std::vector<SpatialAcceleration<T>> Ab_WB_array(num_bodies());
   std::vector<SpatialForce<T>> F_BMo_W_array(num_bodies());
+  DoCalcBiasTerm(context, pc, vc, &Ab_WB_array, &F_BMo_W_array, Cv);
+}
 
-  // TODO(amcastro-tri): provide specific API for when vdot = 0.
-  CalcInverseDynamics(context, pc, vc, vdot, {}, VectorX<T>(),
-                      &A_WB_array, &F_BMo_W_array, Cv);
+template <typename T>
+void MultibodyTree<T>::DoCalcBiasTerm(
+    const systems::Context<T>& context,
+    const PositionKinematicsCache<T>& pc,
+    const VelocityKinematicsCache<T>& vc,
+    std::vector<SpatialAcceleration<T>>* Ab_WB_scratch,
+    std::vector<SpatialForce<T>>* F_BMo_W_scratch,
+    EigenPtr<VectorX<T>> Cv) const {
+  DRAKE_DEMAND(Ab_WB_scratch != nullptr);
+  DRAKE_DEMAND(F_BMo_W_scratch != nullptr);
+  Ab_WB_scratch->resize(num_bodies());
+  F_BMo_W_scratch->resize(num_bodies());
+
+  const auto& mbt_context =
+      dynamic_cast<const MultibodyTreeContext<T>&>(context);
+
+  // With v̇ = 0 the base-to-tip acceleration sweep yields exactly the bias
+  // spatial accelerations Ab_WB(q, v) = J̇_WB⋅v.
+  const VectorX<T> vdot = VectorX<T>::Zero(num_velocities());
+  CalcSpatialAccelerationsFromVdot(context, pc, vc, vdot, Ab_WB_scratch);
+
+  // Tip-to-base force sweep. With no applied forces the total force on each
+  // body reduces to the inertial reaction to its bias acceleration plus its
+  // velocity dependent gyroscopic terms; the projection of these forces onto
+  // the mobilizer motion sub-spaces is exactly C(q, v)v. Unlike
+  // CalcInverseDynamics(), no applied force bookkeeping is performed.
+  const SpatialForce<T> Fapplied_Bo_W = SpatialForce<T>::Zero();
+  const VectorX<T> tau_applied;  // Zero size; no applied generalized forces.
+  for (int depth = tree_height() - 1; depth >= 0; --depth) {
+    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
+      const BodyNode<T>& node = *body_nodes_[body_node_index];
+
+      DRAKE_ASSERT(node.get_topology().level == depth);
+      DRAKE_ASSERT(node.index() == body_node_index);
+
+      node.CalcInverseDynamics_TipToBase(
+          mbt_context, pc, vc, *Ab_WB_scratch,
+          Fapplied_Bo_W, tau_applied,
+          F_BMo_W_scratch, Cv);
+    }
+  }
 }
 
 template <typename T>
@@ -917,6 +1422,9 @@ void MultibodyTree<T>::CalcAcrossNodeGeometricJacobianExpressedInWorld(
        node_index < num_bodies(); ++node_index) {
     const BodyNode<T>& node = *body_nodes_[node_index];
 
+    // Welded nodes have no mobilities and therefore no Jacobian columns.
+    if (node.get_topology().is_welded_to_composite()) continue;
+
     // Jacobian matrix for this node. H_PB_W ∈ ℝ⁶ˣⁿᵐ with nm ∈ [0; 6] the number
     // of mobilities for this node. Therefore, the return is a MatrixUpTo6 since
     // the number of columns generally changes with the node.
@@ -982,7 +1490,24 @@ VectorX<T> MultibodyTree<T>::CalcBiasForPointsGeometricJacobianExpressedInWorld(
     const systems::Context<T>& context,
     const Frame<T>& frame_F,
     const Eigen::Ref<const MatrixX<T>>& p_FP_list) const {
+  std::vector<SpatialAcceleration<T>> A_WB_scratch(num_bodies());
+  VectorX<T> Ab_WFp(3 * p_FP_list.cols());
+  CalcBiasForPointsGeometricJacobianExpressedInWorld(
+      context, frame_F, p_FP_list, &A_WB_scratch, &Ab_WFp);
+  return Ab_WFp;
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcBiasForPointsGeometricJacobianExpressedInWorld(
+    const systems::Context<T>& context,
+    const Frame<T>& frame_F,
+    const Eigen::Ref<const MatrixX<T>>& p_FP_list,
+    std::vector<SpatialAcceleration<T>>* A_WB_scratch,
+    EigenPtr<VectorX<T>> Ab_WFp) const {
   DRAKE_THROW_UNLESS(p_FP_list.rows() == 3);
+  DRAKE_THROW_UNLESS(A_WB_scratch != nullptr);
+  DRAKE_THROW_UNLESS(Ab_WFp != nullptr);
+  DRAKE_THROW_UNLESS(Ab_WFp->size() == 3 * p_FP_list.cols());
 
   const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
   const VelocityKinematicsCache<T>& vc = EvalVelocityKinematics(context);
@@ -1011,19 +1536,16 @@ VectorX<T> MultibodyTree<T>::CalcBiasForPointsGeometricJacobianExpressedInWorld(
   // Where the body bias terms is defined s.t. A_WB = J_WB⋅v̇ + Ab_WB or,
   // Ab_WB = J̇_WB⋅v
 
-  std::vector<SpatialAcceleration<T>> A_WB_array(num_bodies());
+  A_WB_scratch->resize(num_bodies());
   const VectorX<T> vdot = VectorX<T>::Zero(num_velocities());
-  CalcSpatialAccelerationsFromVdot(context, pc, vc, vdot, &A_WB_array);
+  CalcSpatialAccelerationsFromVdot(context, pc, vc, vdot, A_WB_scratch);
 
   const Body<T>& body_B = frame_F.body();
   // Bias for body B spatial acceleration.
-  const SpatialAcceleration<T>& Ab_WB = A_WB_array[body_B.node_index()];
+  const SpatialAcceleration<T>& Ab_WB = (*A_WB_scratch)[body_B.node_index()];
 
   const int num_points = p_FP_list.cols();
 
-  // Allocate output vector.
-  VectorX<T> Ab_WB_array(3 * num_points);
-
   for (int ipoint = 0; ipoint < num_points; ++ipoint) {
     const Vector3<T> p_FPi = p_FP_list.col(ipoint);
 
@@ -1042,10 +1564,8 @@ VectorX<T> MultibodyTree<T>::CalcBiasForPointsGeometricJacobianExpressedInWorld(
     const SpatialAcceleration<T> Ab_WBp = Ab_WB.Shift(p_BPi_W, w_WB);
 
     // Output translational component only.
-    Ab_WB_array.template segment<3>(3 * ipoint) = Ab_WBp.translational();
+    Ab_WFp->template segment<3>(3 * ipoint) = Ab_WBp.translational();
   }
-
-  return Ab_WB_array;
 }
 
 template <typename T>
@@ -1103,6 +1623,19 @@ void MultibodyTree<T>::CalcJacobianSpatialVelocity(
     const Frame<T>& frame_B, const Eigen::Ref<const Vector3<T>>& p_BP,
     const Frame<T>& frame_A, const Frame<T>& frame_E,
     EigenPtr<MatrixX<T>> Jw_V_ABp_E) const {
+  MatrixX<T> Jw_WAp_scratch;
+  CalcJacobianSpatialVelocity(context, with_respect_to, frame_B, p_BP,
+                              frame_A, frame_E, &Jw_WAp_scratch, Jw_V_ABp_E);
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcJacobianSpatialVelocity(
+    const systems::Context<T>& context, JacobianWrtVariable with_respect_to,
+    const Frame<T>& frame_B, const Eigen::Ref<const Vector3<T>>& p_BP,
+    const Frame<T>& frame_A, const Frame<T>& frame_E,
+    MatrixX<T>* Jw_WAp_scratch,
+    EigenPtr<MatrixX<T>> Jw_V_ABp_E) const {
+  DRAKE_THROW_UNLESS(Jw_WAp_scratch != nullptr);
   DRAKE_THROW_UNLESS(Jw_V_ABp_E != nullptr);
   DRAKE_THROW_UNLESS(Jw_V_ABp_E->rows() == 6);
   const bool wrt_qdot = [with_respect_to]() {
@@ -1136,21 +1669,24 @@ void MultibodyTree<T>::CalcJacobianSpatialVelocity(
   // TODO(amcastro-tri): When performance becomes an issue, implement this
   // method so that we only consider the kinematic path from A to B.
 
-  MatrixX<T> Jw_WAp(6, num_columns);
+  // Frame A's Jacobian goes into the caller-provided scratch; a no-op resize
+  // once the scratch reached its steady-state size.
+  MatrixX<T>& Jw_WAp = *Jw_WAp_scratch;
+  Jw_WAp.resize(6, num_columns);
   auto Jr_WAp = Jw_WAp.template topRows<3>();     // rotational part.
   auto Jt_WAp = Jw_WAp.template bottomRows<3>();  // translational part.
   CalcFrameJacobianExpressedInWorld(context, frame_A, p_WP, wrt_qdot, &Jr_WAp,
                                     &Jt_WAp);
 
-  MatrixX<T> Jw_WBp(6, num_columns);
-  auto Jr_WBp = Jw_WBp.template topRows<3>();     // rotational part.
-  auto Jt_WBp = Jw_WBp.template bottomRows<3>();  // translational part.
+  // Frame B's Jacobian is computed directly into the output.
+  auto Jr_WBp = Jw_V_ABp_E->template topRows<3>();     // rotational part.
+  auto Jt_WBp = Jw_V_ABp_E->template bottomRows<3>();  // translational part.
   CalcFrameJacobianExpressedInWorld(context, frame_B, p_WP, wrt_qdot, &Jr_WBp,
                                     &Jt_WBp);
 
   // Jacobian Jw_ABp_W when E is the world frame W.
-  Jw_V_ABp_E->template topRows<3>() = Jr_WBp - Jr_WAp;
-  Jw_V_ABp_E->template bottomRows<3>() = Jt_WBp - Jt_WAp;
+  Jw_V_ABp_E->template topRows<3>() -= Jr_WAp;
+  Jw_V_ABp_E->template bottomRows<3>() -= Jt_WAp;
 
   // If the expressed-in frame E is not the world frame, we need to perform
   // an additional operation.
@@ -1169,6 +1705,17 @@ template <typename T>
 Vector6<T> MultibodyTree<T>::CalcBiasForFrameGeometricJacobianExpressedInWorld(
     const systems::Context<T>& context,
     const Frame<T>& frame_F, const Eigen::Ref<const Vector3<T>>& p_FP) const {
+  std::vector<SpatialAcceleration<T>> A_WB_scratch(num_bodies());
+  return CalcBiasForFrameGeometricJacobianExpressedInWorld(
+      context, frame_F, p_FP, &A_WB_scratch);
+}
+
+template <typename T>
+Vector6<T> MultibodyTree<T>::CalcBiasForFrameGeometricJacobianExpressedInWorld(
+    const systems::Context<T>& context,
+    const Frame<T>& frame_F, const Eigen::Ref<const Vector3<T>>& p_FP,
+    std::vector<SpatialAcceleration<T>>* A_WB_scratch) const {
+  DRAKE_THROW_UNLESS(A_WB_scratch != nullptr);
   const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
   const VelocityKinematicsCache<T>& vc = EvalVelocityKinematics(context);
 
@@ -1196,13 +1743,13 @@ Vector6<T> MultibodyTree<T>::CalcBiasForFrameGeometricJacobianExpressedInWorld(
   // Where the body bias terms is defined s.t. A_WB = J_WB⋅v̇ + Ab_WB or,
   // Ab_WB = J̇_WB⋅v
 
-  std::vector<SpatialAcceleration<T>> A_WB_array(num_bodies());
+  A_WB_scratch->resize(num_bodies());
   const VectorX<T> vdot = VectorX<T>::Zero(num_velocities());
-  CalcSpatialAccelerationsFromVdot(context, pc, vc, vdot, &A_WB_array);
+  CalcSpatialAccelerationsFromVdot(context, pc, vc, vdot, A_WB_scratch);
 
   const Body<T>& body_B = frame_F.body();
   // Bias for body B spatial acceleration.
-  const SpatialAcceleration<T>& Ab_WB = A_WB_array[body_B.node_index()];
+  const SpatialAcceleration<T>& Ab_WB = (*A_WB_scratch)[body_B.node_index()];
 
   // Body B's orientation.
   const Matrix3<T>& R_WB = pc.get_X_WB(body_B.node_index()).linear();
@@ -1453,6 +2000,56 @@ void MultibodyTree<T>::CalcArticulatedBodyInertiaCache(
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::SolveMassMatrixViaArticulatedBodyAlgorithm(
+    const systems::Context<T>& context,
+    const Eigen::Ref<const VectorX<T>>& b,
+    EigenPtr<VectorX<T>> x) const {
+  DRAKE_DEMAND(x != nullptr);
+  DRAKE_DEMAND(b.size() == num_velocities());
+  DRAKE_DEMAND(x->size() == num_velocities());
+
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  const std::vector<Vector6<T>>& H_PB_W_cache =
+      tree_system_->EvalAcrossNodeGeometricJacobianExpressedInWorld(context);
+
+  // TODO(amcastro-tri): Make the articulated body inertia cache an actual
+  // cache entry in MultibodyTreeSystem so that it is only recomputed when the
+  // generalized positions change.
+  ArticulatedBodyInertiaCache<T> abc(get_topology());
+  CalcArticulatedBodyInertiaCache(context, pc, &abc);
+
+  // Workspaces for the two sweeps below, indexed by BodyNodeIndex.
+  std::vector<SpatialForce<T>> Zplus_PB_W_array(num_bodies());
+  std::vector<VectorUpTo6<T>> e_B_array(num_bodies());
+  std::vector<SpatialAcceleration<T>> A_WB_array(num_bodies());
+
+  // Tip-to-base sweep accumulating the articulated body force biases, with
+  // the entries of b playing the role of applied generalized forces.
+  for (int depth = tree_height() - 1; depth > 0; --depth) {
+    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
+      const BodyNode<T>& node = *body_nodes_[body_node_index];
+      Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+          node.GetJacobianFromArray(H_PB_W_cache);
+      node.CalcArticulatedBodyForceBias_TipToBase(
+          pc, abc, H_PB_W, b, &Zplus_PB_W_array, &e_B_array);
+    }
+  }
+
+  // Base-to-tip sweep computing the solution x together with the body
+  // spatial accelerations consistent with v̇ = x at zero velocities.
+  A_WB_array[BodyNodeIndex(0)] = SpatialAcceleration<T>::Zero();
+  for (int depth = 1; depth < tree_height(); ++depth) {
+    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
+      const BodyNode<T>& node = *body_nodes_[body_node_index];
+      Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+          node.GetJacobianFromArray(H_PB_W_cache);
+      node.CalcArticulatedBodyAccelerations_BaseToTip(
+          pc, abc, H_PB_W, e_B_array, &A_WB_array, x);
+    }
+  }
+}
+
 template <typename T>
 MatrixX<double> MultibodyTree<T>::MakeStateSelectorMatrix(
     const std::vector<JointIndex>& user_to_joint_index_map) const {
@@ -1600,6 +1600,25 @@ class MultibodyTree {
       const Frame<T>& frame_F,
       const Eigen::Ref<const MatrixX<T>>& p_FP_list) const;
 
+  /// Alternate signature of CalcBiasForPointsGeometricJacobianExpressedInWorld
+  /// that writes into a caller-provided output and scratch space so that, once
+  /// those are sized, repeated calls perform no heap allocation. This is
+  /// useful in e.g. operational-space control loops that recompute Jacobian
+  /// bias terms at high rates.
+  /// @param[in,out] A_WB_scratch
+  ///   Scratch space for the body spatial accelerations, resized to
+  ///   num_bodies() if needed. Its contents on input are discarded. It must
+  ///   not be nullptr.
+  /// @param[out] Ab_WFp
+  ///   On output, the bias terms `Ab_WFp` stacked per point. It must not be
+  ///   nullptr and must be of size `3 x p_FP_list.cols()`.
+  void CalcBiasForPointsGeometricJacobianExpressedInWorld(
+      const systems::Context<T>& context,
+      const Frame<T>& frame_F,
+      const Eigen::Ref<const MatrixX<T>>& p_FP_list,
+      std::vector<SpatialAcceleration<T>>* A_WB_scratch,
+      EigenPtr<VectorX<T>> Ab_WFp) const;
+
   /// See MultibodyPlant method.
   void CalcPointsAnalyticalJacobianExpressedInWorld(
       const systems::Context<T>& context,
@@ -1624,6 +1643,18 @@ class MultibodyTree {
       const systems::Context<T>& context,
       const Frame<T>& frame_F, const Eigen::Ref<const Vector3<T>>& p_FP) const;
 
+  /// Alternate signature of CalcBiasForFrameGeometricJacobianExpressedInWorld
+  /// that uses caller-provided scratch space so that, once it is sized,
+  /// repeated calls perform no heap allocation.
+  /// @param[in,out] A_WB_scratch
+  ///   Scratch space for the body spatial accelerations, resized to
+  ///   num_bodies() if needed. Its contents on input are discarded. It must
+  ///   not be nullptr.
+  Vector6<T> CalcBiasForFrameGeometricJacobianExpressedInWorld(
+      const systems::Context<T>& context,
+      const Frame<T>& frame_F, const Eigen::Ref<const Vector3<T>>& p_FP,
+      std::vector<SpatialAcceleration<T>>* A_WB_scratch) const;
+
   /// See MultibodyPlant method.
   void CalcJacobianSpatialVelocity(
       const systems::Context<T>& context,
@@ -1632,6 +1663,21 @@ class MultibodyTree {
       const Frame<T>& frame_A, const Frame<T>& frame_E,
       EigenPtr<MatrixX<T>> Jw_ABp_E) const;
 
+  /// Alternate signature of CalcJacobianSpatialVelocity() that uses a
+  /// caller-provided scratch matrix so that, once it is sized, repeated calls
+  /// perform no heap allocation.
+  /// @param[in,out] Jw_WAp_scratch
+  ///   Scratch space for the Jacobian of frame A, resized to `6 x n` if
+  ///   needed, with `n` the number of columns of `Jw_ABp_E`. Its contents on
+  ///   input are discarded. It must not be nullptr.
+  void CalcJacobianSpatialVelocity(
+      const systems::Context<T>& context,
+      JacobianWrtVariable with_respect_to,
+      const Frame<T>& frame_B, const Eigen::Ref<const Vector3<T>>& p_BP,
+      const Frame<T>& frame_A, const Frame<T>& frame_E,
+      MatrixX<T>* Jw_WAp_scratch,
+      EigenPtr<MatrixX<T>> Jw_ABp_E) const;
+
   /// @}
   // End of multibody Jacobian methods section.
 
@@ -1657,6 +1703,15 @@ class MultibodyTree {
   /// - Across-mobilizer Jacobian matrices `H_FM` and `H_PB_W`.
   /// - Body specific quantities such as `com_W` and `M_Bo_W`.
   ///
+  /// When `pc` already holds the results of a previous update, only the
+  /// subtrees rooted at mobilizers whose generalized positions changed since
+  /// that update are recomputed; the cached poses of all other branches are
+  /// reused. The comparison against the previous positions is bit-wise (and
+  /// only ever performed for `T = double`), so the results are always
+  /// identical to those of a full update. This makes repeated evaluations
+  /// where only a few joints move, e.g. perturbing one arm of a multi-robot
+  /// model during planning, cost O(moved subtree) instead of O(model).
+  ///
   /// Aborts if `pc` is nullptr.
   void CalcPositionKinematicsCache(
       const systems::Context<T>& context,
@@ -1728,6 +1783,89 @@ class MultibodyTree {
       const VectorX<T>& known_vdot,
       const MultibodyForces<T>& external_forces) const;
 
+  /// Computes inverse dynamics for a batch of state and acceleration samples
+  /// in a single pass, as needed by e.g. sampling based controllers that
+  /// evaluate hundreds of samples per control tick.
+  /// For each sample i this method computes the i-th column of `tau_batch`
+  /// as: <pre>
+  ///   tau_batch.col(i) = M(qᵢ)v̇ᵢ + C(qᵢ, vᵢ)vᵢ
+  /// </pre>
+  /// with `qᵢ = q_batch.col(i)`, `vᵢ = v_batch.col(i)` and
+  /// `v̇ᵢ = vdot_batch.col(i)`, using the same `O(n)` recursive Newton-Euler
+  /// algorithm as CalcInverseDynamics(). No externally applied forces are
+  /// included; callers can subtract their own applied forces from the result.
+  /// The batch is tiled into contiguous ranges processed by up to
+  /// `num_threads` worker threads, each reusing one scratch context and one
+  /// set of kinematics caches across all of its samples, so per-sample heap
+  /// allocation is avoided.
+  /// @param[in] q_batch
+  ///   Generalized positions, stacked column-wise. Of size
+  ///   `num_positions() x num_samples`.
+  /// @param[in] v_batch
+  ///   Generalized velocities, stacked column-wise. Of size
+  ///   `num_velocities() x num_samples`.
+  /// @param[in] vdot_batch
+  ///   Generalized accelerations, stacked column-wise. Of size
+  ///   `num_velocities() x num_samples`.
+  /// @param[in] num_threads
+  ///   Maximum number of worker threads. Must be strictly positive; one means
+  ///   serial execution.
+  /// @param[out] tau_batch
+  ///   On output, the inverse dynamics result for each sample, stacked
+  ///   column-wise. It must not be nullptr and must be of size
+  ///   `num_velocities() x num_samples`.
+  /// @throws std::exception if this %MultibodyTree is not finalized, if it is
+  /// not owned by a MultibodyTreeSystem, or if the arguments have
+  /// inconsistent sizes.
+  void CalcBatchInverseDynamics(
+      const Eigen::Ref<const MatrixX<T>>& q_batch,
+      const Eigen::Ref<const MatrixX<T>>& v_batch,
+      const Eigen::Ref<const MatrixX<T>>& vdot_batch,
+      int num_threads,
+      EigenPtr<MatrixX<T>> tau_batch) const;
+
+  /// Computes the partial derivatives of the inverse dynamics
+  /// `tau(q, v, v̇) = M(q)v̇ + C(q, v)v` with respect to the generalized
+  /// positions, velocities and accelerations, at the state stored in
+  /// `context`. These partials are the main ingredient when linearizing
+  /// multibody dynamics: for the forward dynamics `v̇ = M⁻¹(q)(tau_app - Cv)`
+  /// the state-space matrices follow from `∂tau/∂q` and `∂tau/∂v` by solves
+  /// against the mass matrix.
+  /// This method operates directly on scalar type T; there is no scalar
+  /// conversion of the model and no allocation of derivative vectors, which
+  /// makes it orders of magnitude faster than linearizing through an
+  /// AutoDiffXd-converted plant.
+  /// The partial with respect to v̇ equals the mass matrix `M(q)` and is
+  /// computed analytically with the Composite Rigid Body Algorithm, see
+  /// CalcMassMatrix(). The partials with respect to q and v are computed
+  /// column-wise with central differences of the `O(n)` recursive
+  /// Newton-Euler algorithm, at a cost of two `O(n)` evaluations per state
+  /// coordinate. Externally applied forces are not included; their
+  /// contribution to a linearization must be differentiated by the caller.
+  /// @param[in] context
+  ///   The context containing the state of the %MultibodyTree model.
+  /// @param[in] known_vdot
+  ///   A vector with the generalized accelerations, of size
+  ///   num_velocities().
+  /// @param[out] dtau_dq
+  ///   `∂tau/∂q`, of size `num_velocities() x num_positions()`. Partials are
+  ///   taken with respect to the generalized position coordinates; for
+  ///   quaternion bases these are partials with respect to the quaternion
+  ///   components, not a tangent-space parameterization.
+  /// @param[out] dtau_dv
+  ///   `∂tau/∂v`, of size `num_velocities() x num_velocities()`.
+  /// @param[out] dtau_dvdot
+  ///   `∂tau/∂v̇ = M(q)`, of size `num_velocities() x num_velocities()`.
+  /// @throws std::exception if this %MultibodyTree is not finalized, if it is
+  /// not owned by a MultibodyTreeSystem, or if the arguments have
+  /// inconsistent sizes.
+  void CalcInverseDynamicsPartials(
+      const systems::Context<T>& context,
+      const VectorX<T>& known_vdot,
+      EigenPtr<MatrixX<T>> dtau_dq,
+      EigenPtr<MatrixX<T>> dtau_dv,
+      EigenPtr<MatrixX<T>> dtau_dvdot) const;
+
   /// (Advanced) Given the state of `this` %MultibodyTree in `context` and a
   /// known vector of generalized accelerations `vdot`, this method computes the
   /// set of generalized forces `tau` that would need to be applied at each
@@ -1861,10 +1999,38 @@ class MultibodyTree {
   void CalcMassMatrixViaInverseDynamics(
       const systems::Context<T>& context, EigenPtr<MatrixX<T>> H) const;
 
+  /// See MultibodyPlant method.
+  void CalcMassMatrix(
+      const systems::Context<T>& context, EigenPtr<MatrixX<T>> H) const;
+
   /// See MultibodyPlant method.
   void CalcBiasTerm(
       const systems::Context<T>& context, EigenPtr<VectorX<T>> Cv) const;
 
+  /// Alternative signature to the method above for the computation of the
+  /// bias term `C(q, v)v` using caller-provided workspace arrays, so that no
+  /// heap allocation is performed by this method. This signature is intended
+  /// for controllers that evaluate the bias term at high rates.
+  /// The computation performs a dedicated pair of sweeps; a base-to-tip sweep
+  /// computing the bias spatial accelerations `Ab_WB = A_WB(q, v, v̇ = 0)`
+  /// followed by a tip-to-base force sweep projecting the resulting inertial
+  /// and gyroscopic forces onto the generalized velocities. Unlike a full
+  /// inverse dynamics computation, no applied forces are assembled.
+  /// @param[out] Ab_WB_scratch
+  ///   Workspace for the bias spatial accelerations, resized to num_bodies()
+  ///   if needed.
+  /// @param[out] F_BMo_W_scratch
+  ///   Workspace for the mobilizer reaction forces, resized to num_bodies()
+  ///   if needed.
+  /// @param[out] Cv
+  ///   On output `Cv` will contain the bias term. It must be a valid, non-null
+  ///   pointer to a column vector of size num_velocities().
+  void CalcBiasTerm(
+      const systems::Context<T>& context,
+      std::vector<SpatialAcceleration<T>>* Ab_WB_scratch,
+      std::vector<SpatialForce<T>>* F_BMo_W_scratch,
+      EigenPtr<VectorX<T>> Cv) const;
+
   /// See MultibodyPlant method.
   VectorX<T> CalcGravityGeneralizedForces(
       const systems::Context<T>& context) const;
@@ -1906,6 +2072,29 @@ class MultibodyTree {
       const PositionKinematicsCache<T>& pc,
       ArticulatedBodyInertiaCache<T>* abc) const;
 
+  /// Solves the linear system `M(q)⋅x = b`, with `M(q)` the mass matrix of
+  /// this model, in O(n) with n the number of bodies, using the articulated
+  /// body algorithm. The mass matrix is never formed; instead, the articulated
+  /// body inertias computed by CalcArticulatedBodyInertiaCache() are combined
+  /// with a tip-to-base force bias sweep and a base-to-tip acceleration sweep
+  /// over the body nodes.
+  ///
+  /// When `b` collects the total applied generalized forces (minus bias
+  /// terms), `x` are the resulting generalized accelerations, i.e., this
+  /// method performs O(n) forward dynamics.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the %MultibodyTree model.
+  /// @param[in] b
+  ///   The right hand side vector, of size num_velocities().
+  /// @param[out] x
+  ///   A valid (non-null) pointer to a vector of size num_velocities() where
+  ///   the solution is written.
+  void SolveMassMatrixViaArticulatedBodyAlgorithm(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const VectorX<T>>& b,
+      EigenPtr<VectorX<T>> x) const;
+
   /// @}
   // Closes "Computational methods" Doxygen section.
 
@@ -2161,6 +2350,25 @@ class MultibodyTree {
     tree_system_ = tree_system;
   }
 
+  /// Sets the number of threads used by the kinematics sweeps in this tree,
+  /// see num_kinematics_threads(). Body nodes at the same level (depth) in
+  /// the tree are independent within a single base-to-tip sweep, so each
+  /// level can be processed in parallel while levels are still visited in
+  /// order.
+  /// The default is one thread, i.e. serial execution. More than one thread
+  /// only pays off for models with many bodies per level; for typical
+  /// articulated robots the per-node work is too small to amortize the
+  /// threading overhead.
+  /// @throws std::exception if `num_threads` is not strictly positive.
+  void set_num_kinematics_threads(int num_threads) {
+    DRAKE_THROW_UNLESS(num_threads > 0);
+    num_kinematics_threads_ = num_threads;
+  }
+
+  /// Returns the number of threads used by the kinematics sweeps in this
+  /// tree, see set_num_kinematics_threads().
+  int num_kinematics_threads() const { return num_kinematics_threads_; }
+
   /// (Internal) Computes the cache entry associated with the geometric Jacobian
   /// H_PB_W for each node.
   /// The geometric Jacobian `H_PB_W` relates to the spatial velocity of B in P
@@ -2310,6 +2518,23 @@ class MultibodyTree {
       const PositionKinematicsCache<T>& pc,
       EigenPtr<MatrixX<T>> H) const;
 
+  // Implementation for CalcMassMatrix(). Implements the Composite Rigid Body
+  // Algorithm, which runs in O(n²) with a much smaller constant than the
+  // inverse dynamics based implementation in
+  // DoCalcMassMatrixViaInverseDynamics(). Only a single tip-to-base sweep over
+  // the body nodes is performed to accumulate composite body inertias; the
+  // remaining work projects those inertias through the hinge matrices along
+  // each path to the world to fill in the (symmetric) mass matrix.
+  // It assumes:
+  //  - The position kinematics cache object is already updated to be in sync
+  //    with `context`.
+  //  - H is not nullptr.
+  //  - H has storage for a square matrix of size num_velocities().
+  void DoCalcMassMatrix(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      EigenPtr<MatrixX<T>> H) const;
+
   // Implementation of CalcBiasTerm().
   // It assumes:
   //  - The position kinematics cache object is already updated to be in sync
@@ -2324,6 +2549,21 @@ class MultibodyTree {
       const VelocityKinematicsCache<T>& vc,
       EigenPtr<VectorX<T>> Cv) const;
 
+  // Workspace-based kernel underlying DoCalcBiasTerm(). It performs a
+  // base-to-tip sweep for the bias spatial accelerations (the accelerations
+  // for v̇ = 0) followed by a tip-to-base force sweep with no applied forces,
+  // writing into the caller-provided arrays instead of allocating.
+  // It makes the same assumptions as DoCalcBiasTerm() above, plus:
+  //  - Ab_WB_scratch and F_BMo_W_scratch are not nullptr; they are resized to
+  //    num_bodies() if needed.
+  void DoCalcBiasTerm(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const VelocityKinematicsCache<T>& vc,
+      std::vector<SpatialAcceleration<T>>* Ab_WB_scratch,
+      std::vector<SpatialForce<T>>* F_BMo_W_scratch,
+      EigenPtr<VectorX<T>> Cv) const;
+
   // Helper method to apply forces due to damping at the joints.
   // MultibodyTree treats damping forces separately from other ForceElement
   // forces for a quick simple solution. This allows clients of MBT (namely MBP)
@@ -2352,6 +2592,13 @@ class MultibodyTree {
 
   void CreateModelInstances();
 
+  // Precomputes, at Finalize() time, the constant transforms for bodies that
+  // are welded (possibly through a chain of weld mobilizers) to a composite
+  // body, so that the kinematics sweeps can update those bodies with a single
+  // rigid shift from the composite body instead of a full across-mobilizer
+  // computation. See X_CB_weld_pool_ and friends.
+  void CollapseWeldedBodies();
+
   // Helper method to create a clone of `frame` and add it to `this` tree.
   template <typename FromScalar>
   Frame<T>* CloneFrameAndAdd(const Frame<FromScalar>& frame) {
@@ -2618,6 +2865,21 @@ class MultibodyTree {
   // in that level.
   std::vector<std::vector<BodyNodeIndex>> body_node_levels_;
 
+  // Constant transforms for bodies welded to a composite body, precomputed at
+  // Finalize() time by CollapseWeldedBodies(). For a body B connected to its
+  // parent P by a weld mobilizer, and rigidly carried by the composite body
+  // rooted at node C (see BodyNodeTopology::composite_body_node), these pools
+  // store the constant transforms X_CB, X_PB and the across-mobilizer
+  // transform X_FM. Entries for mobilized nodes are left as identity and are
+  // never used.
+  eigen_aligned_std_vector<Isometry3<T>> X_CB_weld_pool_;
+  eigen_aligned_std_vector<Isometry3<T>> X_PB_weld_pool_;
+  eigen_aligned_std_vector<Isometry3<T>> X_FM_weld_pool_;
+
+  // Number of threads used to process each level of body_node_levels_ during
+  // the kinematics sweeps, see set_num_kinematics_threads().
+  int num_kinematics_threads_{1};
+
   MultibodyTreeTopology topology_;
 
   const MultibodyTreeSystem<T>* tree_system_{};
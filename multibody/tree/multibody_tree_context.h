@@ -132,15 +132,26 @@ class MultibodyTreeContext final : public systems::LeafContext<T> {
     return get_state_segment(num_positions(), num_velocities());
   }
 
-  /// Returns a mutable Eigen expression of the vector of generalized positions.
+  /// Returns a mutable Eigen expression of the vector of generalized
+  /// positions. When the state is continuous, sends out of date notifications
+  /// only for computations that depend on the generalized positions q, so
+  /// that velocity-dependent results (e.g. velocity kinematics) stay valid.
+  /// With discrete state the q's and v's share a single state group and all
+  /// of its dependents are notified.
   Eigen::VectorBlock<VectorX<T>> get_mutable_positions() {
-    return get_mutable_state_segment(0, num_positions());
+    NotePartialStateChanged(&MultibodyTreeContext::NoteAllQChanged);
+    return access_mutable_state_segment(0, num_positions());
   }
 
   /// Returns a mutable Eigen expression of the vector of generalized
-  /// velocities.
+  /// velocities. When the state is continuous, sends out of date
+  /// notifications only for computations that depend on the generalized
+  /// velocities v, so that position-dependent results (e.g. position
+  /// kinematics) stay valid. With discrete state the q's and v's share a
+  /// single state group and all of its dependents are notified.
   Eigen::VectorBlock<VectorX<T>> get_mutable_velocities() {
-    return get_mutable_state_segment(num_positions(), num_velocities());
+    NotePartialStateChanged(&MultibodyTreeContext::NoteAllVChanged);
+    return access_mutable_state_segment(num_positions(), num_velocities());
   }
 
   /// Returns a const fixed-size Eigen::VectorBlock of `count` elements
@@ -215,6 +226,36 @@ class MultibodyTreeContext final : public systems::LeafContext<T> {
  private:
   MultibodyTreeContext(const MultibodyTreeContext& source) = default;
 
+  // Sends the given narrower out of date notification when the state is
+  // continuous. With discrete state the q's and v's share a single state
+  // group, so the whole-group notification must be sent instead.
+  void NotePartialStateChanged(
+      void (systems::ContextBase::*note_change)(int64_t)) {
+    const int64_t change_event = this->start_new_change_event();
+    if (is_state_discrete()) {
+      this->PropagateBulkChange(
+          change_event, &MultibodyTreeContext::NoteAllDiscreteStateChanged);
+    } else {
+      this->PropagateBulkChange(change_event, note_change);
+    }
+  }
+
+  // Returns a mutable segment of the state vector _without_ sending any out
+  // of date notifications; the caller must already have sent the appropriate
+  // notification.
+  Eigen::VectorBlock<VectorX<T>> access_mutable_state_segment(
+      int start, int count) {
+    DRAKE_ASSERT(this->get_num_discrete_state_groups() <= 1);
+    systems::State<T>& state = systems::Context<T>::access_mutable_state(this);
+    systems::BasicVector<T>& state_vector =
+        is_state_discrete()
+            ? state.get_mutable_discrete_state(0)
+            : dynamic_cast<systems::BasicVector<T>&>(
+                  state.get_mutable_continuous_state().get_mutable_vector());
+    Eigen::VectorBlock<VectorX<T>> x = state_vector.get_mutable_value();
+    return x.nestedExpression().segment(start, count);
+  }
+
   const MultibodyTreeTopology topology_;
 
   // If `true`, this context stores a discrete state. If `false` the state is
@@ -86,7 +86,9 @@ void MultibodyTreeSystem<T>::Finalize() {
                                  0 /* num_z */);
   }
 
-  // Allocate position cache.
+  // Allocate position cache. Position kinematics depend only on the
+  // generalized positions q. With discrete state the q's live in the (single)
+  // discrete state group, so the discrete-variables ticket is used instead.
   auto& position_kinematics_cache_entry = this->DeclareCacheEntry(
       std::string("position kinematics"),
       [tree = tree_.get()]() {
@@ -100,11 +102,14 @@ void MultibodyTreeSystem<T>::Finalize() {
             cache_value->GetMutableValue<PositionKinematicsCache<T>>();
         tree->CalcPositionKinematicsCache(context, &position_cache);
       },
-      {this->configuration_ticket()});
+      {is_discrete_ ? this->xd_ticket() : this->q_ticket()});
   position_kinematics_cache_index_ =
       position_kinematics_cache_entry.cache_index();
 
-  // Allocate velocity cache.
+  // Allocate velocity cache. Velocity kinematics depend on the generalized
+  // velocities v and on position kinematics; the dependence on q is captured
+  // through the position kinematics cache entry so that a velocity-only
+  // change leaves position kinematics valid.
   auto& velocity_kinematics_cache_entry = this->DeclareCacheEntry(
       std::string("velocity kinematics"),
       [tree = tree_.get()]() {
@@ -119,7 +124,8 @@ void MultibodyTreeSystem<T>::Finalize() {
         tree->CalcVelocityKinematicsCache(
             context, tree->EvalPositionKinematics(context), &velocity_cache);
       },
-      {this->kinematics_ticket()});
+      {this->cache_entry_ticket(position_kinematics_cache_index_),
+       is_discrete_ ? this->xd_ticket() : this->v_ticket()});
   velocity_kinematics_cache_index_ =
       velocity_kinematics_cache_entry.cache_index();
 
@@ -373,9 +373,22 @@ struct BodyNodeTopology {
     if (flexible_velocities_start != other.flexible_velocities_start)
       return false;
 
+    if (composite_body_node.is_valid() !=
+        other.composite_body_node.is_valid()) return false;
+    if (composite_body_node.is_valid() &&
+        composite_body_node != other.composite_body_node) return false;
+
     return true;
   }
 
+  /// Returns `true` if this node connects to its parent through a zero-dof
+  /// (weld) mobilizer and therefore moves rigidly with the composite body
+  /// rooted at composite_body_node.
+  /// Only valid after MultibodyTreeTopology::Finalize().
+  bool is_welded_to_composite() const {
+    return composite_body_node.is_valid() && composite_body_node != index;
+  }
+
   /// Unique index of this node in the MultibodyTree.
   BodyNodeIndex index{};
 
@@ -413,6 +426,13 @@ struct BodyNodeTopology {
   int flexible_positions_start{0};
   int num_flexible_velocities{0};
   int flexible_velocities_start{0};
+
+  /// Index of the node for the composite body this node moves rigidly with.
+  /// For the world and for mobilized nodes (non-zero number of mobilities)
+  /// this is the node's own index. For a node connected by a zero-dof (weld)
+  /// mobilizer it is the index of its nearest mobilized (or world) ancestor.
+  /// Assigned during MultibodyTreeTopology::Finalize().
+  BodyNodeIndex composite_body_node;
 };
 
 /// Data structure to store the topological information associated with an
@@ -844,6 +864,23 @@ class MultibodyTreeTopology {
     DRAKE_DEMAND(position_index == num_positions_);
     DRAKE_DEMAND(velocity_index == num_states_);
 
+    // Identify weld composites: a node connected by a zero-dof (weld)
+    // mobilizer moves rigidly with its parent and therefore belongs to the
+    // composite body rooted at its nearest mobilized (or world) ancestor.
+    // Nodes are numbered in BFT order so parents are visited before their
+    // children.
+    for (BodyNodeIndex node_index(0);
+         node_index < get_num_body_nodes(); ++node_index) {
+      BodyNodeTopology& node = body_nodes_[node_index];
+      if (node_index == 0 || node.num_mobilizer_velocities > 0 ||
+          node.num_mobilizer_positions > 0) {
+        node.composite_body_node = node_index;
+      } else {
+        node.composite_body_node =
+            body_nodes_[node.parent_body_node].composite_body_node;
+      }
+    }
+
     // We are done with a successful Finalize() and we mark it as so.
     // Do not add any more code after this!
     is_valid_ = true;
@@ -54,13 +54,13 @@ class PositionKinematicsCache {
   ///                 expressed in the world frame W.
   const Isometry3<T>& get_X_WB(BodyNodeIndex body_node_index) const {
     DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
-    return X_WB_pool_[body_node_index];
+    return pool_[kXWBSlot * num_nodes_ + body_node_index];
   }
 
   /// See documentation on the const version get_X_WB() for details.
   Isometry3<T>& get_mutable_X_WB(BodyNodeIndex body_node_index) {
     DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
-    return X_WB_pool_[body_node_index];
+    return pool_[kXWBSlot * num_nodes_ + body_node_index];
   }
 
   /// Returns a const reference to the pose `X_PB` of the body frame B
@@ -71,13 +71,13 @@ class PositionKinematicsCache {
   ///                 measured and expressed in the parent body frame P.
   const Isometry3<T>& get_X_PB(BodyNodeIndex body_node_id) const {
     DRAKE_ASSERT(0 <= body_node_id && body_node_id < num_nodes_);
-    return X_PB_pool_[body_node_id];
+    return pool_[kXPBSlot * num_nodes_ + body_node_id];
   }
 
   /// See documentation on the const version get_X_PB() for details.
   Isometry3<T>& get_mutable_X_PB(BodyNodeIndex body_node_id) {
     DRAKE_ASSERT(0 <= body_node_id && body_node_id < num_nodes_);
-    return X_PB_pool_[body_node_id];
+    return pool_[kXPBSlot * num_nodes_ + body_node_id];
   }
 
   /// For the mobilizer associated with the body node indexed by
@@ -92,38 +92,57 @@ class PositionKinematicsCache {
   ///          as measured and expressed in the inboard frame F.
   const Isometry3<T>& get_X_FM(BodyNodeIndex body_node_index) const {
     DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
-    return X_FM_pool_[body_node_index];
+    return pool_[kXFMSlot * num_nodes_ + body_node_index];
   }
 
   /// See documentation on the const version get_X_FM() for details.
   Isometry3<T>& get_mutable_X_FM(BodyNodeIndex body_node_index) {
     DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
-    return X_FM_pool_[body_node_index];
+    return pool_[kXFMSlot * num_nodes_ + body_node_index];
   }
 
- private:
-  // Pool types:
-  // Pools store entries in the same order multibody tree nodes are
-  // ordered in the tree, i.e. in BFT (Breadth-First Traversal) order. Therefore
-  // clients of this class will access entries by BodyNodeIndex, see
-  // `get_X_WB()` for instance.
+  /// (Internal use only) Returns the vector of generalized positions this
+  /// cache was last updated at, as recorded by
+  /// MultibodyTree::CalcPositionKinematicsCache(). It has zero size if this
+  /// cache was never updated. This allows incremental updates that recompute
+  /// only the subtrees whose positions changed, see
+  /// MultibodyTree::CalcPositionKinematicsCache() for details.
+  const VectorX<T>& last_update_positions() const {
+    return last_update_positions_;
+  }
+
+  /// (Internal use only) Records the vector of generalized positions this
+  /// cache was updated at. See last_update_positions().
+  void set_last_update_positions(const Eigen::Ref<const VectorX<T>>& q) {
+    last_update_positions_ = q;
+  }
 
-  // The type of pools for storing poses.
+ private:
+  // Pool layout:
+  // All pools live in a single contiguous arena so that a full cache update
+  // touches one allocation instead of several scattered ones. Within the
+  // arena each pool occupies a contiguous block of num_nodes_ entries, with
+  // entries in the same order multibody tree nodes are ordered in the tree,
+  // i.e. in BFT (Breadth-First Traversal) order. Therefore clients of this
+  // class access entries by BodyNodeIndex, see `get_X_WB()` for instance.
+  // The pose for node i of pool `slot` is stored at
+  // pool_[slot * num_nodes_ + i].
+
+  // The type of the arena for storing poses.
   typedef eigen_aligned_std_vector<Isometry3<T>> X_PoolType;
 
+  // Slot of each pool within the arena.
+  enum PoolSlot { kXWBSlot = 0, kXPBSlot, kXFMSlot, kXMBSlot, kNumSlots };
+
   // Allocates resources for this position kinematics cache.
   void Allocate() {
-    X_WB_pool_.resize(num_nodes_);
-    X_WB_pool_[world_index()] = Isometry3<T>::Identity();
-
-    X_PB_pool_.resize(num_nodes_);
-    X_PB_pool_[world_index()] = NaNPose();  // It should never be used.
-
-    X_FM_pool_.resize(num_nodes_);
-    X_FM_pool_[world_index()] = NaNPose();  // It should never be used.
+    pool_.resize(kNumSlots * num_nodes_);
 
-    X_MB_pool_.resize(num_nodes_);
-    X_MB_pool_[world_index()] = NaNPose();  // It should never be used.
+    pool_[kXWBSlot * num_nodes_ + world_index()] = Isometry3<T>::Identity();
+    // The world entries of the remaining pools should never be used.
+    pool_[kXPBSlot * num_nodes_ + world_index()] = NaNPose();
+    pool_[kXFMSlot * num_nodes_ + world_index()] = NaNPose();
+    pool_[kXMBSlot * num_nodes_ + world_index()] = NaNPose();
   }
 
   // Helper method to initialize poses to NaN.
@@ -134,10 +153,11 @@ class PositionKinematicsCache {
 
   // Number of body nodes in the corresponding MultibodyTree.
   int num_nodes_{0};
-  X_PoolType X_WB_pool_;  // Indexed by BodyNodeIndex.
-  X_PoolType X_PB_pool_;  // Indexed by BodyNodeIndex.
-  X_PoolType X_FM_pool_;  // Indexed by BodyNodeIndex.
-  X_PoolType X_MB_pool_;  // Indexed by BodyNodeIndex.
+  // Single arena holding the X_WB, X_PB, X_FM and X_MB pools, in that order.
+  X_PoolType pool_;
+  // Generalized positions at the last update of this cache, with zero size
+  // before the first update. See last_update_positions().
+  VectorX<T> last_update_positions_;
 };
 
 }  // namespace internal
@@ -0,0 +1,118 @@
+#include "drake/multibody/tree/sparse_ltdl_factorization.h"
+
+#include <utility>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+template <typename T>
+SparseLtdlFactorization<T>::SparseLtdlFactorization(
+    const MultibodyTreeTopology& topology) {
+  DRAKE_THROW_UNLESS(topology.is_valid());
+  const int nv = topology.num_velocities();
+  lambda_.resize(nv);
+
+  // For each body node, the index of the last generalized velocity of the
+  // closest ancestor node (including the node itself) that has a mobilizer
+  // with at least one velocity, or -1 if there is no such ancestor.
+  // Body nodes are numbered with a base-to-tip level ordering so that a
+  // node's parent always precedes it in this loop.
+  std::vector<int> last_ancestor_velocity(topology.get_num_body_nodes(), -1);
+  for (BodyNodeIndex node_index(1);
+       node_index < topology.get_num_body_nodes(); ++node_index) {
+    const BodyNodeTopology& node = topology.get_body_node(node_index);
+    const int start = node.mobilizer_velocities_start_in_v;
+    const int nm = node.num_mobilizer_velocities;
+    const int parent_last = last_ancestor_velocity[node.parent_body_node];
+    for (int m = 0; m < nm; ++m) {
+      lambda_[start + m] = (m == 0) ? parent_last : start + m - 1;
+    }
+    last_ancestor_velocity[node_index] =
+        (nm > 0) ? start + nm - 1 : parent_last;
+  }
+}
+
+template <typename T>
+SparseLtdlFactorization<T>::SparseLtdlFactorization(
+    std::vector<int> expanded_parent_array)
+    : lambda_(std::move(expanded_parent_array)) {
+  for (int i = 0; i < static_cast<int>(lambda_.size()); ++i) {
+    DRAKE_THROW_UNLESS(-1 <= lambda_[i] && lambda_[i] < i);
+  }
+}
+
+template <typename T>
+void SparseLtdlFactorization<T>::Factorize(const MatrixX<T>& M) {
+  const int nv = static_cast<int>(lambda_.size());
+  DRAKE_THROW_UNLESS(M.rows() == nv && M.cols() == nv);
+
+  // In-place LTDL factorization following [Featherstone 2008, Table 6.3].
+  // Only entries (i, j) with j in the ancestor chain of i are accessed, and
+  // the factorization introduces no fill-in outside that pattern.
+  LTDL_ = M;
+  for (int k = nv - 1; k >= 0; --k) {
+    int i = lambda_[k];
+    while (i >= 0) {
+      const T a = LTDL_(k, i) / LTDL_(k, k);
+      int j = i;
+      while (j >= 0) {
+        LTDL_(i, j) -= a * LTDL_(k, j);
+        j = lambda_[j];
+      }
+      LTDL_(k, i) = a;
+      i = lambda_[i];
+    }
+  }
+  is_factorized_ = true;
+}
+
+template <typename T>
+VectorX<T> SparseLtdlFactorization<T>::Solve(
+    const Eigen::Ref<const VectorX<T>>& b) const {
+  VectorX<T> x(b);
+  SolveInPlace(&x);
+  return x;
+}
+
+template <typename T>
+void SparseLtdlFactorization<T>::SolveInPlace(EigenPtr<VectorX<T>> b) const {
+  DRAKE_THROW_UNLESS(b != nullptr);
+  DRAKE_THROW_UNLESS(is_factorized_);
+  const int nv = static_cast<int>(lambda_.size());
+  DRAKE_THROW_UNLESS(b->size() == nv);
+  // An Eigen::Ref to the solution vector being computed in place.
+  auto& x = *b;
+
+  // Back and forward substitutions following [Featherstone 2008, Table 6.5],
+  // with M = Lᵀ⋅D⋅L:
+  // 1. Solve Lᵀ⋅y = b.
+  for (int i = nv - 1; i >= 0; --i) {
+    int j = lambda_[i];
+    while (j >= 0) {
+      x(j) -= LTDL_(i, j) * x(i);
+      j = lambda_[j];
+    }
+  }
+  // 2. Scale by D⁻¹.
+  for (int i = 0; i < nv; ++i) x(i) /= LTDL_(i, i);
+  // 3. Solve L⋅x = y.
+  for (int i = 0; i < nv; ++i) {
+    int j = lambda_[i];
+    while (j >= 0) {
+      x(i) -= LTDL_(i, j) * x(j);
+      j = lambda_[j];
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class drake::multibody::internal::SparseLtdlFactorization)
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/tree/multibody_tree_topology.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+/// This class implements a sparsity exploiting LTDL factorization of the mass
+/// matrix `M(q)` of a multibody model, that is, a factorization
+/// `M = Lᵀ⋅D⋅L` with `L` unit lower triangular and `D` diagonal.
+///
+/// The key observation, see [Featherstone 2008, §6.5], is that entry
+/// `M(i, j)`, with `j < i`, of the mass matrix is non-zero only when the j-th
+/// generalized velocity is an ancestor of the i-th generalized velocity in
+/// the tree; that is, the sparsity pattern of `M(q)` is induced by the
+/// branching structure of the kinematic tree and is constant, known once the
+/// topology is finalized. This structure is summarized by the _expanded
+/// parent array_ λ, where `λ(i)` is the index of the closest ancestor
+/// generalized velocity of the i-th generalized velocity, or -1 when the i-th
+/// generalized velocity has no ancestors. The factorization and the
+/// corresponding solves only ever touch entries `(i, j)` with `j` in the
+/// ancestor chain `λ(i), λ(λ(i)), ...` of `i`, and therefore incur zero
+/// fill-in. For topologies with significant branching (e.g. multiple arms,
+/// hands, legs) the cost approaches O(n) rather than the O(n³) of a dense
+/// factorization.
+///
+/// A typical use looks like:
+/// @code
+///   SparseLtdlFactorization<double> ltdl(tree.get_topology());
+///   ltdl.Factorize(M);              // O(nd²), d the tree depth.
+///   VectorX<double> x = ltdl.Solve(b);  // O(nd).
+/// @endcode
+///
+/// - [Featherstone 2008] Featherstone, R., 2008. Rigid body dynamics
+///   algorithms. Springer.
+///
+/// @tparam T Must be a valid Eigen scalar type.
+template <typename T>
+class SparseLtdlFactorization {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(SparseLtdlFactorization)
+
+  /// Creates an empty factorization for a model with no generalized
+  /// velocities. Usable only after assignment from a properly constructed
+  /// factorization.
+  SparseLtdlFactorization() {}
+
+  /// Creates the factorization engine for a model with the given finalized
+  /// `topology`. The expanded parent array is extracted from the topology at
+  /// construction; Factorize() must be called before any solves.
+  /// @throws std::exception if `topology` is not finalized.
+  explicit SparseLtdlFactorization(const MultibodyTreeTopology& topology);
+
+  /// (Advanced) Creates the factorization engine directly from an expanded
+  /// parent array λ, where `expanded_parent_array[i]` must be in
+  /// `[-1, i - 1]`. Mostly useful for unit testing.
+  explicit SparseLtdlFactorization(std::vector<int> expanded_parent_array);
+
+  /// Computes the LTDL factorization of `M`, which must be symmetric with the
+  /// branch-induced sparsity pattern described in this class's documentation.
+  /// Only the lower triangular part of `M` is accessed.
+  /// @throws std::exception if `M` is not of size n x n, with n the number of
+  /// generalized velocities implied by the expanded parent array.
+  void Factorize(const MatrixX<T>& M);
+
+  /// Solves `M⋅x = b` using the factorization computed by the last call to
+  /// Factorize() and returns x.
+  /// @pre Factorize() has been called.
+  VectorX<T> Solve(const Eigen::Ref<const VectorX<T>>& b) const;
+
+  /// In-place version of Solve(); `b` is overwritten with the solution.
+  /// @pre Factorize() has been called.
+  void SolveInPlace(EigenPtr<VectorX<T>> b) const;
+
+  /// Returns the expanded parent array λ for this model's topology.
+  const std::vector<int>& expanded_parent_array() const { return lambda_; }
+
+  /// Returns `true` if Factorize() has been called at least once.
+  bool is_factorized() const { return is_factorized_; }
+
+ private:
+  // Expanded parent array λ, of size num_velocities.
+  std::vector<int> lambda_;
+
+  // In-place storage for the factors. The strictly lower triangular part
+  // stores the strictly lower triangular part of the unit matrix L and the
+  // diagonal stores D.
+  MatrixX<T> LTDL_;
+
+  bool is_factorized_{false};
+};
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,144 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/tree/multibody_tree.h"
+#include "drake/multibody/tree/multibody_tree_system.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/rigid_body.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::Isometry3d;
+using Eigen::Vector3d;
+using Eigen::Vector4d;
+using systems::Context;
+
+// Tests the incremental update performed by
+// MultibodyTree::CalcPositionKinematicsCache() when only some of the
+// generalized positions changed since the last update, see that method's
+// documentation. The model consists of two independent two-link arms
+// attached to the world, emulating a multi-robot plant where a planner
+// perturbs the joints of a single arm at a time.
+class IncrementalPositionKinematicsTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    system_ = MakeSystem(&joints_, &links_);
+    context_ = system_->CreateDefaultContext();
+  }
+
+  // Builds a model with two identical two-link arms. On output `joints` and
+  // `links` contain the four revolute joints and four links, ordered from
+  // base to tip, arm A first.
+  static std::unique_ptr<internal::MultibodyTreeSystem<double>> MakeSystem(
+      std::vector<const RevoluteJoint<double>*>* joints,
+      std::vector<const RigidBody<double>*>* links) {
+    const SpatialInertia<double> M_link(
+        1.0, Vector3d::Zero(), UnitInertia<double>::SolidSphere(0.1));
+    auto model = std::make_unique<internal::MultibodyTree<double>>();
+    joints->clear();
+    links->clear();
+    for (const std::string arm : {"A", "B"}) {
+      const RigidBody<double>& link1 = model->AddBody<RigidBody>(M_link);
+      const RigidBody<double>& link2 = model->AddBody<RigidBody>(M_link);
+      const Isometry3d X_PF{Eigen::Translation3d(0.0, 0.5, 0.0)};
+      joints->push_back(&model->AddJoint<RevoluteJoint>(
+          "Shoulder" + arm, model->world_body(), {}, link1, {},
+          Vector3d::UnitZ()));
+      joints->push_back(&model->AddJoint<RevoluteJoint>(
+          "Elbow" + arm, link1, X_PF, link2, {}, Vector3d::UnitZ()));
+      links->push_back(&link1);
+      links->push_back(&link2);
+    }
+    return std::make_unique<internal::MultibodyTreeSystem<double>>(
+        std::move(model));
+  }
+
+  const internal::MultibodyTree<double>& tree() const {
+    return internal::GetInternalTree(*system_);
+  }
+
+  void SetAngles(const Vector4d& q) {
+    for (int i = 0; i < 4; ++i) {
+      joints_[i]->set_angle(context_.get(), q(i));
+    }
+  }
+
+  // Returns the pose of the i-th link computed through the position
+  // kinematics cache for the current context.
+  Isometry3d CalcLinkPose(int i) const {
+    return tree().EvalBodyPoseInWorld(*context_, *links_[i]);
+  }
+
+ protected:
+  std::unique_ptr<internal::MultibodyTreeSystem<double>> system_;
+  std::unique_ptr<Context<double>> context_;
+  std::vector<const RevoluteJoint<double>*> joints_;
+  std::vector<const RigidBody<double>*> links_;
+};
+
+// An incremental update that only moves arm B must leave arm A's cached
+// poses bit-identical and produce exactly the poses a from-scratch update
+// computes for arm B.
+TEST_F(IncrementalPositionKinematicsTest, OnlyMovedSubtreesAreRecomputed) {
+  const Vector4d q0(0.1, 0.2, 0.3, 0.4);
+  SetAngles(q0);
+  // A full update; this is the first evaluation for this context.
+  const Isometry3d X_WA1_initial = CalcLinkPose(0);
+  const Isometry3d X_WA2_initial = CalcLinkPose(1);
+
+  // Move only arm B; the evaluation after this reuses arm A's subtree.
+  const Vector4d q1(0.1, 0.2, -0.5, 0.6);
+  SetAngles(q1);
+  const Isometry3d X_WA1 = CalcLinkPose(0);
+  const Isometry3d X_WA2 = CalcLinkPose(1);
+
+  // Arm A's poses must be bit-identical to those before the update.
+  EXPECT_TRUE(CompareMatrices(X_WA1.matrix(), X_WA1_initial.matrix()));
+  EXPECT_TRUE(CompareMatrices(X_WA2.matrix(), X_WA2_initial.matrix()));
+
+  // All poses must be bit-identical to a from-scratch computation at q1 on a
+  // freshly created context, which never takes the incremental path.
+  std::vector<const RevoluteJoint<double>*> joints_fresh;
+  std::vector<const RigidBody<double>*> links_fresh;
+  auto system_fresh = MakeSystem(&joints_fresh, &links_fresh);
+  auto context_fresh = system_fresh->CreateDefaultContext();
+  for (int i = 0; i < 4; ++i) {
+    joints_fresh[i]->set_angle(context_fresh.get(), q1(i));
+  }
+  const internal::MultibodyTree<double>& tree_fresh =
+      internal::GetInternalTree(*system_fresh);
+  for (int i = 0; i < 4; ++i) {
+    const Isometry3d X_WL_fresh =
+        tree_fresh.EvalBodyPoseInWorld(*context_fresh, *links_fresh[i]);
+    const Isometry3d X_WL = CalcLinkPose(i);
+    EXPECT_TRUE(CompareMatrices(X_WL.matrix(), X_WL_fresh.matrix()));
+  }
+}
+
+// Moving only an elbow must leave the corresponding upper link's pose
+// bit-identical while updating the lower link.
+TEST_F(IncrementalPositionKinematicsTest, PartialArmUpdate) {
+  SetAngles(Vector4d(0.1, 0.2, 0.3, 0.4));
+  const Isometry3d X_WB1_initial = CalcLinkPose(2);
+  const Isometry3d X_WB2_initial = CalcLinkPose(3);
+
+  // Move only arm B's elbow.
+  joints_[3]->set_angle(context_.get(), 1.4);
+  EXPECT_TRUE(
+      CompareMatrices(CalcLinkPose(2).matrix(), X_WB1_initial.matrix()));
+  EXPECT_FALSE(
+      CompareMatrices(CalcLinkPose(3).matrix(), X_WB2_initial.matrix()));
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -14,10 +14,13 @@
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/benchmarks/kuka_iiwa_robot/MG/MG_kuka_iiwa_robot.h"
 #include "drake/multibody/benchmarks/kuka_iiwa_robot/make_kuka_iiwa_model.h"
+#include "drake/common/drake_assert.h"
 #include "drake/multibody/tree/frame.h"
+#include "drake/multibody/tree/multibody_tree_context.h"
 #include "drake/multibody/tree/multibody_tree_system.h"
 #include "drake/multibody/tree/revolute_joint.h"
 #include "drake/multibody/tree/weld_mobilizer.h"
+#include "drake/systems/framework/cache_entry.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/continuous_state.h"
 #include "drake/systems/framework/leaf_system.h"
@@ -279,6 +282,52 @@ GTEST_TEST(MultibodyTreeSystem, CatchBadBehavior) {
       ".*MultibodyTreeSystem().*MultibodyTree was null.*");
 }
 
+// Returns the cache entry declared with the given description.
+const systems::CacheEntry& FindCacheEntry(
+    const MultibodyTreeSystem<double>& system, const std::string& description) {
+  for (int i = 0; i < system.num_cache_entries(); ++i) {
+    const systems::CacheEntry& entry =
+        system.get_cache_entry(systems::CacheIndex(i));
+    if (entry.description() == description) return entry;
+  }
+  DRAKE_ABORT_MSG("Cache entry not found.");
+}
+
+// Verifies that the kinematics cache entries have the advertised dependency
+// granularity: a velocity-only change must leave position kinematics valid,
+// while a position change invalidates both position and velocity kinematics.
+GTEST_TEST(MultibodyTreeSystem, KinematicsCacheInvalidation) {
+  const SpatialInertia<double> M_B(1.0, Vector3d::Zero(),
+                                   UnitInertia<double>::SolidSphere(0.1));
+  auto model = std::make_unique<MultibodyTree<double>>();
+  const RigidBody<double>& body = model->AddBody<RigidBody>(M_B);
+  model->AddJoint<RevoluteJoint>("Pin", model->world_body(), {}, body, {},
+                                 Vector3d::UnitZ());
+  MultibodyTreeSystem<double> system(std::move(model));
+  auto context = system.CreateDefaultContext();
+  auto& tree_context = dynamic_cast<MultibodyTreeContext<double>&>(*context);
+
+  const systems::CacheEntry& position_entry =
+      FindCacheEntry(system, "position kinematics");
+  const systems::CacheEntry& velocity_entry =
+      FindCacheEntry(system, "velocity kinematics");
+
+  system.EvalVelocityKinematics(*context);
+  EXPECT_FALSE(position_entry.is_out_of_date(*context));
+  EXPECT_FALSE(velocity_entry.is_out_of_date(*context));
+
+  // A velocity-only change leaves position kinematics valid.
+  tree_context.get_mutable_velocities().setConstant(1.0);
+  EXPECT_FALSE(position_entry.is_out_of_date(*context));
+  EXPECT_TRUE(velocity_entry.is_out_of_date(*context));
+
+  // A position change invalidates both.
+  system.EvalVelocityKinematics(*context);
+  tree_context.get_mutable_positions().setConstant(0.5);
+  EXPECT_TRUE(position_entry.is_out_of_date(*context));
+  EXPECT_TRUE(velocity_entry.is_out_of_date(*context));
+}
+
 GTEST_TEST(MultibodyTree, BackwardsCompatibility) {
   auto owned_tree = std::make_unique<MultibodyTree<double>>();
   auto* tree = owned_tree.get();
@@ -0,0 +1,148 @@
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/tree/multibody_tree.h"
+#include "drake/multibody/tree/multibody_tree_system.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/rigid_body.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::Isometry3d;
+using Eigen::Translation3d;
+using Eigen::Vector3d;
+using systems::Context;
+
+// The parallel level-scheduled kinematics sweeps must produce exactly the
+// same results as the serial ones: every node of a level writes only its own
+// cache entries and reads only entries written by previous levels, so the
+// computation is identical regardless of how a level's nodes are distributed
+// over threads. This fixture builds the same wide-level "hand" model twice
+// -- a palm carrying kNumFingers two-link fingers, so that the second and
+// third levels are kNumFingers nodes wide -- evaluating one model serially
+// and the other with several threads, and requires bit-identical position,
+// velocity and acceleration kinematics.
+class ParallelKinematicsTest : public ::testing::Test {
+ protected:
+  struct Model {
+    std::unique_ptr<internal::MultibodyTreeSystem<double>> system;
+    std::unique_ptr<Context<double>> context;
+    std::vector<const RevoluteJoint<double>*> joints;
+
+    const internal::MultibodyTree<double>& tree() const {
+      return internal::GetInternalTree(*system);
+    }
+  };
+
+  static constexpr int kNumFingers = 12;
+
+  static Model MakeModel(int num_threads) {
+    const SpatialInertia<double> M_palm(
+        1.0, Vector3d::Zero(), UnitInertia<double>::SolidSphere(0.2));
+    const SpatialInertia<double> M_link(
+        0.1, Vector3d::Zero(), UnitInertia<double>::SolidSphere(0.05));
+    auto tree = std::make_unique<internal::MultibodyTree<double>>();
+    Model model;
+    const RigidBody<double>& palm = tree->AddBody<RigidBody>(M_palm);
+    model.joints.push_back(&tree->AddJoint<RevoluteJoint>(
+        "Wrist", tree->world_body(), {}, palm, {}, Vector3d::UnitZ()));
+    for (int i = 0; i < kNumFingers; ++i) {
+      const std::string name = "Finger" + std::to_string(i);
+      const RigidBody<double>& proximal = tree->AddBody<RigidBody>(M_link);
+      const RigidBody<double>& distal = tree->AddBody<RigidBody>(M_link);
+      const Isometry3d X_PF{Translation3d(
+          0.2 * std::cos(0.5 * i), 0.2 * std::sin(0.5 * i), 0.0)};
+      model.joints.push_back(&tree->AddJoint<RevoluteJoint>(
+          name + "Proximal", palm, X_PF, proximal, {}, Vector3d::UnitY()));
+      model.joints.push_back(&tree->AddJoint<RevoluteJoint>(
+          name + "Distal", proximal,
+          Isometry3d{Translation3d(0.0, 0.0, -0.15)}, distal, {},
+          Vector3d::UnitY()));
+    }
+    tree->set_num_kinematics_threads(num_threads);
+    model.system = std::make_unique<internal::MultibodyTreeSystem<double>>(
+        std::move(tree));
+    model.context = model.system->CreateDefaultContext();
+    return model;
+  }
+
+  // Sets the same, trial-dependent, arbitrary state on `model`.
+  static void SetArbitraryState(int trial, Model* model) {
+    for (int i = 0; i < static_cast<int>(model->joints.size()); ++i) {
+      model->joints[i]->set_angle(
+          model->context.get(), 0.3 * i - 1.1 + 0.01 * trial);
+      model->joints[i]->set_angular_rate(
+          model->context.get(), -0.2 * i + 0.7 - 0.02 * trial);
+    }
+  }
+};
+
+TEST_F(ParallelKinematicsTest, BitIdenticalWithSerial) {
+  Model serial = MakeModel(1);
+  Model parallel = MakeModel(4);
+  ASSERT_EQ(parallel.tree().num_kinematics_threads(), 4);
+  const int num_bodies = serial.tree().num_bodies();
+  const int nv = serial.tree().num_velocities();
+  ASSERT_EQ(num_bodies, 2 + 2 * kNumFingers);
+
+  // Several trials at different states: thread scheduling must never leak
+  // into the results.
+  for (int trial = 0; trial < 5; ++trial) {
+    SetArbitraryState(trial, &serial);
+    SetArbitraryState(trial, &parallel);
+
+    // Position and velocity kinematics, body by body. The zero tolerance
+    // requests exact, bit-identical equality.
+    for (BodyIndex body_index(1); body_index < num_bodies; ++body_index) {
+      const Body<double>& body_s = serial.tree().get_body(body_index);
+      const Body<double>& body_p = parallel.tree().get_body(body_index);
+      EXPECT_TRUE(CompareMatrices(
+          parallel.tree().EvalBodyPoseInWorld(*parallel.context, body_p)
+              .matrix(),
+          serial.tree().EvalBodyPoseInWorld(*serial.context, body_s)
+              .matrix(),
+          0.0));
+      EXPECT_TRUE(CompareMatrices(
+          parallel.tree()
+              .EvalBodySpatialVelocityInWorld(*parallel.context, body_p)
+              .get_coeffs(),
+          serial.tree()
+              .EvalBodySpatialVelocityInWorld(*serial.context, body_s)
+              .get_coeffs(),
+          0.0));
+    }
+
+    // Acceleration kinematics for an arbitrary vdot.
+    VectorX<double> vdot(nv);
+    for (int i = 0; i < nv; ++i) vdot(i) = std::sin(i + trial);
+    std::vector<SpatialAcceleration<double>> A_WB_serial(num_bodies);
+    serial.tree().CalcSpatialAccelerationsFromVdot(
+        *serial.context,
+        serial.tree().EvalPositionKinematics(*serial.context),
+        serial.tree().EvalVelocityKinematics(*serial.context),
+        vdot, &A_WB_serial);
+    std::vector<SpatialAcceleration<double>> A_WB_parallel(num_bodies);
+    parallel.tree().CalcSpatialAccelerationsFromVdot(
+        *parallel.context,
+        parallel.tree().EvalPositionKinematics(*parallel.context),
+        parallel.tree().EvalVelocityKinematics(*parallel.context),
+        vdot, &A_WB_parallel);
+    for (int i = 0; i < num_bodies; ++i) {
+      EXPECT_TRUE(CompareMatrices(
+          A_WB_parallel[i].get_coeffs(), A_WB_serial[i].get_coeffs(), 0.0));
+    }
+  }
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
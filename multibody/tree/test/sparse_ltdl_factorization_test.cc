@@ -0,0 +1,115 @@
+#include "drake/multibody/tree/sparse_ltdl_factorization.h"
+
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+constexpr double kEps = std::numeric_limits<double>::epsilon();
+
+// Builds a symmetric positive definite matrix whose sparsity pattern is
+// exactly the branch-induced pattern implied by the expanded parent array
+// lambda. Each dof i contributes an outer product supported on its ancestor
+// chain, mimicking how composite inertias couple a dof with its ancestors.
+MatrixXd MakeMassMatrixLikeMatrix(const std::vector<int>& lambda) {
+  const int nv = static_cast<int>(lambda.size());
+  MatrixXd M = MatrixXd::Zero(nv, nv);
+  for (int i = 0; i < nv; ++i) {
+    // Collect the ancestor chain of dof i, including i itself.
+    std::vector<int> chain;
+    for (int j = i; j >= 0; j = lambda[j]) chain.push_back(j);
+    VectorXd h = VectorXd::Zero(nv);
+    for (int k = 0; k < static_cast<int>(chain.size()); ++k) {
+      h(chain[k]) = 1.0 / (1.0 + k) + 0.3 * ((i + k) % 3);
+    }
+    M += h * h.transpose();
+  }
+  // Add a diagonal term to guarantee positive definiteness.
+  M += VectorXd::Constant(nv, 0.1).asDiagonal();
+  return M;
+}
+
+// With a chain topology (lambda(i) = i - 1) the mass matrix is dense and the
+// factorization must match a dense solve.
+GTEST_TEST(SparseLtdlFactorization, ChainTopology) {
+  const std::vector<int> lambda = {-1, 0, 1, 2, 3, 4};
+  const MatrixXd M = MakeMassMatrixLikeMatrix(lambda);
+
+  SparseLtdlFactorization<double> ltdl(lambda);
+  EXPECT_FALSE(ltdl.is_factorized());
+  ltdl.Factorize(M);
+  EXPECT_TRUE(ltdl.is_factorized());
+
+  const VectorXd b = VectorXd::LinSpaced(6, -1.0, 2.5);
+  const VectorXd x = ltdl.Solve(b);
+  const VectorXd x_expected = M.ldlt().solve(b);
+  EXPECT_TRUE(CompareMatrices(x, x_expected, 64 * kEps,
+                              MatrixCompareType::relative));
+}
+
+// A branched topology: a floating base (dofs 0-2 in a chain for this test)
+// with two branches hanging from dof 2 and an extra branch from the root.
+// Verifies the solve against a dense factorization and that the factors
+// introduce no fill-in outside the branch-induced pattern.
+GTEST_TEST(SparseLtdlFactorization, BranchedTopology) {
+  //        0 ─ 1 ─ 2 ─ 3 ─ 4
+  //                 └─ 5 ─ 6
+  //        7 ─ 8   (second tree, e.g. a free body)
+  const std::vector<int> lambda = {-1, 0, 1, 2, 3, 2, 5, -1, 7};
+  const int nv = static_cast<int>(lambda.size());
+  const MatrixXd M = MakeMassMatrixLikeMatrix(lambda);
+
+  SparseLtdlFactorization<double> ltdl(lambda);
+  ltdl.Factorize(M);
+
+  const VectorXd b = VectorXd::LinSpaced(nv, 1.0, 2.0);
+  VectorXd x = b;
+  ltdl.SolveInPlace(&x);
+  const VectorXd x_expected = M.ldlt().solve(b);
+  EXPECT_TRUE(CompareMatrices(x, x_expected, 64 * kEps,
+                              MatrixCompareType::relative));
+
+  // Verify that off-pattern entries of M are zero, i.e. the test matrix has
+  // the sparsity this class is designed for: M(i, j) != 0, j < i, only when
+  // j is an ancestor of i.
+  for (int i = 0; i < nv; ++i) {
+    std::vector<bool> is_ancestor(nv, false);
+    for (int j = lambda[i]; j >= 0; j = lambda[j]) is_ancestor[j] = true;
+    for (int j = 0; j < i; ++j) {
+      if (!is_ancestor[j]) EXPECT_EQ(M(i, j), 0.0);
+    }
+  }
+}
+
+// The expanded parent array must satisfy -1 <= lambda(i) < i.
+GTEST_TEST(SparseLtdlFactorization, InvalidParentArray) {
+  EXPECT_THROW(SparseLtdlFactorization<double>({0}), std::exception);
+  EXPECT_THROW(SparseLtdlFactorization<double>({-1, 1}), std::exception);
+  EXPECT_THROW(SparseLtdlFactorization<double>({-2}), std::exception);
+}
+
+// Solves require a previous call to Factorize() and a properly sized rhs.
+GTEST_TEST(SparseLtdlFactorization, Preconditions) {
+  SparseLtdlFactorization<double> ltdl(std::vector<int>{-1, 0});
+  VectorXd b = VectorXd::Zero(2);
+  EXPECT_THROW(ltdl.SolveInPlace(&b), std::exception);
+  ltdl.Factorize(Eigen::Matrix2d::Identity());
+  VectorXd b_bad = VectorXd::Zero(3);
+  EXPECT_THROW(ltdl.SolveInPlace(&b_bad), std::exception);
+  EXPECT_THROW(ltdl.Factorize(MatrixXd::Identity(3, 3)), std::exception);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
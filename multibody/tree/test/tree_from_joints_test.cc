@@ -9,6 +9,8 @@
 
 #include "drake/common/eigen_types.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/benchmarks/acrobot/acrobot.h"
 #include "drake/multibody/tree/multibody_tree_system.h"
 #include "drake/multibody/tree/revolute_joint.h"
@@ -26,6 +28,7 @@ using benchmarks::Acrobot;
 using Eigen::Matrix2d;
 using Eigen::Vector2d;
 using Eigen::Vector3d;
+using Eigen::Vector4d;
 using std::make_unique;
 using std::unique_ptr;
 using systems::Context;
@@ -261,6 +264,24 @@ class PendulumTests : public ::testing::Test {
         H, H_expected, kTolerance, MatrixCompareType::relative));
   }
 
+  // Verifies the mass matrix computed by the Composite Rigid Body Algorithm
+  // implemented by MultibodyTree::CalcMassMatrix() against our benchmark.
+  void VerifyCalcMassMatrix(double theta1, double theta2) {
+    const double kTolerance = 10 * kEpsilon;
+    pendulum_.shoulder().set_angle(context_.get(), theta1);
+    pendulum_.elbow().set_angle(context_.get(), theta2);
+
+    // MultibodyTree mass matrix:
+    Matrix2d H;
+    tree().CalcMassMatrix(*context_, &H);
+
+    // Benchmark mass matrix:
+    Matrix2d H_expected = acrobot_benchmark_.CalcMassMatrix(theta2);
+
+    EXPECT_TRUE(CompareMatrices(
+        H, H_expected, kTolerance, MatrixCompareType::relative));
+  }
+
   // For the double pendulum model under test, it verifies the result returned
   // by UniformGravityFieldElement::CalcGravityGeneralizedForces() which
   // computes the generalized forces tau_g due to a uniform gravity field force
@@ -406,6 +427,133 @@ TEST_F(PendulumTests, CalcMassMatrixViaInverseDynamics) {
   VerifyCalcMassMatrixViaInverseDynamics(-M_PI / 7.0, M_PI / 4.0);
 }
 
+// Compute the mass matrix using the Composite Rigid Body Algorithm.
+TEST_F(PendulumTests, CalcMassMatrix) {
+  VerifyCalcMassMatrix(0.0, 0.0);
+  VerifyCalcMassMatrix(0.0, M_PI / 2.0);
+  VerifyCalcMassMatrix(0.0, M_PI / 3.0);
+  VerifyCalcMassMatrix(0.0, M_PI / 4.0);
+
+  // As in the inverse dynamics based test above, different shoulder angles
+  // verify that the mass matrix is a function of theta2 only.
+  VerifyCalcMassMatrix(M_PI / 3.0, 0.0);
+  VerifyCalcMassMatrix(M_PI / 3.0, M_PI / 2.0);
+  VerifyCalcMassMatrix(M_PI / 3.0, M_PI / 3.0);
+  VerifyCalcMassMatrix(M_PI / 3.0, M_PI / 4.0);
+
+  VerifyCalcMassMatrix(-M_PI / 7.0, 0.0);
+  VerifyCalcMassMatrix(-M_PI / 7.0, M_PI / 2.0);
+  VerifyCalcMassMatrix(-M_PI / 7.0, M_PI / 3.0);
+  VerifyCalcMassMatrix(-M_PI / 7.0, M_PI / 4.0);
+}
+
+// Solve M(q)⋅x = b with the O(n) articulated body algorithm and compare
+// against a dense solve using the benchmark mass matrix.
+TEST_F(PendulumTests, SolveMassMatrixViaArticulatedBodyAlgorithm) {
+  const double kTolerance = 50 * kEpsilon;
+  const double theta1 = M_PI / 3.0;
+  const double theta2 = M_PI / 4.0;
+  pendulum_.shoulder().set_angle(context_.get(), theta1);
+  pendulum_.elbow().set_angle(context_.get(), theta2);
+
+  const Vector2d b(1.0, -2.0);
+  Vector2d x;
+  tree().SolveMassMatrixViaArticulatedBodyAlgorithm(*context_, b, &x);
+
+  const Matrix2d H_expected = acrobot_benchmark_.CalcMassMatrix(theta2);
+  const Vector2d x_expected = H_expected.ldlt().solve(b);
+
+  EXPECT_TRUE(CompareMatrices(
+      x, x_expected, kTolerance, MatrixCompareType::relative));
+}
+
+// Verifies the batched inverse dynamics API against one-at-a-time calls to
+// CalcInverseDynamics(), including the multi-threaded code path.
+TEST_F(PendulumTests, CalcBatchInverseDynamics) {
+  const double kTolerance = 10 * kEpsilon;
+  const int kNumSamples = 5;
+  const int nq = tree().num_positions();
+  const int nv = tree().num_velocities();
+
+  MatrixX<double> q_batch(nq, kNumSamples);
+  MatrixX<double> v_batch(nv, kNumSamples);
+  MatrixX<double> vdot_batch(nv, kNumSamples);
+  for (int i = 0; i < kNumSamples; ++i) {
+    q_batch.col(i) = Vector2d(0.1 + 0.3 * i, -0.2 + 0.1 * i);
+    v_batch.col(i) = Vector2d(0.5 - 0.2 * i, 1.0 + 0.1 * i);
+    vdot_batch.col(i) = Vector2d(-1.0 + 0.4 * i, 2.0 - 0.3 * i);
+  }
+
+  MatrixX<double> tau_batch(nv, kNumSamples);
+  tree().CalcBatchInverseDynamics(
+      q_batch, v_batch, vdot_batch, 2 /* num_threads */, &tau_batch);
+
+  // The batched API does not include externally applied forces.
+  const MultibodyForces<double> no_applied_forces(tree());
+  for (int i = 0; i < kNumSamples; ++i) {
+    pendulum_.shoulder().set_angle(context_.get(), q_batch(0, i));
+    pendulum_.elbow().set_angle(context_.get(), q_batch(1, i));
+    pendulum_.shoulder().set_angular_rate(context_.get(), v_batch(0, i));
+    pendulum_.elbow().set_angular_rate(context_.get(), v_batch(1, i));
+    const VectorX<double> tau_expected = tree().CalcInverseDynamics(
+        *context_, vdot_batch.col(i), no_applied_forces);
+    EXPECT_TRUE(CompareMatrices(tau_batch.col(i), tau_expected, kTolerance,
+                                MatrixCompareType::relative));
+  }
+}
+
+// Verifies CalcInverseDynamicsPartials() against reference partials obtained
+// by differentiating the benchmark's closed-form inverse dynamics
+// tau = M(θ₂)v̇ + C(θ, v)v with AutoDiffXd.
+TEST_F(PendulumTests, CalcInverseDynamicsPartials) {
+  // The partials with respect to q and v are O(h²) central difference
+  // approximations; the tolerance is loose accordingly.
+  const double kTolerance = 1.0e-7;
+  const int nq = tree().num_positions();
+  const int nv = tree().num_velocities();
+
+  const Vector2d q(M_PI / 3.0, M_PI / 5.0);
+  const Vector2d v(0.7, -0.3);
+  const Vector2d vdot(1.5, -2.1);
+  pendulum_.shoulder().set_angle(context_.get(), q(0));
+  pendulum_.elbow().set_angle(context_.get(), q(1));
+  pendulum_.shoulder().set_angular_rate(context_.get(), v(0));
+  pendulum_.elbow().set_angular_rate(context_.get(), v(1));
+
+  MatrixX<double> dtau_dq(nv, nq);
+  MatrixX<double> dtau_dv(nv, nv);
+  MatrixX<double> dtau_dvdot(nv, nv);
+  tree().CalcInverseDynamicsPartials(
+      *context_, vdot, &dtau_dq, &dtau_dv, &dtau_dvdot);
+
+  // Reference partials from the benchmark, with the state as the independent
+  // variables. The benchmark model has zero joint damping, matching the tree
+  // model's inverse dynamics with no applied forces.
+  const Acrobot<AutoDiffXd> benchmark_autodiff(
+      Vector3<AutoDiffXd>::UnitZ(), Vector3<AutoDiffXd>::UnitY(),
+      pendulum_.mass1(), pendulum_.mass2(),
+      pendulum_.length1(), pendulum_.length2(),
+      pendulum_.half_length1(), pendulum_.half_length2(),
+      pendulum_.Ic1(), pendulum_.Ic2(), 0.0, 0.0,
+      pendulum_.gravity());
+  const Vector4d x0(q(0), q(1), v(0), v(1));
+  const auto x_autodiff = math::initializeAutoDiff(x0);
+  const Matrix2<AutoDiffXd> M = benchmark_autodiff.CalcMassMatrix(
+      x_autodiff(1));
+  const Vector2<AutoDiffXd> tau =
+      M * vdot.cast<AutoDiffXd>() +
+      benchmark_autodiff.CalcCoriolisVector(
+          x_autodiff(0), x_autodiff(1), x_autodiff(2), x_autodiff(3));
+  const MatrixX<double> dtau_dx = math::autoDiffToGradientMatrix(tau);
+
+  EXPECT_TRUE(CompareMatrices(dtau_dq, dtau_dx.leftCols(nq), kTolerance,
+                              MatrixCompareType::absolute));
+  EXPECT_TRUE(CompareMatrices(dtau_dv, dtau_dx.rightCols(nv), kTolerance,
+                              MatrixCompareType::absolute));
+  EXPECT_TRUE(CompareMatrices(dtau_dvdot, math::autoDiffToValueMatrix(M),
+                              10 * kEpsilon, MatrixCompareType::relative));
+}
+
 // Verify the correct result from
 // UniformGravityFieldElement::CalcGravityGeneralizedForces().
 TEST_F(PendulumTests, VerifyGravityGeneralizedForces) {
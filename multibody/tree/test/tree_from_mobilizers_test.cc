@@ -4,6 +4,7 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -622,6 +623,16 @@ class PendulumKinematicTests : public PendulumTests {
         shoulder_angle, elbow_angle, shoulder_rate, elbow_rate);
     EXPECT_TRUE(CompareMatrices(
         C, C_expected, kTolerance, MatrixCompareType::relative));
+
+    // The workspace-based signature, meant for high rate evaluations without
+    // heap allocation, must produce exactly the same result.
+    vector<SpatialAcceleration<double>> Ab_WB_scratch;
+    vector<SpatialForce<double>> F_BMo_W_scratch;
+    Vector2d C_scratch;
+    tree().CalcBiasTerm(*context_, &Ab_WB_scratch, &F_BMo_W_scratch,
+                        &C_scratch);
+    EXPECT_TRUE(CompareMatrices(
+        C_scratch, C, kEpsilon, MatrixCompareType::relative));
   }
 
   /// This method verifies the correctness of
@@ -0,0 +1,313 @@
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/rotation_matrix.h"
+#include "drake/multibody/tree/multibody_tree.h"
+#include "drake/multibody/tree/multibody_tree_system.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/rigid_body.h"
+#include "drake/multibody/tree/weld_joint.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::AngleAxisd;
+using Eigen::Isometry3d;
+using Eigen::MatrixXd;
+using Eigen::Translation3d;
+using Eigen::Vector2d;
+using Eigen::Vector3d;
+using systems::Context;
+
+// Tests the collapsing of welded bodies into composite bodies performed at
+// Finalize() time, see MultibodyTree::CollapseWeldedBodies().
+//
+// Two equivalent models are built:
+//  - A "welded" model: world ─(revolute)─ link1 ─(weld)─ bracket, with a
+//    sensor body welded to the bracket (a chain of two welds) and link2
+//    attached to the bracket by a revolute joint (a mobilized body whose
+//    parent is welded).
+//  - A "lumped" model with only link1 and link2, where the bracket and
+//    sensor spatial inertias were lumped into link1 by hand and the elbow
+//    joint was re-attached with the composed fixed offset.
+// Kinematics and dynamics of the two models must match.
+class WeldCollapsingTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    // Bodies have their com at the body origin so that the parallel axis
+    // contributions below come only from the weld offsets.
+    const SpatialInertia<double> M_link1(
+        1.0, Vector3d::Zero(), UnitInertia<double>::SolidSphere(0.2));
+    const SpatialInertia<double> M_bracket(
+        0.7, Vector3d::Zero(), UnitInertia<double>::SolidSphere(0.1));
+    const SpatialInertia<double> M_sensor(
+        0.3, Vector3d::Zero(), UnitInertia<double>::SolidSphere(0.05));
+    const SpatialInertia<double> M_link2(
+        0.5, Vector3d::Zero(), UnitInertia<double>::SolidSphere(0.15));
+
+    {  // The welded model.
+      auto model = std::make_unique<internal::MultibodyTree<double>>();
+      link1_w_ = &model->AddBody<RigidBody>(M_link1);
+      bracket_ = &model->AddBody<RigidBody>(M_bracket);
+      sensor_ = &model->AddBody<RigidBody>(M_sensor);
+      link2_w_ = &model->AddBody<RigidBody>(M_link2);
+      shoulder_w_ = &model->AddJoint<RevoluteJoint>(
+          "Shoulder", model->world_body(), {}, *link1_w_, {},
+          Vector3d::UnitZ());
+      model->AddJoint<WeldJoint>(
+          "BracketWeld", *link1_w_, {}, *bracket_, {}, X_L1B_);
+      model->AddJoint<WeldJoint>(
+          "SensorWeld", *bracket_, {}, *sensor_, {}, X_BS_);
+      elbow_w_ = &model->AddJoint<RevoluteJoint>(
+          "Elbow", *bracket_, {}, *link2_w_, {}, Vector3d::UnitZ());
+      welded_system_ = std::make_unique<internal::MultibodyTreeSystem<double>>(
+          std::move(model));
+      welded_context_ = welded_system_->CreateDefaultContext();
+    }
+
+    {  // The equivalent lumped model.
+      // Lump the bracket and sensor inertias into link1: re-express in L1 and
+      // shift to L1's origin. R_L1B is the identity, so only the sensor needs
+      // re-expression by R_L1S = R_BS.
+      SpatialInertia<double> M_link1_eff = M_link1;
+      M_link1_eff += M_bracket.Shift(-X_L1B_.translation());
+      const Isometry3d X_L1S = X_L1B_ * X_BS_;
+      M_link1_eff += M_sensor
+          .ReExpress(math::RotationMatrix<double>(X_L1S.linear()))
+          .Shift(-X_L1S.translation());
+
+      auto model = std::make_unique<internal::MultibodyTree<double>>();
+      link1_l_ = &model->AddBody<RigidBody>(M_link1_eff);
+      link2_l_ = &model->AddBody<RigidBody>(M_link2);
+      shoulder_l_ = &model->AddJoint<RevoluteJoint>(
+          "Shoulder", model->world_body(), {}, *link1_l_, {},
+          Vector3d::UnitZ());
+      // In the welded model the elbow's inboard frame is the bracket frame;
+      // here it is at the bracket's fixed pose in link1.
+      elbow_l_ = &model->AddJoint<RevoluteJoint>(
+          "Elbow", *link1_l_, X_L1B_, *link2_l_, {}, Vector3d::UnitZ());
+      lumped_system_ = std::make_unique<internal::MultibodyTreeSystem<double>>(
+          std::move(model));
+      lumped_context_ = lumped_system_->CreateDefaultContext();
+    }
+  }
+
+  const internal::MultibodyTree<double>& welded_tree() const {
+    return internal::GetInternalTree(*welded_system_);
+  }
+
+  const internal::MultibodyTree<double>& lumped_tree() const {
+    return internal::GetInternalTree(*lumped_system_);
+  }
+
+  // Sets both models to the same state.
+  void SetState(const Vector2d& q, const Vector2d& v) {
+    shoulder_w_->set_angle(welded_context_.get(), q(0));
+    elbow_w_->set_angle(welded_context_.get(), q(1));
+    shoulder_w_->set_angular_rate(welded_context_.get(), v(0));
+    elbow_w_->set_angular_rate(welded_context_.get(), v(1));
+    shoulder_l_->set_angle(lumped_context_.get(), q(0));
+    elbow_l_->set_angle(lumped_context_.get(), q(1));
+    shoulder_l_->set_angular_rate(lumped_context_.get(), v(0));
+    elbow_l_->set_angular_rate(lumped_context_.get(), v(1));
+  }
+
+ protected:
+  std::unique_ptr<internal::MultibodyTreeSystem<double>> welded_system_;
+  std::unique_ptr<Context<double>> welded_context_;
+  std::unique_ptr<internal::MultibodyTreeSystem<double>> lumped_system_;
+  std::unique_ptr<Context<double>> lumped_context_;
+
+  const RigidBody<double>* link1_w_{nullptr};
+  const RigidBody<double>* bracket_{nullptr};
+  const RigidBody<double>* sensor_{nullptr};
+  const RigidBody<double>* link2_w_{nullptr};
+  const RevoluteJoint<double>* shoulder_w_{nullptr};
+  const RevoluteJoint<double>* elbow_w_{nullptr};
+
+  const RigidBody<double>* link1_l_{nullptr};
+  const RigidBody<double>* link2_l_{nullptr};
+  const RevoluteJoint<double>* shoulder_l_{nullptr};
+  const RevoluteJoint<double>* elbow_l_{nullptr};
+
+  // Fixed pose of the bracket frame B in link1's frame L1 and of the sensor
+  // frame S in B. The sensor weld includes a rotation so that re-expression
+  // of its inertia is exercised.
+  const Isometry3d X_L1B_{Translation3d(0.0, -1.0, 0.0)};
+  const Isometry3d X_BS_{Translation3d(0.1, -0.5, 0.0) *
+                         AngleAxisd(0.3, Vector3d::UnitX())};
+};
+
+// Verifies the weld-composite assignments made at Finalize() time.
+TEST_F(WeldCollapsingTest, CompositeTopology) {
+  const internal::MultibodyTreeTopology& topology = welded_tree().get_topology();
+  auto node = [&](const RigidBody<double>* body) ->
+      const internal::BodyNodeTopology& {
+    return topology.get_body_node(topology.get_body(body->index()).body_node);
+  };
+  // Mobilized bodies are their own composites.
+  EXPECT_FALSE(node(link1_w_).is_welded_to_composite());
+  EXPECT_EQ(node(link1_w_).composite_body_node, node(link1_w_).index);
+  EXPECT_FALSE(node(link2_w_).is_welded_to_composite());
+  // The bracket and the sensor (welded through the bracket) both belong to
+  // the composite body rooted at link1.
+  EXPECT_TRUE(node(bracket_).is_welded_to_composite());
+  EXPECT_EQ(node(bracket_).composite_body_node, node(link1_w_).index);
+  EXPECT_TRUE(node(sensor_).is_welded_to_composite());
+  EXPECT_EQ(node(sensor_).composite_body_node, node(link1_w_).index);
+}
+
+// Poses of welded bodies must equal the composition of the composite body's
+// pose with the constant transforms precomputed at Finalize() time.
+TEST_F(WeldCollapsingTest, PositionKinematics) {
+  const double kTolerance = 10 * std::numeric_limits<double>::epsilon();
+  SetState(Vector2d(0.3, -0.4), Vector2d::Zero());
+  const Isometry3d& X_WL1 =
+      welded_tree().EvalBodyPoseInWorld(*welded_context_, *link1_w_);
+  const Isometry3d& X_WB =
+      welded_tree().EvalBodyPoseInWorld(*welded_context_, *bracket_);
+  const Isometry3d& X_WS =
+      welded_tree().EvalBodyPoseInWorld(*welded_context_, *sensor_);
+  EXPECT_TRUE(CompareMatrices(
+      X_WB.matrix(), (X_WL1 * X_L1B_).matrix(), kTolerance));
+  EXPECT_TRUE(CompareMatrices(
+      X_WS.matrix(), (X_WL1 * X_L1B_ * X_BS_).matrix(), kTolerance));
+}
+
+// Spatial velocities of welded bodies are rigid shifts of the composite
+// body's spatial velocity.
+TEST_F(WeldCollapsingTest, VelocityKinematics) {
+  const double kTolerance = 10 * std::numeric_limits<double>::epsilon();
+  SetState(Vector2d(0.3, -0.4), Vector2d(0.5, -0.2));
+  // Link1 rotates about the z-axis through the world's origin, therefore for
+  // any point Q rigidly attached to it: w_WQ = w_WL1, v_WQo = w_WL1 x p_WQo.
+  const Vector3d w_WL1(0.0, 0.0, 0.5);
+  const Isometry3d& X_WS =
+      welded_tree().EvalBodyPoseInWorld(*welded_context_, *sensor_);
+  const SpatialVelocity<double>& V_WS =
+      welded_tree().EvalBodySpatialVelocityInWorld(*welded_context_, *sensor_);
+  EXPECT_TRUE(CompareMatrices(V_WS.rotational(), w_WL1, kTolerance));
+  EXPECT_TRUE(CompareMatrices(
+      V_WS.translational(), w_WL1.cross(X_WS.translation()), kTolerance));
+}
+
+// The welded model and the hand-lumped model must produce the same mass
+// matrix and inverse dynamics.
+TEST_F(WeldCollapsingTest, MassMatrixAndInverseDynamics) {
+  const double kTolerance = 1.0e-13;
+  SetState(Vector2d(0.3, -0.4), Vector2d(0.5, -0.2));
+
+  MatrixXd M_welded(2, 2);
+  welded_tree().CalcMassMatrix(*welded_context_, &M_welded);
+  MatrixXd M_lumped(2, 2);
+  lumped_tree().CalcMassMatrix(*lumped_context_, &M_lumped);
+  EXPECT_TRUE(CompareMatrices(M_welded, M_lumped, kTolerance));
+
+  // Cross-check the CRBA computed matrix against the O(n²) algorithm based
+  // on inverse dynamics, which exercises the collapsed acceleration sweep.
+  MatrixXd M_id(2, 2);
+  welded_tree().CalcMassMatrixViaInverseDynamics(*welded_context_, &M_id);
+  EXPECT_TRUE(CompareMatrices(M_welded, M_id, kTolerance));
+
+  // Inverse dynamics with non-zero velocities exercises the velocity
+  // dependent terms of the collapsed velocity/acceleration sweeps.
+  const Vector2d vdot(1.1, -0.7);
+  const MultibodyForces<double> no_applied_forces_w(welded_tree());
+  const VectorX<double> tau_welded = welded_tree().CalcInverseDynamics(
+      *welded_context_, vdot, no_applied_forces_w);
+  const MultibodyForces<double> no_applied_forces_l(lumped_tree());
+  const VectorX<double> tau_lumped = lumped_tree().CalcInverseDynamics(
+      *lumped_context_, vdot, no_applied_forces_l);
+  EXPECT_TRUE(CompareMatrices(tau_welded, tau_lumped, kTolerance));
+}
+
+// Regression for the branch-specific code paths of the CRBA implemented by
+// CalcMassMatrix(): the multi-child composite-inertia accumulation and the
+// off-diagonal walk across welded (zero-dof) ancestors. A branched model
+// with welds interleaved between mobilized joints is cross-checked at
+// several configurations against the independent O(n²) algorithm based on
+// inverse dynamics.
+GTEST_TEST(CrbaBranchedModelTest, CompareWithInverseDynamics) {
+  const SpatialInertia<double> M_big(
+      1.2, Vector3d::Zero(), UnitInertia<double>::SolidSphere(0.2));
+  const SpatialInertia<double> M_small(
+      0.4, Vector3d::Zero(), UnitInertia<double>::SolidSphere(0.1));
+
+  // A torso with three outboard branches: a head and, hanging from a welded
+  // shoulder bracket, a two-joint left arm and a one-joint right arm.
+  auto model = std::make_unique<internal::MultibodyTree<double>>();
+  const RigidBody<double>& torso = model->AddBody<RigidBody>(M_big);
+  const RigidBody<double>& bracket = model->AddBody<RigidBody>(M_small);
+  const RigidBody<double>& upper_arm_l = model->AddBody<RigidBody>(M_big);
+  const RigidBody<double>& elbow_bracket_l =
+      model->AddBody<RigidBody>(M_small);
+  const RigidBody<double>& lower_arm_l = model->AddBody<RigidBody>(M_big);
+  const RigidBody<double>& upper_arm_r = model->AddBody<RigidBody>(M_big);
+  const RigidBody<double>& head = model->AddBody<RigidBody>(M_small);
+
+  std::vector<const RevoluteJoint<double>*> joints;
+  joints.push_back(&model->AddJoint<RevoluteJoint>(
+      "TorsoYaw", model->world_body(), {}, torso, {}, Vector3d::UnitZ()));
+  // The bracket joins the torso's composite body and roots both arms, so
+  // that the composite inertia accumulation sees multiple children.
+  model->AddJoint<WeldJoint>(
+      "BracketWeld", torso, {}, bracket, {},
+      Isometry3d{Translation3d(0.0, 0.1, 0.4) *
+                 AngleAxisd(0.2, Vector3d::UnitY())});
+  joints.push_back(&model->AddJoint<RevoluteJoint>(
+      "ShoulderL", bracket, Isometry3d{Translation3d(0.0, 0.3, 0.0)},
+      upper_arm_l, {}, Vector3d::UnitX()));
+  // A weld interleaved between two mobilized joints, so that the
+  // off-diagonal ancestor walk crosses a welded (zero-dof) body.
+  model->AddJoint<WeldJoint>(
+      "ElbowBracketWeldL", upper_arm_l, {}, elbow_bracket_l, {},
+      Isometry3d{Translation3d(0.0, 0.0, -0.5) *
+                 AngleAxisd(-0.4, Vector3d::UnitX())});
+  joints.push_back(&model->AddJoint<RevoluteJoint>(
+      "ElbowL", elbow_bracket_l, {}, lower_arm_l, {}, Vector3d::UnitY()));
+  joints.push_back(&model->AddJoint<RevoluteJoint>(
+      "ShoulderR", bracket, Isometry3d{Translation3d(0.0, -0.3, 0.0)},
+      upper_arm_r, {}, Vector3d::UnitY()));
+  joints.push_back(&model->AddJoint<RevoluteJoint>(
+      "Neck", torso, Isometry3d{Translation3d(0.0, 0.0, 0.6)}, head, {},
+      Vector3d::UnitX()));
+
+  auto system = std::make_unique<internal::MultibodyTreeSystem<double>>(
+      std::move(model));
+  std::unique_ptr<Context<double>> context = system->CreateDefaultContext();
+  const internal::MultibodyTree<double>& tree =
+      internal::GetInternalTree(*system);
+
+  const int nv = tree.num_velocities();
+  ASSERT_EQ(nv, 5);
+  ASSERT_EQ(static_cast<int>(joints.size()), nv);
+
+  const double kTolerance = 1.0e-13;
+  const std::vector<VectorX<double>> configurations = {
+      VectorX<double>::Zero(nv),
+      (VectorX<double>(nv) << 0.3, -0.4, 0.5, 1.1, -0.2).finished(),
+      (VectorX<double>(nv) << -1.2, 0.7, -0.9, 0.4, 2.1).finished(),
+      (VectorX<double>(nv) << 1.57, -1.57, 0.1, -2.4, 0.8).finished()};
+  for (const VectorX<double>& q : configurations) {
+    for (int i = 0; i < nv; ++i) joints[i]->set_angle(context.get(), q(i));
+
+    MatrixXd M_crba(nv, nv);
+    tree.CalcMassMatrix(*context, &M_crba);
+    MatrixXd M_id(nv, nv);
+    tree.CalcMassMatrixViaInverseDynamics(*context, &M_id);
+
+    EXPECT_TRUE(CompareMatrices(M_crba, M_id, kTolerance));
+    EXPECT_TRUE(CompareMatrices(M_crba, M_crba.transpose(), kTolerance));
+  }
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -53,20 +53,17 @@ class VelocityKinematicsCache {
     Allocate();
     DRAKE_ASSERT_VOID(InitializeToNaN());
     // Sets defaults.
-    V_WB_pool_[world_index()].SetZero();  // World's velocity is always zero.
-    V_FM_pool_[world_index()].SetNaN();  // It must never be used.
-    V_PB_W_pool_[world_index()].SetNaN();  // It must never be used.
+    // World's velocity is always zero.
+    pool_[kVWBSlot * num_nodes_ + world_index()].SetZero();
+    // The world entries of the remaining pools must never be used.
+    pool_[kVFMSlot * num_nodes_ + world_index()].SetNaN();
+    pool_[kVPBWSlot * num_nodes_ + world_index()].SetNaN();
   }
 
   /// Initializes `this` %VelocityKinematicsCache as if all generalized
   /// velocities of the corresponding MultibodyTree model were zero.
   void InitializeToZero() {
-    for (BodyNodeIndex body_node_index(0); body_node_index < num_nodes_;
-         ++body_node_index) {
-      V_WB_pool_[body_node_index].SetZero();
-      V_FM_pool_[body_node_index].SetZero();
-      V_PB_W_pool_[body_node_index].SetZero();
-    }
+    for (SpatialVelocity<T>& V : pool_) V.SetZero();
   }
 
   /// Returns a constant reference to the spatial velocity `V_WB` of the body B
@@ -78,13 +75,13 @@ class VelocityKinematicsCache {
   ///                 expressed in the world frame W.
   const SpatialVelocity<T>& get_V_WB(BodyNodeIndex body_node_index) const {
     DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
-    return V_WB_pool_[body_node_index];
+    return pool_[kVWBSlot * num_nodes_ + body_node_index];
   }
 
   /// Mutable version of get_V_WB().
   SpatialVelocity<T>& get_mutable_V_WB(BodyNodeIndex body_node_index) {
     DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
-    return V_WB_pool_[body_node_index];
+    return pool_[kVWBSlot * num_nodes_ + body_node_index];
   }
 
   /// Returns a const reference to the across-mobilizer (associated with node
@@ -92,13 +89,13 @@ class VelocityKinematicsCache {
   /// inboard frame F.
   const SpatialVelocity<T>& get_V_FM(BodyNodeIndex body_node_index) const {
     DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
-    return V_FM_pool_[body_node_index];
+    return pool_[kVFMSlot * num_nodes_ + body_node_index];
   }
 
   /// Mutable version of get_V_FM().
   SpatialVelocity<T>& get_mutable_V_FM(BodyNodeIndex body_node_index) {
     DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
-    return V_FM_pool_[body_node_index];
+    return pool_[kVFMSlot * num_nodes_ + body_node_index];
   }
 
   /// Returns a const reference to the spatial velocity `V_PB_W` of the
@@ -106,47 +103,47 @@ class VelocityKinematicsCache {
   /// frame P, expressed in the world frame W.
   const SpatialVelocity<T>& get_V_PB_W(BodyNodeIndex body_node_index) const {
     DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
-    return V_PB_W_pool_[body_node_index];
+    return pool_[kVPBWSlot * num_nodes_ + body_node_index];
   }
 
   /// Mutable version of get_V_PB_W().
   SpatialVelocity<T>& get_mutable_V_PB_W(BodyNodeIndex body_node_index) {
     DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
-    return V_PB_W_pool_[body_node_index];
+    return pool_[kVPBWSlot * num_nodes_ + body_node_index];
   }
 
  private:
-  // Pools store entries in the same order multibody tree nodes are
-  // ordered in the tree, i.e. in BFT (Breadth-First Traversal) order. Therefore
-  // clients of this class will access entries by BodyNodeIndex, see
-  // `get_V_WB()` for instance.
-
-  // The type of the pools for storing spatial velocities.
+  // Pool layout:
+  // All pools live in a single contiguous arena so that a full cache update
+  // touches one allocation instead of several scattered ones. Within the
+  // arena each pool occupies a contiguous block of num_nodes_ entries, with
+  // entries in the same order multibody tree nodes are ordered in the tree,
+  // i.e. in BFT (Breadth-First Traversal) order. Therefore clients of this
+  // class access entries by BodyNodeIndex, see `get_V_WB()` for instance.
+  // The spatial velocity for node i of pool `slot` is stored at
+  // pool_[slot * num_nodes_ + i].
+
+  // The type of the arena for storing spatial velocities.
   typedef std::vector<SpatialVelocity<T>> SpatialVelocity_PoolType;
 
-  // Allocates resources for this position kinematics cache.
+  // Slot of each pool within the arena.
+  enum PoolSlot { kVWBSlot = 0, kVFMSlot, kVPBWSlot, kNumSlots };
+
+  // Allocates resources for this velocity kinematics cache.
   void Allocate() {
-    V_WB_pool_.resize(num_nodes_);
-    V_FM_pool_.resize(num_nodes_);
-    V_PB_W_pool_.resize(num_nodes_);
+    pool_.resize(kNumSlots * num_nodes_);
   }
 
   // Initializes all pools to have NaN values to ease bug detection when entries
   // are accidentally left uninitialized.
   void InitializeToNaN() {
-    for (BodyNodeIndex body_node_index(0); body_node_index < num_nodes_;
-         ++body_node_index) {
-      V_WB_pool_[body_node_index].SetNaN();
-      V_FM_pool_[body_node_index].SetNaN();
-      V_PB_W_pool_[body_node_index].SetNaN();
-    }
+    for (SpatialVelocity<T>& V : pool_) V.SetNaN();
   }
 
   // Number of body nodes in the corresponding MultibodyTree.
   int num_nodes_{0};
-  SpatialVelocity_PoolType V_WB_pool_;
-  SpatialVelocity_PoolType V_FM_pool_;
-  SpatialVelocity_PoolType V_PB_W_pool_;
+  // Single arena holding the V_WB, V_FM and V_PB_W pools, in that order.
+  SpatialVelocity_PoolType pool_;
 };
 
 }  // namespace internal
@@ -68,23 +68,42 @@ void DoConvert(
   const float cy = camera_info.center_y();
   const float fx_inv = 1.f / camera_info.focal_x();
   const float fy_inv = 1.f / camera_info.focal_y();
-  const Isometry3f X_PC = camera_pose ?
+  const bool has_pose = (camera_pose != nullptr);
+  const Isometry3f X_PC = has_pose ?
       camera_pose->GetAsIsometry3().cast<float>() :
       Isometry3f::Identity();
+  const Eigen::Matrix3f R_PC = X_PC.linear();
+  const Vector3f p_PC = X_PC.translation();
+
+  // Tabulate the per-column and per-row back-projection factors once, so the
+  // pixel loop is just a scale of the precomputed ray plus the (optional)
+  // pose; the pinhole divides and pixel-center offsets move out of the O(N)
+  // loop entirely.
+  Eigen::VectorXf ray_x(width);
+  for (int u = 0; u < width; ++u) {
+    ray_x(u) = (u - cx) * fx_inv;
+  }
+  Eigen::VectorXf ray_y(height);
+  for (int v = 0; v < height; ++v) {
+    ray_y(v) = (v - cy) * fy_inv;
+  }
 
   for (int v = 0; v < height; ++v) {
+    // Depth images are single-channel, so a row is contiguous memory.
+    const auto* const row = depth_image.at(0, v);
+    const float ry = ray_y(v);
+    const int row_col = v * width;
     for (int u = 0; u < width; ++u) {
-      const int col = v * width + u;
-      const auto z = depth_image.at(u, v)[0];
+      const int col = row_col + u;
+      const auto z = row[u];
       if ((z == ImageTraits<pixel_type>::kTooClose) ||
           (z == ImageTraits<pixel_type>::kTooFar)) {
         output_xyz.col(col).array() = std::numeric_limits<float>::infinity();
       } else {
         // N.B. This clause handles both true depths *and* NaNs.
-        output_xyz.col(col) = X_PC * Vector3f(
-            scale * z * (u - cx) * fx_inv,
-            scale * z * (v - cy) * fy_inv,
-            scale * z);
+        const float sz = scale * z;
+        const Vector3f p_C(sz * ray_x(u), sz * ry, sz);
+        output_xyz.col(col) = has_pose ? Vector3f(R_PC * p_C + p_PC) : p_C;
       }
     }
   }
@@ -1,6 +1,7 @@
 #include "drake/perception/point_cloud.h"
 
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
@@ -235,6 +236,109 @@ void PointCloud::Expand(
   resize(new_size, skip_initialization);
 }
 
+void PointCloud::TransformInPlace(const Isometry3<T>& X_NO) {
+  DRAKE_DEMAND(has_xyzs());
+  const Matrix3<T> R_NO = X_NO.linear();
+  const Vector3<T> p_NO = X_NO.translation();
+  // Column-at-a-time with fixed-size operands keeps Eigen on its vectorized
+  // small-matrix kernels and avoids materializing a 3xN temporary.
+  auto xyzs = mutable_xyzs();
+  for (int i = 0; i < size_; ++i) {
+    xyzs.col(i) = R_NO * xyzs.col(i) + p_NO;
+  }
+  if (has_normals()) {
+    auto normals = mutable_normals();
+    for (int i = 0; i < size_; ++i) {
+      normals.col(i) = R_NO * normals.col(i);
+    }
+  }
+}
+
+namespace {
+
+// Compacts the columns listed in `kept` to the front of `data` (for the
+// in-place case) or copies them into `out` (when `out` differs from `data`).
+// Hoisting the field references out of the per-point loop matters at typical
+// camera-frame sizes (hundreds of thousands of points).
+template <typename RefIn, typename RefOut>
+void CompactColumns(const std::vector<int>& kept, const RefIn& data,
+                    RefOut* out) {
+  for (int k = 0; k < static_cast<int>(kept.size()); ++k) {
+    const int i = kept[k];
+    if (out->data() != data.data() || i != k) {
+      out->col(k) = data.col(i);
+    }
+  }
+}
+
+}  // namespace
+
+int PointCloud::CropToBox(const Vector3<T>& lower, const Vector3<T>& upper,
+                          PointCloud* output) const {
+  DRAKE_DEMAND(output != nullptr);
+  DRAKE_DEMAND(output != this);
+  DRAKE_DEMAND(has_xyzs());
+  output->RequireExactFields(fields());
+  output->resize(size(), true /* skip_initialize */);
+
+  const auto xyzs_in = xyzs();
+  std::vector<int> kept;
+  kept.reserve(size_);
+  for (int i = 0; i < size_; ++i) {
+    // NaN coordinates fail both comparisons, so invalid points are dropped.
+    const auto p = xyzs_in.col(i).array();
+    if ((p >= lower.array()).all() && (p <= upper.array()).all()) {
+      kept.push_back(i);
+    }
+  }
+
+  auto xyzs_out = output->mutable_xyzs();
+  CompactColumns(kept, xyzs_in, &xyzs_out);
+  if (has_normals()) {
+    auto out = output->mutable_normals();
+    CompactColumns(kept, normals(), &out);
+  }
+  if (has_rgbs()) {
+    auto out = output->mutable_rgbs();
+    CompactColumns(kept, rgbs(), &out);
+  }
+  if (has_descriptors()) {
+    auto out = output->mutable_descriptors();
+    CompactColumns(kept, descriptors(), &out);
+  }
+  output->resize(kept.size());
+  return kept.size();
+}
+
+int PointCloud::RemoveInvalidPoints() {
+  DRAKE_DEMAND(has_xyzs());
+  auto xyzs = mutable_xyzs();
+  std::vector<int> kept;
+  kept.reserve(size_);
+  for (int i = 0; i < size_; ++i) {
+    if (xyzs.col(i).array().isFinite().all()) {
+      kept.push_back(i);
+    }
+  }
+
+  CompactColumns(kept, xyzs, &xyzs);
+  if (has_normals()) {
+    auto normals = mutable_normals();
+    CompactColumns(kept, normals, &normals);
+  }
+  if (has_rgbs()) {
+    auto rgbs = mutable_rgbs();
+    CompactColumns(kept, rgbs, &rgbs);
+  }
+  if (has_descriptors()) {
+    auto descriptors = mutable_descriptors();
+    CompactColumns(kept, descriptors, &descriptors);
+  }
+  const int removed = size_ - static_cast<int>(kept.size());
+  resize(kept.size());
+  return removed;
+}
+
 bool PointCloud::has_xyzs() const {
   return fields_.contains(pc_flags::kXYZs);
 }
@@ -276,6 +276,39 @@ class PointCloud final {
 
   /// @}
 
+  /// @name Bulk Operations
+  ///
+  /// Whole-cloud kernels that iterate over the column-major storage directly,
+  /// without going through the per-point accessors.
+  /// @{
+
+  /// Transforms all points (and normals, if present) in place by the rigid
+  /// transform `X_NO`, i.e. `p_N = X_NO * p_O` for every point. Does not
+  /// allocate.
+  /// @pre `has_xyzs()` must be true.
+  void TransformInPlace(const Isometry3<T>& X_NO);
+
+  /// Copies into `output` only the points whose XYZ values lie within the
+  /// axis-aligned box `[lower, upper]` (inclusive), compacting them to the
+  /// front of `output` and resizing it to the number of points kept. Points
+  /// with NaN coordinates never satisfy the bounds and are dropped. All of
+  /// this cloud's fields are copied.
+  /// @returns the number of points kept.
+  /// @pre `has_xyzs()` must be true.
+  /// @pre `output` must have exactly this cloud's fields and must not alias
+  ///      this cloud.
+  int CropToBox(const Vector3<T>& lower, const Vector3<T>& upper,
+                PointCloud* output) const;
+
+  /// Removes, in place, every point whose XYZ value has a non-finite
+  /// coordinate, compacting the surviving points (all fields) to the front
+  /// and shrinking the cloud.
+  /// @returns the number of points removed.
+  /// @pre `has_xyzs()` must be true.
+  int RemoveInvalidPoints();
+
+  /// @}
+
   /// @name Fields
   /// @{
 
@@ -0,0 +1,140 @@
+#include "drake/perception/point_cloud_kd_tree.h"
+
+#include <algorithm>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace perception {
+
+PointCloudKdTree::PointCloudKdTree(const PointCloud& cloud) {
+  cloud.RequireFields(pc_flags::kXYZs);
+
+  // Compact the finite points into contiguous storage.
+  const auto xyzs = cloud.xyzs();
+  source_indices_.reserve(cloud.size());
+  for (int i = 0; i < cloud.size(); ++i) {
+    if (xyzs.col(i).array().isFinite().all()) {
+      source_indices_.push_back(i);
+    }
+  }
+  const int count = static_cast<int>(source_indices_.size());
+  points_.resize(3, count);
+  for (int i = 0; i < count; ++i) {
+    points_.col(i) = xyzs.col(source_indices_[i]);
+  }
+
+  nodes_.reserve(count);
+  std::vector<int> order(count);
+  for (int i = 0; i < count; ++i) order[i] = i;
+  root_ = BuildSubtree(0, count, &order);
+}
+
+int PointCloudKdTree::BuildSubtree(int begin, int end,
+                                   std::vector<int>* order) {
+  if (begin >= end) return -1;
+
+  // Split on the axis of largest extent, at the median point.
+  Vector3<float> lower = points_.col((*order)[begin]);
+  Vector3<float> upper = lower;
+  for (int i = begin + 1; i < end; ++i) {
+    const auto p = points_.col((*order)[i]);
+    lower = lower.cwiseMin(p);
+    upper = upper.cwiseMax(p);
+  }
+  int axis = 0;
+  (upper - lower).maxCoeff(&axis);
+
+  const int mid = begin + (end - begin) / 2;
+  std::nth_element(order->begin() + begin, order->begin() + mid,
+                   order->begin() + end, [this, axis](int a, int b) {
+                     return points_(axis, a) < points_(axis, b);
+                   });
+
+  const int node_index = static_cast<int>(nodes_.size());
+  nodes_.push_back(Node{(*order)[mid], -1, -1, axis});
+  // N.B. Fill in the children after both recursions; the push_back above may
+  // not be the last one by the time they return.
+  const int left = BuildSubtree(begin, mid, order);
+  const int right = BuildSubtree(mid + 1, end, order);
+  nodes_[node_index].left = left;
+  nodes_[node_index].right = right;
+  return node_index;
+}
+
+std::vector<int> PointCloudKdTree::FindNearestNeighbors(
+    const Vector3<float>& query, int k) const {
+  DRAKE_THROW_UNLESS(k > 0);
+  DRAKE_THROW_UNLESS(query.array().isFinite().all());
+  std::vector<Neighbor> heap;
+  heap.reserve(k);
+  SearchNearest(root_, query, k, &heap);
+  std::sort_heap(heap.begin(), heap.end());
+  std::vector<int> result;
+  result.reserve(heap.size());
+  for (const Neighbor& neighbor : heap) {
+    result.push_back(source_indices_[neighbor.point]);
+  }
+  return result;
+}
+
+void PointCloudKdTree::SearchNearest(int node_index,
+                                     const Vector3<float>& query, int k,
+                                     std::vector<Neighbor>* heap) const {
+  if (node_index < 0) return;
+  const Node& node = nodes_[node_index];
+
+  const float squared_distance =
+      (points_.col(node.point) - query).squaredNorm();
+  if (static_cast<int>(heap->size()) < k) {
+    heap->push_back(Neighbor{squared_distance, node.point});
+    std::push_heap(heap->begin(), heap->end());
+  } else if (squared_distance < heap->front().squared_distance) {
+    std::pop_heap(heap->begin(), heap->end());
+    heap->back() = Neighbor{squared_distance, node.point};
+    std::push_heap(heap->begin(), heap->end());
+  }
+
+  // Descend into the near side first; visit the far side only if the
+  // splitting plane is closer than the current k-th best distance.
+  const float plane_delta = query(node.axis) - points_(node.axis, node.point);
+  const int near_child = (plane_delta < 0) ? node.left : node.right;
+  const int far_child = (plane_delta < 0) ? node.right : node.left;
+  SearchNearest(near_child, query, k, heap);
+  if (static_cast<int>(heap->size()) < k ||
+      plane_delta * plane_delta < heap->front().squared_distance) {
+    SearchNearest(far_child, query, k, heap);
+  }
+}
+
+std::vector<int> PointCloudKdTree::FindPointsWithinRadius(
+    const Vector3<float>& query, float radius) const {
+  DRAKE_THROW_UNLESS(radius >= 0);
+  DRAKE_THROW_UNLESS(query.array().isFinite().all());
+  std::vector<int> result;
+  SearchRadius(root_, query, radius * radius, &result);
+  return result;
+}
+
+void PointCloudKdTree::SearchRadius(int node_index,
+                                    const Vector3<float>& query,
+                                    float squared_radius,
+                                    std::vector<int>* result) const {
+  if (node_index < 0) return;
+  const Node& node = nodes_[node_index];
+
+  if ((points_.col(node.point) - query).squaredNorm() <= squared_radius) {
+    result->push_back(source_indices_[node.point]);
+  }
+
+  const float plane_delta = query(node.axis) - points_(node.axis, node.point);
+  const int near_child = (plane_delta < 0) ? node.left : node.right;
+  const int far_child = (plane_delta < 0) ? node.right : node.left;
+  SearchRadius(near_child, query, squared_radius, result);
+  if (plane_delta * plane_delta <= squared_radius) {
+    SearchRadius(far_child, query, squared_radius, result);
+  }
+}
+
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/perception/point_cloud.h"
+
+namespace drake {
+namespace perception {
+
+/// A KD-tree over the XYZ values of a PointCloud, supporting k-nearest
+/// neighbor and fixed-radius queries without converting to any external
+/// library's point type.
+///
+/// The tree copies the (finite) points into its own contiguous storage at
+/// construction, so the source cloud may be mutated or destroyed afterwards;
+/// query results refer to the source cloud by index at construction time.
+/// Points with a non-finite coordinate are excluded from the index and will
+/// never be reported by a query.
+class PointCloudKdTree final {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(PointCloudKdTree)
+
+  /// Builds the tree over `cloud`.
+  /// @pre `cloud` must have XYZ values.
+  explicit PointCloudKdTree(const PointCloud& cloud);
+
+  /// Returns the number of (finite) points in the index.
+  int size() const { return static_cast<int>(nodes_.size()); }
+
+  /// Returns the indices of up to `k` points nearest to `query`, ordered
+  /// nearest first. Fewer than `k` indices are returned when the index holds
+  /// fewer points.
+  /// @pre `k` must be positive, and `query` must be finite.
+  std::vector<int> FindNearestNeighbors(const Vector3<float>& query,
+                                        int k) const;
+
+  /// Returns the indices of all points within `radius` of `query`
+  /// (inclusive), in no particular order.
+  /// @pre `radius` must be non-negative, and `query` must be finite.
+  std::vector<int> FindPointsWithinRadius(const Vector3<float>& query,
+                                          float radius) const;
+
+ private:
+  struct Node {
+    int point{-1};  // Column into points_.
+    int left{-1};   // Child node indices; -1 when absent.
+    int right{-1};
+    int axis{0};    // Splitting axis (coordinate of `point` is the split).
+  };
+
+  // Neighbor candidate used by the k-NN max-heap.
+  struct Neighbor {
+    float squared_distance{};
+    int point{};
+    bool operator<(const Neighbor& other) const {
+      return squared_distance < other.squared_distance;
+    }
+  };
+
+  int BuildSubtree(int begin, int end, std::vector<int>* order);
+  void SearchNearest(int node_index, const Vector3<float>& query, int k,
+                     std::vector<Neighbor>* heap) const;
+  void SearchRadius(int node_index, const Vector3<float>& query,
+                    float squared_radius, std::vector<int>* result) const;
+
+  // The indexed points, compacted into contiguous storage.
+  Matrix3X<float> points_;
+  // Maps columns of points_ back to indices in the source cloud.
+  std::vector<int> source_indices_;
+  std::vector<Node> nodes_;
+  int root_{-1};
+};
+
+}  // namespace perception
+}  // namespace drake
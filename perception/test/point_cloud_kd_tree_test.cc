@@ -0,0 +1,92 @@
+#include "drake/perception/point_cloud_kd_tree.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace perception {
+namespace {
+
+// Brute-force k-NN reference for comparison.
+std::vector<int> BruteForceNearest(const PointCloud& cloud,
+                                   const Vector3<float>& query, int k) {
+  std::vector<std::pair<float, int>> distances;
+  for (int i = 0; i < cloud.size(); ++i) {
+    const Vector3<float> p = cloud.xyz(i);
+    if (!p.array().isFinite().all()) continue;
+    distances.emplace_back((p - query).squaredNorm(), i);
+  }
+  std::sort(distances.begin(), distances.end());
+  std::vector<int> result;
+  for (int i = 0; i < k && i < static_cast<int>(distances.size()); ++i) {
+    result.push_back(distances[i].second);
+  }
+  return result;
+}
+
+GTEST_TEST(PointCloudKdTreeTest, MatchesBruteForce) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> uniform(-1.0, 1.0);
+  const int count = 200;
+  PointCloud cloud(count);
+  auto xyzs = cloud.mutable_xyzs();
+  for (int i = 0; i < count; ++i) {
+    xyzs.col(i) << uniform(generator), uniform(generator), uniform(generator);
+  }
+
+  const PointCloudKdTree tree(cloud);
+  EXPECT_EQ(tree.size(), count);
+
+  for (int trial = 0; trial < 10; ++trial) {
+    const Vector3<float> query(uniform(generator), uniform(generator),
+                               uniform(generator));
+    const std::vector<int> actual = tree.FindNearestNeighbors(query, 5);
+    const std::vector<int> expected = BruteForceNearest(cloud, query, 5);
+    EXPECT_EQ(actual, expected);
+
+    const float radius = 0.5;
+    std::vector<int> in_radius = tree.FindPointsWithinRadius(query, radius);
+    std::sort(in_radius.begin(), in_radius.end());
+    std::vector<int> in_radius_expected;
+    for (int i = 0; i < count; ++i) {
+      if ((Vector3<float>(cloud.xyz(i)) - query).norm() <= radius) {
+        in_radius_expected.push_back(i);
+      }
+    }
+    EXPECT_EQ(in_radius, in_radius_expected);
+  }
+}
+
+GTEST_TEST(PointCloudKdTreeTest, InvalidPointsExcluded) {
+  const float kNaN = std::numeric_limits<float>::quiet_NaN();
+  PointCloud cloud(3);
+  cloud.mutable_xyzs() << 0, kNaN, 1,
+                          0, kNaN, 1,
+                          0, kNaN, 1;
+  const PointCloudKdTree tree(cloud);
+  EXPECT_EQ(tree.size(), 2);
+  // Asking for more neighbors than the index holds returns what exists, and
+  // the NaN point (index 1) is never reported.
+  const std::vector<int> neighbors =
+      tree.FindNearestNeighbors(Vector3<float>::Zero(), 5);
+  EXPECT_EQ(neighbors, (std::vector<int>{0, 2}));
+}
+
+GTEST_TEST(PointCloudKdTreeTest, Validation) {
+  PointCloud cloud(1);
+  cloud.mutable_xyzs().setZero();
+  const PointCloudKdTree tree(cloud);
+  EXPECT_THROW(tree.FindNearestNeighbors(Vector3<float>::Zero(), 0),
+               std::runtime_error);
+  EXPECT_THROW(tree.FindPointsWithinRadius(Vector3<float>::Zero(), -1.0),
+               std::runtime_error);
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
@@ -1,6 +1,7 @@
 #include "drake/perception/point_cloud.h"
 
 #include <iostream>
+#include <limits>
 #include <stdexcept>
 
 #include <gtest/gtest.h>
@@ -256,6 +257,90 @@ GTEST_TEST(PointCloudTest, Fields) {
   }
 }
 
+GTEST_TEST(PointCloudTest, TransformInPlace) {
+  PointCloud cloud(2, pc_flags::kXYZs | pc_flags::kNormals);
+  cloud.mutable_xyzs() << 1, 0,
+                          0, 1,
+                          0, 0;
+  cloud.mutable_normals() << 0, 1,
+                             0, 0,
+                             1, 0;
+
+  // Rotate 90 degrees about +z, then translate.
+  Isometry3<float> X = Isometry3<float>::Identity();
+  X.linear() << 0, -1, 0,
+                1, 0, 0,
+                0, 0, 1;
+  X.translation() << 10, 20, 30;
+  cloud.TransformInPlace(X);
+
+  Matrix3Xf xyzs_expected(3, 2);
+  xyzs_expected << 10, 9,
+                   21, 20,
+                   30, 30;
+  EXPECT_TRUE(CompareMatrices(cloud.xyzs(), xyzs_expected, 1e-6));
+  // Normals are only rotated.
+  Matrix3Xf normals_expected(3, 2);
+  normals_expected << 0, 0,
+                      0, 1,
+                      1, 0;
+  EXPECT_TRUE(CompareMatrices(cloud.normals(), normals_expected, 1e-6));
+}
+
+GTEST_TEST(PointCloudTest, CropToBox) {
+  const float kNaN = std::numeric_limits<float>::quiet_NaN();
+  PointCloud cloud(4, pc_flags::kXYZs | pc_flags::kRGBs);
+  cloud.mutable_xyzs() << 0.5, 2.0, kNaN, 0.25,
+                          0.5, 0.5, 0.5, 0.25,
+                          0.5, 0.5, 0.5, 0.25;
+  cloud.mutable_rgbs() << 1, 2, 3, 4,
+                          1, 2, 3, 4,
+                          1, 2, 3, 4;
+
+  PointCloud output(0, cloud.fields());
+  const int kept = cloud.CropToBox(Vector3<float>::Zero(),
+                                   Vector3<float>::Ones(), &output);
+  // The out-of-box point and the NaN point are dropped.
+  EXPECT_EQ(kept, 2);
+  ASSERT_EQ(output.size(), 2);
+  Matrix3Xf xyzs_expected(3, 2);
+  xyzs_expected << 0.5, 0.25,
+                   0.5, 0.25,
+                   0.5, 0.25;
+  EXPECT_TRUE(CompareMatrices(output.xyzs(), xyzs_expected));
+  EXPECT_EQ(output.rgbs()(0, 0), 1);
+  EXPECT_EQ(output.rgbs()(0, 1), 4);
+
+  // A destination with mismatched fields is rejected.
+  PointCloud bad_output(0, pc_flags::kXYZs);
+  EXPECT_THROW(cloud.CropToBox(Vector3<float>::Zero(), Vector3<float>::Ones(),
+                               &bad_output),
+               std::runtime_error);
+}
+
+GTEST_TEST(PointCloudTest, RemoveInvalidPoints) {
+  const float kNaN = std::numeric_limits<float>::quiet_NaN();
+  const float kInf = std::numeric_limits<float>::infinity();
+  PointCloud cloud(4, pc_flags::kXYZs | pc_flags::kRGBs);
+  cloud.mutable_xyzs() << 1, kNaN, 3, kInf,
+                          1, 2, 3, 4,
+                          1, 2, 3, 4;
+  cloud.mutable_rgbs() << 1, 2, 3, 4,
+                          1, 2, 3, 4,
+                          1, 2, 3, 4;
+
+  const int removed = cloud.RemoveInvalidPoints();
+  EXPECT_EQ(removed, 2);
+  ASSERT_EQ(cloud.size(), 2);
+  Matrix3Xf xyzs_expected(3, 2);
+  xyzs_expected << 1, 3,
+                   1, 3,
+                   1, 3;
+  EXPECT_TRUE(CompareMatrices(cloud.xyzs(), xyzs_expected));
+  EXPECT_EQ(cloud.rgbs()(0, 0), 1);
+  EXPECT_EQ(cloud.rgbs()(0, 1), 3);
+}
+
 }  // namespace
 }  // namespace perception
 }  // namespace drake
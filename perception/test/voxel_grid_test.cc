@@ -0,0 +1,54 @@
+#include "drake/perception/voxel_grid.h"
+
+#include <limits>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+GTEST_TEST(VoxelGridTest, Downsample) {
+  const float kNaN = std::numeric_limits<float>::quiet_NaN();
+  // Two points in one voxel, one point in another, and one invalid point.
+  PointCloud cloud(4);
+  cloud.mutable_xyzs() << 0.1, 0.3, 5.1, kNaN,
+                          0.1, 0.3, 5.1, 0,
+                          0.1, 0.3, 5.1, 0;
+
+  const PointCloud result = DownsampleToVoxelGrid(cloud, 1.0);
+  ASSERT_EQ(result.size(), 2);
+
+  // The output voxel order is unspecified; identify the centroids by value.
+  const Vector3<float> centroid_a(0.2, 0.2, 0.2);
+  const Vector3<float> centroid_b(5.1, 5.1, 5.1);
+  const Vector3<float> p0 = result.xyz(0);
+  const Vector3<float> p1 = result.xyz(1);
+  const bool a_first = (p0 - centroid_a).norm() < (p0 - centroid_b).norm();
+  EXPECT_TRUE(CompareMatrices(a_first ? p0 : p1, centroid_a, 1e-6));
+  EXPECT_TRUE(CompareMatrices(a_first ? p1 : p0, centroid_b, 1e-6));
+}
+
+GTEST_TEST(VoxelGridTest, NegativeCoordinates) {
+  // Points just either side of the origin land in different voxels.
+  PointCloud cloud(2);
+  cloud.mutable_xyzs() << -0.1, 0.1,
+                          -0.1, 0.1,
+                          -0.1, 0.1;
+  const PointCloud result = DownsampleToVoxelGrid(cloud, 1.0);
+  EXPECT_EQ(result.size(), 2);
+}
+
+GTEST_TEST(VoxelGridTest, Validation) {
+  PointCloud cloud(1);
+  EXPECT_THROW(DownsampleToVoxelGrid(cloud, 0.0), std::runtime_error);
+  PointCloud no_xyzs(1, pc_flags::kDescriptorCurvature);
+  EXPECT_THROW(DownsampleToVoxelGrid(no_xyzs, 1.0), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,93 @@
+#include "drake/perception/voxel_grid.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+// Packs the three signed voxel indices into one 64-bit key (21 bits each).
+// At e.g. a 5 mm voxel size this covers roughly +/- 5 km, far beyond any
+// sensor range we care about.
+uint64_t PackVoxelKey(int64_t ix, int64_t iy, int64_t iz) {
+  constexpr uint64_t kMask = (uint64_t{1} << 21) - 1;
+  return ((static_cast<uint64_t>(ix) & kMask) << 42) |
+         ((static_cast<uint64_t>(iy) & kMask) << 21) |
+         (static_cast<uint64_t>(iz) & kMask);
+}
+
+// Finalizer from splitmix64; a cheap, well-mixed hash for the packed key.
+uint64_t HashVoxelKey(uint64_t key) {
+  key ^= key >> 30;
+  key *= UINT64_C(0xbf58476d1ce4e5b9);
+  key ^= key >> 27;
+  key *= UINT64_C(0x94d049bb133111eb);
+  key ^= key >> 31;
+  return key;
+}
+
+}  // namespace
+
+PointCloud DownsampleToVoxelGrid(const PointCloud& cloud, float voxel_size) {
+  cloud.RequireFields(pc_flags::kXYZs);
+  DRAKE_THROW_UNLESS(voxel_size > 0);
+
+  // Open-addressing hash table with linear probing. There can be at most one
+  // occupied voxel per input point, so a power-of-two capacity at least twice
+  // the cloud size keeps the load factor at or below one half.
+  struct Slot {
+    uint64_t key{};
+    Vector3<float> sum{Vector3<float>::Zero()};
+    int count{0};
+  };
+  uint64_t capacity = 2;
+  while (capacity < 2 * static_cast<uint64_t>(cloud.size()) + 2) {
+    capacity *= 2;
+  }
+  std::vector<Slot> slots(capacity);
+  const uint64_t mask = capacity - 1;
+
+  const auto xyzs = cloud.xyzs();
+  const float inv_voxel_size = 1.f / voxel_size;
+  int num_voxels = 0;
+  for (int i = 0; i < cloud.size(); ++i) {
+    const auto p = xyzs.col(i);
+    if (!p.array().isFinite().all()) continue;
+    const uint64_t key = PackVoxelKey(
+        static_cast<int64_t>(std::floor(p.x() * inv_voxel_size)),
+        static_cast<int64_t>(std::floor(p.y() * inv_voxel_size)),
+        static_cast<int64_t>(std::floor(p.z() * inv_voxel_size)));
+    uint64_t slot_index = HashVoxelKey(key) & mask;
+    while (true) {
+      Slot& slot = slots[slot_index];
+      if (slot.count == 0) {
+        slot.key = key;
+        ++num_voxels;
+      } else if (slot.key != key) {
+        slot_index = (slot_index + 1) & mask;
+        continue;
+      }
+      slot.sum += p;
+      ++slot.count;
+      break;
+    }
+  }
+
+  PointCloud result(num_voxels, pc_flags::kXYZs, true /* skip_initialize */);
+  auto result_xyzs = result.mutable_xyzs();
+  int out = 0;
+  for (const Slot& slot : slots) {
+    if (slot.count > 0) {
+      result_xyzs.col(out++) = slot.sum / static_cast<float>(slot.count);
+    }
+  }
+  DRAKE_DEMAND(out == num_voxels);
+  return result;
+}
+
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "drake/common/eigen_types.h"
+#include "drake/perception/point_cloud.h"
+
+namespace drake {
+namespace perception {
+
+/// Downsamples a point cloud with a voxel grid: space is partitioned into
+/// axis-aligned cubes of edge length `voxel_size`, and every occupied voxel
+/// contributes one output point at the centroid of the points it contains.
+/// Points with a non-finite coordinate are ignored.
+///
+/// The returned cloud provides only XYZ values; other fields of `cloud` do
+/// not survive downsampling because each output point aggregates many inputs.
+///
+/// @param cloud The cloud to downsample. Must have XYZ values.
+/// @param voxel_size Edge length of the voxel cubes. Must be positive.
+/// @throws std::runtime_error if the preconditions are violated.
+PointCloud DownsampleToVoxelGrid(const PointCloud& cloud, float voxel_size);
+
+}  // namespace perception
+}  // namespace drake
@@ -2,6 +2,9 @@
 
 #include <algorithm>
 #include <limits>
+#include <mutex>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -380,20 +383,44 @@ SolutionResult MixedIntegerBranchAndBound::Solve() {
       !root_->optimal_solution_is_integral()) {
     SearchIntegralSolutionByRounding(*root_);
   }
-  MixedIntegerBranchAndBoundNode* branching_node = PickBranchingNode();
-  while (branching_node) {
-    // Found a branching node, branch on this node. If no branching node is
-    // found, then every leaf node is fathomed, the branch-and-bound process
-    // should terminate.
-    // TODO(hongkai.dai) We might need to have a function that picks the
-    // branching node together with the branching variable simultaneously.
-    const symbolic::Variable* branching_variable =
-        PickBranchingVariable(*branching_node);
-    BranchAndUpdate(branching_node, *branching_variable);
-    if (HasConverged()) {
-      return SolutionResult::kSolutionFound;
-    }
-    branching_node = PickBranchingNode();
+  // The user-defined node selection function picks a single node, so the
+  // parallel exploration only supports the built-in selection methods.
+  if (num_threads_ > 1 &&
+      node_selection_method_ != NodeSelectionMethod::kUserDefined) {
+    std::vector<MixedIntegerBranchAndBoundNode*> branching_nodes =
+        PickBranchingNodes(num_threads_);
+    while (!branching_nodes.empty()) {
+      // Pick the branching variables serially (they only read each node's
+      // solution), then solve the children's relaxations concurrently.
+      std::vector<std::pair<MixedIntegerBranchAndBoundNode*,
+                            const symbolic::Variable*>>
+          branchings;
+      branchings.reserve(branching_nodes.size());
+      for (MixedIntegerBranchAndBoundNode* node : branching_nodes) {
+        branchings.emplace_back(node, PickBranchingVariable(*node));
+      }
+      BranchAndUpdateInParallel(branchings);
+      if (HasConverged()) {
+        return SolutionResult::kSolutionFound;
+      }
+      branching_nodes = PickBranchingNodes(num_threads_);
+    }
+  } else {
+    MixedIntegerBranchAndBoundNode* branching_node = PickBranchingNode();
+    while (branching_node) {
+      // Found a branching node, branch on this node. If no branching node is
+      // found, then every leaf node is fathomed, the branch-and-bound process
+      // should terminate.
+      // TODO(hongkai.dai) We might need to have a function that picks the
+      // branching node together with the branching variable simultaneously.
+      const symbolic::Variable* branching_variable =
+          PickBranchingVariable(*branching_node);
+      BranchAndUpdate(branching_node, *branching_variable);
+      if (HasConverged()) {
+        return SolutionResult::kSolutionFound;
+      }
+      branching_node = PickBranchingNode();
+    }
   }
   // No node to branch.
   if (best_lower_bound_ == -std::numeric_limits<double>::infinity()) {
@@ -587,6 +614,22 @@ double BestLowerBoundInSubTree(
   }
 }
 
+// Collects every non-fathomed leaf node in the sub-tree.
+void CollectUnfathomedLeaves(
+    const MixedIntegerBranchAndBound& bnb,
+    const MixedIntegerBranchAndBoundNode& sub_tree_root,
+    std::vector<MixedIntegerBranchAndBoundNode*>* leaves) {
+  if (sub_tree_root.IsLeaf()) {
+    if (!bnb.IsLeafNodeFathomed(sub_tree_root)) {
+      leaves->push_back(
+          const_cast<MixedIntegerBranchAndBoundNode*>(&sub_tree_root));
+    }
+  } else {
+    CollectUnfathomedLeaves(bnb, *(sub_tree_root.left_child()), leaves);
+    CollectUnfathomedLeaves(bnb, *(sub_tree_root.right_child()), leaves);
+  }
+}
+
 const symbolic::Variable* PickMostOrLeastAmbivalentAsBranchingVariable(
     const MixedIntegerBranchAndBoundNode& node,
     MixedIntegerBranchAndBound::VariableSelectionMethod
@@ -634,6 +677,43 @@ MixedIntegerBranchAndBoundNode* MixedIntegerBranchAndBound::PickDepthFirstNode()
   return PickDepthFirstNodeInSubTree(*this, *root_);
 }
 
+std::vector<MixedIntegerBranchAndBoundNode*>
+MixedIntegerBranchAndBound::PickBranchingNodes(int max_count) const {
+  DRAKE_DEMAND(max_count >= 1);
+  std::vector<MixedIntegerBranchAndBoundNode*> leaves;
+  CollectUnfathomedLeaves(*this, *root_, &leaves);
+  switch (node_selection_method_) {
+    case NodeSelectionMethod::kMinLowerBound: {
+      std::sort(leaves.begin(), leaves.end(),
+                [](const MixedIntegerBranchAndBoundNode* node1,
+                   const MixedIntegerBranchAndBoundNode* node2) {
+                  return node1->prog()->GetOptimalCost() <
+                         node2->prog()->GetOptimalCost();
+                });
+      break;
+    }
+    case NodeSelectionMethod::kDepthFirst: {
+      // The deepest node has the fewest remaining binary variables.
+      std::sort(leaves.begin(), leaves.end(),
+                [](const MixedIntegerBranchAndBoundNode* node1,
+                   const MixedIntegerBranchAndBoundNode* node2) {
+                  return node1->remaining_binary_variables().size() <
+                         node2->remaining_binary_variables().size();
+                });
+      break;
+    }
+    case NodeSelectionMethod::kUserDefined: {
+      throw std::runtime_error(
+          "PickBranchingNodes does not support the user-defined node "
+          "selection method.");
+    }
+  }
+  if (static_cast<int>(leaves.size()) > max_count) {
+    leaves.resize(max_count);
+  }
+  return leaves;
+}
+
 const symbolic::Variable* MixedIntegerBranchAndBound::PickBranchingVariable(
     const MixedIntegerBranchAndBoundNode& node) const {
   switch (variable_selection_method_) {
@@ -702,6 +782,56 @@ void MixedIntegerBranchAndBound::BranchAndUpdate(
   }
 }
 
+void MixedIntegerBranchAndBound::BranchAndUpdateInParallel(
+    const std::vector<std::pair<MixedIntegerBranchAndBoundNode*,
+                                const symbolic::Variable*>>& branchings) {
+  // Solve the children's relaxations on worker threads. Each Branch() call
+  // only touches its own leaf's sub-tree and constructs its own solver
+  // instance, so the solves are independent.
+  std::mutex exception_mutex;
+  std::exception_ptr first_exception{nullptr};
+  std::vector<std::thread> workers;
+  workers.reserve(branchings.size());
+  for (const auto& branching : branchings) {
+    workers.emplace_back([&branching, &exception_mutex, &first_exception]() {
+      try {
+        branching.first->Branch(*branching.second);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(exception_mutex);
+        if (first_exception == nullptr) {
+          first_exception = std::current_exception();
+        }
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  if (first_exception != nullptr) {
+    std::rethrow_exception(first_exception);
+  }
+  // The bookkeeping below mutates shared state (the bounds, solutions_, and
+  // any user callback), so it stays on the calling thread. It mirrors the
+  // post-branch part of BranchAndUpdate().
+  best_lower_bound_ = BestLowerBoundInSubTree(*this, *root_);
+  for (const auto& branching : branchings) {
+    for (auto& child :
+         {branching.first->left_child(), branching.first->right_child()}) {
+      if (child->solution_result() == SolutionResult::kSolutionFound &&
+          child->optimal_solution_is_integral()) {
+        const double child_node_optimal_cost = child->prog()->GetOptimalCost();
+        const Eigen::VectorXd x_sol =
+            child->prog()->GetSolution(child->prog()->decision_variables());
+        UpdateIntegralSolution(x_sol, child_node_optimal_cost);
+      }
+      if (search_integral_solution_by_rounding_) {
+        SearchIntegralSolutionByRounding(*child);
+      }
+      NodeCallback(*child);
+    }
+  }
+}
+
 void MixedIntegerBranchAndBound::UpdateIntegralSolution(
     const Eigen::Ref<const Eigen::VectorXd>& solution, double cost) {
   // First make sure that this solution has not been found before. The solution
@@ -5,6 +5,7 @@
 #include <memory>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "drake/solvers/mathematical_program.h"
 
@@ -553,6 +554,23 @@ class MixedIntegerBranchAndBound {
   /** Geeter for the relative gap tolerance. */
   double relative_gap_tol() const { return relative_gap_tol_; }
 
+  /** Setter for the number of worker threads used in Solve(). The default is
+   * 1 (serial exploration). With more than one thread, each iteration picks
+   * up to num_threads un-fathomed leaf nodes (ordered by the node selection
+   * method) and solves their children's relaxations concurrently; every
+   * relaxation is solved by its own solver instance, while the
+   * bounds/solutions bookkeeping and all user callbacks stay on the calling
+   * thread. The user-defined node selection method is not supported with
+   * multiple threads; Solve() then falls back to serial exploration.
+   */
+  void set_num_threads(int num_threads) {
+    DRAKE_DEMAND(num_threads >= 1);
+    num_threads_ = num_threads;
+  }
+
+  /** Getter for the number of worker threads used in Solve(). */
+  int num_threads() const { return num_threads_; }
+
  private:
   // Forward declaration the tester class.
   friend class MixedIntegerBranchAndBoundTester;
@@ -572,6 +590,15 @@ class MixedIntegerBranchAndBound {
    */
   MixedIntegerBranchAndBoundNode* PickDepthFirstNode() const;
 
+  /**
+   * Pick up to @p max_count nodes to branch concurrently. The returned nodes
+   * are the un-fathomed leaf nodes that the node selection method ranks best
+   * (smallest optimal cost for "min lower bound", most fixed binary variables
+   * for "depth first").
+   */
+  std::vector<MixedIntegerBranchAndBoundNode*> PickBranchingNodes(
+      int max_count) const;
+
   /**
    * Pick the branching variable in a node.
    */
@@ -587,6 +614,15 @@ class MixedIntegerBranchAndBound {
   void BranchAndUpdate(MixedIntegerBranchAndBoundNode* node,
                        const symbolic::Variable& branching_variable);
 
+  /**
+   * Branch on several nodes at once, solving the children's relaxations on
+   * worker threads, then update the best lower and upper bounds on the
+   * calling thread. Each entry pairs a node with its branching variable.
+   */
+  void BranchAndUpdateInParallel(
+      const std::vector<std::pair<MixedIntegerBranchAndBoundNode*,
+                                  const symbolic::Variable*>>& branchings);
+
   /**
    * Update the solutions (solutions_) and the best upper bound, with an
    * integral solution and its cost.
@@ -671,6 +707,9 @@ class MixedIntegerBranchAndBound {
 
   bool search_integral_solution_by_rounding_ = false;
 
+  // The number of worker threads used in Solve(); 1 means serial exploration.
+  int num_threads_{1};
+
   // The user defined function to pick a branching variable. Default is null.
   VariableSelectFun variable_selection_userfun_ = nullptr;
 
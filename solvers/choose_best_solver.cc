@@ -1,5 +1,9 @@
 #include "drake/solvers/choose_best_solver.h"
 
+#include <chrono>
+#include <vector>
+
+#include "drake/common/drake_assert.h"
 #include "drake/solvers/equality_constrained_qp_solver.h"
 #include "drake/solvers/gurobi_solver.h"
 #include "drake/solvers/ipopt_solver.h"
@@ -10,10 +14,44 @@
 #include "drake/solvers/osqp_solver.h"
 #include "drake/solvers/scs_solver.h"
 #include "drake/solvers/snopt_solver.h"
+#include "drake/solvers/solver_selection_history.h"
 
 namespace drake {
 namespace solvers {
+namespace {
+
+// All solver ids this module knows how to construct, in the static precedence
+// order of ChooseBestSolver().
+std::vector<SolverId> KnownSolverIds() {
+  return {LinearSystemSolver::id(), EqualityConstrainedQPSolver::id(),
+          MosekSolver::id(),        GurobiSolver::id(),
+          OsqpSolver::id(),         MobyLcpSolverId::id(),
+          SnoptSolver::id(),        IpoptSolver::id(),
+          NloptSolver::id(),        ScsSolver::id()};
+}
+
+}  // namespace
+
 SolverId ChooseBestSolver(const MathematicalProgram& prog) {
+  // Prefer the empirically fastest solver when the performance history has
+  // matching records; solvers are matched by name since records may have been
+  // loaded from a file.
+  const optional<SolverId> recorded =
+      SolverSelectionHistory::GetInstance().BestRecordedSolver(
+          prog.required_capabilities(), prog.num_vars());
+  if (recorded.has_value()) {
+    for (const SolverId& known_id : KnownSolverIds()) {
+      if (known_id.name() == recorded->name()) {
+        const auto solver = MakeSolver(known_id);
+        if (solver->available() &&
+            solver->AreProgramAttributesSatisfied(prog)) {
+          return known_id;
+        }
+        break;
+      }
+    }
+  }
+
   if (LinearSystemSolver::is_available() &&
       LinearSystemSolver::ProgramAttributesSatisfied(prog)) {
     return LinearSystemSolver::id();
@@ -82,5 +120,28 @@ std::unique_ptr<MathematicalProgramSolverInterface> MakeSolver(
     throw std::invalid_argument("MakeSolver: no matching solver " + id.name());
   }
 }
+
+void BenchmarkSolversForSelectionHistory(const MathematicalProgram& prog,
+                                         int num_trials) {
+  DRAKE_DEMAND(num_trials >= 1);
+  SolverSelectionHistory& history = SolverSelectionHistory::GetInstance();
+  for (const SolverId& id : KnownSolverIds()) {
+    const auto solver = MakeSolver(id);
+    if (!solver->available() || !solver->AreProgramAttributesSatisfied(prog)) {
+      continue;
+    }
+    for (int trial = 0; trial < num_trials; ++trial) {
+      MathematicalProgramResult result;
+      const auto start = std::chrono::steady_clock::now();
+      solver->Solve(prog, {}, {}, &result);
+      const std::chrono::duration<double> solve_time =
+          std::chrono::steady_clock::now() - start;
+      history.AddRecord(
+          prog.required_capabilities(), prog.num_vars(), id,
+          solve_time.count(),
+          result.get_solution_result() == SolutionResult::kSolutionFound);
+    }
+  }
+}
 }  // namespace solvers
 }  // namespace drake
@@ -10,6 +10,11 @@ namespace solvers {
 /**
  * Choose the best solver given the formulation in the optimization program and
  * the availability of the solvers.
+ *
+ * When the process-wide SolverSelectionHistory has records matching the
+ * program's required capabilities and size, the empirically fastest recorded
+ * solver is chosen (provided it is available and can handle the program);
+ * otherwise the static precedence order is used.
  * @throw invalid_argument if there is no available solver for @p prog.
  */
 SolverId ChooseBestSolver(const MathematicalProgram& prog);
@@ -20,5 +25,16 @@ SolverId ChooseBestSolver(const MathematicalProgram& prog);
  */
 std::unique_ptr<MathematicalProgramSolverInterface> MakeSolver(
     const SolverId& id);
+
+/**
+ * Runs every available solver that can handle @p prog, @p num_trials times
+ * each, and records the solve times into the process-wide
+ * SolverSelectionHistory. This is the offline population path: run it on
+ * representative programs (optionally persisting the history with
+ * SolverSelectionHistory::SaveToFile()), and subsequent calls to
+ * ChooseBestSolver() on similar programs will pick the fastest solver.
+ */
+void BenchmarkSolversForSelectionHistory(const MathematicalProgram& prog,
+                                         int num_trials = 1);
 }  // namespace solvers
 }  // namespace drake
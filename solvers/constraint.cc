@@ -131,7 +131,11 @@ void LinearConstraint::DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x,
 
 void LinearConstraint::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
                               Eigen::VectorXd* y) const {
-  DoEvalGeneric(x, y);
+  // Compute the product straight into the caller's buffer; with noalias there
+  // is no temporary, so once y has the right size this path is
+  // allocation-free.
+  y->resize(num_constraints());
+  y->noalias() = A_ * x;
 }
 
 void LinearConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
@@ -145,6 +149,12 @@ void LinearConstraint::DoEval(
   DoEvalGeneric(x, y);
 }
 
+void LinearConstraint::DoEvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& x,
+                                   Eigen::MatrixXd* y) const {
+  y->resize(num_constraints(), x.cols());
+  *y = A_ * x;
+}
+
 template <typename DerivedX, typename ScalarY>
 void BoundingBoxConstraint::DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x,
                                           VectorX<ScalarY>* y) const {
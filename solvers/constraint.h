@@ -545,6 +545,11 @@ class LinearConstraint : public Constraint {
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
               VectorX<symbolic::Expression>* y) const override;
 
+  // Evaluates all the points with a single matrix product A * x. This
+  // override is inherited by the derived linear constraint types as well.
+  void DoEvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& x,
+                   Eigen::MatrixXd* y) const override;
+
   Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> A_;
 
  private:
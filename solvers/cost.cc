@@ -30,6 +30,12 @@ void LinearCost::DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
   DoEvalGeneric(x, y);
 }
 
+void LinearCost::DoEvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& x,
+                             Eigen::MatrixXd* y) const {
+  y->resize(1, x.cols());
+  *y = ((a_.transpose() * x).array() + b_).matrix();
+}
+
 template <typename DerivedX, typename U>
 void QuadraticCost::DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x,
                                   VectorX<U>* y) const {
@@ -40,7 +46,10 @@ void QuadraticCost::DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x,
 
 void QuadraticCost::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
                            Eigen::VectorXd* y) const {
-  DoEvalGeneric(x, y);
+  // The lazy product is evaluated coefficient-wise inside the dot product, so
+  // unlike the generic path there is no heap-allocated temporary for Q * x.
+  y->resize(1);
+  (*y)(0) = .5 * x.dot(Q_.lazyProduct(x)) + b_.dot(x) + c_;
 }
 
 void QuadraticCost::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
@@ -54,6 +63,15 @@ void QuadraticCost::DoEval(
   DoEvalGeneric(x, y);
 }
 
+void QuadraticCost::DoEvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& x,
+                                Eigen::MatrixXd* y) const {
+  y->resize(1, x.cols());
+  *y = ((.5 * x.cwiseProduct(Q_ * x).colwise().sum() + b_.transpose() * x)
+            .array() +
+        c_)
+           .matrix();
+}
+
 shared_ptr<QuadraticCost> MakeQuadraticErrorCost(
     const Eigen::Ref<const MatrixXd>& Q,
     const Eigen::Ref<const VectorXd>& x_desired) {
@@ -86,6 +86,10 @@ class LinearCost : public Cost {
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
               VectorX<symbolic::Expression>* y) const override;
 
+  // Evaluates all the points with a single matrix-vector product a' * x.
+  void DoEvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& x,
+                   Eigen::MatrixXd* y) const override;
+
  private:
   template <typename DerivedX, typename U>
   void DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x, VectorX<U>* y) const;
@@ -162,6 +166,11 @@ class QuadraticCost : public Cost {
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
               VectorX<symbolic::Expression>* y) const override;
 
+  // Evaluates all the points with a single matrix product Q * x, instead of
+  // one quadratic form per point.
+  void DoEvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& x,
+                   Eigen::MatrixXd* y) const override;
+
   Eigen::MatrixXd Q_;
   Eigen::VectorXd b_;
   double c_{};
@@ -15,6 +15,30 @@
 namespace drake {
 namespace solvers {
 
+// Holds the factorization of the KKT system from a previous solve so that
+// repeated solves of the same program with unchanged G and A (e.g. a
+// controller updating only the right-hand sides every control step) skip the
+// O(n³) factorization and cost only back-substitution.
+struct EqualityConstrainedQPSolver::KktCache {
+  // The program the cached factorization was computed for; nullptr when the
+  // cache is empty or invalid.
+  const MathematicalProgram* last_prog{nullptr};
+  // The matrices the factorization below corresponds to.
+  Eigen::MatrixXd G;
+  Eigen::MatrixXd A;
+  // Cholesky factorization of G (valid only when G is positive definite).
+  Eigen::LLT<Eigen::MatrixXd> llt;
+  // inv(G) * Aᵀ and the Schur complement A * inv(G) * Aᵀ.
+  Eigen::MatrixXd AiG_T;
+  Eigen::MatrixXd A_iG_A_T;
+  // QR factorization of the Schur complement.
+  Eigen::FullPivHouseholderQR<Eigen::MatrixXd> qr;
+};
+
+EqualityConstrainedQPSolver::EqualityConstrainedQPSolver() = default;
+
+EqualityConstrainedQPSolver::~EqualityConstrainedQPSolver() = default;
+
 bool EqualityConstrainedQPSolver::is_available() { return true; }
 
 /**
@@ -197,28 +221,51 @@ void EqualityConstrainedQPSolver::Solve(
       constraint_index += n;
     }
 
-    // Check for positive definite Hessian matrix.
-    Eigen::LLT<Eigen::MatrixXd> llt(G);
-    if (llt.info() == Eigen::Success) {
-      // Matrix is positive definite. (inv(G)*A')' = A*inv(G) because G is
-      // symmetric.
-      Eigen::MatrixXd AiG_T = llt.solve(A.transpose());
-
-      // Compute a full pivoting, QR factorization.
-      const Eigen::MatrixXd A_iG_A_T = A * AiG_T;
-      Eigen::FullPivHouseholderQR<Eigen::MatrixXd> qr(A_iG_A_T);
-
+    // Check for positive definite Hessian matrix, reusing the factorization
+    // from the previous solve when the same program presents the same G and A
+    // (i.e. only the right-hand sides b and c changed). Comparing the
+    // assembled matrices is O(n²), far cheaper than the O(n³) factorization
+    // it saves.
+    if (kkt_cache_ == nullptr) {
+      kkt_cache_ = std::make_unique<KktCache>();
+    }
+    KktCache& cache = *kkt_cache_;
+    bool hessian_positive_definite =
+        cache.last_prog == &prog && cache.G.rows() == G.rows() &&
+        cache.A.rows() == A.rows() && cache.A.cols() == A.cols() &&
+        (cache.G.array() == G.array()).all() &&
+        (cache.A.array() == A.array()).all();
+    if (!hessian_positive_definite) {
+      cache.last_prog = nullptr;
+      cache.llt.compute(G);
+      if (cache.llt.info() == Eigen::Success) {
+        // Matrix is positive definite. (inv(G)*A')' = A*inv(G) because G is
+        // symmetric.
+        cache.AiG_T = cache.llt.solve(A.transpose());
+
+        // Compute a full pivoting, QR factorization of the Schur complement.
+        cache.A_iG_A_T = A * cache.AiG_T;
+        cache.qr.compute(cache.A_iG_A_T);
+
+        cache.G = G;
+        cache.A = A;
+        cache.last_prog = &prog;
+        hessian_positive_definite = true;
+      }
+    }
+    if (hessian_positive_definite) {
       // Solve using least-squares A*inv(G)*A'y = A*inv(G)*c + b for `y`.
-      const Eigen::VectorXd rhs = AiG_T.transpose() * c + b;
-      Eigen::VectorXd lambda = qr.solve(rhs);
+      const Eigen::VectorXd rhs = cache.AiG_T.transpose() * c + b;
+      Eigen::VectorXd lambda = cache.qr.solve(rhs);
 
       solution_result =
-          rhs.isApprox(A_iG_A_T * lambda, solver_options_struct.feasibility_tol)
+          rhs.isApprox(cache.A_iG_A_T * lambda,
+                       solver_options_struct.feasibility_tol)
               ? SolutionResult::kSolutionFound
               : SolutionResult::kInfeasibleConstraints;
 
       // Solve G*x = A'y - c
-      x = llt.solve(A.transpose() * lambda - c);
+      x = cache.llt.solve(A.transpose() * lambda - c);
     } else {
       // The following code assumes that the Hessian is not positive definite.
       // We first compute the null space of A. Denote kernel(A) = N.
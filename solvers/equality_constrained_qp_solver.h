@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include "drake/common/drake_copyable.h"
@@ -8,12 +9,23 @@
 namespace drake {
 namespace solvers {
 
+/**
+ * Solves equality constrained QPs analytically via the KKT conditions.
+ *
+ * A solver instance caches the factorization of the KKT system between
+ * solves. When the same program is solved repeatedly and only the right-hand
+ * sides change (the linear cost and the equality constraint bounds, as in a
+ * controller resolving the same-structure QP every control step), the cached
+ * factorization is reused and each re-solve costs only back-substitution.
+ * The cache is invalidated automatically whenever the assembled Hessian or
+ * constraint matrix differs from the cached one.
+ */
 class EqualityConstrainedQPSolver : public MathematicalProgramSolverInterface {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(EqualityConstrainedQPSolver)
 
-  EqualityConstrainedQPSolver() = default;
-  ~EqualityConstrainedQPSolver() override = default;
+  EqualityConstrainedQPSolver();
+  ~EqualityConstrainedQPSolver() override;
 
   bool available() const override { return is_available(); };
 
@@ -56,6 +68,12 @@ class EqualityConstrainedQPSolver : public MathematicalProgramSolverInterface {
    * tolerance.
    */
   static std::string FeasibilityTolOptionName();
+
+ private:
+  // The cached KKT factorization (defined in the .cc file). This is scratch
+  // state only; it does not affect the semantic const'ness of Solve().
+  struct KktCache;
+  mutable std::unique_ptr<KktCache> kkt_cache_;
 };
 
 }  // namespace solvers
@@ -1,5 +1,8 @@
 #include "drake/solvers/evaluator_base.h"
 
+#include <set>
+#include <stdexcept>
+
 using std::make_shared;
 using std::shared_ptr;
 using Eigen::MatrixXd;
@@ -8,6 +11,38 @@ using Eigen::VectorXd;
 namespace drake {
 namespace solvers {
 
+void EvaluatorBase::SetGradientSparsityPattern(
+    const std::vector<std::pair<int, int>>& gradient_sparsity_pattern) {
+  std::set<std::pair<int, int>> nonzero_entries;
+  for (const auto& entry : gradient_sparsity_pattern) {
+    if (entry.first < 0 || entry.first >= num_outputs_) {
+      throw std::runtime_error(
+          "The row index of the gradient sparsity pattern is out of range.");
+    }
+    if (num_vars_ != Eigen::Dynamic &&
+        (entry.second < 0 || entry.second >= num_vars_)) {
+      throw std::runtime_error(
+          "The column index of the gradient sparsity pattern is out of "
+          "range.");
+    }
+    if (!nonzero_entries.insert(entry).second) {
+      throw std::runtime_error(
+          "The gradient sparsity pattern contains a repeated entry.");
+    }
+  }
+  gradient_sparsity_pattern_.emplace(gradient_sparsity_pattern);
+}
+
+void EvaluatorBase::DoEvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& x,
+                                Eigen::MatrixXd* y) const {
+  y->resize(num_outputs(), x.cols());
+  Eigen::VectorXd y_col(num_outputs());
+  for (int j = 0; j < x.cols(); ++j) {
+    DoEval(x.col(j), &y_col);
+    y->col(j) = y_col;
+  }
+}
+
 void PolynomialEvaluator::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
                                  Eigen::VectorXd* y) const {
   double_evaluation_point_temp_.clear();
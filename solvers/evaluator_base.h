@@ -10,6 +10,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_optional.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/polynomial.h"
 #include "drake/common/symbolic.h"
@@ -70,6 +71,23 @@ class EvaluatorBase {
     DoEval(x, y);
   }
 
+  /**
+   * Evaluates the expression at a batch of points with a scalar type of
+   * double. Column j of @p x is the j-th evaluation point, and column j of
+   * @p y is the corresponding output. This is equivalent to calling
+   * Eval(x.col(j), &y_j) for every column, but derived classes with linear or
+   * quadratic structure override the batch evaluation to process all the
+   * points with a single matrix product, which is substantially faster when
+   * the number of points is large.
+   * @param x A `num_vars` x `num_points` input matrix.
+   * @param[out] y A `num_outputs` x `num_points` output matrix.
+   */
+  void EvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& x,
+                 Eigen::MatrixXd* y) const {
+    DRAKE_ASSERT(x.rows() == num_vars_ || num_vars_ == Eigen::Dynamic);
+    DoEvalBatch(x, y);
+  }
+
   /**
    * Set a human-friendly description for the evaluator.
    */
@@ -94,6 +112,31 @@ class EvaluatorBase {
    */
   int num_outputs() const { return num_outputs_; }
 
+  /**
+   * Declares the sparsity pattern of the gradient matrix ∂y/∂x, namely the
+   * list of (row_index, column_index) pairs of all the entries that could
+   * possibly be nonzero, where row_index is the index in the output y and
+   * column_index is the index in the input x. Gradient-based solvers can
+   * then allocate and evaluate only these entries, instead of the dense
+   * num_outputs() x num_vars() matrix. The pattern may be conservative (it
+   * may list entries whose gradient happens to be zero), but every entry not
+   * listed is treated as identically zero.
+   * @throws std::runtime_error if any index is out of range, or if a pair is
+   * repeated.
+   */
+  void SetGradientSparsityPattern(
+      const std::vector<std::pair<int, int>>& gradient_sparsity_pattern);
+
+  /**
+   * Returns the declared sparsity pattern of the gradient matrix ∂y/∂x, or
+   * nullopt if none has been declared (in which case the gradient must be
+   * treated as dense).
+   */
+  const optional<std::vector<std::pair<int, int>>>& gradient_sparsity_pattern()
+      const {
+    return gradient_sparsity_pattern_;
+  }
+
  protected:
   /**
    * Constructs a evaluator.
@@ -139,6 +182,18 @@ class EvaluatorBase {
   virtual void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
                       VectorX<symbolic::Expression>* y) const = 0;
 
+  /**
+   * Implements batch expression evaluation for scalar type double. The
+   * default implementation evaluates each column of @p x with DoEval; derived
+   * classes may override it to evaluate all the columns at once.
+   * @param x Input matrix, one evaluation point per column.
+   * @param y Output matrix, one result per column.
+   * @pre x must have `num_vars` rows.
+   * @post y will be of size `num_outputs` x `x.cols()`.
+   */
+  virtual void DoEvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& x,
+                           Eigen::MatrixXd* y) const;
+
   // Setter for the number of outputs.
   // This method is only meant to be called, if the sub-class structure permits
   // to change the number of outputs. One example is LinearConstraint in
@@ -150,6 +205,9 @@ class EvaluatorBase {
   int num_vars_{};
   int num_outputs_{};
   std::string description_;
+  // The declared sparsity pattern of the gradient matrix ∂y/∂x; nullopt means
+  // the gradient has to be treated as dense.
+  optional<std::vector<std::pair<int, int>>> gradient_sparsity_pattern_;
 };
 
 /**
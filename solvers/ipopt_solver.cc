@@ -5,6 +5,7 @@
 #include <limits>
 #include <memory>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <IpIpoptApplication.hpp>
@@ -44,7 +45,11 @@ int GetConstraintBounds(const Constraint& c, Number* lb, Number* ub) {
 /// @return number of constraints
 int GetNumGradients(const Constraint& c, int var_count, Index* num_grad) {
   const int num_constraints = c.num_constraints();
-  *num_grad = num_constraints * var_count;
+  if (c.gradient_sparsity_pattern()) {
+    *num_grad = static_cast<Index>(c.gradient_sparsity_pattern()->size());
+  } else {
+    *num_grad = num_constraints * var_count;
+  }
   return num_constraints;
 }
 
@@ -67,6 +72,19 @@ size_t GetGradientMatrix(
   const int m = c.num_constraints();
   size_t grad_index = 0;
 
+  const optional<std::vector<std::pair<int, int>>>& gradient_sparsity =
+      c.gradient_sparsity_pattern();
+  if (gradient_sparsity) {
+    // Only the declared nonzero gradient entries are reported to IPOPT.
+    for (const auto& entry : *gradient_sparsity) {
+      iRow[grad_index] = constraint_idx + entry.first;
+      jCol[grad_index] =
+          prog.FindDecisionVariableIndex(variables(entry.second));
+      grad_index++;
+    }
+    return grad_index;
+  }
+
   for (int i = 0; i < static_cast<int>(m); ++i) {
     for (int j = 0; j < variables.rows(); ++j) {
       iRow[grad_index] = constraint_idx + i;
@@ -122,6 +140,17 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
   // gradient array.
   size_t grad_idx = 0;
 
+  const optional<std::vector<std::pair<int, int>>>& gradient_sparsity =
+      c.gradient_sparsity_pattern();
+  if (gradient_sparsity) {
+    // Write only the declared nonzero gradient entries, in the same order as
+    // their structure was reported in GetGradientMatrix().
+    for (const auto& entry : *gradient_sparsity) {
+      grad[grad_idx++] = ty(entry.first).derivatives()(entry.second);
+    }
+    return grad_idx;
+  }
+
   for (int i = 0; i < c.num_constraints(); i++) {
     for (int j = 0; j < variables.rows(); j++) {
       grad[grad_idx++] = ty(i).derivatives()(j);
@@ -18,6 +18,7 @@
 
 #include "drake/common/eigen_types.h"
 #include "drake/common/symbolic.h"
+#include "drake/common/tracing.h"
 #include "drake/math/matrix_util.h"
 #include "drake/solvers/choose_best_solver.h"
 #include "drake/solvers/equality_constrained_qp_solver.h"
@@ -439,6 +440,58 @@ Binding<Constraint> MathematicalProgram::AddConstraint(
   }
 }
 
+void MathematicalProgram::AddConstraints(
+    const std::vector<Binding<Constraint>>& bindings) {
+  // Classify the bindings up front (mirroring the dispatch order in
+  // AddConstraint above) so that every per-type container grows at most once
+  // before the individual additions run.
+  int num_lmi{0};
+  int num_psd{0};
+  int num_rotated_lorentz{0};
+  int num_lorentz{0};
+  int num_bbox{0};
+  int num_linear_equality{0};
+  int num_linear{0};
+  int num_generic{0};
+  for (const auto& binding : bindings) {
+    Constraint* constraint = binding.evaluator().get();
+    if (dynamic_cast<LinearMatrixInequalityConstraint*>(constraint)) {
+      ++num_lmi;
+    } else if (dynamic_cast<PositiveSemidefiniteConstraint*>(constraint)) {
+      ++num_psd;
+    } else if (dynamic_cast<RotatedLorentzConeConstraint*>(constraint)) {
+      ++num_rotated_lorentz;
+    } else if (dynamic_cast<LorentzConeConstraint*>(constraint)) {
+      ++num_lorentz;
+    } else if (dynamic_cast<BoundingBoxConstraint*>(constraint)) {
+      ++num_bbox;
+    } else if (dynamic_cast<LinearEqualityConstraint*>(constraint)) {
+      ++num_linear_equality;
+    } else if (dynamic_cast<LinearConstraint*>(constraint)) {
+      ++num_linear;
+    } else {
+      ++num_generic;
+    }
+  }
+  linear_matrix_inequality_constraint_.reserve(
+      linear_matrix_inequality_constraint_.size() + num_lmi);
+  positive_semidefinite_constraint_.reserve(
+      positive_semidefinite_constraint_.size() + num_psd);
+  rotated_lorentz_cone_constraint_.reserve(
+      rotated_lorentz_cone_constraint_.size() + num_rotated_lorentz);
+  lorentz_cone_constraint_.reserve(
+      lorentz_cone_constraint_.size() + num_lorentz);
+  bbox_constraints_.reserve(bbox_constraints_.size() + num_bbox);
+  linear_equality_constraints_.reserve(
+      linear_equality_constraints_.size() + num_linear_equality);
+  linear_constraints_.reserve(linear_constraints_.size() + num_linear);
+  generic_constraints_.reserve(generic_constraints_.size() + num_generic);
+
+  for (const auto& binding : bindings) {
+    AddConstraint(binding);
+  }
+}
+
 Binding<Constraint> MathematicalProgram::AddConstraint(const Expression& e,
                                                        const double lb,
                                                        const double ub) {
@@ -1010,6 +1063,7 @@ void MathematicalProgram::SetInitialGuess(
 // implemented in mathematical_program_api.cc instead of this file.
 
 SolutionResult MathematicalProgram::Solve() {
+  DRAKE_TRACEPOINT("MathematicalProgram::Solve");
   const SolverId solver_id = ChooseBestSolver(*this);
   if (solver_id == LinearSystemSolver::id()) {
     return linear_system_solver_->Solve(*this);
@@ -1099,6 +1099,36 @@ class MathematicalProgram {
    */
   Binding<Constraint> AddConstraint(const Binding<Constraint>& binding);
 
+  /**
+   * Adds a batch of constraints to the program, as if AddConstraint had been
+   * called once per binding (each binding is still dispatched to its most
+   * specific constraint container).  The per-type containers are sized up
+   * front so that each grows at most once, which matters when a large program
+   * (e.g. a transcribed trajectory optimization) is assembled constraint by
+   * constraint.
+   */
+  void AddConstraints(const std::vector<Binding<Constraint>>& bindings);
+
+  /**
+   * Reserves storage for at least @p size additional generic constraint
+   * bindings, as a hint ahead of repeated AddConstraint calls.  Analogous
+   * hints for the specialized containers are provided by AddConstraints,
+   * which classifies its input and reserves for the caller.
+   */
+  void ReserveGenericConstraints(int size) {
+    DRAKE_DEMAND(size >= 0);
+    generic_constraints_.reserve(generic_constraints_.size() + size);
+  }
+
+  /**
+   * Reserves storage for at least @p size additional linear constraint
+   * bindings, as a hint ahead of repeated AddLinearConstraint calls.
+   */
+  void ReserveLinearConstraints(int size) {
+    DRAKE_DEMAND(size >= 0);
+    linear_constraints_.reserve(linear_constraints_.size() + size);
+  }
+
   /**
    * Adds one row of constraint lb <= e <= ub where @p e is a symbolic
    * expression.
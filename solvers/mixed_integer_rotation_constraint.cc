@@ -1,7 +1,11 @@
 #include "drake/solvers/mixed_integer_rotation_constraint.h"
 
 #include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
 
+#include "drake/common/never_destroyed.h"
 #include "drake/math/gray_code.h"
 #include "drake/solvers/bilinear_product_util.h"
 #include "drake/solvers/integer_optimization_util.h"
@@ -817,6 +821,36 @@ void ComputeBoxSphereIntersectionAndHalfSpace(
   }
 }
 
+// The box-sphere intersection tables computed by
+// ComputeBoxSphereIntersectionAndHalfSpace() depend only on
+// num_intervals_per_half_axis (φ₊ is determined by it), but computing them is
+// by far the most expensive part of constructing a generator. Memoize them
+// process-wide, so that repeatedly constructing generators (e.g. building the
+// same MIP once per planning query) computes each table only once.
+struct BoxSphereIntersectionTable {
+  std::vector<std::vector<std::vector<std::vector<Eigen::Vector3d>>>> vertices;
+  std::vector<std::vector<std::vector<std::pair<Eigen::Vector3d, double>>>>
+      halfspace;
+};
+
+const BoxSphereIntersectionTable& GetBoxSphereIntersectionTable(
+    int num_intervals_per_half_axis,
+    const Eigen::Ref<const Eigen::VectorXd>& phi_nonnegative) {
+  static never_destroyed<std::mutex> mutex;
+  static never_destroyed<
+      std::map<int, std::unique_ptr<BoxSphereIntersectionTable>>>
+      table_cache;
+  std::lock_guard<std::mutex> lock(mutex.access());
+  auto& table = table_cache.access()[num_intervals_per_half_axis];
+  if (table == nullptr) {
+    table = std::make_unique<BoxSphereIntersectionTable>();
+    ComputeBoxSphereIntersectionAndHalfSpace(num_intervals_per_half_axis,
+                                             phi_nonnegative, &table->vertices,
+                                             &table->halfspace);
+  }
+  return *table;
+}
+
 }  // namespace
 
 std::string to_string(MixedIntegerRotationConstraintGenerator::Approach type) {
@@ -863,12 +897,14 @@ MixedIntegerRotationConstraintGenerator::
 
   // If we consider the box-sphere intersection, then we need to compute the
   // halfspace nᵀx≥ d, as the tightest halfspace for each intersection region.
+  // The tables are memoized process-wide, so only the first generator with a
+  // given num_intervals_per_half_axis pays for the computation.
   if (approach_ == Approach::kBoxSphereIntersection ||
       approach_ == Approach::kBoth) {
-    ComputeBoxSphereIntersectionAndHalfSpace(
-        num_intervals_per_half_axis_, phi_nonnegative_,
-        &box_sphere_intersection_vertices_,
-        &box_sphere_intersection_halfspace_);
+    const BoxSphereIntersectionTable& table = GetBoxSphereIntersectionTable(
+        num_intervals_per_half_axis_, phi_nonnegative_);
+    box_sphere_intersection_vertices_ = table.vertices;
+    box_sphere_intersection_halfspace_ = table.halfspace;
   }
 }
 
@@ -641,6 +641,35 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
                                      const VectorX<T>& q, VectorX<T>* z,
                                      const T& piv_tol,
                                      const T& zero_tol) const {
+  return SolveLcpLemkeImpl(M, q, z, piv_tol, zero_tol,
+                           false /* warm_starting */);
+}
+
+template <typename T>
+bool MobyLCPSolver<T>::SolveLcpLemkeWarmStarted(const MatrixX<T>& M,
+                                                const VectorX<T>& q,
+                                                VectorX<T>* z,
+                                                const T& piv_tol,
+                                                const T& zero_tol) const {
+  if (SolveLcpLemkeImpl(M, q, z, piv_tol, zero_tol,
+                        true /* warm_starting */)) {
+    return true;
+  }
+
+  // Lemke's Algorithm does not always recover from an arbitrary starting
+  // basis; fall back on the standard cold start rather than reporting
+  // failure for a solvable LCP.
+  Log() << "MobyLCPSolver::SolveLcpLemkeWarmStarted() - warm start failed; "
+        << "retrying from a cold start" << std::endl;
+  return SolveLcpLemkeImpl(M, q, z, piv_tol, zero_tol,
+                           false /* warm_starting */);
+}
+
+template <typename T>
+bool MobyLCPSolver<T>::SolveLcpLemkeImpl(const MatrixX<T>& M,
+                                         const VectorX<T>& q, VectorX<T>* z,
+                                         const T& piv_tol, const T& zero_tol,
+                                         bool warm_starting) const {
   using std::max;
 
   // Variables that will be reused multiple times, thus hopefully allowing
@@ -680,11 +709,12 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
     return true;
   }
 
-  // Lemke's algorithm doesn't seem to like warmstarting
-  //
-  // TODO(sammy-tri) this is not present in the sparse solver, and it
-  // causes subtle dead code below.
-  z->fill(0);
+  // Lemke's algorithm doesn't seem to like warmstarting from an arbitrary z,
+  // so only the dedicated warm-started entry point keeps the incoming value;
+  // SolveLcpLemkeWarmStarted() falls back on a cold start if the warm start
+  // fails to converge.
+  if (!warm_starting)
+    z->fill(0);
 
   // copy z to z0
   z0 = *z;
@@ -738,8 +768,9 @@ bool MobyLCPSolver<T>::SolveLcpLemke(const MatrixX<T>& M,
     Bl.block(0, 0, t1.rows(), t1.cols()) = t1;
     Bl.block(0, t1.cols(), t2.rows(), t2.cols()) = t2;
 
-    // Solve B*x = -q.
-    x = LinearSolve(Bl, q);
+    // Solve B*x = -q. (The basis columns are +M for basic z variables and
+    // -I for basic w variables, so the basic solution satisfies Bl*x = -q.)
+    x = LinearSolve(Bl, (-q).eval());
   } else {
     Log() << "-- using basis of -1 (no warmstarting)" << std::endl;
 
@@ -228,6 +228,28 @@ class MobyLCPSolver : public MathematicalProgramSolverInterface {
                      VectorX<T>* z, const T& piv_tol = T(-1),
                      const T& zero_tol = T(-1)) const;
 
+  /// Warm-started version of Lemke's Algorithm, intended for sequences of
+  /// nearly identical LCPs such as the contact problems of consecutive time
+  /// steps. The value of @p z on entry is interpreted as the previous
+  /// solution, and its positive components determine the starting basis. If
+  /// that basis is still complementary for the new (M, q) pair, the solve
+  /// returns without pivoting at all (get_num_pivots() reports zero);
+  /// otherwise Lemke's Algorithm pivots onward from the old basis. If the
+  /// warm-started pivoting sequence fails — the known hazard of starting
+  /// Lemke from an arbitrary basis — the solver automatically retries from a
+  /// cold start, so this method never does worse than SolveLcpLemke() except
+  /// for the wasted pivots.
+  /// @param[in,out] z on entry, the previous solution (pass a vector whose
+  ///                length differs from that of q, e.g. an empty vector, to
+  ///                force a cold start); on return, the solution to the LCP
+  ///                (if the solver succeeds). If the solver fails (returns
+  ///                `false`), `z` will be set to the zero vector.
+  /// See SolveLcpLemke() for a description of the remaining parameters, the
+  /// return value, and the applicable matrix classes.
+  bool SolveLcpLemkeWarmStarted(const MatrixX<T>& M, const VectorX<T>& q,
+                                VectorX<T>* z, const T& piv_tol = T(-1),
+                                const T& zero_tol = T(-1)) const;
+
   /// Lemke's Algorithm for solving LCPs in the matrix class E, which contains
   /// all strictly semimonotone matrices, all P-matrices, and all strictly
   /// copositive matrices. Lemke's Algorithm is described in [Cottle 1992],
@@ -294,6 +316,13 @@ class MobyLCPSolver : public MathematicalProgramSolverInterface {
  private:
   void ClearIndexVectors() const;
 
+  // The common implementation of SolveLcpLemke() and
+  // SolveLcpLemkeWarmStarted(). When @p warm_starting is true, the value of
+  // z on entry seeds the starting basis; otherwise z is zeroed first.
+  bool SolveLcpLemkeImpl(const MatrixX<T>& M, const VectorX<T>& q,
+                         VectorX<T>* z, const T& piv_tol, const T& zero_tol,
+                         bool warm_starting) const;
+
   template <typename MatrixType, typename Scalar>
   void FinishLemkeSolution(const MatrixType& M, const VectorX<Scalar>& q,
                            const VectorX<Scalar>& x, VectorX<Scalar>* z) const;
@@ -9,6 +9,14 @@
 namespace drake {
 namespace solvers {
 
+// The cached workspace is only used by the available flavor of this class;
+// this empty definition just lets the unique_ptr member be destroyed.
+struct OsqpSolver::Workspace {};
+
+OsqpSolver::OsqpSolver() = default;
+
+OsqpSolver::~OsqpSolver() = default;
+
 bool OsqpSolver::is_available() { return false; }
 
 SolutionResult OsqpSolver::Solve(MathematicalProgram&) const {
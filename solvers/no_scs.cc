@@ -26,5 +26,21 @@ SolutionResult ScsSolver::Solve(MathematicalProgram&) const {
       "solver.");
 }
 
+class ScsSession::Impl {};
+
+ScsSession::ScsSession(const MathematicalProgram&) {
+  throw std::runtime_error(
+      "The SCS bindings were not compiled.  You'll need to use a different "
+      "solver.");
+}
+
+ScsSession::~ScsSession() = default;
+
+void ScsSession::Solve(MathematicalProgramResult*) {
+  throw std::runtime_error(
+      "The SCS bindings were not compiled.  You'll need to use a different "
+      "solver.");
+}
+
 }  // namespace solvers
 }  // namespace drake
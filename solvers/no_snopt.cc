@@ -7,6 +7,14 @@
 namespace drake {
 namespace solvers {
 
+// Stub so that the unique_ptr in the header has a complete type; this build
+// flavor never caches a session.
+struct SnoptSolver::Workspace {};
+
+SnoptSolver::SnoptSolver() = default;
+
+SnoptSolver::~SnoptSolver() = default;
+
 bool SnoptSolver::is_available() { return false; }
 
 void SnoptSolver::Solve(const MathematicalProgram&,
@@ -1,5 +1,7 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <cstring>
+#include <utility>
 #include <vector>
 
 #include <osqp.h>
@@ -217,6 +219,58 @@ void SetOsqpSolverSettings(const SolverOptions& solver_options,
 }
 }  // namespace
 
+// The persistent OSQP workspace, together with the structural signature (the
+// dimensions and P/A sparsity patterns) and settings of the program it was
+// set up for. See the class overview in osqp_solver.h.
+struct OsqpSolver::Workspace {
+  ~Workspace() {
+    if (work != nullptr) {
+      osqp_cleanup(work);
+    }
+  }
+
+  // Returns true iff this workspace was set up for a program with the same
+  // dimensions, the same P/A sparsity patterns, and the same settings, so
+  // that refreshing it with in-place osqp_update_* calls is valid.
+  bool Matches(const Eigen::SparseMatrix<c_float>& P,
+               const Eigen::SparseMatrix<c_float>& A,
+               const OSQPSettings& new_settings) const {
+    return work != nullptr && P.cols() == n && A.rows() == m &&
+           SameSparsity(P, P_outer, P_inner) &&
+           SameSparsity(A, A_outer, A_inner) &&
+           std::memcmp(&new_settings, &settings, sizeof(OSQPSettings)) == 0;
+  }
+
+  static bool SameSparsity(const Eigen::SparseMatrix<c_float>& mat,
+                           const std::vector<c_int>& outer,
+                           const std::vector<c_int>& inner) {
+    if (static_cast<int>(outer.size()) != mat.cols() + 1 ||
+        static_cast<int>(inner.size()) != mat.nonZeros()) {
+      return false;
+    }
+    for (int i = 0; i < mat.cols() + 1; ++i) {
+      if (outer[i] != mat.outerIndexPtr()[i]) return false;
+    }
+    for (int i = 0; i < mat.nonZeros(); ++i) {
+      if (inner[i] != mat.innerIndexPtr()[i]) return false;
+    }
+    return true;
+  }
+
+  OSQPWorkspace* work{nullptr};
+  OSQPSettings settings;
+  c_int n{0};
+  c_int m{0};
+  std::vector<c_int> P_outer;
+  std::vector<c_int> P_inner;
+  std::vector<c_int> A_outer;
+  std::vector<c_int> A_inner;
+};
+
+OsqpSolver::OsqpSolver() = default;
+
+OsqpSolver::~OsqpSolver() = default;
+
 bool OsqpSolver::is_available() { return true; }
 
 void OsqpSolver::Solve(const MathematicalProgram& prog,
@@ -224,8 +278,6 @@ void OsqpSolver::Solve(const MathematicalProgram& prog,
                        const optional<SolverOptions>& solver_options,
                        MathematicalProgramResult* result) const {
   *result = {};
-  // TODO(hongkai.dai): OSQP uses initial guess to warm start.
-  unused(initial_guess);
   if (!AreProgramAttributesSatisfied(prog)) {
     throw std::invalid_argument(
         "OSQP solver's capability doesn't satisfy the requirement of the "
@@ -237,48 +289,116 @@ void OsqpSolver::Solve(const MathematicalProgram& prog,
   // s.t l ≤ Ax ≤ u
   // OSQP is written in C, so this function will be in C style.
 
+  const int num_vars = prog.num_vars();
+
   // Get the cost for the QP.
   Eigen::SparseMatrix<c_float> P_sparse;
-  std::vector<c_float> q(prog.num_vars(), 0);
+  std::vector<c_float> q(num_vars, 0);
   double constant_cost_term{0};
 
   ParseQuadraticCosts(prog, &P_sparse, &q, &constant_cost_term);
   ParseLinearCosts(prog, &q, &constant_cost_term);
 
+  // OSQP stores the Hessian by its upper triangular part. Passing it in that
+  // form keeps our value array aligned with OSQP's internal copy, so the
+  // workspace can be refreshed in place by osqp_update_P below.
+  Eigen::SparseMatrix<c_float> P_upper =
+      P_sparse.triangularView<Eigen::Upper>();
+  P_upper.makeCompressed();
+
   // Parse the linear constraints.
   Eigen::SparseMatrix<c_float> A_sparse;
   std::vector<c_float> l, u;
   ParseAllLinearConstraints(prog, &A_sparse, &l, &u);
 
-  // Now pass the constraint and cost to osqp data.
-  OSQPData* data;  // OSQPData
-
-  // Populate data.
-  data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
-
-  data->n = prog.num_vars();
-  data->m = A_sparse.rows();
-  data->P = EigenSparseToCSC(P_sparse);
-  data->q = q.data();
-  data->A = EigenSparseToCSC(A_sparse);
-  data->l = l.data();
-  data->u = u.data();
-
   // Define Solver settings as default.
   // Problem settings
-  OSQPSettings* settings =
-      static_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
-  osqp_set_default_settings(settings);
+  OSQPSettings settings;
+  // memset (rather than just osqp_set_default_settings) so that the struct's
+  // padding bytes are deterministic; Workspace::Matches compares settings
+  // with memcmp.
+  std::memset(&settings, 0, sizeof(settings));
+  osqp_set_default_settings(&settings);
 
   SolverOptions merged_solver_options =
       solver_options.value_or(SolverOptions());
   merged_solver_options.Merge(prog.solver_options());
-  SetOsqpSolverSettings(merged_solver_options, settings);
-
-  // Setup workspace.
-  // OSQP structures.
-  OSQPWorkspace* work;  // Workspace
-  work = osqp_setup(data, settings);
+  SetOsqpSolverSettings(merged_solver_options, &settings);
+
+  // When this solver instance just solved a program with the same structure
+  // and settings (the common case in an MPC loop), refresh the cached
+  // workspace in place -- skipping the setup phase -- so that OSQP warm
+  // starts from the previous primal/dual solution. Otherwise run the full
+  // setup and cache the resulting workspace.
+  bool reused = false;
+  if (workspace_ != nullptr &&
+      workspace_->Matches(P_upper, A_sparse, settings)) {
+    OSQPWorkspace* const cached_work = workspace_->work;
+    reused = osqp_update_P(cached_work, P_upper.valuePtr(), OSQP_NULL,
+                           P_upper.nonZeros()) == 0 &&
+             osqp_update_A(cached_work, A_sparse.valuePtr(), OSQP_NULL,
+                           A_sparse.nonZeros()) == 0 &&
+             osqp_update_lin_cost(cached_work, q.data()) == 0 &&
+             osqp_update_bounds(cached_work, l.data(), u.data()) == 0;
+  }
+  if (!reused) {
+    workspace_.reset();
+
+    // Now pass the constraint and cost to osqp data.
+    OSQPData* data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
+    data->n = num_vars;
+    data->m = A_sparse.rows();
+    data->P = EigenSparseToCSC(P_upper);
+    data->q = q.data();
+    data->A = EigenSparseToCSC(A_sparse);
+    data->l = l.data();
+    data->u = u.data();
+
+    auto workspace = std::make_unique<Workspace>();
+    workspace->work = osqp_setup(data, &settings);
+
+    // osqp_setup copies the problem data into the workspace, so the scratch
+    // copies can be freed right away.
+    c_free(data->P->x);
+    c_free(data->P->i);
+    c_free(data->P->p);
+    c_free(data->P);
+    c_free(data->A->x);
+    c_free(data->A->i);
+    c_free(data->A->p);
+    c_free(data->A);
+    c_free(data);
+
+    if (workspace->work == nullptr) {
+      result->set_solver_id(id());
+      result->set_solution_result(SolutionResult::kInvalidInput);
+      return;
+    }
+    std::memcpy(&workspace->settings, &settings, sizeof(OSQPSettings));
+    workspace->n = num_vars;
+    workspace->m = A_sparse.rows();
+    workspace->P_outer.assign(P_upper.outerIndexPtr(),
+                              P_upper.outerIndexPtr() + P_upper.cols() + 1);
+    workspace->P_inner.assign(P_upper.innerIndexPtr(),
+                              P_upper.innerIndexPtr() + P_upper.nonZeros());
+    workspace->A_outer.assign(A_sparse.outerIndexPtr(),
+                              A_sparse.outerIndexPtr() + A_sparse.cols() + 1);
+    workspace->A_inner.assign(A_sparse.innerIndexPtr(),
+                              A_sparse.innerIndexPtr() + A_sparse.nonZeros());
+    workspace_ = std::move(workspace);
+  }
+  OSQPWorkspace* const work = workspace_->work;
+
+  // Warm start the primal variables from the caller's initial guess when one
+  // is provided (a guess with unset -- i.e. NaN -- entries is ignored).
+  if (initial_guess.has_value() && initial_guess->allFinite()) {
+    DRAKE_DEMAND(initial_guess->rows() == num_vars);
+    std::vector<c_float> x_guess(num_vars);
+    for (int i = 0; i < num_vars; ++i) {
+      x_guess[i] = static_cast<c_float>((*initial_guess)(i));
+    }
+    osqp_warm_start_x(work, x_guess.data());
+  }
 
   // Solve Problem.
   c_int osqp_exitflag = osqp_solve(work);
@@ -328,18 +448,8 @@ void OsqpSolver::Solve(const MathematicalProgram& prog,
   }
   result->set_solution_result(solution_result);
 
-  // Clean workspace.
-  osqp_cleanup(work);
-  c_free(data->P->x);
-  c_free(data->P->i);
-  c_free(data->P->p);
-  c_free(data->P);
-  c_free(data->A->x);
-  c_free(data->A->i);
-  c_free(data->A->p);
-  c_free(data->A);
-  c_free(data);
-  c_free(settings);
+  // The workspace is deliberately kept alive (in workspace_) so that the next
+  // structurally identical Solve() reuses it; ~Workspace() cleans it up.
 }
 
 SolutionResult OsqpSolver::Solve(MathematicalProgram& prog) const {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "drake/common/drake_copyable.h"
 #include "drake/solvers/mathematical_program_solver_interface.h"
 
@@ -30,12 +32,25 @@ struct OsqpSolverDetails {
   double run_time{};
 };
 
+/**
+ * An interface to the OSQP solver.
+ *
+ * A given %OsqpSolver instance keeps the OSQP workspace from its most recent
+ * Solve() alive: when the next program has the same structure (same number of
+ * variables and constraint rows and the same P/A sparsity patterns, as arises
+ * when only coefficients or bounds change between solves, e.g., in MPC), the
+ * cached workspace is updated in place -- no matrix factorization setup --
+ * and OSQP warm starts from the previous primal/dual solution. A program
+ * with different structure transparently triggers a full re-setup. To
+ * benefit, reuse one solver instance across the repeated solves; a given
+ * instance must not be used from multiple threads concurrently.
+ */
 class OsqpSolver : public MathematicalProgramSolverInterface {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(OsqpSolver)
 
-  OsqpSolver() = default;
-  ~OsqpSolver() override = default;
+  OsqpSolver();
+  ~OsqpSolver() override;
 
   // This solver is implemented in various pieces depending on if Osqp was
   // available during compilation.
@@ -58,6 +73,14 @@ class OsqpSolver : public MathematicalProgramSolverInterface {
       const MathematicalProgram& prog) const override;
 
   static bool ProgramAttributesSatisfied(const MathematicalProgram& prog);
+
+ private:
+  // The persistent OSQP workspace (and the structural signature of the
+  // program it was set up for), reused across Solve() calls; see the class
+  // overview. Defined in the .cc file to keep the OSQP C types out of this
+  // header.
+  struct Workspace;
+  mutable std::unique_ptr<Workspace> workspace_;
 };
 }  // namespace solvers
 }  // namespace drake
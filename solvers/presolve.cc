@@ -0,0 +1,417 @@
+#include "drake/solvers/presolve.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "drake/solvers/solve.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+// A dense linear row lb <= a'x <= ub over the original decision variables.
+struct PresolveRow {
+  Eigen::RowVectorXd a;
+  double lb{};
+  double ub{};
+  bool active{true};
+};
+
+// Returns true if the program only contains the cost and constraint types
+// that the presolve knows how to transform. Bounding box constraints are
+// recorded as ProgramAttribute::kLinearConstraint.
+bool ProgramIsSupported(const ProgramAttributes& attributes) {
+  for (const ProgramAttribute& attribute : attributes) {
+    if (attribute != ProgramAttribute::kLinearCost &&
+        attribute != ProgramAttribute::kQuadraticCost &&
+        attribute != ProgramAttribute::kLinearConstraint &&
+        attribute != ProgramAttribute::kLinearEqualityConstraint) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+PresolvedProgram::PresolvedProgram(const MathematicalProgram& prog,
+                                   double tol) {
+  const int num_vars = prog.num_vars();
+  reduced_index_.resize(num_vars);
+  fixed_value_ = Eigen::VectorXd::Zero(num_vars);
+  if (!ProgramIsSupported(prog.required_capabilities())) {
+    // Pass the program through unchanged, with an identity variable mapping.
+    reduced_prog_ = prog.Clone();
+    std::iota(reduced_index_.begin(), reduced_index_.end(), 0);
+    return;
+  }
+
+  // Intersect the bounding box constraints into per-variable bounds.
+  Eigen::VectorXd lb = Eigen::VectorXd::Constant(num_vars, -kInf);
+  Eigen::VectorXd ub = Eigen::VectorXd::Constant(num_vars, kInf);
+  for (const auto& binding : prog.bounding_box_constraints()) {
+    for (int k = 0; k < static_cast<int>(binding.GetNumElements()); ++k) {
+      const int j = prog.FindDecisionVariableIndex(binding.variables()(k));
+      lb(j) = std::max(lb(j), binding.evaluator()->lower_bound()(k));
+      ub(j) = std::min(ub(j), binding.evaluator()->upper_bound()(k));
+    }
+  }
+
+  // Scatter every linear (in)equality row onto the full variable set.
+  std::vector<PresolveRow> rows;
+  auto append_rows = [&](const auto& binding) {
+    const auto& constraint = *binding.evaluator();
+    Eigen::MatrixXd A =
+        Eigen::MatrixXd::Zero(constraint.num_constraints(), num_vars);
+    for (int k = 0; k < static_cast<int>(binding.GetNumElements()); ++k) {
+      const int j = prog.FindDecisionVariableIndex(binding.variables()(k));
+      A.col(j) += constraint.A().col(k);
+    }
+    for (int i = 0; i < constraint.num_constraints(); ++i) {
+      rows.push_back(PresolveRow{A.row(i), constraint.lower_bound()(i),
+                                 constraint.upper_bound()(i), true});
+    }
+  };
+  for (const auto& binding : prog.linear_equality_constraints()) {
+    append_rows(binding);
+  }
+  for (const auto& binding : prog.linear_constraints()) {
+    append_rows(binding);
+  }
+
+  // Merge duplicate rows by intersecting their bounds.
+  std::map<std::vector<double>, int> row_by_coefficients;
+  for (int i = 0; i < static_cast<int>(rows.size()); ++i) {
+    const std::vector<double> key(rows[i].a.data(),
+                                  rows[i].a.data() + num_vars);
+    const auto result = row_by_coefficients.emplace(key, i);
+    if (!result.second) {
+      PresolveRow& kept = rows[result.first->second];
+      kept.lb = std::max(kept.lb, rows[i].lb);
+      kept.ub = std::min(kept.ub, rows[i].ub);
+      rows[i].active = false;
+    }
+  }
+
+  // Iterate singleton-row conversion and variable fixing to a fixed point,
+  // since fixing a variable can turn another row into a singleton.
+  std::vector<bool> fixed(num_vars, false);
+  bool changed = true;
+  while (changed && !infeasible_) {
+    changed = false;
+    for (PresolveRow& row : rows) {
+      if (!row.active) {
+        continue;
+      }
+      // Substitute the variables fixed so far out of the row.
+      int num_nonzero = 0;
+      int last_nonzero = -1;
+      for (int j = 0; j < num_vars; ++j) {
+        if (row.a(j) == 0) {
+          continue;
+        }
+        if (fixed[j]) {
+          const double shift = row.a(j) * fixed_value_(j);
+          row.lb -= shift;
+          row.ub -= shift;
+          row.a(j) = 0;
+        } else {
+          ++num_nonzero;
+          last_nonzero = j;
+        }
+      }
+      if (num_nonzero == 0) {
+        if (row.lb > tol || row.ub < -tol) {
+          infeasible_ = true;
+        }
+        row.active = false;
+      } else if (num_nonzero == 1) {
+        // Convert the singleton row to bounds on its variable.
+        const int j = last_nonzero;
+        const double coeff = row.a(j);
+        double var_lb = row.lb / coeff;
+        double var_ub = row.ub / coeff;
+        if (coeff < 0) {
+          std::swap(var_lb, var_ub);
+        }
+        lb(j) = std::max(lb(j), var_lb);
+        ub(j) = std::min(ub(j), var_ub);
+        row.active = false;
+        changed = true;
+      }
+    }
+    // Fix the variables whose bounds have collapsed.
+    for (int j = 0; j < num_vars; ++j) {
+      if (fixed[j]) {
+        continue;
+      }
+      if (lb(j) > ub(j) + tol) {
+        infeasible_ = true;
+      } else if (std::isfinite(lb(j)) && ub(j) - lb(j) <= tol) {
+        fixed[j] = true;
+        fixed_value_(j) = 0.5 * (lb(j) + ub(j));
+        changed = true;
+      }
+    }
+  }
+
+  // One pass of activity-based bound tightening on the remaining rows.
+  for (const PresolveRow& row : rows) {
+    if (infeasible_) {
+      break;
+    }
+    if (!row.active) {
+      continue;
+    }
+    // The minimum activity of the row, together with the number of variables
+    // whose contribution is -infinity (and symmetrically for the maximum).
+    double min_activity = 0;
+    double max_activity = 0;
+    int num_min_inf = 0;
+    int num_max_inf = 0;
+    for (int j = 0; j < num_vars; ++j) {
+      const double coeff = row.a(j);
+      if (coeff == 0) {
+        continue;
+      }
+      const double toward_min = coeff > 0 ? coeff * lb(j) : coeff * ub(j);
+      const double toward_max = coeff > 0 ? coeff * ub(j) : coeff * lb(j);
+      if (std::isinf(toward_min)) {
+        ++num_min_inf;
+      } else {
+        min_activity += toward_min;
+      }
+      if (std::isinf(toward_max)) {
+        ++num_max_inf;
+      } else {
+        max_activity += toward_max;
+      }
+    }
+    if (num_min_inf == 0 && min_activity > row.ub + tol) {
+      infeasible_ = true;
+      break;
+    }
+    if (num_max_inf == 0 && max_activity < row.lb - tol) {
+      infeasible_ = true;
+      break;
+    }
+    for (int j = 0; j < num_vars; ++j) {
+      const double coeff = row.a(j);
+      if (coeff == 0) {
+        continue;
+      }
+      const double toward_min = coeff > 0 ? coeff * lb(j) : coeff * ub(j);
+      const double toward_max = coeff > 0 ? coeff * ub(j) : coeff * lb(j);
+      // The activity of the rest of the row is finite only when variable j
+      // accounts for every infinite contribution.
+      if (num_min_inf == (std::isinf(toward_min) ? 1 : 0) &&
+          std::isfinite(row.ub)) {
+        const double residual =
+            row.ub - (std::isinf(toward_min) ? min_activity
+                                             : min_activity - toward_min);
+        if (coeff > 0) {
+          ub(j) = std::min(ub(j), residual / coeff);
+        } else {
+          lb(j) = std::max(lb(j), residual / coeff);
+        }
+      }
+      if (num_max_inf == (std::isinf(toward_max) ? 1 : 0) &&
+          std::isfinite(row.lb)) {
+        const double residual =
+            row.lb - (std::isinf(toward_max) ? max_activity
+                                             : max_activity - toward_max);
+        if (coeff > 0) {
+          lb(j) = std::max(lb(j), residual / coeff);
+        } else {
+          ub(j) = std::min(ub(j), residual / coeff);
+        }
+      }
+    }
+  }
+  for (int j = 0; j < num_vars && !infeasible_; ++j) {
+    if (!fixed[j] && lb(j) > ub(j) + tol) {
+      infeasible_ = true;
+    }
+  }
+
+  // Build the reduced program over the variables that were not fixed.
+  reduced_prog_ = std::make_unique<MathematicalProgram>();
+  int num_kept = 0;
+  for (int j = 0; j < num_vars; ++j) {
+    reduced_index_[j] = fixed[j] ? -1 : num_kept++;
+  }
+  const VectorXDecisionVariable x =
+      reduced_prog_->NewContinuousVariables(num_kept, "x");
+  if (num_kept > 0) {
+    Eigen::VectorXd lb_kept(num_kept);
+    Eigen::VectorXd ub_kept(num_kept);
+    for (int j = 0; j < num_vars; ++j) {
+      if (!fixed[j]) {
+        lb_kept(reduced_index_[j]) = lb(j);
+        ub_kept(reduced_index_[j]) = ub(j);
+      }
+    }
+    // Skip the bounding box entirely when no bound is finite, so that a pure
+    // equality-constrained program stays equality-constrained.
+    if ((lb_kept.array() > -kInf).any() || (ub_kept.array() < kInf).any()) {
+      reduced_prog_->AddBoundingBoxConstraint(lb_kept, ub_kept, x);
+    }
+  }
+  // Re-emit the surviving rows, keeping equality rows as equality
+  // constraints so that the reduced program retains its attributes.
+  int num_equality_rows = 0;
+  int num_inequality_rows = 0;
+  for (const PresolveRow& row : rows) {
+    if (row.active) {
+      (row.lb == row.ub ? num_equality_rows : num_inequality_rows)++;
+    }
+  }
+  if (num_kept > 0 && (num_equality_rows > 0 || num_inequality_rows > 0)) {
+    Eigen::MatrixXd Aeq(num_equality_rows, num_kept);
+    Eigen::VectorXd beq(num_equality_rows);
+    Eigen::MatrixXd A_kept(num_inequality_rows, num_kept);
+    Eigen::VectorXd row_lb(num_inequality_rows);
+    Eigen::VectorXd row_ub(num_inequality_rows);
+    int i_eq = 0;
+    int i_ineq = 0;
+    for (const PresolveRow& row : rows) {
+      if (!row.active) {
+        continue;
+      }
+      const bool is_equality = row.lb == row.ub;
+      const int i = is_equality ? i_eq++ : i_ineq++;
+      for (int j = 0; j < num_vars; ++j) {
+        if (!fixed[j]) {
+          (is_equality ? Aeq : A_kept)(i, reduced_index_[j]) = row.a(j);
+        }
+      }
+      if (is_equality) {
+        beq(i) = row.lb;
+      } else {
+        row_lb(i) = row.lb;
+        row_ub(i) = row.ub;
+      }
+    }
+    if (num_equality_rows > 0) {
+      reduced_prog_->AddLinearEqualityConstraint(Aeq, beq, x);
+    }
+    if (num_inequality_rows > 0) {
+      reduced_prog_->AddLinearConstraint(A_kept, row_lb, row_ub, x);
+    }
+  }
+
+  // Rebuild the costs, folding the contribution of the fixed variables into
+  // cost_constant_.
+  if (!prog.linear_costs().empty()) {
+    Eigen::VectorXd a_total = Eigen::VectorXd::Zero(num_vars);
+    for (const auto& binding : prog.linear_costs()) {
+      const auto& cost = *binding.evaluator();
+      for (int k = 0; k < static_cast<int>(binding.GetNumElements()); ++k) {
+        a_total(prog.FindDecisionVariableIndex(binding.variables()(k))) +=
+            cost.a()(k);
+      }
+      cost_constant_ += cost.b();
+    }
+    Eigen::VectorXd a_kept = Eigen::VectorXd::Zero(num_kept);
+    for (int j = 0; j < num_vars; ++j) {
+      if (fixed[j]) {
+        cost_constant_ += a_total(j) * fixed_value_(j);
+      } else {
+        a_kept(reduced_index_[j]) = a_total(j);
+      }
+    }
+    if (num_kept > 0) {
+      reduced_prog_->AddLinearCost(a_kept, x);
+    }
+  }
+  for (const auto& binding : prog.quadratic_costs()) {
+    const auto& cost = *binding.evaluator();
+    const int binding_size = static_cast<int>(binding.GetNumElements());
+    std::vector<int> kept_positions;
+    std::vector<int> fixed_positions;
+    for (int k = 0; k < binding_size; ++k) {
+      const int j = prog.FindDecisionVariableIndex(binding.variables()(k));
+      if (fixed[j]) {
+        fixed_positions.push_back(k);
+      } else {
+        kept_positions.push_back(k);
+      }
+    }
+    Eigen::VectorXd v(fixed_positions.size());
+    for (int q = 0; q < static_cast<int>(fixed_positions.size()); ++q) {
+      v(q) = fixed_value_(
+          prog.FindDecisionVariableIndex(binding.variables()(
+              fixed_positions[q])));
+    }
+    // With z = [z_kept; z_fixed], substituting z_fixed = v into
+    // 0.5 z'Qz + b'z + c leaves a quadratic cost in z_kept plus a constant.
+    const int num_binding_kept = static_cast<int>(kept_positions.size());
+    Eigen::MatrixXd Q_kept(num_binding_kept, num_binding_kept);
+    Eigen::VectorXd b_kept(num_binding_kept);
+    VectorXDecisionVariable binding_vars_kept(num_binding_kept);
+    for (int p = 0; p < num_binding_kept; ++p) {
+      b_kept(p) = cost.b()(kept_positions[p]);
+      for (int q = 0; q < num_binding_kept; ++q) {
+        Q_kept(p, q) = cost.Q()(kept_positions[p], kept_positions[q]);
+      }
+      for (int q = 0; q < static_cast<int>(fixed_positions.size()); ++q) {
+        b_kept(p) += cost.Q()(kept_positions[p], fixed_positions[q]) * v(q);
+      }
+      binding_vars_kept(p) =
+          x(reduced_index_[prog.FindDecisionVariableIndex(
+              binding.variables()(kept_positions[p]))]);
+    }
+    cost_constant_ += cost.c();
+    for (int q = 0; q < static_cast<int>(fixed_positions.size()); ++q) {
+      cost_constant_ += cost.b()(fixed_positions[q]) * v(q);
+      for (int r = 0; r < static_cast<int>(fixed_positions.size()); ++r) {
+        cost_constant_ +=
+            0.5 * cost.Q()(fixed_positions[q], fixed_positions[r]) * v(q) *
+            v(r);
+      }
+    }
+    if (num_binding_kept > 0) {
+      reduced_prog_->AddQuadraticCost(Q_kept, b_kept, binding_vars_kept);
+    }
+  }
+}
+
+MathematicalProgramResult PresolvedProgram::MapSolutionBack(
+    const MathematicalProgramResult& reduced_result) const {
+  MathematicalProgramResult result = reduced_result;
+  const Eigen::VectorXd& x_reduced = reduced_result.get_x_val();
+  if (x_reduced.rows() == reduced_prog_->num_vars()) {
+    Eigen::VectorXd x(reduced_index_.size());
+    for (int j = 0; j < static_cast<int>(reduced_index_.size()); ++j) {
+      x(j) = reduced_index_[j] >= 0 ? x_reduced(reduced_index_[j])
+                                    : fixed_value_(j);
+    }
+    result.set_x_val(x);
+  }
+  result.set_optimal_cost(reduced_result.get_optimal_cost() + cost_constant_);
+  return result;
+}
+
+MathematicalProgramResult SolveWithPresolve(const MathematicalProgram& prog) {
+  const PresolvedProgram presolved(prog);
+  if (presolved.is_infeasible()) {
+    MathematicalProgramResult result;
+    result.set_solution_result(SolutionResult::kInfeasibleConstraints);
+    result.set_optimal_cost(MathematicalProgram::kGlobalInfeasibleCost);
+    return result;
+  }
+  if (presolved.reduced_prog().num_vars() == 0) {
+    // The presolve fixed every variable; there is nothing left to solve.
+    MathematicalProgramResult result;
+    result.set_solution_result(SolutionResult::kSolutionFound);
+    return presolved.MapSolutionBack(result);
+  }
+  return presolved.MapSolutionBack(Solve(presolved.reduced_prog()));
+}
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/mathematical_program_result.h"
+
+namespace drake {
+namespace solvers {
+/**
+ * Applies a presolve pass to a linear or quadratic program, producing a
+ * smaller program together with the bookkeeping needed to map a solution of
+ * the reduced program back to the original decision variables.
+ *
+ * The pass operates on the linear constraint bindings of the program:
+ * - Rows with a single nonzero coefficient are converted to variable bounds.
+ * - Duplicate rows (identical coefficients) are merged by intersecting their
+ *   bounds.
+ * - Variables whose lower and upper bounds coincide are fixed and substituted
+ *   out of the remaining constraints and costs.
+ * - Variable bounds are tightened once using the activity of each remaining
+ *   row.
+ * These steps are iterated to a fixed point, since fixing a variable can turn
+ * another row into a singleton.
+ *
+ * Programs containing costs or constraints other than linear costs, quadratic
+ * costs, (in)equality linear constraints and bounding box constraints are
+ * passed through unchanged, so it is always safe to apply the presolve.
+ *
+ * If the presolve proves the program infeasible (for example two duplicate
+ * equality rows with different right-hand sides), is_infeasible() returns
+ * true and the reduced program should not be solved.
+ */
+class PresolvedProgram {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PresolvedProgram)
+
+  /**
+   * Presolves @p prog. The original program is not modified.
+   * @param prog The program to presolve. The reference is only used inside
+   * the constructor; it is not retained.
+   * @param tol The tolerance used to detect fixed variables (ub - lb ≤ tol)
+   * and infeasible bounds (lb > ub + tol).
+   */
+  explicit PresolvedProgram(const MathematicalProgram& prog,
+                            double tol = 1E-10);
+
+  /** Getter for the reduced program. */
+  const MathematicalProgram& reduced_prog() const { return *reduced_prog_; }
+
+  /** Getter for the mutable reduced program. */
+  MathematicalProgram* get_mutable_reduced_prog() {
+    return reduced_prog_.get();
+  }
+
+  /** Returns true if the presolve proved the original program infeasible. */
+  bool is_infeasible() const { return infeasible_; }
+
+  /**
+   * Maps a result of solving the reduced program back to the original
+   * decision variables: fixed variables take their presolved values, the
+   * remaining variables take the values found by the solver, and the constant
+   * cost contribution of the fixed variables is added back to the optimal
+   * cost.
+   */
+  MathematicalProgramResult MapSolutionBack(
+      const MathematicalProgramResult& reduced_result) const;
+
+ private:
+  std::unique_ptr<MathematicalProgram> reduced_prog_;
+  bool infeasible_{false};
+  // reduced_index_[i] is the index of the i-th original decision variable in
+  // the reduced program, or -1 if the variable was fixed by the presolve.
+  std::vector<int> reduced_index_;
+  // fixed_value_(i) is the value of the i-th original decision variable when
+  // reduced_index_[i] is -1, and unused otherwise.
+  Eigen::VectorXd fixed_value_;
+  // The constant cost contribution of the fixed variables (plus the constant
+  // terms of the original costs), which is not part of the reduced program.
+  double cost_constant_{0};
+};
+
+/**
+ * Presolves @p prog with PresolvedProgram, solves the reduced program with
+ * the best available solver (as in Solve()), and maps the solution back to
+ * the original decision variables. If the presolve proves the program
+ * infeasible, returns a result with SolutionResult::kInfeasibleConstraints
+ * without calling a solver.
+ */
+MathematicalProgramResult SolveWithPresolve(const MathematicalProgram& prog);
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,171 @@
+#include "drake/solvers/program_template.h"
+
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+namespace drake {
+namespace solvers {
+
+using symbolic::Evaluate;
+using symbolic::Expression;
+using symbolic::Substitution;
+using symbolic::Variable;
+
+VectorX<Variable> ProgramTemplate::NewParameters(int rows,
+                                                 const std::string& name) {
+  DRAKE_DEMAND(rows >= 0);
+  VectorX<Variable> parameters(rows);
+  for (int i = 0; i < rows; ++i) {
+    parameters(i) = Variable(fmt::format("{}({})", name, i));
+    parameters_.push_back(parameters(i));
+    parameter_set_.insert(parameters(i));
+    environment_.insert(parameters(i), 0.0);
+  }
+  return parameters;
+}
+
+VectorXDecisionVariable ProgramTemplate::ExtractBoundVariables(
+    const Expression& e) const {
+  std::vector<Variable> bound;
+  for (const Variable& var : e.GetVariables()) {
+    if (parameter_set_.include(var)) {
+      continue;
+    }
+    // Throws if `var` is neither a parameter nor a decision variable.
+    FindDecisionVariableIndex(var);
+    bound.push_back(var);
+  }
+  VectorXDecisionVariable x(bound.size());
+  for (int i = 0; i < x.rows(); ++i) {
+    x(i) = bound[i];
+  }
+  return x;
+}
+
+void ProgramTemplate::ThrowIfNotParameterOnly(const Expression& e,
+                                              const char* source) const {
+  for (const Variable& var : e.GetVariables()) {
+    if (!parameter_set_.include(var)) {
+      throw std::runtime_error(
+          fmt::format("ProgramTemplate::{}: the expression {} should contain "
+                      "only parameters, but depends on the decision variable "
+                      "{}.",
+                      source, e.to_string(), var.get_name()));
+    }
+  }
+}
+
+Binding<LinearCost> ProgramTemplate::AddParameterizedLinearCost(
+    const Expression& e) {
+  const VectorXDecisionVariable x = ExtractBoundVariables(e);
+  // Decompose e = a(p)'x + b(p) once, symbolically.
+  const VectorX<Expression> a =
+      symbolic::Jacobian(Vector1<Expression>(e), x).transpose();
+  Substitution zero_x;
+  for (int i = 0; i < x.rows(); ++i) {
+    zero_x.emplace(x(i), 0.0);
+  }
+  const Expression b = e.Substitute(zero_x);
+  for (int i = 0; i < a.rows(); ++i) {
+    ThrowIfNotParameterOnly(a(i), "AddParameterizedLinearCost");
+  }
+  ThrowIfNotParameterOnly(b, "AddParameterizedLinearCost");
+
+  const Binding<LinearCost> binding =
+      AddLinearCost(Evaluate(a, environment_), b.Evaluate(environment_), x);
+  linear_cost_updates_.push_back({binding, a, b});
+  return binding;
+}
+
+Binding<QuadraticCost> ProgramTemplate::AddParameterizedQuadraticCost(
+    const Expression& e) {
+  const VectorXDecisionVariable x = ExtractBoundVariables(e);
+  // Decompose e = 0.5 x'Q(p)x + b(p)'x + c(p) once, symbolically: Q is the
+  // Hessian of e in x, and b and c come from evaluating the gradient and e
+  // itself at x = 0.
+  const VectorX<Expression> gradient =
+      symbolic::Jacobian(Vector1<Expression>(e), x).transpose();
+  const MatrixX<Expression> Q = symbolic::Jacobian(gradient, x);
+  Substitution zero_x;
+  for (int i = 0; i < x.rows(); ++i) {
+    zero_x.emplace(x(i), 0.0);
+  }
+  VectorX<Expression> b(x.rows());
+  for (int i = 0; i < x.rows(); ++i) {
+    b(i) = gradient(i).Substitute(zero_x);
+  }
+  const Expression c = e.Substitute(zero_x);
+  for (int i = 0; i < Q.rows(); ++i) {
+    for (int j = 0; j < Q.cols(); ++j) {
+      ThrowIfNotParameterOnly(Q(i, j), "AddParameterizedQuadraticCost");
+    }
+    ThrowIfNotParameterOnly(b(i), "AddParameterizedQuadraticCost");
+  }
+  ThrowIfNotParameterOnly(c, "AddParameterizedQuadraticCost");
+
+  const Binding<QuadraticCost> binding =
+      AddQuadraticCost(Evaluate(Q, environment_), Evaluate(b, environment_),
+                       c.Evaluate(environment_), x);
+  quadratic_cost_updates_.push_back({binding, Q, b, c});
+  return binding;
+}
+
+Binding<LinearConstraint> ProgramTemplate::AddParameterizedLinearConstraint(
+    const Expression& e, const Expression& lb, const Expression& ub) {
+  const VectorXDecisionVariable x = ExtractBoundVariables(e);
+  const VectorX<Expression> a =
+      symbolic::Jacobian(Vector1<Expression>(e), x).transpose();
+  Substitution zero_x;
+  for (int i = 0; i < x.rows(); ++i) {
+    zero_x.emplace(x(i), 0.0);
+  }
+  // Fold the constant part of e into the bounds, as the numeric
+  // AddLinearConstraint overload expects lb <= a'x <= ub.
+  const Expression b = e.Substitute(zero_x);
+  for (int i = 0; i < a.rows(); ++i) {
+    ThrowIfNotParameterOnly(a(i), "AddParameterizedLinearConstraint");
+  }
+  ThrowIfNotParameterOnly(b, "AddParameterizedLinearConstraint");
+  ThrowIfNotParameterOnly(lb, "AddParameterizedLinearConstraint");
+  ThrowIfNotParameterOnly(ub, "AddParameterizedLinearConstraint");
+  const Expression shifted_lb = lb - b;
+  const Expression shifted_ub = ub - b;
+
+  const Binding<LinearConstraint> binding = AddLinearConstraint(
+      Evaluate(a, environment_).transpose(),
+      shifted_lb.Evaluate(environment_), shifted_ub.Evaluate(environment_), x);
+  linear_constraint_updates_.push_back({binding, a, shifted_lb, shifted_ub});
+  return binding;
+}
+
+void ProgramTemplate::SetParameterValues(
+    const Eigen::Ref<const Eigen::VectorXd>& values) {
+  if (values.rows() != num_parameters()) {
+    throw std::runtime_error(
+        fmt::format("ProgramTemplate::SetParameterValues: expected {} "
+                    "parameter values, but got {}.",
+                    num_parameters(), values.rows()));
+  }
+  for (int i = 0; i < num_parameters(); ++i) {
+    environment_[parameters_[i]] = values(i);
+  }
+  for (const auto& update : linear_cost_updates_) {
+    update.binding.evaluator()->UpdateCoefficients(
+        Evaluate(update.a, environment_), update.b.Evaluate(environment_));
+  }
+  for (const auto& update : quadratic_cost_updates_) {
+    update.binding.evaluator()->UpdateCoefficients(
+        Evaluate(update.Q, environment_), Evaluate(update.b, environment_),
+        update.c.Evaluate(environment_));
+  }
+  for (const auto& update : linear_constraint_updates_) {
+    update.binding.evaluator()->UpdateCoefficients(
+        Evaluate(update.a, environment_).transpose(),
+        Vector1d(update.lb.Evaluate(environment_)),
+        Vector1d(update.ub.Evaluate(environment_)));
+  }
+}
+
+}  // namespace solvers
+}  // namespace drake
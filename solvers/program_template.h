@@ -0,0 +1,131 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/symbolic.h"
+#include "drake/solvers/mathematical_program.h"
+
+namespace drake {
+namespace solvers {
+
+/**
+ * A MathematicalProgram whose symbolic costs and constraints are parsed once,
+ * with placeholder "parameters" standing in for the numeric data that changes
+ * between solves.
+ *
+ * Building a program from symbolic expressions every control cycle re-runs
+ * the expression decomposition (DecomposeLinearExpressions and friends) even
+ * though the program's structure never changes. A %ProgramTemplate instead
+ * compiles each parameterized cost/constraint when it is added: the
+ * expression is decomposed with respect to the decision variables up front,
+ * leaving per-coefficient expressions that depend only on the parameters.
+ * SetParameterValues() then rebinds new numeric data by evaluating those
+ * coefficient expressions and updating the stored costs/constraints in place
+ * -- no symbolic expression is re-parsed per cycle.
+ *
+ * Example:
+ * @code
+ * ProgramTemplate prog;
+ * auto x = prog.NewContinuousVariables<2>("x");
+ * auto p = prog.NewParameters(2, "p");
+ * // Track the (parameterized) setpoint p.
+ * prog.AddParameterizedQuadraticCost((x(0) - p(0)) * (x(0) - p(0)) +
+ *                                    (x(1) - p(1)) * (x(1) - p(1)));
+ * prog.AddParameterizedLinearConstraint(x(0) + x(1), -p(0), p(0));
+ * for (...) {  // Per-cycle loop.
+ *   prog.SetParameterValues(p_value);
+ *   solver.Solve(prog, {}, {}, &result);
+ * }
+ * @endcode
+ *
+ * Parameters may enter the coefficients nonlinearly (e.g. cos(p(0)) * x(0)),
+ * but every expression must be affine -- or, for quadratic costs, quadratic
+ * -- in the decision variables. Until SetParameterValues() is called, all
+ * parameters evaluate to zero.
+ */
+class ProgramTemplate : public MathematicalProgram {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ProgramTemplate)
+
+  ProgramTemplate() = default;
+
+  ~ProgramTemplate() override {}
+
+  /** Creates @p rows new parameters named `name(0)`, ... The returned
+   * variables are placeholders for per-cycle numeric data; they are not
+   * decision variables and must only appear in the parameterized costs and
+   * constraints below. Their values are initially zero. */
+  VectorX<symbolic::Variable> NewParameters(int rows,
+                                            const std::string& name = "p");
+
+  /** Adds the linear cost @p e, whose coefficients may depend on the
+   * parameters.
+   * @throws std::runtime_error if @p e is not affine in the decision
+   * variables. */
+  Binding<LinearCost> AddParameterizedLinearCost(const symbolic::Expression& e);
+
+  /** Adds the quadratic cost @p e, whose coefficients may depend on the
+   * parameters.
+   * @throws std::runtime_error if @p e is not quadratic in the decision
+   * variables. */
+  Binding<QuadraticCost> AddParameterizedQuadraticCost(
+      const symbolic::Expression& e);
+
+  /** Adds the constraint `lb <= e <= ub`, where the coefficients of @p e and
+   * the bounds may depend on the parameters.
+   * @throws std::runtime_error if @p e is not affine in the decision
+   * variables, or if a bound contains a decision variable. */
+  Binding<LinearConstraint> AddParameterizedLinearConstraint(
+      const symbolic::Expression& e, const symbolic::Expression& lb,
+      const symbolic::Expression& ub);
+
+  /** Rebinds the parameters to @p values (ordered as the parameters were
+   * created) and refreshes every parameterized cost and constraint in place.
+   * @throws std::runtime_error if @p values does not have num_parameters()
+   * rows. */
+  void SetParameterValues(const Eigen::Ref<const Eigen::VectorXd>& values);
+
+  int num_parameters() const { return static_cast<int>(parameters_.size()); }
+
+ private:
+  // The compiled update lists: each entry pairs a binding with the
+  // parameter-only coefficient expressions that refresh it.
+  struct LinearCostUpdate {
+    Binding<LinearCost> binding;
+    VectorX<symbolic::Expression> a;
+    symbolic::Expression b;
+  };
+  struct QuadraticCostUpdate {
+    Binding<QuadraticCost> binding;
+    MatrixX<symbolic::Expression> Q;
+    VectorX<symbolic::Expression> b;
+    symbolic::Expression c;
+  };
+  struct LinearConstraintUpdate {
+    Binding<LinearConstraint> binding;
+    VectorX<symbolic::Expression> a;
+    symbolic::Expression lb;
+    symbolic::Expression ub;
+  };
+
+  // Splits the variables of `e` into the decision variables it binds
+  // (returned) and parameters; throws if `e` contains an unknown variable.
+  VectorXDecisionVariable ExtractBoundVariables(
+      const symbolic::Expression& e) const;
+
+  // Throws unless `e` depends only on the parameters.
+  void ThrowIfNotParameterOnly(const symbolic::Expression& e,
+                               const char* source) const;
+
+  std::vector<symbolic::Variable> parameters_;
+  symbolic::Variables parameter_set_;
+  symbolic::Environment environment_;
+  std::vector<LinearCostUpdate> linear_cost_updates_;
+  std::vector<QuadraticCostUpdate> quadratic_cost_updates_;
+  std::vector<LinearConstraintUpdate> linear_constraint_updates_;
+};
+
+}  // namespace solvers
+}  // namespace drake
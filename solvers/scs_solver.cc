@@ -1,5 +1,10 @@
 #include "drake/solvers/scs_solver.h"
 
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <Eigen/Sparse>
 #include <fmt/format.h>
 
@@ -567,42 +572,45 @@ void SetScsSettings(
     throw std::invalid_argument("Unsupported SCS solver options.");
   }
 }
-}  // namespace
 
-void ScsSolver::Solve(const MathematicalProgram& prog,
-                      const optional<Eigen::VectorXd>& initial_guess,
-                      const optional<SolverOptions>& solver_options,
-                      MathematicalProgramResult* result) const {
-  *result = {};
-  // TODO(hongkai.dai): allow warm starting SCS with initial guess on
-  // primal/dual variables and primal residues.
-  unused(initial_guess);
-  if (!AreProgramAttributesSatisfied(prog)) {
-    throw std::invalid_argument(
-        "SCS doesn't have the capability required by the program.");
-  }
-  // The initial guess for SCS is unused.
-  // SCS solves the problem in this form
-  // min  cᵀx
-  // s.t A x + s = b
-  //     s in K
-  // where K is a Cartesian product of some primitive cones.
-  // The cones have to be in this order
-  // Zero cone {x | x = 0 }
-  // Positive orthant {x | x ≥ 0 }
-  // Second-order cone {(t, x) | |x|₂ ≤ t }
-  // Positive semidefinite cone { X | min(eig(X)) ≥ 0, X = Xᵀ }
-  // There are more types that are supported by SCS, after the Positive
-  // semidefinite cone. Please refer to https://github.com/cvxgrp/scs for more
-  // details on the cone types.
-  // Notice that due to the special problem form supported by SCS, we need to
-  // convert our generic constraints to SCS form. For example, a linear
-  // inequality constraint
-  //   A x ≤ b
-  // will be converted as
-  //   A x + s = b
-  //   s in positive orthant cone.
-  // by introducing the slack variable s.
+// Groups the outputs of converting a MathematicalProgram into the SCS cone
+// program form; see AssembleScsProgram() below.
+struct ScsProgramData {
+  // The cone K, allocated with scs_calloc.
+  ScsCone* cone{nullptr};
+  // The problem data (A, b, c and settings), allocated with scs_calloc.
+  ScsData* data{nullptr};
+  // The number of rows in A.
+  int A_row_count{0};
+  // The number of variables x, including appended slack variables.
+  int num_x{0};
+  // The aggregated constant term of the costs, which SCS does not see.
+  double cost_constant{0};
+};
+
+// Converts `prog` into the problem form solved by SCS,
+// min  cᵀx
+// s.t A x + s = b
+//     s in K
+// where K is a Cartesian product of some primitive cones.
+// The cones have to be in this order
+// Zero cone {x | x = 0 }
+// Positive orthant {x | x ≥ 0 }
+// Second-order cone {(t, x) | |x|₂ ≤ t }
+// Positive semidefinite cone { X | min(eig(X)) ≥ 0, X = Xᵀ }
+// There are more types that are supported by SCS, after the Positive
+// semidefinite cone. Please refer to https://github.com/cvxgrp/scs for more
+// details on the cone types.
+// Notice that due to the special problem form supported by SCS, we need to
+// convert our generic constraints to SCS form. For example, a linear
+// inequality constraint
+//   A x ≤ b
+// will be converted as
+//   A x + s = b
+//   s in positive orthant cone.
+// by introducing the slack variable s.
+ScsProgramData AssembleScsProgram(const MathematicalProgram& prog) {
+  ScsProgramData scs_program{};
 
   // num_x is the number of variables in `x`. It can contain more variables
   // than in prog. For some constraint/cost, we need to append slack variables
@@ -613,8 +621,8 @@ void ScsSolver::Solve(const MathematicalProgram& prog,
   //   min y
   //   s.t 2(y - bᵀz - d) ≥ zᵀQz     (1)
   // now the cost is a linear function of y, with a rotated Lorentz cone
-  // constraint(1). So we need to append the slack variable `y` to the variables
-  // in `prog`.
+  // constraint(1). So we need to append the slack variable `y` to the
+  // variables in `prog`.
   int num_x = prog.num_vars();
 
   // We need to construct a sparse matrix in Column Compressed Storage (CCS)
@@ -679,29 +687,44 @@ void ScsSolver::Solve(const MathematicalProgram& prog,
   ScsData* scs_problem_data =
       static_cast<ScsData*>(scs_calloc(1, sizeof(ScsData)));
   SetScsProblemData(A_row_count, num_x, A, b, c, scs_problem_data);
+
+  scs_program.cone = cone;
+  scs_program.data = scs_problem_data;
+  scs_program.A_row_count = A_row_count;
+  scs_program.num_x = num_x;
+  scs_program.cost_constant = cost_constant;
+  return scs_program;
+}
+
+// Applies the SCS options attached to the program and (if provided) the
+// explicitly supplied solver options to the SCS settings.
+void ApplyScsSettings(const MathematicalProgram& prog,
+                      const optional<SolverOptions>& solver_options,
+                      SCS_SETTINGS* scs_settings) {
   std::unordered_map<std::string, int> prog_solver_options_int =
-      prog.GetSolverOptionsInt(id());
+      prog.GetSolverOptionsInt(ScsSolver::id());
   std::unordered_map<std::string, double> prog_solver_options_double =
-      prog.GetSolverOptionsDouble(id());
-  SetScsSettings(&prog_solver_options_int, scs_problem_data->stgs);
-  SetScsSettings(&prog_solver_options_double, scs_problem_data->stgs);
+      prog.GetSolverOptionsDouble(ScsSolver::id());
+  SetScsSettings(&prog_solver_options_int, scs_settings);
+  SetScsSettings(&prog_solver_options_double, scs_settings);
   if (solver_options.has_value()) {
     std::unordered_map<std::string, int> input_solver_options_int =
-        solver_options->GetOptionsInt(id());
+        solver_options->GetOptionsInt(ScsSolver::id());
     std::unordered_map<std::string, double> input_solver_options_double =
-        solver_options->GetOptionsDouble(id());
-    SetScsSettings(&input_solver_options_int, scs_problem_data->stgs);
-    SetScsSettings(&input_solver_options_double, scs_problem_data->stgs);
+        solver_options->GetOptionsDouble(ScsSolver::id());
+    SetScsSettings(&input_solver_options_int, scs_settings);
+    SetScsSettings(&input_solver_options_double, scs_settings);
   }
+}
 
-  ScsInfo scs_info{0};
-
-  ScsSolution* scs_sol =
-      static_cast<ScsSolution*>(scs_calloc(1, sizeof(ScsSolution)));
-
-  ScsSolverDetails& solver_details =
-      result->SetSolverDetailsType<ScsSolverDetails>();
-  solver_details.scs_status = scs(scs_problem_data, cone, scs_sol, &scs_info);
+// Populates `result` from the SCS return status and solution.
+// @p solver_details must already live in @p result (through
+// SetSolverDetailsType()) with its scs_status field set.
+void SetResultFromScs(const MathematicalProgram& prog, const ScsInfo& scs_info,
+                      const ScsSolution& scs_sol, int A_row_count,
+                      double cost_constant, ScsSolverDetails* solver_details_in,
+                      MathematicalProgramResult* result) {
+  ScsSolverDetails& solver_details = *solver_details_in;
 
   solver_details.iter = scs_info.iter;
   solver_details.primal_objective = scs_info.pobj;
@@ -714,18 +737,18 @@ void ScsSolver::Solve(const MathematicalProgram& prog,
   solver_details.scs_solve_time = scs_info.solve_time;
 
   SolutionResult solution_result{SolutionResult::kUnknownError};
-  result->set_solver_id(id());
+  result->set_solver_id(ScsSolver::id());
   solver_details.y.resize(A_row_count);
   solver_details.s.resize(A_row_count);
   for (int i = 0; i < A_row_count; ++i) {
-    solver_details.y(i) = scs_sol->y[i];
-    solver_details.s(i) = scs_sol->s[i];
+    solver_details.y(i) = scs_sol.y[i];
+    solver_details.s(i) = scs_sol.s[i];
   }
   if (solver_details.scs_status == SCS_SOLVED ||
       solver_details.scs_status == SCS_SOLVED_INACCURATE) {
     solution_result = SolutionResult::kSolutionFound;
     result->set_x_val(
-        (Eigen::Map<VectorX<scs_float>>(scs_sol->x, prog.num_vars()))
+        (Eigen::Map<VectorX<scs_float>>(scs_sol.x, prog.num_vars()))
             .cast<double>());
     result->set_optimal_cost(scs_info.pobj + cost_constant);
   } else if (solver_details.scs_status == SCS_UNBOUNDED ||
@@ -744,9 +767,40 @@ void ScsSolver::Solve(const MathematicalProgram& prog,
   }
 
   result->set_solution_result(solution_result);
+}
+}  // namespace
+
+void ScsSolver::Solve(const MathematicalProgram& prog,
+                      const optional<Eigen::VectorXd>& initial_guess,
+                      const optional<SolverOptions>& solver_options,
+                      MathematicalProgramResult* result) const {
+  *result = {};
+  // TODO(hongkai.dai): allow warm starting SCS with initial guess on
+  // primal/dual variables and primal residues.
+  unused(initial_guess);
+  if (!AreProgramAttributesSatisfied(prog)) {
+    throw std::invalid_argument(
+        "SCS doesn't have the capability required by the program.");
+  }
+  // The initial guess for SCS is unused.
+  const ScsProgramData scs_program = AssembleScsProgram(prog);
+  ApplyScsSettings(prog, solver_options, scs_program.data->stgs);
+
+  ScsInfo scs_info{0};
+
+  ScsSolution* scs_sol =
+      static_cast<ScsSolution*>(scs_calloc(1, sizeof(ScsSolution)));
+
+  ScsSolverDetails& solver_details =
+      result->SetSolverDetailsType<ScsSolverDetails>();
+  solver_details.scs_status =
+      scs(scs_program.data, scs_program.cone, scs_sol, &scs_info);
+
+  SetResultFromScs(prog, scs_info, *scs_sol, scs_program.A_row_count,
+                   scs_program.cost_constant, &solver_details, result);
 
   // Free allocated memory
-  scs_free_data(scs_problem_data, cone);
+  scs_free_data(scs_program.data, scs_program.cone);
   scs_free_sol(scs_sol);
 }
 
@@ -757,5 +811,70 @@ SolutionResult ScsSolver::Solve(MathematicalProgram& prog) const {
   prog.SetSolverResult(solver_result);
   return result.get_solution_result();
 }
+
+class ScsSession::Impl {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Impl)
+
+  explicit Impl(const MathematicalProgram& prog) : prog_(prog) {
+    if (!ScsSolver::ProgramAttributesSatisfied(prog_)) {
+      throw std::invalid_argument(
+          "SCS doesn't have the capability required by the program.");
+    }
+    scs_program_ = AssembleScsProgram(prog_);
+    ApplyScsSettings(prog_, nullopt, scs_program_.data->stgs);
+    // The solution is allocated once and kept across solves; scs() writes
+    // (x, y, s) into it and, when warm_start is on, reads them back as the
+    // starting iterate of the next solve.
+    scs_sol_ = static_cast<ScsSolution*>(scs_calloc(1, sizeof(ScsSolution)));
+  }
+
+  ~Impl() {
+    scs_free_data(scs_program_.data, scs_program_.cone);
+    scs_free_sol(scs_sol_);
+  }
+
+  void Solve(MathematicalProgramResult* result) {
+    *result = {};
+    // Re-read only the linear cost coefficients; everything else in the
+    // assembled data is structural and unchanged by assumption. Note that the
+    // tail of `c` belonging to appended slack variables (e.g. from quadratic
+    // costs) is structural as well and left untouched.
+    std::vector<double> c(prog_.num_vars(), 0.0);
+    cost_constant_ = 0;
+    ParseLinearCost(prog_, &c, &cost_constant_);
+    for (int i = 0; i < prog_.num_vars(); ++i) {
+      scs_program_.data->c[i] = c[i];
+    }
+
+    scs_program_.data->stgs->warm_start = first_solve_ ? 0 : 1;
+
+    ScsInfo scs_info{0};
+    ScsSolverDetails& solver_details =
+        result->SetSolverDetailsType<ScsSolverDetails>();
+    solver_details.scs_status =
+        scs(scs_program_.data, scs_program_.cone, scs_sol_, &scs_info);
+    first_solve_ = false;
+
+    SetResultFromScs(prog_, scs_info, *scs_sol_, scs_program_.A_row_count,
+                     cost_constant_, &solver_details, result);
+  }
+
+ private:
+  const MathematicalProgram& prog_;
+  ScsProgramData scs_program_{};
+  ScsSolution* scs_sol_{nullptr};
+  double cost_constant_{0};
+  bool first_solve_{true};
+};
+
+ScsSession::ScsSession(const MathematicalProgram& prog)
+    : impl_(std::make_unique<Impl>(prog)) {}
+
+ScsSession::~ScsSession() = default;
+
+void ScsSession::Solve(MathematicalProgramResult* result) {
+  impl_->Solve(result);
+}
 }  // namespace solvers
 }  // namespace drake
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_deprecated.h"
 #include "drake/solvers/mathematical_program_solver_interface.h"
@@ -98,5 +100,41 @@ class ScsSolver : public MathematicalProgramSolverInterface {
   }
 };
 
+/** A persistent SCS session for solving a sequence of conic programs that
+ * share their constraints and differ only in their linear cost coefficients,
+ * such as the bilinear alternations arising in sum-of-squares
+ * region-of-attraction searches. The cone program data (the sparse constraint
+ * matrix A, right-hand side b, and cone structure) is assembled from the
+ * program once at construction. Each subsequent Solve() call re-reads only
+ * the linear cost coefficients from the program and warm starts SCS from the
+ * previous primal/dual solution (x, y, s), which typically needs far fewer
+ * iterations than a cold start.
+ *
+ * Between Solve() calls the program may only be modified by updating the
+ * coefficients of its existing linear costs (e.g. through
+ * LinearCost::UpdateCoefficients()); adding or removing costs, constraints,
+ * or decision variables requires constructing a new session.
+ */
+class ScsSession {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ScsSession)
+
+  /** Assembles the SCS cone program data from @p prog. The program reference
+   * is aliased and must outlive this session.
+   * @throws std::invalid_argument if SCS cannot handle @p prog. */
+  explicit ScsSession(const MathematicalProgram& prog);
+
+  ~ScsSession();
+
+  /** Re-reads the linear cost coefficients from the program supplied at
+   * construction and solves, warm starting from the previous solution when
+   * one exists. */
+  void Solve(MathematicalProgramResult* result);
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace solvers
 }  // namespace drake
@@ -8,6 +8,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -136,15 +137,89 @@ using Snopt = SnoptImpl<kIsSnopt76>;
 
 namespace drake {
 namespace solvers {
+
+// The SNOPT session that survives between Solve() calls on one solver
+// instance: the integer/real workspaces (initialized once with sninit and
+// released with snend in the destructor), the problem arrays (kept so that
+// repeated solves reuse their capacity instead of reallocating), and the
+// previous solution. When the next call solves the same program object with
+// unchanged dimensions, the solve warm starts from that solution's basis.
+// Note that skipping sninit on reuse means solver options from a previous
+// call persist until overwritten; Solve() re-applies the merged options on
+// every call.
+struct SnoptSolver::Workspace {
+  ~Workspace() {
+    if (initialized) {
+      Snopt::snend(iw.data(), iw.size(), rw.data(), rw.size());
+    }
+  }
+
+  // SNOPT integer and real workspaces. Once initialized they are kept alive
+  // (and only ever grown) until the solver is destroyed.
+  std::vector<int> iw = std::vector<int>(500);
+  std::vector<double> rw = std::vector<double>(500);
+  bool initialized{false};
+  // The print file the workspaces were initialized with; changing it forces
+  // re-initialization.
+  std::string print_file;
+
+  // Problem arrays, reused across solves.
+  std::vector<double> x, xlow, xupp, xmul;
+  std::vector<int> xstate;
+  std::vector<double> F, Flow, Fupp, Fmul;
+  std::vector<int> Fstate;
+  std::vector<double> A;
+  std::vector<int> iAfun, jAvar, iGfun, jGvar;
+
+  // The identity and dimensions of the previously solved program, plus its
+  // solution, used to decide whether the next call may warm start.
+  const MathematicalProgram* last_prog{nullptr};
+  int last_nx{-1};
+  int last_nF{-1};
+  int last_lenA{-1};
+  int last_lenG{-1};
+  std::vector<double> last_x, last_xmul, last_F, last_Fmul;
+  std::vector<int> last_xstate, last_Fstate;
+  bool has_solution{false};
+};
+
 namespace {
 
-// TODO(jwnimmer-tri) Add a reusable scope_guard to //common.
-// Make a scope exit guard -- an object that when destroyed runs `func`.
-auto MakeGuard(std::function<void()> func) {
-  // The shared_ptr deleter func is always invoked, even for nullptrs.
-  // http://en.cppreference.com/w/cpp/memory/shared_ptr/%7Eshared_ptr
-  return std::shared_ptr<void>(nullptr, [=](void*) { func(); });
-}
+// Per-binding decision-variable indices for every nonlinear cost and
+// constraint that snopt_userfun visits, compiled once per solve so that the
+// NLP iteration loop does pure integer indexing into the decision-variable
+// vector instead of hashing Variable ids on every evaluation.  Each entry
+// parallels the corresponding binding list of the program, in order.
+struct BindingVariableIndices {
+  explicit BindingVariableIndices(const MathematicalProgram& prog)
+      : quadratic_costs(Compile(prog, prog.quadratic_costs())),
+        generic_costs(Compile(prog, prog.generic_costs())),
+        generic_constraints(Compile(prog, prog.generic_constraints())),
+        lorentz_cone_constraints(
+            Compile(prog, prog.lorentz_cone_constraints())),
+        rotated_lorentz_cone_constraints(
+            Compile(prog, prog.rotated_lorentz_cone_constraints())),
+        linear_complementarity_constraints(
+            Compile(prog, prog.linear_complementarity_constraints())) {}
+
+  template <typename C>
+  static std::vector<std::vector<int>> Compile(
+      const MathematicalProgram& prog, const std::vector<Binding<C>>& list) {
+    std::vector<std::vector<int>> result;
+    result.reserve(list.size());
+    for (const auto& binding : list) {
+      result.push_back(prog.FindDecisionVariableIndices(binding.variables()));
+    }
+    return result;
+  }
+
+  std::vector<std::vector<int>> quadratic_costs;
+  std::vector<std::vector<int>> generic_costs;
+  std::vector<std::vector<int>> generic_constraints;
+  std::vector<std::vector<int>> lorentz_cone_constraints;
+  std::vector<std::vector<int>> rotated_lorentz_cone_constraints;
+  std::vector<std::vector<int>> linear_complementarity_constraints;
+};
 
 // This class is used for passing additional info to the snopt_userfun, which
 // evaluates the value and gradient of the cost and constraints. Apart from the
@@ -165,10 +240,15 @@ class SnoptUserFunInfo {
   // than the SnoptUserFuncInfo object.
   explicit SnoptUserFunInfo(const MathematicalProgram* prog)
       : this_pointer_as_int_array_(MakeThisAsInts()),
-        prog_(*prog) {}
+        prog_(*prog),
+        binding_variable_indices_(*prog) {}
 
   const MathematicalProgram& mathematical_program() const { return prog_; }
 
+  const BindingVariableIndices& binding_variable_indices() const {
+    return binding_variable_indices_;
+  }
+
   std::set<int>& nonlinear_cost_gradient_indices() {
     return nonlinear_cost_gradient_indices_;
   }
@@ -176,6 +256,14 @@ class SnoptUserFunInfo {
     return nonlinear_cost_gradient_indices_;
   }
 
+  // Scratch buffers reused across snopt_userfun invocations, so that the NLP
+  // function evaluations stop allocating once the buffers reach their final
+  // sizes during the first iteration.
+  Eigen::VectorXd& xvec_scratch() const { return xvec_scratch_; }
+  std::vector<double>& cost_gradients_scratch() const {
+    return cost_gradients_scratch_;
+  }
+
   int* iu() const {
     return const_cast<int*>(this_pointer_as_int_array_.data());
   }
@@ -218,28 +306,34 @@ class SnoptUserFunInfo {
 
   const std::array<int, kIntCount> this_pointer_as_int_array_;
   const MathematicalProgram& prog_;
+  const BindingVariableIndices binding_variable_indices_;
   std::set<int> nonlinear_cost_gradient_indices_;
+  mutable Eigen::VectorXd xvec_scratch_;
+  mutable std::vector<double> cost_gradients_scratch_;
 };
 
-// Storage that we pass in and out of SNOPT APIs.
+// Storage that we pass in and out of SNOPT APIs. The iw/rw vectors are
+// borrowed from the solver's Workspace so that their memory survives between
+// solves.
 class WorkspaceStorage {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(WorkspaceStorage)
 
-  explicit WorkspaceStorage(const SnoptUserFunInfo* user_info)
-      : user_info_(user_info) {
+  WorkspaceStorage(const SnoptUserFunInfo* user_info, std::vector<int>* iw,
+                   std::vector<double>* rw)
+      : iw_(iw), rw_(rw), user_info_(user_info) {
+    DRAKE_DEMAND(iw_ != nullptr);
+    DRAKE_DEMAND(rw_ != nullptr);
     DRAKE_DEMAND(user_info_ != nullptr);
-    iw_.resize(500);
-    rw_.resize(500);
   }
 
-  int* iw() { return iw_.data(); }
-  int leniw() const { return iw_.size(); }
-  void resize_iw(int size) { iw_.resize(size); }
+  int* iw() { return iw_->data(); }
+  int leniw() const { return iw_->size(); }
+  void resize_iw(int size) { iw_->resize(size); }
 
-  double* rw() { return rw_.data(); }
-  int lenrw() const { return rw_.size(); }
-  void resize_rw(int size) { rw_.resize(size); }
+  double* rw() { return rw_->data(); }
+  int lenrw() const { return rw_->size(); }
+  void resize_rw(int size) { rw_->resize(size); }
 
   int* iu() { return user_info_->iu(); }
   int leniu() const { return user_info_->leniu(); }
@@ -248,8 +342,8 @@ class WorkspaceStorage {
   int lenru() const { return 0; }
 
  private:
-  std::vector<int> iw_;
-  std::vector<double> rw_;
+  std::vector<int>* const iw_;
+  std::vector<double>* const rw_;
 
   const SnoptUserFunInfo* const user_info_;
 };
@@ -301,24 +395,29 @@ void EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
  * @param grad_index The starting index of the gradient of constraint_list(0)
  * in the optimization problem.
  * @param xvec the value of the decision variables.
+ * @param binding_var_indices The precompiled decision-variable indices of
+ * each binding in constraint_list, in the same order.
  */
 template <typename C>
 void EvaluateNonlinearConstraints(
-    const MathematicalProgram& prog,
     const std::vector<Binding<C>>& constraint_list, double F[], double G[],
-    size_t* constraint_index, size_t* grad_index, const Eigen::VectorXd& xvec) {
+    size_t* constraint_index, size_t* grad_index, const Eigen::VectorXd& xvec,
+    const std::vector<std::vector<int>>& binding_var_indices) {
+  DRAKE_ASSERT(binding_var_indices.size() == constraint_list.size());
   Eigen::VectorXd this_x;
+  AutoDiffVecXd ty;
+  size_t binding_count = 0;
   for (const auto& binding : constraint_list) {
     const auto& c = binding.evaluator();
     int num_constraints = SingleNonlinearConstraintSize(*c);
 
     const int num_variables = binding.GetNumElements();
+    const std::vector<int>& var_indices = binding_var_indices[binding_count++];
     this_x.resize(num_variables);
     for (int i = 0; i < num_variables; ++i) {
-      this_x(i) = xvec(prog.FindDecisionVariableIndex(binding.variables()(i)));
+      this_x(i) = xvec(var_indices[i]);
     }
 
-    AutoDiffVecXd ty;
     ty.resize(num_constraints);
     EvaluateSingleNonlinearConstraint(*c, this_x, &ty);
 
@@ -326,9 +425,20 @@ void EvaluateNonlinearConstraints(
       F[(*constraint_index)++] = ty(i).value();
     }
 
-    for (int i = 0; i < num_constraints; i++) {
-      for (int j = 0; j < num_variables; ++j) {
-        G[(*grad_index)++] = ty(i).derivatives()(j);
+    const optional<std::vector<std::pair<int, int>>>& gradient_sparsity =
+        c->gradient_sparsity_pattern();
+    if (gradient_sparsity) {
+      // Write only the declared nonzero gradient entries, in the same order
+      // as their structure was reported in
+      // UpdateConstraintBoundsAndGradients().
+      for (const auto& entry : *gradient_sparsity) {
+        G[(*grad_index)++] = ty(entry.first).derivatives()(entry.second);
+      }
+    } else {
+      for (int i = 0; i < num_constraints; i++) {
+        for (int j = 0; j < num_variables; ++j) {
+          G[(*grad_index)++] = ty(i).derivatives()(j);
+        }
       }
     }
   }
@@ -371,29 +481,29 @@ std::set<int> GetAllNonlinearCostNonzeroGradientIndices(
  */
 template <typename C>
 void EvaluateAndAddNonlinearCosts(
-    const MathematicalProgram& prog,
     const std::vector<Binding<C>>& nonlinear_costs, const Eigen::VectorXd& x,
+    const std::vector<std::vector<int>>& binding_var_indices,
     double* total_cost, std::vector<double>* nonlinear_cost_gradients) {
+  DRAKE_ASSERT(binding_var_indices.size() == nonlinear_costs.size());
+  Eigen::VectorXd this_x;
+  AutoDiffVecXd ty(1);
+  size_t binding_count = 0;
   for (const auto& binding : nonlinear_costs) {
     const auto& obj = binding.evaluator();
     const int num_variables = binding.GetNumElements();
 
-    Eigen::VectorXd this_x(num_variables);
-    // binding_var_indices[i] is the index of binding.variables()(i) in prog's
-    // decision variables.
-    std::vector<int> binding_var_indices(num_variables);
+    // var_indices[i] is the index of binding.variables()(i) in prog's
+    // decision variables, precompiled once per solve.
+    const std::vector<int>& var_indices = binding_var_indices[binding_count++];
+    this_x.resize(num_variables);
     for (int i = 0; i < num_variables; ++i) {
-      binding_var_indices[i] =
-          prog.FindDecisionVariableIndex(binding.variables()(i));
-      this_x(i) = x(binding_var_indices[i]);
+      this_x(i) = x(var_indices[i]);
     }
-    AutoDiffVecXd ty(1);
     obj->Eval(math::initializeAutoDiff(this_x), &ty);
 
     *total_cost += ty(0).value();
     for (int i = 0; i < num_variables; ++i) {
-      (*nonlinear_cost_gradients)[binding_var_indices[i]] +=
-          ty(0).derivatives()(i);
+      (*nonlinear_cost_gradients)[var_indices[i]] += ty(0).derivatives()(i);
     }
   }
 }
@@ -404,14 +514,20 @@ void EvaluateAndAddNonlinearCosts(
 // will store the nonzero gradient of the cost.
 void EvaluateAllNonlinearCosts(
     const MathematicalProgram& prog, const Eigen::VectorXd& xvec,
-    const std::set<int>& nonlinear_cost_gradient_indices, double F[],
-    double G[], size_t* grad_index) {
-  std::vector<double> cost_gradients(prog.num_vars(), 0);
+    const SnoptUserFunInfo& info, double F[],
+    double G[], size_t* grad_index, std::vector<double>* cost_gradients_in) {
+  const std::set<int>& nonlinear_cost_gradient_indices =
+      info.nonlinear_cost_gradient_indices();
+  const BindingVariableIndices& indices = info.binding_variable_indices();
+  std::vector<double>& cost_gradients = *cost_gradients_in;
+  cost_gradients.assign(prog.num_vars(), 0);
   // Quadratic costs.
-  EvaluateAndAddNonlinearCosts(prog, prog.quadratic_costs(), xvec, &(F[0]),
+  EvaluateAndAddNonlinearCosts(prog.quadratic_costs(), xvec,
+                               indices.quadratic_costs, &(F[0]),
                                &cost_gradients);
   // Generic costs.
-  EvaluateAndAddNonlinearCosts(prog, prog.generic_costs(), xvec, &(F[0]),
+  EvaluateAndAddNonlinearCosts(prog.generic_costs(), xvec,
+                               indices.generic_costs, &(F[0]),
                                &cost_gradients);
 
   for (const int cost_gradient_index : nonlinear_cost_gradient_indices) {
@@ -426,7 +542,8 @@ void snopt_userfun(int* Status, int* n, double x[], int* needF, int* neF,
   const SnoptUserFunInfo& info = SnoptUserFunInfo::GetFrom(iu, *leniu);
   const MathematicalProgram& current_problem = info.mathematical_program();
 
-  Eigen::VectorXd xvec(*n);
+  Eigen::VectorXd& xvec = info.xvec_scratch();
+  xvec.resize(*n);
   for (int i = 0; i < *n; i++) {
     xvec(i) = x[i];
   }
@@ -438,26 +555,28 @@ void snopt_userfun(int* Status, int* n, double x[], int* needF, int* neF,
 
   current_problem.EvalVisualizationCallbacks(xvec);
 
-  EvaluateAllNonlinearCosts(current_problem, xvec,
-                            info.nonlinear_cost_gradient_indices(), F, G,
-                            &grad_index);
+  EvaluateAllNonlinearCosts(current_problem, xvec, info, F, G,
+                            &grad_index, &info.cost_gradients_scratch());
 
+  const BindingVariableIndices& indices = info.binding_variable_indices();
   // The constraint index starts at 1 because the cost is the
   // first row.
   size_t constraint_index = 1;
   // The gradient_index also starts after the cost.
-  EvaluateNonlinearConstraints(current_problem,
-                               current_problem.generic_constraints(), F, G,
-                               &constraint_index, &grad_index, xvec);
-  EvaluateNonlinearConstraints(current_problem,
-                               current_problem.lorentz_cone_constraints(), F, G,
-                               &constraint_index, &grad_index, xvec);
+  EvaluateNonlinearConstraints(current_problem.generic_constraints(), F, G,
+                               &constraint_index, &grad_index, xvec,
+                               indices.generic_constraints);
+  EvaluateNonlinearConstraints(current_problem.lorentz_cone_constraints(), F, G,
+                               &constraint_index, &grad_index, xvec,
+                               indices.lorentz_cone_constraints);
   EvaluateNonlinearConstraints(
-      current_problem, current_problem.rotated_lorentz_cone_constraints(), F, G,
-      &constraint_index, &grad_index, xvec);
+      current_problem.rotated_lorentz_cone_constraints(), F, G,
+      &constraint_index, &grad_index, xvec,
+      indices.rotated_lorentz_cone_constraints);
   EvaluateNonlinearConstraints(
-      current_problem, current_problem.linear_complementarity_constraints(), F,
-      G, &constraint_index, &grad_index, xvec);
+      current_problem.linear_complementarity_constraints(), F,
+      G, &constraint_index, &grad_index, xvec,
+      indices.linear_complementarity_constraints);
 }
 
 /*
@@ -475,7 +594,12 @@ void UpdateNumNonlinearConstraintsAndGradients(
   for (auto const& binding : constraint_list) {
     auto const& c = binding.evaluator();
     int n = c->num_constraints();
-    *max_num_gradients += n * binding.GetNumElements();
+    if (c->gradient_sparsity_pattern()) {
+      *max_num_gradients +=
+          static_cast<int>(c->gradient_sparsity_pattern()->size());
+    } else {
+      *max_num_gradients += n * binding.GetNumElements();
+    }
     *num_nonlinear_constraints += n;
   }
 }
@@ -513,14 +637,27 @@ void UpdateConstraintBoundsAndGradients(
       (*Fupp)[constraint_index_i] = ub(i);
     }
 
-    for (int i = 0; i < n; i++) {
-      for (int j = 0; j < static_cast<int>(binding.GetNumElements()); ++j) {
+    const optional<std::vector<std::pair<int, int>>>& gradient_sparsity =
+        c->gradient_sparsity_pattern();
+    if (gradient_sparsity) {
+      // Only the declared nonzero gradient entries are reported to SNOPT.
+      for (const auto& entry : *gradient_sparsity) {
         // Fortran is 1-indexed.
-        (*iGfun)[*grad_index] = 1 + *constraint_index + i;  // row order
-        (*jGvar)[*grad_index] =
-            1 + prog.FindDecisionVariableIndex(binding.variables()(j));
+        (*iGfun)[*grad_index] = 1 + *constraint_index + entry.first;
+        (*jGvar)[*grad_index] = 1 + prog.FindDecisionVariableIndex(
+                                        binding.variables()(entry.second));
         (*grad_index)++;
       }
+    } else {
+      for (int i = 0; i < n; i++) {
+        for (int j = 0; j < static_cast<int>(binding.GetNumElements()); ++j) {
+          // Fortran is 1-indexed.
+          (*iGfun)[*grad_index] = 1 + *constraint_index + i;  // row order
+          (*jGvar)[*grad_index] =
+              1 + prog.FindDecisionVariableIndex(binding.variables()(j));
+          (*grad_index)++;
+        }
+      }
     }
 
     (*constraint_index) += n;
@@ -654,42 +791,45 @@ void SolveWithGivenOptions(
     const std::unordered_map<std::string, std::string>& snopt_options_string,
     const std::unordered_map<std::string, int>& snopt_options_int,
     const std::unordered_map<std::string, double>& snopt_options_double,
-    int* snopt_status, double* objective, EigenPtr<Eigen::VectorXd> x_val) {
+    SnoptSolver::Workspace* workspace, int* snopt_status, double* objective,
+    EigenPtr<Eigen::VectorXd> x_val) {
   DRAKE_ASSERT(x_val->rows() == prog.num_vars());
 
   SnoptUserFunInfo user_info(&prog);
-  WorkspaceStorage storage(&user_info);
+  WorkspaceStorage storage(&user_info, &workspace->iw, &workspace->rw);
 
   std::string print_file_name;
   const auto print_file_it = snopt_options_string.find("Print file");
   if (print_file_it != snopt_options_string.end()) {
     print_file_name = print_file_it->second;
   }
-  Snopt::sninit(
-      print_file_name.c_str(), print_file_name.length(), 0 /* no summary */,
-      storage.iw(), storage.leniw(),
-      storage.rw(), storage.lenrw());
-  auto guard = MakeGuard([&storage]() {
-      Snopt::snend(
-          storage.iw(), storage.leniw(),
-          storage.rw(), storage.lenrw());
-  });
+  // Initialize the SNOPT workspaces once; they stay alive until the solver
+  // is destroyed (or the print file changes), so repeated solves skip the
+  // setup cost.
+  if (workspace->initialized && workspace->print_file != print_file_name) {
+    Snopt::snend(storage.iw(), storage.leniw(), storage.rw(), storage.lenrw());
+    workspace->initialized = false;
+  }
+  if (!workspace->initialized) {
+    Snopt::sninit(
+        print_file_name.c_str(), print_file_name.length(), 0 /* no summary */,
+        storage.iw(), storage.leniw(),
+        storage.rw(), storage.lenrw());
+    workspace->initialized = true;
+    workspace->print_file = print_file_name;
+  }
 
   int nx = prog.num_vars();
-  std::vector<double> x(nx, 0.0);
-  std::vector<double> xlow(nx, -std::numeric_limits<double>::infinity());
-  std::vector<double> xupp(nx, std::numeric_limits<double>::infinity());
-  std::vector<double> xmul(nx, 0.0);
-  std::vector<int> xstate(nx, 0);
-
-  // Initialize the guess for x.
-  for (int i = 0; i < nx; ++i) {
-    if (!std::isnan(x_init(i))) {
-      x[i] = x_init(i);
-    } else {
-      x[i] = 0.0;
-    }
-  }
+  std::vector<double>& x = workspace->x;
+  std::vector<double>& xlow = workspace->xlow;
+  std::vector<double>& xupp = workspace->xupp;
+  std::vector<double>& xmul = workspace->xmul;
+  std::vector<int>& xstate = workspace->xstate;
+  x.assign(nx, 0.0);
+  xlow.assign(nx, -std::numeric_limits<double>::infinity());
+  xupp.assign(nx, std::numeric_limits<double>::infinity());
+  xmul.assign(nx, 0.0);
+  xstate.assign(nx, 0);
 
   // Set up the lower and upper bounds.
   for (auto const& binding : prog.bounding_box_constraints()) {
@@ -751,16 +891,23 @@ void SolveWithGivenOptions(
 
   // Update the bound of the constraint.
   int nF = 1 + num_nonlinear_constraints + num_linear_constraints;
-  std::vector<double> F(nF, 0.0);
-  std::vector<double> Flow(nF, -std::numeric_limits<double>::infinity());
-  std::vector<double> Fupp(nF, std::numeric_limits<double>::infinity());
-  std::vector<double> Fmul(nF, 0.0);
-  std::vector<int> Fstate(nF, 0);
+  std::vector<double>& F = workspace->F;
+  std::vector<double>& Flow = workspace->Flow;
+  std::vector<double>& Fupp = workspace->Fupp;
+  std::vector<double>& Fmul = workspace->Fmul;
+  std::vector<int>& Fstate = workspace->Fstate;
+  F.assign(nF, 0.0);
+  Flow.assign(nF, -std::numeric_limits<double>::infinity());
+  Fupp.assign(nF, std::numeric_limits<double>::infinity());
+  Fmul.assign(nF, 0.0);
+  Fstate.assign(nF, 0);
 
   // Set up the gradient sparsity pattern.
   int lenG = max_num_gradients;
-  std::vector<int> iGfun(lenG, 0);
-  std::vector<int> jGvar(lenG, 0);
+  std::vector<int>& iGfun = workspace->iGfun;
+  std::vector<int>& jGvar = workspace->jGvar;
+  iGfun.assign(lenG, 0);
+  jGvar.assign(lenG, 0);
   size_t grad_index = 0;
   for (const auto cost_gradient_index :
          user_info.nonlinear_cost_gradient_indices()) {
@@ -808,9 +955,12 @@ void SolveWithGivenOptions(
 
   int lenA = variable_to_linear_cost_coefficient.size() +
              linear_constraints_triplets.size();
-  std::vector<double> A(lenA, 0.0);
-  std::vector<int> iAfun(lenA, 0);
-  std::vector<int> jAvar(lenA, 0);
+  std::vector<double>& A = workspace->A;
+  std::vector<int>& iAfun = workspace->iAfun;
+  std::vector<int>& jAvar = workspace->jAvar;
+  A.assign(lenA, 0.0);
+  iAfun.assign(lenA, 0);
+  jAvar.assign(lenA, 0);
   size_t A_index = 0;
   for (const auto& it : variable_to_linear_cost_coefficient) {
     A[A_index] = it.second;
@@ -845,7 +995,30 @@ void SolveWithGivenOptions(
     // TODO(hongkai.dai): report the error in SnoptSolverDetails.
   }
 
-  int Cold = 0;
+  // Warm start from the previous solution's basis when this is a repeated
+  // solve of the same program object with unchanged dimensions. The initial
+  // guess still takes precedence for x; entries the guess leaves as NaN fall
+  // back to the previous solution (and then to zero).
+  const bool warm_start =
+      workspace->has_solution && workspace->last_prog == &prog &&
+      workspace->last_nx == nx && workspace->last_nF == nF &&
+      workspace->last_lenA == lenA && workspace->last_lenG == lenG;
+  if (warm_start) {
+    xstate = workspace->last_xstate;
+    xmul = workspace->last_xmul;
+    Fstate = workspace->last_Fstate;
+    Fmul = workspace->last_Fmul;
+    F = workspace->last_F;
+  }
+  for (int i = 0; i < nx; ++i) {
+    if (!std::isnan(x_init(i))) {
+      x[i] = x_init(i);
+    } else {
+      x[i] = warm_start ? workspace->last_x[i] : 0.0;
+    }
+  }
+
+  const int start = warm_start ? 2 /* Warm */ : 0 /* Cold */;
   double ObjAdd = linear_cost_constant_term;
   int ObjRow = 1;
   int nS = 0;
@@ -882,7 +1055,7 @@ void SolveWithGivenOptions(
   // Actual solve.
   const char problem_name[] = "drake_problem";
   Snopt::snkera(
-      Cold, problem_name, nF, nx, ObjAdd, ObjRow, snopt_userfun,
+      start, problem_name, nF, nx, ObjAdd, ObjRow, snopt_userfun,
       nullptr /* isnLog snLog */, nullptr /* isnLog2 snLog2 */,
       nullptr /* isqLog sqLog */, nullptr /* isnSTOP snSTOP */,
       iAfun.data(), jAvar.data(), lenA, A.data(),
@@ -900,6 +1073,20 @@ void SolveWithGivenOptions(
 
   *x_val = Eigen::Map<Eigen::VectorXd>(x.data(), nx);
   *objective = F[0];
+
+  // Remember the solution so a repeated solve of this program can warm start.
+  workspace->last_prog = &prog;
+  workspace->last_nx = nx;
+  workspace->last_nF = nF;
+  workspace->last_lenA = lenA;
+  workspace->last_lenG = lenG;
+  workspace->last_x = x;
+  workspace->last_xstate = xstate;
+  workspace->last_xmul = xmul;
+  workspace->last_F = F;
+  workspace->last_Fstate = Fstate;
+  workspace->last_Fmul = Fmul;
+  workspace->has_solution = true;
 }
 
 SolutionResult MapSnoptInfoToSolutionResult(int snopt_info) {
@@ -923,6 +1110,10 @@ SolutionResult MapSnoptInfoToSolutionResult(int snopt_info) {
 
 }  // namespace
 
+SnoptSolver::SnoptSolver() = default;
+
+SnoptSolver::~SnoptSolver() = default;
+
 bool SnoptSolver::is_available() { return true; }
 
 void SnoptSolver::Solve(const MathematicalProgram& prog,
@@ -939,7 +1130,10 @@ void SnoptSolver::Solve(const MathematicalProgram& prog,
       solver_options ? *solver_options : SolverOptions();
   merged_options.Merge(prog.solver_options());
 
-  // Call SNOPT.
+  // Call SNOPT, reusing the session cached on this solver instance.
+  if (!workspace_) {
+    workspace_ = std::make_unique<Workspace>();
+  }
   int snopt_status{0};
   double objective{0};
   Eigen::VectorXd x_val(prog.num_vars());
@@ -948,7 +1142,7 @@ void SnoptSolver::Solve(const MathematicalProgram& prog,
       merged_options.GetOptionsStr(id()),
       merged_options.GetOptionsInt(id()),
       merged_options.GetOptionsDouble(id()),
-      &snopt_status, &objective, &x_val);
+      workspace_.get(), &snopt_status, &objective, &x_val);
 
   // Populate our results structure.
   result->set_solver_id(id());
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include "drake/common/drake_copyable.h"
@@ -8,12 +9,20 @@
 namespace drake {
 namespace solvers {
 
+/**
+ * A solver instance keeps the SNOPT workspaces alive between calls to
+ * Solve(). When the same solver object repeatedly solves the same program
+ * object with an unchanged structure (as in a receding-horizon loop that only
+ * updates bounds and the initial guess), the workspace memory is reused and
+ * the solve is warm started from the basis of the previous solution, instead
+ * of setting the problem up from scratch.
+ */
 class SnoptSolver : public MathematicalProgramSolverInterface  {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SnoptSolver)
 
-  SnoptSolver() = default;
-  ~SnoptSolver() override = default;
+  SnoptSolver();
+  ~SnoptSolver() override;
 
   // This solver is implemented in various pieces depending on if
   // SNOPT was available during compilation.
@@ -45,6 +54,13 @@ class SnoptSolver : public MathematicalProgramSolverInterface  {
 
   /// For some reason, SNOPT 7.4 fails to detect a simple LP being unbounded.
   static bool is_bounded_lp_broken();
+
+ private:
+  // The cached SNOPT session (workspaces, problem arrays, and the previous
+  // solution used for warm starting), reused across Solve() calls when the
+  // program structure is unchanged.
+  struct Workspace;
+  mutable std::unique_ptr<Workspace> workspace_;
 };
 
 }  // namespace solvers
@@ -602,6 +602,14 @@ void UpdateLinearConstraint(const MathematicalProgram& prog,
 }
 }  // anon namespace
 
+// The f2c interface keeps its state in globals, so this build flavor does
+// not cache a session between solves.
+struct SnoptSolver::Workspace {};
+
+SnoptSolver::SnoptSolver() = default;
+
+SnoptSolver::~SnoptSolver() = default;
+
 bool SnoptSolver::is_available() { return true; }
 
 void SnoptSolver::Solve(const MathematicalProgram& prog,
@@ -1,9 +1,19 @@
 #include "drake/solvers/solve.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "drake/solvers/choose_best_solver.h"
 #include "drake/solvers/mathematical_program_solver_interface.h"
+#include "drake/solvers/snopt_solver.h"
+#include "drake/solvers/solver_selection_history.h"
 
 namespace drake {
 namespace solvers {
@@ -14,7 +24,19 @@ MathematicalProgramResult Solve(const MathematicalProgram& prog,
   std::unique_ptr<MathematicalProgramSolverInterface> solver =
       MakeSolver(solver_id);
   MathematicalProgramResult result{};
-  solver->Solve(prog, initial_guess, solver_options, &result);
+  SolverSelectionHistory& history = SolverSelectionHistory::GetInstance();
+  if (history.recording_enabled()) {
+    const auto start = std::chrono::steady_clock::now();
+    solver->Solve(prog, initial_guess, solver_options, &result);
+    const std::chrono::duration<double> solve_time =
+        std::chrono::steady_clock::now() - start;
+    history.AddRecord(
+        prog.required_capabilities(), prog.num_vars(), solver_id,
+        solve_time.count(),
+        result.get_solution_result() == SolutionResult::kSolutionFound);
+  } else {
+    solver->Solve(prog, initial_guess, solver_options, &result);
+  }
   return result;
 }
 
@@ -28,5 +50,81 @@ MathematicalProgramResult Solve(
 MathematicalProgramResult Solve(const MathematicalProgram& prog) {
   return Solve(prog, {}, {});
 }
+
+std::vector<MathematicalProgramResult> SolveInParallel(
+    const MathematicalProgram& prog,
+    const std::vector<Eigen::VectorXd>& initial_guesses,
+    const optional<SolverOptions>& solver_options, int num_threads,
+    bool stop_at_first_success) {
+  DRAKE_DEMAND(num_threads >= 0);
+  const int num_guesses = static_cast<int>(initial_guesses.size());
+  const SolverId solver_id = ChooseBestSolver(prog);
+  int num_workers =
+      num_threads > 0
+          ? num_threads
+          : std::max<int>(1, std::thread::hardware_concurrency());
+  // The f2c flavor of SNOPT keeps global state, so its solves cannot overlap.
+  if (solver_id == SnoptSolver::id() && !SnoptSolver::is_thread_safe()) {
+    num_workers = 1;
+  }
+  num_workers = std::min(num_workers, num_guesses);
+
+  // Mark every entry as not attempted, so that abandoned guesses are
+  // distinguishable from solved ones.
+  std::vector<MathematicalProgramResult> results(num_guesses);
+  for (auto& result : results) {
+    result.set_solution_result(SolutionResult::kUnknownError);
+  }
+  std::atomic<int> next_guess{0};
+  std::atomic<bool> cancelled{false};
+  std::mutex exception_mutex;
+  std::exception_ptr first_exception{nullptr};
+
+  // Each worker owns a clone of the program and its own solver instance, and
+  // pulls guesses off a shared counter.
+  auto solve_guesses = [&]() {
+    try {
+      const std::unique_ptr<MathematicalProgram> local_prog = prog.Clone();
+      const std::unique_ptr<MathematicalProgramSolverInterface> solver =
+          MakeSolver(solver_id);
+      int i;
+      while ((i = next_guess++) < num_guesses) {
+        if (cancelled) {
+          break;
+        }
+        solver->Solve(*local_prog, initial_guesses[i], solver_options,
+                      &results[i]);
+        if (stop_at_first_success &&
+            results[i].get_solution_result() ==
+                SolutionResult::kSolutionFound) {
+          cancelled = true;
+        }
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> guard(exception_mutex);
+      if (first_exception == nullptr) {
+        first_exception = std::current_exception();
+      }
+      cancelled = true;
+    }
+  };
+
+  if (num_workers <= 1) {
+    solve_guesses();
+  } else {
+    std::vector<std::thread> workers;
+    workers.reserve(num_workers);
+    for (int i = 0; i < num_workers; ++i) {
+      workers.emplace_back(solve_guesses);
+    }
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+  }
+  if (first_exception != nullptr) {
+    std::rethrow_exception(first_exception);
+  }
+  return results;
+}
 }  // namespace solvers
 }  // namespace drake
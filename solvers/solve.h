@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "drake/solvers/mathematical_program.h"
 
 namespace drake {
@@ -28,5 +30,31 @@ MathematicalProgramResult Solve(
     const Eigen::Ref<const Eigen::VectorXd>& initial_guess);
 
 MathematicalProgramResult Solve(const MathematicalProgram& prog);
+
+/**
+ * Solves an optimization program from multiple initial guesses concurrently,
+ * as is commonly done to escape local minima of nonconvex programs. The best
+ * solver is chosen once (as in Solve()); each worker thread then clones the
+ * program and constructs its own solver instance, so no solver state is
+ * shared between threads. The i-th entry of the returned vector is the result
+ * of solving from @p initial_guesses[i].
+ * @param prog Contains the formulation of the program. It is not modified.
+ * @param initial_guesses One initial guess for the decision variables per
+ * solve.
+ * @param solver_options The options in addition to those stored in @p prog,
+ * applied to every solve.
+ * @param num_threads The number of worker threads. Pass 0 (the default) to
+ * use the hardware concurrency. If the chosen solver is not thread-safe, the
+ * guesses are solved serially regardless of this value.
+ * @param stop_at_first_success If true, the remaining initial guesses are
+ * abandoned as soon as one solve reports SolutionResult::kSolutionFound;
+ * the entries that were never attempted report
+ * SolutionResult::kUnknownError.
+ */
+std::vector<MathematicalProgramResult> SolveInParallel(
+    const MathematicalProgram& prog,
+    const std::vector<Eigen::VectorXd>& initial_guesses,
+    const optional<SolverOptions>& solver_options = {}, int num_threads = 0,
+    bool stop_at_first_success = false);
 }  // namespace solvers
 }  // namespace drake
@@ -0,0 +1,169 @@
+#include "drake/solvers/solver_selection_history.h"
+
+#include <fstream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "drake/common/never_destroyed.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+
+// Returns the size bucket for a program with num_vars decision variables,
+// i.e., floor(log2(num_vars)) with num_vars clamped to at least one.
+int SizeBucket(int num_vars) {
+  int bucket = 0;
+  while (num_vars > 1) {
+    num_vars >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+}  // namespace
+
+SolverSelectionHistory& SolverSelectionHistory::GetInstance() {
+  static never_destroyed<SolverSelectionHistory> instance;
+  return instance.access();
+}
+
+int SolverSelectionHistory::EncodeAttributes(
+    const ProgramAttributes& attributes) {
+  int mask = 0;
+  for (const ProgramAttribute attribute : attributes) {
+    mask |= 1 << static_cast<int>(attribute);
+  }
+  return mask;
+}
+
+void SolverSelectionHistory::set_recording_enabled(bool enabled) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  recording_enabled_ = enabled;
+}
+
+bool SolverSelectionHistory::recording_enabled() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return recording_enabled_;
+}
+
+void SolverSelectionHistory::AddRecord(const ProgramAttributes& attributes,
+                                       int num_vars, const SolverId& solver_id,
+                                       double solve_time, bool success) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  records_.push_back(SolverPerformanceRecord{
+      solver_id, EncodeAttributes(attributes), num_vars, solve_time, success});
+}
+
+optional<SolverId> SolverSelectionHistory::BestRecordedSolver(
+    const ProgramAttributes& attributes, int num_vars) const {
+  const int mask = EncodeAttributes(attributes);
+  const int bucket = SizeBucket(num_vars);
+
+  // Group the matching records by solver name (not by SolverId, since records
+  // loaded from a file carry freshly-constructed ids).
+  struct GroupStats {
+    const SolverId* solver_id{nullptr};
+    double total_time{0};
+    int num_success{0};
+    int num_failure{0};
+  };
+  std::map<std::string, GroupStats> groups;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const SolverPerformanceRecord& record : records_) {
+    if (record.attributes_mask != mask ||
+        SizeBucket(record.num_vars) != bucket) {
+      continue;
+    }
+    GroupStats& stats = groups[record.solver_id.name()];
+    stats.solver_id = &record.solver_id;
+    if (record.success) {
+      stats.total_time += record.solve_time;
+      ++stats.num_success;
+    } else {
+      ++stats.num_failure;
+    }
+  }
+
+  // Pick the solver with the smallest mean solve time, excluding any solver
+  // that ever failed on this group.
+  const SolverId* best{nullptr};
+  double best_mean_time = std::numeric_limits<double>::infinity();
+  for (const auto& name_and_stats : groups) {
+    const GroupStats& stats = name_and_stats.second;
+    if (stats.num_failure > 0 || stats.num_success == 0) {
+      continue;
+    }
+    const double mean_time = stats.total_time / stats.num_success;
+    if (mean_time < best_mean_time) {
+      best_mean_time = mean_time;
+      best = stats.solver_id;
+    }
+  }
+  if (best == nullptr) {
+    return nullopt;
+  }
+  return *best;
+}
+
+int SolverSelectionHistory::num_records() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return static_cast<int>(records_.size());
+}
+
+void SolverSelectionHistory::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  records_.clear();
+}
+
+void SolverSelectionHistory::LoadFromFile(const std::string& filename) {
+  std::ifstream file(filename);
+  if (!file.is_open()) {
+    throw std::runtime_error("SolverSelectionHistory: cannot open " + filename +
+                             " for reading.");
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream stream(line);
+    int attributes_mask{};
+    int num_vars{};
+    double solve_time{};
+    int success{};
+    std::string solver_name;
+    if (!(stream >> attributes_mask >> num_vars >> solve_time >> success) ||
+        !std::getline(stream >> std::ws, solver_name)) {
+      throw std::runtime_error(
+          "SolverSelectionHistory: cannot parse the line '" + line + "' in " +
+          filename + ".");
+    }
+    records_.push_back(SolverPerformanceRecord{SolverId(std::move(solver_name)),
+                                               attributes_mask, num_vars,
+                                               solve_time, success != 0});
+  }
+}
+
+void SolverSelectionHistory::SaveToFile(const std::string& filename) const {
+  std::ofstream file(filename);
+  if (!file.is_open()) {
+    throw std::runtime_error("SolverSelectionHistory: cannot open " + filename +
+                             " for writing.");
+  }
+  file << "# attributes_mask num_vars solve_time success solver_name\n";
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const SolverPerformanceRecord& record : records_) {
+    file << record.attributes_mask << " " << record.num_vars << " "
+         << record.solve_time << " " << (record.success ? 1 : 0) << " "
+         << record.solver_id.name() << "\n";
+  }
+}
+
+}  // namespace solvers
+}  // namespace drake
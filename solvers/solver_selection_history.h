@@ -0,0 +1,105 @@
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/drake_optional.h"
+#include "drake/solvers/program_attribute.h"
+#include "drake/solvers/solver_id.h"
+
+namespace drake {
+namespace solvers {
+
+/**
+ * One observation of a solver run, as stored in SolverSelectionHistory.
+ */
+struct SolverPerformanceRecord {
+  /** The solver that was run. */
+  SolverId solver_id;
+  /** The required capabilities of the program, encoded as a bitmask over
+   * ProgramAttribute (see SolverSelectionHistory::EncodeAttributes). */
+  int attributes_mask{};
+  /** The number of decision variables of the program. */
+  int num_vars{};
+  /** The wall-clock solve time, in seconds. */
+  double solve_time{};
+  /** Whether the solver reported SolutionResult::kSolutionFound. */
+  bool success{};
+};
+
+/**
+ * A process-wide history of solver performance, used by ChooseBestSolver() to
+ * pick the empirically fastest solver for a given class of programs instead of
+ * relying purely on the static precedence order. The best solver often varies
+ * with problem size even for a fixed set of program attributes, so records are
+ * grouped by (required capabilities, size bucket), where the size bucket is
+ * the base-2 logarithm of the number of decision variables.
+ *
+ * The history starts empty, in which case ChooseBestSolver() behaves exactly
+ * as before. It can be populated offline by BenchmarkSolversForSelectionHistory
+ * (and then persisted with SaveToFile() / LoadFromFile()), or online by
+ * calling set_recording_enabled(true), which makes Solve() record every solver
+ * run.
+ */
+class SolverSelectionHistory {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SolverSelectionHistory)
+
+  /** Returns the singleton history for this process. Thread-safe. */
+  static SolverSelectionHistory& GetInstance();
+
+  /** Encodes a set of program attributes as a bitmask, the grouping key used
+   * by the history. */
+  static int EncodeAttributes(const ProgramAttributes& attributes);
+
+  /** If true, Solve() records a SolverPerformanceRecord for every solver run.
+   * False by default. */
+  void set_recording_enabled(bool enabled);
+
+  bool recording_enabled() const;
+
+  /** Appends one observation to the history. */
+  void AddRecord(const ProgramAttributes& attributes, int num_vars,
+                 const SolverId& solver_id, double solve_time, bool success);
+
+  /**
+   * Returns the solver with the smallest mean solve time among the recorded
+   * solvers that (a) have at least one record matching @p attributes and the
+   * size bucket of @p num_vars, and (b) never failed on that group. Returns
+   * nullopt if no recorded solver qualifies, in which case the caller should
+   * fall back on the static precedence order.
+   */
+  optional<SolverId> BestRecordedSolver(const ProgramAttributes& attributes,
+                                        int num_vars) const;
+
+  int num_records() const;
+
+  /** Removes all records. */
+  void Clear();
+
+  /**
+   * Appends the records stored in @p filename (as written by SaveToFile()) to
+   * the history. Solvers are identified by name when loading, so a loaded
+   * history matches the solvers compiled into this process.
+   * @throws std::runtime_error if the file cannot be opened.
+   */
+  void LoadFromFile(const std::string& filename);
+
+  /**
+   * Writes all records to @p filename in a line-oriented text format.
+   * @throws std::runtime_error if the file cannot be opened.
+   */
+  void SaveToFile(const std::string& filename) const;
+
+ private:
+  SolverSelectionHistory() = default;
+
+  mutable std::mutex mutex_;
+  bool recording_enabled_{false};
+  std::vector<SolverPerformanceRecord> records_;
+};
+
+}  // namespace solvers
+}  // namespace drake
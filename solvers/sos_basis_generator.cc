@@ -1,5 +1,6 @@
 #include "drake/solvers/sos_basis_generator.h"
 
+#include <random>
 #include <vector>
 
 #include <Eigen/Core>
@@ -134,17 +135,17 @@ struct Hyperplanes {
  * polytope of the polynomial p (i.e., the convex hull of its exponents).
 */
 
-Hyperplanes RandomSupportingHyperplanes(const ExponentList& exponents_of_p) {
+Hyperplanes RandomSupportingHyperplanes(const ExponentList& exponents_of_p,
+                                        std::default_random_engine* generator) {
   Hyperplanes H;
 
 
   // get_random() samples uniformly between normal_vector_component_min/max.
   const int normal_vector_component_min  = 1;
   const int normal_vector_component_max  = 20;
-  std::default_random_engine generator;
   std::uniform_int_distribution<int> distribution(normal_vector_component_min,
                                                   normal_vector_component_max);
-  auto get_random = [&]() { return distribution(generator); };
+  auto get_random = [&]() { return distribution(*generator); };
 
 
   // Number of hyperplanes currently picked heuristically.
@@ -168,13 +169,57 @@ Hyperplanes RandomSupportingHyperplanes(const ExponentList& exponents_of_p) {
   return H;
 }
 
+/* Removes from candidates any exponent α for which 2α falls outside of a
+ * supporting hyperplane of the Newton polytope of p, i.e., outside of the
+ * convex hull of exponents_of_p. Each batch of hyperplanes is checked against
+ * all candidates with a single (integer) matrix product; fresh batches are
+ * drawn until one of them prunes nothing. Since every hyperplane bound is
+ * derived from the exponents of p, each batch is a sound (outer)
+ * approximation of the polytope, and more batches only tighten it.
+*/
+void PruneWithNewtonPolytope(const ExponentList& exponents_of_p,
+                             std::default_random_engine* generator,
+                             ExponentList* candidates) {
+  // Number of batches currently picked heuristically; pruning usually
+  // saturates after a few.
+  const int max_batches = 10;
+  for (int batch = 0; batch < max_batches; batch++) {
+    if (candidates->rows() == 0) {
+      return;
+    }
+    Hyperplanes hyperplanes =
+        RandomSupportingHyperplanes(exponents_of_p, generator);
+    // Since max_dot_product and min_dot_product are already halved, testing
+    // the candidate α against them is equivalent to testing 2α against the
+    // supporting hyperplanes themselves.
+    const Eigen::MatrixXi dot_products =
+        (*candidates) * hyperplanes.normal_vectors.transpose();
+    int index = 0;
+    for (int i = 0; i < candidates->rows(); i++) {
+      if ((dot_products.row(i).transpose().array() <=
+           hyperplanes.max_dot_product.array()).all() &&
+          (dot_products.row(i).transpose().array() >=
+           hyperplanes.min_dot_product.array()).all()) {
+        candidates->row(index++) = candidates->row(i);
+      }
+    }
+    const bool pruned = index < candidates->rows();
+    candidates->conservativeResize(index, Eigen::NoChange);
+    if (!pruned) {
+      return;
+    }
+  }
+}
+
 ExponentList ConstructMonomialBasis(const ExponentList& exponents_of_p) {
   Eigen::VectorXi lower_bounds = exponents_of_p.colwise().minCoeff() / 2;
   Eigen::VectorXi upper_bounds = exponents_of_p.colwise().maxCoeff() / 2;
 
-  // Note: RandomSupportingHyperplanes is actually deterministic due to
-  // its internal initialization of the random number seed.
-  Hyperplanes hyperplanes = RandomSupportingHyperplanes(exponents_of_p);
+  // Note: the procedure is actually deterministic, since the random number
+  // seed is initialized here.
+  std::default_random_engine generator;
+  Hyperplanes hyperplanes =
+      RandomSupportingHyperplanes(exponents_of_p, &generator);
 
   // We check the inequalities in two batches to allow for internal
   // infeasibility propagation inside of EnumerateIntegerSolutions,
@@ -190,6 +235,11 @@ ExponentList ConstructMonomialBasis(const ExponentList& exponents_of_p) {
       upper_bounds);
 
   Intersection(basis_exponents_1, &basis_exponents);
+  // Tighten the basis towards the true Newton polytope with additional
+  // batches of supporting hyperplanes. This is much cheaper than enumerating
+  // against more hyperplanes up front, since each batch is applied to the
+  // surviving candidates with one matrix product.
+  PruneWithNewtonPolytope(exponents_of_p, &generator, &basis_exponents);
   RemoveDiagonallyInconsistentExponents(exponents_of_p, &basis_exponents);
   return basis_exponents;
 }
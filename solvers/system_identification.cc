@@ -1,9 +1,17 @@
 #include "drake/solvers/system_identification.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <exception>
 #include <iostream>  // For LUMPED_SYSTEM_IDENTIFICATION_VERBOSE below.
 #include <list>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Cholesky>
 
 #include "drake/common/drake_assert.h"
 #include "drake/solvers/mathematical_program.h"
@@ -12,6 +20,187 @@ using std::pow;
 
 namespace drake {
 namespace solvers {
+namespace {
+
+// One monomial of an identification polynomial, compiled for fast numeric
+// evaluation: the coefficient, the active-variable part as (value-slot,
+// power) pairs, and the index of the parameter variable it multiplies
+// (or -1 for the constant/pure-active part). Compiling once up front avoids
+// re-walking the Polynomial structure and the per-datum maps for every
+// sample.
+template <typename T>
+struct CompiledMonomial {
+  T coefficient{};
+  std::vector<std::pair<int, int>> active_terms;
+  int parameter_index{-1};
+};
+
+// Tries to estimate the parameters by linear least squares over the data:
+// each datum contributes one row c + aᵀθ + err = 0 per polynomial, and the
+// minimizer of Σ err² solves the normal equations (Σ a aᵀ) θ = -Σ a c. The
+// accumulators are built over chunks of the data across threads and then
+// reduced, so the cost is one pass over the samples instead of a
+// MathematicalProgram with one error variable per sample.
+//
+// Returns false (leaving the outputs untouched) if the polynomials are not
+// affine in the parameters, or if some datum does not provide a value for
+// every active variable; the caller should then fall back on the generic
+// optimization-based path.
+template <typename T>
+bool TryEstimateParametersByNormalEquations(
+    const std::vector<::Polynomial<T>>& polys,
+    const std::vector<typename SystemIdentification<T>::PartialEvalType>&
+        active_var_values,
+    const std::vector<typename ::Polynomial<T>::VarType>& vars_to_estimate,
+    typename SystemIdentification<T>::PartialEvalType* estimates,
+    T* rms_error) {
+  typedef typename ::Polynomial<T>::VarType VarType;
+  const int num_to_estimate = static_cast<int>(vars_to_estimate.size());
+  const int num_data = static_cast<int>(active_var_values.size());
+  const int num_polys = static_cast<int>(polys.size());
+
+  std::map<VarType, int> parameter_slots;
+  for (int i = 0; i < num_to_estimate; ++i) {
+    parameter_slots[vars_to_estimate[i]] = i;
+  }
+
+  // Compile each polynomial, assigning every active variable a slot in the
+  // per-sample value vector.
+  std::map<VarType, int> active_slots;
+  std::vector<VarType> active_vars;
+  std::vector<std::vector<CompiledMonomial<T>>> compiled(num_polys);
+  for (int poly_num = 0; poly_num < num_polys; ++poly_num) {
+    for (const auto& monomial : polys[poly_num].GetMonomials()) {
+      CompiledMonomial<T> compiled_monomial;
+      compiled_monomial.coefficient = monomial.coefficient;
+      for (const auto& term : monomial.terms) {
+        const auto param_it = parameter_slots.find(term.var);
+        if (param_it != parameter_slots.end()) {
+          if (compiled_monomial.parameter_index >= 0 || term.power != 1) {
+            // More than one parameter, or a parameter power above one; the
+            // problem is not linear least squares.
+            return false;
+          }
+          compiled_monomial.parameter_index = param_it->second;
+        } else {
+          auto active_it = active_slots.find(term.var);
+          if (active_it == active_slots.end()) {
+            active_it =
+                active_slots.emplace(term.var,
+                                     static_cast<int>(active_vars.size()))
+                    .first;
+            active_vars.push_back(term.var);
+          }
+          compiled_monomial.active_terms.emplace_back(active_it->second,
+                                                      term.power);
+        }
+      }
+      compiled[poly_num].push_back(compiled_monomial);
+    }
+  }
+
+  // Per-thread accumulators for the normal equations: AtA = Σ a aᵀ,
+  // Atc = Σ a c, and the sum of squared constants.
+  Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> AtA =
+      Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>::Zero(num_to_estimate,
+                                                             num_to_estimate);
+  Eigen::Matrix<T, Eigen::Dynamic, 1> Atc =
+      Eigen::Matrix<T, Eigen::Dynamic, 1>::Zero(num_to_estimate);
+  T sum_c_squared{0};
+
+  const int chunk_size = 1024;
+  const int num_chunks = (num_data + chunk_size - 1) / chunk_size;
+  std::atomic<int> next_chunk{0};
+  std::atomic<bool> missing_value{false};
+  std::mutex reduce_mutex;
+
+  auto accumulate_chunks = [&]() {
+    Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> local_AtA =
+        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>::Zero(
+            num_to_estimate, num_to_estimate);
+    Eigen::Matrix<T, Eigen::Dynamic, 1> local_Atc =
+        Eigen::Matrix<T, Eigen::Dynamic, 1>::Zero(num_to_estimate);
+    T local_sum_c_squared{0};
+    std::vector<T> active_values(active_vars.size());
+    Eigen::Matrix<T, Eigen::Dynamic, 1> a(num_to_estimate);
+    while (!missing_value) {
+      const int chunk = next_chunk++;
+      if (chunk >= num_chunks) {
+        break;
+      }
+      const int datum_end =
+          std::min(num_data, (chunk + 1) * chunk_size);
+      for (int datum_num = chunk * chunk_size; datum_num < datum_end;
+           ++datum_num) {
+        const auto& partial_eval_map = active_var_values[datum_num];
+        for (int i = 0; i < static_cast<int>(active_vars.size()); ++i) {
+          const auto it = partial_eval_map.find(active_vars[i]);
+          if (it == partial_eval_map.end()) {
+            missing_value = true;
+            return;
+          }
+          active_values[i] = it->second;
+        }
+        for (int poly_num = 0; poly_num < num_polys; ++poly_num) {
+          a.setZero();
+          T c{0};
+          for (const auto& monomial : compiled[poly_num]) {
+            T value = monomial.coefficient;
+            for (const auto& slot_and_power : monomial.active_terms) {
+              value *= pow(active_values[slot_and_power.first],
+                           slot_and_power.second);
+            }
+            if (monomial.parameter_index >= 0) {
+              a(monomial.parameter_index) += value;
+            } else {
+              c += value;
+            }
+          }
+          local_AtA.template selfadjointView<Eigen::Lower>().rankUpdate(a);
+          local_Atc += a * c;
+          local_sum_c_squared += c * c;
+        }
+      }
+    }
+    std::lock_guard<std::mutex> lock(reduce_mutex);
+    AtA += local_AtA;
+    Atc += local_Atc;
+    sum_c_squared += local_sum_c_squared;
+  };
+
+  const int num_workers = std::min<int>(
+      num_chunks, std::max<int>(1, std::thread::hardware_concurrency()));
+  if (num_workers <= 1) {
+    accumulate_chunks();
+  } else {
+    std::vector<std::thread> workers;
+    for (int i = 0; i < num_workers; ++i) {
+      workers.emplace_back(accumulate_chunks);
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+  }
+  if (missing_value) {
+    return false;
+  }
+
+  // Only the lower triangle was accumulated.
+  AtA.template triangularView<Eigen::StrictlyUpper>() = AtA.transpose();
+
+  const Eigen::Matrix<T, Eigen::Dynamic, 1> theta = AtA.ldlt().solve(-Atc);
+  for (int i = 0; i < num_to_estimate; ++i) {
+    (*estimates)[vars_to_estimate[i]] = theta(i);
+  }
+  const int num_err_terms = num_data * num_polys;
+  const T error_squared = std::max<T>(
+      T{0},
+      sum_c_squared + 2 * theta.dot(Atc) + theta.dot(AtA * theta));
+  *rms_error = std::sqrt(error_squared / num_err_terms);
+  return true;
+}
+
+}  // namespace
 
 template <typename T>
 std::set<typename SystemIdentification<T>::MonomialType>
@@ -262,6 +451,20 @@ SystemIdentification<T>::EstimateParameters(
   // our solution will be meaningless.
   DRAKE_ASSERT(num_data >= num_to_estimate);
 
+  // Lumped polynomials are affine in the parameters, so in the common case
+  // the least-squares fit reduces to the normal equations, which we can
+  // accumulate in a single parallel pass over the data instead of building
+  // an optimization problem with one error variable per sample.
+  {
+    PartialEvalType estimates;
+    T rms_error{};
+    if (TryEstimateParametersByNormalEquations<T>(
+            polys_vec, active_var_values, vars_to_estimate, &estimates,
+            &rms_error)) {
+      return std::make_pair(estimates, rms_error);
+    }
+  }
+
   // Build up our optimization problem's decision variables.
   MathematicalProgram problem;
   VectorXDecisionVariable parameter_variables =
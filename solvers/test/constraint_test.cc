@@ -76,6 +76,51 @@ GTEST_TEST(testConstraint, testLinearConstraintUpdate) {
   EXPECT_TRUE(CompareMatrices(constraint.A(), A3));
   EXPECT_EQ(constraint.num_constraints(), 3);
 }
+GTEST_TEST(testConstraint, testEvalBatch) {
+  // The linear constraint overrides DoEvalBatch with a single matrix product;
+  // check that it matches the column-by-column evaluation.
+  Eigen::Matrix<double, 2, 3> A;
+  // clang-format off
+  A << 1, 2, 3,
+       4, 5, 6;
+  // clang-format on
+  LinearConstraint linear_constraint(A, Vector2d(-1, -2), Vector2d(1, 2));
+  Eigen::Matrix<double, 3, 4> x_batch;
+  // clang-format off
+  x_batch << 1, -2, 0.5, 3,
+             0,  1, 1.5, -1,
+             2, -1, 0.2, 0;
+  // clang-format on
+  MatrixXd y_batch;
+  linear_constraint.EvalBatch(x_batch, &y_batch);
+  EXPECT_EQ(y_batch.rows(), 2);
+  EXPECT_EQ(y_batch.cols(), 4);
+  for (int j = 0; j < x_batch.cols(); ++j) {
+    VectorXd y_j;
+    linear_constraint.Eval(x_batch.col(j), &y_j);
+    EXPECT_TRUE(CompareMatrices(y_batch.col(j), y_j, 1E-14));
+  }
+
+  // The Lorentz cone constraint relies on the default column-by-column
+  // fallback.
+  LorentzConeConstraint lorentz_cone_constraint(Eigen::Matrix3d::Identity(),
+                                                Eigen::Vector3d::Zero());
+  Eigen::Matrix<double, 3, 2> x_cone;
+  // clang-format off
+  x_cone << 3, 2,
+            1, 3,
+            1, 1;
+  // clang-format on
+  lorentz_cone_constraint.EvalBatch(x_cone, &y_batch);
+  EXPECT_EQ(y_batch.rows(), 2);
+  EXPECT_EQ(y_batch.cols(), 2);
+  for (int j = 0; j < x_cone.cols(); ++j) {
+    VectorXd y_j;
+    lorentz_cone_constraint.Eval(x_cone.col(j), &y_j);
+    EXPECT_TRUE(CompareMatrices(y_batch.col(j), y_j, 1E-14));
+  }
+}
+
 GTEST_TEST(testConstraint, testQuadraticConstraintHessian) {
   // Check if the getters in the QuadraticConstraint are right.
   Eigen::Matrix2d Q;
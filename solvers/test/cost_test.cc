@@ -194,6 +194,40 @@ GTEST_TEST(testCost, testQuadraticCost) {
   EXPECT_NEAR(y(0), obj_expected + c, tol);
 }
 
+GTEST_TEST(testCost, testEvalBatch) {
+  // Both LinearCost and QuadraticCost override DoEvalBatch to evaluate all
+  // the points with a single matrix product; check that the batch result
+  // matches the column-by-column evaluation.
+  Eigen::Matrix<double, 2, 5> x_batch;
+  // clang-format off
+  x_batch << 1, -2, 0.5, 3, 0,
+             0,  1, 1.5, -1, 2;
+  // clang-format on
+
+  LinearCost linear_cost(Eigen::Vector2d(1, 2), 3);
+  Eigen::MatrixXd y_batch;
+  linear_cost.EvalBatch(x_batch, &y_batch);
+  EXPECT_EQ(y_batch.rows(), 1);
+  EXPECT_EQ(y_batch.cols(), 5);
+  for (int j = 0; j < x_batch.cols(); ++j) {
+    VectorXd y_j;
+    linear_cost.Eval(x_batch.col(j), &y_j);
+    EXPECT_TRUE(CompareMatrices(y_batch.col(j), y_j, 1E-14));
+  }
+
+  Eigen::Matrix2d Q;
+  Q << 1, 2, 3, 4;
+  QuadraticCost quadratic_cost(Q, Eigen::Vector2d(5, 6), 7);
+  quadratic_cost.EvalBatch(x_batch, &y_batch);
+  EXPECT_EQ(y_batch.rows(), 1);
+  EXPECT_EQ(y_batch.cols(), 5);
+  for (int j = 0; j < x_batch.cols(); ++j) {
+    VectorXd y_j;
+    quadratic_cost.Eval(x_batch.col(j), &y_j);
+    EXPECT_TRUE(CompareMatrices(y_batch.col(j), y_j, 1E-13));
+  }
+}
+
 // TODO(eric.cousineau): Move QuadraticErrorCost and L2NormCost tests here from
 // MathematicalProgram.
 
@@ -358,6 +358,42 @@ GTEST_TEST(testEqualityConstrainedQPSolver, testLinearCost) {
   EXPECT_EQ(result.get_optimal_cost(), .5);
 }
 
+// min x'*x s.t. x0 + x1 = beq, re-solved repeatedly on one solver instance
+// as a controller would. The second solve changes only the right-hand sides
+// and hits the cached KKT factorization; the third changes the constraint
+// matrix and must invalidate it.
+GTEST_TEST(testEqualityConstrainedQPSolver, testRepeatedSolves) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>("x");
+  prog.AddQuadraticCost(x(0) * x(0) + x(1) * x(1));
+  auto constraint = prog.AddLinearEqualityConstraint(x(0) + x(1), 1);
+
+  EqualityConstrainedQPSolver solver;
+  const double tol = 1E-10;
+  MathematicalProgramResult result;
+  solver.Solve(prog, {}, {}, &result);
+  EXPECT_EQ(result.get_solution_result(), SolutionResult::kSolutionFound);
+  EXPECT_TRUE(CompareMatrices(prog.GetSolution(x, result),
+                              Eigen::Vector2d(0.5, 0.5), tol));
+
+  // Change only the constraint right-hand side; G and A are unchanged.
+  constraint.evaluator()->UpdateCoefficients(Eigen::RowVector2d(1, 1),
+                                             Vector1d(3));
+  solver.Solve(prog, {}, {}, &result);
+  EXPECT_EQ(result.get_solution_result(), SolutionResult::kSolutionFound);
+  EXPECT_TRUE(CompareMatrices(prog.GetSolution(x, result),
+                              Eigen::Vector2d(1.5, 1.5), tol));
+  EXPECT_NEAR(result.get_optimal_cost(), 4.5, tol);
+
+  // Change the constraint matrix itself.
+  constraint.evaluator()->UpdateCoefficients(Eigen::RowVector2d(1, -1),
+                                             Vector1d(1));
+  solver.Solve(prog, {}, {}, &result);
+  EXPECT_EQ(result.get_solution_result(), SolutionResult::kSolutionFound);
+  EXPECT_TRUE(CompareMatrices(prog.GetSolution(x, result),
+                              Eigen::Vector2d(0.5, -0.5), tol));
+}
+
 class EqualityConstrainedQPSolverTest : public ::testing::Test {
  public:
   EqualityConstrainedQPSolverTest()
@@ -4,6 +4,7 @@
 #include <limits>
 #include <memory>
 #include <stdexcept>
+#include <utility>
 
 #include <gtest/gtest.h>
 
@@ -166,6 +167,23 @@ GTEST_TEST(EvaluatorBaseTest, FunctionEvaluatorTest) {
   VerifyFunctionEvaluator(MakeFunctionWrapped(callable, 3, 3), x);
 }
 
+GTEST_TEST(EvaluatorBaseTest, GradientSparsityPattern) {
+  auto evaluator = MakeFunctionEvaluator(GenericTrivialFunctor());
+  // By default no sparsity pattern is declared, so the gradient is dense.
+  EXPECT_FALSE(evaluator->gradient_sparsity_pattern().has_value());
+
+  const std::vector<std::pair<int, int>> pattern{{0, 0}, {1, 2}, {2, 1}};
+  evaluator->SetGradientSparsityPattern(pattern);
+  ASSERT_TRUE(evaluator->gradient_sparsity_pattern().has_value());
+  EXPECT_EQ(evaluator->gradient_sparsity_pattern().value(), pattern);
+
+  // Out-of-range and repeated entries are rejected.
+  EXPECT_THROW(evaluator->SetGradientSparsityPattern({{3, 0}}), runtime_error);
+  EXPECT_THROW(evaluator->SetGradientSparsityPattern({{0, 3}}), runtime_error);
+  EXPECT_THROW(evaluator->SetGradientSparsityPattern({{0, 0}, {0, 0}}),
+               runtime_error);
+}
+
 }  // anonymous namespace
 }  // namespace solvers
 }  // namespace drake
@@ -690,6 +690,32 @@ void ExpectBadVar(MathematicalProgram* prog, int num_var, Args&&... args) {
 
 }  // namespace
 
+GTEST_TEST(testMathematicalProgram, AddConstraintsBulk) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<3>();
+
+  // A mixed batch: each binding must land in the same per-type container
+  // that one-at-a-time AddConstraint dispatch would have chosen.
+  std::vector<Binding<Constraint>> bindings;
+  bindings.push_back(internal::CreateBinding<Constraint>(
+      make_shared<LinearConstraint>(Eigen::RowVector3d(1, 2, 3), Vector1d(0),
+                                    Vector1d(1)),
+      x));
+  bindings.push_back(internal::CreateBinding<Constraint>(
+      make_shared<BoundingBoxConstraint>(Eigen::Vector3d::Zero(),
+                                         Eigen::Vector3d::Ones()),
+      x));
+  bindings.push_back(internal::CreateBinding<Constraint>(
+      make_shared<LinearEqualityConstraint>(Eigen::RowVector3d(1, 1, 1),
+                                            Vector1d(1)),
+      x));
+  prog.AddConstraints(bindings);
+
+  EXPECT_EQ(prog.linear_constraints().size(), 1u);
+  EXPECT_EQ(prog.bounding_box_constraints().size(), 1u);
+  EXPECT_EQ(prog.linear_equality_constraints().size(), 1u);
+}
+
 GTEST_TEST(testMathematicalProgram, testBadBindingVariable) {
   // Attempt to add a binding that does not have a valid decision variable.
   MathematicalProgram prog;
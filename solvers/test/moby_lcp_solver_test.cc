@@ -345,6 +345,52 @@ GTEST_TEST(testMobyLCP, testEmpty) {
   EXPECT_EQ(z.size(), 0);
 }
 
+GTEST_TEST(testMobyLCP, testLemkeWarmStart) {
+  // A positive definite LCP whose solution has every z variable basic.
+  Eigen::Matrix<double, 3, 3> M;
+  // clang-format off
+  M <<
+      2, 1, 0,
+      1, 2, 1,
+      0, 1, 2;
+  // clang-format on
+
+  Eigen::Vector3d q(-3, -4, -3);
+
+  MobyLCPSolver<double> l;
+  l.SetLoggingEnabled(verbose);
+
+  // Solve cold to get the first solution (and its basis).
+  Eigen::VectorXd z;
+  bool result = l.SolveLcpLemke(M, q, &z);
+  EXPECT_TRUE(result);
+  EXPECT_TRUE(CompareMatrices(z, Eigen::Vector3d(1, 1, 1), epsilon,
+                              MatrixCompareType::absolute));
+  EXPECT_GT(l.get_num_pivots(), 0);
+
+  // Perturb q slightly, as between consecutive time steps; the old basis is
+  // still complementary, so the warm-started solve succeeds without pivoting.
+  const Eigen::Vector3d q_perturbed(-3.1, -3.9, -3.05);
+  result = l.SolveLcpLemkeWarmStarted(M, q_perturbed, &z);
+  EXPECT_TRUE(result);
+  EXPECT_EQ(l.get_num_pivots(), 0);
+
+  // The warm-started solution matches a cold solve of the perturbed problem.
+  Eigen::VectorXd z_cold;
+  EXPECT_TRUE(l.SolveLcpLemke(M, q_perturbed, &z_cold));
+  EXPECT_TRUE(CompareMatrices(z, z_cold, epsilon,
+                              MatrixCompareType::absolute));
+
+  // A stale basis that no longer solves the problem still succeeds (pivoting
+  // onward from the old basis, or falling back on a cold start).
+  Eigen::Vector3d q_flipped(-3, 4, -3);
+  result = l.SolveLcpLemkeWarmStarted(M, q_flipped, &z);
+  EXPECT_TRUE(result);
+  EXPECT_TRUE(l.SolveLcpLemke(M, q_flipped, &z_cold));
+  EXPECT_TRUE(CompareMatrices(z, z_cold, epsilon,
+                              MatrixCompareType::absolute));
+}
+
 // Verifies that z is zero on LCP solver failure.
 GTEST_TEST(testMobyLCP, testFailure) {
   Eigen::MatrixXd neg_M(1, 1);
@@ -0,0 +1,114 @@
+#include "drake/solvers/presolve.h"
+
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+GTEST_TEST(PresolveTest, SingletonAndDuplicateRows) {
+  MathematicalProgram prog;
+  const auto x = prog.NewContinuousVariables<3>();
+  prog.AddLinearCost(Eigen::Vector3d(1, 1, 1), x);
+  // Two copies of the same row; the presolve merges them.
+  prog.AddLinearConstraint(Eigen::RowVector2d(1, 1), 0, 4, x.head<2>());
+  prog.AddLinearConstraint(Eigen::RowVector2d(1, 1), 0, 4, x.head<2>());
+  // A singleton row, converted to the bound x(0) <= 3.
+  prog.AddLinearConstraint(Vector1d(2), -kInf, 6, x.segment<1>(0));
+  // A singleton equality row, which fixes x(2).
+  prog.AddLinearEqualityConstraint(Vector1d(1), Vector1d(1), x.segment<1>(2));
+
+  const PresolvedProgram presolved(prog);
+  EXPECT_FALSE(presolved.is_infeasible());
+  // x(2) was fixed, leaving two variables, the single merged inequality row,
+  // and the bounding box holding the tightened bounds.
+  EXPECT_EQ(presolved.reduced_prog().num_vars(), 2);
+  ASSERT_EQ(presolved.reduced_prog().linear_constraints().size(), 1);
+  EXPECT_EQ(presolved.reduced_prog()
+                .linear_constraints()[0]
+                .evaluator()
+                ->num_constraints(),
+            1);
+  EXPECT_TRUE(presolved.reduced_prog().linear_equality_constraints().empty());
+  ASSERT_EQ(presolved.reduced_prog().bounding_box_constraints().size(), 1);
+  const auto& bbox =
+      *presolved.reduced_prog().bounding_box_constraints()[0].evaluator();
+  EXPECT_LE(bbox.upper_bound()(0), 3);
+
+  // Map a solution of the reduced program back to the original variables.
+  MathematicalProgramResult reduced_result;
+  reduced_result.set_solution_result(SolutionResult::kSolutionFound);
+  reduced_result.set_x_val(Eigen::Vector2d(1, 2));
+  const MathematicalProgramResult result =
+      presolved.MapSolutionBack(reduced_result);
+  EXPECT_TRUE(
+      CompareMatrices(result.get_x_val(), Eigen::Vector3d(1, 2, 1), 1E-12));
+}
+
+GTEST_TEST(PresolveTest, SolveEqualityConstrainedQP) {
+  // min 0.5(x₀² + x₁² + x₂²) + x₂ s.t. x₀ + x₁ = 1, x₂ = 3. The presolve
+  // fixes x₂ and the remaining program is an equality constrained QP, solved
+  // by a solver that is always available.
+  MathematicalProgram prog;
+  const auto x = prog.NewContinuousVariables<3>();
+  prog.AddQuadraticCost(Eigen::Matrix3d::Identity(),
+                        Eigen::Vector3d(0, 0, 1), x);
+  prog.AddLinearEqualityConstraint(Eigen::RowVector2d(1, 1), 1, x.head<2>());
+  prog.AddLinearEqualityConstraint(Vector1d(1), Vector1d(3), x.segment<1>(2));
+
+  const PresolvedProgram presolved(prog);
+  EXPECT_EQ(presolved.reduced_prog().num_vars(), 2);
+
+  const MathematicalProgramResult result = SolveWithPresolve(prog);
+  EXPECT_EQ(result.get_solution_result(), SolutionResult::kSolutionFound);
+  EXPECT_TRUE(CompareMatrices(result.get_x_val(),
+                              Eigen::Vector3d(0.5, 0.5, 3), 1E-8));
+  // 0.5 * (0.25 + 0.25 + 9) + 3 = 7.75.
+  EXPECT_NEAR(result.get_optimal_cost(), 7.75, 1E-8);
+}
+
+GTEST_TEST(PresolveTest, AllVariablesFixed) {
+  MathematicalProgram prog;
+  const auto x = prog.NewContinuousVariables<1>();
+  prog.AddLinearCost(Vector1d(3), 1, x);
+  prog.AddLinearEqualityConstraint(Vector1d(1), Vector1d(2), x);
+
+  const MathematicalProgramResult result = SolveWithPresolve(prog);
+  EXPECT_EQ(result.get_solution_result(), SolutionResult::kSolutionFound);
+  EXPECT_TRUE(CompareMatrices(result.get_x_val(), Vector1d(2), 1E-12));
+  EXPECT_NEAR(result.get_optimal_cost(), 7, 1E-12);
+}
+
+GTEST_TEST(PresolveTest, InfeasibleDetectedByPresolve) {
+  MathematicalProgram prog;
+  const auto x = prog.NewContinuousVariables<1>();
+  prog.AddLinearEqualityConstraint(Vector1d(1), Vector1d(1), x);
+  prog.AddLinearEqualityConstraint(Vector1d(1), Vector1d(2), x);
+
+  const PresolvedProgram presolved(prog);
+  EXPECT_TRUE(presolved.is_infeasible());
+  const MathematicalProgramResult result = SolveWithPresolve(prog);
+  EXPECT_EQ(result.get_solution_result(),
+            SolutionResult::kInfeasibleConstraints);
+}
+
+GTEST_TEST(PresolveTest, UnsupportedProgramPassesThrough) {
+  // A program with a Lorentz cone constraint is passed through unchanged.
+  MathematicalProgram prog;
+  const auto x = prog.NewContinuousVariables<3>();
+  prog.AddLorentzConeConstraint(Eigen::Matrix3d::Identity(),
+                                Eigen::Vector3d::Zero(), x);
+  prog.AddLinearEqualityConstraint(Vector1d(1), Vector1d(3), x.segment<1>(2));
+
+  const PresolvedProgram presolved(prog);
+  EXPECT_EQ(presolved.reduced_prog().num_vars(), 3);
+  EXPECT_EQ(presolved.reduced_prog().lorentz_cone_constraints().size(), 1);
+}
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
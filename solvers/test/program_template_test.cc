@@ -0,0 +1,118 @@
+#include "drake/solvers/program_template.h"
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/solvers/osqp_solver.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+
+using symbolic::Expression;
+using symbolic::Variable;
+
+const double kTol = 1E-14;
+
+// Adding a parameterized cost/constraint compiles it once; rebinding the
+// parameters must refresh the stored numeric coefficients exactly.
+GTEST_TEST(ProgramTemplateTest, CompiledCoefficients) {
+  ProgramTemplate prog;
+  auto x = prog.NewContinuousVariables<2>("x");
+  auto p = prog.NewParameters(2, "p");
+
+  auto linear_cost =
+      prog.AddParameterizedLinearCost(p(0) * x(0) + cos(p(1)) * x(1) + p(1));
+  auto quadratic_cost = prog.AddParameterizedQuadraticCost(
+      (x(0) - p(0)) * (x(0) - p(0)) + 2 * (x(1) - p(1)) * (x(1) - p(1)));
+  auto constraint = prog.AddParameterizedLinearConstraint(
+      p(1) * x(0) + x(1) + 1, -p(0), p(0));
+
+  // Until SetParameterValues() is called, the parameters are zero.
+  EXPECT_TRUE(CompareMatrices(linear_cost.evaluator()->a(),
+                              Eigen::Vector2d(0, 1), kTol));
+  EXPECT_EQ(linear_cost.evaluator()->b(), 0);
+
+  prog.SetParameterValues(Eigen::Vector2d(2, M_PI));
+  EXPECT_TRUE(CompareMatrices(linear_cost.evaluator()->a(),
+                              Eigen::Vector2d(2, -1), kTol));
+  EXPECT_NEAR(linear_cost.evaluator()->b(), M_PI, kTol);
+  // (x₀-p₀)² + 2(x₁-p₁)² = 0.5 x'[[2,0],[0,4]]x - (2p₀, 4p₁)'x + p₀² + 2p₁².
+  EXPECT_TRUE(CompareMatrices(quadratic_cost.evaluator()->Q(),
+                              (Eigen::Matrix2d() << 2, 0, 0, 4).finished(),
+                              kTol));
+  EXPECT_TRUE(CompareMatrices(quadratic_cost.evaluator()->b(),
+                              Eigen::Vector2d(-4, -4 * M_PI), kTol));
+  EXPECT_NEAR(quadratic_cost.evaluator()->c(), 4 + 2 * M_PI * M_PI, kTol);
+  // The constant +1 in the constraint expression is folded into the bounds.
+  EXPECT_TRUE(CompareMatrices(constraint.evaluator()->A(),
+                              (Eigen::RowVector2d() << M_PI, 1).finished(),
+                              kTol));
+  EXPECT_TRUE(CompareMatrices(constraint.evaluator()->lower_bound(),
+                              Vector1d(-3), kTol));
+  EXPECT_TRUE(CompareMatrices(constraint.evaluator()->upper_bound(),
+                              Vector1d(1), kTol));
+}
+
+// Exercises the intended per-cycle usage: rebind the parameters and re-solve
+// the same compiled program.
+GTEST_TEST(ProgramTemplateTest, RebindAndSolve) {
+  ProgramTemplate prog;
+  auto x = prog.NewContinuousVariables<2>("x");
+  auto p = prog.NewParameters(2, "p");
+  // min (x₀-p₀)² + (x₁-p₁)², s.t. x₀ + x₁ ≤ p₀.
+  prog.AddParameterizedQuadraticCost((x(0) - p(0)) * (x(0) - p(0)) +
+                                     (x(1) - p(1)) * (x(1) - p(1)));
+  prog.AddParameterizedLinearConstraint(x(0) + x(1), -Expression(100), p(0));
+
+  OsqpSolver solver;
+  if (!solver.available()) {
+    return;
+  }
+  const double tol = 1E-6;
+  MathematicalProgramResult result;
+
+  // The setpoint (2, 0) satisfies the constraint, so it is attained.
+  prog.SetParameterValues(Eigen::Vector2d(2, 0));
+  solver.Solve(prog, {}, {}, &result);
+  EXPECT_EQ(result.get_solution_result(), SolutionResult::kSolutionFound);
+  EXPECT_TRUE(CompareMatrices(result.get_x_val(), Eigen::Vector2d(2, 0), tol));
+
+  // The setpoint (1, 1) violates x₀ + x₁ ≤ 1; the solution is its projection
+  // onto the constraint boundary.
+  prog.SetParameterValues(Eigen::Vector2d(1, 1));
+  solver.Solve(prog, {}, {}, &result);
+  EXPECT_EQ(result.get_solution_result(), SolutionResult::kSolutionFound);
+  EXPECT_TRUE(
+      CompareMatrices(result.get_x_val(), Eigen::Vector2d(0.5, 0.5), tol));
+}
+
+GTEST_TEST(ProgramTemplateTest, Errors) {
+  ProgramTemplate prog;
+  auto x = prog.NewContinuousVariables<2>("x");
+  auto p = prog.NewParameters(1, "p");
+
+  // Not affine in the decision variables.
+  EXPECT_THROW(prog.AddParameterizedLinearCost(x(0) * x(1)),
+               std::runtime_error);
+  // Not quadratic in the decision variables.
+  EXPECT_THROW(prog.AddParameterizedQuadraticCost(x(0) * x(0) * x(1)),
+               std::runtime_error);
+  // A bound may not contain a decision variable.
+  EXPECT_THROW(prog.AddParameterizedLinearConstraint(x(0), Expression(x(1)),
+                                                     p(0)),
+               std::runtime_error);
+  // Variables that are neither decision variables nor parameters are
+  // rejected.
+  const Variable z("z");
+  EXPECT_THROW(prog.AddParameterizedLinearCost(z * x(0)), std::runtime_error);
+  // The parameter vector must have the right size.
+  EXPECT_THROW(prog.SetParameterValues(Eigen::Vector2d(1, 2)),
+               std::runtime_error);
+}
+
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
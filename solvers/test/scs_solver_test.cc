@@ -1,5 +1,7 @@
 #include "drake/solvers/scs_solver.h"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -270,6 +272,39 @@ GTEST_TEST(TestScs, SetOptions) {
   EXPECT_NE(result.get_solver_details().GetValue<ScsSolverDetails>().scs_status,
             solved_status);
 }
+
+GTEST_TEST(TestScs, Session) {
+  // Solve a sequence of programs that differ only in their linear cost
+  // through a persistent session, and cross check each solution against a
+  // fresh cold-started solve.
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>();
+  prog.AddLinearConstraint(x(0) + x(1) >= 1);
+  prog.AddBoundingBoxConstraint(0, 2, x);
+  auto cost = prog.AddLinearCost(Eigen::Vector2d(1, 2), 0, x);
+
+  ScsSolver solver;
+  if (solver.available()) {
+    const double tol{1E-5};
+    ScsSession session(prog);
+    MathematicalProgramResult session_result;
+    MathematicalProgramResult cold_result;
+    const std::vector<Eigen::Vector2d> cost_coeffs{
+        {1, 2}, {2, 1}, {-1, 1}, {1, -1}};
+    for (const auto& a : cost_coeffs) {
+      cost.evaluator()->UpdateCoefficients(a, 0);
+      session.Solve(&session_result);
+      solver.Solve(prog, {}, {}, &cold_result);
+      EXPECT_EQ(session_result.get_solution_result(),
+                cold_result.get_solution_result());
+      EXPECT_NEAR(session_result.get_optimal_cost(),
+                  cold_result.get_optimal_cost(), tol);
+      EXPECT_TRUE(CompareMatrices(session_result.get_x_val(),
+                                  cold_result.get_x_val(), tol,
+                                  MatrixCompareType::absolute));
+    }
+  }
+}
 }  // namespace test
 }  // namespace solvers
 }  // namespace drake
@@ -157,6 +157,33 @@ GTEST_TEST(SnoptTest, TestSparseCost) {
   EXPECT_NEAR(prog.GetOptimalCost(), -1, tol);
 }
 
+GTEST_TEST(SnoptTest, WorkspaceReuse) {
+  // Repeated solves of the same program object on one solver instance reuse
+  // the cached SNOPT session and warm start from the previous solution.
+  MathematicalProgram prog;
+  const auto x = prog.NewContinuousVariables<2>();
+  prog.AddQuadraticCost((x(0) - 1) * (x(0) - 1) + (x(1) - 2) * (x(1) - 2));
+  auto constraint = prog.AddLinearConstraint(x(0) + x(1) <= 10);
+
+  SnoptSolver solver;
+  const double tol{1E-6};
+  EXPECT_EQ(solver.Solve(prog), SolutionResult::kSolutionFound);
+  EXPECT_TRUE(
+      CompareMatrices(prog.GetSolution(x), Eigen::Vector2d(1, 2), tol));
+
+  // Tighten the bound; the second solve warm starts from (1, 2).
+  constraint.evaluator()->UpdateUpperBound(Vector1d(2));
+  EXPECT_EQ(solver.Solve(prog), SolutionResult::kSolutionFound);
+  EXPECT_TRUE(
+      CompareMatrices(prog.GetSolution(x), Eigen::Vector2d(0.5, 1.5), tol));
+
+  // Changing the structure falls back to a cold start.
+  prog.AddLinearConstraint(x(0) >= 0);
+  EXPECT_EQ(solver.Solve(prog), SolutionResult::kSolutionFound);
+  EXPECT_TRUE(
+      CompareMatrices(prog.GetSolution(x), Eigen::Vector2d(0.5, 1.5), tol));
+}
+
 GTEST_TEST(SnoptTest, DistanceToTetrahedron) {
   // This test fails in SNOPT 7.6 using C interface, but succeeds in SNOPT
   // 7.4.11 with f2c interface.
@@ -1,5 +1,7 @@
 #include "drake/solvers/solve.h"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -51,5 +53,41 @@ GTEST_TEST(SolveTest, TestInitialGuessAndOptions) {
   }
 }
 
+GTEST_TEST(SolveTest, SolveInParallelTest) {
+  // A convex QP, so every initial guess reaches the same minimizer. The
+  // point of the test is the bookkeeping, not escaping local minima.
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>();
+  prog.AddQuadraticCost(Eigen::Matrix2d::Identity(), Eigen::Vector2d(-2, -4),
+                        x);
+  prog.AddLinearEqualityConstraint(Eigen::RowVector2d(1, 1), 3, x);
+  const std::vector<Eigen::VectorXd> initial_guesses{
+      Eigen::Vector2d(0, 0), Eigen::Vector2d(10, -10), Eigen::Vector2d(1, 2)};
+
+  const std::vector<MathematicalProgramResult> results =
+      SolveInParallel(prog, initial_guesses, {}, 2);
+  ASSERT_EQ(results.size(), initial_guesses.size());
+  for (const auto& result : results) {
+    EXPECT_EQ(result.get_solution_result(), SolutionResult::kSolutionFound);
+    EXPECT_TRUE(
+        CompareMatrices(result.get_x_val(), Eigen::Vector2d(1, 2), 1E-8));
+  }
+
+  // With stop_at_first_success at least one guess succeeds; the abandoned
+  // ones report kUnknownError.
+  const std::vector<MathematicalProgramResult> first_success_results =
+      SolveInParallel(prog, initial_guesses, {}, 1,
+                      true /* stop_at_first_success */);
+  int num_solved = 0;
+  for (const auto& result : first_success_results) {
+    if (result.get_solution_result() == SolutionResult::kSolutionFound) {
+      ++num_solved;
+    } else {
+      EXPECT_EQ(result.get_solution_result(), SolutionResult::kUnknownError);
+    }
+  }
+  EXPECT_GE(num_solved, 1);
+}
+
 }  // namespace solvers
 }  // namespace drake
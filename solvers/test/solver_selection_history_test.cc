@@ -0,0 +1,111 @@
+#include "drake/solvers/solver_selection_history.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/solvers/choose_best_solver.h"
+#include "drake/solvers/equality_constrained_qp_solver.h"
+#include "drake/solvers/mathematical_program.h"
+
+namespace drake {
+namespace solvers {
+namespace test {
+namespace {
+
+GTEST_TEST(SolverSelectionHistoryTest, BestRecordedSolver) {
+  SolverSelectionHistory& history = SolverSelectionHistory::GetInstance();
+  history.Clear();
+
+  const ProgramAttributes attributes{ProgramAttribute::kQuadraticCost,
+                                     ProgramAttribute::kLinearEqualityConstraint};
+  // No records yet.
+  EXPECT_FALSE(history.BestRecordedSolver(attributes, 4).has_value());
+
+  // Solver A is faster on average, solver B always succeeds but is slower.
+  const SolverId solver_a("solver A");
+  const SolverId solver_b("solver B");
+  history.AddRecord(attributes, 4, solver_a, 0.1, true);
+  history.AddRecord(attributes, 5, solver_a, 0.2, true);
+  history.AddRecord(attributes, 4, solver_b, 0.5, true);
+  EXPECT_EQ(history.num_records(), 3);
+
+  // num_vars = 4 and 5 fall in the same size bucket; 100 does not.
+  auto best = history.BestRecordedSolver(attributes, 5);
+  ASSERT_TRUE(best.has_value());
+  EXPECT_EQ(best->name(), "solver A");
+  EXPECT_FALSE(history.BestRecordedSolver(attributes, 100).has_value());
+
+  // Different attributes do not match.
+  EXPECT_FALSE(
+      history.BestRecordedSolver({ProgramAttribute::kLinearCost}, 4)
+          .has_value());
+
+  // A failure disqualifies solver A, leaving solver B.
+  history.AddRecord(attributes, 6, solver_a, 0.1, false);
+  best = history.BestRecordedSolver(attributes, 4);
+  ASSERT_TRUE(best.has_value());
+  EXPECT_EQ(best->name(), "solver B");
+
+  history.Clear();
+  EXPECT_EQ(history.num_records(), 0);
+}
+
+GTEST_TEST(SolverSelectionHistoryTest, SaveAndLoad) {
+  SolverSelectionHistory& history = SolverSelectionHistory::GetInstance();
+  history.Clear();
+
+  const ProgramAttributes attributes{ProgramAttribute::kLinearCost,
+                                     ProgramAttribute::kLinearConstraint};
+  history.AddRecord(attributes, 10, SolverId("solver A"), 0.25, true);
+  history.AddRecord(attributes, 12, SolverId("solver B"), 0.125, true);
+
+  const std::string filename = temp_directory() + "/history.txt";
+  history.SaveToFile(filename);
+  history.Clear();
+  history.LoadFromFile(filename);
+  EXPECT_EQ(history.num_records(), 2);
+
+  // Loaded records are matched by name and keep their statistics.
+  const auto best = history.BestRecordedSolver(attributes, 10);
+  ASSERT_TRUE(best.has_value());
+  EXPECT_EQ(best->name(), "solver B");
+
+  history.Clear();
+}
+
+GTEST_TEST(SolverSelectionHistoryTest, BenchmarkAndChoose) {
+  SolverSelectionHistory& history = SolverSelectionHistory::GetInstance();
+  history.Clear();
+
+  // An equality constrained QP; the static precedence order picks
+  // EqualityConstrainedQPSolver.
+  MathematicalProgram prog;
+  const auto x = prog.NewContinuousVariables<2>();
+  prog.AddQuadraticCost(x(0) * x(0) + x(1) * x(1));
+  prog.AddLinearEqualityConstraint(x(0) + x(1), 1);
+  EXPECT_EQ(ChooseBestSolver(prog), EqualityConstrainedQPSolver::id());
+
+  // The benchmark runner records every capable solver, after which
+  // ChooseBestSolver() picks from the history; for this program the choice
+  // must still be a solver that can handle it.
+  BenchmarkSolversForSelectionHistory(prog, 2);
+  EXPECT_GT(history.num_records(), 0);
+  const SolverId chosen = ChooseBestSolver(prog);
+  const auto solver = MakeSolver(chosen);
+  EXPECT_TRUE(solver->available());
+  EXPECT_TRUE(solver->AreProgramAttributesSatisfied(prog));
+
+  // A record claiming an unavailable (unknown) solver is fastest falls back
+  // on the static precedence order.
+  history.Clear();
+  history.AddRecord(prog.required_capabilities(), prog.num_vars(),
+                    SolverId("nonexistent solver"), 1e-9, true);
+  EXPECT_EQ(ChooseBestSolver(prog), EqualityConstrainedQPSolver::id());
+
+  history.Clear();
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace solvers
+}  // namespace drake
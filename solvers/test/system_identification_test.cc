@@ -199,6 +199,38 @@ GTEST_TEST(SystemIdentificationTest, BasicEstimateParameters) {
   }
 }
 
+GTEST_TEST(SystemIdentificationTest, ManySampleEstimateParameters) {
+  // Estimation over a dataset spanning several work chunks, to exercise the
+  // parallel normal-equation accumulation path.
+  const Polynomiald x = Polynomiald("x");
+  const auto x_var = x.GetSimpleVariable();
+  const Polynomiald z = Polynomiald("z");
+  const auto z_var = z.GetSimpleVariable();
+  const Polynomiald a = Polynomiald("a");
+  const auto a_var = a.GetSimpleVariable();
+  const Polynomiald b = Polynomiald("b");
+  const auto b_var = b.GetSimpleVariable();
+
+  // Data generated from z = 2*x + 3, to be fit by (a*x) + b - z.
+  const Polynomiald poly = (a * x) + b - z;
+  const int num_samples = 5000;
+  std::vector<SID::PartialEvalType> sample_points;
+  for (int i = 0; i < num_samples; i++) {
+    const double x_value = 0.01 * i;
+    sample_points.push_back({{x_var, x_value}, {z_var, 2 * x_value + 3}});
+  }
+
+  SID::PartialEvalType estimated_params;
+  double error;
+  std::tie(estimated_params, error) =
+      SID::EstimateParameters(VectorXPoly::Constant(1, poly), sample_points);
+
+  EXPECT_LT(error, 1e-8);
+  EXPECT_EQ(estimated_params.size(), 2u);
+  EXPECT_NEAR(estimated_params[a_var], 2, 1e-8);
+  EXPECT_NEAR(estimated_params[b_var], 3, 1e-8);
+}
+
 /// Test to check parameter estimation for a basic spring-mass system.
 ///@{
 
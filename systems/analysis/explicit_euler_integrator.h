@@ -49,6 +49,25 @@ class ExplicitEulerIntegrator final : public IntegratorBase<T> {
   /// Integrator does not provide an error estimate.
   int get_error_estimate_order() const override { return 0; }
 
+  /**
+   * Advances time and state by exactly @p dt in a single step, bypassing the
+   * error-control branching, statistics bookkeeping, and dense output hook of
+   * the IntegratorBase stepping methods. Because this class is `final`, the
+   * step arithmetic resolves at compile time and inlines into the caller,
+   * giving the deterministic per-step cost needed by hard real-time loops.
+   * Statistics other than the derivative evaluation count are not updated.
+   * @pre Initialize() has been called and @p dt is non-negative (checked by
+   *      DRAKE_ASSERT only, to keep this path lean).
+   * @sa IntegratorBase::IntegrateWithSingleFixedStep(), the checked and
+   *     instrumented equivalent.
+   */
+  void IntegrateWithSingleMinimalStep(const T& dt) {
+    DRAKE_ASSERT(this->is_initialized());
+    DRAKE_ASSERT(dt >= 0);
+    const bool success = DoStep(dt);
+    DRAKE_DEMAND(success);
+  }
+
  private:
   bool DoStep(const T& dt) override;
 
@@ -2,8 +2,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <fstream>
 #include <limits>
+#include <memory>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -242,6 +245,51 @@ class HermitianDenseOutput final : public StepwiseDenseOutput<T> {
 
   HermitianDenseOutput() = default;
 
+  /// Starts streaming this dense output to disk.
+  ///
+  /// In streaming mode, @ref StepwiseDenseOutput::Consolidate
+  /// "consolidation" appends the cubic Hermite coefficients of each
+  /// interpolation segment to the binary file at @p file_path instead of
+  /// growing an in-memory trajectory, keeping only an index of segment
+  /// start times in memory (8 bytes per segment, against 32·n bytes of
+  /// on-disk coefficients for an n-dimensional state). Evaluation locates
+  /// the enclosing segment through an O(log n) binary search over that
+  /// index and reads its coefficients back from the file, so memory
+  /// footprint stays bounded over arbitrarily long runs and the file can
+  /// be queried post-hoc for as long as this output is kept alive.
+  ///
+  /// @note Copies of a streaming dense output share the underlying file
+  ///       and reader; they are intended for read-only use (e.g. queries
+  ///       from multiple call sites), not for concurrent updates.
+  ///
+  /// @param file_path Path of the binary file to stream to. The file is
+  ///                  created or truncated.
+  /// @throws std::logic_error if streaming was already started or if this
+  ///                          dense output is not empty (including steps
+  ///                          pending consolidation).
+  /// @throws std::runtime_error if the file at @p file_path cannot be
+  ///                            opened for writing.
+  void StartStreaming(const std::string& file_path) {
+    if (streaming_) {
+      throw std::logic_error("Streaming has already been started.");
+    }
+    if (!continuous_trajectory_.empty() || !raw_steps_.empty()) {
+      throw std::logic_error("Streaming must be started on an "
+                             "empty dense output.");
+    }
+    std::ofstream file(file_path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      throw std::runtime_error("Cannot open dense output streaming"
+                               " file: " + file_path);
+    }
+    streaming_file_path_ = file_path;
+    streaming_ = true;
+  }
+
+  /// Returns whether this dense output is streaming to disk.
+  /// @see StartStreaming()
+  bool is_streaming() const { return streaming_; }
+
   /// Update output with the given @p step.
   ///
   /// Provided @p step is queued for later consolidation. Note that
@@ -271,36 +319,94 @@ class HermitianDenseOutput final : public StepwiseDenseOutput<T> {
     if (raw_steps_.empty()) {
       throw std::logic_error("No updates to consolidate.");
     }
+    // Pool all queued steps into a single contiguous sample set, dropping
+    // each step's leading triplet when it duplicates the previous step's
+    // trailing one (C1 continuity across steps was validated on Update()),
+    // so that the underlying storage is extended just once.
+    std::vector<double> times{};
+    std::vector<MatrixX<double>> states{};
+    std::vector<MatrixX<double>> state_derivatives{};
+    size_t sample_count = 0;
+    for (const IntegrationStep& step : raw_steps_) {
+      sample_count += step.get_times().size();
+    }
+    times.reserve(sample_count);
+    states.reserve(sample_count);
+    state_derivatives.reserve(sample_count);
     for (const IntegrationStep& step : raw_steps_) {
+      const int first = times.empty() ? 0 : 1;
+      const std::vector<double> step_times =
+          detail::ExtractDoublesOrThrow(step.get_times());
+      const std::vector<MatrixX<double>> step_states =
+          detail::ExtractDoublesOrThrow(step.get_states());
+      const std::vector<MatrixX<double>> step_state_derivatives =
+          detail::ExtractDoublesOrThrow(step.get_state_derivatives());
+      times.insert(times.end(), step_times.begin() + first,
+                   step_times.end());
+      states.insert(states.end(), step_states.begin() + first,
+                    step_states.end());
+      state_derivatives.insert(state_derivatives.end(),
+                               step_state_derivatives.begin() + first,
+                               step_state_derivatives.end());
+    }
+    if (streaming_) {
+      StreamSegmentsToFile(times, states, state_derivatives);
+    } else {
       continuous_trajectory_.ConcatenateInTime(
           trajectories::PiecewisePolynomial<double>::Cubic(
-              detail::ExtractDoublesOrThrow(step.get_times()),
-              detail::ExtractDoublesOrThrow(step.get_states()),
-              detail::ExtractDoublesOrThrow(step.get_state_derivatives())));
+              times, states, state_derivatives));
+      start_time_ = continuous_trajectory_.start_time();
+      end_time_ = continuous_trajectory_.end_time();
     }
-    start_time_ = continuous_trajectory_.start_time();
-    end_time_ = continuous_trajectory_.end_time();
     last_consolidated_step_ = std::move(raw_steps_.back());
     raw_steps_.clear();
   }
 
  protected:
   VectorX<T> DoEvaluate(const T& t) const override {
+    const double time = ExtractDoubleOrThrow(t);
+    if (streaming_) {
+      const int segment_index = FindStreamedSegment(time);
+      const int record_size = 4 * streamed_state_size_;
+      coefficient_buffer_.resize(record_size);
+      ReadStreamedDoubles(
+          static_cast<std::streamoff>(segment_index) * record_size *
+              sizeof(double), record_size, coefficient_buffer_.data());
+      const double relative_time = time - segment_start_times_[segment_index];
+      VectorX<double> value(streamed_state_size_);
+      for (int i = 0; i < streamed_state_size_; ++i) {
+        value(i) = EvaluateStreamedCubic(
+            &coefficient_buffer_[4 * i], relative_time);
+      }
+      return value.cast<T>();
+    }
     const MatrixX<double> matrix_value =
-        continuous_trajectory_.value(ExtractDoubleOrThrow(t));
+        continuous_trajectory_.value(time);
     return matrix_value.col(0).cast<T>();
   }
 
   T DoEvaluateNth(const T& t, const int n) const override {
-    return continuous_trajectory_.scalarValue(
-        ExtractDoubleOrThrow(t), n, 0);
+    const double time = ExtractDoubleOrThrow(t);
+    if (streaming_) {
+      const int segment_index = FindStreamedSegment(time);
+      double coefficients[4];
+      ReadStreamedDoubles(
+          (static_cast<std::streamoff>(segment_index) *
+               4 * streamed_state_size_ + 4 * n) * sizeof(double),
+          4, coefficients);
+      return T{EvaluateStreamedCubic(
+          coefficients, time - segment_start_times_[segment_index])};
+    }
+    return continuous_trajectory_.scalarValue(time, n, 0);
   }
 
   bool do_is_empty() const override {
+    if (streaming_) return segment_start_times_.empty();
     return continuous_trajectory_.empty();
   }
 
   int do_size() const override {
+    if (streaming_) return streamed_state_size_;
     return continuous_trajectory_.rows();
   }
 
@@ -320,7 +426,7 @@ class HermitianDenseOutput final : public StepwiseDenseOutput<T> {
     }
     if (!raw_steps_.empty()) {
       EnsureOutputConsistencyOrThrow(step, raw_steps_.back());
-    } else if (!continuous_trajectory_.empty()) {
+    } else if (!this->is_empty()) {
       EnsureOutputConsistencyOrThrow(step, last_consolidated_step_);
     }
   }
@@ -372,6 +478,98 @@ class HermitianDenseOutput final : public StepwiseDenseOutput<T> {
     }
   }
 
+  // Appends the cubic Hermite coefficients for every interpolation segment
+  // spanned by the given pooled sample set to the streaming file, and
+  // updates the in-memory segment index accordingly.
+  // @pre Streaming was started (see StartStreaming()).
+  // @see Consolidate()
+  void StreamSegmentsToFile(
+      const std::vector<double>& times,
+      const std::vector<MatrixX<double>>& states,
+      const std::vector<MatrixX<double>>& state_derivatives) {
+    const int state_size = states.front().rows();
+    if (streamed_state_size_ == 0) streamed_state_size_ = state_size;
+    std::ofstream file(streaming_file_path_,
+                       std::ios::binary | std::ios::app);
+    if (!file) {
+      throw std::runtime_error("Cannot open dense output streaming"
+                               " file: " + streaming_file_path_);
+    }
+    // One record per segment: four coefficients per state dimension,
+    // ordered by dimension so that a single element can be read back
+    // contiguously (see DoEvaluateNth()).
+    std::vector<double> record(4 * state_size);
+    for (size_t k = 0; k + 1 < times.size(); ++k) {
+      const double interval = times[k + 1] - times[k];
+      for (int i = 0; i < state_size; ++i) {
+        const double x0 = states[k](i, 0);
+        const double x1 = states[k + 1](i, 0);
+        const double f0 = state_derivatives[k](i, 0);
+        const double f1 = state_derivatives[k + 1](i, 0);
+        record[4 * i] = x0;
+        record[4 * i + 1] = f0;
+        record[4 * i + 2] =
+            (3. * (x1 - x0) / interval - 2. * f0 - f1) / interval;
+        record[4 * i + 3] =
+            (2. * (x0 - x1) / interval + f0 + f1) / (interval * interval);
+      }
+      file.write(reinterpret_cast<const char*>(record.data()),
+                 record.size() * sizeof(double));
+      segment_start_times_.push_back(times[k]);
+    }
+    if (!file) {
+      throw std::runtime_error("Cannot write to dense output streaming"
+                               " file: " + streaming_file_path_);
+    }
+    file.close();
+    start_time_ = T{segment_start_times_.front()};
+    end_time_ = T{times.back()};
+    // Force the reader to reopen so that it sees the appended records.
+    streaming_file_reader_.reset();
+  }
+
+  // Returns the index of the streamed segment enclosing the given @p time,
+  // through a binary search over the in-memory segment index.
+  int FindStreamedSegment(double time) const {
+    const int segment_count = static_cast<int>(segment_start_times_.size());
+    const int segment_index = static_cast<int>(
+        std::upper_bound(segment_start_times_.begin(),
+                         segment_start_times_.end(), time) -
+        segment_start_times_.begin()) - 1;
+    return std::min(std::max(segment_index, 0), segment_count - 1);
+  }
+
+  // Reads @p count doubles at the given byte @p offset of the streaming
+  // file into @p destination, opening the reader on first use.
+  void ReadStreamedDoubles(std::streamoff offset, int count,
+                           double* destination) const {
+    if (!streaming_file_reader_) {
+      streaming_file_reader_ = std::make_shared<std::ifstream>(
+          streaming_file_path_, std::ios::binary);
+      if (!*streaming_file_reader_) {
+        throw std::runtime_error("Cannot open dense output streaming"
+                                 " file: " + streaming_file_path_);
+      }
+    }
+    streaming_file_reader_->clear();
+    streaming_file_reader_->seekg(offset);
+    streaming_file_reader_->read(reinterpret_cast<char*>(destination),
+                                 count * sizeof(double));
+    if (!*streaming_file_reader_) {
+      throw std::runtime_error("Cannot read from dense output streaming"
+                               " file: " + streaming_file_path_);
+    }
+  }
+
+  // Evaluates a cubic from its monomial @p coefficients (lowest order
+  // first) at the given @p relative_time past the segment start.
+  static double EvaluateStreamedCubic(const double* coefficients,
+                                      double relative_time) {
+    return coefficients[0] + relative_time * (
+        coefficients[1] + relative_time * (
+            coefficients[2] + relative_time * coefficients[3]));
+  }
+
   // TODO(hidmic): Remove redundant time-keeping member fields when
   // PiecewisePolynomial supports return by-reference of its time extents.
   // It currently returns them by-value, double type only, and thus the
@@ -395,8 +593,27 @@ class HermitianDenseOutput final : public StepwiseDenseOutput<T> {
   // doubles, pass in the template parameter T to it too and remove all scalar
   // type conversions.
 
-  // The underlying PiecewisePolynomial continuous trajectory.
+  // The underlying PiecewisePolynomial continuous trajectory. Unused when
+  // streaming to disk (see StartStreaming()).
   trajectories::PiecewisePolynomial<double> continuous_trajectory_{};
+
+  // Whether consolidated segments are streamed to disk instead of being
+  // held by `continuous_trajectory_`.
+  bool streaming_{false};
+  // Path of the binary file that consolidated segments are streamed to.
+  std::string streaming_file_path_{};
+  // The state size of the streamed segments, or zero before the first
+  // streaming consolidation.
+  int streamed_state_size_{0};
+  // Start times of the streamed segments, in increasing order; the
+  // in-memory index for the streaming file.
+  std::vector<double> segment_start_times_{};
+  // Lazily opened reader over the streaming file, shared across copies of
+  // this dense output.
+  mutable std::shared_ptr<std::ifstream> streaming_file_reader_{};
+  // Scratch space for segment coefficients read back from the streaming
+  // file.
+  mutable std::vector<double> coefficient_buffer_{};
 };
 
 }  // namespace systems
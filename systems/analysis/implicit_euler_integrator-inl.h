@@ -13,7 +13,9 @@
 #include <limits>
 #include <memory>
 #include <utility>
+#include <vector>
 
+#include "drake/common/drake_throw.h"
 #include "drake/common/text_logging.h"
 #include "drake/math/autodiff.h"
 
@@ -28,6 +30,7 @@ void ImplicitEulerIntegrator<T>::DoResetStatistics() {
     num_err_est_jacobian_function_evaluations_ = 0;
   num_jacobian_evaluations_ = num_err_est_jacobian_reforms_ = 0;
   num_iter_factorizations_ = num_err_est_iter_factorizations_ = 0;
+  num_iter_matrix_reuses_ = num_convergence_rate_refreshes_ = 0;
 }
 
 template <class T>
@@ -67,6 +70,62 @@ void ImplicitEulerIntegrator<T>::DoInitialize() {
   J_.resize(0, 0);
 }
 
+template <class T>
+void ImplicitEulerIntegrator<T>::set_jacobian_sparsity_pattern(
+    const MatrixX<bool>& pattern) {
+  DRAKE_THROW_UNLESS(pattern.rows() == pattern.cols());
+  sparsity_pattern_ = pattern;
+  nonzero_rows_.clear();
+  column_groups_.clear();
+  use_sparse_solve_ = false;
+
+  // Force Jacobian recomputation under the new pattern.
+  J_.resize(0, 0);
+
+  const int n = pattern.rows();
+  if (n == 0)
+    return;
+
+  // Record the structural nonzero rows of each column.
+  nonzero_rows_.resize(n);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < n; ++i)
+      if (pattern(i, j)) nonzero_rows_[j].push_back(i);
+  }
+
+  // Group the columns greedily: a column joins the first group in which no
+  // existing member has a structural nonzero in any of its rows (i.e., a
+  // greedy coloring of the column intersection graph, per [Curtis, 1974]).
+  // All columns in a group can then be perturbed simultaneously, with each
+  // column's entries recovered from its own rows of the difference quotient.
+  std::vector<std::vector<char>> group_occupied_rows;
+  for (int j = 0; j < n; ++j) {
+    bool placed = false;
+    for (size_t group = 0; group < column_groups_.size() && !placed; ++group) {
+      bool conflict = false;
+      for (int i : nonzero_rows_[j]) {
+        if (group_occupied_rows[group][i]) {
+          conflict = true;
+          break;
+        }
+      }
+      if (!conflict) {
+        column_groups_[group].push_back(j);
+        for (int i : nonzero_rows_[j]) group_occupied_rows[group][i] = 1;
+        placed = true;
+      }
+    }
+    if (!placed) {
+      column_groups_.emplace_back(1, j);
+      group_occupied_rows.emplace_back(n, 0);
+      for (int i : nonzero_rows_[j]) group_occupied_rows.back()[i] = 1;
+    }
+  }
+
+  SPDLOG_DEBUG(drake::log(), "  IE sparsity pattern declared: {} columns in "
+               "{} groups", n, column_groups_.size());
+}
+
 // Computes the Jacobian of the ordinary differential equations taken with
 // respect to the continuous state (at a point specified by @p state) using
 // automatic differentiation.
@@ -166,42 +225,69 @@ MatrixX<T> ImplicitEulerIntegrator<T>::ComputeForwardDiffJacobian(
   // Prevent compiler warnings for context.
   unused(context);
 
-  // Initialize the Jacobian.
-  MatrixX<T> J(n, n);
+  // Initialize the Jacobian. Zero initialization matters when a sparsity
+  // pattern has been declared, in which case only structural nonzeros are
+  // written below.
+  MatrixX<T> J = MatrixX<T>::Zero(n, n);
 
   // Evaluate f(t+h,xtplus) for the current state (current xtplus).
   VectorX<T> f = CalcTimeDerivativesUsingContext();
 
-  // Compute the Jacobian.
+  // With a declared sparsity pattern the columns have been collected into
+  // groups that may be perturbed simultaneously; otherwise each column is
+  // its own group.
+  const bool use_groups =
+      !column_groups_.empty() && sparsity_pattern_.rows() == n;
+  const int num_groups =
+      use_groups ? static_cast<int>(column_groups_.size()) : n;
+
+  // Compute the Jacobian, one derivative evaluation per column group.
   VectorX<T> xtplus_prime = xtplus;
-  for (int i = 0; i < n; ++i) {
-    // Compute a good increment to the dimension using approximately 1/eps
-    // digits of precision. Note that if |xtplus| is large, the increment will
-    // be large as well. If |xtplus| is small, the increment will be no smaller
-    // than eps.
-    const T abs_xi = abs(xtplus(i));
-    T dxi(abs_xi);
-    if (dxi <= 1) {
-      // When |xtplus[i]| is small, increment will be eps.
-      dxi = eps;
-    } else {
-      // |xtplus[i]| not small; make increment a fraction of |xtplus[i]|.
-      dxi = eps * abs_xi;
-    }
+  VectorX<T> dx(n);
+  for (int group = 0; group < num_groups; ++group) {
+    const int group_size =
+        use_groups ? static_cast<int>(column_groups_[group].size()) : 1;
+    for (int k = 0; k < group_size; ++k) {
+      const int i = use_groups ? column_groups_[group][k] : group;
+
+      // Compute a good increment to the dimension using approximately 1/eps
+      // digits of precision. Note that if |xtplus| is large, the increment
+      // will be large as well. If |xtplus| is small, the increment will be no
+      // smaller than eps.
+      const T abs_xi = abs(xtplus(i));
+      T dxi(abs_xi);
+      if (dxi <= 1) {
+        // When |xtplus[i]| is small, increment will be eps.
+        dxi = eps;
+      } else {
+        // |xtplus[i]| not small; make increment a fraction of |xtplus[i]|.
+        dxi = eps * abs_xi;
+      }
 
-    // Update xtplus', minimizing the effect of roundoff error by ensuring that
-    // x and dx differ by an exactly representable number. See p. 192 of
-    // Press, W., Teukolsky, S., Vetterling, W., and Flannery, P. Numerical
-    //   Recipes in C++, 2nd Ed., Cambridge University Press, 2002.
-    xtplus_prime(i) = xtplus(i) + dxi;
-    dxi = xtplus_prime(i) - xtplus(i);
+      // Update xtplus', minimizing the effect of roundoff error by ensuring
+      // that x and dx differ by an exactly representable number. See p. 192
+      // of Press, W., Teukolsky, S., Vetterling, W., and Flannery, P.
+      // Numerical Recipes in C++, 2nd Ed., Cambridge University Press, 2002.
+      xtplus_prime(i) = xtplus(i) + dxi;
+      dx(i) = xtplus_prime(i) - xtplus(i);
+    }
 
-    // Compute f' and set the relevant column of the Jacobian matrix.
+    // Compute f' and set the relevant column(s) of the Jacobian matrix.
     state->SetFromVector(xtplus_prime);
-    J.col(i) = (CalcTimeDerivativesUsingContext() - f) / dxi;
+    const VectorX<T> df = CalcTimeDerivativesUsingContext() - f;
+    for (int k = 0; k < group_size; ++k) {
+      const int i = use_groups ? column_groups_[group][k] : group;
+      if (use_groups) {
+        // Columns in a group have disjoint structural nonzero rows, so each
+        // row of df is attributable to exactly one column.
+        for (int row : nonzero_rows_[i]) J(row, i) = df(row) / dx(i);
+      } else {
+        J.col(i) = df / dx(i);
+      }
 
-    // Reset xtplus' to xtplus.
-    xtplus_prime(i) = xtplus(i);
+      // Reset xtplus' to xtplus.
+      xtplus_prime(i) = xtplus(i);
+    }
   }
 
   return J;
@@ -234,53 +320,89 @@ MatrixX<T> ImplicitEulerIntegrator<T>::ComputeCentralDiffJacobian(
   // Prevent compiler warnings for context.
   unused(context);
 
-  // Initialize the Jacobian.
-  MatrixX<T> J(n, n);
+  // Initialize the Jacobian. Zero initialization matters when a sparsity
+  // pattern has been declared, in which case only structural nonzeros are
+  // written below.
+  MatrixX<T> J = MatrixX<T>::Zero(n, n);
 
   // Get the current continuous state.
   const VectorX<T> xtplus = state->CopyToVector();
 
-  // Compute the Jacobian.
+  // With a declared sparsity pattern the columns have been collected into
+  // groups that may be perturbed simultaneously; otherwise each column is
+  // its own group.
+  const bool use_groups =
+      !column_groups_.empty() && sparsity_pattern_.rows() == n;
+  const int num_groups =
+      use_groups ? static_cast<int>(column_groups_.size()) : n;
+
+  // Compute the Jacobian, two derivative evaluations per column group.
   VectorX<T> xtplus_prime = xtplus;
-  for (int i = 0; i < n; ++i) {
-    // Compute a good increment to the dimension using approximately 1/eps
-    // digits of precision. Note that if |xtplus| is large, the increment will
-    // be large as well. If |xtplus| is small, the increment will be no smaller
-    // than eps.
-    const T abs_xi = abs(xtplus(i));
-    T dxi(abs_xi);
-    if (dxi <= 1) {
-      // When |xtplus[i]| is small, increment will be eps.
-      dxi = eps;
-    } else {
-      // |xtplus[i]| not small; make increment a fraction of |xtplus[i]|.
-      dxi = eps * abs_xi;
-    }
+  VectorX<T> dx(n);
+  for (int group = 0; group < num_groups; ++group) {
+    const int group_size =
+        use_groups ? static_cast<int>(column_groups_[group].size()) : 1;
+
+    // Perturb each column in the group in the positive direction.
+    for (int k = 0; k < group_size; ++k) {
+      const int i = use_groups ? column_groups_[group][k] : group;
+
+      // Compute a good increment to the dimension using approximately 1/eps
+      // digits of precision. Note that if |xtplus| is large, the increment
+      // will be large as well. If |xtplus| is small, the increment will be no
+      // smaller than eps.
+      const T abs_xi = abs(xtplus(i));
+      T dxi(abs_xi);
+      if (dxi <= 1) {
+        // When |xtplus[i]| is small, increment will be eps.
+        dxi = eps;
+      } else {
+        // |xtplus[i]| not small; make increment a fraction of |xtplus[i]|.
+        dxi = eps * abs_xi;
+      }
 
-    // Update xtplus', minimizing the effect of roundoff error, by ensuring that
-    // x and dx differ by an exactly representable number. See p. 192 of
-    // Press, W., Teukolsky, S., Vetterling, W., and Flannery, P. Numerical
-    //   Recipes in C++, 2nd Ed., Cambridge University Press, 2002.
-    xtplus_prime(i) = xtplus(i) + dxi;
-    const T dxi_plus = xtplus_prime(i) - xtplus(i);
+      // Update xtplus', minimizing the effect of roundoff error, by ensuring
+      // that x and dx differ by an exactly representable number. See p. 192
+      // of Press, W., Teukolsky, S., Vetterling, W., and Flannery, P.
+      // Numerical Recipes in C++, 2nd Ed., Cambridge University Press, 2002.
+      xtplus_prime(i) = xtplus(i) + dxi;
+      dx(i) = dxi;
+    }
 
     // Compute f(x+dx).
     state->SetFromVector(xtplus_prime);
     VectorX<T> fprime_plus = CalcTimeDerivativesUsingContext();
 
-    // Update xtplus' again, minimizing the effect of roundoff error.
-    xtplus_prime(i) = xtplus(i) - dxi;
-    const T dxi_minus = xtplus(i) - xtplus_prime(i);
+    // Perturb each column in the group in the negative direction. Note that
+    // the denominators below are computed the same way as in the ungrouped
+    // code: from the exactly representable perturbed values.
+    for (int k = 0; k < group_size; ++k) {
+      const int i = use_groups ? column_groups_[group][k] : group;
+      const T dxi_plus = xtplus_prime(i) - xtplus(i);
+      xtplus_prime(i) = xtplus(i) - dx(i);
+      const T dxi_minus = xtplus(i) - xtplus_prime(i);
+      dx(i) = dxi_plus + dxi_minus;
+    }
 
     // Compute f(x-dx).
     state->SetFromVector(xtplus_prime);
     VectorX<T> fprime_minus = CalcTimeDerivativesUsingContext();
 
-    // Set the Jacobian column.
-    J.col(i) = (fprime_plus - fprime_minus) / (dxi_plus + dxi_minus);
+    // Set the relevant column(s) of the Jacobian matrix.
+    for (int k = 0; k < group_size; ++k) {
+      const int i = use_groups ? column_groups_[group][k] : group;
+      if (use_groups) {
+        // Columns in a group have disjoint structural nonzero rows, so each
+        // row of the difference is attributable to exactly one column.
+        for (int row : nonzero_rows_[i])
+          J(row, i) = (fprime_plus(row) - fprime_minus(row)) / dx(i);
+      } else {
+        J.col(i) = (fprime_plus - fprime_minus) / dx(i);
+      }
 
-    // Reset xtplus' to xtplus.
-    xtplus_prime(i) = xtplus(i);
+      // Reset xtplus' to xtplus.
+      xtplus_prime(i) = xtplus(i);
+    }
   }
 
   return J;
@@ -288,10 +410,28 @@ MatrixX<T> ImplicitEulerIntegrator<T>::ComputeCentralDiffJacobian(
 
 // Factors a dense matrix (the negated iteration matrix) using LU factorization,
 // which should be faster than the QR factorization used in the specialized
-// template method immediately below.
+// template method immediately below. When a Jacobian sparsity pattern has
+// been declared, the factorization is instead routed through a sparse LU
+// decomposition with fill-reducing column ordering, which scales far better
+// than dense LU when the iteration matrix is, e.g., banded.
 template <class T>
 void ImplicitEulerIntegrator<T>::Factor(const MatrixX<T>& A) {
   num_iter_factorizations_++;
+  if (!column_groups_.empty() && sparsity_pattern_.rows() == A.rows()) {
+    // The iteration matrix inherits the Jacobian's structural nonzeros plus
+    // the identity's diagonal, all of which sparseView() retains (exact
+    // zeros within the pattern are harmless).
+    sparse_iteration_matrix_ = A.sparseView();
+    sparse_lu_.compute(sparse_iteration_matrix_);
+    if (sparse_lu_.info() == Eigen::Success) {
+      use_sparse_solve_ = true;
+      return;
+    }
+    // A numerically singular iteration matrix falls through to the dense
+    // factorization, which cannot fail to produce a (possibly garbage)
+    // solution; Newton-Raphson failure handling then reduces the step size.
+  }
+  use_sparse_solve_ = false;
   LU_.compute(A);
 }
 
@@ -307,10 +447,11 @@ void ImplicitEulerIntegrator<AutoDiffXd>::Factor(
 }
 
 // Solves a linear system Ax = b for x using a negated iteration matrix (A)
-// factored using LU decomposition.
+// factored using LU decomposition (sparse or dense; see Factor()).
 // @sa Factor()
 template <class T>
 VectorX<T> ImplicitEulerIntegrator<T>::Solve(const VectorX<T>& b) const {
+  if (use_sparse_solve_) return sparse_lu_.solve(b);
   return LU_.solve(b);
 }
 
@@ -330,6 +471,27 @@ bool ImplicitEulerIntegrator<T>::IsBadJacobian(const MatrixX<T>& J) const {
   return !J.allFinite();
 }
 
+// Discards the cached Jacobian matrix (and, implicitly, the iteration matrix
+// factorization) when the observed Newton-Raphson contraction rate @p theta
+// indicates the cached matrices have gone stale; see
+// set_convergence_rate_refresh_threshold(). Called after every converged
+// Newton-Raphson solve.
+template <class T>
+void ImplicitEulerIntegrator<T>::RefreshJacobianIfStale(const T& theta) {
+  // With reuse disabled the matrices are always fresh; there is nothing
+  // to discard.
+  if (!reuse_)
+    return;
+
+  if (theta > convergence_rate_refresh_threshold_) {
+    SPDLOG_DEBUG(drake::log(), "Convergence rate {} exceeds refresh "
+        "threshold {}; discarding Jacobian", theta,
+        convergence_rate_refresh_threshold_);
+    ++num_convergence_rate_refreshes_;
+    J_.resize(0, 0);
+  }
+}
+
 // Computes any necessary matrices for the Newton-Raphson iteration in
 // StepAbstract(). Parameters are identical to those for StepAbstract;
 // @see StepAbstract() for their documentation.
@@ -360,7 +522,9 @@ bool ImplicitEulerIntegrator<T>::CalcMatrices(const T& tf, const T& dt,
 
   switch (trial) {
     case 1:
-      // For the first trial, we do nothing special.
+      // For the first trial, we do nothing special: both the Jacobian matrix
+      // and the iteration matrix factorization are reused as-is.
+      ++num_iter_matrix_reuses_;
       return true;
 
     case 2: {
@@ -460,6 +624,13 @@ bool ImplicitEulerIntegrator<T>::StepAbstract(const T& dt,
   // convergence.
   T last_dx_norm = std::numeric_limits<double>::infinity();
 
+  // The most recently observed contraction rate (θ); used to judge, after a
+  // successful solve, whether the reused Jacobian matrix has gone stale. A
+  // solve that converges before a rate can be observed contracts quickly,
+  // so zero (which never triggers a refresh) is the appropriate initial
+  // value.
+  T last_theta(0);
+
   // Calculate Jacobian and iteration matrices (and factorizations), as needed.
   if (!CalcMatrices(tf, dt, scale, *xtplus, trial)) {
     last_call_failed_ = true;
@@ -502,6 +673,7 @@ bool ImplicitEulerIntegrator<T>::StepAbstract(const T& dt,
     if (dx_norm < 10 * std::numeric_limits<double>::epsilon()) {
       context->get_mutable_continuous_state().SetFromVector(*xtplus);
       last_call_failed_ = false;
+      RefreshJacobianIfStale(last_theta);
       return true;
     }
 
@@ -513,6 +685,7 @@ bool ImplicitEulerIntegrator<T>::StepAbstract(const T& dt,
       const T eta = theta / (1 - theta);
       SPDLOG_DEBUG(drake::log(), "Newton-Raphson loop {} theta: {}, eta: {}",
                    i, theta, eta);
+      last_theta = theta;
 
       // Look for divergence.
       if (theta > 1) {
@@ -532,6 +705,7 @@ bool ImplicitEulerIntegrator<T>::StepAbstract(const T& dt,
                      eta, dt);
         context->get_mutable_continuous_state().SetFromVector(*xtplus);
         last_call_failed_ = false;
+        RefreshJacobianIfStale(last_theta);
         return true;
       }
     }
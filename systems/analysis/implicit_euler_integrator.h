@@ -3,10 +3,13 @@
 #include <limits>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include <Eigen/LU>
+#include <Eigen/SparseLU>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
 #include "drake/math/autodiff_gradient.h"
 #include "drake/systems/analysis/integrator_base.h"
 
@@ -144,6 +147,33 @@ class ImplicitEulerIntegrator final : public IntegratorBase<T> {
   /// @sa set_reuse()
   bool get_reuse() const { return reuse_; }
 
+  /// Sets the Newton-Raphson convergence rate past which reused Jacobian
+  /// matrices and iteration matrix factorizations are considered stale
+  /// (default is 1, which disables the policy). After every converged
+  /// Newton-Raphson solve, the last observed contraction rate
+  /// θ = ‖Δxᵏ‖/‖Δxᵏ⁻¹‖ is compared against this threshold; if θ exceeds it,
+  /// the cached Jacobian matrix and factorization are discarded so that the
+  /// next solve reforms them at the current state. This is the "modified
+  /// Newton" staleness test used by codes like SUNDIALS: a stale iteration
+  /// matrix still converges- it merely converges linearly with rate θ- so
+  /// slow contraction, rather than outright failure, is the earliest signal
+  /// that the matrix should be refreshed. Values around 0.3 are typical;
+  /// smaller values refresh more eagerly. This policy is inactive when
+  /// set_reuse(false) is in effect (matrices are then always fresh).
+  /// @throws std::runtime_error if @p threshold is not positive.
+  /// @sa get_num_convergence_rate_refreshes()
+  void set_convergence_rate_refresh_threshold(double threshold) {
+    DRAKE_THROW_UNLESS(threshold > 0);
+    convergence_rate_refresh_threshold_ = threshold;
+  }
+
+  /// Gets the convergence rate threshold for discarding stale Jacobian
+  /// matrices and iteration matrix factorizations.
+  /// @sa set_convergence_rate_refresh_threshold()
+  double get_convergence_rate_refresh_threshold() const {
+    return convergence_rate_refresh_threshold_;
+  }
+
   /// Sets the Jacobian computation scheme. This function can be safely called
   /// at any time (i.e., the integrator need not be re-initialized afterward).
   /// @note Discards any already-computed Jacobian matrices if the scheme
@@ -159,6 +189,51 @@ class ImplicitEulerIntegrator final : public IntegratorBase<T> {
   }
   /// @}
 
+  /// @name Methods for declaring Jacobian sparsity.
+  ///
+  /// The cost of numerically differentiated Jacobian formation is one
+  /// derivative evaluation per state variable. When the Jacobian is sparse-
+  /// as for systems with banded or block-diagonal coupling- columns whose
+  /// structural nonzeros occupy disjoint rows can be perturbed simultaneously
+  /// and recovered from a single derivative evaluation, reducing the n
+  /// evaluations to one per column *group* (a graph coloring; see
+  /// [Curtis, 1974]). A declared pattern also routes the iteration matrix
+  /// factorization through a sparse LU decomposition with fill-reducing
+  /// ordering.
+  ///
+  /// - [Curtis, 1974]  A. R. Curtis, M. J. D. Powell, and J. K. Reid. On the
+  ///                   estimation of sparse Jacobian matrices. J. Inst. Math.
+  ///                   Appl., 13:117-119, 1974.
+  /// @{
+
+  /// Declares the structural sparsity pattern of the Jacobian matrix:
+  /// `pattern(i, j)` is `true` if ∂fᵢ/∂xⱼ may be nonzero. Entries declared
+  /// `false` are taken to be exactly zero; a pattern that omits a true
+  /// dependency will produce a wrong Jacobian (and, typically, Newton-Raphson
+  /// convergence failures). The pattern only affects the finite difference
+  /// schemes; automatic differentiation always forms the exact dense
+  /// Jacobian. A pattern whose dimension does not match the number of
+  /// continuous state variables is ignored (dense differencing is used).
+  /// Pass an empty (0 x 0) matrix to revert to dense differencing.
+  /// @throws std::runtime_error if @p pattern is not square.
+  /// @note Discards any already-computed Jacobian matrices.
+  void set_jacobian_sparsity_pattern(const MatrixX<bool>& pattern);
+
+  /// Gets the declared Jacobian sparsity pattern (empty if none).
+  /// @sa set_jacobian_sparsity_pattern()
+  const MatrixX<bool>& get_jacobian_sparsity_pattern() const {
+    return sparsity_pattern_;
+  }
+
+  /// Returns the number of column groups computed from the declared sparsity
+  /// pattern, equal to the number of derivative evaluations needed per
+  /// forward difference Jacobian. Returns zero if no pattern is declared
+  /// (every column is evaluated separately).
+  int num_jacobian_column_groups() const {
+    return static_cast<int>(column_groups_.size());
+  }
+  /// @}
+
   /// The integrator supports error estimation.
   bool supports_error_estimation() const override { return true; }
 
@@ -212,6 +287,26 @@ class ImplicitEulerIntegrator final : public IntegratorBase<T> {
     return num_iter_factorizations_;
   }
 
+  /// Gets the number of Newton-Raphson solves that reused both the cached
+  /// Jacobian matrix and the cached iteration matrix factorization (i.e.,
+  /// that performed no factorization at all) since the last call to
+  /// ResetStatistics(). Together with
+  /// get_num_iteration_matrix_factorizations(), this statistic shows how
+  /// effective the reuse policy is for a given problem.
+  /// @sa set_reuse()
+  int64_t get_num_iteration_matrix_reuses() const {
+    return num_iter_matrix_reuses_;
+  }
+
+  /// Gets the number of times the cached Jacobian matrix and iteration matrix
+  /// factorization were discarded because the observed Newton-Raphson
+  /// convergence rate degraded past the refresh threshold, since the last
+  /// call to ResetStatistics().
+  /// @sa set_convergence_rate_refresh_threshold()
+  int64_t get_num_convergence_rate_refreshes() const {
+    return num_convergence_rate_refreshes_;
+  }
+
   /// @}
 
   /// @name Error-estimation statistics functions.
@@ -250,6 +345,7 @@ class ImplicitEulerIntegrator final : public IntegratorBase<T> {
 
  private:
   bool IsBadJacobian(const MatrixX<T>& J) const;
+  void RefreshJacobianIfStale(const T& theta);
   void DoInitialize() override;
   void DoResetStatistics() override;
   void Factor(const MatrixX<T>& A);
@@ -286,6 +382,20 @@ class ImplicitEulerIntegrator final : public IntegratorBase<T> {
   // serves to minimize heap allocations and deallocations.
   Eigen::PartialPivLU<MatrixX<double>> LU_;
 
+  // Sparse factorization of the iteration matrix, used in place of LU_ when
+  // a Jacobian sparsity pattern has been declared (the iteration matrix
+  // inherits the Jacobian's pattern plus the identity's diagonal).
+  Eigen::SparseLU<Eigen::SparseMatrix<double>> sparse_lu_;
+  Eigen::SparseMatrix<double> sparse_iteration_matrix_;
+  bool use_sparse_solve_{false};
+
+  // The declared Jacobian sparsity pattern (empty if none), the structural
+  // nonzero rows of each of its columns, and the column groups computed from
+  // it; see set_jacobian_sparsity_pattern().
+  MatrixX<bool> sparsity_pattern_;
+  std::vector<std::vector<int>> nonzero_rows_;
+  std::vector<std::vector<int>> column_groups_;
+
   // A QR factorization is necessary for automatic differentiation (current
   // Eigen requirement).
   Eigen::HouseholderQR<MatrixX<AutoDiffXd>> QR_;
@@ -329,9 +439,17 @@ class ImplicitEulerIntegrator final : public IntegratorBase<T> {
   // will not be reused.
   bool reuse_{true};
 
+  // Observed Newton-Raphson contraction rate past which cached Jacobian
+  // matrices and iteration matrix factorizations are discarded as stale; see
+  // set_convergence_rate_refresh_threshold(). The default of 1 disables the
+  // policy (only divergence and convergence failures force a refresh).
+  double convergence_rate_refresh_threshold_{1.0};
+
   // Various combined statistics.
   int64_t num_jacobian_evaluations_{0};
   int64_t num_iter_factorizations_{0};
+  int64_t num_iter_matrix_reuses_{0};
+  int64_t num_convergence_rate_refreshes_{0};
   int64_t num_jacobian_function_evaluations_{0};
   int64_t num_nr_iterations_{0};
 
@@ -1,5 +1,12 @@
 #include "drake/systems/analysis/monte_carlo.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_throw.h"
 #include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/system.h"
 
@@ -22,7 +29,11 @@ double RandomSimulation(const SimulatorFactory& make_simulator,
 
 std::vector<RandomSimulationResult> MonteCarloSimulation(
     const SimulatorFactory& make_simulator, const ScalarSystemFunction& output,
-    double final_time, int num_samples, RandomGenerator* generator) {
+    double final_time, int num_samples, RandomGenerator* generator,
+    int num_parallel_executions) {
+  DRAKE_THROW_UNLESS(num_samples >= 0);
+  DRAKE_THROW_UNLESS(num_parallel_executions >= 1 ||
+                     num_parallel_executions == kUseHardwareConcurrency);
   std::unique_ptr<RandomGenerator> owned_generator{};
   if (generator == nullptr) {
     // Create a generator to be used for this set of tests.
@@ -30,18 +41,58 @@ std::vector<RandomSimulationResult> MonteCarloSimulation(
     generator = owned_generator.get();
   }
 
-  std::vector<RandomSimulationResult> data;
-  data.reserve(num_samples);
+  int num_threads = num_parallel_executions;
+  if (num_parallel_executions == kUseHardwareConcurrency) {
+    // hardware_concurrency() may return zero if it cannot be determined.
+    num_threads = std::max(1, static_cast<int>(
+        std::thread::hardware_concurrency()));
+  }
+  num_threads = std::min(num_threads, std::max(num_samples, 1));
+
+  // Seed one generator per sample, serially, so that the set of samples is
+  // identical regardless of the number of threads used below.
+  std::vector<RandomGenerator> sample_generators;
+  sample_generators.reserve(num_samples);
+  for (int i = 0; i < num_samples; ++i) {
+    sample_generators.emplace_back((*generator)());
+  }
+
+  // Workers claim the next unclaimed sample index until none are left, so
+  // that long simulations do not serialize behind an a-priori static
+  // partition of the samples.
+  std::vector<double> outputs(num_samples);
+  std::atomic<int> next_sample(0);
+  auto worker = [&]() {
+    while (true) {
+      const int i = next_sample.fetch_add(1);
+      if (i >= num_samples) return;
+      // Each sample runs on a copy so that the pre-simulation snapshot in
+      // sample_generators remains valid for replay.
+      RandomGenerator sample_generator(sample_generators[i]);
+      outputs[i] =
+          RandomSimulation(make_simulator, output, final_time,
+                           &sample_generator);
+    }
+  };
 
-  // TODO(russt): Support running these in multiple threads, as they are
-  // trivially parallelizable.
-  for (int i = 0; i < num_samples; i++) {
-    RandomSimulationResult result(*generator);
-    result.output =
-        RandomSimulation(make_simulator, output, final_time, generator);
-    data.emplace_back(std::move(result));
+  if (num_threads <= 1) {
+    worker();
+  } else {
+    // The calling thread participates as a worker, so only num_threads - 1
+    // additional threads are spawned; this avoids leaving one hardware
+    // thread idle when num_threads == hardware_concurrency().
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads - 1);
+    for (int i = 0; i < num_threads - 1; ++i) threads.emplace_back(worker);
+    worker();
+    for (auto& thread : threads) thread.join();
   }
 
+  std::vector<RandomSimulationResult> data;
+  data.reserve(num_samples);
+  for (int i = 0; i < num_samples; ++i) {
+    data.emplace_back(sample_generators[i], outputs[i]);
+  }
   return data;
 }
 
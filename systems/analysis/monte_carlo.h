@@ -119,12 +119,19 @@ struct RandomSimulationResult {
  * In pseudo-code, this algorithm implements:
  * @code
  *   for i=1:num_samples
- *     const generator_snapshot = deepcopy(generator)
- *     output = RandomSimulation(..., generator)
+ *     sample_generator(i) = RandomGenerator(generator())
+ *   parallel for i=1:num_samples
+ *     const generator_snapshot = deepcopy(sample_generator(i))
+ *     output = RandomSimulation(..., sample_generator(i))
  *     data(i) = std::pair(generator_snapshot, output)
  *   return data
  * @endcode
  *
+ * Each sample is run on its own RandomGenerator, seeded serially from @p
+ * generator before any simulation starts. Therefore the returned samples are
+ * identical for any value of @p num_parallel_executions, and each sample can
+ * still be replayed from its generator snapshot with RandomSimulation().
+ *
  * @see RandomSimulation() for details about @p make_simulator, @p output,
  * and @p final_time.
  *
@@ -138,16 +145,25 @@ struct RandomSimulationResult {
  * future call to MonteCarloSimulation, you should make repeated uses of the
  * same RandomGenerator object.
  *
+ * @param num_parallel_executions Number of simulations to run in parallel,
+ * each on its own worker thread with its own Simulator (and System) made by
+ * @p make_simulator. The calling thread acts as one of the workers. Pass
+ * kUseHardwareConcurrency to use the number of hardware threads reported by
+ * the OS. When larger than one, @p make_simulator and @p output must be safe
+ * to call concurrently from multiple threads.
+ *
  * @returns a list of RandomSimulationResult's.
  *
  * @ingroup analysis
  */
-// TODO(russt): Consider generalizing this with options (e.g. setting the
-// number of simulators, number of samples per simulator, number of parallel
-// threads, ...).
 std::vector<RandomSimulationResult> MonteCarloSimulation(
     const SimulatorFactory& make_simulator, const ScalarSystemFunction& output,
-    double final_time, int num_samples, RandomGenerator* generator = nullptr);
+    double final_time, int num_samples, RandomGenerator* generator = nullptr,
+    int num_parallel_executions = 1);
+
+/// Pass as `num_parallel_executions` to MonteCarloSimulation() to run as many
+/// simulations in parallel as the hardware reports it can run concurrently.
+constexpr int kUseHardwareConcurrency = -1;
 
 }  // namespace analysis
 }  // namespace systems
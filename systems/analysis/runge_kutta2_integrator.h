@@ -45,6 +45,25 @@ class RungeKutta2Integrator final : public IntegratorBase<T> {
   /// Integrator does not provide an error estimate.
   int get_error_estimate_order() const override { return 0; }
 
+  /**
+   * Takes a single step of exactly @p dt, skipping the mode checks,
+   * statistics updates, and dense output hook that the IntegratorBase
+   * stepping methods perform; the two-stage update inlines into the caller
+   * (this class is `final`) so the per-step cost is deterministic, as hard
+   * real-time loops require. Statistics other than the derivative evaluation
+   * count are not updated.
+   * @pre Initialize() has been called and @p dt is non-negative (checked by
+   *      DRAKE_ASSERT only).
+   * @sa IntegratorBase::IntegrateWithSingleFixedStep() for the checked and
+   *     instrumented equivalent.
+   */
+  void IntegrateWithSingleMinimalStep(const T& dt) {
+    DRAKE_ASSERT(this->is_initialized());
+    DRAKE_ASSERT(dt >= 0);
+    const bool success = DoStep(dt);
+    DRAKE_DEMAND(success);
+  }
+
  private:
   bool DoStep(const T& dt) override;
 
@@ -0,0 +1,168 @@
+#pragma once
+
+/// @file
+/// Template method implementations for runge_kutta5_integrator.h.
+/// Most users should only include that file, not this one.
+/// For background, see https://drake.mit.edu/cxx_inl.html.
+
+/* clang-format off to disable clang-format-includes */
+#include "drake/systems/analysis/runge_kutta5_integrator.h"
+/* clang-format on */
+
+#include <utility>
+
+namespace drake {
+namespace systems {
+
+/**
+ * RK5-specific initialization function.
+ * @throws std::logic_error if *neither* the initial step size target nor the
+ *           maximum step size have been set before calling.
+ */
+template <class T>
+void RungeKutta5Integrator<T>::DoInitialize() {
+  using std::isnan;
+  const double kDefaultAccuracy = 1e-5;  // Good for this particular
+                                         // integrator.
+  const double kLoosestAccuracy = 1e-3;  // Integrator specific.
+  const double kMaxStepFraction = 0.1;   // Fraction of max step size for
+                                         // less aggressive first step.
+
+  // Set an artificial step size target, if not set already.
+  if (isnan(this->get_initial_step_size_target())) {
+    // Verify that maximum step size has been set.
+    if (isnan(this->get_maximum_step_size()))
+      throw std::logic_error("Neither initial step size target nor maximum "
+                                 "step size has been set!");
+
+    this->request_initial_step_size_target(
+        this->get_maximum_step_size() * kMaxStepFraction);
+  }
+
+  // Sets the working accuracy to a good value.
+  double working_accuracy = this->get_target_accuracy();
+
+  // If the user asks for accuracy that is looser than the loosest this
+  // integrator can provide, use the integrator's loosest accuracy setting
+  // instead.
+  if (working_accuracy > kLoosestAccuracy)
+    working_accuracy = kLoosestAccuracy;
+  else if (isnan(working_accuracy))
+    working_accuracy = kDefaultAccuracy;
+  this->set_accuracy_in_use(working_accuracy);
+
+  // Invalidate the FSAL cache.
+  fsal_valid_ = false;
+}
+
+template <class T>
+bool RungeKutta5Integrator<T>::DoStep(const T& dt) {
+  // Find the continuous state xc within the Context, just once.
+  VectorBase<T>& xc = this->get_mutable_context()
+                          ->get_mutable_continuous_state_vector();
+  const VectorX<T> xt0 = xc.CopyToVector();
+
+  // Setup ta and tb.
+  const T ta = this->get_context().get_time();
+  const T tb = ta + dt;
+
+  // Get the context.
+  auto& context = this->get_context();
+
+  // Get the derivative at the current state (x0) and time (t0). If the final
+  // (FSAL) derivative evaluation of the previous step is still valid — the
+  // time and state have not been changed since, e.g., by an event handler —
+  // it *is* this derivative and no new evaluation is needed.
+  if (fsal_valid_ && ta == fsal_time_ && xt0 == fsal_state_) {
+    std::swap(derivs0_, derivs6_);
+  } else {
+    this->CalcTimeDerivatives(context, derivs0_.get());
+  }
+  const auto& xcdot0 = derivs0_->get_vector();
+
+  // Compute the second stage state and derivative (at c₂ = 1/5).
+  this->get_mutable_context()->set_time(ta + dt * (1.0 / 5));
+  xc.PlusEqScaled(dt * (1.0 / 5), xcdot0);
+  this->CalcTimeDerivatives(context, derivs1_.get());
+  const auto& xcdot1 = derivs1_->get_vector();
+
+  // Compute the third stage state and derivative (at c₃ = 3/10).
+  this->get_mutable_context()->set_time(ta + dt * (3.0 / 10));
+  xc.SetFromVector(xt0);
+  xc.PlusEqScaled({{dt * (3.0 / 40), xcdot0},
+                   {dt * (9.0 / 40), xcdot1}});
+  this->CalcTimeDerivatives(context, derivs2_.get());
+  const auto& xcdot2 = derivs2_->get_vector();
+
+  // Compute the fourth stage state and derivative (at c₄ = 4/5).
+  this->get_mutable_context()->set_time(ta + dt * (4.0 / 5));
+  xc.SetFromVector(xt0);
+  xc.PlusEqScaled({{dt * (44.0 / 45), xcdot0},
+                   {dt * (-56.0 / 15), xcdot1},
+                   {dt * (32.0 / 9), xcdot2}});
+  this->CalcTimeDerivatives(context, derivs3_.get());
+  const auto& xcdot3 = derivs3_->get_vector();
+
+  // Compute the fifth stage state and derivative (at c₅ = 8/9).
+  this->get_mutable_context()->set_time(ta + dt * (8.0 / 9));
+  xc.SetFromVector(xt0);
+  xc.PlusEqScaled({{dt * (19372.0 / 6561), xcdot0},
+                   {dt * (-25360.0 / 2187), xcdot1},
+                   {dt * (64448.0 / 6561), xcdot2},
+                   {dt * (-212.0 / 729), xcdot3}});
+  this->CalcTimeDerivatives(context, derivs4_.get());
+  const auto& xcdot4 = derivs4_->get_vector();
+
+  // Compute the sixth stage state and derivative (at c₆ = 1).
+  this->get_mutable_context()->set_time(tb);
+  xc.SetFromVector(xt0);
+  xc.PlusEqScaled({{dt * (9017.0 / 3168), xcdot0},
+                   {dt * (-355.0 / 33), xcdot1},
+                   {dt * (46732.0 / 5247), xcdot2},
+                   {dt * (49.0 / 176), xcdot3},
+                   {dt * (-5103.0 / 18656), xcdot4}});
+  this->CalcTimeDerivatives(context, derivs5_.get());
+  const auto& xcdot5 = derivs5_->get_vector();
+
+  // Calculate the 5th-order solution at tb.
+  xc.SetFromVector(xt0);
+  xc.PlusEqScaled({{dt * (35.0 / 384), xcdot0},
+                   {dt * (500.0 / 1113), xcdot2},
+                   {dt * (125.0 / 192), xcdot3},
+                   {dt * (-2187.0 / 6784), xcdot4},
+                   {dt * (11.0 / 84), xcdot5}});
+
+  // Evaluate the derivative at the solution (the seventh, FSAL stage); it
+  // contributes to the error estimate and is cached for reuse as the first
+  // stage of the next step.
+  this->CalcTimeDerivatives(context, derivs6_.get());
+  const auto& xcdot6 = derivs6_->get_vector();
+  fsal_time_ = tb;
+  fsal_state_ = xc.CopyToVector();
+  fsal_valid_ = true;
+
+  // If the state of the system has changed, the error estimate will no
+  // longer be sized correctly. Verify that the error estimate is the
+  // correct size.
+  DRAKE_DEMAND(this->get_error_estimate()->size() == xc.size());
+
+  // Calculate the error estimate — the difference between the 5th-order and
+  // embedded 4th-order solutions — using an Eigen vector, then copy it to
+  // the continuous state vector, where the various state components can be
+  // analyzed.
+  err_est_vec_ = VectorX<T>::Zero(xt0.size());
+  xcdot0.ScaleAndAddToVector(dt * (71.0 / 57600), err_est_vec_);
+  xcdot2.ScaleAndAddToVector(dt * (-71.0 / 16695), err_est_vec_);
+  xcdot3.ScaleAndAddToVector(dt * (71.0 / 1920), err_est_vec_);
+  xcdot4.ScaleAndAddToVector(dt * (-17253.0 / 339200), err_est_vec_);
+  xcdot5.ScaleAndAddToVector(dt * (22.0 / 525), err_est_vec_);
+  xcdot6.ScaleAndAddToVector(dt * (-1.0 / 40), err_est_vec_);
+  err_est_vec_ = err_est_vec_.cwiseAbs();
+  this->get_mutable_error_estimate()->SetFromVector(err_est_vec_);
+
+  // RK5 always succeeds in taking its desired step.
+  return true;
+}
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/analysis/integrator_base.h"
+
+namespace drake {
+namespace systems {
+
+/**
+ * A fifth-order Runge-Kutta integrator (Dormand-Prince) with a fourth-order
+ * embedded error estimate.
+ * @tparam T A double or autodiff type.
+ *
+ * This class uses Drake's `-inl.h` pattern.  When seeing linker errors from
+ * this class, please refer to https://drake.mit.edu/cxx_inl.html.
+ *
+ * Instantiated templates for the following kinds of T's are provided:
+ *
+ * - double
+ * - AutoDiffXd
+ *
+ * This integrator implements the RK5(4)7M pair of [Dormand, 1980], commonly
+ * known as DOPRI5. The Butcher tableaux for this integrator follows:
+ * <pre>
+ * 0    |
+ * 1/5  | 1/5
+ * 3/10 | 3/40        9/40
+ * 4/5  | 44/45      -56/15      32/9
+ * 8/9  | 19372/6561 -25360/2187 64448/6561 -212/729
+ * 1    | 9017/3168  -355/33     46732/5247  49/176  -5103/18656
+ * 1    | 35/384      0          500/1113    125/192 -2187/6784    11/84
+ * ---------------------------------------------------------------------------
+ *        35/384      0          500/1113    125/192 -2187/6784    11/84    0
+ *        5179/57600  0          7571/16695  393/640 -92097/339200 187/2100 1/40
+ * </pre>
+ * where the second to last row is the 5th-order propagated solution and
+ * the last row is the 4th-order embedded solution used for the error
+ * estimate.
+ *
+ * The method is "first same as last" (FSAL): the seventh stage derivative is
+ * evaluated at the propagated solution, so it is exactly the first stage
+ * derivative of the following step. When consecutive steps are taken without
+ * the time or state being changed in between (e.g., by an event handler),
+ * the cached final evaluation is reused and each step costs only six
+ * derivative evaluations.
+ *
+ * - [Dormand, 1980] J. R. Dormand and P. J. Prince. A family of embedded
+ *   Runge-Kutta formulae. Journal of Computational and Applied Mathematics,
+ *   6(1):19-26, 1980.
+ * - [Hairer, 1993] E. Hairer, S. Noersett, and G. Wanner. Solving ODEs I. 2nd
+ *   rev. ed. Springer, 1993. pp. 178-179.
+ */
+template <class T>
+class RungeKutta5Integrator final : public IntegratorBase<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RungeKutta5Integrator)
+
+  ~RungeKutta5Integrator() override = default;
+
+  explicit RungeKutta5Integrator(const System<T>& system,
+                                 Context<T>* context = nullptr)
+      : IntegratorBase<T>(system, context) {
+    derivs0_ = system.AllocateTimeDerivatives();
+    derivs1_ = system.AllocateTimeDerivatives();
+    derivs2_ = system.AllocateTimeDerivatives();
+    derivs3_ = system.AllocateTimeDerivatives();
+    derivs4_ = system.AllocateTimeDerivatives();
+    derivs5_ = system.AllocateTimeDerivatives();
+    derivs6_ = system.AllocateTimeDerivatives();
+  }
+
+  /**
+   * The integrator supports error estimation.
+   */
+  bool supports_error_estimation() const override { return true; }
+
+  /// The error estimate is the difference between the fifth-order propagated
+  /// solution and the fourth-order embedded solution, which behaves as h⁵.
+  int get_error_estimate_order() const override { return 5; }
+
+ private:
+  void DoInitialize() override;
+  bool DoStep(const T& dt) override;
+
+  // Vector used in error estimate calculations.
+  VectorX<T> err_est_vec_;
+
+  // These are pre-allocated temporaries for use by integration. They store
+  // the derivatives computed at the various stages within the integration
+  // interval.
+  std::unique_ptr<ContinuousState<T>> derivs0_, derivs1_, derivs2_, derivs3_,
+      derivs4_, derivs5_, derivs6_;
+
+  // The time, state, and derivative of the last FSAL evaluation; the cached
+  // derivative can be reused as the first stage of the next step only when
+  // the time and state are unchanged from the end of this one.
+  T fsal_time_{0};
+  VectorX<T> fsal_state_;
+  bool fsal_valid_{false};
+};
+}  // namespace systems
+}  // namespace drake
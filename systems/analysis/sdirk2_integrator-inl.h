@@ -0,0 +1,524 @@
+#pragma once
+
+/// @file
+/// Template method implementations for sdirk2_integrator.h.
+/// Most users should only include that file, not this one.
+/// For background, see https://drake.mit.edu/cxx_inl.html.
+
+/* clang-format off to disable clang-format-includes */
+#include "drake/systems/analysis/sdirk2_integrator.h"
+/* clang-format on */
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include "drake/common/text_logging.h"
+
+namespace drake {
+namespace systems {
+
+template <class T>
+void Sdirk2Integrator<T>::DoResetStatistics() {
+  num_nr_iterations_ = 0;
+  num_jacobian_evaluations_ = 0;
+  num_jacobian_function_evaluations_ = 0;
+  num_iter_factorizations_ = 0;
+}
+
+template <class T>
+void Sdirk2Integrator<T>::DoInitialize() {
+  using std::isnan;
+
+  // Allocate storage for changes to state variables during Newton-Raphson.
+  dx_state_ = this->get_system().AllocateTimeDerivatives();
+
+  const double kDefaultAccuracy = 1e-2;  // Good for this particular
+                                         // integrator.
+  const double kLoosestAccuracy = 5e-1;  // Loosest accuracy is quite loose.
+
+  // Set an artificial step size target, if not set already.
+  if (isnan(this->get_initial_step_size_target())) {
+    // Verify that maximum step size has been set.
+    if (isnan(this->get_maximum_step_size()))
+      throw std::logic_error("Neither initial step size target nor maximum "
+                                 "step size has been set!");
+
+    this->request_initial_step_size_target(
+        this->get_maximum_step_size());
+  }
+
+  // Sets the working accuracy to a good value.
+  double working_accuracy = this->get_target_accuracy();
+
+  // If the user asks for accuracy that is looser than the loosest this
+  // integrator can provide, use the integrator's loosest accuracy setting
+  // instead.
+  if (isnan(working_accuracy))
+    working_accuracy = kDefaultAccuracy;
+  else if (working_accuracy > kLoosestAccuracy)
+    working_accuracy = kLoosestAccuracy;
+  this->set_accuracy_in_use(working_accuracy);
+
+  // Reset the Jacobian matrix (so that recomputation is forced).
+  J_.resize(0, 0);
+}
+
+// Evaluates the ordinary differential equations at the time and state in
+// the system's context (stored by the integrator).
+template <class T>
+VectorX<T> Sdirk2Integrator<T>::CalcTimeDerivativesUsingContext() {
+  this->CalcTimeDerivatives(this->get_context(), derivs_.get());
+  return derivs_->CopyToVector();
+}
+
+// Computes the Jacobian of the ordinary differential equations with respect
+// to the continuous state, evaluated at time @p t and state @p x, using
+// first-order forward differencing.
+// @post The time and state of the system's context are restored on return.
+template <class T>
+MatrixX<T> Sdirk2Integrator<T>::CalcJacobian(const T& t, const VectorX<T>& x) {
+  using std::abs;
+
+  // Set epsilon to the square root of machine precision.
+  const double eps = std::sqrt(std::numeric_limits<double>::epsilon());
+
+  Context<T>* context = this->get_mutable_context();
+
+  // Save the current time and state so they can be restored on return.
+  const T t_current = context->get_time();
+  const VectorX<T> x_current = context->get_continuous_state_vector().
+      CopyToVector();
+
+  // Update the time and state to those at which the Jacobian is evaluated.
+  context->set_time(t);
+  ContinuousState<T>& continuous_state = context->
+      get_mutable_continuous_state();
+  continuous_state.SetFromVector(x);
+  num_jacobian_evaluations_++;
+
+  // Get the current number of ODE evaluations so that the number used for
+  // the Jacobian can be determined afterward.
+  const int64_t current_ODE_evals = this->get_num_derivative_evaluations();
+
+  const int n = x.size();
+  SPDLOG_DEBUG(drake::log(), "  SDIRK2 Compute Forwarddiff {}-Jacobian t={}",
+               n, t);
+
+  // Initialize the Jacobian.
+  MatrixX<T> J(n, n);
+
+  // Evaluate f(t, x) at the current state.
+  const VectorX<T> f = CalcTimeDerivativesUsingContext();
+
+  // Compute the Jacobian, column by column.
+  VectorX<T> x_prime = x;
+  for (int i = 0; i < n; ++i) {
+    // Compute a good increment to the dimension using approximately 1/eps
+    // digits of precision. Note that if |x| is large, the increment will be
+    // large as well. If |x| is small, the increment will be no smaller than
+    // eps.
+    const T abs_xi = abs(x(i));
+    T dxi(abs_xi);
+    if (dxi <= 1) {
+      // When |x[i]| is small, increment will be eps.
+      dxi = eps;
+    } else {
+      // |x[i]| not small; make increment a fraction of |x[i]|.
+      dxi = eps * abs_xi;
+    }
+
+    // Update x', minimizing the effect of roundoff error by ensuring that
+    // x and dx differ by an exactly representable number. See p. 192 of
+    // Press, W., Teukolsky, S., Vetterling, W., and Flannery, P. Numerical
+    //   Recipes in C++, 2nd Ed., Cambridge University Press, 2002.
+    x_prime(i) = x(i) + dxi;
+    dxi = x_prime(i) - x(i);
+
+    // Compute f' and set the relevant column of the Jacobian matrix.
+    continuous_state.SetFromVector(x_prime);
+    J.col(i) = (CalcTimeDerivativesUsingContext() - f) / dxi;
+
+    // Reset x' to x.
+    x_prime(i) = x(i);
+  }
+
+  // Use the new number of ODE evaluations to determine the number of
+  // Jacobian evaluations.
+  num_jacobian_function_evaluations_ +=
+      this->get_num_derivative_evaluations() - current_ODE_evals;
+
+  // Restore the time and state.
+  context->set_time(t_current);
+  continuous_state.SetFromVector(x_current);
+
+  return J;
+}
+
+// Factors a dense matrix (the negated iteration matrix) using LU
+// factorization, which should be faster than the QR factorization used in
+// the specialized template method immediately below.
+template <class T>
+void Sdirk2Integrator<T>::Factor(const MatrixX<T>& A) {
+  num_iter_factorizations_++;
+  LU_.compute(A);
+}
+
+// Factors a dense matrix (the negated iteration matrix). This
+// AutoDiff-specialized method is necessary because Eigen's LU factorization,
+// which should be faster than the QR factorization used here, is not
+// currently AutoDiff-able (while the QR factorization *is* AutoDiff-able).
+template <>
+inline void Sdirk2Integrator<AutoDiffXd>::Factor(
+    const MatrixX<AutoDiffXd>& A) {
+  num_iter_factorizations_++;
+  QR_.compute(A);
+}
+
+// Solves a linear system Ax = b for x using a negated iteration matrix (A)
+// factored using LU decomposition.
+// @sa Factor()
+template <class T>
+VectorX<T> Sdirk2Integrator<T>::Solve(const VectorX<T>& b) const {
+  return LU_.solve(b);
+}
+
+// Solves the linear system Ax = b for x using a negated iteration matrix (A)
+// factored using QR decomposition.
+// @sa Factor()
+template <>
+inline VectorX<AutoDiffXd> Sdirk2Integrator<AutoDiffXd>::Solve(
+    const VectorX<AutoDiffXd>& b) const {
+  return QR_.solve(b);
+}
+
+// Checks to see whether a Jacobian matrix has "become bad" and needs to be
+// refactorized.
+template <class T>
+bool Sdirk2Integrator<T>::IsBadJacobian(const MatrixX<T>& J) const {
+  return !J.allFinite();
+}
+
+// Computes any necessary matrices for the Newton-Raphson iteration in
+// SolveImplicitEquation(). Parameters are identical to those for
+// SolveImplicitEquation(); @see SolveImplicitEquation() for their
+// documentation.
+// @returns `false` if the calling method should indicate failure; `true`
+//          otherwise.
+template <class T>
+bool Sdirk2Integrator<T>::CalcMatrices(const T& t_solve, const T& gamma_h,
+                                       const VectorX<T>& z, int trial) {
+  // Compute the initial Jacobian and negated iteration matrices and factor
+  // them, if necessary. Both stages of a step use the same γh, so the
+  // factorization computed for the first stage is shared by the second,
+  // even when reuse across steps is disabled.
+  if ((!reuse_ && !factored_this_step_) || J_.rows() == 0 ||
+      IsBadJacobian(J_)) {
+    J_ = CalcJacobian(t_solve, z);
+    const int n = z.size();
+    neg_iteration_matrix_ = J_ * gamma_h - MatrixX<T>::Identity(n, n);
+    Factor(neg_iteration_matrix_);
+    factored_this_step_ = true;
+    return true;
+  }
+
+  switch (trial) {
+    case 1:
+      // For the first trial, we do nothing special: the Jacobian matrix and
+      // iteration matrix factorization from the previous solve (possibly
+      // with a different step size) are reused as-is.
+      return true;
+
+    case 2: {
+      // For the second trial, re-construct and factor the iteration matrix
+      // with the current γh, still reusing the cached Jacobian matrix.
+      const int n = z.size();
+      neg_iteration_matrix_ = J_ * gamma_h - MatrixX<T>::Identity(n, n);
+      Factor(neg_iteration_matrix_);
+      factored_this_step_ = true;
+      return true;
+    }
+
+    case 3: {
+      // If the last solve failed, we know the Jacobian matrix is fresh and
+      // the iteration matrix was newly formed and factored (on Trial #2), so
+      // there is nothing more to be done.
+      if (last_call_failed_)
+        return false;
+
+      // Reform the Jacobian matrix at the current state and refactor.
+      J_ = CalcJacobian(t_solve, z);
+      const int n = z.size();
+      neg_iteration_matrix_ = J_ * gamma_h - MatrixX<T>::Identity(n, n);
+      Factor(neg_iteration_matrix_);
+      factored_this_step_ = true;
+      return true;
+    }
+
+    case 4:
+      // Trial #4 indicates failure.
+      return false;
+
+    default:
+      DRAKE_ABORT_MSG("Unexpected trial number.");
+  }
+}
+
+// Solves the stage equation z = rhs + γh f(t_solve, z) for z using
+// Newton-Raphson.
+// @param t_solve the time at which the stage derivative is evaluated.
+// @param gamma_h the product of the diagonal coefficient γ and the step
+//        size.
+// @param rhs the constant portion of the stage equation.
+// @param [in,out] z the initial guess on entry; the solution on successful
+//        return (indeterminate on failure).
+// @param trial the attempt for this approach (1-4); the method uses more
+//        computationally expensive matrix refreshes as the trial number
+//        increases.
+// @returns `true` if the iteration converged and `false` otherwise.
+// @post The time and continuous state of the system's context are
+//       indeterminate on return.
+template <class T>
+bool Sdirk2Integrator<T>::SolveImplicitEquation(const T& t_solve,
+                                                const T& gamma_h,
+                                                const VectorX<T>& rhs,
+                                                VectorX<T>* z, int trial) {
+  using std::max;
+
+  // Verify the trial number is valid.
+  DRAKE_ASSERT(trial >= 1 && trial <= 4);
+
+  SPDLOG_DEBUG(drake::log(), "SDIRK2 stage solve entered for t={}, γh={}, "
+               "trial={}", t_solve, gamma_h, trial);
+
+  // All derivatives will be computed at the stage time.
+  Context<T>* context = this->get_mutable_context();
+  context->set_time(t_solve);
+  context->get_mutable_continuous_state().SetFromVector(*z);
+
+  // Evaluate the residual g(z) = z - rhs - γh f(t_solve, z) at the initial
+  // guess.
+  VectorX<T> goutput = *z - rhs - gamma_h * CalcTimeDerivativesUsingContext();
+
+  // Initialize the "last" state update norm; this will be used to detect
+  // convergence.
+  T last_dx_norm = std::numeric_limits<double>::infinity();
+
+  // Calculate Jacobian and iteration matrices (and factorizations), as
+  // needed.
+  if (!CalcMatrices(t_solve, gamma_h, *z, trial)) {
+    last_call_failed_ = true;
+    return false;
+  }
+
+  // The maximum number of Newton-Raphson iterations to take before declaring
+  // failure; see ImplicitEulerIntegrator for the rationale behind this
+  // particular number.
+  const int max_iterations = 10;
+
+  // Do the Newton-Raphson iterations.
+  for (int i = 0; i < max_iterations; ++i) {
+    // Update the number of Newton-Raphson iterations.
+    num_nr_iterations_++;
+
+    // Compute the state update using the equation A*dz = -g(), where A is
+    // the iteration matrix I - γh J. Using nA as the negation of the
+    // iteration matrix, we instead solve nA*dz = g().
+    VectorX<T> dz = Solve(goutput);
+
+    // Get the infinity norm of the weighted update vector.
+    dx_state_->get_mutable_vector().SetFromVector(dz);
+    T dz_norm = this->CalcStateChangeNorm(*dx_state_);
+
+    // Update the stage state.
+    *z += dz;
+
+    // Check for convergence at machine precision; see
+    // ImplicitEulerIntegrator::StepAbstract() for why this check must
+    // precede the rate-based check below.
+    if (dz_norm < 10 * std::numeric_limits<double>::epsilon()) {
+      last_call_failed_ = false;
+      return true;
+    }
+
+    // Compute the convergence rate and check convergence using the criteria
+    // and constants from ImplicitEulerIntegrator::StepAbstract() (Equation
+    // 8.10 of [Hairer, 1996], applied after at least two iterations).
+    if (i >= 1) {
+      const T theta = dz_norm / last_dx_norm;
+      const T eta = theta / (1 - theta);
+      SPDLOG_DEBUG(drake::log(), "SDIRK2 Newton-Raphson loop {} theta: {}, "
+                   "eta: {}", i, theta, eta);
+
+      // Look for divergence.
+      if (theta > 1) {
+        SPDLOG_DEBUG(drake::log(), "SDIRK2 Newton-Raphson divergence "
+            "detected");
+        break;
+      }
+
+      const double kappa = 0.05;
+      const double k_dot_tol = kappa * this->get_accuracy_in_use();
+      if (eta * dz_norm < k_dot_tol) {
+        last_call_failed_ = false;
+        return true;
+      }
+    }
+
+    // Update the norm of the state update.
+    last_dx_norm = dz_norm;
+
+    // Update the state in the context and compute g(zⁱ⁺¹).
+    context->get_mutable_continuous_state().SetFromVector(*z);
+    goutput = *z - rhs - gamma_h * CalcTimeDerivativesUsingContext();
+  }
+
+  SPDLOG_DEBUG(drake::log(), "SDIRK2 stage solve convergence failed");
+
+  // If Jacobian and iteration matrix factorizations are not reused, there
+  // is nothing else we can try.
+  if (!reuse_) {
+    last_call_failed_ = true;
+    return false;
+  }
+
+  // Try again, freshening Jacobians and iteration matrix factorizations as
+  // helpful.
+  return SolveImplicitEquation(t_solve, gamma_h, rhs, z, trial + 1);
+}
+
+// Steps the system forward by dt, if possible, computing both the
+// second-order solution and the embedded error estimate.
+// @param dt the integration step size to attempt.
+// @param [out] xtplus the second-order solution x(t+dt) on successful return.
+// @param [out] err_est the embedded error estimate on successful return.
+// @returns `true` if both stage solves converged and `false` otherwise.
+// @pre The time and state in the system's context (stored by the integrator)
+//      are set to {t0, x(t0)} on entry.
+// @post The time and state of the system's context will be set to t0+dt and
+//       @p xtplus on successful exit and will be indeterminate on
+//       unsuccessful exit.
+template <class T>
+bool Sdirk2Integrator<T>::AttemptStep(const T& dt, VectorX<T>* xtplus,
+                                      VectorX<T>* err_est) {
+  DRAKE_ASSERT(xtplus != nullptr);
+  DRAKE_ASSERT(err_est != nullptr);
+
+  // Save the time and state at the beginning of this interval.
+  Context<T>* context = this->get_mutable_context();
+  const T t0 = context->get_time();
+  const VectorX<T> xt0 = context->get_continuous_state_vector().
+      CopyToVector();
+
+  const double g = gamma();
+  const T gamma_h = g * dt;
+
+  // No factorization has been performed for this step yet.
+  factored_this_step_ = false;
+
+  // Stage 1: solve z₁ = x(t0) + γh k₁ with k₁ = f(t0 + γh, z₁).
+  VectorX<T> z1 = xt0;
+  if (!SolveImplicitEquation(t0 + gamma_h, gamma_h, xt0, &z1)) {
+    SPDLOG_DEBUG(drake::log(), "SDIRK2 first stage did not converge for "
+        "step size {}", dt);
+    return false;
+  }
+
+  // Recover the first stage derivative algebraically from the converged
+  // stage equation (the residual is approximately zero), avoiding an
+  // additional derivative evaluation.
+  const VectorX<T> k1 = (z1 - xt0) / gamma_h;
+
+  // Stage 2: solve z₂ = x(t0) + (1-γ)h k₁ + γh k₂ with k₂ = f(t0 + h, z₂),
+  // sharing the iteration matrix factorization from the first stage. The
+  // first-order prediction x(t0) + h k₁ makes a good initial guess.
+  const VectorX<T> rhs2 = xt0 + (dt - gamma_h) * k1;
+  VectorX<T> z2 = xt0 + dt * k1;
+  if (!SolveImplicitEquation(t0 + dt, gamma_h, rhs2, &z2)) {
+    SPDLOG_DEBUG(drake::log(), "SDIRK2 second stage did not converge for "
+        "step size {}", dt);
+    return false;
+  }
+  const VectorX<T> k2 = (z2 - rhs2) / gamma_h;
+
+  // The method is stiffly accurate, so the second stage *is* the solution:
+  // x(t0+h) = x(t0) + (1-γ)h k₁ + γh k₂ = z₂.
+  *xtplus = z2;
+
+  // The embedded first-order solution is x̂(t0+h) = x(t0) + h k₁, so the
+  // error estimate is x(t0+h) - x̂(t0+h) = γh (k₂ - k₁).
+  *err_est = gamma_h * (k2 - k1);
+
+  // Set the time and state to the solution.
+  context->set_time(t0 + dt);
+  context->get_mutable_continuous_state().SetFromVector(*xtplus);
+  return true;
+}
+
+/// Takes a given step of the requested size, if possible.
+/// @returns `true` if successful and `false` otherwise.
+/// @post the time and continuous state will be advanced only if `true` is
+///       returned.
+template <class T>
+bool Sdirk2Integrator<T>::DoStep(const T& dt) {
+  // Save the current time and state.
+  Context<T>* context = this->get_mutable_context();
+  const T t0 = context->get_time();
+  const VectorX<T> xt0 = context->get_continuous_state().CopyToVector();
+
+  SPDLOG_DEBUG(drake::log(), "SDIRK2 DoStep(h={}) t={}", dt, t0);
+
+  VectorX<T> xtplus, err_est;
+
+  // If the requested dt is less than or equal to the minimum step size,
+  // an explicit Euler step will be taken, with two half-steps providing the
+  // error estimate; see ImplicitEulerIntegrator::DoStep() for the
+  // derivation of that estimate. Newton-Raphson is not reliable at such
+  // small step sizes (and is not needed- stability is not a concern when dt
+  // is this small).
+  if (dt < this->get_working_minimum_step_size()) {
+    SPDLOG_DEBUG(drake::log(), "-- requested step too small, taking explicit "
+        "step instead");
+    const T half_dt = dt / 2;
+
+    // Compute the full Euler step.
+    this->CalcTimeDerivatives(*context, derivs_.get());
+    xtplus = xt0 + dt * derivs_->CopyToVector();
+
+    // Do one half step.
+    context->get_mutable_continuous_state().SetFromVector(
+        xt0 + half_dt * derivs_->CopyToVector());
+    context->set_time(t0 + half_dt);
+
+    // Do another half step.
+    const VectorX<T> xtpoint5 = context->get_continuous_state_vector().
+        CopyToVector();
+    this->CalcTimeDerivatives(*context, derivs_.get());
+    const VectorX<T> xtplus_halves =
+        xtpoint5 + half_dt * derivs_->CopyToVector();
+    context->get_mutable_continuous_state().SetFromVector(xtplus_halves);
+    context->set_time(t0 + dt);
+
+    // The difference between the full step and the two half steps is a
+    // second-order error estimate.
+    err_est = xtplus - xtplus_halves;
+  } else {
+    // Try taking the requested step.
+    if (!AttemptStep(dt, &xtplus, &err_est)) {
+      // Reset the time and state.
+      context->set_time(t0);
+      context->get_mutable_continuous_state().SetFromVector(xt0);
+      return false;
+    }
+  }
+
+  // Update the caller-accessible error estimate.
+  this->get_mutable_error_estimate()->get_mutable_vector().
+      SetFromVector(err_est);
+
+  return true;
+}
+
+}  // namespace systems
+}  // namespace drake
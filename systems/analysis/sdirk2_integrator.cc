@@ -0,0 +1,11 @@
+#include "drake/systems/analysis/sdirk2_integrator.h"
+#include "drake/systems/analysis/sdirk2_integrator-inl.h"
+
+#include "drake/common/autodiff.h"
+
+namespace drake {
+namespace systems {
+template class Sdirk2Integrator<double>;
+template class Sdirk2Integrator<AutoDiffXd>;
+}  // namespace systems
+}  // namespace drake
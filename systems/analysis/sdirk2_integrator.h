@@ -0,0 +1,196 @@
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include <Eigen/LU>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/analysis/integrator_base.h"
+
+namespace drake {
+namespace systems {
+
+/**
+ * A second-order, L-stable, singly diagonally implicit Runge-Kutta (SDIRK)
+ * integrator with an embedded first-order error estimate.
+ * @tparam T The vector element type, which must be a valid Eigen scalar.
+ *
+ * This class uses Drake's `-inl.h` pattern.  When seeing linker errors from
+ * this class, please refer to https://drake.mit.edu/cxx_inl.html.
+ *
+ * Instantiated templates for the following kinds of T's are provided:
+ *
+ * - double
+ * - AutoDiffXd
+ *
+ * This integrator implements the two-stage SDIRK method of [Alexander, 1977]
+ * with γ = 1 - √2/2, whose Butcher tableau is:<pre>
+ *    γ  |    γ    0
+ *    1  |  1-γ    γ
+ *   ----+------------
+ *       |  1-γ    γ
+ * </pre>
+ * The method is stiffly accurate (the final stage *is* the solution) and
+ * L-stable, making it appropriate for the same class of stiff problems as
+ * ImplicitEulerIntegrator while delivering second-order accuracy: halving
+ * the step size quarters the error, instead of merely halving it.
+ *
+ * The "singly diagonal" structure is the key efficiency property: both
+ * stages solve a nonlinear system whose Newton-Raphson iteration matrix is
+ * the same `I - γh J` (where J is the Jacobian matrix ∂f/∂x of the ordinary
+ * differential equations f and h is the step size), so one factorization is
+ * shared across the stages of a step- and, when matrix reuse is enabled
+ * (the default, see set_reuse()), across subsequent steps until the
+ * iteration fails to converge with the stale factorization. The Jacobian
+ * matrix is computed by first-order forward differencing.
+ *
+ * The embedded error estimate is the difference between the second-order
+ * solution and the first-order approximation `x(t) + h k₁` obtained from the
+ * first stage derivative, i.e., `γh (k₂ - k₁)`; it costs no additional
+ * derivative evaluations or nonlinear solves.
+ *
+ * - [Alexander, 1977]  R. Alexander. Diagonally implicit Runge-Kutta methods
+ *                      for stiff O.D.E.'s. SIAM J. Numer. Anal., 14(6):
+ *                      1006-1021, 1977.
+ * - [Hairer, 1996]     E. Hairer and G. Wanner. Solving Ordinary Differential
+ *                      Equations II (Stiff and Differential-Algebraic
+ *                      Problems). Springer, 1996.
+ *
+ * @see ImplicitEulerIntegrator
+ */
+template <class T>
+class Sdirk2Integrator final : public IntegratorBase<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Sdirk2Integrator)
+
+  ~Sdirk2Integrator() override = default;
+
+  explicit Sdirk2Integrator(const System<T>& system,
+                            Context<T>* context = nullptr)
+      : IntegratorBase<T>(system, context) {
+    derivs_ = system.AllocateTimeDerivatives();
+  }
+
+  /// Sets whether the integrator attempts to reuse Jacobian matrices and
+  /// iteration matrix factorizations (default is `true`). A stale iteration
+  /// matrix slows Newton-Raphson convergence but does not affect the
+  /// solution it converges to; for problems whose Jacobian matrix changes
+  /// slowly, reuse avoids the dominant cost of implicit integration.
+  /// @sa get_reuse()
+  void set_reuse(bool reuse) { reuse_ = reuse; }
+
+  /// Gets whether the integrator attempts to reuse Jacobian matrices and
+  /// iteration matrix factorizations.
+  /// @sa set_reuse()
+  bool get_reuse() const { return reuse_; }
+
+  /// Returns the diagonal coefficient γ = 1 - √2/2 of the Butcher tableau.
+  static double gamma() { return 1.0 - std::sqrt(2.0) / 2.0; }
+
+  /// The integrator supports error estimation.
+  bool supports_error_estimation() const override { return true; }
+
+  /// This integrator provides second order error estimates (the embedded
+  /// method is first order, so the difference between the two solutions is
+  /// second order).
+  int get_error_estimate_order() const override { return 2; }
+
+  /// @name Cumulative statistics functions.
+  /// The functions return statistics specific to the implicit integration
+  /// process.
+  /// @{
+
+  /// Gets the number of ODE function evaluations
+  /// (calls to CalcTimeDerivatives()) *used only for computing
+  /// the Jacobian matrices* since the last call to ResetStatistics().
+  int64_t get_num_derivative_evaluations_for_jacobian() const {
+    return num_jacobian_function_evaluations_;
+  }
+
+  /// Gets the number of Jacobian evaluations (i.e., the number of times
+  /// that the Jacobian matrix was reformed) since the last call to
+  /// ResetStatistics().
+  int64_t get_num_jacobian_evaluations() const {
+    return num_jacobian_evaluations_;
+  }
+
+  /// Gets the number of iterations used in the Newton-Raphson nonlinear
+  /// systems of equation solving process since the last call to
+  /// ResetStatistics().
+  int64_t get_num_newton_raphson_iterations() const {
+    return num_nr_iterations_;
+  }
+
+  /// Gets the number of factorizations of the iteration matrix since the
+  /// last call to ResetStatistics(). Both stages of a step share a single
+  /// factorization, and (with reuse enabled) so do subsequent steps, so this
+  /// count is ordinarily much smaller than twice the number of steps taken.
+  int64_t get_num_iteration_matrix_factorizations() const {
+    return num_iter_factorizations_;
+  }
+
+  /// @}
+
+ private:
+  bool IsBadJacobian(const MatrixX<T>& J) const;
+  void DoInitialize() override;
+  void DoResetStatistics() override;
+  bool DoStep(const T& dt) override;
+  void Factor(const MatrixX<T>& A);
+  VectorX<T> Solve(const VectorX<T>& rhs) const;
+  bool AttemptStep(const T& dt, VectorX<T>* xtplus, VectorX<T>* err_est);
+  bool SolveImplicitEquation(const T& t_solve, const T& gamma_h,
+                             const VectorX<T>& rhs, VectorX<T>* z,
+                             int trial = 1);
+  bool CalcMatrices(const T& t_solve, const T& gamma_h, const VectorX<T>& z,
+                    int trial);
+  MatrixX<T> CalcJacobian(const T& t, const VectorX<T>& x);
+  VectorX<T> CalcTimeDerivativesUsingContext();
+
+  // This is a pre-allocated temporary for use by integration. It stores
+  // the derivatives computed at the stage states.
+  std::unique_ptr<ContinuousState<T>> derivs_;
+
+  // A simple LU factorization is all that is needed; robustness in the solve
+  // comes naturally as h << 1. Keeping this data in the class definition
+  // serves to minimize heap allocations and deallocations.
+  Eigen::PartialPivLU<MatrixX<double>> LU_;
+
+  // A QR factorization is necessary for automatic differentiation (current
+  // Eigen requirement).
+  Eigen::HouseholderQR<MatrixX<AutoDiffXd>> QR_;
+
+  // The continuous state update vector used during Newton-Raphson.
+  std::unique_ptr<ContinuousState<T>> dx_state_;
+
+  // The last computed Jacobian matrix and the *negation* of the iteration
+  // matrix formed from it, equivalent to J * γh - I. Keeping this data in
+  // the class definition serves to minimize heap allocations and
+  // deallocations; using the negation avoids an O(n²) subtraction (see
+  // ImplicitEulerIntegrator for the original rationale).
+  MatrixX<T> J_;
+  MatrixX<T> neg_iteration_matrix_;
+
+  // Whether the last call to SolveImplicitEquation() was a failure.
+  bool last_call_failed_{false};
+
+  // Whether the iteration matrix has been factored during the current step;
+  // used to share one factorization between the two stages of a step even
+  // when reuse across steps is disabled.
+  bool factored_this_step_{false};
+
+  // If set to `false`, Jacobian matrices and iteration matrix factorizations
+  // will not be reused across steps.
+  bool reuse_{true};
+
+  // Various statistics.
+  int64_t num_jacobian_evaluations_{0};
+  int64_t num_jacobian_function_evaluations_{0};
+  int64_t num_nr_iterations_{0};
+  int64_t num_iter_factorizations_{0};
+};
+}  // namespace systems
+}  // namespace drake
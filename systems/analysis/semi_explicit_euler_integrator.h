@@ -102,6 +102,25 @@ class SemiExplicitEulerIntegrator final : public IntegratorBase<T> {
    */
   bool supports_error_estimation() const override { return false; }
 
+  /**
+   * Advances the state by exactly @p dt in one semi-explicit step without the
+   * mode checks, statistics updates, or dense output hook of the
+   * IntegratorBase stepping methods. The update inlines into the caller
+   * (this class is `final`), yielding a deterministic per-step cost for hard
+   * real-time use. Statistics other than the derivative evaluation count are
+   * not updated.
+   * @pre Initialize() has been called and @p dt is non-negative (checked by
+   *      DRAKE_ASSERT only).
+   * @sa IntegratorBase::IntegrateWithSingleFixedStep() for the checked and
+   *     instrumented equivalent.
+   */
+  void IntegrateWithSingleMinimalStep(const T& dt) {
+    DRAKE_ASSERT(this->is_initialized());
+    DRAKE_ASSERT(dt >= 0);
+    const bool success = DoStep(dt);
+    DRAKE_DEMAND(success);
+  }
+
  private:
   bool DoStep(const T& dt) override;
 
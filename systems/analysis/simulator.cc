@@ -1,7 +1,10 @@
 #include "drake/systems/analysis/simulator.h"
 
 #include <chrono>
+#include <iomanip>
 #include <limits>
+#include <sstream>
+#include <string>
 #include <thread>
 
 #include "drake/common/autodiff.h"
@@ -39,11 +42,32 @@ void Simulator<T>::ResetStatistics() {
   num_discrete_updates_ = 0;
   num_unrestricted_updates_ = 0;
   num_publishes_ = 0;
+  phase_timing_ = PhaseTiming{};
 
   initial_simtime_ = ExtractDoubleOrThrow(get_context().get_time());
   initial_realtime_ = Clock::now();
 }
 
+template <typename T>
+std::string Simulator<T>::MakePhaseTimingReport() const {
+  const PhaseTiming& timing = phase_timing_;
+  const double total = timing.unrestricted_updates_s +
+                       timing.discrete_updates_s + timing.event_timing_s +
+                       timing.continuous_integration_s + timing.publishes_s;
+  std::ostringstream report;
+  report << std::scientific << std::setprecision(3);
+  report << "Simulator phase timing (wall-clock seconds):\n";
+  report << "  unrestricted updates:   "
+         << timing.unrestricted_updates_s << "\n";
+  report << "  discrete updates:       " << timing.discrete_updates_s << "\n";
+  report << "  event timing queries:   " << timing.event_timing_s << "\n";
+  report << "  continuous integration: "
+         << timing.continuous_integration_s << "\n";
+  report << "  publishes:              " << timing.publishes_s << "\n";
+  report << "  total:                  " << total << "\n";
+  return report.str();
+}
+
 template class Simulator<double>;
 template class Simulator<AutoDiffXd>;
 
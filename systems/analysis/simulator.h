@@ -3,8 +3,11 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <functional>
 #include <limits>
+#include <map>
 #include <memory>
+#include <string>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -16,9 +19,12 @@
 #include "drake/common/drake_optional.h"
 #include "drake/common/extract_double.h"
 #include "drake/common/text_logging.h"
+#include "drake/common/tracing.h"
 #include "drake/systems/analysis/integrator_base.h"
 #include "drake/systems/analysis/runge_kutta3_integrator.h"
 #include "drake/systems/framework/context.h"
+#include "drake/systems/framework/event_collection.h"
+#include "drake/systems/framework/leaf_system.h"
 #include "drake/systems/framework/system.h"
 #include "drake/systems/framework/witness_function.h"
 
@@ -337,6 +343,92 @@ class Simulator {
   /// @see set_target_realtime_rate()
   double get_actual_realtime_rate() const;
 
+  /// Registers a function to be invoked with the %Simulator's Context at
+  /// (approximately) regular intervals of simulated time during StepTo(),
+  /// e.g. to write a binary checkpoint of the Context (see
+  /// ContextSerializer) from which a later run can resume. The function is
+  /// called at the end of the first trajectory-advancing substep whose time
+  /// reaches or exceeds each multiple of `period` beyond the time at which
+  /// stepping began, so checkpoints land on substep boundaries rather than
+  /// exact multiples. Replaces any previously registered checkpoint
+  /// function; pass a default-constructed std::function to turn
+  /// checkpointing off.
+  /// @pre `period` is positive whenever `checkpointer` is non-empty.
+  void set_periodic_checkpoint(
+      double period, std::function<void(const Context<T>&)> checkpointer) {
+    DRAKE_THROW_UNLESS(!checkpointer || period > 0.0);
+    checkpoint_period_ = period;
+    checkpointer_ = std::move(checkpointer);
+    next_checkpoint_time_ = nullopt;  // Rearmed on the next StepTo() substep.
+  }
+
+  /// Sets the capacity of the rewind snapshot ring. When `capacity` is
+  /// positive, the %Simulator records the Context's time and a copy of its
+  /// State at the start of every trajectory-advancing substep during
+  /// StepTo() — just after the updates scheduled for that time have been
+  /// applied, so each snapshot is event-complete — retaining the most recent
+  /// `capacity` snapshots; RewindBy() restores one of them. This provides in-memory recovery when, e.g., a solver produces
+  /// a bad state partway through a long run: rewind a few substeps, adjust
+  /// integrator parameters, and call StepTo() again, rather than restarting
+  /// from t = 0. A capacity of zero (the default) disables snapshotting.
+  /// Snapshot storage for each ring slot is allocated the first time the slot
+  /// is written and reused thereafter, so steady-state recording copies state
+  /// values without heap allocation. Changing the capacity discards any
+  /// existing snapshots.
+  /// @throws std::logic_error if `capacity` is negative.
+  void set_rewind_snapshot_capacity(int capacity) {
+    DRAKE_THROW_UNLESS(capacity >= 0);
+    snapshot_ring_.clear();
+    snapshot_ring_.resize(capacity);
+    snapshot_capacity_ = capacity;
+    snapshot_next_ = 0;
+    snapshot_count_ = 0;
+  }
+
+  /// Gets the capacity of the rewind snapshot ring (zero if snapshotting is
+  /// disabled).
+  /// @see set_rewind_snapshot_capacity()
+  int get_rewind_snapshot_capacity() const { return snapshot_capacity_; }
+
+  /// Gets the number of substep snapshots currently available to RewindBy().
+  int get_num_rewind_snapshots() const { return snapshot_count_; }
+
+  /// Rewinds the simulation by `num_substeps` trajectory-advancing substeps,
+  /// restoring the Context's time and state from the corresponding snapshot.
+  /// RewindBy(1) restores the snapshot taken at the start of the most recent
+  /// substep; larger arguments reach correspondingly further back. Snapshots
+  /// newer than the restored one are discarded; the restored snapshot remains
+  /// available, so a failed retry can rewind to the same point again. The
+  /// active witness functions will be redetermined when stepping resumes.
+  /// The caller will typically alter integrator parameters (e.g., shrink the
+  /// maximum step size or tighten the accuracy) before calling StepTo() to
+  /// retry the rewound interval.
+  /// @throws std::logic_error if `num_substeps` is non-positive or exceeds
+  ///         get_num_rewind_snapshots().
+  /// @see set_rewind_snapshot_capacity()
+  void RewindBy(int num_substeps) {
+    DRAKE_THROW_UNLESS(num_substeps > 0);
+    if (num_substeps > snapshot_count_) {
+      throw std::logic_error(
+          "RewindBy(): requested rewind of " + std::to_string(num_substeps) +
+          " substep(s) but only " + std::to_string(snapshot_count_) +
+          " snapshot(s) are available.");
+    }
+    const int slot = (snapshot_next_ + snapshot_capacity_ - num_substeps) %
+        snapshot_capacity_;
+    const StateSnapshot& snapshot = snapshot_ring_[slot];
+    context_->set_time(snapshot.time);
+    context_->get_mutable_state().CopyFrom(*snapshot.state);
+    // Discard the snapshots newer than the restored one and keep the rest.
+    snapshot_next_ = (slot + 1) % snapshot_capacity_;
+    snapshot_count_ -= (num_substeps - 1);
+    // The restored state may lie on the other side of a zero crossing.
+    redetermine_active_witnesses_ = true;
+    // Any timed event left pending by the interrupted run was scheduled for
+    // a now-abandoned future time; resuming recomputes the schedule.
+    timed_or_witnessed_event_triggered_ = false;
+  }
+
   /// Sets whether the simulation should trigger a forced-Publish event on the
   /// System under simulation at the end of every trajectory-advancing substep.
   /// Specifically, that means the System::Publish() event dispatcher will be
@@ -367,6 +459,39 @@ class Simulator {
   /// enabled. By default, returns false.
   bool get_publish_every_time_step() const { return publish_every_time_step_; }
 
+  /// Sets whether the simulator should precompute the system's periodic event
+  /// schedule during Initialize() instead of calling
+  /// System::CalcNextUpdateTime() on every trajectory-advancing substep. When
+  /// enabled, the next timed-event time is obtained by a cheap arithmetic
+  /// pass over the distinct (period, offset) phases reported by
+  /// System::GetPeriodicEvents(), and the event collection for each
+  /// combination of simultaneously-firing phases is built once and reused,
+  /// so steady-state stepping performs no per-substep event-collection
+  /// reconstruction. The phases act as rate groups for a multi-rate diagram
+  /// (e.g. a 1 kHz controller alongside 100 Hz and 30 Hz subsystems): each
+  /// group's next tick is tracked incrementally and its sample-time
+  /// arithmetic and event collection are revisited only when that tick
+  /// arrives, so slow groups contribute no meaningful per-substep cost to
+  /// the fast loop. Witness-triggered events are unaffected and continue to
+  /// use the dynamic path.
+  ///
+  /// @warning This option assumes that all of the system's timed events are
+  /// the periodic events reported by System::GetPeriodicEvents(). Systems
+  /// that schedule non-periodic timers by overriding
+  /// System::DoCalcNextUpdateTime() must not enable it; a mismatch between
+  /// the precomputed schedule and the system's reported update time is
+  /// detected and reported by throwing std::logic_error.
+  void set_use_periodic_event_schedule(bool enable) {
+    use_periodic_event_schedule_ = enable;
+    initialization_done_ = false;
+  }
+
+  /// Returns true if the set_use_periodic_event_schedule() option has been
+  /// enabled. By default, returns false.
+  bool get_use_periodic_event_schedule() const {
+    return use_periodic_event_schedule_;
+  }
+
   /// Returns a const reference to the internally-maintained Context holding the
   /// most recent step in the trajectory. This is suitable for publishing or
   /// extracting information about this trajectory step. Do not call this method
@@ -417,6 +542,49 @@ class Simulator {
   /// have post construction or immediately after `Initialize()`.
   void ResetStatistics();
 
+  /// Wall-clock time (in seconds) accumulated per phase of the StepTo()
+  /// substep loop since the last Initialize() or ResetStatistics() call.
+  /// All fields remain zero unless profiling has been enabled (see
+  /// set_profiling_enabled()).
+  struct PhaseTiming {
+    /// Time spent handling unrestricted update events.
+    double unrestricted_updates_s{0.};
+    /// Time spent handling discrete update events.
+    double discrete_updates_s{0.};
+    /// Time spent querying the system for its next timed event.
+    double event_timing_s{0.};
+    /// Time spent advancing the continuous state, including derivative
+    /// evaluations and witness function isolation.
+    double continuous_integration_s{0.};
+    /// Time spent handling publish events, including any per-step forced
+    /// publishes (see set_publish_every_time_step()).
+    double publishes_s{0.};
+  };
+
+  /// Sets whether the simulator accumulates the wall-clock time spent in
+  /// each phase of the StepTo() substep loop (disabled by default). The
+  /// existing counters (get_num_steps_taken() and friends) record how often
+  /// each phase ran but not what it cost; per-phase timings tell where the
+  /// wall-clock time of a slow run actually went. The overhead when enabled
+  /// is a pair of monotonic clock reads per phase per substep.
+  /// @see get_phase_timing(), MakePhaseTimingReport()
+  void set_profiling_enabled(bool enabled) { profiling_enabled_ = enabled; }
+
+  /// Gets whether per-phase profiling is enabled.
+  /// @see set_profiling_enabled()
+  bool get_profiling_enabled() const { return profiling_enabled_; }
+
+  /// Gets the per-phase wall-clock timings accumulated since the last
+  /// Initialize() or ResetStatistics() call.
+  /// @see set_profiling_enabled()
+  const PhaseTiming& get_phase_timing() const { return phase_timing_; }
+
+  /// Returns a human-readable, multi-line report of the per-phase
+  /// wall-clock timings accumulated since the last Initialize() or
+  /// ResetStatistics() call, suitable for logging.
+  /// @see set_profiling_enabled()
+  std::string MakePhaseTimingReport() const;
+
   /// Gets the number of publishes made since the last Initialize() or
   /// ResetStatistics() call.
   int64_t get_num_publishes() const { return num_publishes_; }
@@ -518,6 +686,15 @@ class Simulator {
 
   void HandlePublish(const EventCollection<PublishEvent<T>>& events);
 
+  // Records the distinct periodic phases reported by
+  // System::GetPeriodicEvents() (see set_use_periodic_event_schedule()).
+  void BuildPeriodicEventSchedule();
+
+  // Returns the time of the next timed event and fills `events` with the
+  // events scheduled then, consulting the precomputed periodic schedule when
+  // it is enabled and falling back to System::CalcNextUpdateTime() otherwise.
+  T CalcNextTimedEventTime(CompositeEventCollection<T>* events);
+
   bool IntegrateContinuousState(const T& next_publish_dt,
                                 const T& next_update_dt,
                                 const T& time_of_next_timed_event,
@@ -540,6 +717,24 @@ class Simulator {
   // enough to let real time catch up (approximately).
   void PauseIfTooFast() const;
 
+  // An RAII helper that, when armed, adds the wall-clock duration of its
+  // scope to the given accumulator (in seconds). Disarmed instances read no
+  // clocks. @see set_profiling_enabled()
+  class PhaseTimer {
+   public:
+    PhaseTimer(bool armed, double* accumulator)
+        : accumulator_(armed ? accumulator : nullptr) {
+      if (accumulator_ != nullptr) start_ = Clock::now();
+    }
+    ~PhaseTimer() {
+      if (accumulator_ != nullptr)
+        *accumulator_ += Duration(Clock::now() - start_).count();
+    }
+   private:
+    double* accumulator_{nullptr};
+    TimePoint start_;
+  };
+
   // A pointer to the integrator.
   std::unique_ptr<IntegratorBase<T>> integrator_;
 
@@ -566,9 +761,32 @@ class Simulator {
   std::vector<const WitnessFunction<T>*> triggered_witnesses_;
   VectorX<T> w0_, wf_;
 
+  // Scratch for the continuous state saved at the start of each substep.
+  VectorX<T> x0_;
+
   // Slow down to this rate if possible (user settable).
   double target_realtime_rate_{0.};
 
+  // Periodic checkpointing; see set_periodic_checkpoint(). The next
+  // checkpoint time is armed lazily by the StepTo() substep loop.
+  double checkpoint_period_{0.};
+  std::function<void(const Context<T>&)> checkpointer_;
+  optional<T> next_checkpoint_time_;
+
+  // One slot of the rewind snapshot ring; see set_rewind_snapshot_capacity().
+  // The state pointer is allocated on first use and reused thereafter.
+  struct StateSnapshot {
+    T time{0};
+    std::unique_ptr<State<T>> state;
+  };
+
+  // Bounded ring of post-substep snapshots for RewindBy(). snapshot_next_ is
+  // the index of the next slot to write.
+  std::vector<StateSnapshot> snapshot_ring_;
+  int snapshot_capacity_{0};
+  int snapshot_next_{0};
+  int snapshot_count_{0};
+
   bool publish_every_time_step_{false};
 
   bool publish_at_initialization_{false};
@@ -577,6 +795,12 @@ class Simulator {
   double initial_simtime_{nan()};  // Simulated time at start of period.
   TimePoint initial_realtime_;     // Real time at start of period.
 
+  // Whether StepTo() accumulates per-phase wall-clock timings.
+  bool profiling_enabled_{false};
+
+  // Per-phase wall-clock timings since the last statistics reset.
+  PhaseTiming phase_timing_;
+
   // The number of discrete updates since the last statistics reset.
   int64_t num_discrete_updates_{0};
 
@@ -612,6 +836,11 @@ class Simulator {
   // StepTo(). This collection is constructed within Initialize().
   std::unique_ptr<CompositeEventCollection<T>> witnessed_events_;
 
+  // Scratch collection into which the per-step, timed, and witnessed events
+  // are merged during each StepTo() substep. Constructed within Initialize()
+  // so that StepTo() itself never touches the heap.
+  std::unique_ptr<CompositeEventCollection<T>> merged_events_;
+
   // Indicates when a timed or witnessed event needs to be handled on the next
   // call to StepTo().
   bool timed_or_witnessed_event_triggered_{false};
@@ -633,6 +862,30 @@ class Simulator {
   // Mapping of witness functions to pre-allocated events.
   std::unordered_map<const WitnessFunction<T>*, std::unique_ptr<Event<T>>>
       witness_function_events_;
+
+  // Whether set_use_periodic_event_schedule() has been enabled.
+  bool use_periodic_event_schedule_{false};
+
+  // The distinct (period, offset) phases of the system's periodic events,
+  // recorded by BuildPeriodicEventSchedule() during Initialize().
+  std::vector<PeriodicEventData> periodic_event_phases_;
+
+  // Timed-event collections captured once per combination of simultaneously
+  // firing phases (keyed by the sorted indices into periodic_event_phases_)
+  // and reused on every subsequent firing of the same combination.
+  std::map<std::vector<int>, std::unique_ptr<CompositeEventCollection<T>>>
+      periodic_event_collections_;
+
+  // The next tick time of each rate group in periodic_event_phases_,
+  // maintained incrementally by CalcNextTimedEventTime(): an entry is
+  // recomputed only once its tick has been reached, so idle groups cost a
+  // single comparison per query.
+  std::vector<T> periodic_phase_next_times_;
+
+  // The time at which periodic_phase_next_times_ was last maintained. A
+  // query at an earlier time (e.g. after RewindBy()) invalidates the whole
+  // table, since ticks between the two times would otherwise be skipped.
+  T periodic_schedule_time_{-std::numeric_limits<double>::infinity()};
 };
 
 template <typename T>
@@ -761,6 +1014,9 @@ void Simulator<T>::Initialize() {
   timed_events_ = system_.AllocateCompositeEventCollection();
   DRAKE_DEMAND(timed_events_ != nullptr);
 
+  // Precompute the periodic event schedule, if enabled.
+  if (use_periodic_event_schedule_) BuildPeriodicEventSchedule();
+
   // Ensure that CalcNextUpdateTime() can return the current time by perturbing
   // current time as slightly toward negative infinity as we can allow.
   const T current_time = context_->get_time();
@@ -769,8 +1025,7 @@ void Simulator<T>::Initialize() {
   context_->set_time(slightly_before_current_time);
 
   // Get the next timed event.
-  next_timed_event_time_ =
-      system_.CalcNextUpdateTime(*context_, timed_events_.get());
+  next_timed_event_time_ = CalcNextTimedEventTime(timed_events_.get());
 
   // Reset the context time.
   context_->set_time(current_time);
@@ -782,6 +1037,9 @@ void Simulator<T>::Initialize() {
   // Allocate the witness function collection.
   witnessed_events_ = system_.AllocateCompositeEventCollection();
 
+  // Allocate the scratch merged-event collection used by StepTo().
+  merged_events_ = system_.AllocateCompositeEventCollection();
+
   // Do any publishes last. Merge the initialization events with per-step
   // events and current_time timed events (if any). We expect all initialization
   // events to precede any per-step or timed events in the merged collection.
@@ -804,6 +1062,83 @@ void Simulator<T>::Initialize() {
   initialization_done_ = true;
 }
 
+template <typename T>
+void Simulator<T>::BuildPeriodicEventSchedule() {
+  periodic_event_phases_.clear();
+  periodic_event_collections_.clear();
+  for (const auto& map_entry : system_.GetPeriodicEvents()) {
+    periodic_event_phases_.push_back(map_entry.first);
+  }
+
+  // Force a full refresh of the tick table on the first scheduling query.
+  periodic_phase_next_times_.assign(
+      periodic_event_phases_.size(),
+      -std::numeric_limits<double>::infinity());
+  periodic_schedule_time_ = -std::numeric_limits<double>::infinity();
+}
+
+template <typename T>
+T Simulator<T>::CalcNextTimedEventTime(CompositeEventCollection<T>* events) {
+  if (!use_periodic_event_schedule_) {
+    return system_.CalcNextUpdateTime(*context_, events);
+  }
+
+  // Maintain the per-rate-group tick table incrementally: a group's next
+  // tick is recomputed only once time has reached it (i.e., the tick just
+  // fired), or when time has moved backward (e.g. after RewindBy()), which
+  // stales the whole table. Groups whose ticks are still pending cost one
+  // comparison apiece, so slow rate groups add essentially nothing to the
+  // per-substep cost of a fast loop. GetNextSampleTime() returns a time
+  // strictly greater than its argument, so an entry computed at an earlier
+  // time remains the correct next tick until time reaches it.
+  const T current_time = context_->get_time();
+  const int num_phases = static_cast<int>(periodic_event_phases_.size());
+  const bool table_stale = current_time < periodic_schedule_time_;
+  for (int i = 0; i < num_phases; ++i) {
+    if (table_stale || periodic_phase_next_times_[i] <= current_time) {
+      periodic_phase_next_times_[i] = leaf_system_detail::GetNextSampleTime(
+          periodic_event_phases_[i], current_time);
+    }
+  }
+  periodic_schedule_time_ = current_time;
+
+  // Find the minimum pending tick and the set of rate groups firing then.
+  T min_time = std::numeric_limits<double>::infinity();
+  std::vector<int> firing;
+  for (int i = 0; i < num_phases; ++i) {
+    const T& t = periodic_phase_next_times_[i];
+    if (t < min_time) {
+      min_time = t;
+      firing = {i};
+    } else if (t == min_time) {
+      firing.push_back(i);
+    }
+  }
+  if (firing.empty()) {
+    events->Clear();
+    return min_time;  // No periodic events; next update time is infinity.
+  }
+
+  std::unique_ptr<CompositeEventCollection<T>>& cached =
+      periodic_event_collections_[firing];
+  if (cached == nullptr) {
+    // First firing of this combination of phases: build its event collection
+    // once via the dynamic path and cache it for reuse.
+    const T reported_time = system_.CalcNextUpdateTime(*context_, events);
+    if (reported_time != min_time) {
+      throw std::logic_error(
+          "Simulator: the system reported a next update time that differs "
+          "from the precomputed periodic event schedule; this system is not "
+          "compatible with set_use_periodic_event_schedule().");
+    }
+    cached = system_.AllocateCompositeEventCollection();
+    cached->SetFrom(*events);
+    return min_time;
+  }
+  events->SetFrom(*cached);
+  return min_time;
+}
+
 // Processes UnrestrictedUpdateEvent events.
 template <typename T>
 void Simulator<T>::HandleUnrestrictedUpdate(
@@ -857,24 +1192,24 @@ void Simulator<T>::HandlePublish(
 //                 ways, like calling StepTo(get_context().get_time()).
 template <typename T>
 void Simulator<T>::StepTo(const T& boundary_time) {
+  DRAKE_TRACEPOINT("Simulator::StepTo");
   if (!initialization_done_) Initialize();
 
   DRAKE_THROW_UNLESS(boundary_time >= context_->get_time());
 
   // Integrate until desired interval has completed.
-  auto merged_events = system_.AllocateCompositeEventCollection();
   DRAKE_DEMAND(timed_events_ != nullptr);
   DRAKE_DEMAND(witnessed_events_ != nullptr);
-  DRAKE_DEMAND(merged_events != nullptr);
+  DRAKE_DEMAND(merged_events_ != nullptr);
 
   // Clear events for the loop iteration.
-  merged_events->Clear();
-  merged_events->Merge(*per_step_events_);
+  merged_events_->Clear();
+  merged_events_->Merge(*per_step_events_);
 
   // Merge in timed and witnessed events, if necessary.
   if (timed_or_witnessed_event_triggered_) {
-    merged_events->Merge(*timed_events_);
-    merged_events->Merge(*witnessed_events_);
+    merged_events_->Merge(*timed_events_);
+    merged_events_->Merge(*witnessed_events_);
   }
 
   while (true) {
@@ -890,13 +1225,41 @@ void Simulator<T>::StepTo(const T& boundary_time) {
     // publish. The "timed" actions happen before the "per step" ones.
 
     // Do unrestricted updates first.
-    HandleUnrestrictedUpdate(merged_events->get_unrestricted_update_events());
+    {
+      DRAKE_TRACEPOINT("Simulator::UnrestrictedUpdates");
+      PhaseTimer timer(profiling_enabled_,
+                       &phase_timing_.unrestricted_updates_s);
+      HandleUnrestrictedUpdate(
+          merged_events_->get_unrestricted_update_events());
+    }
     // Do restricted (discrete variable) updates next.
-    HandleDiscreteUpdate(merged_events->get_discrete_update_events());
+    {
+      DRAKE_TRACEPOINT("Simulator::DiscreteUpdates");
+      PhaseTimer timer(profiling_enabled_, &phase_timing_.discrete_updates_s);
+      HandleDiscreteUpdate(merged_events_->get_discrete_update_events());
+    }
+
+    // Record a rewind snapshot now that this substep's scheduled updates
+    // have been applied: the captured state is event-complete, so resuming
+    // from it neither re-fires a handled update nor loses a pending one.
+    if (snapshot_capacity_ > 0) {
+      StateSnapshot& slot = snapshot_ring_[snapshot_next_];
+      if (!slot.state) {
+        slot.state = context_->CloneState();
+      } else {
+        slot.state->CopyFrom(context_->get_state());
+      }
+      slot.time = step_start_time;
+      snapshot_next_ = (snapshot_next_ + 1) % snapshot_capacity_;
+      if (snapshot_count_ < snapshot_capacity_) ++snapshot_count_;
+    }
 
     // How far can we go before we have to handle timed events?
-    next_timed_event_time_ =
-        system_.CalcNextUpdateTime(*context_, timed_events_.get());
+    {
+      DRAKE_TRACEPOINT("Simulator::CalcNextTimedEventTime");
+      PhaseTimer timer(profiling_enabled_, &phase_timing_.event_timing_s);
+      next_timed_event_time_ = CalcNextTimedEventTime(timed_events_.get());
+    }
     DRAKE_DEMAND(next_timed_event_time_ >= step_start_time);
 
     // Determine whether the set of events requested by the System at
@@ -916,12 +1279,17 @@ void Simulator<T>::StepTo(const T& boundary_time) {
     const T boundary_dt = boundary_time - step_start_time;
 
     // Integrate the continuous state forward in time.
-    timed_or_witnessed_event_triggered_ = IntegrateContinuousState(
-        next_publish_dt,
-        next_update_dt,
-        next_timed_event_time_,
-        boundary_dt,
-        witnessed_events_.get());
+    {
+      DRAKE_TRACEPOINT("Simulator::IntegrateContinuousState");
+      PhaseTimer timer(profiling_enabled_,
+                       &phase_timing_.continuous_integration_s);
+      timed_or_witnessed_event_triggered_ = IntegrateContinuousState(
+          next_publish_dt,
+          next_update_dt,
+          next_timed_event_time_,
+          boundary_dt,
+          witnessed_events_.get());
+    }
 
     // Update the number of simulation substeps taken.
     ++num_substeps_taken_;
@@ -929,25 +1297,42 @@ void Simulator<T>::StepTo(const T& boundary_time) {
     // TODO(sherm1) Constraint projection goes here.
 
     // Clear events for the next loop iteration.
-    merged_events->Clear();
+    merged_events_->Clear();
 
     // Merge in per-step events.
-    merged_events->Merge(*per_step_events_);
+    merged_events_->Merge(*per_step_events_);
 
     // Only merge timed / witnessed events in if an event was triggered.
     if (timed_or_witnessed_event_triggered_) {
-      merged_events->Merge(*timed_events_);
-      merged_events->Merge(*witnessed_events_);
+      merged_events_->Merge(*timed_events_);
+      merged_events_->Merge(*witnessed_events_);
     }
 
     // Handle any publish events at the end of the loop.
-    HandlePublish(merged_events->get_publish_events());
+    {
+      DRAKE_TRACEPOINT("Simulator::Publishes");
+      PhaseTimer timer(profiling_enabled_, &phase_timing_.publishes_s);
+      HandlePublish(merged_events_->get_publish_events());
+
+      // TODO(siyuan): transfer per step publish entirely to individual
+      // systems. Allow System a chance to produce some output.
+      if (get_publish_every_time_step()) {
+        system_.Publish(*context_);
+        ++num_publishes_;
+      }
+    }
 
-    // TODO(siyuan): transfer per step publish entirely to individual systems.
-    // Allow System a chance to produce some output.
-    if (get_publish_every_time_step()) {
-      system_.Publish(*context_);
-      ++num_publishes_;
+    // Write a checkpoint if we have reached the next checkpoint time. The
+    // schedule is armed lazily so that the first checkpoint lands one period
+    // past the time at which stepping began.
+    if (checkpointer_) {
+      if (!next_checkpoint_time_)
+        next_checkpoint_time_ = step_start_time + checkpoint_period_;
+      if (context_->get_time() >= *next_checkpoint_time_) {
+        checkpointer_(*context_);
+        while (context_->get_time() >= *next_checkpoint_time_)
+          *next_checkpoint_time_ += checkpoint_period_;
+      }
     }
 
     // Break out of the loop after timed and witnessed events are merged in
@@ -1039,21 +1424,32 @@ void Simulator<T>::IsolateWitnessTriggers(
   // Will need to alter the context repeatedly.
   Context<T>& context = get_mutable_context();
 
-  // Get the witness isolation interval length.
-  const optional<T> witness_iso_len = GetCurrentWitnessTimeIsolation();
-
   // Check whether witness functions *are* to be isolated. If not, the witnesses
   // that were triggered on entry will be the set that is returned.
-  if (!witness_iso_len)
+  if (!GetCurrentWitnessTimeIsolation())
     return;
 
-  // Mini function for integrating the system forward in time from t0.
+  // Reset the context to the start of the interval and get the witness
+  // isolation interval length there. The isolation window is clamped by the
+  // achievable time resolution, which is finest at the left end of the
+  // interval; the bracketing sweep below can usually isolate to that
+  // resolution (and terminates early if the bracket stops shrinking).
+  context.set_time(t0);
+  context.get_mutable_continuous_state().SetFromVector(x0);
+  const optional<T> witness_iso_len = GetCurrentWitnessTimeIsolation();
+
+  // Mini function for integrating the system forward in time. When the
+  // desired time lies ahead of the context time, integration continues from
+  // the current (already computed) state; the more expensive restart from
+  // (t0, x0) is needed only when a probe moves backward in time.
   std::function<void(const T&)> integrate_forward =
       [&t0, &x0, &context, this](const T& t_des) {
     const T inf = std::numeric_limits<double>::infinity();
-    context.set_time(t0);
-    context.get_mutable_continuous_state().SetFromVector(x0);
-    T t_remaining = t_des - t0;
+    if (context.get_time() > t_des) {
+      context.set_time(t0);
+      context.get_mutable_continuous_state().SetFromVector(x0);
+    }
+    T t_remaining = t_des - context.get_time();
     while (t_remaining > 0) {
       integrator_->IntegrateAtMost(inf, inf, t_remaining);
       t_remaining = t_des - context.get_time();
@@ -1064,45 +1460,69 @@ void Simulator<T>::IsolateWitnessTriggers(
   SPDLOG_DEBUG(drake::log(),
       "Isolating witness functions using isolation window of {} over [{}, {}]",
       witness_iso_len.value(), t0, tf);
+  // `wa` holds the witness function values at the left end of the bracketing
+  // interval [a, b]; all witness functions are evaluated in a single pass at
+  // each probe, so the system evaluations are shared across witnesses.
+  VectorX<T> wa = w0;
   VectorX<T> wc(witnesses.size());
   T a = t0;
   T b = tf;
   do {
-    // Compute the midpoint and evaluate the witness functions at it.
+    // Compute the midpoint and evaluate the witness functions at it. The
+    // bracket is updated with the time the integrator actually reached (which
+    // can differ from the desired midpoint by roundoff); using the requested
+    // time instead would let the bracket drift from the states at which the
+    // witnesses were actually evaluated.
     T c = (a + b) / 2;
     SPDLOG_DEBUG(drake::log(), "Integrating forward to time {}", c);
     integrate_forward(c);
+    c = context.get_time();
 
-    // See whether any witness functions trigger.
+    // See whether any witness functions trigger over [a, c].
     bool trigger = false;
     for (size_t i = 0; i < witnesses.size(); ++i) {
       wc[i] = get_system().CalcWitnessValue(context, *witnesses[i]);
-      if (witnesses[i]->should_trigger(w0[i], wc[i]))
+      if (witnesses[i]->should_trigger(wa[i], wc[i]))
         trigger = true;
     }
 
-    // If no witness function triggered, we can continue integrating forward.
+    // If the midpoint made no floating point progress, the bracket has been
+    // narrowed to the limits of time resolution; no further refinement is
+    // possible.
+    if (c <= a || c >= b)
+      break;
+
+    // If no witness function triggered over [a, c], the trigger detected over
+    // [t0, tf] must lie in (c, b]: discard the left half-interval and keep
+    // bracketing within this call. This does not violate Simulator's contract
+    // to only integrate once over the interval [a, c] before per-step events
+    // are handled (we know no other events are to be handled between t0 and
+    // tf), and it avoids restarting the sweep- and re-integrating from t0-
+    // on a subsequent substep.
     if (!trigger) {
-      // NOTE: Since we're always checking that the sign changes over [t0,c],
-      // it's also feasible to replace the two lines below with "a = c" without
-      // violating Simulator's contract to only integrate once over the interval
-      // [a, c], for some c <= b before per-step events are handled (i.e., it's
-      // unacceptable to take two steps of (c - a)/2 without processing per-step
-      // events first). That change would avoid handling unnecessary per-step
-      // events- we know no other events are to be handled between t0 and tf-
-      // but the current logic appears easier to follow.
-      SPDLOG_DEBUG(drake::log(), "No witness functions triggered up to {}", c);
-      triggered_witnesses->clear();
-      return;
+      SPDLOG_DEBUG(drake::log(), "No witness functions triggered over [{}, {}]",
+                   a, c);
+      a = c;
+      wa = wc;
     } else {
       b = c;
     }
   } while (b - a > witness_iso_len.value());
 
-  // Determine the set of triggered witnesses.
+  // Leave the context at the right end of the bracket (the reported trigger
+  // time), where all witnesses that changed sign over [a, b] are guaranteed
+  // to have triggered; at least one witness crossing is bracketed, so the
+  // final set is non-empty.
+  if (context.get_time() != b) {
+    integrate_forward(b);
+    for (size_t i = 0; i < witnesses.size(); ++i)
+      wc[i] = get_system().CalcWitnessValue(context, *witnesses[i]);
+  }
+
+  // Determine the set of triggered witnesses from the final bracket.
   triggered_witnesses->clear();
   for (size_t i = 0; i < witnesses.size(); ++i) {
-    if (witnesses[i]->should_trigger(w0[i], wc[i]))
+    if (witnesses[i]->should_trigger(wa[i], wc[i]))
       triggered_witnesses->push_back(witnesses[i]);
   }
 }
@@ -1129,10 +1549,15 @@ bool Simulator<T>::IntegrateContinuousState(
   DRAKE_ASSERT(events);
   events->Clear();
 
-  // Save the time and current state.
+  // Save the time and current state. The state is copied into preallocated
+  // scratch (resize is a no-op after the first substep) since this code runs
+  // on every substep and must not touch the heap.
   const Context<T>& context = get_context();
   const T t0 = context.get_time();
-  const VectorX<T> x0 = context.get_continuous_state().CopyToVector();
+  const ContinuousState<T>& continuous_state = context.get_continuous_state();
+  x0_.resize(continuous_state.size());
+  continuous_state.get_vector().CopyToPreallocatedVector(x0_);
+  const VectorX<T>& x0 = x0_;
 
   // Note: this function is only called in one place and under the conditions
   // that (1) t0 + next_update_dt equals *either* time_of_next_timed_event *or*
@@ -118,6 +118,43 @@ GTEST_TEST(IntegratorTest, MagDisparity) {
   integrator.IntegrateWithSingleFixedStep(dt);
 }
 
+// Verifies that the minimal stepping fast path advances time and state
+// identically to the checked fixed-step method, while skipping the
+// statistics updates.
+GTEST_TEST(IntegratorTest, MinimalStepMatchesFixedStep) {
+  const double spring_k = 300.0;  // N/m
+  const double mass = 2.0;      // kg
+  const double dt = 1e-3;
+  const int n_steps = 100;
+
+  SpringMassSystem<double> spring_mass(spring_k, mass, 0.);
+  auto context_fixed = spring_mass.CreateDefaultContext();
+  auto context_minimal = spring_mass.CreateDefaultContext();
+
+  ExplicitEulerIntegrator<double> fixed(spring_mass, dt, context_fixed.get());
+  ExplicitEulerIntegrator<double> minimal(
+      spring_mass, dt, context_minimal.get());
+  fixed.Initialize();
+  minimal.Initialize();
+
+  for (int i = 0; i < n_steps; ++i) {
+    fixed.IntegrateWithSingleFixedStep(dt);
+    minimal.IntegrateWithSingleMinimalStep(dt);
+  }
+
+  // Both contexts must be bitwise identical.
+  EXPECT_EQ(context_fixed->get_time(), context_minimal->get_time());
+  EXPECT_EQ(context_fixed->get_continuous_state_vector().CopyToVector(),
+            context_minimal->get_continuous_state_vector().CopyToVector());
+
+  // The fast path does not charge step statistics (only derivative
+  // evaluations are counted).
+  EXPECT_EQ(fixed.get_num_steps_taken(), n_steps);
+  EXPECT_EQ(minimal.get_num_steps_taken(), 0);
+  EXPECT_EQ(minimal.get_num_derivative_evaluations(),
+            fixed.get_num_derivative_evaluations());
+}
+
 // Try a purely continuous system with no sampling.
 // d^2x/dt^2 = -kx/m
 // solution to this ODE: x(t) = c1*cos(omega*t) + c2*sin(omega*t)
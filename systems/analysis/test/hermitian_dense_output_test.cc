@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/eigen_types.h"
+#include "drake/common/temp_directory.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/common/trajectories/piecewise_polynomial.h"
@@ -334,6 +335,77 @@ TYPED_TEST(HermitianDenseOutputTest, CorrectEvaluation) {
   }
 }
 
+// Checks that a dense output streamed to disk behaves exactly as an
+// in-memory one, and enforces its mode-switching preconditions.
+GTEST_TEST(HermitianDenseOutputStreamingTest, CorrectEvaluation) {
+  const double kInitialTime{0.0};
+  const double kMidTime{0.5};
+  const double kFinalTime{1.0};
+  const MatrixX<double> kInitialState{
+    (MatrixX<double>(3, 1) << 0., 0., 0.).finished()};
+  const MatrixX<double> kMidState{
+    (MatrixX<double>(3, 1) << 0.5, 5., 50.).finished()};
+  const MatrixX<double> kFinalState{
+    (MatrixX<double>(3, 1) << 1., 10., 100.).finished()};
+  const MatrixX<double> kInitialStateDerivative{
+    (MatrixX<double>(3, 1) << 0., 1., 0.).finished()};
+  const MatrixX<double> kMidStateDerivative{
+    (MatrixX<double>(3, 1) << 0.5, 0.5, 0.5).finished()};
+  const MatrixX<double> kFinalStateDerivative{
+    (MatrixX<double>(3, 1) << 1., 0., 1.).finished()};
+
+  // Builds the reference, in-memory dense output and its streamed twin.
+  HermitianDenseOutput<double> dense_output;
+  HermitianDenseOutput<double> streamed_output;
+  const std::string file_path =
+      temp_directory() + "/hermitian_dense_output_test.bin";
+  streamed_output.StartStreaming(file_path);
+  EXPECT_TRUE(streamed_output.is_streaming());
+  EXPECT_FALSE(dense_output.is_streaming());
+
+  HermitianDenseOutput<double>::IntegrationStep first_step(
+      kInitialTime, kInitialState, kInitialStateDerivative);
+  first_step.Extend(kMidTime, kMidState, kMidStateDerivative);
+  HermitianDenseOutput<double>::IntegrationStep second_step(
+      kMidTime, kMidState, kMidStateDerivative);
+  second_step.Extend(kFinalTime, kFinalState, kFinalStateDerivative);
+
+  dense_output.Update(first_step);
+  dense_output.Update(second_step);
+  dense_output.Consolidate();
+
+  // Consolidates the streamed output in two batches to exercise appending
+  // to a non-empty streaming file.
+  streamed_output.Update(first_step);
+  streamed_output.Consolidate();
+  streamed_output.Update(second_step);
+  streamed_output.Consolidate();
+
+  EXPECT_FALSE(streamed_output.is_empty());
+  EXPECT_EQ(streamed_output.size(), dense_output.size());
+  EXPECT_EQ(streamed_output.start_time(), dense_output.start_time());
+  EXPECT_EQ(streamed_output.end_time(), dense_output.end_time());
+
+  const double kAccuracy{1e-12};
+  const double kTimeStep{0.03};
+  for (double t = kInitialTime; t <= kFinalTime; t += kTimeStep) {
+    EXPECT_TRUE(CompareMatrices(streamed_output.Evaluate(t),
+                                dense_output.Evaluate(t), kAccuracy));
+    for (int n = 0; n < dense_output.size(); ++n) {
+      EXPECT_NEAR(streamed_output.EvaluateNth(t, n),
+                  dense_output.EvaluateNth(t, n), kAccuracy);
+    }
+  }
+
+  // Streaming cannot be enabled twice nor on a non-empty output.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      streamed_output.StartStreaming(file_path), std::logic_error,
+      "Streaming has already been started.");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dense_output.StartStreaming(file_path), std::logic_error,
+      "Streaming must be started on an empty dense output.");
+}
+
 }  // namespace
 }  // namespace analysis
 }  // namespace systems
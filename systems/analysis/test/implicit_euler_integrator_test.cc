@@ -1,5 +1,8 @@
 #include "drake/systems/analysis/implicit_euler_integrator.h"
 
+#include <array>
+#include <cmath>
+
 #include <gtest/gtest.h>
 
 #include "drake/systems/analysis/test_utilities/discontinuous_spring_mass_damper_system.h"
@@ -113,6 +116,166 @@ GTEST_TEST(ImplicitEulerIntegratorTest, Robertson) {
   EXPECT_NEAR(state.GetAtIndex(2), sol(2), tol);
 }
 
+/// System with two uncoupled exponentially decaying states, giving a diagonal
+/// Jacobian so that a single perturbed derivative evaluation recovers every
+/// column when the sparsity pattern is declared.
+class DecoupledDecaySystem final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DecoupledDecaySystem)
+
+  DecoupledDecaySystem() { this->DeclareContinuousState(2); }
+
+ protected:
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const override {
+    const VectorBase<double>& x = context.get_continuous_state_vector();
+    derivatives->get_mutable_vector().SetAtIndex(0, -x.GetAtIndex(0));
+    derivatives->get_mutable_vector().SetAtIndex(1, -10.0 * x.GetAtIndex(1));
+  }
+};
+
+// Tests that a declared Jacobian sparsity pattern reduces the number of
+// derivative evaluations spent forming finite difference Jacobian matrices
+// without changing the computed solution.
+GTEST_TEST(ImplicitEulerIntegratorTest, JacobianSparsityPattern) {
+  DecoupledDecaySystem decay;
+  const double t_final = 1.0;
+  const double tol = 1e-2;
+  std::array<int64_t, 2> jacobian_function_evaluations = {{0, 0}};
+  std::array<Eigen::Vector2d, 2> solutions;
+
+  // Pass 0 differences the dense way; pass 1 declares the diagonal pattern.
+  for (int pass = 0; pass < 2; ++pass) {
+    std::unique_ptr<Context<double>> context = decay.CreateDefaultContext();
+    context->get_mutable_continuous_state_vector().SetFromVector(
+        Eigen::Vector2d(1.0, 1.0));
+
+    ImplicitEulerIntegrator<double> integrator(decay, context.get());
+    integrator.set_maximum_step_size(0.1);
+    integrator.set_target_accuracy(1e-4);
+    if (pass == 1) {
+      MatrixX<bool> pattern = MatrixX<bool>::Constant(2, 2, false);
+      pattern(0, 0) = pattern(1, 1) = true;
+      integrator.set_jacobian_sparsity_pattern(pattern);
+
+      // The columns occupy disjoint rows, so one group covers both.
+      EXPECT_EQ(integrator.num_jacobian_column_groups(), 1);
+    }
+
+    integrator.Initialize();
+    integrator.IntegrateWithMultipleSteps(t_final);
+
+    // Verify the solution against the analytical one.
+    const VectorBase<double>& x = context->get_continuous_state_vector();
+    EXPECT_NEAR(x.GetAtIndex(0), std::exp(-t_final), tol);
+    EXPECT_NEAR(x.GetAtIndex(1), std::exp(-10.0 * t_final), tol);
+
+    solutions[pass] = Eigen::Vector2d(x.GetAtIndex(0), x.GetAtIndex(1));
+    jacobian_function_evaluations[pass] =
+        integrator.get_num_derivative_evaluations_for_jacobian();
+  }
+
+  // The columns are truly decoupled, so grouped differencing computes the
+  // same Jacobian entries and hence (nearly) the same trajectory.
+  EXPECT_NEAR(solutions[0](0), solutions[1](0), 1e-8);
+  EXPECT_NEAR(solutions[0](1), solutions[1](1), 1e-8);
+
+  // Grouped differencing must spend fewer derivative evaluations on Jacobian
+  // formation than dense differencing.
+  EXPECT_LT(jacobian_function_evaluations[1], jacobian_function_evaluations[0]);
+}
+
+// Tests the greedy column grouping on a banded pattern: a tridiagonal
+// Jacobian needs only three column groups regardless of dimension.
+GTEST_TEST(ImplicitEulerIntegratorTest, TridiagonalColumnGrouping) {
+  const int n = 7;
+  MatrixX<bool> pattern = MatrixX<bool>::Constant(n, n, false);
+  for (int i = 0; i < n; ++i) {
+    for (int j = std::max(i - 1, 0); j <= std::min(i + 1, n - 1); ++j)
+      pattern(i, j) = true;
+  }
+
+  DecoupledDecaySystem decay;
+  std::unique_ptr<Context<double>> context = decay.CreateDefaultContext();
+  ImplicitEulerIntegrator<double> integrator(decay, context.get());
+  integrator.set_jacobian_sparsity_pattern(pattern);
+  EXPECT_EQ(integrator.num_jacobian_column_groups(), 3);
+
+  // An empty pattern reverts to dense (ungrouped) differencing.
+  integrator.set_jacobian_sparsity_pattern(MatrixX<bool>());
+  EXPECT_EQ(integrator.num_jacobian_column_groups(), 0);
+
+  // A non-square pattern is rejected.
+  EXPECT_THROW(
+      integrator.set_jacobian_sparsity_pattern(
+          MatrixX<bool>::Constant(2, 3, true)),
+      std::runtime_error);
+}
+
+// Tests the modified-Newton staleness policy. With the default threshold the
+// integrator reuses its factored iteration matrix across steps and never
+// refreshes on convergence rate alone; with an aggressive threshold, slowly
+// contracting Newton-Raphson solves discard the cached matrices and force
+// refactorization.
+GTEST_TEST(ImplicitEulerIntegratorTest, ConvergenceRateRefreshPolicy) {
+  // Robertson's stiff nonlinear problem produces multi-iteration
+  // Newton-Raphson solves whose contraction rates are observable.
+  analysis::test::RobertsonSystem<double> robertson;
+  const double t_final = robertson.get_end_time();
+  const double tol = 5e-5;
+  std::array<int64_t, 2> factorizations = {{0, 0}};
+
+  // Pass 0 uses the default (disabled) policy; pass 1 refreshes eagerly.
+  for (int pass = 0; pass < 2; ++pass) {
+    std::unique_ptr<Context<double>> context = robertson.CreateDefaultContext();
+    VectorBase<double>& state = context->get_mutable_continuous_state().
+        get_mutable_vector();
+    state.SetAtIndex(0, 1);
+    state.SetAtIndex(1, 0);
+    state.SetAtIndex(2, 0);
+
+    ImplicitEulerIntegrator<double> integrator(robertson, context.get());
+    integrator.set_maximum_step_size(10000000.0);
+    integrator.set_throw_on_minimum_step_size_violation(false);
+    integrator.set_target_accuracy(tol);
+    integrator.request_initial_step_size_target(1e-4);
+    if (pass == 1) {
+      integrator.set_convergence_rate_refresh_threshold(1e-3);
+      EXPECT_EQ(integrator.get_convergence_rate_refresh_threshold(), 1e-3);
+    }
+
+    integrator.Initialize();
+    integrator.IntegrateWithMultipleSteps(t_final);
+
+    // The solution is unaffected by the refresh policy.
+    const Eigen::Vector3d sol = robertson.GetSolution(t_final);
+    EXPECT_NEAR(state.GetAtIndex(0), sol(0), tol);
+    EXPECT_NEAR(state.GetAtIndex(1), sol(1), tol);
+    EXPECT_NEAR(state.GetAtIndex(2), sol(2), tol);
+
+    factorizations[pass] = integrator.get_num_iteration_matrix_factorizations();
+    if (pass == 0) {
+      // The default policy reuses factorizations and never refreshes on
+      // convergence rate alone.
+      EXPECT_GT(integrator.get_num_iteration_matrix_reuses(), 0);
+      EXPECT_EQ(integrator.get_num_convergence_rate_refreshes(), 0);
+    } else {
+      // The eager policy detects degraded contraction and refreshes.
+      EXPECT_GT(integrator.get_num_convergence_rate_refreshes(), 0);
+    }
+  }
+
+  // Eager refreshing must cost additional factorizations.
+  EXPECT_GT(factorizations[1], factorizations[0]);
+
+  // The threshold must be positive.
+  std::unique_ptr<Context<double>> context = robertson.CreateDefaultContext();
+  ImplicitEulerIntegrator<double> integrator(robertson, context.get());
+  EXPECT_THROW(integrator.set_convergence_rate_refresh_threshold(0),
+               std::runtime_error);
+}
+
 class ImplicitIntegratorTest : public ::testing::TestWithParam<bool> {
  public:
   ImplicitIntegratorTest() {
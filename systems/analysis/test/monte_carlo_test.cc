@@ -169,6 +169,44 @@ GTEST_TEST(MonteCarloSimulationTest, BasicTest) {
   }
 }
 
+// The samples must not depend on the number of threads used to compute them.
+GTEST_TEST(MonteCarloSimulationTest, ParallelExecutionMatchesSerial) {
+  const SimulatorFactory make_simulator = [](RandomGenerator*) {
+    auto system = std::make_unique<RandomContextSystem>();
+    return std::make_unique<Simulator<double>>(std::move(system));
+  };
+  const double final_time = 0.1;
+  const int num_samples = 8;
+
+  RandomGenerator serial_generator(42);
+  const auto serial_results =
+      MonteCarloSimulation(make_simulator, &GetScalarOutput, final_time,
+                           num_samples, &serial_generator, 1);
+
+  RandomGenerator parallel_generator(42);
+  const auto parallel_results =
+      MonteCarloSimulation(make_simulator, &GetScalarOutput, final_time,
+                           num_samples, &parallel_generator, 3);
+
+  ASSERT_EQ(serial_results.size(), num_samples);
+  ASSERT_EQ(parallel_results.size(), num_samples);
+  for (int i = 0; i < num_samples; ++i) {
+    EXPECT_EQ(serial_results[i].output, parallel_results[i].output);
+    EXPECT_TRUE(serial_results[i].generator_snapshot ==
+                parallel_results[i].generator_snapshot);
+  }
+  // Both runs must leave the caller's generator in the same state.
+  EXPECT_TRUE(serial_generator == parallel_generator);
+
+  // Parallel results can be replayed with RandomSimulation just the same.
+  for (const auto& result : parallel_results) {
+    RandomGenerator generator(result.generator_snapshot);
+    EXPECT_EQ(RandomSimulation(make_simulator, &GetScalarOutput, final_time,
+                               &generator),
+              result.output);
+  }
+}
+
 }  // namespace
 }  // namespace analysis
 }  // namespace systems
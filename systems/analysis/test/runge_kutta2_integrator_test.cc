@@ -151,6 +151,36 @@ GTEST_TEST(IntegratorTest, SpringMassStep) {
   CheckStatsValidity(&integrator);
 }
 
+// The minimal stepping fast path must produce bitwise identical results to
+// the checked fixed-step method.
+GTEST_TEST(IntegratorTest, MinimalStepMatchesFixedStep) {
+  const double spring_k = 300.0;  // N/m
+  const double mass = 2.0;      // kg
+  const double dt = 1.0/1024;
+  const int n_steps = 512;
+
+  SpringMassSystem<double> spring_mass(spring_k, mass, 0.);
+  auto context_fixed = spring_mass.CreateDefaultContext();
+  auto context_minimal = spring_mass.CreateDefaultContext();
+
+  RungeKutta2Integrator<double> fixed(spring_mass, dt, context_fixed.get());
+  RungeKutta2Integrator<double> minimal(
+      spring_mass, dt, context_minimal.get());
+  fixed.Initialize();
+  minimal.Initialize();
+
+  for (int i = 0; i < n_steps; ++i) {
+    fixed.IntegrateWithSingleFixedStep(dt);
+    minimal.IntegrateWithSingleMinimalStep(dt);
+  }
+
+  EXPECT_EQ(context_fixed->get_time(), context_minimal->get_time());
+  EXPECT_EQ(context_fixed->get_continuous_state_vector().CopyToVector(),
+            context_minimal->get_continuous_state_vector().CopyToVector());
+  EXPECT_EQ(minimal.get_num_derivative_evaluations(),
+            fixed.get_num_derivative_evaluations());
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
@@ -0,0 +1,146 @@
+#include "drake/systems/analysis/runge_kutta5_integrator.h"
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "drake/systems/analysis/test_utilities/my_spring_mass_system.h"
+
+namespace drake {
+namespace systems {
+namespace analysis_test {
+
+// Verifies the miscellaneous API.
+GTEST_TEST(RK5IntegratorTest, MiscAPI) {
+  MySpringMassSystem<double> spring_mass(300.0 /* N/m */, 2.0 /* kg */, 0.);
+  std::unique_ptr<Context<double>> context =
+      spring_mass.CreateDefaultContext();
+  RungeKutta5Integrator<double> integrator(spring_mass, context.get());
+
+  EXPECT_TRUE(integrator.supports_error_estimation());
+  EXPECT_EQ(integrator.get_error_estimate_order(), 5);
+
+  // Initialization should throw when neither the initial step size target
+  // nor the maximum step size has been set.
+  EXPECT_THROW(integrator.Initialize(), std::logic_error);
+}
+
+// Verifies fifth-order convergence on the unforced spring-mass system, which
+// has a closed form solution: halving the fixed step size should reduce the
+// global error by a factor of approximately 2⁵ = 32.
+GTEST_TEST(RK5IntegratorTest, SpringMassStepConvergence) {
+  const double spring_k = 300.0;  // N/m
+  const double mass = 2.0;        // kg
+  const double initial_position = 0.1;
+  const double initial_velocity = 0.0;
+  const double t_final = 1.0;
+
+  MySpringMassSystem<double> spring_mass(spring_k, mass, 0.);
+
+  // Compute the true solution at t_final.
+  double x_final_true, v_final_true;
+  spring_mass.GetClosedFormSolution(initial_position, initial_velocity,
+                                    t_final, &x_final_true, &v_final_true);
+
+  // Integrate with fixed steps of size h and h/2 and record the errors.
+  const double dts[2] = { 1e-2, 5e-3 };
+  double errors[2];
+  for (int i = 0; i < 2; ++i) {
+    std::unique_ptr<Context<double>> context =
+        spring_mass.CreateDefaultContext();
+    spring_mass.set_position(context.get(), initial_position);
+    spring_mass.set_velocity(context.get(), initial_velocity);
+
+    RungeKutta5Integrator<double> integrator(spring_mass, context.get());
+    integrator.set_maximum_step_size(dts[i]);
+    integrator.set_fixed_step_mode(true);
+    integrator.Initialize();
+
+    const int n_steps = static_cast<int>(std::round(t_final / dts[i]));
+    for (int j = 0; j < n_steps; ++j)
+      integrator.IntegrateWithSingleFixedStep(dts[i]);
+
+    const double x_final =
+        context->get_continuous_state().get_vector().GetAtIndex(0);
+    errors[i] = std::abs(x_final - x_final_true);
+  }
+
+  // The error ratio should be close to 32 for a fifth-order method; the
+  // brackets account for the non-asymptotic contribution at these step
+  // sizes (a fourth-order method would yield a ratio close to sixteen).
+  EXPECT_GT(errors[0] / errors[1], 20.0);
+  EXPECT_LT(errors[0] / errors[1], 45.0);
+}
+
+// Verifies that the embedded error estimate captures the true single-step
+// error. Note: the spring-mass system is linear, for which the embedded
+// fourth-order formula happens to be superconvergent, so the estimate here
+// tracks the true error to within a factor of about two rather than
+// conservatively bounding it.
+GTEST_TEST(RK5IntegratorTest, ErrorEstimate) {
+  const double spring_k = 300.0;  // N/m
+  const double mass = 2.0;        // kg
+  const double initial_position = 0.1;
+  const double initial_velocity = 0.01;
+
+  MySpringMassSystem<double> spring_mass(spring_k, mass, 0.);
+  std::unique_ptr<Context<double>> context =
+      spring_mass.CreateDefaultContext();
+  spring_mass.set_position(context.get(), initial_position);
+  spring_mass.set_velocity(context.get(), initial_velocity);
+
+  RungeKutta5Integrator<double> integrator(spring_mass, context.get());
+  const double dt = 1e-1;
+  integrator.set_maximum_step_size(dt);
+  integrator.set_fixed_step_mode(true);
+  integrator.Initialize();
+  integrator.IntegrateWithSingleFixedStep(dt);
+
+  // Get the true solution.
+  double x_true, v_true;
+  spring_mass.GetClosedFormSolution(initial_position, initial_velocity,
+                                    dt, &x_true, &v_true);
+
+  const double x_approx =
+      context->get_continuous_state_vector().GetAtIndex(0);
+  const double err_est =
+      integrator.get_error_estimate()->get_vector().GetAtIndex(0);
+
+  EXPECT_GT(err_est, 0.0);
+  EXPECT_LT(std::abs(x_approx - x_true), 2 * err_est);
+}
+
+// Verifies the first-same-as-last (FSAL) property: after the initial
+// evaluation, each step of an uninterrupted integration costs exactly six
+// derivative evaluations because the last stage of one step is reused as
+// the first stage of the next.
+GTEST_TEST(RK5IntegratorTest, FSALReuse) {
+  MySpringMassSystem<double> spring_mass(300.0 /* N/m */, 2.0 /* kg */, 0.);
+  std::unique_ptr<Context<double>> context =
+      spring_mass.CreateDefaultContext();
+  spring_mass.set_position(context.get(), 0.1);
+  spring_mass.set_velocity(context.get(), 0.0);
+
+  RungeKutta5Integrator<double> integrator(spring_mass, context.get());
+  const double dt = 1e-2;
+  integrator.set_maximum_step_size(dt);
+  integrator.set_fixed_step_mode(true);
+  integrator.Initialize();
+
+  const int n_steps = 10;
+  for (int j = 0; j < n_steps; ++j)
+    integrator.IntegrateWithSingleFixedStep(dt);
+
+  EXPECT_EQ(integrator.get_num_steps_taken(), n_steps);
+  EXPECT_EQ(integrator.get_num_derivative_evaluations(), 6 * n_steps + 1);
+
+  // Changing the state between steps invalidates the cached evaluation, so
+  // the next step pays the seventh evaluation again.
+  spring_mass.set_position(context.get(), 0.2);
+  integrator.IntegrateWithSingleFixedStep(dt);
+  EXPECT_EQ(integrator.get_num_derivative_evaluations(), 6 * n_steps + 1 + 7);
+}
+
+}  // namespace analysis_test
+}  // namespace systems
+}  // namespace drake
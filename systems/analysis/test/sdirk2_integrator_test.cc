@@ -0,0 +1,176 @@
+#include "drake/systems/analysis/sdirk2_integrator.h"
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "drake/systems/analysis/test_utilities/robertson_system.h"
+#include "drake/systems/analysis/test_utilities/spring_mass_damper_system.h"
+#include "drake/systems/plants/spring_mass_system/spring_mass_system.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using implicit_integrator_test::SpringMassDamperSystem;
+
+// Verifies the miscellaneous API: the tableau coefficient and the error
+// estimation properties.
+GTEST_TEST(Sdirk2IntegratorTest, MiscAPI) {
+  SpringMassSystem<double> spring_mass(1.0, 1.0, false /* unforced */);
+  std::unique_ptr<Context<double>> context =
+      spring_mass.CreateDefaultContext();
+  Sdirk2Integrator<double> integrator(spring_mass, context.get());
+
+  EXPECT_NEAR(Sdirk2Integrator<double>::gamma(),
+              1.0 - std::sqrt(2.0) / 2.0,
+              std::numeric_limits<double>::epsilon());
+  EXPECT_TRUE(integrator.supports_error_estimation());
+  EXPECT_EQ(integrator.get_error_estimate_order(), 2);
+  EXPECT_TRUE(integrator.get_reuse());
+  integrator.set_reuse(false);
+  EXPECT_FALSE(integrator.get_reuse());
+}
+
+// Tests the integrator on Robertson's stiff chemical reaction problem, the
+// same benchmark used for ImplicitEulerIntegrator; L-stability lets the
+// integrator take very large steps once the fast transient has decayed.
+GTEST_TEST(Sdirk2IntegratorTest, Robertson) {
+  std::unique_ptr<analysis::test::RobertsonSystem<double>> robertson =
+    std::make_unique<analysis::test::RobertsonSystem<double>>();
+  std::unique_ptr<Context<double>> context = robertson->CreateDefaultContext();
+
+  // Set the initial conditions for Robertson's system.
+  VectorBase<double>& state = context->get_mutable_continuous_state().
+                                get_mutable_vector();
+  state.SetAtIndex(0, 1);
+  state.SetAtIndex(1, 0);
+  state.SetAtIndex(2, 0);
+
+  const double t_final = robertson->get_end_time();
+  const double tol = 5e-5;
+
+  // Create the integrator.
+  Sdirk2Integrator<double> integrator(*robertson, context.get());
+
+  // As in the corresponding ImplicitEulerIntegrator test, a small initial
+  // step size must be selected explicitly to get past the fast initial
+  // transient (see issue #6329).
+  integrator.set_maximum_step_size(10000000.0);
+  integrator.set_throw_on_minimum_step_size_violation(false);
+  integrator.set_target_accuracy(tol);
+  integrator.request_initial_step_size_target(1e-4);
+
+  // Integrate the system.
+  integrator.Initialize();
+  integrator.IntegrateWithMultipleSteps(t_final);
+
+  // Verify the solution.
+  const Eigen::Vector3d sol = robertson->GetSolution(t_final);
+  EXPECT_NEAR(state.GetAtIndex(0), sol(0), tol);
+  EXPECT_NEAR(state.GetAtIndex(1), sol(1), tol);
+  EXPECT_NEAR(state.GetAtIndex(2), sol(2), tol);
+
+  // Verify that the implicit statistics were exercised.
+  EXPECT_GT(integrator.get_num_steps_taken(), 0);
+  EXPECT_GT(integrator.get_num_newton_raphson_iterations(), 0);
+  EXPECT_GT(integrator.get_num_jacobian_evaluations(), 0);
+  EXPECT_GT(integrator.get_num_iteration_matrix_factorizations(), 0);
+  EXPECT_GT(integrator.get_num_derivative_evaluations_for_jacobian(), 0);
+}
+
+// Verifies second-order convergence on the unforced spring-mass system,
+// which has a closed form solution: halving the fixed step size should
+// reduce the global error by a factor of approximately four.
+GTEST_TEST(Sdirk2IntegratorTest, SpringMassStepConvergence) {
+  const double spring_k = 300.0;  // N/m
+  const double mass = 2.0;        // kg
+  const double initial_position = 0.1;
+  const double initial_velocity = 0.0;
+  const double t_final = 1.0;
+
+  SpringMassSystem<double> spring_mass(spring_k, mass, false /* unforced */);
+
+  // Compute the true solution at t_final.
+  double x_final_true, v_final_true;
+  spring_mass.GetClosedFormSolution(initial_position, initial_velocity,
+                                    t_final, &x_final_true, &v_final_true);
+
+  // Integrate with fixed steps of size h and h/2 and record the errors.
+  const double dts[2] = { 1e-2, 5e-3 };
+  double errors[2];
+  for (int i = 0; i < 2; ++i) {
+    std::unique_ptr<Context<double>> context =
+        spring_mass.CreateDefaultContext();
+    spring_mass.set_position(context.get(), initial_position);
+    spring_mass.set_velocity(context.get(), initial_velocity);
+
+    Sdirk2Integrator<double> integrator(spring_mass, context.get());
+    integrator.set_maximum_step_size(dts[i]);
+    integrator.set_fixed_step_mode(true);
+    integrator.Initialize();
+
+    const int n_steps = static_cast<int>(std::round(t_final / dts[i]));
+    for (int j = 0; j < n_steps; ++j)
+      integrator.IntegrateWithSingleFixedStep(dts[i]);
+
+    const double x_final =
+        context->get_continuous_state().get_vector().GetAtIndex(0);
+    errors[i] = std::abs(x_final - x_final_true);
+  }
+
+  // The error ratio should be close to four for a second-order method; a
+  // first-order method would yield a ratio close to two.
+  EXPECT_GT(errors[0] / errors[1], 3.0);
+  EXPECT_LT(errors[0] / errors[1], 5.0);
+}
+
+// Verifies that the stages of a step share iteration matrix factorizations:
+// with reuse enabled, the number of factorizations should be far smaller
+// than the number of stage solves, and disabling reuse should increase the
+// number of Jacobian evaluations for the same integration.
+GTEST_TEST(Sdirk2IntegratorTest, SharedFactorization) {
+  const double spring_k = 300.0;   // N/m
+  const double damping_b = 40.0;   // N·s/m
+  const double mass = 2.0;         // kg
+  const double t_final = 1.0;
+
+  SpringMassDamperSystem<double> spring_damper(spring_k, damping_b, mass);
+
+  int64_t jacobians[2], factorizations[2];
+  for (int i = 0; i < 2; ++i) {
+    std::unique_ptr<Context<double>> context =
+        spring_damper.CreateDefaultContext();
+    spring_damper.set_position(context.get(), 0.1);
+    spring_damper.set_velocity(context.get(), 0.0);
+
+    Sdirk2Integrator<double> integrator(spring_damper, context.get());
+    integrator.set_reuse(i == 0);
+    integrator.set_maximum_step_size(1e-2);
+    integrator.set_fixed_step_mode(true);
+    integrator.Initialize();
+
+    const int n_steps = static_cast<int>(std::round(t_final / 1e-2));
+    for (int j = 0; j < n_steps; ++j)
+      integrator.IntegrateWithSingleFixedStep(1e-2);
+
+    jacobians[i] = integrator.get_num_jacobian_evaluations();
+    factorizations[i] = integrator.get_num_iteration_matrix_factorizations();
+
+    // The error estimate should have been populated.
+    EXPECT_GT(integrator.get_error_estimate()->CopyToVector().norm(), 0.0);
+
+    // Both stages of every step share one factorization, so even without
+    // reuse across steps there can be at most one factorization per step.
+    EXPECT_LE(factorizations[i], n_steps);
+  }
+
+  // Reuse should have resulted in strictly fewer Jacobian evaluations and
+  // factorizations.
+  EXPECT_LT(jacobians[0], jacobians[1]);
+  EXPECT_LT(factorizations[0], factorizations[1]);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/test_utilities/limit_malloc.h"
+#include "drake/systems/analysis/explicit_euler_integrator.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/primitives/adder.h"
+#include "drake/systems/primitives/constant_vector_source.h"
+#include "drake/systems/primitives/gain.h"
+#include "drake/systems/primitives/integrator.h"
+
+namespace drake {
+namespace systems {
+namespace analysis {
+namespace {
+
+// These tests pin down the allocation behavior of the simulation hot loop:
+// once a Simulator has reached steady state, stepping a diagram of ordinary
+// vector-valued systems with a fixed-step integrator must not touch the heap.
+// If a framework change introduces a per-step allocation (an event collection
+// copy, a BasicVector temporary, ...) these tests fail, naming the regression
+// rather than leaving it for an external profiler to discover.
+
+// Advances the simulation to @p boundary_time, requiring that no memory is
+// allocated along the way. Armed DRAKE_ASSERTs run expensive self-checks
+// (e.g. the cache revalidates output types, which allocates a sample value),
+// so the zero-allocation contract is only enforced in release builds.
+void StepToWithoutAllocating(Simulator<double>* simulator,
+                             double boundary_time) {
+#ifdef DRAKE_ASSERT_IS_DISARMED
+  test::LimitMalloc guard;
+#endif
+  simulator->StepTo(boundary_time);
+}
+
+// A canonical continuous diagram: source -> adder -> integrator -> gain.
+std::unique_ptr<Diagram<double>> MakeContinuousDiagram() {
+  DiagramBuilder<double> builder;
+  auto* source = builder.AddSystem<ConstantVectorSource<double>>(
+      Eigen::Vector2d(1.0, -1.0));
+  auto* adder = builder.AddSystem<Adder<double>>(2 /* inputs */, 2 /* size */);
+  auto* integrator = builder.AddSystem<Integrator<double>>(2);
+  auto* gain = builder.AddSystem<Gain<double>>(2.0, 2);
+  builder.Connect(source->get_output_port(), adder->get_input_port(0));
+  builder.Connect(source->get_output_port(), adder->get_input_port(1));
+  builder.Connect(adder->get_output_port(), integrator->get_input_port());
+  builder.Connect(integrator->get_output_port(), gain->get_input_port());
+  return builder.Build();
+}
+
+GTEST_TEST(SimulatorAllocationTest, ContinuousSteadyState) {
+  const std::unique_ptr<Diagram<double>> diagram = MakeContinuousDiagram();
+  Simulator<double> simulator(*diagram);
+  simulator.set_publish_every_time_step(false);
+  simulator.reset_integrator<ExplicitEulerIntegrator<double>>(
+      *diagram, 1e-3, &simulator.get_mutable_context());
+  simulator.Initialize();
+
+  // Take some steps first so that one-time costs (cache entry values,
+  // integrator scratch, event collections) have all been paid.
+  simulator.StepTo(0.5);
+
+  // Steady state must be allocation-free.
+  StepToWithoutAllocating(&simulator, 1.0);
+}
+
+GTEST_TEST(SimulatorAllocationTest, ContinuousSteadyStateWithPublish) {
+  const std::unique_ptr<Diagram<double>> diagram = MakeContinuousDiagram();
+  Simulator<double> simulator(*diagram);
+  simulator.set_publish_every_time_step(true);
+  simulator.reset_integrator<ExplicitEulerIntegrator<double>>(
+      *diagram, 1e-3, &simulator.get_mutable_context());
+  simulator.Initialize();
+  simulator.StepTo(0.5);
+
+  // Per-step publishing must not allocate either.
+  StepToWithoutAllocating(&simulator, 1.0);
+}
+
+}  // namespace
+}  // namespace analysis
+}  // namespace systems
+}  // namespace drake
@@ -896,6 +896,43 @@ GTEST_TEST(SimulatorTest, RealtimeRate) {
   EXPECT_TRUE(simulator.get_actual_realtime_rate() <= 5.1);
 }
 
+// Tests that per-phase wall-clock profiling accumulates timings only when
+// enabled and that the timings are cleared on a statistics reset.
+GTEST_TEST(SimulatorTest, PhaseTiming) {
+  analysis_test::MySpringMassSystem<double> spring_mass(1., 1., 30. /* Hz */);
+  Simulator<double> simulator(spring_mass);  // Use default Context.
+  simulator.get_mutable_integrator()->set_maximum_step_size(0.001);
+  simulator.set_publish_every_time_step(true);
+
+  // Profiling is off by default and accumulates nothing.
+  EXPECT_FALSE(simulator.get_profiling_enabled());
+  simulator.Initialize();
+  simulator.StepTo(1.);
+  EXPECT_EQ(simulator.get_phase_timing().continuous_integration_s, 0.);
+  EXPECT_EQ(simulator.get_phase_timing().discrete_updates_s, 0.);
+
+  // With profiling enabled, the exercised phases accumulate time.
+  simulator.set_profiling_enabled(true);
+  simulator.StepTo(2.);
+  EXPECT_GT(simulator.get_phase_timing().continuous_integration_s, 0.);
+  EXPECT_GT(simulator.get_phase_timing().discrete_updates_s, 0.);
+  EXPECT_GT(simulator.get_phase_timing().event_timing_s, 0.);
+  EXPECT_GT(simulator.get_phase_timing().publishes_s, 0.);
+
+  // The report mentions every phase.
+  const std::string report = simulator.MakePhaseTimingReport();
+  EXPECT_NE(report.find("unrestricted updates"), std::string::npos);
+  EXPECT_NE(report.find("discrete updates"), std::string::npos);
+  EXPECT_NE(report.find("event timing"), std::string::npos);
+  EXPECT_NE(report.find("continuous integration"), std::string::npos);
+  EXPECT_NE(report.find("publishes"), std::string::npos);
+
+  // Resetting statistics clears the accumulated timings.
+  simulator.ResetStatistics();
+  EXPECT_EQ(simulator.get_phase_timing().continuous_integration_s, 0.);
+  EXPECT_EQ(simulator.get_phase_timing().discrete_updates_s, 0.);
+}
+
 // Tests that if publishing every timestep is disabled and publish on
 // initialization is enabled, publish only happens on initialization.
 GTEST_TEST(SimulatorTest, DisablePublishEveryTimestep) {
@@ -1035,6 +1072,172 @@ GTEST_TEST(SimulatorTest, ExampleDiscreteSystem) {
                     "3: 30 (0.06)\n");
 }
 
+// A simple periodic counter used to exercise the precomputed periodic event
+// schedule: x_{n+1} = x_n + 1 at the given period and offset.
+class PeriodicCounterSystem : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PeriodicCounterSystem)
+
+  PeriodicCounterSystem(double period, double offset) {
+    DeclareDiscreteState(1);
+    DeclarePeriodicDiscreteUpdateEvent(period, offset,
+                                       &PeriodicCounterSystem::Update);
+  }
+
+ private:
+  EventStatus Update(const Context<double>& context,
+                     DiscreteValues<double>* xd) const {
+    (*xd)[0] = context.get_discrete_state()[0] + 1.;
+    return EventStatus::Succeeded();
+  }
+};
+
+// Simulating with the precomputed periodic event schedule must dispatch
+// exactly the same events, at the same times, as the dynamic
+// CalcNextUpdateTime() path -- including steps at which phases with different
+// rates happen to coincide.
+// The periodic checkpoint hook fires at substep boundaries, once per period
+// boundary crossed, with monotonically increasing times.
+GTEST_TEST(SimulatorTest, PeriodicCheckpoint) {
+  analysis_test::MySpringMassSystem<double> spring_mass(1., 1., 0.);
+  Simulator<double> simulator(spring_mass);
+
+  std::vector<double> checkpoint_times;
+  simulator.set_periodic_checkpoint(
+      0.125, [&checkpoint_times](const Context<double>& context) {
+        checkpoint_times.push_back(context.get_time());
+      });
+  simulator.StepTo(1.);
+
+  // Eight period boundaries lie in (0, 1]; a checkpoint lands at the end of
+  // the first substep reaching each one, and one substep may cover several.
+  ASSERT_GE(checkpoint_times.size(), 1u);
+  EXPECT_LE(checkpoint_times.size(), 8u);
+  EXPECT_GE(checkpoint_times.front(), 0.125);
+  for (size_t i = 1; i < checkpoint_times.size(); ++i)
+    EXPECT_GT(checkpoint_times[i], checkpoint_times[i - 1]);
+
+  // A positive period is required when registering a checkpoint function.
+  EXPECT_THROW(
+      simulator.set_periodic_checkpoint(0., [](const Context<double>&) {}),
+      std::runtime_error);
+
+  // Clearing the checkpoint function stops checkpointing.
+  simulator.set_periodic_checkpoint(0., nullptr);
+  const size_t num_checkpoints = checkpoint_times.size();
+  simulator.StepTo(2.);
+  EXPECT_EQ(checkpoint_times.size(), num_checkpoints);
+}
+
+// RewindBy() must restore the time and state recorded at prior substep
+// boundaries, and resuming from a rewound boundary must reproduce the
+// trajectory of an uninterrupted run.
+GTEST_TEST(SimulatorTest, RewindSnapshots) {
+  analysis_test::MySpringMassSystem<double> spring_mass(1., 1., 0.);
+
+  Simulator<double> simulator(spring_mass);
+  simulator.reset_integrator<ExplicitEulerIntegrator<double>>(
+      spring_mass, 1e-3, &simulator.get_mutable_context());
+
+  // Snapshotting is off by default, so no snapshots accumulate and rewinding
+  // is not possible.
+  EXPECT_EQ(simulator.get_rewind_snapshot_capacity(), 0);
+  simulator.Initialize();
+  simulator.StepTo(0.005);
+  EXPECT_EQ(simulator.get_num_rewind_snapshots(), 0);
+  EXPECT_THROW(simulator.RewindBy(1), std::logic_error);
+
+  // A negative capacity is rejected.
+  EXPECT_THROW(simulator.set_rewind_snapshot_capacity(-1), std::runtime_error);
+
+  // The ring retains only the most recent `capacity` substeps.
+  simulator.set_rewind_snapshot_capacity(4);
+  simulator.StepTo(0.01);
+  EXPECT_EQ(simulator.get_num_rewind_snapshots(), 4);
+  EXPECT_THROW(simulator.RewindBy(5), std::logic_error);
+  EXPECT_THROW(simulator.RewindBy(0), std::runtime_error);
+
+  // RewindBy(1) restores the start of the most recent substep, which is
+  // strictly earlier than the time StepTo() just reached.
+  const double t_before = simulator.get_context().get_time();
+  simulator.RewindBy(1);
+  const double t_rewound = simulator.get_context().get_time();
+  EXPECT_LT(t_rewound, t_before);
+  EXPECT_EQ(simulator.get_num_rewind_snapshots(), 4);
+
+  // Rewinding further reaches a strictly earlier substep and discards the
+  // snapshots that followed it (the restored one remains available).
+  simulator.RewindBy(3);
+  EXPECT_LT(simulator.get_context().get_time(), t_rewound);
+  EXPECT_EQ(simulator.get_num_rewind_snapshots(), 2);
+
+  // Resuming after a rewind retraces the trajectory of an uninterrupted
+  // twin exactly: the restored time and state are bitwise those the run
+  // passed through, so the fixed-step sequence to the boundary is identical.
+  simulator.StepTo(0.02);
+
+  Simulator<double> twin(spring_mass);
+  twin.reset_integrator<ExplicitEulerIntegrator<double>>(
+      spring_mass, 1e-3, &twin.get_mutable_context());
+  twin.Initialize();
+  twin.StepTo(0.02);
+  EXPECT_EQ(simulator.get_context().get_time(), twin.get_context().get_time());
+  EXPECT_EQ(
+      simulator.get_context().get_continuous_state_vector().CopyToVector(),
+      twin.get_context().get_continuous_state_vector().CopyToVector());
+}
+
+GTEST_TEST(SimulatorTest, PeriodicEventSchedule) {
+  auto count_updates = [](bool use_schedule) {
+    DiagramBuilder<double> builder;
+    // Phases fire separately and together (both fire at t = k * 0.05).
+    auto* fast = builder.AddSystem<PeriodicCounterSystem>(0.01, 0.);
+    auto* slow = builder.AddSystem<PeriodicCounterSystem>(0.025, 0.005);
+    auto diagram = builder.Build();
+
+    Simulator<double> simulator(*diagram);
+    simulator.set_use_periodic_event_schedule(use_schedule);
+    EXPECT_EQ(simulator.get_use_periodic_event_schedule(), use_schedule);
+    simulator.StepTo(1.);
+
+    const Context<double>& context = simulator.get_context();
+    return std::make_pair(
+        diagram->GetSubsystemContext(*fast, context).get_discrete_state()[0],
+        diagram->GetSubsystemContext(*slow, context).get_discrete_state()[0]);
+  };
+
+  const auto dynamic_counts = count_updates(false);
+  const auto scheduled_counts = count_updates(true);
+  EXPECT_EQ(scheduled_counts.first, dynamic_counts.first);
+  EXPECT_EQ(scheduled_counts.second, dynamic_counts.second);
+
+  // Sanity check that the counters actually ran.
+  EXPECT_GE(dynamic_counts.first, 100.);
+  EXPECT_GE(dynamic_counts.second, 39.);
+}
+
+// Rewinding invalidates the precomputed tick table, so ticks between the
+// rewound-to time and the former current time must fire again on resume and
+// the update count must match an uninterrupted run.
+GTEST_TEST(SimulatorTest, PeriodicEventScheduleAfterRewind) {
+  auto count_updates = [](bool rewind) {
+    PeriodicCounterSystem counter(0.01, 0.);
+    Simulator<double> simulator(counter);
+    simulator.set_use_periodic_event_schedule(true);
+    if (rewind) {
+      simulator.set_rewind_snapshot_capacity(4);
+      simulator.StepTo(0.5);
+      simulator.RewindBy(2);
+      EXPECT_LT(simulator.get_context().get_time(), 0.5);
+    }
+    simulator.StepTo(1.);
+    return simulator.get_context().get_discrete_state()[0];
+  };
+
+  EXPECT_EQ(count_updates(true), count_updates(false));
+}
+
+
 // A hybrid discrete-continuous system:
 //   x_{n+1} = sin(1.234*t)
 //   y_n     = x_n
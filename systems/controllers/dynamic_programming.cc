@@ -1,6 +1,12 @@
 #include "drake/systems/controllers/dynamic_programming.h"
 
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <functional>
 #include <limits>
+#include <memory>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -13,6 +19,36 @@
 namespace drake {
 namespace systems {
 namespace controllers {
+namespace {
+
+// Runs worker(0) on the calling thread and worker(1) ... worker(n-1) on
+// n-1 additional threads, then rethrows the first exception (if any) that
+// escaped from a worker.
+void RunWorkers(int num_threads, const std::function<void(int)>& worker) {
+  std::vector<std::exception_ptr> errors(num_threads);
+  const auto guarded_worker = [&](int thread_num) {
+    try {
+      worker(thread_num);
+    } catch (...) {
+      errors[thread_num] = std::current_exception();
+    }
+  };
+  std::vector<std::thread> threads;
+  for (int i = 1; i < num_threads; i++) {
+    threads.emplace_back(guarded_worker, i);
+  }
+  guarded_worker(0);
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  for (const std::exception_ptr& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+}  // namespace
 
 DynamicProgrammingOptions::PeriodicBoundaryCondition::PeriodicBoundaryCondition(
     int state_index_in, double low_in, double high_in)
@@ -63,6 +99,13 @@ FittedValueIteration(
     DRAKE_DEMAND(b.high <= *(state_grid[b.state_index].rbegin()));
   }
 
+  int num_threads = options.num_threads;
+  if (num_threads <= 0) {
+    num_threads =
+        std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  }
+  num_threads = std::min(num_threads, num_states);
+
   // The transition probabilities are represented as a sparse matrix,
   // where Tind[input](:,state) is a list of non-zero indexes into the
   // state_mesh, and T[input](:,state) is the associated list of coefficients.
@@ -70,43 +113,63 @@ FittedValueIteration(
   std::vector<Eigen::MatrixXi> Tind(num_inputs);
   std::vector<Eigen::MatrixXd> T(num_inputs);
   std::vector<Eigen::RowVectorXd> cost(num_inputs);
+  for (int input = 0; input < num_inputs; input++) {
+    Tind[input].resize(num_state_indices, num_states);
+    T[input].resize(num_state_indices, num_states);
+    cost[input].resize(num_states);
+  }
 
   drake::log()->info("Computing transition and cost matrices.");
-  auto& sim_state = context.get_mutable_continuous_state_vector();
 
-  Eigen::VectorXd input_vec(input_mesh.get_input_size());
-  Eigen::VectorXd state_vec(state_mesh.get_input_size());
+  // Worker zero reuses the caller's simulator; the others step clones of the
+  // caller's context (with default integrator settings).  The state grid is
+  // dealt round-robin across the workers, so every worker touches a disjoint
+  // set of columns of Tind/T/cost and no synchronization is required.
+  // BarycentricMesh keeps a per-instance interval cache during queries, so
+  // each worker also gets a private copy of the state mesh.
+  std::vector<std::unique_ptr<Simulator<double>>> worker_simulators;
+  for (int i = 1; i < num_threads; i++) {
+    worker_simulators.emplace_back(
+        std::make_unique<Simulator<double>>(system, context.Clone()));
+  }
 
-  Eigen::VectorXi Tind_tmp(num_state_indices);
-  Eigen::VectorXd T_tmp(num_state_indices);
+  RunWorkers(num_threads, [&](int thread_num) {
+    Simulator<double>* worker_simulator =
+        (thread_num == 0) ? simulator : worker_simulators[thread_num - 1].get();
+    auto& worker_context = worker_simulator->get_mutable_context();
+    auto& worker_state = worker_context.get_mutable_continuous_state_vector();
+    const math::BarycentricMesh<double> worker_mesh(state_grid);
 
-  for (int input = 0; input < num_inputs; input++) {
-    Tind[input].resize(num_state_indices, num_states);
-    T[input].resize(num_state_indices, num_states);
-    cost[input].resize(num_states);
+    Eigen::VectorXd input_vec(input_mesh.get_input_size());
+    Eigen::VectorXd state_vec(worker_mesh.get_input_size());
 
-    input_mesh.get_mesh_point(input, &input_vec);
-    context.FixInputPort(0, input_vec);
+    Eigen::VectorXi Tind_tmp(num_state_indices);
+    Eigen::VectorXd T_tmp(num_state_indices);
 
-    for (int state = 0; state < num_states; state++) {
-      context.set_time(0.0);
-      sim_state.SetFromVector(state_mesh.get_mesh_point(state));
+    for (int input = 0; input < num_inputs; input++) {
+      input_mesh.get_mesh_point(input, &input_vec);
+      worker_context.FixInputPort(0, input_vec);
 
-      cost[input](state) = timestep * cost_function(context);
+      for (int state = thread_num; state < num_states; state += num_threads) {
+        worker_context.set_time(0.0);
+        worker_state.SetFromVector(worker_mesh.get_mesh_point(state));
 
-      simulator->StepTo(timestep);
-      state_vec = sim_state.CopyToVector();
+        cost[input](state) = timestep * cost_function(worker_context);
 
-      for (const auto& b : options.periodic_boundary_conditions) {
-        state_vec[b.state_index] =
-            math::wrap_to(state_vec[b.state_index], b.low, b.high);
-      }
+        worker_simulator->StepTo(timestep);
+        state_vec = worker_state.CopyToVector();
+
+        for (const auto& b : options.periodic_boundary_conditions) {
+          state_vec[b.state_index] =
+              math::wrap_to(state_vec[b.state_index], b.low, b.high);
+        }
 
-      state_mesh.EvalBarycentricWeights(state_vec, &Tind_tmp, &T_tmp);
-      Tind[input].col(state) = Tind_tmp;
-      T[input].col(state) = T_tmp;
+        worker_mesh.EvalBarycentricWeights(state_vec, &Tind_tmp, &T_tmp);
+        Tind[input].col(state) = Tind_tmp;
+        T[input].col(state) = T_tmp;
+      }
     }
-  }
+  });
   drake::log()->info("Done computing transition and cost matrices.");
 
   // Perform value iteration loop.
@@ -114,31 +177,51 @@ FittedValueIteration(
   Eigen::RowVectorXd Jnext(num_states);
   Eigen::MatrixXd Pi(input_mesh.get_input_size(), num_states);
 
+  // Pre-extract all of the input mesh points, so that the backup below is
+  // pure arithmetic over the transition tables.
+  Eigen::MatrixXd input_mesh_points(input_mesh.get_input_size(), num_inputs);
+  for (int input = 0; input < num_inputs; input++) {
+    input_mesh_points.col(input) = input_mesh.get_mesh_point(input);
+  }
+
   drake::log()->info("Running value iteration.");
   double max_diff = std::numeric_limits<double>::infinity();
   int iteration = 0;
+  std::vector<double> worker_max_diff(num_threads);
   while (max_diff > options.convergence_tol) {
-    for (int state = 0; state < num_states; state++) {
-      Jnext(state) = std::numeric_limits<double>::infinity();
-
-      int best_input = 0;
-      for (int input = 0; input < num_inputs; input++) {
-        // Q(x,u) = g(x,u) + γ J(f(x,u)).
-        double Q = cost[input](state);
-        for (int index = 0; index < num_state_indices; index++) {
-          Q += options.discount_factor * T[input](index, state) *
-               J(Tind[input](index, state));
-        }
-        // Cost-to-go: J = minᵤ Q(x,u).
-        // Policy:  π(x) = argminᵤ Q(x,u).
-        if (Q < Jnext(state)) {
-          Jnext(state) = Q;
-          best_input = input;
+    // The backup for each state reads only J and the transition tables, and
+    // writes only its own column of Jnext/Pi, so the states can be dealt
+    // round-robin across the workers with no synchronization.
+    RunWorkers(num_threads, [&](int thread_num) {
+      double local_max_diff = 0.;
+      for (int state = thread_num; state < num_states; state += num_threads) {
+        Jnext(state) = std::numeric_limits<double>::infinity();
+
+        int best_input = 0;
+        for (int input = 0; input < num_inputs; input++) {
+          // Q(x,u) = g(x,u) + γ J(f(x,u)).
+          double interpolated_J = 0.;
+          for (int index = 0; index < num_state_indices; index++) {
+            interpolated_J +=
+                T[input](index, state) * J(Tind[input](index, state));
+          }
+          const double Q =
+              cost[input](state) + options.discount_factor * interpolated_J;
+          // Cost-to-go: J = minᵤ Q(x,u).
+          // Policy:  π(x) = argminᵤ Q(x,u).
+          if (Q < Jnext(state)) {
+            Jnext(state) = Q;
+            best_input = input;
+          }
         }
+        Pi.col(state) = input_mesh_points.col(best_input);
+        local_max_diff =
+            std::max(local_max_diff, std::abs(J(state) - Jnext(state)));
       }
-      Pi.col(state) = input_mesh.get_mesh_point(best_input);
-    }
-    max_diff = (J - Jnext).lpNorm<Eigen::Infinity>();
+      worker_max_diff[thread_num] = local_max_diff;
+    });
+    max_diff =
+        *std::max_element(worker_max_diff.begin(), worker_max_diff.end());
     J = Jnext;
     iteration++;
     if (options.visualization_callback) {
@@ -40,6 +40,16 @@ struct DynamicProgrammingOptions {
   /// threshold.
   double convergence_tol = 1e-4;
 
+  /// Number of worker threads used by FittedValueIteration, both to compute
+  /// the transition/cost matrices and to run the value-iteration backups; the
+  /// state grid is partitioned across the workers on each pass.  If <= 0,
+  /// uses std::thread::hardware_concurrency().  When more than one thread is
+  /// requested, the cost_function must be safe to invoke concurrently (each
+  /// worker calls it with its own Context), and the additional workers
+  /// simulate clones of the supplied context using default integrator
+  /// settings (only worker zero reuses the supplied Simulator).
+  int num_threads{1};
+
   /// If callable, this method is invoked during each major iteration of the
   /// dynamic programming algorithm, in order to facilitate e.g. graphical
   /// inspection/debugging of the results.
@@ -34,8 +34,23 @@ InverseDynamics<T>::InverseDynamics(const MultibodyPlant<T>* plant,
                                     &InverseDynamics<T>::CalcOutputForce)
           .get_index();
 
-  // Make context with default parameters.
-  multibody_plant_context_ = plant->CreateDefaultContext();
+  // Scratch workspace for CalcOutputForce(), including the plant context
+  // used to set positions and velocities. Declaring it as a cache entry
+  // gives every Context its own preallocated copy, so that concurrent
+  // evaluations on per-thread Contexts do not interfere; see the "Thread
+  // safety" notes in the System class documentation. The entry is never
+  // Eval()'ed -- the workspace is overwritten on every use and never read
+  // across calls -- so its calculator is a no-op and it has no
+  // prerequisites.
+  workspace_cache_index_ =
+      this->DeclareCacheEntry(
+              std::string("inverse dynamics workspace"),
+              [plant]() {
+                return AbstractValue::Make(Workspace(*plant));
+              },
+              [](const ContextBase&, AbstractValue*) {},
+              {this->nothing_ticket()})
+          .cache_index();
 
   // Doesn't declare desired acceleration input port if we are only doing
   // gravity compensation.
@@ -51,37 +66,49 @@ InverseDynamics<T>::~InverseDynamics() = default;
 template <typename T>
 void InverseDynamics<T>::CalcOutputForce(const Context<T>& context,
                                           BasicVector<T>* output) const {
-  // State input.
-  VectorX<T> x = this->EvalEigenVectorInput(context, input_port_index_state_);
-
-  // Desired acceleration input.
-  VectorX<T> desired_vd = VectorX<T>::Zero(v_dim_);
+  auto& plant = *multibody_plant_;
 
-  if (!this->is_pure_gravity_compensation()) {
-    // Only eval acceleration input port when we are not in pure gravity
-    // compensation mode.
-    desired_vd = this->EvalEigenVectorInput(
-        context, input_port_index_desired_acceleration_);
-  } else {
-    // Sets velocity to zero in pure gravity compensation.
-    x.tail(v_dim_).setZero();
-  }
+  // The workspace (including the plant context) belongs to the supplied
+  // context, so that concurrent evaluations on per-thread contexts do not
+  // interfere. It is plain scratch -- overwritten below, never read across
+  // calls -- so it is fetched directly rather than Eval()'ed.
+  Workspace& workspace =
+      this->get_cache_entry(workspace_cache_index_)
+          .get_mutable_cache_entry_value(context)
+          .template GetMutableValueOrThrow<Workspace>();
+  Context<T>& plant_context = *workspace.plant_context;
 
-  auto& plant = *multibody_plant_;
-  // Set the position and velocity in the context.
-  plant.GetMutablePositionsAndVelocities(multibody_plant_context_.get()) = x;
+  // Set the position and velocity in the context from the state input.
+  auto plant_state = plant.GetMutablePositionsAndVelocities(&plant_context);
+  plant_state = this->EvalEigenVectorInput(context, input_port_index_state_);
 
   if (this->is_pure_gravity_compensation()) {
+    // Velocities do not enter the gravity computation; zero them as in the
+    // original formulation of this mode.
+    plant_state.tail(v_dim_).setZero();
     output->get_mutable_value() =
-        -plant.CalcGravityGeneralizedForces(*multibody_plant_context_);
-  } else {
-    // Compute inverse dynamics.
-    multibody::MultibodyForces<T> external_forces(plant);
-    plant.CalcForceElementsContribution(
-        *multibody_plant_context_, &external_forces);
-    output->get_mutable_value() = plant.CalcInverseDynamics(
-        *multibody_plant_context_, desired_vd, external_forces);
+        -plant.CalcGravityGeneralizedForces(plant_context);
+    return;
   }
+
+  // Desired acceleration input.
+  workspace.desired_vd = this->EvalEigenVectorInput(
+      context, input_port_index_desired_acceleration_);
+
+  // Compute inverse dynamics on the preallocated workspace, evaluating the
+  // kinematics once and sharing it between the force element contribution
+  // and the Newton-Euler recursion.
+  const auto& pc = plant.EvalPositionKinematics(plant_context);
+  const auto& vc = plant.EvalVelocityKinematics(plant_context);
+  const auto& tree = multibody::internal::GetInternalTree(plant);
+  tree.CalcForceElementsContribution(plant_context, pc, vc,
+                                     &workspace.external_forces);
+  tree.CalcInverseDynamics(
+      plant_context, pc, vc, workspace.desired_vd,
+      workspace.external_forces.body_forces(),
+      workspace.external_forces.generalized_forces(),
+      &workspace.A_WB_array, &workspace.F_BMo_W_array, &workspace.tau);
+  output->get_mutable_value() = workspace.tau;
 }
 
 template class InverseDynamics<double>;
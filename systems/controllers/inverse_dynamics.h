@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_deprecated.h"
@@ -156,9 +157,49 @@ class InverseDynamics : public LeafSystem<T> {
   // Mode dictates whether to do inverse dynamics or just gravity compensation.
   const InverseDynamicsMode mode_;
 
-  // This context is used solely for setting generalized positions and
-  // velocities in multibody_plant_.
-  std::unique_ptr<Context<T>> multibody_plant_context_;
+  // Scratch space for CalcOutputForce(), preallocated so that evaluations
+  // perform no per-evaluation heap allocation (this system is exercised at
+  // high rates by realtime controllers). Each Context owns its own copy,
+  // via the cache entry declared at construction, so that evaluating one
+  // system against per-thread Contexts is race-free; see the "Thread
+  // safety" notes in the System class documentation. The plant context,
+  // used solely for setting generalized positions and velocities in
+  // multibody_plant_, lives here for the same reason.
+  struct Workspace {
+    explicit Workspace(const multibody::MultibodyPlant<T>& plant)
+        : plant_context(plant.CreateDefaultContext()),
+          external_forces(plant),
+          A_WB_array(plant.num_bodies()),
+          F_BMo_W_array(plant.num_bodies()),
+          desired_vd(plant.num_velocities()),
+          tau(plant.num_velocities()) {}
+
+    Workspace(const Workspace& other)
+        : plant_context(other.plant_context->Clone()),
+          external_forces(other.external_forces),
+          A_WB_array(other.A_WB_array),
+          F_BMo_W_array(other.F_BMo_W_array),
+          desired_vd(other.desired_vd),
+          tau(other.tau) {}
+
+    Workspace& operator=(const Workspace& other) {
+      plant_context = other.plant_context->Clone();
+      external_forces = other.external_forces;
+      A_WB_array = other.A_WB_array;
+      F_BMo_W_array = other.F_BMo_W_array;
+      desired_vd = other.desired_vd;
+      tau = other.tau;
+      return *this;
+    }
+
+    std::unique_ptr<Context<T>> plant_context;
+    multibody::MultibodyForces<T> external_forces;
+    std::vector<multibody::SpatialAcceleration<T>> A_WB_array;
+    std::vector<multibody::SpatialForce<T>> F_BMo_W_array;
+    VectorX<T> desired_vd;
+    VectorX<T> tau;
+  };
+  CacheIndex workspace_cache_index_;
 
   int input_port_index_state_{0};
   int input_port_index_desired_acceleration_{0};
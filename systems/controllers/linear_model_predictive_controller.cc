@@ -4,15 +4,11 @@
 #include <utility>
 
 #include "drake/common/eigen_types.h"
-#include "drake/systems/trajectory_optimization/direct_transcription.h"
 
 namespace drake {
 namespace systems {
 namespace controllers {
 
-using solvers::VectorXDecisionVariable;
-using trajectory_optimization::DirectTranscription;
-
 template <typename T>
 LinearModelPredictiveController<T>::LinearModelPredictiveController(
     std::unique_ptr<systems::System<double>> model,
@@ -66,9 +62,72 @@ LinearModelPredictiveController<T>::LinearModelPredictiveController(
 
   if (base_context_ != nullptr) {
     linear_model_ = Linearize(*model_, *base_context_);
+    CondenseQp();
   }
 }
 
+template <typename T>
+void LinearModelPredictiveController<T>::CondenseQp() {
+  DRAKE_DEMAND(linear_model_ != nullptr);
+
+  const int kNumSampleTimes =
+      static_cast<int>(time_horizon_ / time_period_ + 0.5);
+  DRAKE_DEMAND(kNumSampleTimes > 1);
+
+  // The transcription has state samples x(0)..x(N-1) and input samples
+  // u(0)..u(N-1), with u(N-1) constrained to equal u(N-2), and running cost
+  // ∑_{i=0}^{N-2} x(i)ᵀQx(i) + u(i)ᵀRu(i).  Only u(0)..u(N-2) are free, and
+  // only x(1)..x(N-2) appear in the cost (x(0) is fixed).  (The common
+  // timestep factor in the running cost scales the entire objective and is
+  // omitted here.)
+  const int num_free_inputs = kNumSampleTimes - 1;
+  const int num_predicted_states = kNumSampleTimes - 2;
+
+  const Eigen::MatrixXd& A = linear_model_->A();
+  const Eigen::MatrixXd& B = linear_model_->B();
+
+  // Eliminate the states: stack the predicted states as X = Sx x(0) + Su U,
+  // where U stacks the free input samples, Sx's i-th block row is Aⁱ⁺¹, and
+  // Su's (i,j) block is A^(i-j) B for j ≤ i.
+  Eigen::MatrixXd Sx(num_predicted_states * num_states_, num_states_);
+  Eigen::MatrixXd Su = Eigen::MatrixXd::Zero(
+      num_predicted_states * num_states_, num_free_inputs * num_inputs_);
+  Eigen::MatrixXd A_power = A;
+  for (int i = 0; i < num_predicted_states; i++) {
+    if (i > 0) {
+      // x(i+1) = A x(i) + B u(i): shift the previous block row through A.
+      Su.middleRows(i * num_states_, num_states_).leftCols(i * num_inputs_) =
+          A * Su.middleRows((i - 1) * num_states_, num_states_)
+                  .leftCols(i * num_inputs_);
+    }
+    Su.block(i * num_states_, i * num_inputs_, num_states_, num_inputs_) = B;
+    Sx.middleRows(i * num_states_, num_states_) = A_power;
+    A_power = A * A_power;
+  }
+
+  // Substituting X into the cost gives the condensed objective
+  //   Uᵀ(SuᵀQ̄Su + R̄)U + 2 x(0)ᵀSxᵀQ̄Su U + constant,
+  // with Q̄ and R̄ block-diagonal in Q and R.
+  Eigen::MatrixXd QSu(Su.rows(), Su.cols());
+  Eigen::MatrixXd QSx(Sx.rows(), Sx.cols());
+  for (int i = 0; i < num_predicted_states; i++) {
+    QSu.middleRows(i * num_states_, num_states_) =
+        Q_ * Su.middleRows(i * num_states_, num_states_);
+    QSx.middleRows(i * num_states_, num_states_) =
+        Q_ * Sx.middleRows(i * num_states_, num_states_);
+  }
+  Eigen::MatrixXd hessian = Su.transpose() * QSu;
+  for (int i = 0; i < num_free_inputs; i++) {
+    hessian.block(i * num_inputs_, i * num_inputs_, num_inputs_,
+                  num_inputs_) += R_;
+  }
+  condensed_linear_term_ = Su.transpose() * QSx;
+
+  // R ≻ 0 (checked in the constructor) makes the Hessian positive definite.
+  condensed_hessian_llt_.compute(hessian);
+  DRAKE_DEMAND(condensed_hessian_llt_.info() == Eigen::Success);
+}
+
 template <typename T>
 void LinearModelPredictiveController<T>::CalcControl(
     const Context<T>& context, BasicVector<T>* control) const {
@@ -76,7 +135,7 @@ void LinearModelPredictiveController<T>::CalcControl(
       this->EvalEigenVectorInput(context, state_input_index_);
 
   const Eigen::VectorXd current_input =
-      SetupAndSolveQp(*base_context_, current_state);
+      SolveCondensedQp(*base_context_, current_state);
 
   const VectorX<T> input_ref = model_->EvalEigenVectorInput(*base_context_, 0);
 
@@ -86,29 +145,21 @@ void LinearModelPredictiveController<T>::CalcControl(
 }
 
 template <typename T>
-VectorX<T> LinearModelPredictiveController<T>::SetupAndSolveQp(
+VectorX<T> LinearModelPredictiveController<T>::SolveCondensedQp(
     const Context<T>& base_context, const VectorX<T>& current_state) const {
   DRAKE_DEMAND(linear_model_ != nullptr);
 
-  const int kNumSampleTimes =
-      static_cast<int>(time_horizon_ / time_period_ + 0.5);
-
-  DirectTranscription prog(linear_model_.get(), *base_context_,
-                           kNumSampleTimes);
-
-  const auto state_error = prog.state();
-  const auto input_error = prog.input();
-
-  prog.AddRunningCost(state_error.transpose() * Q_ * state_error +
-                      input_error.transpose() * R_ * input_error);
-
   const VectorX<T> state_ref =
       base_context.get_discrete_state().get_vector().CopyToVector();
-  prog.AddLinearConstraint(prog.initial_state() == current_state - state_ref);
 
-  DRAKE_DEMAND(prog.Solve() == solvers::SolutionResult::kSolutionFound);
+  // Only the linear cost term depends on the current state error; the
+  // Hessian factorization was computed once at construction.
+  const Eigen::VectorXd linear_term =
+      condensed_linear_term_ * (current_state - state_ref);
+  const Eigen::VectorXd input_samples =
+      -condensed_hessian_llt_.solve(linear_term);
 
-  return prog.GetInputSamples().col(0);
+  return input_samples.head(num_inputs_);
 }
 
 template class LinearModelPredictiveController<double>;
@@ -23,9 +23,12 @@ namespace controllers {
 ///
 /// and subject to linear inequality constraints on the inputs and states, where
 /// N is the horizon length, Q and R are cost matrices, and xd and ud are the
-/// desired states and inputs, respectively.  Note that the present
-/// implementation solves the QP in whole at every time step, discarding any
-/// information between steps.
+/// desired states and inputs, respectively.  Since the present formulation is
+/// unconstrained, the program is condensed at construction time into an
+/// equivalent QP over the input samples only (the states are eliminated
+/// through the linearized dynamics), and its Hessian is factorized once; each
+/// control update then costs only a matrix-vector product and a triangular
+/// solve, with the current state entering through the linear cost term alone.
 ///
 /// Instantiated templates for the following kinds of T's are provided:
 ///
@@ -78,10 +81,15 @@ class LinearModelPredictiveController : public LeafSystem<T> {
  private:
   void CalcControl(const Context<T>& context, BasicVector<T>* control) const;
 
-  // Sets up a DirectTranscription problem and solves for the current control
-  // input.
-  VectorX<T> SetupAndSolveQp(const Context<T>& base_context,
-                             const VectorX<T>& current_state) const;
+  // Precomputes the condensed (controls-only) form of the MPC quadratic
+  // program about the linearized model: eliminates the state samples through
+  // the dynamics, and factorizes the resulting dense Hessian.
+  void CondenseQp();
+
+  // Solves the condensed QP for the current control input, given the state
+  // error with respect to the reference in @p base_context.
+  VectorX<T> SolveCondensedQp(const Context<T>& base_context,
+                              const VectorX<T>& current_state) const;
 
   const int state_input_index_{-1};
   const int control_output_index_{-1};
@@ -101,6 +109,13 @@ class LinearModelPredictiveController : public LeafSystem<T> {
 
   // Descrption of the linearized plant model.
   std::unique_ptr<LinearSystem<double>> linear_model_;
+
+  // Cholesky factorization of the condensed Hessian (over the free input
+  // samples), computed once at construction.
+  Eigen::LLT<Eigen::MatrixXd> condensed_hessian_llt_;
+  // Maps the current state error to the condensed linear cost term; a change
+  // of reference at runtime only changes this product.
+  Eigen::MatrixXd condensed_linear_term_;
 };
 
 }  // namespace controllers
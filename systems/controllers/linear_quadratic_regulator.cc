@@ -1,5 +1,11 @@
 #include "drake/systems/controllers/linear_quadratic_regulator.h"
 
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <utility>
+#include <vector>
+
 #include "drake/common/drake_assert.h"
 #include "drake/common/is_approx_equal_abstol.h"
 #include "drake/math/continuous_algebraic_riccati_equation.h"
@@ -140,6 +146,81 @@ std::unique_ptr<systems::AffineSystem<double>> LinearQuadraticRegulator(
       linear_system->time_period());
 }
 
+std::vector<LinearQuadraticRegulatorResult> TrajectoryLinearQuadraticRegulator(
+    const System<double>& system, const Context<double>& context,
+    const trajectories::Trajectory<double>& x_trajectory,
+    const trajectories::Trajectory<double>& u_trajectory,
+    const std::vector<double>& sample_times,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    int num_threads) {
+  DRAKE_DEMAND(system.get_num_input_ports() == 1);
+  const int num_samples = static_cast<int>(sample_times.size());
+  DRAKE_DEMAND(num_samples > 0);
+
+  if (num_threads <= 0) {
+    num_threads =
+        std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  }
+  num_threads = std::min(num_threads, num_samples);
+
+  std::vector<LinearQuadraticRegulatorResult> results(num_samples);
+
+  // Each worker converts the system to AutoDiffXd once (the dominant cost of
+  // a single linearization) and then processes every num_threads-th sample
+  // with its own cloned context; the samples are otherwise independent.
+  std::vector<std::exception_ptr> errors(num_threads);
+  const auto worker = [&](int thread_num) {
+    try {
+      Linearizer linearizer(system);
+      const auto worker_context = context.Clone();
+      for (int i = thread_num; i < num_samples; i += num_threads) {
+        const double t = sample_times[i];
+        worker_context->set_time(t);
+        if (worker_context->get_continuous_state().size() > 0) {
+          worker_context->get_mutable_continuous_state_vector().SetFromVector(
+              x_trajectory.value(t));
+        } else {
+          worker_context->get_mutable_discrete_state(0).SetFromVector(
+              x_trajectory.value(t));
+        }
+        worker_context->FixInputPort(0, u_trajectory.value(t));
+
+        // Use the first input and no outputs (the output dynamics are
+        // irrelevant for LQR design).
+        const auto linearization = linearizer.FirstOrderTaylorApproximation(
+            *worker_context, 0, kNoOutput);
+
+        results[i] =
+            (linearization->time_period() == 0.0)
+                ? LinearQuadraticRegulator(linearization->A(),
+                                           linearization->B(), Q, R)
+                : DiscreteTimeLinearQuadraticRegulator(linearization->A(),
+                                                       linearization->B(), Q,
+                                                       R);
+      }
+    } catch (...) {
+      errors[thread_num] = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 1; i < num_threads; i++) {
+    threads.emplace_back(worker, i);
+  }
+  worker(0);
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  for (const std::exception_ptr& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+  return results;
+}
+
 }  // namespace controllers
 }  // namespace systems
 }  // namespace drake
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
+#include "drake/common/trajectories/trajectory.h"
 #include "drake/systems/primitives/linear_system.h"
 
 namespace drake {
@@ -134,6 +136,45 @@ std::unique_ptr<AffineSystem<double>> LinearQuadraticRegulator(
     const Eigen::Ref<const Eigen::MatrixXd>& N =
         Eigen::Matrix<double, 0, 0>::Zero());
 
+/// Designs a schedule of LQR gains along a trajectory, in one batch call.
+/// For each time in @p sample_times, the nominal state x0(t) and input u0(t)
+/// are taken from @p x_trajectory and @p u_trajectory, @p system is
+/// linearized about that operating point (via a first-order Taylor
+/// approximation, so the samples need not be equilibria), and an
+/// infinite-horizon LQR problem is solved for the linearization, as if
+/// LinearQuadraticRegulator() had been called at each sample.  The expensive
+/// AutoDiffXd conversion of @p system is paid once per worker thread rather
+/// than once per sample, and the samples are solved in parallel.
+///
+/// @param system The System to be controlled.
+/// @param context Defines the parameters of the system.  The state and fixed
+/// input values in this context are not used (they are overwritten by the
+/// trajectory samples on a clone).
+/// @param x_trajectory The nominal state trajectory, with dimension equal to
+/// the number of (continuous or discrete) states of @p system.
+/// @param u_trajectory The nominal input trajectory, with dimension equal to
+/// the size of input port 0 of @p system.
+/// @param sample_times The times at which to schedule the gains.
+/// @param Q A symmetric positive semi-definite cost matrix of size num_states
+/// x num_states.
+/// @param R A symmetric positive definite cost matrix of size num_inputs x
+/// num_inputs.
+/// @param num_threads The number of worker threads; if <= 0, uses
+/// std::thread::hardware_concurrency().
+/// @returns One LinearQuadraticRegulatorResult per entry of
+/// @p sample_times, in order.
+///
+/// @throws std::runtime_error if R is not positive definite.
+/// @ingroup control_systems
+std::vector<LinearQuadraticRegulatorResult> TrajectoryLinearQuadraticRegulator(
+    const System<double>& system, const Context<double>& context,
+    const trajectories::Trajectory<double>& x_trajectory,
+    const trajectories::Trajectory<double>& u_trajectory,
+    const std::vector<double>& sample_times,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    int num_threads = 1);
+
 }  // namespace controllers
 }  // namespace systems
 }  // namespace drake
@@ -96,6 +96,39 @@ GTEST_TEST(FittedValueIterationTest, PeriodicBoundary) {
   EXPECT_TRUE(CompareMatrices(cost_to_go_values, J_expected, 1e-4));
 }
 
+// The multi-threaded solve must produce the same cost-to-go as the
+// single-threaded one (same single-integrator problem as above).
+GTEST_TEST(FittedValueIterationTest, MultiThreaded) {
+  const int kNumStates = 1;
+  Integrator<double> sys(kNumStates);
+
+  Simulator<double> simulator(sys);
+
+  const auto cost_function = [](const Context<double>& context) {
+    double x = context.get_continuous_state()[0];
+    return (std::abs(x) > 0.1) ? 1. : 0.;
+  };
+
+  const math::BarycentricMesh<double>::MeshGrid state_grid(
+      {{-4., -3., -2., -1., 0., 1., 2., 3., 4.}});
+  const math::BarycentricMesh<double>::MeshGrid input_grid({{-1., 0., 1.}});
+
+  const double timestep = 1.0;
+
+  DynamicProgrammingOptions options;
+  options.num_threads = 3;
+
+  std::unique_ptr<BarycentricMeshSystem<double>> policy;
+  Eigen::RowVectorXd cost_to_go_values;
+  std::tie(policy, cost_to_go_values) = FittedValueIteration(
+      &simulator, cost_function, state_grid, input_grid, timestep, options);
+
+  // Optimal cost-to-go is |x|, as in the single-threaded test.
+  Eigen::RowVectorXd J_expected(static_cast<int>(state_grid[0].size()));
+  J_expected << 4., 3., 2., 1., 0., 1., 2., 3., 4.;
+  EXPECT_TRUE(CompareMatrices(cost_to_go_values, J_expected, 1e-8));
+}
+
 // Plot in Matlab.  (Costs little here and is very useful for any future
 // debugging).
 void VisualizationCallback(int iteration,
@@ -1,8 +1,11 @@
 #include "drake/systems/controllers/linear_quadratic_regulator.h"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/trajectories/piecewise_polynomial.h"
 #include "drake/systems/primitives/linear_system.h"
 
 namespace drake {
@@ -196,6 +199,43 @@ GTEST_TEST(TestLQR, DiscreteDoubleIntegrator) {
   TestLQRAffineSystemAgainstKnownSolution(tol, sys, K, Q, R);
 }
 
+// The batch trajectory version must reproduce the single-point solution at
+// every sample (here along a constant trajectory at the origin of the double
+// integrator, so that every sample has the same known answer).
+GTEST_TEST(TestLQR, TrajectoryMatchesPointwiseSolution) {
+  Eigen::Matrix2d A;
+  Eigen::Vector2d B;
+  A << 0, 1, 0, 0;
+  B << 0, 1;
+  LinearSystem<double> sys(A, B, Eigen::Matrix<double, 0, 2>::Zero(),
+                           Eigen::Matrix<double, 0, 1>::Zero());
+
+  const Eigen::Matrix2d Q = Eigen::Matrix2d::Identity();
+  const Vector1d R = Vector1d::Identity();
+
+  const LinearQuadraticRegulatorResult pointwise =
+      LinearQuadraticRegulator(A, B, Q, R);
+
+  const trajectories::PiecewisePolynomial<double> x_trajectory(
+      Eigen::Vector2d::Zero());
+  const trajectories::PiecewisePolynomial<double> u_trajectory(
+      Vector1d::Zero());
+  const std::vector<double> sample_times{0., 0.5, 1., 1.5, 2.};
+
+  auto context = sys.CreateDefaultContext();
+  const std::vector<LinearQuadraticRegulatorResult> results =
+      TrajectoryLinearQuadraticRegulator(sys, *context, x_trajectory,
+                                         u_trajectory, sample_times, Q, R,
+                                         2 /* num_threads */);
+
+  const double tol = 1e-10;
+  ASSERT_EQ(results.size(), sample_times.size());
+  for (const auto& result : results) {
+    EXPECT_TRUE(CompareMatrices(result.K, pointwise.K, tol));
+    EXPECT_TRUE(CompareMatrices(result.S, pointwise.S, tol));
+  }
+}
+
 }  // namespace
 }  // namespace controllers
 }  // namespace systems
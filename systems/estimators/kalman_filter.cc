@@ -1,6 +1,8 @@
 #include "drake/systems/estimators/kalman_filter.h"
 
+#include <algorithm>
 #include <utility>
+#include <vector>
 
 #include "drake/common/drake_assert.h"
 #include "drake/math/continuous_algebraic_riccati_equation.h"
@@ -22,6 +24,108 @@ Eigen::MatrixXd SteadyStateKalmanFilter(
   return P * C.transpose() * V.inverse();
 }
 
+namespace {
+
+constexpr int kMaxNewtonIterations{10};
+constexpr double kNewtonTolerance{1e-12};
+
+// Returns true iff every eigenvalue of F has a strictly negative real part.
+bool IsHurwitz(const Eigen::MatrixXd& F) {
+  const Eigen::EigenSolver<Eigen::MatrixXd> eigensolver(F, false);
+  return eigensolver.eigenvalues().real().maxCoeff() < 0.;
+}
+
+// Solves the continuous Lyapunov equation F X + X Fᵀ + Q = 0 for symmetric X
+// via the Kronecker-product linear system (I ⊗ F + F ⊗ I) vec(X) = -vec(Q).
+// The dense O(n⁶) solve is acceptable for the modest state dimensions that
+// estimator synthesis sweeps use, and each solve is far cheaper than a full
+// Riccati solve at the same dimension.
+Eigen::MatrixXd SolveLyapunov(const Eigen::MatrixXd& F,
+                              const Eigen::MatrixXd& Q) {
+  const int n = static_cast<int>(F.rows());
+  const Eigen::MatrixXd identity = Eigen::MatrixXd::Identity(n, n);
+  Eigen::MatrixXd M = Eigen::MatrixXd::Zero(n * n, n * n);
+  for (int i = 0; i < n; ++i) {
+    // (I ⊗ F) contributes F to the i-th diagonal block.
+    M.block(i * n, i * n, n, n) += F;
+    // (F ⊗ I) contributes F(i, j) I to block (i, j).
+    for (int j = 0; j < n; ++j) {
+      M.block(i * n, j * n, n, n) += F(i, j) * identity;
+    }
+  }
+  const Eigen::VectorXd vec_Q =
+      Eigen::Map<const Eigen::VectorXd>(Q.data(), n * n);
+  const Eigen::VectorXd vec_X = M.partialPivLu().solve(-vec_Q);
+  Eigen::MatrixXd X = Eigen::Map<const Eigen::MatrixXd>(vec_X.data(), n, n);
+  // Symmetrize to scrub numerical asymmetry.
+  return (X + X.transpose()) / 2.;
+}
+
+// Refines the observer Riccati solution A P + P Aᵀ - P Cᵀ V⁻¹ C P + W = 0 by
+// Newton-Kleinman iteration starting from the guess @p P_guess (typically a
+// neighboring linearization's solution).  Each iteration solves one Lyapunov
+// equation and converges quadratically near the solution.  Returns true and
+// writes the solution to @p P_out on success; returns false if the guess does
+// not stabilize the error dynamics or the iteration fails to converge, in
+// which case the caller should fall back to the full Riccati solve.
+bool WarmStartedKalmanRiccati(const Eigen::MatrixXd& A,
+                              const Eigen::MatrixXd& C,
+                              const Eigen::Ref<const Eigen::MatrixXd>& W,
+                              const Eigen::Ref<const Eigen::MatrixXd>& V,
+                              const Eigen::LLT<Eigen::MatrixXd>& V_llt,
+                              const Eigen::MatrixXd& P_guess,
+                              Eigen::MatrixXd* P_out) {
+  Eigen::MatrixXd P = P_guess;
+  for (int iteration = 0; iteration < kMaxNewtonIterations; ++iteration) {
+    // L = P Cᵀ V⁻¹ (P and V are symmetric).
+    const Eigen::MatrixXd L = V_llt.solve(C * P).transpose();
+    const Eigen::MatrixXd F = A - L * C;
+    if (!IsHurwitz(F)) {
+      return false;
+    }
+    const Eigen::MatrixXd P_next =
+        SolveLyapunov(F, W + L * V * L.transpose());
+    const double delta = (P_next - P).norm();
+    P = P_next;
+    if (delta <= kNewtonTolerance * std::max(1., P.norm())) {
+      *P_out = P;
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+std::vector<Eigen::MatrixXd> BatchSteadyStateKalmanFilter(
+    const std::vector<Eigen::MatrixXd>& A,
+    const std::vector<Eigen::MatrixXd>& C,
+    const Eigen::Ref<const Eigen::MatrixXd>& W,
+    const Eigen::Ref<const Eigen::MatrixXd>& V) {
+  DRAKE_DEMAND(A.size() == C.size());
+
+  // The measurement covariance factorization is shared across the batch.
+  const Eigen::LLT<Eigen::MatrixXd> V_llt(V);
+
+  std::vector<Eigen::MatrixXd> gains;
+  gains.reserve(A.size());
+  Eigen::MatrixXd P;
+  bool have_neighbor_solution = false;
+  for (size_t k = 0; k < A.size(); ++k) {
+    const bool warm_start_succeeded =
+        have_neighbor_solution &&
+        WarmStartedKalmanRiccati(A[k], C[k], W, V, V_llt, P, &P);
+    if (!warm_start_succeeded) {
+      P = math::ContinuousAlgebraicRiccatiEquation(A[k].transpose(),
+                                                   C[k].transpose(), W, V);
+      have_neighbor_solution = true;
+    }
+    // L = P Cᵀ V⁻¹ (P and V are symmetric).
+    gains.push_back(V_llt.solve(C[k] * P).transpose());
+  }
+  return gains;
+}
+
 std::unique_ptr<LuenbergerObserver<double>> SteadyStateKalmanFilter(
     std::unique_ptr<LinearSystem<double>> system,
     const Eigen::Ref<const Eigen::MatrixXd>& W,
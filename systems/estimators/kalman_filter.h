@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include <Eigen/Dense>
 
@@ -40,6 +41,34 @@ Eigen::MatrixXd SteadyStateKalmanFilter(
     const Eigen::Ref<const Eigen::MatrixXd>& W,
     const Eigen::Ref<const Eigen::MatrixXd>& V);
 
+/// Computes the steady-state observer gains for a batch of linearizations in
+/// one call.  The k-th entry of the result is the gain for the pair
+/// (A[k], C[k]) with the common noise covariances @p W and @p V, as if
+/// SteadyStateKalmanFilter(A[k], C[k], W, V) had been called for each entry.
+///
+/// When consecutive linearizations are close -- as for neighboring operating
+/// points in a parameter sweep -- each Riccati solution is obtained by
+/// warm-starting a Newton iteration from the previous entry's solution, which
+/// typically converges in a few Lyapunov solves instead of a full Riccati
+/// solve.  Entries whose warm start fails to converge (e.g. across a large
+/// jump in the sweep) fall back to the full Riccati solve, so the result is
+/// identical either way up to the solver tolerance.
+///
+/// @param A The state-space dynamics matrices, each num_states x num_states.
+/// @param C The state-space output matrices, each num_outputs x num_states.
+/// @param W The process noise covariance matrix, E[ww'], of size num_states x
+/// num_states.
+/// @param V The measurement noise covariance matrix, E[vv'], of size num_.
+/// @returns One observer gain matrix per entry of @p A, in order.
+///
+/// @throws std::runtime_error if V is not positive definite.
+/// @ingroup estimator_systems
+std::vector<Eigen::MatrixXd> BatchSteadyStateKalmanFilter(
+    const std::vector<Eigen::MatrixXd>& A,
+    const std::vector<Eigen::MatrixXd>& C,
+    const Eigen::Ref<const Eigen::MatrixXd>& W,
+    const Eigen::Ref<const Eigen::MatrixXd>& V);
+
 /// Creates a Luenberger observer system using the optimal steady-state Kalman
 /// filter gain matrix, L, as described above.
 ///
@@ -19,7 +19,9 @@ LuenbergerObserver<T>::LuenbergerObserver(
       observed_system_context_(std::move(observed_system_context)),
       observed_system_output_(observed_system_->AllocateOutput()),
       observed_system_derivatives_(
-          observed_system_->AllocateTimeDerivatives()) {
+          observed_system_->AllocateTimeDerivatives()),
+      innovation_(observed_system_->get_output_port(0).size()),
+      correction_(observed_system_context_->get_continuous_state().size()) {
   DRAKE_DEMAND(observed_system_ != nullptr);
 
   // Note: Could potentially extend this to MIMO systems.
@@ -61,6 +63,10 @@ LuenbergerObserver<T>::LuenbergerObserver(
     auto input_vec = observed_system_->AllocateInputVector(
         observed_system_->get_input_port(0));
     this->DeclareVectorInputPort(*input_vec);
+    // Fix the observed system's input once here; DoCalcTimeDerivatives()
+    // overwrites the fixed value in place instead of re-allocating it.
+    observed_system_input_ =
+        &observed_system_context_->FixInputPort(0, *input_vec);
   }
 }
 
@@ -78,12 +84,10 @@ void LuenbergerObserver<T>::DoCalcTimeDerivatives(
   // from the observer state/inputs.  The observer_context does not hold any
   // hidden undeclared state).
 
-  // Set observed system input.
-  if (observed_system_->get_num_input_ports() > 0) {
-    // TODO(russt): Avoid this dynamic allocation by fixing the input port once
-    // and updating it here.
-    observed_system_context_->FixInputPort(
-        0, this->EvalVectorInput(context, 1)->CopyToVector());
+  // Set observed system input, overwriting the fixed port value in place.
+  if (observed_system_input_ != nullptr) {
+    observed_system_input_->GetMutableVectorData<T>()->SetFromVector(
+        this->EvalVectorInput(context, 1)->get_value());
   }
   // Set observed system state.
   observed_system_context_->get_mutable_continuous_state_vector().SetFrom(
@@ -95,16 +99,15 @@ void LuenbergerObserver<T>::DoCalcTimeDerivatives(
   observed_system_->CalcTimeDerivatives(*observed_system_context_,
                                         observed_system_derivatives_.get());
 
-  // Get the measurements.
-  auto y = this->EvalVectorInput(context, 0)->CopyToVector();
-  auto yhat = observed_system_output_->GetMutableVectorData(0)->CopyToVector();
-
-  // Add in the observed gain terms.
-  auto& xdothat = observed_system_derivatives_->get_mutable_vector();
+  // The innovation is the measurement error, y - yhat.
+  innovation_ = this->EvalVectorInput(context, 0)->get_value() -
+                observed_system_output_->get_vector_data(0)->get_value();
 
-  // xdothat = f(xhat,u) + L(y-yhat).
-  derivatives->SetFromVector(xdothat.CopyToVector() +
-                             observer_gain_ * (y - yhat));
+  // xdothat = f(xhat,u) + L(y-yhat), assembled into preallocated storage.
+  correction_.get_mutable_value().noalias() = observer_gain_ * innovation_;
+  auto& xdothat = derivatives->get_mutable_vector();
+  xdothat.SetFrom(observed_system_derivatives_->get_vector());
+  xdothat += correction_;
 }
 
 }  // namespace estimators
@@ -77,6 +77,18 @@ class LuenbergerObserver : public systems::LeafSystem<T> {
   const std::unique_ptr<systems::SystemOutput<T>> observed_system_output_;
   const std::unique_ptr<systems::ContinuousState<T>>
   observed_system_derivatives_;
+
+  // The observed system's input port is fixed once at construction; its value
+  // is overwritten in place on every derivative evaluation.  Owned by
+  // observed_system_context_; nullptr when the observed system has no input.
+  FixedInputPortValue* observed_system_input_{nullptr};
+
+  // Preallocated workspace for DoCalcTimeDerivatives so that the update path
+  // performs no heap allocation.  The method already mutates
+  // observed_system_context_ and so is not reentrant; these members do not
+  // change that.
+  mutable VectorX<T> innovation_;
+  mutable BasicVector<T> correction_;
 };
 
 }  // namespace estimators
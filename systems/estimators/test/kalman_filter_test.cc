@@ -1,5 +1,7 @@
 #include "drake/systems/estimators/kalman_filter.h"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -56,6 +58,36 @@ GTEST_TEST(TestKalman, DoubleIntegrator) {
   EXPECT_TRUE(CompareMatrices(filter->L(), L, tol));
 }
 
+GTEST_TEST(TestKalman, BatchMatchesSingle) {
+  // A sweep of second-order systems with slowly varying stiffness, damping,
+  // and output matrices, as produced by linearizing along a parameter sweep.
+  // The neighboring entries exercise the warm-started Newton path; each gain
+  // must match the one-at-a-time synthesis.
+  std::vector<Eigen::MatrixXd> A;
+  std::vector<Eigen::MatrixXd> C;
+  const int kNumOperatingPoints = 5;
+  for (int k = 0; k < kNumOperatingPoints; ++k) {
+    Eigen::Matrix2d Ak;
+    Ak << 0, 1, -0.1 * k, -0.2 * k;
+    Eigen::Matrix<double, 1, 2> Ck;
+    Ck << 1, 0.01 * k;
+    A.push_back(Ak);
+    C.push_back(Ck);
+  }
+
+  Eigen::Matrix2d W = Eigen::Matrix2d::Identity();
+  Vector1d V;
+  V << 1;
+
+  const std::vector<Eigen::MatrixXd> gains =
+      BatchSteadyStateKalmanFilter(A, C, W, V);
+  ASSERT_EQ(gains.size(), A.size());
+  for (int k = 0; k < kNumOperatingPoints; ++k) {
+    EXPECT_TRUE(CompareMatrices(
+        gains[k], SteadyStateKalmanFilter(A[k], C[k], W, V), 1e-8));
+  }
+}
+
 }  // namespace
 
 }  // namespace estimators
@@ -108,6 +108,13 @@ class BasicVector : public VectorBase<T> {
 
   VectorX<T> CopyToVector() const override { return values_; }
 
+  void CopyToPreallocatedVector(Eigen::Ref<VectorX<T>> vec) const override {
+    if (vec.rows() != size()) {
+      throw std::out_of_range("Destination vector must be the same size.");
+    }
+    vec = values_;
+  }
+
   void ScaleAndAddToVector(const T& scale,
                            Eigen::Ref<VectorX<T>> vec) const override {
     if (vec.rows() != size()) {
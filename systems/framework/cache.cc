@@ -57,6 +57,16 @@ void CacheEntryValue::ThrowIfBadOtherValue(
   }
 }
 
+CacheEntryStatistics CacheEntryValue::GetStatistics() const {
+  if (stats_ == nullptr) {
+    throw std::logic_error(FormatName(__func__) +
+                           "instrumentation is not enabled for this entry.");
+  }
+  CacheEntryStatistics result = *stats_;
+  result.description = description();
+  return result;
+}
+
 CacheEntryValue& Cache::CreateNewCacheEntryValue(
     CacheIndex index, DependencyTicket ticket,
     const std::string& description,
@@ -67,16 +77,18 @@ CacheEntryValue& Cache::CreateNewCacheEntryValue(
 
   // Make sure there is a place for this cache entry in the cache.
   if (index >= cache_size())
-    store_.resize(index + 1);
+    store_.resize(index + 1, nullptr);
 
-  // Create the new cache entry value and install it into this Cache. Note that
-  // indirection here means the CacheEntryValue object's address is stable
-  // even when store_ is resized.
+  // Construct the new cache entry value into this Cache's arena. The object's
+  // address is stable even when store_ is resized since store_ holds only
+  // pointers into the arena.
   DRAKE_DEMAND(store_[index] == nullptr);
-  // Can't use make_unique because constructor is private.
-  store_[index] = std::unique_ptr<CacheEntryValue>(
-      new CacheEntryValue(index, ticket, description, owning_subcontext_,
-                          nullptr /* no value yet */));
+  // Placement new here (rather than make_unique) both targets the arena slot
+  // and sidesteps the private constructor, to which only we have access.
+  store_[index] = new (arena_.AllocateRawSlot())
+      CacheEntryValue(index, ticket, description, owning_subcontext_,
+                      nullptr /* no value yet */);
+  arena_.NoteConstructed(store_[index]);
   CacheEntryValue& value = *store_[index];
 
   // Obtain a DependencyTracker for the CacheEntryValue. Normally there will be
@@ -125,6 +137,25 @@ void Cache::SetAllEntriesOutOfDate() {
     if (entry) entry->mark_out_of_date();
 }
 
+void Cache::EnableInstrumentation() {
+  for (auto& entry : store_)
+    if (entry) entry->enable_instrumentation();
+}
+
+void Cache::DisableInstrumentation() {
+  for (auto& entry : store_)
+    if (entry) entry->disable_instrumentation();
+}
+
+std::vector<CacheEntryStatistics> Cache::GetStatistics() const {
+  std::vector<CacheEntryStatistics> result;
+  for (const CacheEntryValue* entry : store_) {
+    if (entry != nullptr && entry->is_instrumentation_enabled())
+      result.push_back(entry->GetStatistics());
+  }
+  return result;
+}
+
 void Cache::RepairCachePointers(
     const internal::ContextMessageInterface* owning_subcontext) {
   DRAKE_DEMAND(owning_subcontext != nullptr);
@@ -6,15 +6,15 @@ values. */
 
 #include <cstdint>
 #include <memory>
+#include <new>
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
-#include "drake/common/copyable_unique_ptr.h"
 #include "drake/common/drake_assert.h"
-#include "drake/common/never_destroyed.h"
 #include "drake/common/reset_on_copy.h"
 #include "drake/systems/framework/framework_common.h"
 #include "drake/systems/framework/value.h"
@@ -24,6 +24,30 @@ namespace systems {
 
 class DependencyGraph;
 
+//==============================================================================
+//                          CACHE ENTRY STATISTICS
+//==============================================================================
+/** Statistics collected for one cache entry value while instrumentation is
+enabled; see CacheEntryValue::enable_instrumentation(). These are intended for
+diagnosing cache performance problems, such as entries that thrash because a
+prerequisite is changing more often than expected, or dependency-ticket bugs
+that silently force recomputation on every access. */
+struct CacheEntryStatistics {
+  /** The human-readable description of the instrumented entry. This is
+  normally identical to the description of the corresponding CacheEntry. */
+  std::string description;
+  /** Number of Eval()-style accesses that were satisfied by the stored
+  value. */
+  int64_t hits{0};
+  /** Number of Eval()-style accesses that had to recompute the stored value,
+  either because it was out of date or because caching was disabled. */
+  int64_t misses{0};
+  /** Number of times this entry was marked out of date. */
+  int64_t invalidations{0};
+  /** Total wall clock time spent recomputing this value, in seconds. */
+  double total_recomputation_seconds{0.};
+};
+
 //==============================================================================
 //                             CACHE ENTRY VALUE
 //==============================================================================
@@ -62,7 +86,22 @@ the contained value even if it is not marked out of date. That should have no
 effect other than to slow computation; if results change, something is wrong.
 There could be a problem with the specification of dependencies, a bug in user
 code such as improper retention of a stale reference, or a bug in the caching
-system. */
+system.
+
+<h4>Copy-on-write cloning</h4>
+
+To make Context cloning cheap for workloads that create many clones (e.g.
+sampling-based planners and rollout-based controllers), the stored value
+object is shared between a %CacheEntryValue and its copies rather than
+deep-copied at copy time. The flags, serial number, and dependency bookkeeping
+are still copied eagerly, so invalidation in one context never affects
+another. A private copy of the shared value object is materialized lazily, on
+the first mutable access through either sharer -- typically the first Calc()
+performed after the clone -- so sharers can never observe one another's
+modifications. One consequence: a reference previously obtained from an
+accessor here remains valid after a clone (shared ownership keeps the object
+alive) but may cease to track further updates once a private copy has been
+materialized; as always, do not retain such references across modifications. */
 class CacheEntryValue {
  public:
   /** @name  Does not allow move or assignment; copy constructor is private. */
@@ -74,7 +113,7 @@ class CacheEntryValue {
 
   /** Destructs the cache value, but does not issue any notifications to
   downstream dependents. */
-  ~CacheEntryValue() = default;
+  ~CacheEntryValue() { delete stats_; }
 
   /** Defines the concrete value type by providing an initial AbstractValue
   object containing an object of the appropriate concrete type. This value
@@ -270,21 +309,26 @@ class CacheEntryValue {
 #ifdef DRAKE_ASSERT_IS_ARMED
     SetValueOrThrowHelper<V>(__func__, new_value);
 #else
-    value_->SetValue<V>(new_value);
+    mutable_value().SetValue<V>(new_value);
 #endif
     ++serial_number_;
     mark_up_to_date();
   }
 
-  /** (Advanced) Swaps ownership of the stored value object with the given
-  one. The value is marked out of date and the serial number is incremented.
-  This is useful for discrete updates of abstract state variables that contain
-  large objects. Both values must be non-null and of the same concrete type but
-  we won't check for errors except in Debug builds. */
+  /** (Advanced) Exchanges the stored value object with the given one. The
+  value is marked out of date and the serial number is incremented. This is
+  useful for discrete updates of abstract state variables that contain large
+  objects. Both values must be non-null and of the same concrete type but we
+  won't check for errors except in Debug builds. Note that because the stored
+  value object may be shared with clones of the owning Context, the value
+  handed back in `other_value` is a copy of the stored value rather than the
+  original object. */
   void swap_value(std::unique_ptr<AbstractValue>* other_value) {
     DRAKE_ASSERT_VOID(ThrowIfNoValuePresent(__func__));
     DRAKE_ASSERT_VOID(ThrowIfBadOtherValue(__func__, other_value));
-    value_.swap(*other_value);
+    std::unique_ptr<AbstractValue> outgoing = value_->Clone();
+    value_ = std::move(*other_value);
+    *other_value = std::move(outgoing);
     ++serial_number_;
     mark_out_of_date();
   }
@@ -338,6 +382,7 @@ class CacheEntryValue {
   even an empty cache entry can be marked out of date. */
   void mark_out_of_date() {
     flags_ |= kValueIsOutOfDate;
+    if (stats_ != nullptr) ++stats_->invalidations;
   }
 
   /** Returns the serial number of the contained value. This counts up every
@@ -413,34 +458,65 @@ class CacheEntryValue {
   }
   //@}
 
-#ifndef DRAKE_DOXYGEN_CXX
-  // (Internal use only) Returns a mutable reference to an unused cache entry
-  // value object, which has no valid CacheIndex or DependencyTicket and has a
-  // meaningless value. The reference is to a singleton %CacheEntryValue and
-  // will always return the same address. You may invoke mark_up_to_date()
-  // harmlessly on this object, but may not depend on its contents in any way as
-  // they may change unexpectedly. The intention is that this object is used as
-  // a common throw-away destination for non-cache DependencyTracker
-  // invalidations so that invalidation can be done unconditionally, and to the
-  // same memory location, for speed.
-  static CacheEntryValue& dummy() {
-    static never_destroyed<CacheEntryValue> dummy;
-    return dummy.access();
+  /** @name              Instrumentation (opt-in)
+  Methods here provide per-entry statistics for diagnosing cache performance
+  problems: hit and miss counts, invalidation counts, and recomputation wall
+  clock time. Instrumentation is off by default and adds a small cost to every
+  invalidation and Eval() of an instrumented entry, so enable it only while
+  investigating. Usually all entries in a Cache are instrumented together
+  using Cache::EnableInstrumentation(), but you can instrument just a single
+  entry if you already know where to look. */
+  //@{
+
+  /** (Advanced) Enables statistics collection for just this cache entry
+  value, with all counters starting at zero. Does nothing if instrumentation
+  is already enabled; the existing counts are retained in that case. Note that
+  instrumentation status and accumulated statistics are _not_ copied when a
+  Context is cloned; re-enable on the clone if needed. */
+  void enable_instrumentation() {
+    if (stats_ == nullptr) stats_ = new CacheEntryStatistics;
+  }
+
+  /** (Advanced) Disables statistics collection for this cache entry value and
+  discards any statistics accumulated so far. */
+  void disable_instrumentation() {
+    delete stats_;
+    stats_ = nullptr;
+  }
+
+  /** (Advanced) Returns `true` if statistics are currently being collected
+  for this cache entry value. */
+  bool is_instrumentation_enabled() const { return stats_ != nullptr; }
+
+  /** (Advanced) Returns a snapshot of the statistics accumulated since
+  instrumentation was enabled, with the description filled in from this
+  entry. Collection continues afterwards; use disable_instrumentation()
+  followed by enable_instrumentation() if you want to reset the counters.
+  @throws std::logic_error if instrumentation is not enabled. */
+  CacheEntryStatistics GetStatistics() const;
+
+  /** (Internal use only) Records that an Eval()-style access was satisfied by
+  the stored value. Does nothing unless instrumentation is enabled; this is
+  invoked by CacheEntry on every cache hit so must stay cheap. */
+  void note_cache_hit() const {
+    if (stats_ != nullptr) ++stats_->hits;
+  }
+
+  /** (Internal use only) Records that an Eval()-style access had to recompute
+  the stored value, and that the recomputation took `elapsed_seconds` of wall
+  clock time. Does nothing unless instrumentation is enabled. */
+  void note_recomputation(double elapsed_seconds) const {
+    if (stats_ != nullptr) {
+      ++stats_->misses;
+      stats_->total_recomputation_seconds += elapsed_seconds;
+    }
   }
-#endif
+  //@}
 
  private:
   // So Cache and no one else can construct and copy CacheEntryValues.
   friend class Cache;
 
-  // Allow these adapters access to our private constructors on our behalf.
-  // TODO(sherm1) These friend declarations allow us to hide constructors we
-  //   don't want users to call. But there is still a loophole in that a user
-  //   could create objects of these types and get access indirectly. Consider
-  //   whether that is a real problem that needs to be solved and if so fix it.
-  friend class never_destroyed<CacheEntryValue>;
-  friend class copyable_unique_ptr<CacheEntryValue>;
-
   // Default constructor can only be used privately to construct an empty
   // CacheEntryValue with description "DUMMY" and a meaningless value.
   CacheEntryValue()
@@ -490,7 +566,7 @@ class CacheEntryValue {
     ThrowIfNoValuePresent(api);
     ThrowIfAlreadyComputed(api);  // *Must* be out of date!
     ++serial_number_;
-    return *value_;
+    return mutable_value();
   }
 
   // Adds a check on the concrete value type also.
@@ -501,10 +577,20 @@ class CacheEntryValue {
 
   // Fully-checked method with API name to use in error messages.
   template <typename T>
-  void SetValueOrThrowHelper(const char* api, const T& new_value) const {
+  void SetValueOrThrowHelper(const char* api, const T& new_value) {
     ThrowIfNoValuePresent(api);
     ThrowIfAlreadyComputed(api);
-    return value_->SetValueOrThrow<T>(new_value);
+    return mutable_value().SetValueOrThrow<T>(new_value);
+  }
+
+  // Returns a mutable reference to the stored value object, materializing a
+  // private copy first if the object is currently shared with a clone of the
+  // owning Context. All mutations of the stored value must funnel through
+  // here; const accessors may continue to read shared storage directly.
+  AbstractValue& mutable_value() {
+    DRAKE_ASSERT(value_ != nullptr);
+    if (value_.use_count() > 1) value_ = value_->Clone();
+    return *value_;
   }
 
   void ThrowIfNoValuePresent(const char* api) const {
@@ -573,22 +659,104 @@ class CacheEntryValue {
   reset_on_copy<const internal::ContextMessageInterface*>
       owning_subcontext_;
 
-  // The value, its serial number, and its validity. The value is copyable so
-  // that we can use a default copy constructor. The serial number is
+  // The value, its serial number, and its validity. The value object is held
+  // by shared_ptr so that the default copy constructor shares it with the
+  // copy (copy-on-write); a private copy is materialized by mutable_value()
+  // on the first mutable access through either sharer. The serial number is
   // 0 on construction but is always >= 1 once we get an initial value.
-  copyable_unique_ptr<AbstractValue> value_;
+  std::shared_ptr<AbstractValue> value_;
   int64_t serial_number_{0};
   int flags_{kValueIsOutOfDate};
+
+  // Statistics accumulated while instrumentation is enabled, or nullptr (the
+  // default) when it is not. Owned here but deliberately not copied when the
+  // owning Context is cloned; the note_*() methods above may write through
+  // this pointer from const accessors since cache statistics, like cache
+  // values, are mutable state.
+  reset_on_copy<CacheEntryStatistics*> stats_;
+};
+
+namespace internal {
+
+//==============================================================================
+//                          CACHE ENTRY VALUE ARENA
+//==============================================================================
+/** (Internal use only) Provides stable, chunked storage for the
+CacheEntryValue objects owned by one Cache. A large diagram's context contains
+hundreds of these small objects; allocating each one separately fragments the
+heap and scatters Eval-heavy inner loops across memory. Instead, the arena
+hands out slots from contiguous chunks, so a context's cache entries are laid
+out (mostly) consecutively and are freed in bulk when the context is
+destroyed. Slot addresses are stable for the life of the arena; chunks are
+never reallocated or reused.
+
+The arena deals only in raw storage -- the owning Cache placement-news each
+CacheEntryValue into a slot (it is the only class with access to the private
+constructors) and then registers the constructed object here so the arena can
+run its destructor. */
+class CacheEntryValueArena {
+ public:
+  CacheEntryValueArena(const CacheEntryValueArena&) = delete;
+  CacheEntryValueArena(CacheEntryValueArena&&) = delete;
+  void operator=(const CacheEntryValueArena&) = delete;
+  void operator=(CacheEntryValueArena&&) = delete;
+
+  CacheEntryValueArena() = default;
+
+  /** Destroys every registered CacheEntryValue, in reverse order of
+  construction, then releases the chunks. */
+  ~CacheEntryValueArena() {
+    for (auto it = constructed_.rbegin(); it != constructed_.rend(); ++it)
+      (*it)->~CacheEntryValue();
+  }
+
+  /** Returns raw storage suitably sized and aligned for one CacheEntryValue.
+  The returned address is stable for the life of this arena. */
+  void* AllocateRawSlot() {
+    if (chunks_.empty() || chunks_.back()->used == kChunkCapacity)
+      chunks_.push_back(std::make_unique<Chunk>());
+    Chunk& chunk = *chunks_.back();
+    return &chunk.slots[chunk.used++];
+  }
+
+  /** Registers a CacheEntryValue that was just constructed into a slot
+  obtained from AllocateRawSlot() so that its destructor runs when this arena
+  is destroyed. */
+  void NoteConstructed(CacheEntryValue* entry) {
+    DRAKE_DEMAND(entry != nullptr);
+    constructed_.push_back(entry);
+  }
+
+ private:
+  // Number of slots per chunk. CacheEntryValue is on the order of 100 bytes
+  // so this keeps chunk allocations well under a page-cluster in size while
+  // still covering a typical leaf context with one chunk.
+  static constexpr int kChunkCapacity = 64;
+
+  struct Chunk {
+    typename std::aligned_storage<sizeof(CacheEntryValue),
+                                  alignof(CacheEntryValue)>::type
+        slots[kChunkCapacity];
+    int used{0};
+  };
+
+  std::vector<std::unique_ptr<Chunk>> chunks_;
+  std::vector<CacheEntryValue*> constructed_;
 };
 
+}  // namespace internal
+
 //==============================================================================
 //                                  CACHE
 //==============================================================================
 /** Stores all the CacheEntryValue objects owned by a particular Context,
-organized to allow fast access using a CacheIndex as an index. Memory addresses
-of CacheEntryValue objects are stable once allocated, but CacheIndex numbers are
-stable even after a Context has been copied so should be preferred as a means
-for identifying particular cache entries. */
+organized to allow fast access using a CacheIndex as an index. The entries are
+allocated from a per-cache arena (see internal::CacheEntryValueArena) so that
+one context's cache entries are laid out contiguously in memory and are freed
+in bulk. Memory addresses of CacheEntryValue objects are stable once
+allocated, but CacheIndex numbers are stable even after a Context has been
+copied so should be preferred as a means for identifying particular cache
+entries. */
 class Cache {
  public:
   /** @name  Does not allow move or assignment; copy constructor is private. */
@@ -659,6 +827,21 @@ class Cache {
     return const_cast<CacheEntryValue&>(get_cache_entry_value(index));
   }
 
+#ifndef DRAKE_DOXYGEN_CXX
+  // (Internal use only) Returns a mutable reference to this cache's unused
+  // "dummy" cache entry value object, which has no valid CacheIndex or
+  // DependencyTicket and has a meaningless value. You may invoke
+  // mark_up_to_date() harmlessly on this object, but may not depend on its
+  // contents in any way as they may change unexpectedly. The intention is that
+  // this object is used as a common throw-away destination for this context's
+  // non-cache DependencyTracker invalidations so that invalidation can be done
+  // unconditionally, and to the same memory location, for speed. Each Cache
+  // owns its own dummy (rather than sharing a static one) so that invalidation
+  // sweeps running concurrently in different Context trees never write to
+  // shared memory.
+  CacheEntryValue& dummy_cache_entry_value() { return dummy_; }
+#endif
+
   /** (Advanced) Disables caching for all the entries in this %Cache. Note that
   this is done by setting individual `is_disabled` flags in the entries, so it
   can be changed on a per-entry basis later. This has no effect on the
@@ -678,6 +861,23 @@ class Cache {
   normal caching behavior resumes. */
   void SetAllEntriesOutOfDate();
 
+  /** (Advanced) Enables statistics collection for every entry in this %Cache.
+  Note that this is done by allocating per-entry statistics in the entries, so
+  instrumentation can be changed on a per-entry basis later. See
+  CacheEntryValue::enable_instrumentation() for details and costs. */
+  void EnableInstrumentation();
+
+  /** (Advanced) Disables statistics collection for every entry in this %Cache
+  and discards any statistics accumulated so far. */
+  void DisableInstrumentation();
+
+  /** (Advanced) Returns a snapshot of the statistics for every instrumented
+  entry in this %Cache, in CacheIndex order; entries that are not being
+  instrumented are omitted. Each snapshot is keyed by the entry's
+  human-readable description, which is normally identical to that of the
+  corresponding CacheEntry. */
+  std::vector<CacheEntryStatistics> GetStatistics() const;
+
  private:
   // So ContextBase and no one else can copy a Cache.
   friend class ContextBase;
@@ -686,8 +886,23 @@ class Cache {
   // contents but with the "owning subcontext" back pointers set to null. Those
   // must be set properly using RepairCachePointers() once the new subcontext is
   // available. This should only be invoked by ContextBase code as part of
-  // copying an entire Context tree.
-  Cache(const Cache& source) = default;
+  // copying an entire Context tree. The copied entries are constructed into
+  // this cache's own arena; note that the CacheEntryValue copy constructor
+  // shares the stored value objects with the source (see "Copy-on-write
+  // cloning" in the CacheEntryValue documentation).
+  Cache(const Cache& source) {
+    store_.reserve(source.store_.size());
+    for (const CacheEntryValue* source_entry : source.store_) {
+      if (source_entry == nullptr) {
+        store_.push_back(nullptr);
+        continue;
+      }
+      auto* entry = new (arena_.AllocateRawSlot()) CacheEntryValue(
+          *source_entry);
+      arena_.NoteConstructed(entry);
+      store_.push_back(entry);
+    }
+  }
 
   // Assumes `this` %Cache is a recent copy that does not yet have its pointers
   // to the system name-providing service of the new owning Context, and sets
@@ -701,8 +916,19 @@ class Cache {
   reset_on_copy<const internal::ContextMessageInterface*>
       owning_subcontext_;
 
-  // All CacheEntryValue objects, indexed by CacheIndex.
-  std::vector<copyable_unique_ptr<CacheEntryValue>> store_;
+  // Provides the storage for the CacheEntryValue objects; must outlive the
+  // pointers in store_ below.
+  internal::CacheEntryValueArena arena_;
+
+  // All CacheEntryValue objects, indexed by CacheIndex. These are non-owning
+  // pointers into arena_, where the objects live until this Cache is
+  // destroyed.
+  std::vector<CacheEntryValue*> store_;
+
+  // The throw-away invalidation target shared by this context's non-cache
+  // DependencyTrackers; see dummy_cache_entry_value() above. This is always
+  // default-constructed, even when this Cache is a copy.
+  CacheEntryValue dummy_;
 };
 
 }  // namespace systems
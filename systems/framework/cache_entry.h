@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <set>
@@ -140,7 +141,11 @@ class CacheEntry {
   // called *a lot*.
   const AbstractValue& EvalAbstract(const ContextBase& context) const {
     const CacheEntryValue& cache_value = get_cache_entry_value(context);
-    if (cache_value.needs_recomputation()) UpdateValue(context);
+    if (cache_value.needs_recomputation()) {
+      UpdateValue(context);
+    } else {
+      cache_value.note_cache_hit();  // Does nothing unless instrumented.
+    }
     return cache_value.get_abstract_value();
   }
 
@@ -260,7 +265,15 @@ class CacheEntry {
         get_mutable_cache_entry_value(context);
     AbstractValue& value = mutable_cache_value.GetMutableAbstractValueOrThrow();
     // If Calc() throws a recoverable exception, the cache remains out of date.
-    Calc(context, &value);
+    if (!mutable_cache_value.is_instrumentation_enabled()) {
+      Calc(context, &value);
+    } else {
+      using Clock = std::chrono::steady_clock;
+      const Clock::time_point start = Clock::now();
+      Calc(context, &value);
+      mutable_cache_value.note_recomputation(
+          std::chrono::duration<double>(Clock::now() - start).count());
+    }
     mutable_cache_value.mark_up_to_date();
   }
 
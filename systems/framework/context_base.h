@@ -233,7 +233,8 @@ class ContextBase : public internal::ContextMessageInterface {
   q, all states, all inputs, etc.). We can't allocate trackers for individual
   discrete & abstract states, parameters, or input ports since we don't yet
   know how many there are. */
-  ContextBase() : cache_(this), graph_(this) {
+  ContextBase()
+      : cache_(this), graph_(this, &cache_.dummy_cache_entry_value()) {
     CreateBuiltInTrackers();
   }
 
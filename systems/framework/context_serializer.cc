@@ -0,0 +1,253 @@
+#include "drake/systems/framework/context_serializer.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace drake {
+namespace systems {
+namespace {
+
+// Identifies a snapshot produced by this class ("DCTX"), plus a format
+// version for defensive checking.
+constexpr uint32_t kMagic = 0x44435458;
+constexpr int32_t kVersion = 1;
+
+// Appends the raw bytes of a trivially-copyable scalar to the buffer.
+template <typename U>
+void Write(U value, std::vector<uint8_t>* out) {
+  const auto* const bytes = reinterpret_cast<const uint8_t*>(&value);
+  out->insert(out->end(), bytes, bytes + sizeof(U));
+}
+
+void WriteString(const std::string& value, std::vector<uint8_t>* out) {
+  Write<int32_t>(static_cast<int32_t>(value.size()), out);
+  out->insert(out->end(), value.begin(), value.end());
+}
+
+void WriteVector(const Eigen::VectorXd& value, std::vector<uint8_t>* out) {
+  Write<int32_t>(static_cast<int32_t>(value.size()), out);
+  const auto* const bytes = reinterpret_cast<const uint8_t*>(value.data());
+  out->insert(out->end(), bytes, bytes + value.size() * sizeof(double));
+}
+
+// Sequentially decodes a snapshot buffer, throwing std::runtime_error on any
+// attempt to read past the end.
+class Reader {
+ public:
+  explicit Reader(const std::vector<uint8_t>& buffer) : buffer_(buffer) {}
+
+  template <typename U>
+  U Read() {
+    U value;
+    CopyOut(&value, sizeof(U));
+    return value;
+  }
+
+  std::string ReadString() {
+    const int32_t size = ReadCount();
+    std::string value(size, '\0');
+    if (size > 0) CopyOut(&value[0], size);
+    return value;
+  }
+
+  Eigen::VectorXd ReadVector() {
+    const int32_t size = ReadCount();
+    Eigen::VectorXd value(size);
+    if (size > 0) CopyOut(value.data(), size * sizeof(double));
+    return value;
+  }
+
+  std::vector<uint8_t> ReadPayload() {
+    const int32_t size = ReadCount();
+    std::vector<uint8_t> payload(size);
+    if (size > 0) CopyOut(payload.data(), size);
+    return payload;
+  }
+
+  // Reads a non-negative element count.
+  int32_t ReadCount() {
+    const int32_t count = Read<int32_t>();
+    if (count < 0) ThrowMalformed();
+    return count;
+  }
+
+  bool done() const { return cursor_ == buffer_.size(); }
+
+  static void ThrowMalformed() {
+    throw std::runtime_error(
+        "ContextSerializer::Deserialize(): the snapshot is malformed.");
+  }
+
+ private:
+  void CopyOut(void* destination, size_t size) {
+    if (cursor_ + size > buffer_.size()) ThrowMalformed();
+    std::memcpy(destination, buffer_.data() + cursor_, size);
+    cursor_ += size;
+  }
+
+  const std::vector<uint8_t>& buffer_;
+  size_t cursor_{0};
+};
+
+// Throws unless the snapshot quantity matches the context's.
+void ThrowUnlessMatches(const char* quantity, int snapshot_value,
+                        int context_value) {
+  if (snapshot_value != context_value) {
+    throw std::runtime_error(
+        "ContextSerializer::Deserialize(): the snapshot has " +
+        std::to_string(snapshot_value) + " " + quantity +
+        " but the context has " + std::to_string(context_value) + ".");
+  }
+}
+
+}  // namespace
+
+std::vector<uint8_t> ContextSerializer::Serialize(
+    const Context<double>& context) const {
+  std::vector<uint8_t> out;
+  Write<uint32_t>(kMagic, &out);
+  Write<int32_t>(kVersion, &out);
+
+  // Time and accuracy.
+  Write<double>(context.get_time(), &out);
+  const optional<double>& accuracy = context.get_accuracy();
+  Write<uint8_t>(accuracy ? 1 : 0, &out);
+  Write<double>(accuracy.value_or(0.0), &out);
+
+  // Continuous state.
+  WriteVector(context.get_continuous_state_vector().CopyToVector(), &out);
+
+  // Discrete state.
+  const int num_groups = context.get_num_discrete_state_groups();
+  Write<int32_t>(num_groups, &out);
+  for (int i = 0; i < num_groups; ++i)
+    WriteVector(context.get_discrete_state(i).CopyToVector(), &out);
+
+  // Abstract state.
+  const int num_abstract_states = context.get_num_abstract_states();
+  Write<int32_t>(num_abstract_states, &out);
+  for (int i = 0; i < num_abstract_states; ++i)
+    EncodeAbstract(__func__, context.get_abstract_state().get_value(i), &out);
+
+  // Numeric parameters.
+  const int num_numeric = context.num_numeric_parameter_groups();
+  Write<int32_t>(num_numeric, &out);
+  for (int i = 0; i < num_numeric; ++i)
+    WriteVector(context.get_numeric_parameter(i).CopyToVector(), &out);
+
+  // Abstract parameters.
+  const int num_abstract_parameters = context.num_abstract_parameters();
+  Write<int32_t>(num_abstract_parameters, &out);
+  for (int i = 0; i < num_abstract_parameters; ++i)
+    EncodeAbstract(__func__, context.get_abstract_parameter(i), &out);
+
+  return out;
+}
+
+void ContextSerializer::Deserialize(const std::vector<uint8_t>& snapshot,
+                                    Context<double>* context) const {
+  DRAKE_THROW_UNLESS(context != nullptr);
+  Reader reader(snapshot);
+  if (reader.Read<uint32_t>() != kMagic || reader.Read<int32_t>() != kVersion)
+    Reader::ThrowMalformed();
+
+  // Decodes one abstract entry from the snapshot into an existing value,
+  // checking that the stored type matches the value's current type.
+  auto decode_abstract = [this, &reader](AbstractValue* value) {
+    const std::string name = reader.ReadString();
+    if (name != value->GetNiceTypeName()) {
+      throw std::runtime_error(
+          "ContextSerializer::Deserialize(): the snapshot holds an abstract "
+          "value of type '" + name + "' where the context has type '" +
+          value->GetNiceTypeName() + "'.");
+    }
+    auto it = handlers_.find(name);
+    if (it == handlers_.end()) {
+      throw std::logic_error(
+          "ContextSerializer::Deserialize(): no binary encoding has been "
+          "registered for abstract type '" + name +
+          "'; use RegisterType() first.");
+    }
+    it->second.decode(reader.ReadPayload(), value);
+  };
+
+  // Time and accuracy.
+  context->set_time(reader.Read<double>());
+  const bool has_accuracy = reader.Read<uint8_t>() != 0;
+  const double accuracy = reader.Read<double>();
+  if (has_accuracy)
+    context->set_accuracy(accuracy);
+  else
+    context->set_accuracy(nullopt);
+
+  // Continuous state.
+  const Eigen::VectorXd xc = reader.ReadVector();
+  ThrowUnlessMatches("continuous states", static_cast<int>(xc.size()),
+                     context->get_continuous_state_vector().size());
+  context->get_mutable_continuous_state_vector().SetFromVector(xc);
+
+  // Discrete state.
+  const int num_groups = reader.ReadCount();
+  ThrowUnlessMatches("discrete state groups", num_groups,
+                     context->get_num_discrete_state_groups());
+  DiscreteValues<double>& xd = context->get_mutable_discrete_state();
+  for (int i = 0; i < num_groups; ++i) {
+    const Eigen::VectorXd group = reader.ReadVector();
+    ThrowUnlessMatches("discrete states in a group",
+                       static_cast<int>(group.size()),
+                       xd.get_vector(i).size());
+    xd.get_mutable_vector(i).SetFromVector(group);
+  }
+
+  // Abstract state.
+  const int num_abstract_states = reader.ReadCount();
+  ThrowUnlessMatches("abstract states", num_abstract_states,
+                     context->get_num_abstract_states());
+  if (num_abstract_states > 0) {
+    AbstractValues& xa = context->get_mutable_abstract_state();
+    for (int i = 0; i < num_abstract_states; ++i)
+      decode_abstract(&xa.get_mutable_value(i));
+  }
+
+  // Numeric parameters.
+  const int num_numeric = reader.ReadCount();
+  ThrowUnlessMatches("numeric parameter groups", num_numeric,
+                     context->num_numeric_parameter_groups());
+  for (int i = 0; i < num_numeric; ++i) {
+    const Eigen::VectorXd group = reader.ReadVector();
+    ThrowUnlessMatches("numeric parameters in a group",
+                       static_cast<int>(group.size()),
+                       context->get_numeric_parameter(i).size());
+    context->get_mutable_numeric_parameter(i).SetFromVector(group);
+  }
+
+  // Abstract parameters.
+  const int num_abstract_parameters = reader.ReadCount();
+  ThrowUnlessMatches("abstract parameters", num_abstract_parameters,
+                     context->num_abstract_parameters());
+  for (int i = 0; i < num_abstract_parameters; ++i)
+    decode_abstract(&context->get_mutable_abstract_parameter(i));
+
+  if (!reader.done()) Reader::ThrowMalformed();
+}
+
+void ContextSerializer::EncodeAbstract(const char* api,
+                                       const AbstractValue& value,
+                                       std::vector<uint8_t>* out) const {
+  const std::string name = value.GetNiceTypeName();
+  auto it = handlers_.find(name);
+  if (it == handlers_.end()) {
+    throw std::logic_error(
+        std::string("ContextSerializer::") + api +
+        "(): no binary encoding has been registered for abstract type '" +
+        name + "'; use RegisterType() first.");
+  }
+  WriteString(name, out);
+  std::vector<uint8_t> payload;
+  it->second.encode(value, &payload);
+  Write<int32_t>(static_cast<int32_t>(payload.size()), out);
+  out->insert(out->end(), payload.begin(), payload.end());
+}
+
+}  // namespace systems
+}  // namespace drake
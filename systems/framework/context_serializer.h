@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/nice_type_name.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace systems {
+
+/** Converts a Context<double> to and from a compact binary snapshot so that a
+simulation can be checkpointed and later resumed without re-simulating from
+the start, or shipped to another process for distributed rollouts.
+
+A snapshot captures the full value content of a Context tree: time, accuracy,
+continuous state, discrete state, abstract state, and numeric and abstract
+parameters. Diagram contexts are handled transparently since all of those
+quantities are reachable through the root Context.
+
+Numeric quantities are stored natively. Abstract state and abstract
+parameters require a binary encoding for their concrete types, supplied via
+RegisterType(); Serialize() throws if it encounters an abstract value whose
+type has not been registered. Fixed input port values and cached computations
+are deliberately not captured -- inputs are configuration, not state, and the
+cache is recomputed on demand after a restore.
+
+A snapshot records values only, not structure. Deserialize() restores into a
+Context allocated by the same System (or one with identical shapes) and
+throws std::runtime_error if the snapshot does not match the context's
+structure. Restoration goes through the context's normal mutable accessors,
+so all dependent cache entries are properly invalidated.
+
+The snapshot format is a private implementation detail: it is validated with
+a magic number and version, but makes no cross-version or cross-platform
+endianness guarantees beyond "written and read by the same build". */
+class ContextSerializer {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ContextSerializer)
+
+  ContextSerializer() {}
+
+  /** Registers a binary encoding for abstract values of concrete type `T`,
+  covering both abstract state and abstract parameters. The `encode` function
+  must append a representation of its first argument to the given byte
+  vector; `decode` must restore exactly that representation into an existing
+  `T` object. Registering the same `T` again replaces the previous
+  handlers. */
+  template <typename T>
+  void RegisterType(
+      std::function<void(const T&, std::vector<uint8_t>*)> encode,
+      std::function<void(const std::vector<uint8_t>&, T*)> decode) {
+    TypeHandlers handlers;
+    handlers.encode = [encode](const AbstractValue& value,
+                               std::vector<uint8_t>* out) {
+      encode(value.GetValueOrThrow<T>(), out);
+    };
+    handlers.decode = [decode](const std::vector<uint8_t>& payload,
+                               AbstractValue* value) {
+      decode(payload, &value->GetMutableValueOrThrow<T>());
+    };
+    handlers_[NiceTypeName::Get<T>()] = std::move(handlers);
+  }
+
+  /** Returns a binary snapshot of the given context.
+  @throws std::logic_error if the context contains an abstract value whose
+                           type has not been registered. */
+  std::vector<uint8_t> Serialize(const Context<double>& context) const;
+
+  /** Restores a snapshot produced by Serialize() into the given context,
+  which must have been allocated by a System with the same structure as the
+  one that produced the snapshot.
+  @throws std::runtime_error if the snapshot is malformed or does not match
+                             the context's structure.
+  @throws std::logic_error if the snapshot contains an abstract value whose
+                           type has not been registered. */
+  void Deserialize(const std::vector<uint8_t>& snapshot,
+                   Context<double>* context) const;
+
+ private:
+  // Type-erased encode/decode pair for one registered abstract type.
+  struct TypeHandlers {
+    std::function<void(const AbstractValue&, std::vector<uint8_t>*)> encode;
+    std::function<void(const std::vector<uint8_t>&, AbstractValue*)> decode;
+  };
+
+  // Appends the type name and encoded payload of `value` to `out`.
+  void EncodeAbstract(const char* api, const AbstractValue& value,
+                      std::vector<uint8_t>* out) const;
+
+  // Keyed by NiceTypeName of the concrete abstract value type.
+  std::map<std::string, TypeHandlers> handlers_;
+};
+
+}  // namespace systems
+}  // namespace drake
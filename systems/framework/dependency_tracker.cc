@@ -1,25 +1,16 @@
 #include "drake/systems/framework/dependency_tracker.h"
 
 #include <algorithm>
-
-#include "drake/common/unused.h"
+#include <unordered_map>
+#include <unordered_set>
 
 namespace drake {
 namespace systems {
 
-namespace {
-// For debugging use, provide an indent of 2*depth characters.
-std::string Indent(int depth) {
-  std::string s;
-  for (int i = 0; i < depth; ++i) s += "| ";
-  return s;
-}
-}  // namespace
-
 // Our associated value has initiated a change (e.g. the associated value is
 // time and someone advanced time). Short circuit if this is part of a change
-// event that we have already heard about. Otherwise, let the subscribers know
-// that things have changed. Update statistics.
+// event that we have already heard about. Otherwise, let everyone downstream
+// know that things have changed, via the compiled sweep. Update statistics.
 void DependencyTracker::NoteValueChange(int64_t change_event) const {
   DRAKE_SPDLOG_DEBUG(log(), "Tracker '{}' value change event {} ...",
                      GetPathDescription(), change_event);
@@ -33,55 +24,97 @@ void DependencyTracker::NoteValueChange(int64_t change_event) const {
     return;
   }
   last_change_event_ = change_event;
-  NotifySubscribers(change_event, 0);
+  if (!compiled_sweep_.valid) CompileNotificationSweep();
+  RunCompiledSweep(change_event);
 }
 
-// A prerequisite says it has changed. Short circuit if we've already heard
-// about this change event. Otherwise, invalidate the associated cache entry and
-// then pass on the bad news to our subscribers. Update statistics.
-void DependencyTracker::NotePrerequisiteChange(
-    int64_t change_event,
-    const DependencyTracker& prerequisite,
-    int depth) const {
-  unused(Indent);  // Avoid warning in non-Debug builds.
-  DRAKE_SPDLOG_DEBUG(
-      log(), "{}Tracker '{}': prerequisite '{}' changed (event {}) ...",
-      Indent(depth), GetPathDescription(), prerequisite.GetPathDescription(),
-      change_event);
-  DRAKE_ASSERT(change_event > 0);
-  DRAKE_ASSERT(HasPrerequisite(prerequisite));  // Expensive.
+void DependencyTracker::CompileNotificationSweep() const {
+  CompiledSweep& sweep = compiled_sweep_;
+  sweep.nodes.clear();
+  sweep.subscriber_index.clear();
+  sweep.first_edge.clear();
+
+  // Assign a dense index to every tracker reachable downstream from here,
+  // breadth first. Node 0 is this tracker.
+  std::unordered_map<const DependencyTracker*, int> index_of;
+  sweep.nodes.push_back(this);
+  index_of[this] = 0;
+  for (size_t i = 0; i < sweep.nodes.size(); ++i) {
+    for (const DependencyTracker* subscriber : sweep.nodes[i]->subscribers_) {
+      DRAKE_ASSERT(subscriber != nullptr);
+      const int next_index = static_cast<int>(sweep.nodes.size());
+      if (index_of.emplace(subscriber, next_index).second)
+        sweep.nodes.push_back(subscriber);
+    }
+  }
 
-  ++num_prerequisite_notifications_received_;
-  if (last_change_event_ == change_event) {
-    ++num_ignored_notifications_;
-    DRAKE_SPDLOG_DEBUG(log(),
-        "{}... ignoring repeated prereq change notification same change event.",
-        Indent(depth));
-    return;
+  // Concatenate the subscriber lists into one contiguous index array.
+  sweep.first_edge.reserve(sweep.nodes.size() + 1);
+  sweep.first_edge.push_back(0);
+  for (const DependencyTracker* node : sweep.nodes) {
+    for (const DependencyTracker* subscriber : node->subscribers_)
+      sweep.subscriber_index.push_back(index_of[subscriber]);
+    sweep.first_edge.push_back(
+        static_cast<int>(sweep.subscriber_index.size()));
   }
-  last_change_event_ = change_event;
-  // Invalidate associated cache entry value if any.
-  cache_value_->mark_out_of_date();
-  // Follow up with downstream subscribers.
-  NotifySubscribers(change_event, depth);
+
+  sweep.valid = true;
+  DRAKE_SPDLOG_DEBUG(log(),
+      "Tracker '{}' compiled notification sweep: {} nodes, {} edges.",
+      GetPathDescription(), sweep.nodes.size(), sweep.subscriber_index.size());
 }
 
-void DependencyTracker::NotifySubscribers(int64_t change_event,
-                                          int depth) const {
-  DRAKE_SPDLOG_DEBUG(log(), "{}... {} downstream subscribers.{}", Indent(depth),
-                     num_subscribers(),
-                     num_subscribers() > 0 ? " Notifying:" : "");
+void DependencyTracker::RunCompiledSweep(int64_t change_event) const {
+  CompiledSweep& sweep = compiled_sweep_;
+  DRAKE_ASSERT(sweep.valid);
   DRAKE_ASSERT(change_event > 0);
-  DRAKE_ASSERT(depth >= 0);
 
-  for (const DependencyTracker* subscriber : subscribers_) {
-    DRAKE_ASSERT(subscriber != nullptr);
-    DRAKE_SPDLOG_DEBUG(log(), "{}->{}", Indent(depth),
-                       subscriber->GetPathDescription());
-    subscriber->NotePrerequisiteChange(change_event, *this, depth + 1);
+  // Worklist of node indices whose subscribers must still be notified. A
+  // node enters the worklist at most once: when it is first stamped with this
+  // change event (node 0 was stamped by our caller). The worklist lives in
+  // the compiled sweep so that repeated sweeps reuse its capacity; this runs
+  // on every change event and must not touch the heap once warmed up.
+  std::vector<int>& worklist = sweep.worklist;
+  worklist.clear();
+  worklist.reserve(sweep.nodes.size());
+  worklist.push_back(0);
+  while (!worklist.empty()) {
+    const int n = worklist.back();
+    worklist.pop_back();
+    const DependencyTracker& notifier = *sweep.nodes[n];
+    const int first = sweep.first_edge[n];
+    const int last = sweep.first_edge[n + 1];
+    notifier.num_downstream_notifications_sent_ += last - first;
+    for (int e = first; e < last; ++e) {
+      const int s = sweep.subscriber_index[e];
+      const DependencyTracker& subscriber = *sweep.nodes[s];
+      ++subscriber.num_prerequisite_notifications_received_;
+      if (subscriber.last_change_event_ == change_event) {
+        ++subscriber.num_ignored_notifications_;
+        continue;
+      }
+      subscriber.last_change_event_ = change_event;
+      // Invalidate associated cache entry value if any.
+      subscriber.cache_value_->mark_out_of_date();
+      worklist.push_back(s);
+    }
   }
+}
 
-  num_downstream_notifications_sent_ += num_subscribers();
+void DependencyTracker::InvalidateCompiledSweeps() {
+  // Every upstream tracker's sweep embeds this portion of the graph, so all
+  // of them must be recompiled. Diamond patterns require a visited set; this
+  // only runs at setup time when subscriptions change.
+  std::vector<const DependencyTracker*> stack{this};
+  std::unordered_set<const DependencyTracker*> visited{this};
+  while (!stack.empty()) {
+    const DependencyTracker* tracker = stack.back();
+    stack.pop_back();
+    tracker->compiled_sweep_.valid = false;
+    for (const DependencyTracker* prerequisite : tracker->prerequisites_) {
+      if (visited.insert(prerequisite).second) stack.push_back(prerequisite);
+    }
+  }
 }
 
 // Given a DependencyTracker that is supposed to be a prerequisite to this
@@ -111,6 +144,9 @@ void DependencyTracker::AddDownstreamSubscriber(
   DRAKE_ASSERT(subscriber.HasPrerequisite(*this));  // Expensive.
 
   subscribers_.push_back(&subscriber);
+
+  // Any compiled sweep passing through this tracker is now stale.
+  InvalidateCompiledSweeps();
 }
 
 namespace {
@@ -155,6 +191,9 @@ void DependencyTracker::RemoveDownstreamSubscriber(
   DRAKE_ASSERT(!subscriber.HasPrerequisite(*this));  // Expensive.
 
   Remove<const DependencyTracker*>(&subscriber, &subscribers_);
+
+  // Any compiled sweep passing through this tracker is now stale.
+  InvalidateCompiledSweeps();
 }
 
 std::string DependencyTracker::GetPathDescription() const {
@@ -228,6 +267,10 @@ void DependencyTracker::RepairTrackerPointers(
         "Cloned tracker '{}' repairing cache entry {} invalidation to {:#x}.",
         GetPathDescription(), source.cache_value_->cache_index(),
         size_t(cache_value_));
+  } else {
+    // No cache entry to invalidate; use the new context's dummy as the
+    // throw-away invalidation target.
+    cache_value_ = &cache->dummy_cache_entry_value();
   }
 
   // Set the subscriber pointers.
@@ -272,7 +315,9 @@ void DependencyGraph::RepairTrackerPointers(
     const internal::ContextMessageInterface* owning_subcontext,
     Cache* new_cache) {
   DRAKE_DEMAND(owning_subcontext != nullptr);
+  DRAKE_DEMAND(new_cache != nullptr);
   owning_subcontext_ = owning_subcontext;
+  dummy_cache_entry_value_ = &new_cache->dummy_cache_entry_value();
   for (DependencyTicket ticket(0); ticket < trackers_size(); ++ticket) {
     if (!has_tracker(ticket))
       continue;
@@ -126,10 +126,25 @@ nodes. */
 // maintained by the CacheEntryValue object. This is an inner loop activity
 // that must be done very efficiently. It is faster to invalidate with
 // unconditional, inline code than to have a runtime test or abstract interface
-// for cache invalidation. To permit that, we allocate a static dummy
-// CacheEntryValue here, make it available for all non-cache DependencyTrackers
-// to "invalidate", and require that the definition of the cache invalidation
-// method is visible here rather than use an abstract interface to it.
+// for cache invalidation. To permit that, each Context's Cache allocates a
+// dummy CacheEntryValue, which all of that context's non-cache
+// DependencyTrackers "invalidate", and we require that the definition of the
+// cache invalidation method is visible here rather than use an abstract
+// interface to it. The dummy is per-context rather than a process-wide static
+// so that invalidation sweeps running concurrently in different Context trees
+// (a supported use of a const System) never write to shared memory.
+//
+// Rather than performing each invalidation sweep as a recursive walk over the
+// pointer-linked subscriber lists, each tracker that initiates sweeps lazily
+// "compiles" its complete downstream reachable subgraph into dense integer
+// adjacency arrays (see CompiledSweep below). A sweep is then an iterative
+// worklist scan over those contiguous arrays, with the change-event
+// short-circuiting applied per node. This produces exactly the same
+// invalidations and notification statistics as the recursive walk (both are
+// order-independent) but without call-chain overhead or repeated pointer
+// chasing through scattered list nodes. Compiled sweeps are discarded
+// whenever a subscription anywhere in the subgraph changes and are rebuilt on
+// the next sweep.
 
 class DependencyTracker {
  public:
@@ -297,7 +312,8 @@ class DependencyTracker {
   pointer to it here and we'll check that this tracker agrees. If you know which
   cache entry is supposed to be associated with this tracker, supply a pointer
   to that and we'll check it (trackers that are not associated with a real cache
-  entry are still associated with the CacheEntryValue::dummy()). In addition we
+  entry are still associated with their context's dummy CacheEntryValue). In
+  addition we
   check for other internal inconsistencies.
   @throws std::logic_error for anything that goes wrong, with an appropriate
                            explanatory message. */
@@ -312,18 +328,20 @@ class DependencyTracker {
   // (Private because trackers should only be created by DependencyGraph.)
   // Constructs a tracker with a given ticket number, a human-readable
   // description and an optional CacheEntryValue object that should be marked
-  // out-of-date when a prerequisite changes. The description should be of the
-  // associated value only, like "input port 3"; don't include "tracker". The
-  // system pathname service of the owning subcontext must be supplied here and
-  // be non-null.
+  // out-of-date when a prerequisite changes. If there is no associated cache
+  // entry, the owning context's dummy CacheEntryValue is used as a throw-away
+  // invalidation target instead. The description should be of the associated
+  // value only, like "input port 3"; don't include "tracker". The system
+  // pathname service of the owning subcontext must be supplied here and be
+  // non-null.
   DependencyTracker(DependencyTicket ticket, std::string description,
                     const internal::ContextMessageInterface* owning_subcontext,
-                    CacheEntryValue* cache_value)
+                    CacheEntryValue* cache_value, CacheEntryValue* dummy)
       : ticket_(ticket),
         description_(std::move(description)),
         owning_subcontext_(owning_subcontext),
         has_associated_cache_entry_(cache_value != nullptr),
-        cache_value_(cache_value ? cache_value : &CacheEntryValue::dummy()) {
+        cache_value_(cache_value ? cache_value : dummy) {
     DRAKE_SPDLOG_DEBUG(
         log(), "Tracker #{} '{}' constructed {} invalidation {:#x}{}.", ticket_,
         description_, has_associated_cache_entry_ ? "with" : "without",
@@ -338,13 +356,12 @@ class DependencyTracker {
   // unmatchable value for the last change event).
   std::unique_ptr<DependencyTracker> CloneWithoutPointers() const {
     // Can't use make_unique here because constructor is private.
-    std::unique_ptr<DependencyTracker> clone(
-        new DependencyTracker(ticket(), description(), nullptr, nullptr));
+    std::unique_ptr<DependencyTracker> clone(new DependencyTracker(
+        ticket(), description(), nullptr, nullptr, nullptr));
     clone->has_associated_cache_entry_ = has_associated_cache_entry_;
-    // The constructor sets cache_value_ to dummy by default, but that's wrong
-    // if there is an associated cache entry. In that case we'll set it later.
-    if (has_associated_cache_entry_)
-      clone->cache_value_ = nullptr;
+    // The cache_value_ pointer is left null here; RepairTrackerPointers()
+    // sets it to the corresponding cache entry value in the new Context, or
+    // to the new Context's dummy if there is no associated cache entry.
     clone->subscribers_.resize(num_subscribers(), nullptr);
     clone->prerequisites_.resize(num_prerequisites(), nullptr);
     return clone;
@@ -360,23 +377,39 @@ class DependencyTracker {
       const DependencyTracker::PointerMap& tracker_map,
       const internal::ContextMessageInterface* owning_subcontext, Cache* cache);
 
-  // Notifies `this` DependencyTracker that one of its prerequisite values was
-  // modified or made available for mutable access. All of our downstream
-  // subscribers are notified and the associated cache entry (if any) is
-  // invalidated. The unique `change_event` obtained by the initiating value
-  // modification should be passed through here. The particular upstream
-  // `prerequisite` reporting the change is provided here for enforcing
-  // invariants in Debug builds. `depth` measures the notification chain length
-  // and is useful for debugging and performance analysis. An initial caller
-  // should supply `depth`=0; it is incremented internally.
-  void NotePrerequisiteChange(int64_t change_event,
-                              const DependencyTracker& prerequisite,
-                              int depth) const;
-
-  // Notifies downstream subscribers that they are no longer valid. This may
-  // have been initiated by a change to our tracked value or an upstream
-  // prerequisite; downstream subscribers can't tell the difference.
-  void NotifySubscribers(int64_t change_event, int depth) const;
+  // Flattened representation of the complete downstream notification sweep
+  // initiated from this tracker. Every tracker reachable via subscriber edges
+  // is assigned a dense index (this tracker is node 0); the subscriber lists
+  // are concatenated into a single index array delimited by first_edge, CSR
+  // style. The tracker pointers are retained only so the scan can touch each
+  // node's flags, statistics, and cache entry.
+  struct CompiledSweep {
+    bool valid{false};
+    std::vector<const DependencyTracker*> nodes;
+    std::vector<int> subscriber_index;  // Concatenated adjacency lists.
+    std::vector<int> first_edge;        // Size nodes.size() + 1.
+    std::vector<int> worklist;          // Scratch reused by every sweep run.
+  };
+
+  // Builds compiled_sweep_ by breadth-first search over the subscriber lists
+  // starting from this tracker.
+  void CompileNotificationSweep() const;
+
+  // Performs the invalidation sweep for the given change event as an
+  // iterative worklist scan over compiled_sweep_, which must be valid. Each
+  // newly-reached tracker is stamped with the change event, has its
+  // associated cache entry (if any) marked out of date, and notifies all its
+  // subscribers; trackers already stamped with this event ignore the
+  // notification and do not pass it on. Statistics are updated to match what
+  // a recursive edge-by-edge walk would have produced.
+  void RunCompiledSweep(int64_t change_event) const;
+
+  // Discards the compiled sweep of this tracker and of every upstream tracker
+  // (transitively via the prerequisite lists), since those sweeps embed the
+  // portion of the graph that is about to change or just changed. Called
+  // whenever a subscription is added or removed. This is a setup-time
+  // operation; sweeps are rebuilt lazily at the next notification.
+  void InvalidateCompiledSweeps();
 
   std::string GetSystemPathname() const {
     DRAKE_DEMAND(owning_subcontext_!= nullptr);
@@ -396,14 +429,20 @@ class DependencyTracker {
   // Pointer to the system name service of the owning subcontext.
   const internal::ContextMessageInterface* owning_subcontext_{nullptr};
 
-  // If false, cache_value_ will be set to point to CacheEntryValue::dummy() so
-  // we don't need to check during invalidation sweeps.
+  // If false, cache_value_ will be set to point to the owning context's dummy
+  // CacheEntryValue so we don't need to check during invalidation sweeps.
   bool has_associated_cache_entry_{false};
   CacheEntryValue* cache_value_{nullptr};
 
   std::vector<const DependencyTracker*> subscribers_;
   std::vector<const DependencyTracker*> prerequisites_;
 
+  // Lazily-built flattened notification sweep; see CompileNotificationSweep().
+  // Only trackers that actually initiate change events ever build one. This
+  // is a performance optimization that doesn't affect results; hence mutable
+  // is OK.
+  mutable CompiledSweep compiled_sweep_;
+
   // Used for short-circuiting repeated notifications. Does not otherwise change
   // the result; hence mutable is OK. All legitimate change events must be
   // greater than zero, so this will never match.
@@ -451,11 +490,15 @@ class DependencyGraph {
   /** @} */
 
   /** Constructor creates an empty graph referencing the system pathname
-  service of its owning subcontext. The supplied pointer must not be null. */
-  explicit DependencyGraph(
-      const internal::ContextMessageInterface* owning_subcontext)
-      : owning_subcontext_(owning_subcontext) {
+  service of its owning subcontext, and the owning subcontext's dummy cache
+  entry value that serves as the invalidation target for trackers with no
+  associated cache entry. The supplied pointers must not be null. */
+  DependencyGraph(const internal::ContextMessageInterface* owning_subcontext,
+                  CacheEntryValue* dummy_cache_entry_value)
+      : owning_subcontext_(owning_subcontext),
+        dummy_cache_entry_value_(dummy_cache_entry_value) {
     DRAKE_DEMAND(owning_subcontext != nullptr);
+    DRAKE_DEMAND(dummy_cache_entry_value != nullptr);
   }
 
   /** Deletes all DependencyTracker objects; no notifications are issued. */
@@ -478,8 +521,10 @@ class DependencyGraph {
     DRAKE_DEMAND(!has_tracker(known_ticket));
     if (known_ticket >= trackers_size()) graph_.resize(known_ticket + 1);
     // Can't use make_unique here because constructor is private.
-    graph_[known_ticket].reset(new DependencyTracker(
-        known_ticket, std::move(description), owning_subcontext_, cache_value));
+    graph_[known_ticket].reset(
+        new DependencyTracker(known_ticket, std::move(description),
+                              owning_subcontext_, cache_value,
+                              dummy_cache_entry_value_));
     return *graph_[known_ticket];
   }
 
@@ -569,6 +614,11 @@ class DependencyGraph {
   // The system name service of the subcontext that owns this subgraph.
   const internal::ContextMessageInterface* owning_subcontext_{};
 
+  // The owning subcontext's dummy cache entry value, handed to trackers that
+  // have no associated cache entry. Like owning_subcontext_, this is left
+  // null by the copy constructor and set by RepairTrackerPointers().
+  CacheEntryValue* dummy_cache_entry_value_{};
+
   // All value trackers, indexed by DependencyTicket.
   std::vector<std::unique_ptr<DependencyTracker>> graph_;
 };
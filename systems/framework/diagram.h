@@ -26,6 +26,7 @@
 #include "drake/systems/framework/subvector.h"
 #include "drake/systems/framework/system.h"
 #include "drake/systems/framework/system_constraint.h"
+#include "drake/systems/framework/thread_pool.h"
 
 namespace drake {
 namespace systems {
@@ -67,6 +68,39 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
     return result;
   }
 
+  /// (Experimental) Enables concurrent evaluation of subsystem time
+  /// derivatives. The subsystems are partitioned into dependency levels using
+  /// the port connection topology: a subsystem's level is one greater than the
+  /// deepest level among the subsystems feeding its input ports. During
+  /// CalcTimeDerivatives() each level is dispatched to a pool of `num_threads`
+  /// worker threads (zero means use the hardware concurrency), with each task
+  /// confined to its own subcontext; a task also brings its subsystem's output
+  /// ports up to date so that consumers in later levels perform pure cached
+  /// reads.
+  ///
+  /// The context supplied to CalcTimeDerivatives() must have caching enabled
+  /// (see ContextBase::EnableCaching()); with caching disabled, concurrent
+  /// consumers would recompute shared upstream values simultaneously.
+  /// @throws std::logic_error if the subsystem connections form an algebraic
+  ///         loop, which cannot be leveled.
+  void EnableParallelTimeDerivatives(int num_threads = 0) {
+    derivative_levels_ = ComputeDependencyLevels();
+    derivative_thread_pool_ =
+        std::make_unique<internal::ThreadPool>(num_threads);
+  }
+
+  /// Disables the mode enabled by EnableParallelTimeDerivatives(), returning
+  /// to sequential subsystem evaluation and shutting down the worker pool.
+  void DisableParallelTimeDerivatives() {
+    derivative_thread_pool_.reset();
+    derivative_levels_.clear();
+  }
+
+  /// Returns true if EnableParallelTimeDerivatives() is currently in effect.
+  bool parallel_time_derivatives_enabled() const {
+    return derivative_thread_pool_ != nullptr;
+  }
+
   std::multimap<int, int> GetDirectFeedthroughs() const final {
     std::multimap<int, int> pairs;
     for (InputPortIndex u(0); u < this->get_num_input_ports(); ++u) {
@@ -278,6 +312,11 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
     const int n = diagram_derivatives->num_substates();
     DRAKE_DEMAND(num_subsystems() == n);
 
+    if (derivative_thread_pool_ != nullptr) {
+      CalcTimeDerivativesInParallel(*diagram_context, diagram_derivatives);
+      return;
+    }
+
     // Evaluate the derivatives of each constituent system.
     for (SubsystemIndex i(0); i < n; ++i) {
       const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
@@ -886,26 +925,27 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
     *time = std::numeric_limits<double>::infinity();
 
     // Iterate over the subsystems, and harvest the most imminent updates.
-    std::vector<T> times(num_subsystems());
+    // Only the collections of subsystems whose next update time equals the
+    // overall minimum may be left populated; the others are cleared as we
+    // go, retroactively whenever a new minimum is discovered. This runs on
+    // every simulation substep, so we avoid heap-allocating a scratch array
+    // of times here.
     for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
       const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
       CompositeEventCollection<T>& subinfo =
           info->get_mutable_subevent_collection(i);
       const T sub_time =
           registered_systems_[i]->CalcNextUpdateTime(subcontext, &subinfo);
-      times[i] = sub_time;
 
       if (sub_time < *time) {
+        // All the subsystems visited so far update later than this one.
+        for (SubsystemIndex j(0); j < i; ++j)
+          info->get_mutable_subevent_collection(j).Clear();
         *time = sub_time;
+      } else if (sub_time > *time) {
+        subinfo.Clear();
       }
     }
-
-    // For all the subsystems whose next update time is bigger than *time,
-    // clear their event collections.
-    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
-      if (times[i] > *time)
-        info->get_mutable_subevent_collection(i).Clear();
-    }
   }
 
  private:
@@ -1578,6 +1618,86 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
     return static_cast<int>(registered_systems_.size());
   }
 
+  // Partitions the subsystems into dependency levels for parallel execution:
+  // level 0 holds subsystems with no connected inputs from peers; every other
+  // subsystem's level is one greater than the deepest of its producers.
+  // Self-connections are ignored. Kahn-style layering; throws std::logic_error
+  // if the peer connections contain a cycle (an algebraic loop).
+  std::vector<std::vector<SubsystemIndex>> ComputeDependencyLevels() const {
+    const int n = num_subsystems();
+    std::vector<std::set<SubsystemIndex>> consumers_of(n);
+    std::vector<int> num_producers(n, 0);
+    for (const auto& connection : connection_map_) {
+      const SubsystemIndex consumer =
+          GetSystemIndexOrAbort(connection.first.first);
+      const SubsystemIndex producer =
+          GetSystemIndexOrAbort(connection.second.first);
+      if (producer == consumer) continue;
+      if (consumers_of[producer].insert(consumer).second)
+        ++num_producers[consumer];
+    }
+
+    std::vector<int> level(n, 0);
+    std::vector<SubsystemIndex> ready;
+    for (SubsystemIndex i(0); i < n; ++i)
+      if (num_producers[i] == 0) ready.push_back(i);
+    int num_leveled = 0;
+    int max_level = 0;
+    while (!ready.empty()) {
+      const SubsystemIndex producer = ready.back();
+      ready.pop_back();
+      ++num_leveled;
+      max_level = std::max(max_level, level[producer]);
+      for (const SubsystemIndex consumer : consumers_of[producer]) {
+        level[consumer] = std::max(level[consumer], level[producer] + 1);
+        if (--num_producers[consumer] == 0) ready.push_back(consumer);
+      }
+    }
+    if (num_leveled != n) {
+      throw std::logic_error(
+          "Diagram " + this->GetSystemName() +
+          ": cannot enable parallel derivative evaluation because the "
+          "subsystem connections contain an algebraic loop.");
+    }
+
+    std::vector<std::vector<SubsystemIndex>> levels(max_level + 1);
+    for (SubsystemIndex i(0); i < n; ++i) levels[level[i]].push_back(i);
+    return levels;
+  }
+
+  // Parallel flavor of the DoCalcTimeDerivatives() loop. Levels are processed
+  // in dependency order; within a level each task touches only its own
+  // subcontext: it computes the subsystem's derivatives and then evaluates
+  // the subsystem's output ports so that consumers in later levels find them
+  // already cached and perform pure, thread-safe reads.
+  void CalcTimeDerivativesInParallel(
+      const DiagramContext<T>& diagram_context,
+      DiagramContinuousState<T>* diagram_derivatives) const {
+    // Bring this Diagram's own input ports up to date serially; exported
+    // subsystem inputs read them during the parallel phase.
+    for (InputPortIndex i(0); i < this->get_num_input_ports(); ++i)
+      this->EvalAbstractInput(diagram_context, i);
+
+    std::vector<std::function<void()>> tasks;
+    for (const std::vector<SubsystemIndex>& level_systems :
+         derivative_levels_) {
+      tasks.clear();
+      tasks.reserve(level_systems.size());
+      for (const SubsystemIndex i : level_systems) {
+        const System<T>& system = *registered_systems_[i];
+        const Context<T>& subcontext = diagram_context.GetSubsystemContext(i);
+        ContinuousState<T>& subderivatives =
+            diagram_derivatives->get_mutable_substate(i);
+        tasks.push_back([&system, &subcontext, &subderivatives]() {
+          system.CalcTimeDerivatives(subcontext, &subderivatives);
+          for (OutputPortIndex j(0); j < system.get_num_output_ports(); ++j)
+            system.get_output_port(j).EvalAbstract(subcontext);
+        });
+      }
+      derivative_thread_pool_->RunInParallel(tasks);
+    }
+  }
+
   // A map from the input ports of constituent systems, to the output ports of
   // the systems from which they get their values.
   std::map<InputPortLocator, OutputPortLocator> connection_map_;
@@ -1594,6 +1714,12 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   std::vector<InputPortLocator> input_port_ids_;
   std::vector<OutputPortLocator> output_port_ids_;
 
+  // Subsystem dependency levels and the worker pool for parallel derivative
+  // evaluation. Both are empty/null unless EnableParallelTimeDerivatives()
+  // has been called.
+  std::vector<std::vector<SubsystemIndex>> derivative_levels_;
+  std::unique_ptr<internal::ThreadPool> derivative_thread_pool_;
+
   // For all T, Diagram<T> considers DiagramBuilder<T> a friend, so that the
   // builder can set the internal state correctly.
   friend class DiagramBuilder<T>;
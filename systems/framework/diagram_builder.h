@@ -7,6 +7,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -16,6 +17,7 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_throw.h"
 #include "drake/systems/framework/diagram.h"
+#include "drake/systems/framework/diagram_fusion.h"
 #include "drake/systems/framework/system.h"
 
 namespace drake {
@@ -179,6 +181,20 @@ class DiagramBuilder {
     connection_map_[dest_id] = src_id;
   }
 
+  /// Declares every (output port, input port) pairing in @p connections, as
+  /// if Connect(*pair.first, *pair.second) had been called for each entry.
+  /// The wiring tables are sized up front, so programmatically wiring a large
+  /// diagram costs one hash insertion per connection.
+  void Connect(
+      const std::vector<std::pair<const OutputPort<T>*, const InputPort<T>*>>&
+          connections) {
+    connection_map_.reserve(connection_map_.size() + connections.size());
+    for (const auto& pair : connections) {
+      DRAKE_THROW_UNLESS(pair.first != nullptr && pair.second != nullptr);
+      Connect(*pair.first, *pair.second);
+    }
+  }
+
   /// Declares that sole input port on the @p dest system is connected to sole
   /// output port on the @p src system.
   /// @throws std::exception if the sole-port precondition is not met (i.e.,
@@ -253,10 +269,32 @@ class DiagramBuilder {
     return return_id;
   }
 
+  /// Enables a fusion pass that runs when Build() or BuildInto() is called.
+  /// The pass collapses every chain of two or more single-input single-output
+  /// subsystems whose output is a stateless, parameter-free affine function
+  /// of their input (e.g. Gain, PassThrough, single-input Adder) into one
+  /// synthesized leaf system that evaluates the composed affine map in a
+  /// single pass, eliminating the per-subsystem port-resolution, context, and
+  /// cache overhead. Only chains whose interior ports have no fan-out and are
+  /// not exported are fused; all other subsystems are left untouched.
+  ///
+  /// Fused subsystems do not appear in the built Diagram, so they cannot be
+  /// used with per-subsystem queries like Diagram::GetSubsystemContext().
+  /// Pointers previously returned by AddSystem() remain valid, because the
+  /// synthesized system takes over ownership of the subsystems it replaces.
+  /// A Diagram built with fusion enabled cannot be converted to other scalar
+  /// types. Fusion currently has an effect only when `T` = double; for other
+  /// scalar types the pass is a no-op.
+  void EnableFusion() { fusion_enabled_ = true; }
+
+  /// Returns whether EnableFusion() has been called.
+  bool fusion_enabled() const { return fusion_enabled_; }
+
   /// Builds the Diagram that has been described by the calls to Connect,
   /// ExportInput, and ExportOutput.
   /// @throws std::logic_error if the graph is not buildable.
   std::unique_ptr<Diagram<T>> Build() {
+    if (fusion_enabled_) FuseStatelessChains();
     std::unique_ptr<Diagram<T>> diagram(new Diagram<T>(Compile()));
     return diagram;
   }
@@ -268,6 +306,7 @@ class DiagramBuilder {
   /// Only Diagram subclasses should call this method. The target must not
   /// already be initialized.
   void BuildInto(Diagram<T>* target) {
+    if (fusion_enabled_) FuseStatelessChains();
     target->Initialize(Compile());
   }
 
@@ -419,6 +458,16 @@ class DiagramBuilder {
     }
   }
 
+  // Runs the fusion pass enabled by EnableFusion(); see
+  // internal::FuseStatelessAffineChains() for the algorithm. The overload
+  // selected for scalar types other than double is a no-op.
+  void FuseStatelessChains() {
+    internal::DiagramWiring<T> wiring{&registered_systems_, &systems_,
+                                      &connection_map_,     &input_port_ids_,
+                                      &diagram_input_set_,  &output_port_ids_};
+    internal::FuseStatelessAffineChains(wiring);
+  }
+
   // TODO(russt): Implement AddRandomSources method to wire up all dangling
   // random input ports with a compatible RandomSource system.
 
@@ -438,7 +487,10 @@ class DiagramBuilder {
     blueprint->input_port_names = input_port_names_;
     blueprint->output_port_ids = output_port_ids_;
     blueprint->output_port_names = output_port_names_;
-    blueprint->connection_map = connection_map_;
+    // The blueprint keeps the ordered map representation; the one-time
+    // conversion here is cheap relative to diagram construction.
+    blueprint->connection_map.insert(connection_map_.begin(),
+                                     connection_map_.end());
     blueprint->systems = std::move(registered_systems_);
 
     return blueprint;
@@ -450,12 +502,16 @@ class DiagramBuilder {
   std::vector<OutputPortLocator> output_port_ids_;
   std::vector<std::string> output_port_names_;
 
-  // For fast membership queries: has this input port already been declared?
-  std::set<InputPortLocator> diagram_input_set_;
+  // For O(1) membership queries: has this input port already been declared?
+  std::unordered_set<InputPortLocator, internal::PortLocatorHash>
+      diagram_input_set_;
 
   // A map from the input ports of constituent systems, to the output ports of
-  // the systems from which they get their values.
-  std::map<InputPortLocator, OutputPortLocator> connection_map_;
+  // the systems from which they get their values.  Hashed so that the
+  // duplicate-connection check in Connect() stays O(1) as the diagram grows.
+  std::unordered_map<InputPortLocator, OutputPortLocator,
+                     internal::PortLocatorHash>
+      connection_map_;
 
   // A mirror on the systems in the diagram. Should have the same values as
   // registered_systems_. Used for fast membership queries.
@@ -463,6 +519,9 @@ class DiagramBuilder {
   // The Systems in this DiagramBuilder, in the order they were registered.
   std::vector<std::unique_ptr<System<T>>> registered_systems_;
 
+  // Whether EnableFusion() has been called.
+  bool fusion_enabled_{false};
+
   friend int AddRandomInputs(double, systems::DiagramBuilder<double>*);
 };
 
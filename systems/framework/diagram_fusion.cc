@@ -0,0 +1,242 @@
+#include "drake/systems/framework/diagram_fusion.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/symbolic.h"
+#include "drake/common/symbolic_decompose.h"
+#include "drake/systems/framework/basic_vector.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace internal {
+namespace {
+
+using symbolic::Expression;
+using symbolic::Variable;
+
+using InputPortLocator = DiagramWiring<double>::InputPortLocator;
+using OutputPortLocator = DiagramWiring<double>::OutputPortLocator;
+
+// The synthesized leaf that replaces a fused chain. It evaluates the
+// composed affine map y = M u + b in one pass, and owns the subsystems it
+// replaced so that raw pointers handed out by DiagramBuilder::AddSystem()
+// remain valid for the lifetime of the built Diagram.
+class FusedAffineSystem final : public LeafSystem<double> {
+ public:
+  FusedAffineSystem(const Eigen::MatrixXd& M, const Eigen::VectorXd& b,
+                    std::vector<std::unique_ptr<System<double>>> absorbed)
+      : M_(M), b_(b), absorbed_(std::move(absorbed)) {
+    DRAKE_DEMAND(M_.rows() == b_.rows());
+    this->DeclareVectorInputPort(
+        "u0", BasicVector<double>(static_cast<int>(M_.cols())));
+    this->DeclareVectorOutputPort(
+        "y0", BasicVector<double>(static_cast<int>(M_.rows())),
+        &FusedAffineSystem::CalcOutput,
+        {this->input_port_ticket(InputPortIndex(0))});
+  }
+
+ private:
+  void CalcOutput(const Context<double>& context,
+                  BasicVector<double>* output) const {
+    const auto u = this->EvalEigenVectorInput(context, 0);
+    output->get_mutable_value() = M_ * u + b_;
+  }
+
+  const Eigen::MatrixXd M_;
+  const Eigen::VectorXd b_;
+  const std::vector<std::unique_ptr<System<double>>> absorbed_;
+};
+
+struct AffineMap {
+  Eigen::MatrixXd M;
+  Eigen::VectorXd b;
+};
+
+// If `system` is a single-input single-output vector system whose output is
+// a stateless, parameter-free affine function y = M u + b of its input,
+// writes the map into `map` and returns true. The map is extracted by
+// evaluating the symbolic conversion of the system on a vector of variables,
+// so any system convertible to symbolic::Expression is handled uniformly;
+// systems with a non-affine output (e.g. a saturation) fail the affine
+// decomposition and are reported as not fusible.
+bool TryGetAffineMap(const System<double>& system, AffineMap* map) {
+  if (system.get_num_input_ports() != 1 ||
+      system.get_num_output_ports() != 1) {
+    return false;
+  }
+  if (system.get_input_port(0).get_data_type() != kVectorValued ||
+      system.get_output_port(0).get_data_type() != kVectorValued) {
+    return false;
+  }
+  const std::unique_ptr<System<Expression>> symbolic_system =
+      system.ToSymbolicMaybe();
+  if (symbolic_system == nullptr) return false;
+  const std::unique_ptr<Context<Expression>> context =
+      symbolic_system->CreateDefaultContext();
+  if (!context->is_stateless() || context->num_numeric_parameters() > 0 ||
+      context->num_abstract_parameters() > 0) {
+    return false;
+  }
+
+  const int num_inputs = system.get_input_port(0).size();
+  const int num_outputs = system.get_output_port(0).size();
+  VectorX<Variable> vars(num_inputs);
+  VectorX<Expression> input(num_inputs);
+  for (int i = 0; i < num_inputs; ++i) {
+    vars[i] = Variable("u" + std::to_string(i));
+    input[i] = vars[i];
+  }
+  context->FixInputPort(0, input);
+
+  const OutputPort<Expression>& port = symbolic_system->get_output_port(0);
+  const std::unique_ptr<AbstractValue> value = port.Allocate();
+  port.Calc(*context, value.get());
+  const VectorX<Expression> output =
+      value->GetValue<BasicVector<Expression>>().CopyToVector();
+
+  map->M.resize(num_outputs, num_inputs);
+  map->b.resize(num_outputs);
+  try {
+    symbolic::DecomposeAffineExpressions(output, vars, &map->M, &map->b);
+  } catch (const std::exception&) {
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+int FuseStatelessAffineChains(const DiagramWiring<double>& wiring) {
+  auto& connection_map = *wiring.connection_map;
+
+  // Identify the subsystems eligible for fusion and extract their maps.
+  std::map<const System<double>*, AffineMap> affine_maps;
+  for (const auto& system : *wiring.registered_systems) {
+    AffineMap map;
+    if (TryGetAffineMap(*system, &map)) {
+      affine_maps.emplace(system.get(), std::move(map));
+    }
+  }
+  if (affine_maps.size() < 2) return 0;
+
+  // Count the consumers of every output port and note the exported ones; an
+  // output interior to a chain must feed exactly one input and no exports.
+  std::map<OutputPortLocator, int> fan_out;
+  for (const auto& connection : connection_map) ++fan_out[connection.second];
+  const std::set<OutputPortLocator> exported_outputs(
+      wiring.output_port_ids->begin(), wiring.output_port_ids->end());
+
+  // Returns the fusible system feeding `system`'s input through an edge that
+  // is interior to a chain, or nullptr if there is none.
+  auto upstream_in_chain =
+      [&](const System<double>* system) -> const System<double>* {
+    const InputPortLocator input{system, InputPortIndex(0)};
+    const auto it = connection_map.find(input);
+    if (it == connection_map.end()) return nullptr;
+    const OutputPortLocator& source = it->second;
+    if (affine_maps.count(source.first) == 0) return nullptr;
+    if (fan_out[source] != 1) return nullptr;
+    if (exported_outputs.count(source) > 0) return nullptr;
+    return source.first;
+  };
+
+  // A system with an interior edge to some downstream fusible system is not
+  // the tail of its chain.
+  std::set<const System<double>*> has_continuation;
+  for (const auto& entry : affine_maps) {
+    const System<double>* const upstream = upstream_in_chain(entry.first);
+    if (upstream != nullptr) has_continuation.insert(upstream);
+  }
+
+  int num_fused = 0;
+  for (const auto& entry : affine_maps) {
+    const System<double>* const tail = entry.first;
+    if (has_continuation.count(tail) > 0) continue;
+
+    // Walk upstream from the tail to collect the chain. Interior edges have
+    // unit fan-out, so distinct tails always yield disjoint chains, and a
+    // cycle of fusible systems (an algebraic loop, reported later during
+    // compilation) is never entered because every member of such a cycle has
+    // a continuation.
+    std::vector<const System<double>*> chain{tail};
+    for (const System<double>* next = upstream_in_chain(tail);
+         next != nullptr; next = upstream_in_chain(next)) {
+      chain.push_back(next);
+    }
+    if (chain.size() < 2) continue;
+    std::reverse(chain.begin(), chain.end());  // Now head ... tail.
+
+    // Compose the affine maps from head to tail.
+    Eigen::MatrixXd M = affine_maps.at(chain.front()).M;
+    Eigen::VectorXd b = affine_maps.at(chain.front()).b;
+    for (size_t i = 1; i < chain.size(); ++i) {
+      const AffineMap& next = affine_maps.at(chain[i]);
+      b = next.M * b + next.b;
+      M = next.M * M;
+    }
+
+    // Move ownership of the fused subsystems into the synthesized leaf.
+    std::vector<std::unique_ptr<System<double>>> absorbed;
+    std::string name = "fused(";
+    for (const System<double>* link : chain) {
+      if (link != chain.front()) name += "+";
+      name += link->get_name();
+      const auto it = std::find_if(
+          wiring.registered_systems->begin(), wiring.registered_systems->end(),
+          [link](const std::unique_ptr<System<double>>& owned) {
+            return owned.get() == link;
+          });
+      DRAKE_DEMAND(it != wiring.registered_systems->end());
+      absorbed.push_back(std::move(*it));
+      wiring.registered_systems->erase(it);
+      wiring.systems->erase(link);
+    }
+    name += ")";
+
+    auto fused = std::make_unique<FusedAffineSystem>(M, b,
+                                                     std::move(absorbed));
+    fused->set_name(name);
+    const System<double>* const fused_ptr = fused.get();
+    wiring.systems->insert(fused_ptr);
+    wiring.registered_systems->push_back(std::move(fused));
+
+    const System<double>* const head = chain.front();
+    const InputPortLocator head_input{head, InputPortIndex(0)};
+    const OutputPortLocator tail_output{chain.back(), OutputPortIndex(0)};
+    const InputPortLocator fused_input{fused_ptr, InputPortIndex(0)};
+    const OutputPortLocator fused_output{fused_ptr, OutputPortIndex(0)};
+
+    // Rewire. The interior edges simply disappear; everything attached to
+    // the head's input or the tail's output moves to the synthesized system.
+    for (size_t i = 1; i < chain.size(); ++i) {
+      connection_map.erase(InputPortLocator{chain[i], InputPortIndex(0)});
+    }
+    const auto head_source = connection_map.find(head_input);
+    if (head_source != connection_map.end()) {
+      connection_map.emplace(fused_input, head_source->second);
+      connection_map.erase(head_source);
+    }
+    if (wiring.diagram_input_set->erase(head_input) > 0) {
+      wiring.diagram_input_set->insert(fused_input);
+      std::replace(wiring.input_port_ids->begin(),
+                   wiring.input_port_ids->end(), head_input, fused_input);
+    }
+    for (auto& connection : connection_map) {
+      if (connection.second == tail_output) connection.second = fused_output;
+    }
+    std::replace(wiring.output_port_ids->begin(),
+                 wiring.output_port_ids->end(), tail_output, fused_output);
+
+    ++num_fused;
+  }
+  return num_fused;
+}
+
+}  // namespace internal
+}  // namespace systems
+}  // namespace drake
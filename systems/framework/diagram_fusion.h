@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "drake/systems/framework/system.h"
+
+namespace drake {
+namespace systems {
+namespace internal {
+
+/** (Internal use only) Hashes a (system pointer, port index) locator so that
+the DiagramBuilder wiring tables can use O(1) hashed containers. */
+struct PortLocatorHash {
+  template <typename SystemT, typename IndexT>
+  std::size_t operator()(
+      const std::pair<const SystemT*, IndexT>& id) const noexcept {
+    const std::size_t h = std::hash<const void*>()(id.first);
+    // Boost-style combine of the port index into the pointer hash.
+    return h ^ (std::hash<int>()(static_cast<int>(id.second)) + 0x9e3779b9 +
+                (h << 6) + (h >> 2));
+  }
+};
+
+/** (Internal use only) The DiagramBuilder wiring tables that the fusion pass
+rewrites in place. Every pointer aliases the corresponding member of the
+builder that invokes the pass. */
+template <typename T>
+struct DiagramWiring {
+  using InputPortLocator = std::pair<const System<T>*, InputPortIndex>;
+  using OutputPortLocator = std::pair<const System<T>*, OutputPortIndex>;
+
+  std::vector<std::unique_ptr<System<T>>>* registered_systems;
+  std::unordered_set<const System<T>*>* systems;
+  std::unordered_map<InputPortLocator, OutputPortLocator, PortLocatorHash>*
+      connection_map;
+  std::vector<InputPortLocator>* input_port_ids;
+  std::unordered_set<InputPortLocator, PortLocatorHash>* diagram_input_set;
+  std::vector<OutputPortLocator>* output_port_ids;
+};
+
+/** (Internal use only) Implements DiagramBuilder::EnableFusion(). Collapses
+every maximal chain (length ≥ 2) of single-input single-output subsystems
+whose output is a stateless, parameter-free affine function of their input
+into one synthesized leaf system evaluating the composed affine map, and
+rewires the wiring tables accordingly. Interior ports of a chain must have
+no fan-out and must not be exported. Ownership of the replaced subsystems
+moves into the synthesized system, so raw pointers held by callers of
+DiagramBuilder::AddSystem() remain valid. Returns the number of synthesized
+systems (zero when nothing was fused). */
+int FuseStatelessAffineChains(const DiagramWiring<double>& wiring);
+
+/** (Internal use only) Fusion relies on conversion to the symbolic scalar
+type starting from a double-typed system, so for every other scalar type the
+pass is a no-op. */
+template <typename T>
+int FuseStatelessAffineChains(const DiagramWiring<T>&) { return 0; }
+
+}  // namespace internal
+}  // namespace systems
+}  // namespace drake
@@ -3,6 +3,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_assert.h"
@@ -77,6 +78,23 @@ class DiagramOutputPort final : public OutputPort<T> {
     DRAKE_DEMAND(index.is_valid() && ticket.is_valid());
     DRAKE_DEMAND(source_subsystem_index.is_valid());
     DRAKE_DEMAND(source_output_port != nullptr);
+
+    // Compile the evaluation plan: flatten through any intermediate diagram
+    // ports (whose own plans are already flat, since subdiagrams are built
+    // before their parents) so that evaluation reaches the ultimate
+    // non-diagram port with one precomputed subcontext lookup per nesting
+    // level and a single virtual dispatch, instead of a virtual hop and
+    // dynamic_cast at every level.
+    subcontext_path_.push_back(source_subsystem_index);
+    const OutputPort<T>* port = source_output_port;
+    while (const auto* diagram_port =
+               dynamic_cast<const DiagramOutputPort<T>*>(port)) {
+      subcontext_path_.insert(subcontext_path_.end(),
+                              diagram_port->subcontext_path_.begin(),
+                              diagram_port->subcontext_path_.end());
+      port = diagram_port->ultimate_output_port_;
+    }
+    ultimate_output_port_ = port;
   }
 
   ~DiagramOutputPort() final = default;
@@ -94,19 +112,19 @@ class DiagramOutputPort final : public OutputPort<T> {
     return source_output_port_->Allocate();
   }
 
-  // Given the whole Diagram context, extracts the appropriate subcontext and
-  // delegates to the source output port.
+  // Given the whole Diagram context, extracts the ultimate source port's
+  // subcontext and delegates directly to that port.
   void DoCalc(const Context<T>& diagram_context,
               AbstractValue* value) const final {
-    const Context<T>& subcontext = get_subcontext(diagram_context);
-    return source_output_port_->Calc(subcontext, value);
+    const Context<T>& subcontext = get_ultimate_subcontext(diagram_context);
+    return ultimate_output_port_->Calc(subcontext, value);
   }
 
-  // Given he whole Diagram context, extracts the appropriate subcontext and
-  // delegates to the source output port.
+  // Given the whole Diagram context, extracts the ultimate source port's
+  // subcontext and delegates directly to that port.
   const AbstractValue& DoEval(const Context<T>& diagram_context) const final {
-    const Context<T>& subcontext = get_subcontext(diagram_context);
-    return source_output_port_->EvalAbstract(subcontext);
+    const Context<T>& subcontext = get_ultimate_subcontext(diagram_context);
+    return ultimate_output_port_->EvalAbstract(subcontext);
   }
 
   // Returns the source output port's subsystem, and the ticket for that
@@ -115,17 +133,28 @@ class DiagramOutputPort final : public OutputPort<T> {
     return {source_subsystem_index_, source_output_port_->ticket()};
   };
 
-  // Digs out the right subcontext for delegation.
-  const Context<T>& get_subcontext(const Context<T>& diagram_context) const {
-    const DiagramContext<T>* diagram_context_downcast =
-        dynamic_cast<const DiagramContext<T>*>(&diagram_context);
-    DRAKE_DEMAND(diagram_context_downcast != nullptr);
-    return diagram_context_downcast->GetSubsystemContext(
-        source_subsystem_index_);
+  // Follows the compiled subcontext path down to the context of the system
+  // that owns the ultimate output port. Each hop is just an indexed lookup.
+  const Context<T>& get_ultimate_subcontext(
+      const Context<T>& diagram_context) const {
+    const Context<T>* context = &diagram_context;
+    for (const SubsystemIndex index : subcontext_path_) {
+      DRAKE_ASSERT(dynamic_cast<const DiagramContext<T>*>(context) != nullptr);
+      context = &static_cast<const DiagramContext<T>&>(*context)
+                     .GetSubsystemContext(index);
+    }
+    return *context;
   }
 
   const OutputPort<T>* const source_output_port_;
   const SubsystemIndex source_subsystem_index_;
+
+  // The compiled evaluation plan (see the constructor): the chain of
+  // subsystem indices leading from this diagram's context down to the
+  // context of the system that owns ultimate_output_port_, which is the
+  // first non-diagram port reached by following source ports.
+  std::vector<SubsystemIndex> subcontext_path_;
+  const OutputPort<T>* ultimate_output_port_{};
 };
 
 }  // namespace systems
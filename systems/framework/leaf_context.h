@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "drake/common/default_scalars.h"
+#include "drake/common/drake_throw.h"
 #include "drake/systems/framework/basic_vector.h"
 #include "drake/systems/framework/cache.h"
 #include "drake/systems/framework/context.h"
@@ -52,6 +53,45 @@ class LeafContext : public Context<T> {
   using Context<T>::init_parameters;
 #endif
 
+  /// (Advanced) Replaces this context's parameters with a copy-on-write
+  /// overlay that shares the immutable block @p base; see
+  /// Parameters::Parameters(std::shared_ptr<const Parameters<T>>). Clones of
+  /// this context then share `base` as well and deep-copy only the entries
+  /// they modify, which can cut resident memory dramatically when many
+  /// clones with mostly-identical parameters are alive at once. Sends out of
+  /// date notifications for all parameter-dependent computations.
+  ///
+  /// Typical use: allocate a context, snapshot its parameters into a shared
+  /// block with Parameters::Clone(), install the block here, then clone the
+  /// context as many times as needed.
+  ///
+  /// @throws std::logic_error if this context is part of a Diagram, since
+  /// the Diagram's aggregate parameter view would not see the replacement.
+  /// @throws std::runtime_error unless `base` has the same number of numeric
+  /// parameter groups, the same group sizes, and the same number of abstract
+  /// parameters as the current parameters.
+  void SetSharedParameters(std::shared_ptr<const Parameters<T>> base) {
+    DRAKE_THROW_UNLESS(base != nullptr);
+    if (!this->is_root_context()) {
+      throw std::logic_error(
+          "SetSharedParameters(): a context within a Diagram may not replace "
+          "its parameters; the Diagram holds a view into the old ones.");
+    }
+    const Parameters<T>& current = this->get_parameters();
+    DRAKE_THROW_UNLESS(base->num_numeric_parameter_groups() ==
+                       current.num_numeric_parameter_groups());
+    for (int i = 0; i < current.num_numeric_parameter_groups(); ++i) {
+      DRAKE_THROW_UNLESS(base->get_numeric_parameter(i).size() ==
+                         current.get_numeric_parameter(i).size());
+    }
+    DRAKE_THROW_UNLESS(base->num_abstract_parameters() ==
+                       current.num_abstract_parameters());
+    const int64_t change_event = this->start_new_change_event();
+    this->PropagateBulkChange(change_event,
+                              &LeafContext<T>::NoteAllParametersChanged);
+    this->init_parameters(std::make_unique<Parameters<T>>(std::move(base)));
+  }
+
  protected:
   /// Protected copy constructor takes care of the local data members and
   /// all base class members, but doesn't update base class pointers so is
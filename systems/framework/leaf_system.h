@@ -1533,6 +1533,24 @@ class LeafSystem : public System<T> {
                                   kVectorValued, size, random_type);
   }
 
+  /// Declares a vector-valued input port whose size `N` is fixed at compile
+  /// time, using a plain BasicVector of that size as the model vector. Reads
+  /// of the port via EvalEigenVectorInput<N>() return a fixed-size %Eigen
+  /// Map, so small-vector arithmetic in the consuming system compiles to
+  /// fixed-size code. Use the model-vector signature above instead if the
+  /// port requires a subclass of BasicVector.
+  ///
+  /// @tparam N The size of the port.
+  /// @see System::DeclareInputPort() for more information.
+  template <int N>
+  const InputPort<T>& DeclareVectorInputPort(
+      variant<std::string, UseDefaultName> name,
+      optional<RandomDistribution> random_type = nullopt) {
+    static_assert(N >= 0, "The port size must be non-negative.");
+    return DeclareVectorInputPort(std::move(name), BasicVector<T>(N),
+                                  random_type);
+  }
+
   /// Declares an abstract-valued input port using the given @p model_value.
   /// This is the best way to declare LeafSystem abstract input ports.
   ///
@@ -1732,6 +1750,27 @@ class LeafSystem : public System<T> {
     return port;
   }
 
+  /// Declares a vector-valued output port whose size `N` is fixed at compile
+  /// time, using a plain BasicVector of that size as the model vector and the
+  /// given function for calculating the port's value at runtime. This is the
+  /// compile-time-sized companion to DeclareVectorInputPort<N>(); the
+  /// calculator typically writes its result through
+  /// `output->get_mutable_value()`.
+  ///
+  /// @tparam N The size of the port.
+  /// @see LeafOutputPort::CalcVectorCallback
+  template <int N>
+  const OutputPort<T>& DeclareVectorOutputPort(
+      variant<std::string, UseDefaultName> name,
+      typename LeafOutputPort<T>::CalcVectorCallback vector_calc_function,
+      std::set<DependencyTicket> prerequisites_of_calc = {
+          all_sources_ticket()}) {
+    static_assert(N >= 0, "The port size must be non-negative.");
+    return DeclareVectorOutputPort(std::move(name), BasicVector<T>(N),
+                                   std::move(vector_calc_function),
+                                   std::move(prerequisites_of_calc));
+  }
+
   /// Declares an abstract-valued output port by specifying a model value of
   /// concrete type `OutputType` and a calculator function that is a class
   /// member function (method) with signature:
@@ -1761,6 +1800,43 @@ class LeafSystem : public System<T> {
     return port;
   }
 
+  /// Declares an abstract-valued output port by specifying a model value of
+  /// concrete type `OutputType` and a calculator function that is a class
+  /// member function (method) returning its result by value, with signature:
+  /// @code
+  /// OutputType MySystem::CalcOutputValue(const Context<T>&) const;
+  /// @endcode
+  /// where `MySystem` must be a class derived from `LeafSystem<T>`.
+  /// `OutputType` must be such that `Value<OutputType>` is permitted. The
+  /// returned value is _moved_ into the port's cache entry, so a calculator
+  /// that builds a large value (an image, a point cloud, contact results)
+  /// into a local variable pays no copy; prefer this signature over the
+  /// output-argument one when the calculator cannot usefully update the
+  /// previous value in place. Downstream Eval() calls return a reference to
+  /// the single cached value, so fan-out consumers share it without further
+  /// copying.
+  /// Template arguments will be deduced and do not need to be specified.
+  /// @see drake::systems::Value
+  template <class MySystem, typename OutputType>
+  const OutputPort<T>& DeclareAbstractOutputPort(
+      variant<std::string, UseDefaultName> name, const OutputType& model_value,
+      OutputType (MySystem::*calc)(const Context<T>&) const,
+      std::set<DependencyTicket> prerequisites_of_calc = {
+          all_sources_ticket()}) {
+    auto this_ptr = dynamic_cast<const MySystem*>(this);
+    DRAKE_DEMAND(this_ptr != nullptr);
+
+    auto& port = CreateAbstractLeafOutputPort(
+        NextOutputPortName(std::move(name)), MakeAllocCallback(model_value),
+        [this_ptr, calc](const Context<T>& context, AbstractValue* result) {
+          // The calculator's return value is a prvalue, so this is a move
+          // assignment into the cache entry, not a copy.
+          result->GetMutableValue<OutputType>() = (this_ptr->*calc)(context);
+        },
+        std::move(prerequisites_of_calc));
+    return port;
+  }
+
   /// Declares an abstract-valued output port by specifying only a calculator
   /// function that is a class member function (method) with signature:
   /// @code
@@ -1796,6 +1872,36 @@ class LeafSystem : public System<T> {
                                      std::move(prerequisites_of_calc));
   }
 
+  /// Declares an abstract-valued output port by specifying only a calculator
+  /// function that is a class member function (method) returning its result
+  /// by value, with signature:
+  /// @code
+  /// OutputType MySystem::CalcOutputValue(const Context<T>&) const;
+  /// @endcode
+  /// where `MySystem` is a class derived from `LeafSystem<T>`. `OutputType`
+  /// is a concrete type such that `Value<OutputType>` is permitted, and
+  /// must be default constructible, so that we can create a model value using
+  /// `Value<OutputType>{}`. The returned value is _moved_ into the port's
+  /// cache entry; see the nearly identical signature with a model value for
+  /// discussion.
+  /// Template arguments will be deduced and do not need to be specified.
+  /// @see drake::systems::Value
+  template <class MySystem, typename OutputType>
+  const OutputPort<T>& DeclareAbstractOutputPort(
+      variant<std::string, UseDefaultName> name,
+      OutputType (MySystem::*calc)(const Context<T>&) const,
+      std::set<DependencyTicket> prerequisites_of_calc = {
+          all_sources_ticket()}) {
+    static_assert(
+        std::is_default_constructible<OutputType>::value,
+        "LeafSystem::DeclareAbstractOutputPort(calc): the one-argument form of "
+        "this method requires that the output type has a default constructor");
+    // Note that value initialization {} is required here.
+    return DeclareAbstractOutputPort(NextOutputPortName(std::move(name)),
+                                     OutputType{}, calc,
+                                     std::move(prerequisites_of_calc));
+  }
+
   /// Declares an abstract-valued output port by specifying member functions to
   /// use both for the allocator and calculator. The signatures are:
   /// @code
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "drake/common/default_scalars.h"
+#include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_deprecated.h"
 #include "drake/systems/framework/abstract_values.h"
@@ -23,6 +24,20 @@ namespace systems {
 ///
 /// The Parameters include both vector-valued and abstract-valued elements.
 ///
+/// <h3>Copy-on-write sharing</h3>
+///
+/// When many contexts with mostly-identical parameters must be alive at once
+/// (for example, a fleet of simulation rollouts that randomize only a few
+/// entries), a %Parameters object may be constructed as a _copy-on-write
+/// overlay_ over a reference-counted immutable base block; see
+/// Parameters(std::shared_ptr<const Parameters<T>>). An overlay initially
+/// shares every entry of its base and materializes a private copy of an
+/// entry only on first mutable access. Clone() preserves the sharing, so
+/// cloning a Context whose parameters were set up this way costs storage
+/// only for the entries each clone actually modifies. See
+/// LeafContext::SetSharedParameters() for installing an overlay in a
+/// context.
+///
 /// @tparam T A mathematical type compatible with Eigen's Scalar.
 template <typename T>
 class Parameters {
@@ -63,6 +78,23 @@ class Parameters {
         abstract_parameters_(
             std::make_unique<AbstractValues>(std::move(value))) {}
 
+  /// (Advanced) Constructs a copy-on-write overlay over the immutable
+  /// parameter block @p base. The overlay initially shares every entry of
+  /// `base`; the first mutable access to an entry replaces it with a private
+  /// deep copy, leaving the remaining entries shared. Clone() preserves the
+  /// sharing: clones refer to the same base block and deep-copy only the
+  /// entries that have been materialized here.
+  ///
+  /// The caller must not modify `base` for as long as any overlay refers
+  /// to it.
+  explicit Parameters(std::shared_ptr<const Parameters<T>> base)
+      : base_(std::move(base)) {
+    DRAKE_DEMAND(base_ != nullptr);
+    numeric_overlays_.resize(base_->num_numeric_parameter_groups());
+    abstract_overlays_.resize(base_->num_abstract_parameters());
+    RebuildOverlayViews();
+  }
+
   virtual ~Parameters() {}
 
   int num_numeric_parameter_groups() const {
@@ -86,8 +118,17 @@ class Parameters {
   }
 
   /// Returns the vector-valued parameter at @p index. Asserts if the index
-  /// is out of bounds.
+  /// is out of bounds. If this object is a copy-on-write overlay and the
+  /// entry is still shared, a private copy is materialized first.
   BasicVector<T>& get_mutable_numeric_parameter(int index) {
+    if (base_ != nullptr) {
+      DRAKE_ASSERT(index >= 0 &&
+                   index < static_cast<int>(numeric_overlays_.size()));
+      if (numeric_overlays_[index] == nullptr) {
+        numeric_overlays_[index] = base_->get_numeric_parameter(index).Clone();
+        RebuildOverlayViews();
+      }
+    }
     return numeric_parameters_->get_mutable_vector(index);
   }
 
@@ -98,6 +139,7 @@ class Parameters {
   void set_numeric_parameters(
       std::unique_ptr<DiscreteValues<T>> numeric_params) {
     DRAKE_DEMAND(numeric_params != nullptr);
+    DetachFromBase();
     numeric_parameters_ = std::move(numeric_params);
   }
 
@@ -108,8 +150,18 @@ class Parameters {
   }
 
   /// Returns the abstract-valued parameter at @p index. Asserts if the index
-  /// is out of bounds.
+  /// is out of bounds. If this object is a copy-on-write overlay and the
+  /// entry is still shared, a private copy is materialized first.
   AbstractValue& get_mutable_abstract_parameter(int index) {
+    if (base_ != nullptr) {
+      DRAKE_ASSERT(index >= 0 &&
+                   index < static_cast<int>(abstract_overlays_.size()));
+      if (abstract_overlays_[index] == nullptr) {
+        abstract_overlays_[index] =
+            base_->get_abstract_parameter(index).Clone();
+        RebuildOverlayViews();
+      }
+    }
     return abstract_parameters_->get_mutable_value(index);
   }
 
@@ -134,11 +186,33 @@ class Parameters {
   void set_abstract_parameters(
       std::unique_ptr<AbstractValues> abstract_params) {
     DRAKE_DEMAND(abstract_params != nullptr);
+    DetachFromBase();
     abstract_parameters_ = std::move(abstract_params);
   }
 
-  /// Returns a deep copy of the Parameters.
+  /// (Advanced) Returns true if this object is a copy-on-write overlay that
+  /// still refers to a shared base block.
+  bool has_shared_base() const { return base_ != nullptr; }
+
+  /// Returns a copy of the Parameters. An ordinary object is copied in full;
+  /// a copy-on-write overlay produces another overlay over the same base
+  /// block, deep-copying only the entries materialized here.
   std::unique_ptr<Parameters<T>> Clone() const {
+    if (base_ != nullptr) {
+      auto clone = std::make_unique<Parameters<T>>(base_);
+      for (int i = 0; i < static_cast<int>(numeric_overlays_.size()); ++i) {
+        if (numeric_overlays_[i] != nullptr) {
+          clone->numeric_overlays_[i] = numeric_overlays_[i]->Clone();
+        }
+      }
+      for (int i = 0; i < static_cast<int>(abstract_overlays_.size()); ++i) {
+        if (abstract_overlays_[i] != nullptr) {
+          clone->abstract_overlays_[i] = abstract_overlays_[i]->Clone();
+        }
+      }
+      clone->RebuildOverlayViews();
+      return clone;
+    }
     auto clone = std::make_unique<Parameters<T>>();
     clone->set_numeric_parameters(numeric_parameters_->Clone());
     clone->set_abstract_parameters(abstract_parameters_->Clone());
@@ -147,15 +221,75 @@ class Parameters {
 
   /// Initializes this state (regardless of scalar type) from a
   /// Parameters<double>. All scalar types in Drake must support
-  /// initialization from doubles.
+  /// initialization from doubles. If this object is a copy-on-write overlay
+  /// it is detached from its base first, since every entry is overwritten.
   void SetFrom(const Parameters<double>& other) {
+    DetachFromBase();
     numeric_parameters_->SetFrom(other.get_numeric_parameters());
     abstract_parameters_->CopyFrom(other.get_abstract_parameters());
   }
 
  private:
+  // Points the DiscreteValues and AbstractValues members of a copy-on-write
+  // overlay at the current entries: the private copy where one has been
+  // materialized, the shared base entry otherwise. The const_casts are safe
+  // because every mutable path through this class materializes a private
+  // copy before handing out a mutable reference.
+  void RebuildOverlayViews() {
+    DRAKE_DEMAND(base_ != nullptr);
+    std::vector<BasicVector<T>*> numeric;
+    for (int i = 0; i < static_cast<int>(numeric_overlays_.size()); ++i) {
+      numeric.push_back(
+          numeric_overlays_[i] != nullptr
+              ? numeric_overlays_[i].get()
+              : const_cast<BasicVector<T>*>(
+                    &base_->get_numeric_parameter(i)));
+    }
+    std::vector<AbstractValue*> abstract;
+    for (int i = 0; i < static_cast<int>(abstract_overlays_.size()); ++i) {
+      abstract.push_back(
+          abstract_overlays_[i] != nullptr
+              ? abstract_overlays_[i].get()
+              : const_cast<AbstractValue*>(
+                    &base_->get_abstract_parameter(i)));
+    }
+    numeric_parameters_ = std::make_unique<DiscreteValues<T>>(numeric);
+    abstract_parameters_ = std::make_unique<AbstractValues>(abstract);
+  }
+
+  // Converts a copy-on-write overlay into an ordinary self-contained block
+  // by deep-copying every still-shared entry, then drops the reference to
+  // the base block. No-op for an ordinary Parameters object.
+  void DetachFromBase() {
+    if (base_ == nullptr) return;
+    std::vector<std::unique_ptr<BasicVector<T>>> numeric;
+    for (int i = 0; i < num_numeric_parameter_groups(); ++i) {
+      numeric.push_back(get_numeric_parameter(i).Clone());
+    }
+    std::vector<std::unique_ptr<AbstractValue>> abstract;
+    for (int i = 0; i < num_abstract_parameters(); ++i) {
+      abstract.push_back(get_abstract_parameter(i).Clone());
+    }
+    numeric_parameters_ =
+        std::make_unique<DiscreteValues<T>>(std::move(numeric));
+    abstract_parameters_ =
+        std::make_unique<AbstractValues>(std::move(abstract));
+    numeric_overlays_.clear();
+    abstract_overlays_.clear();
+    base_ = nullptr;
+  }
+
   std::unique_ptr<DiscreteValues<T>> numeric_parameters_;
   std::unique_ptr<AbstractValues> abstract_parameters_;
+
+  // Non-null iff this object is a copy-on-write overlay. The base block is
+  // immutable and jointly owned by every overlay that refers to it.
+  std::shared_ptr<const Parameters<T>> base_;
+
+  // One slot per base entry; a non-null slot holds this overlay's private
+  // copy of that entry. Both vectors are empty when base_ is null.
+  std::vector<std::unique_ptr<BasicVector<T>>> numeric_overlays_;
+  std::vector<std::unique_ptr<AbstractValue>> abstract_overlays_;
 };
 
 }  // namespace systems
@@ -10,6 +10,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
 #include "drake/systems/framework/vector_base.h"
 
 namespace drake {
@@ -19,6 +20,12 @@ namespace systems {
 /// VectorBase by concatenating multiple VectorBases, which it
 /// does not own.
 ///
+/// Whole-vector operations such as SetFromVector(), CopyToVector(), and
+/// PlusEqScaled() are implemented block-wise, visiting each constituent
+/// subvector just once so that contiguous subvectors (e.g. BasicVector) are
+/// processed with unit-stride Eigen operations. Only random access through
+/// GetAtIndex() pays for per-element resolution through the lookup table.
+///
 /// @tparam T A mathematical type compatible with Eigen's Scalar.
 template <typename T>
 class Supervector : public VectorBase<T> {
@@ -51,7 +58,91 @@ class Supervector : public VectorBase<T> {
     return target.first->GetAtIndex(target.second);
   }
 
+  void SetFrom(const VectorBase<T>& value) override {
+    DRAKE_THROW_UNLESS(value.size() == size());
+    // When `value` is a supervector with our exact partition (e.g. the same
+    // diagram's state and its time derivatives), copy subvector-by-subvector.
+    const auto* const other = dynamic_cast<const Supervector<T>*>(&value);
+    if (other != nullptr && other->lookup_table_ == lookup_table_) {
+      for (int i = 0; i < num_subvectors(); ++i)
+        vectors_[i]->SetFrom(*other->vectors_[i]);
+      return;
+    }
+    VectorBase<T>::SetFrom(value);
+  }
+
+  void SetFromVector(const Eigen::Ref<const VectorX<T>>& value) override {
+    DRAKE_THROW_UNLESS(value.rows() == size());
+    for (int i = 0; i < num_subvectors(); ++i) {
+      vectors_[i]->SetFromVector(
+          value.segment(subvector_offset(i), subvector_size(i)));
+    }
+  }
+
+  void SetZero() override {
+    for (VectorBase<T>* vec : vectors_) vec->SetZero();
+  }
+
+  VectorX<T> CopyToVector() const override {
+    VectorX<T> vec = VectorX<T>::Zero(size());
+    ScaleAndAddToVector(T(1), vec);
+    return vec;
+  }
+
+  void ScaleAndAddToVector(const T& scale,
+                           Eigen::Ref<VectorX<T>> vec) const override {
+    if (vec.rows() != size()) {
+      throw std::out_of_range("Addends must be the same size.");
+    }
+    for (int i = 0; i < num_subvectors(); ++i) {
+      vectors_[i]->ScaleAndAddToVector(
+          scale, vec.segment(subvector_offset(i), subvector_size(i)));
+    }
+  }
+
+  T NormInf() const override {
+    using std::max;
+    T norm(0);
+    for (const VectorBase<T>* vec : vectors_) norm = max(norm, vec->NormInf());
+    return norm;
+  }
+
+ protected:
+  void DoPlusEqScaled(const std::initializer_list<
+                      std::pair<T, const VectorBase<T>&>>& rhs_scale) override {
+    // The integrator hot path adds supervectors with our exact partition
+    // (e.g. xc += dt * xcdot). Check for that first; if every operand
+    // matches, accumulate subvector-by-subvector -- one pass per operand,
+    // with each block using its own efficient implementation. Any
+    // differently-structured operand sends the whole sum to the base class's
+    // elementwise accumulation.
+    for (const auto& operand : rhs_scale) {
+      const auto* const other =
+          dynamic_cast<const Supervector<T>*>(&operand.second);
+      if (other == nullptr || other->lookup_table_ != lookup_table_) {
+        VectorBase<T>::DoPlusEqScaled(rhs_scale);
+        return;
+      }
+    }
+    for (const auto& operand : rhs_scale) {
+      const auto& other = static_cast<const Supervector<T>&>(operand.second);
+      for (int i = 0; i < num_subvectors(); ++i)
+        vectors_[i]->PlusEqScaled(operand.first, *other.vectors_[i]);
+    }
+  }
+
  private:
+  int num_subvectors() const { return static_cast<int>(vectors_.size()); }
+
+  // Returns the offset of subvector `i` within this supervector, and its
+  // size, recovered from the cumulative-sum lookup table.
+  int subvector_offset(int i) const {
+    return (i == 0) ? 0 : lookup_table_[i - 1];
+  }
+  int subvector_size(int i) const {
+    return lookup_table_[i] - subvector_offset(i);
+  }
+
   // Given an index into the supervector, returns the subvector that
   // contains that index, and its offset within the subvector. This operation
   // is O(log(N)) in the number of subvectors. Throws std::out_of_range for
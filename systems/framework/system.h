@@ -69,6 +69,28 @@ class SystemImpl {
 /// Base class for all System functionality that is dependent on the templatized
 /// scalar type T for input, state, parameters, and outputs.
 ///
+/// <h3>Thread safety</h3>
+///
+/// A %System is logically const once it has been constructed and configured:
+/// all of its runtime methods take the %System itself as `const` and write
+/// only to the supplied Context (including its cache, which is mutable
+/// per-Context state). Consequently a single `const` %System may be used from
+/// multiple threads simultaneously, provided that each thread supplies its
+/// own Context (or other per-thread mutable workspace); Context objects may
+/// not be shared between threads. Use Context::Clone() or
+/// AllocateContext() to produce a Context per thread. Note that this
+/// guarantee covers only the framework itself -- a %System whose
+/// computational methods mutate member state (e.g. scratch variables) would
+/// break it, and not every %System shipped with Drake keeps such state in
+/// the Context yet. Known exceptions include: a multibody::MultibodyPlant
+/// modeled as a discrete system, which shares its contact solver (including
+/// its warm-start state) across all Contexts, so concurrent discrete updates
+/// of a single plant are not supported (continuous-mode plants are covered
+/// by the guarantee); estimators::LuenbergerObserver, which keeps a member
+/// context for the observed system; and several systems in the attic (e.g.
+/// RigidBodyPlant). Check a system's member declarations for `mutable`
+/// state before assuming it may be shared across threads.
+///
 /// @tparam T The vector element type, which must be a valid Eigen scalar.
 template <typename T>
 class System : public SystemBase {
@@ -556,6 +578,37 @@ class System : public SystemBase {
 
     return basic_value->get_value();
   }
+
+  /// Returns the value of the vector-valued input port with the given
+  /// `port_index` as an %Eigen vector whose size `N` is fixed at compile
+  /// time. This behaves identically to the dynamically sized signature above
+  /// but the returned Map carries a compile-time size, so downstream %Eigen
+  /// expressions involving small vectors compile to fixed-size code with no
+  /// heap traffic. The port must have been declared with size `N` (e.g. via
+  /// LeafSystem::DeclareVectorInputPort<N>()).
+  ///
+  /// @pre `port_index` selects an existing input port of this System.
+  /// @pre the port must have been declared to be vector-valued, of size `N`.
+  /// @pre the port must be evaluable (connected or fixed).
+  ///
+  /// @tparam N The declared size of the input port.
+  template <int N>
+  Eigen::Map<const Eigen::Matrix<T, N, 1>> EvalEigenVectorInput(
+      const Context<T>& context, int port_index) const {
+    static_assert(N >= 0, "The port size must be non-negative.");
+    if (port_index < 0)
+      ThrowNegativePortIndex(__func__, port_index);
+    const InputPortIndex port(port_index);
+
+    const BasicVector<T>* const basic_value =
+        EvalBasicVectorInputImpl(__func__, context, port);
+    if (basic_value == nullptr)
+      ThrowCantEvaluateInputPort(__func__, port);
+    DRAKE_THROW_UNLESS(basic_value->size() == N);
+
+    return Eigen::Map<const Eigen::Matrix<T, N, 1>>(
+        basic_value->get_value().data());
+  }
   //@}
 
   //----------------------------------------------------------------------------
@@ -1179,6 +1232,57 @@ class System : public SystemBase {
     return result;
   }
 
+  /// Evaluates every registered SystemConstraint on this system, stacking the
+  /// constraint values into @p value in constraint-index order.  @p value is
+  /// resized only when its size does not already match the stacked size, so a
+  /// caller holding a preallocated vector (e.g. a monitor evaluating the
+  /// constraints every step) avoids the per-constraint result allocations
+  /// that repeated calls to SystemConstraint::Calc would incur.  All
+  /// evaluations share @p context, and hence share whatever computations the
+  /// constraint callbacks cache there.
+  void CalcConstraintValues(const Context<T>& context,
+                            VectorX<T>* value) const {
+    DRAKE_DEMAND(value != nullptr);
+    int stacked_size = 0;
+    for (const auto& constraint : constraints_) {
+      stacked_size += constraint->size();
+    }
+    if (value->size() != stacked_size) {
+      value->resize(stacked_size);
+    }
+    VectorX<T> scratch;
+    int offset = 0;
+    for (const auto& constraint : constraints_) {
+      constraint->Calc(context, &scratch);
+      value->segment(offset, constraint->size()) = scratch;
+      offset += constraint->size();
+    }
+  }
+
+  /// Variant of CalcConstraintValues() that evaluates only the constraints
+  /// named in @p indices, stacked in the given order.
+  /// @throws std::out_of_range for an invalid index.
+  void CalcConstraintValues(const Context<T>& context,
+                            const std::vector<SystemConstraintIndex>& indices,
+                            VectorX<T>* value) const {
+    DRAKE_DEMAND(value != nullptr);
+    int stacked_size = 0;
+    for (const auto& index : indices) {
+      stacked_size += get_constraint(index).size();
+    }
+    if (value->size() != stacked_size) {
+      value->resize(stacked_size);
+    }
+    VectorX<T> scratch;
+    int offset = 0;
+    for (const auto& index : indices) {
+      const SystemConstraint<T>& constraint = get_constraint(index);
+      constraint.Calc(context, &scratch);
+      value->segment(offset, constraint.size()) = scratch;
+      offset += constraint.size();
+    }
+  }
+
   /// Checks that @p output is consistent with the number and size of output
   /// ports declared by the system.
   /// @throws std::exception unless `output` is non-null and valid for this
@@ -14,6 +14,7 @@
 
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -444,6 +445,68 @@ TEST_F(CacheEntryTest, InvalidateAllWorks) {
   EXPECT_TRUE(vector_entry().is_out_of_date(context_));
 }
 
+// The opt-in instrumentation must count Eval() hits and misses, accumulate
+// recomputation wall clock time, and count invalidations, with the dump keyed
+// by the entries' human-readable descriptions.
+TEST_F(CacheEntryTest, InstrumentationWorks) {
+  Cache& cache = context_.get_mutable_cache();
+  const CacheEntryValue& value0 = entry0().get_cache_entry_value(context_);
+
+  // Off by default; the cache-wide dump is empty and asking an uninstrumented
+  // entry for its statistics throws.
+  EXPECT_FALSE(value0.is_instrumentation_enabled());
+  EXPECT_TRUE(cache.GetStatistics().empty());
+  EXPECT_THROW(value0.GetStatistics(), std::logic_error);
+
+  cache.EnableInstrumentation();
+  EXPECT_TRUE(value0.is_instrumentation_enabled());
+
+  // Everything is up to date after SetUp(), so these accesses are hits.
+  entry0().Eval<int>(context_);
+  entry0().Eval<int>(context_);
+  CacheEntryStatistics stats = value0.GetStatistics();
+  EXPECT_EQ(stats.description, "entry0");
+  EXPECT_EQ(stats.hits, 2);
+  EXPECT_EQ(stats.misses, 0);
+  EXPECT_EQ(stats.invalidations, 0);
+  EXPECT_EQ(stats.total_recomputation_seconds, 0.);
+
+  // After invalidation, Eval() must recompute (a miss). The computation here
+  // is too cheap to insist on a nonzero time measurement.
+  invalidate(index0_);
+  entry0().Eval<int>(context_);
+  stats = value0.GetStatistics();
+  EXPECT_EQ(stats.hits, 2);
+  EXPECT_EQ(stats.misses, 1);
+  EXPECT_EQ(stats.invalidations, 1);
+  EXPECT_GE(stats.total_recomputation_seconds, 0.);
+
+  // With caching disabled every Eval() is a miss, even though the entry stays
+  // marked up to date.
+  entry0().disable_caching(context_);
+  entry0().Eval<int>(context_);
+  entry0().Eval<int>(context_);
+  EXPECT_EQ(value0.GetStatistics().misses, 3);
+  EXPECT_EQ(value0.GetStatistics().hits, 2);
+  entry0().enable_caching(context_);
+
+  // Every entry is instrumented, so every entry appears in the dump; find
+  // entry0 by its description.
+  const std::vector<CacheEntryStatistics> dump = cache.GetStatistics();
+  int num_found = 0;
+  for (const CacheEntryStatistics& entry_stats : dump) {
+    if (entry_stats.description == "entry0") {
+      ++num_found;
+      EXPECT_EQ(entry_stats.misses, 3);
+    }
+  }
+  EXPECT_EQ(num_found, 1);
+
+  cache.DisableInstrumentation();
+  EXPECT_FALSE(value0.is_instrumentation_enabled());
+  EXPECT_TRUE(cache.GetStatistics().empty());
+}
+
 // Make sure the debugging routine to disable the cache works, and is
 // independent of the out_of_date flags.
 TEST_F(CacheEntryTest, DisableCacheWorks) {
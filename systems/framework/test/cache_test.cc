@@ -167,6 +167,28 @@ class CacheTest : public ::testing::Test {
   CacheIndex next_cache_index_{cache().cache_size()};
 };
 
+// CacheEntryValue objects live in the Cache's arena; their addresses must
+// remain stable no matter how many further entries are created, since
+// DependencyTrackers retain pointers to them.
+TEST_F(CacheTest, EntryAddressesAreStable) {
+  const CacheEntryValue* index0_address = &cache_value(index0_);
+  const CacheEntryValue* string_address = &cache_value(string_index_);
+
+  // Create enough additional entries to force allocation of several more
+  // arena chunks.
+  for (int i = 0; i < 200; ++i) {
+    CacheIndex index(next_cache_index_++);
+    cache().CreateNewCacheEntryValue(index, next_ticket_++, "stability entry",
+                                     {nothing_ticket_}, &graph());
+    cache_value(index).SetInitialValue(PackValue(i));
+  }
+
+  EXPECT_EQ(&cache_value(index0_), index0_address);
+  EXPECT_EQ(&cache_value(string_index_), string_address);
+  EXPECT_EQ(cache_value(index0_).get_value<int>(), 0);
+  EXPECT_EQ(cache_value(string_index_).get_value<string>(), "initial");
+}
+
 // Normally creating a new CacheEntryValue creates a new DependencyTracker to
 // manage it. However, for well-known cached objects like the time derivatives
 // cache entry xcdot, the tracker is created during Context construction and
@@ -328,6 +350,54 @@ TEST_F(CacheTest, DisableCachingWorks) {
   EXPECT_TRUE(vec_val.is_out_of_date());
 }
 
+// Check the opt-in statistics collection at the CacheEntryValue level: the
+// hit/miss/recomputation notes and invalidation counting, the cache-wide
+// dump, and that instrumentation does not leak into clones. The Eval()-path
+// hooks that drive the notes in practice are tested with CacheEntry.
+TEST_F(CacheTest, InstrumentationWorks) {
+  CacheEntryValue& entry_value = cache_value(index0_);
+  EXPECT_FALSE(entry_value.is_instrumentation_enabled());
+  EXPECT_THROW(entry_value.GetStatistics(), std::logic_error);
+  EXPECT_TRUE(cache().GetStatistics().empty());
+
+  // The note methods must be harmless no-ops while instrumentation is off.
+  entry_value.note_cache_hit();
+  entry_value.note_recomputation(1.);
+
+  entry_value.enable_instrumentation();
+  EXPECT_TRUE(entry_value.is_instrumentation_enabled());
+
+  entry_value.note_cache_hit();
+  entry_value.note_cache_hit();
+  entry_value.note_recomputation(0.25);
+  // This invalidates every entry, but only index0_ is instrumented.
+  tracker(time_ticket_).NoteValueChange(99);
+
+  const CacheEntryStatistics stats = entry_value.GetStatistics();
+  EXPECT_EQ(stats.description, "entry0");
+  EXPECT_EQ(stats.hits, 2);
+  EXPECT_EQ(stats.misses, 1);
+  EXPECT_EQ(stats.invalidations, 1);
+  EXPECT_EQ(stats.total_recomputation_seconds, 0.25);
+
+  // Only the instrumented entry shows up in the cache-wide dump.
+  const auto dump = cache().GetStatistics();
+  ASSERT_EQ(dump.size(), 1u);
+  EXPECT_EQ(dump[0].description, "entry0");
+  EXPECT_EQ(dump[0].hits, 2);
+
+  // Instrumentation and accumulated statistics do not survive cloning.
+  auto clone_context_ptr = context_.Clone();
+  Cache& clone_cache = cache(clone_context_ptr.get());
+  EXPECT_FALSE(cache_value(index0_, &clone_cache).is_instrumentation_enabled());
+  EXPECT_TRUE(clone_cache.GetStatistics().empty());
+
+  // Disabling instrumentation discards the statistics.
+  cache().DisableInstrumentation();
+  EXPECT_FALSE(entry_value.is_instrumentation_enabled());
+  EXPECT_TRUE(cache().GetStatistics().empty());
+}
+
 // Test that the vector-valued cache entry works and preserved the underlying
 // concrete type.
 TEST_F(CacheTest, VectorCacheEntryWorks) {
@@ -432,10 +502,11 @@ TEST_F(CacheTest, Clone) {
     EXPECT_EQ(clone_value.ticket(), value.ticket());
     EXPECT_EQ(clone_value.serial_number(), value.serial_number());
 
-    // If there is a value, the clone_cache should not have the same memory
-    // address.
+    // If there is a value, the clone initially shares the stored value object
+    // with the original (copy-on-write); a private copy is materialized only
+    // on first mutable access below.
     if (value.has_value()) {
-      EXPECT_NE(&clone_value.get_abstract_value(),
+      EXPECT_EQ(&clone_value.get_abstract_value(),
                 &value.get_abstract_value());
     }
 
@@ -469,12 +540,21 @@ TEST_F(CacheTest, Clone) {
   EXPECT_EQ(cache_value(last_index, &clone_cache).GetValueOrThrow<int>(),
             cache_value(last_index).GetValueOrThrow<int>());
 
-  // Changes to the clone_cache should not affect the original.
+  // Changes to the clone_cache should not affect the original. The first
+  // mutation materializes a private copy of the shared value object.
   cache_value(index2_, &clone_cache).mark_out_of_date();  // Invalidate.
   cache_value(index2_,
               &clone_cache).set_value<int>(99);  // Set new value & validate.
   EXPECT_EQ(cache_value(index2_, &clone_cache).get_value<int>(), 99);
   EXPECT_EQ(cache_value(index2_).get_value<int>(), 2);
+  EXPECT_NE(&cache_value(index2_, &clone_cache).get_abstract_value(),
+            &cache_value(index2_).get_abstract_value());
+
+  // Mutation through the *original* must likewise not affect the clone.
+  cache_value(index1_).mark_out_of_date();
+  cache_value(index1_).set_value<int>(-1);
+  EXPECT_EQ(cache_value(index1_).get_value<int>(), -1);
+  EXPECT_EQ(cache_value(index1_, &clone_cache).get_value<int>(), 1);
 
   // This should invalidate everything in the original cache, but nothing
   // in the clone_cache. Just check one entry as representative.
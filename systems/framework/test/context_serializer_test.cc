@@ -0,0 +1,173 @@
+#include "drake/systems/framework/context_serializer.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// A system exercising every kind of serializable quantity: continuous,
+// discrete, and abstract state, plus numeric and abstract parameters.
+class SerializableSystem : public LeafSystem<double> {
+ public:
+  SerializableSystem() {
+    DeclareContinuousState(2);
+    DeclareDiscreteState(Eigen::VectorXd::Zero(1));
+    DeclareAbstractState(AbstractValue::Make<std::string>("xa"));
+    DeclareNumericParameter(BasicVector<double>(Eigen::Vector2d(4.0, 5.0)));
+    DeclareAbstractParameter(Value<std::string>("pa"));
+  }
+};
+
+// Returns a serializer that knows how to encode std::string.
+ContextSerializer MakeSerializer() {
+  ContextSerializer serializer;
+  serializer.RegisterType<std::string>(
+      [](const std::string& value, std::vector<uint8_t>* out) {
+        out->insert(out->end(), value.begin(), value.end());
+      },
+      [](const std::vector<uint8_t>& payload, std::string* value) {
+        value->assign(payload.begin(), payload.end());
+      });
+  return serializer;
+}
+
+// Gives every serializable quantity in the context a distinctive value.
+void SetDistinctiveValues(Context<double>* context) {
+  context->set_time(41.5);
+  context->set_accuracy(1e-6);
+  context->get_mutable_continuous_state_vector().SetFromVector(
+      Eigen::Vector2d(1.0, 2.0));
+  context->get_mutable_discrete_state(0)[0] = 3.0;
+  context->get_mutable_abstract_state<std::string>(0) = "updated state";
+  context->get_mutable_numeric_parameter(0).SetFromVector(
+      Eigen::Vector2d(6.0, 7.0));
+  context->get_mutable_abstract_parameter(0).SetValue<std::string>(
+      "updated parameter");
+}
+
+// Checks that the context holds exactly the values set above.
+void ExpectDistinctiveValues(const Context<double>& context) {
+  EXPECT_EQ(context.get_time(), 41.5);
+  ASSERT_TRUE(context.get_accuracy());
+  EXPECT_EQ(context.get_accuracy().value(), 1e-6);
+  EXPECT_EQ(context.get_continuous_state_vector().CopyToVector(),
+            Eigen::Vector2d(1.0, 2.0));
+  EXPECT_EQ(context.get_discrete_state(0)[0], 3.0);
+  EXPECT_EQ(context.get_abstract_state<std::string>(0), "updated state");
+  EXPECT_EQ(context.get_numeric_parameter(0).CopyToVector(),
+            Eigen::Vector2d(6.0, 7.0));
+  EXPECT_EQ(context.get_abstract_parameter(0).GetValue<std::string>(),
+            "updated parameter");
+}
+
+// A snapshot of a leaf context restores every quantity into a fresh context.
+GTEST_TEST(ContextSerializerTest, LeafRoundTrip) {
+  const SerializableSystem system;
+  const ContextSerializer serializer = MakeSerializer();
+
+  auto source = system.CreateDefaultContext();
+  SetDistinctiveValues(source.get());
+  const std::vector<uint8_t> snapshot = serializer.Serialize(*source);
+
+  auto restored = system.CreateDefaultContext();
+  serializer.Deserialize(snapshot, restored.get());
+  ExpectDistinctiveValues(*restored);
+}
+
+// Diagram contexts serialize through the same root-context accessors; the
+// restored values land in the right subsystems.
+GTEST_TEST(ContextSerializerTest, DiagramRoundTrip) {
+  DiagramBuilder<double> builder;
+  auto* sub1 = builder.AddSystem<SerializableSystem>();
+  auto* sub2 = builder.AddSystem<SerializableSystem>();
+  auto diagram = builder.Build();
+  const ContextSerializer serializer = MakeSerializer();
+
+  auto source = diagram->CreateDefaultContext();
+  source->set_time(8.25);
+  SetDistinctiveValues(
+      &diagram->GetMutableSubsystemContext(*sub1, source.get()));
+  diagram->GetMutableSubsystemContext(*sub2, source.get())
+      .get_mutable_abstract_state<std::string>(0) = "second subsystem";
+  const std::vector<uint8_t> snapshot = serializer.Serialize(*source);
+
+  auto restored = diagram->CreateDefaultContext();
+  serializer.Deserialize(snapshot, restored.get());
+  EXPECT_EQ(restored->get_time(), 8.25);
+  const Context<double>& context1 =
+      diagram->GetSubsystemContext(*sub1, *restored);
+  EXPECT_EQ(context1.get_continuous_state_vector().CopyToVector(),
+            Eigen::Vector2d(1.0, 2.0));
+  EXPECT_EQ(context1.get_abstract_state<std::string>(0), "updated state");
+  EXPECT_EQ(context1.get_abstract_parameter(0).GetValue<std::string>(),
+            "updated parameter");
+  const Context<double>& context2 =
+      diagram->GetSubsystemContext(*sub2, *restored);
+  EXPECT_EQ(context2.get_abstract_state<std::string>(0), "second subsystem");
+}
+
+// Serializing an abstract value whose type was never registered is an error,
+// as is deserializing with a serializer that lacks the registration.
+GTEST_TEST(ContextSerializerTest, UnregisteredAbstractType) {
+  const SerializableSystem system;
+  auto context = system.CreateDefaultContext();
+
+  const ContextSerializer empty_serializer;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      empty_serializer.Serialize(*context), std::logic_error,
+      ".*no binary encoding has been registered.*std::string.*");
+
+  const std::vector<uint8_t> snapshot = MakeSerializer().Serialize(*context);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      empty_serializer.Deserialize(snapshot, context.get()), std::logic_error,
+      ".*no binary encoding has been registered.*std::string.*");
+}
+
+// A snapshot only restores into a structurally identical context.
+GTEST_TEST(ContextSerializerTest, StructureMismatch) {
+  const SerializableSystem system;
+  const ContextSerializer serializer = MakeSerializer();
+  auto context = system.CreateDefaultContext();
+  const std::vector<uint8_t> snapshot = serializer.Serialize(*context);
+
+  // A system with a different number of continuous states.
+  class OtherSystem : public LeafSystem<double> {
+   public:
+    OtherSystem() { DeclareContinuousState(3); }
+  } other_system;
+  auto other_context = other_system.CreateDefaultContext();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      serializer.Deserialize(snapshot, other_context.get()),
+      std::runtime_error, ".*snapshot has 2 continuous states.*has 3.*");
+}
+
+// Truncated or garbage buffers are rejected rather than misinterpreted.
+GTEST_TEST(ContextSerializerTest, MalformedSnapshot) {
+  const SerializableSystem system;
+  const ContextSerializer serializer = MakeSerializer();
+  auto context = system.CreateDefaultContext();
+
+  std::vector<uint8_t> snapshot = serializer.Serialize(*context);
+  snapshot.resize(snapshot.size() / 2);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      serializer.Deserialize(snapshot, context.get()), std::runtime_error,
+      ".*malformed.*");
+
+  const std::vector<uint8_t> garbage(16, 0xab);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      serializer.Deserialize(garbage, context.get()), std::runtime_error,
+      ".*malformed.*");
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
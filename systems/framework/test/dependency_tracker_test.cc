@@ -4,6 +4,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -79,7 +80,7 @@ GTEST_TEST(DependencyTracker, BuiltInTrackers) {
     auto& tracker = context.get_tracker(ticket);
     EXPECT_EQ(tracker.ticket(), ticket);
     EXPECT_NO_THROW(tracker.ThrowIfBadDependencyTracker(
-        &context, &CacheEntryValue::dummy()));
+        &context, &context.get_mutable_cache().dummy_cache_entry_value()));
     EXPECT_THROW(tracker.ThrowIfBadDependencyTracker(&context2),
                  std::logic_error);
   }
@@ -228,6 +229,43 @@ GTEST_TEST(DependencyTracker, BuiltInTrackers) {
   EXPECT_EQ(pnc.subscribers().size(), 0);
 }
 
+// Trackers in distinct Context trees must not share any mutable state so
+// that a single const System can be used from multiple threads, each with its
+// own Context. In particular, trackers with no associated cache entry must
+// invalidate their own context's dummy CacheEntryValue rather than a
+// process-wide singleton -- with a shared singleton the concurrent sweeps
+// below are a data race that ThreadSanitizer reports. Run this test under
+// sanitizers to check the isolation; the assertions here just confirm that
+// the sweeps behaved normally.
+GTEST_TEST(DependencyTracker, SweepsInDistinctContextsAreIsolated) {
+  MyContextBase context1, context2;
+  const DependencyTicket time_ticket(internal::kTimeTicket);
+
+  // Each context invalidates into its own dummy cache entry value.
+  EXPECT_NE(&context1.get_mutable_cache().dummy_cache_entry_value(),
+            &context2.get_mutable_cache().dummy_cache_entry_value());
+
+  // Hammer value-change sweeps (like repeated time advancement) on both
+  // contexts concurrently.
+  const int kNumNotifies = 1000;
+  auto hammer = [kNumNotifies](ContextBase* context) {
+    const DependencyTracker& time_tracker =
+        context->get_tracker(DependencyTicket(internal::kTimeTicket));
+    for (int i = 0; i < kNumNotifies; ++i)
+      time_tracker.NoteValueChange(context->start_new_change_event());
+  };
+  std::thread thread1(hammer, &context1);
+  std::thread thread2(hammer, &context2);
+  thread1.join();
+  thread2.join();
+
+  // Each tracker saw exactly its own context's notifications.
+  EXPECT_EQ(context1.get_tracker(time_ticket).num_value_change_events(),
+            kNumNotifies);
+  EXPECT_EQ(context2.get_tracker(time_ticket).num_value_change_events(),
+            kNumNotifies);
+}
+
 // Normally the dependency trackers are allocated automatically by the
 // System framework. Here we try to use as little of the framework as possible
 // and cobble together the following dependency graph by hand:
@@ -432,6 +470,44 @@ TEST_F(HandBuiltDependencies, Notify) {
   ExpectAllStatsMatch();
 }
 
+// An invalidation sweep runs over a flattened ("compiled") copy of the
+// reachable subgraph that is built lazily at the first notification. Make
+// sure that a subscription change after a sweep has been compiled causes the
+// sweep to be recompiled, rather than continuing to use the stale flattened
+// graph.
+TEST_F(HandBuiltDependencies, NotifySeesSubscriptionChanges) {
+  DependencyGraph& graph = context_.get_mutable_dependency_graph();
+
+  // This first notification compiles upstream1's sweep.
+  upstream1_->NoteValueChange(10LL);
+  EXPECT_TRUE(entry0_->is_out_of_date());
+  entry0_->mark_up_to_date();
+
+  // Create a new cache entry depending on middle1, which is downstream of
+  // upstream1 and already embedded in its compiled sweep.
+  Cache& cache = context_.get_mutable_cache();
+  const CacheIndex late_index(cache.cache_size());
+  const DependencyTicket late_ticket(graph.trackers_size());
+  CacheEntryValue& late_entry = cache.CreateNewCacheEntryValue(
+      late_index, late_ticket, "late entry", {middle1_->ticket()}, &graph);
+  late_entry.SetInitialValue(AbstractValue::Make<int>(7));
+  late_entry.mark_up_to_date();
+
+  // The next sweep from upstream1 must reach the late subscriber.
+  upstream1_->NoteValueChange(11LL);
+  EXPECT_TRUE(late_entry.is_out_of_date());
+  EXPECT_TRUE(entry0_->is_out_of_date());
+  entry0_->mark_up_to_date();
+  late_entry.mark_up_to_date();
+
+  // Unsubscribing must likewise take effect on the next sweep.
+  DependencyTracker& late_tracker = graph.get_mutable_tracker(late_ticket);
+  late_tracker.UnsubscribeFromPrerequisite(middle1_);
+  upstream1_->NoteValueChange(12LL);
+  EXPECT_FALSE(late_entry.is_out_of_date());
+  EXPECT_TRUE(entry0_->is_out_of_date());
+}
+
 // Clone the dependency graph and make sure the clone works like the
 // original did, but on the new entities!
 TEST_F(HandBuiltDependencies, Clone) {
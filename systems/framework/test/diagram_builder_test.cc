@@ -180,6 +180,31 @@ GTEST_TEST(DiagramBuilderTest, CascadedNonDirectFeedthrough) {
   EXPECT_NO_THROW(builder.Build());
 }
 
+// Tests the bulk Connect overload, including its duplicate-wiring check.
+GTEST_TEST(DiagramBuilderTest, BulkConnect) {
+  DiagramBuilder<double> builder;
+
+  auto integrator1 = builder.AddSystem<Integrator>(1 /* size */);
+  integrator1->set_name("integrator1");
+  auto integrator2 = builder.AddSystem<Integrator>(1 /* size */);
+  integrator2->set_name("integrator2");
+  auto integrator3 = builder.AddSystem<Integrator>(1 /* size */);
+  integrator3->set_name("integrator3");
+
+  builder.Connect({{&integrator1->get_output_port(),
+                    &integrator2->get_input_port()},
+                   {&integrator2->get_output_port(),
+                    &integrator3->get_input_port()}});
+
+  // Re-wiring an already-connected input throws, just as for the one-pair
+  // Connect.
+  EXPECT_THROW(builder.Connect({{&integrator1->get_output_port(),
+                                 &integrator3->get_input_port()}}),
+               std::logic_error);
+
+  EXPECT_NO_THROW(builder.Build());
+}
+
 // Tests that an exception is thrown when building an empty diagram.
 GTEST_TEST(DiagramBuilderTest, FinalizeWhenEmpty) {
   DiagramBuilder<double> builder;
@@ -495,6 +520,58 @@ GTEST_TEST(DiagramBuilderTest, ExportInputOutputIndex) {
         adder2->get_output_port()), 1 /* exported output port id */);
 }
 
+// Tests that EnableFusion() collapses a Gain -> Gain -> PassThrough chain
+// into a single synthesized system while leaving the stateful integrator
+// untouched, and that the built diagram computes the same map.
+GTEST_TEST(DiagramBuilderTest, FusionCollapsesAffineChains) {
+  DiagramBuilder<double> builder;
+  auto gain1 = builder.AddSystem<Gain>(2.0 /* gain */, 2 /* size */);
+  auto gain2 = builder.AddSystem<Gain>(-3.0 /* gain */, 2 /* size */);
+  auto pass = builder.AddSystem<PassThrough>(2 /* size */);
+  auto integrator = builder.AddSystem<Integrator>(2 /* size */);
+  builder.Connect(gain1->get_output_port(), gain2->get_input_port());
+  builder.Connect(gain2->get_output_port(), pass->get_input_port());
+  builder.Connect(pass->get_output_port(), integrator->get_input_port());
+  builder.ExportInput(gain1->get_input_port());
+  builder.ExportOutput(integrator->get_output_port());
+
+  EXPECT_FALSE(builder.fusion_enabled());
+  builder.EnableFusion();
+  EXPECT_TRUE(builder.fusion_enabled());
+  auto diagram = builder.Build();
+
+  // The three-link chain collapsed into one synthesized system.
+  auto systems = diagram->GetSystems();
+  ASSERT_EQ(systems.size(), 2u);
+  EXPECT_EQ(systems[1]->get_name().substr(0, 6), "fused(");
+
+  // The composed map is xdot = 2 * -3 * u = -6 u.
+  auto context = diagram->CreateDefaultContext();
+  context->FixInputPort(0, Eigen::Vector2d(1.0, 2.0));
+  auto derivatives = diagram->AllocateTimeDerivatives();
+  diagram->CalcTimeDerivatives(*context, derivatives.get());
+  const Eigen::VectorXd xdot = derivatives->CopyToVector();
+  ASSERT_EQ(xdot.size(), 2);
+  EXPECT_EQ(xdot[0], -6.0);
+  EXPECT_EQ(xdot[1], -12.0);
+}
+
+// An output port interior to a would-be chain that is exported (or has
+// fan-out) pins the chain apart, so nothing may be fused.
+GTEST_TEST(DiagramBuilderTest, FusionRespectsExportedInteriorPorts) {
+  DiagramBuilder<double> builder;
+  auto gain1 = builder.AddSystem<Gain>(2.0 /* gain */, 1 /* size */);
+  auto gain2 = builder.AddSystem<Gain>(3.0 /* gain */, 1 /* size */);
+  builder.Connect(gain1->get_output_port(), gain2->get_input_port());
+  builder.ExportInput(gain1->get_input_port());
+  builder.ExportOutput(gain1->get_output_port());
+  builder.ExportOutput(gain2->get_output_port());
+
+  builder.EnableFusion();
+  auto diagram = builder.Build();
+  EXPECT_EQ(diagram->GetSystems().size(), 2u);
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
@@ -791,6 +791,41 @@ TEST_F(DiagramTest, CalcTimeDerivatives) {
   EXPECT_EQ(27, integrator1_xcdot.get_vector().GetAtIndex(2));
 }
 
+// Parallel evaluation must produce exactly the same derivatives as the
+// serial path. (SetUp() has already enabled caching on context_, which is a
+// precondition for the parallel mode.)
+TEST_F(DiagramTest, CalcTimeDerivativesInParallel) {
+  EXPECT_FALSE(diagram_->parallel_time_derivatives_enabled());
+  diagram_->EnableParallelTimeDerivatives(2);
+  EXPECT_TRUE(diagram_->parallel_time_derivatives_enabled());
+
+  AttachInputs();
+  std::unique_ptr<ContinuousState<double>> derivatives =
+      diagram_->AllocateTimeDerivatives();
+  diagram_->CalcTimeDerivatives(*context_, derivatives.get());
+
+  const ContinuousState<double>& integrator0_xcdot =
+      diagram_->GetSubsystemDerivatives(*integrator0(), *derivatives);
+  EXPECT_EQ(1 + 8, integrator0_xcdot.get_vector().GetAtIndex(0));
+  EXPECT_EQ(2 + 16, integrator0_xcdot.get_vector().GetAtIndex(1));
+  EXPECT_EQ(4 + 32, integrator0_xcdot.get_vector().GetAtIndex(2));
+
+  const ContinuousState<double>& integrator1_xcdot =
+      diagram_->GetSubsystemDerivatives(*integrator1(), *derivatives);
+  EXPECT_EQ(3, integrator1_xcdot.get_vector().GetAtIndex(0));
+  EXPECT_EQ(9, integrator1_xcdot.get_vector().GetAtIndex(1));
+  EXPECT_EQ(27, integrator1_xcdot.get_vector().GetAtIndex(2));
+
+  // Turning the mode back off restores the serial path.
+  diagram_->DisableParallelTimeDerivatives();
+  EXPECT_FALSE(diagram_->parallel_time_derivatives_enabled());
+  diagram_->CalcTimeDerivatives(*context_, derivatives.get());
+  EXPECT_EQ(1 + 8, diagram_->GetSubsystemDerivatives(*integrator0(),
+                                                     *derivatives)
+                       .get_vector()
+                       .GetAtIndex(0));
+}
+
 // Tests the AllocateInput logic.
 TEST_F(DiagramTest, AllocateInputs) {
   auto context = diagram_->CreateDefaultContext();
@@ -2180,6 +2215,28 @@ TEST_F(NestedDiagramContextTest, GetSubsystemState) {
   EXPECT_EQ(big_output_->get_vector_data(3)->GetAtIndex(0), 4);
 }
 
+// An exported output port delegates straight to the leaf port at the bottom
+// of the export chain, no matter how deep the nesting: evaluating the outer
+// diagram port and the underlying leaf port yields the very same cached
+// value object.
+TEST_F(NestedDiagramContextTest, ExportedPortDelegatesToLeafPort) {
+  big_diagram_->GetMutableSubsystemContext(*integrator3_, big_context_.get())
+      .get_mutable_continuous_state_vector()
+      .SetAtIndex(0, 17);
+
+  // Output port 3 of the big diagram exports diagram1's port 0, which in
+  // turn exports integrator3's output port.
+  const OutputPort<double>& big_port = big_diagram_->get_output_port(3);
+  const Context<double>& integrator3_subcontext =
+      big_diagram_->GetSubsystemContext(*integrator3_, *big_context_);
+
+  const AbstractValue& big_value = big_port.EvalAbstract(*big_context_);
+  EXPECT_EQ(big_value.GetValue<BasicVector<double>>()[0], 17);
+  EXPECT_EQ(&big_value,
+            &integrator3_->get_output_port().EvalAbstract(
+                integrator3_subcontext));
+}
+
 // Tests that ContextBase methods for affecting cache behavior propagate
 // all the way through a nested Diagram. Since leaf output ports have cache
 // entries in their corresponding subcontext, we'll pick one at the bottom
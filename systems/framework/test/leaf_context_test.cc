@@ -575,6 +575,40 @@ TEST_F(LeafContextTest, CopyStateFrom) {
   EXPECT_EQ(729, context_.get_abstract_state<int>(0));
 }
 
+// Tests copy-on-write parameter sharing: after installing a shared block,
+// clones of the context share it and deep-copy only the entries they touch.
+TEST_F(LeafContextTest, SharedParameters) {
+  const std::shared_ptr<const Parameters<double>> base =
+      context_.get_parameters().Clone();
+  context_.SetSharedParameters(base);
+  EXPECT_TRUE(context_.get_parameters().has_shared_base());
+
+  // Reads now resolve to the shared entries; the values are unchanged.
+  EXPECT_EQ(&context_.get_numeric_parameter(0),
+            &base->get_numeric_parameter(0));
+  EXPECT_EQ(1.0, context_.get_numeric_parameter(0)[0]);
+
+  // Clones of the context share the same block.
+  std::unique_ptr<Context<double>> clone = context_.Clone();
+  EXPECT_EQ(&clone->get_numeric_parameter(1),
+            &base->get_numeric_parameter(1));
+
+  // A write through the clone materializes a private copy of just the
+  // touched entry; the base block and the original context are untouched.
+  clone->get_mutable_numeric_parameter(0)[0] = 76.0;
+  EXPECT_EQ(76.0, clone->get_numeric_parameter(0)[0]);
+  EXPECT_EQ(1.0, context_.get_numeric_parameter(0)[0]);
+  EXPECT_NE(&clone->get_numeric_parameter(0),
+            &base->get_numeric_parameter(0));
+  EXPECT_EQ(&clone->get_numeric_parameter(1),
+            &base->get_numeric_parameter(1));
+
+  // A block whose shapes don't match the existing parameters is rejected.
+  auto wrong_shape = std::make_shared<Parameters<double>>(
+      std::make_unique<BasicVector<double>>(3));
+  EXPECT_THROW(context_.SetSharedParameters(wrong_shape), std::runtime_error);
+}
+
 // Tests that a LeafContext<AutoDiffXd> can be initialized from a
 // LeafContext<double>.
 TEST_F(LeafContextTest, SetTimeStateAndParametersFrom) {
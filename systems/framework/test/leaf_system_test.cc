@@ -414,6 +414,36 @@ TEST_F(LeafSystemTest, DefaultPortNameTest) {
       "y1");
 }
 
+// Tests the compile-time-sized port declarations and the matching fixed-size
+// Eigen read of an input port. The declared ports behave exactly like
+// dynamically sized ports of the same size.
+TEST_F(LeafSystemTest, FixedSizePortDeclarations) {
+  const InputPort<double>& input =
+      system_.DeclareVectorInputPort<3>("fixed_in");
+  EXPECT_EQ(input.size(), 3);
+  EXPECT_EQ(input.get_data_type(), kVectorValued);
+
+  const OutputPort<double>& output = system_.DeclareVectorOutputPort<2>(
+      "fixed_out", [](const Context<double>&, BasicVector<double>* out) {
+        out->get_mutable_value() = Eigen::Vector2d(1.0, 2.0);
+      });
+  EXPECT_EQ(output.size(), 2);
+
+  auto context = system_.CreateDefaultContext();
+  context->FixInputPort(input.get_index(), {7.0, 8.0, 9.0});
+  const auto value =
+      system_.EvalEigenVectorInput<3>(*context, input.get_index());
+  static_assert(std::decay_t<decltype(value)>::RowsAtCompileTime == 3,
+                "The returned Map should have a compile-time size.");
+  EXPECT_EQ(value[0], 7.0);
+  EXPECT_EQ(value[1], 8.0);
+  EXPECT_EQ(value[2], 9.0);
+
+  // Reading with the wrong compile-time size is an error.
+  EXPECT_THROW(system_.EvalEigenVectorInput<2>(*context, input.get_index()),
+               std::exception);
+}
+
 // Tests that witness functions can be declared. Tests that witness functions
 // stop Simulator at desired points (i.e., the raison d'être of a witness
 // function) are done in diagram_test.cc and
@@ -1533,6 +1563,71 @@ GTEST_TEST(NonModelLeafSystemTest, NonModelPortsOutput) {
   EXPECT_EQ(dut.calc_POD_calls(), 2);  // Should have been cached.
 }
 
+// An output type that counts its copy operations, to verify that the by-value
+// calculator signature moves its result into the cache entry rather than
+// copying it.
+struct CopyCountedString {
+  CopyCountedString() = default;
+  explicit CopyCountedString(std::string value_in)
+      : value(std::move(value_in)) {}
+  CopyCountedString(const CopyCountedString& other) : value(other.value) {
+    ++num_copies;
+  }
+  CopyCountedString& operator=(const CopyCountedString& other) {
+    value = other.value;
+    ++num_copies;
+    return *this;
+  }
+  CopyCountedString(CopyCountedString&&) = default;
+  CopyCountedString& operator=(CopyCountedString&&) = default;
+
+  std::string value;
+  static int num_copies;
+};
+int CopyCountedString::num_copies = 0;
+
+class DeclaredByValueOutputSystem : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DeclaredByValueOutputSystem);
+
+  DeclaredByValueOutputSystem() {
+    // Output port 0 uses a model value with a by-value calculator.
+    this->DeclareAbstractOutputPort(
+        "with_model", CopyCountedString("model"),
+        &DeclaredByValueOutputSystem::CalcCopyCountedString);
+    // Output port 1 default-constructs its model with a by-value calculator.
+    this->DeclareAbstractOutputPort(
+        "without_model", &DeclaredByValueOutputSystem::CalcCopyCountedString);
+  }
+
+ private:
+  CopyCountedString CalcCopyCountedString(const Context<double>&) const {
+    return CopyCountedString("built locally");
+  }
+};
+
+// Tests that the by-value abstract output port calculator signatures move
+// their result into the cache entry with no copies.
+GTEST_TEST(NonModelLeafSystemTest, ByValuePortsOutput) {
+  DeclaredByValueOutputSystem dut;
+  auto context = dut.CreateDefaultContext();
+  auto system_output = dut.AllocateOutput();  // Invokes all allocators.
+
+  EXPECT_EQ(dut.get_num_output_ports(), 2);
+
+  // Allocation copies the model values; only copies made by Calc() below
+  // count against the move-semantics contract.
+  CopyCountedString::num_copies = 0;
+  for (OutputPortIndex i(0); i < dut.get_num_output_ports(); ++i) {
+    const auto& port = dut.get_output_port(i);
+    port.Calc(*context, system_output->GetMutableData(i));
+    EXPECT_EQ(
+        system_output->get_data(i)->GetValueOrThrow<CopyCountedString>().value,
+        "built locally");
+  }
+  EXPECT_EQ(CopyCountedString::num_copies, 0);
+}
+
 // Tests both that an unrestricted update callback is called and that
 // modifications to state dimension are caught.
 TEST_F(LeafSystemTest, CallbackAndInvalidUpdates) {
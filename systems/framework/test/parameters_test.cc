@@ -77,6 +77,73 @@ TEST_F(ParametersTest, Clone) {
   EXPECT_EQ(72, UnpackIntValue(params_->get_abstract_parameter(0)));
 }
 
+// A copy-on-write overlay initially shares every entry of its base block,
+// and materializes a private copy only on first mutable access.
+TEST_F(ParametersTest, CopyOnWriteOverlay) {
+  const std::shared_ptr<const Parameters<double>> base = params_->Clone();
+  Parameters<double> overlay(base);
+  EXPECT_TRUE(overlay.has_shared_base());
+
+  // Reads delegate to the shared entries -- the very same objects.
+  ASSERT_EQ(2, overlay.num_numeric_parameter_groups());
+  ASSERT_EQ(2, overlay.num_abstract_parameters());
+  EXPECT_EQ(&overlay.get_numeric_parameter(0),
+            &base->get_numeric_parameter(0));
+  EXPECT_EQ(&overlay.get_abstract_parameter(1),
+            &base->get_abstract_parameter(1));
+  EXPECT_EQ(3.0, overlay.get_numeric_parameter(0).GetAtIndex(0));
+  EXPECT_EQ(144, UnpackIntValue(overlay.get_abstract_parameter(1)));
+
+  // Writing one entry materializes a private copy of just that entry; the
+  // base is untouched and the other entries remain shared.
+  overlay.get_mutable_numeric_parameter(0).SetAtIndex(0, 42.0);
+  EXPECT_EQ(42.0, overlay.get_numeric_parameter(0).GetAtIndex(0));
+  EXPECT_EQ(3.0, base->get_numeric_parameter(0).GetAtIndex(0));
+  EXPECT_NE(&overlay.get_numeric_parameter(0),
+            &base->get_numeric_parameter(0));
+  EXPECT_EQ(&overlay.get_numeric_parameter(1),
+            &base->get_numeric_parameter(1));
+  EXPECT_EQ(&overlay.get_abstract_parameter(0),
+            &base->get_abstract_parameter(0));
+
+  overlay.get_mutable_abstract_parameter(0).SetValue<int>(256);
+  EXPECT_EQ(256, UnpackIntValue(overlay.get_abstract_parameter(0)));
+  EXPECT_EQ(72, UnpackIntValue(base->get_abstract_parameter(0)));
+}
+
+// Cloning an overlay preserves the sharing: the clone refers to the same
+// base block and deep-copies only the materialized entries.
+TEST_F(ParametersTest, OverlayClonePreservesSharing) {
+  const std::shared_ptr<const Parameters<double>> base = params_->Clone();
+  Parameters<double> overlay(base);
+  overlay.get_mutable_numeric_parameter(0).SetAtIndex(0, 42.0);
+
+  auto clone = overlay.Clone();
+  EXPECT_TRUE(clone->has_shared_base());
+  EXPECT_EQ(&clone->get_numeric_parameter(1),
+            &base->get_numeric_parameter(1));
+  EXPECT_EQ(42.0, clone->get_numeric_parameter(0).GetAtIndex(0));
+  EXPECT_NE(&clone->get_numeric_parameter(0),
+            &overlay.get_numeric_parameter(0));
+
+  // The clone's writes don't leak into the overlay it was cloned from.
+  clone->get_mutable_numeric_parameter(1).SetAtIndex(0, 7.0);
+  EXPECT_EQ(9.0, overlay.get_numeric_parameter(1).GetAtIndex(0));
+  EXPECT_EQ(9.0, base->get_numeric_parameter(1).GetAtIndex(0));
+}
+
+// Whole-block operations detach an overlay from its base block first.
+TEST_F(ParametersTest, OverlayDetachesOnBulkOperations) {
+  const std::shared_ptr<const Parameters<double>> base = params_->Clone();
+  Parameters<double> overlay(base);
+  overlay.SetFrom(*params_);
+  EXPECT_FALSE(overlay.has_shared_base());
+  EXPECT_NE(&overlay.get_numeric_parameter(0),
+            &base->get_numeric_parameter(0));
+  EXPECT_EQ(3.0, overlay.get_numeric_parameter(0).GetAtIndex(0));
+  EXPECT_EQ(72, UnpackIntValue(overlay.get_abstract_parameter(0)));
+}
+
 // Constructs a symbolic::Expression parameters with the same dimensions as
 // params_, and tests we can upconvert the latter into the former.
 TEST_F(ParametersTest, SetSymbolicFromDouble) {
@@ -65,6 +65,79 @@ TEST_F(SupervectorTest, ArrayOperator) {
   EXPECT_EQ(8, (*supervector_)[8]);
 }
 
+// The whole-vector operations are implemented block-wise; make sure they
+// produce the same results as the elementwise defaults and write through to
+// the constituent vectors.
+TEST_F(SupervectorTest, BlockwiseOperations) {
+  // CopyToVector() and NormInf().
+  Eigen::VectorXd expected(kLength);
+  expected << 0, 1, 2, 3, 4, 5, 6, 7, 8;
+  EXPECT_EQ(supervector_->CopyToVector(), expected);
+  EXPECT_EQ(supervector_->NormInf(), 8);
+
+  // ScaleAndAddToVector().
+  Eigen::VectorXd target = Eigen::VectorXd::Ones(kLength);
+  supervector_->ScaleAndAddToVector(2, target);
+  const Eigen::VectorXd expected_target =
+      2 * expected + Eigen::VectorXd::Ones(kLength);
+  EXPECT_EQ(target, expected_target);
+  Eigen::VectorXd wrong_size(2);
+  EXPECT_THROW(supervector_->ScaleAndAddToVector(2, wrong_size),
+               std::out_of_range);
+
+  // SetFromVector() writes through to the constituent vectors.
+  supervector_->SetFromVector(2 * expected);
+  EXPECT_EQ(vec1_->GetAtIndex(3), 6);
+  EXPECT_EQ(vec2_->GetAtIndex(0), 8);
+  EXPECT_EQ(vec4_->GetAtIndex(2), 16);
+  EXPECT_THROW(supervector_->SetFromVector(wrong_size), std::runtime_error);
+
+  // SetZero().
+  supervector_->SetZero();
+  EXPECT_EQ(supervector_->CopyToVector(), Eigen::VectorXd::Zero(kLength));
+  EXPECT_EQ(vec4_->GetAtIndex(1), 0);
+}
+
+// PlusEqScaled() and SetFrom() take the block-wise path when the operands are
+// supervectors with an identical partition, and fall back to elementwise
+// operation otherwise; both paths must agree.
+TEST_F(SupervectorTest, PlusEqScaledAndSetFrom) {
+  // A supervector with the same partition as supervector_.
+  auto rhs1 = BasicVector<double>::Make({1, 1, 1, 1});
+  auto rhs2 = BasicVector<double>::Make({2, 2});
+  auto rhs3 = BasicVector<double>::Make({});
+  auto rhs4 = BasicVector<double>::Make({3, 3, 3});
+  Supervector<double> matching(std::vector<VectorBase<double>*>{
+      rhs1.get(), rhs2.get(), rhs3.get(), rhs4.get()});
+
+  // A vector with the same size but different structure.
+  auto flat = BasicVector<double>::Make({1, 1, 1, 1, 2, 2, 3, 3, 3});
+
+  const Eigen::VectorXd x0 = supervector_->CopyToVector();
+  supervector_->PlusEqScaled(2, matching);
+  const Eigen::VectorXd block_result = supervector_->CopyToVector();
+  EXPECT_EQ(block_result, x0 + 2 * flat->CopyToVector());
+
+  // The fallback path produces the same answer.
+  supervector_->SetFromVector(x0);
+  supervector_->PlusEqScaled(2, *flat);
+  EXPECT_EQ(supervector_->CopyToVector(), block_result);
+
+  // Multi-operand accumulation, mixing partitions, also matches.
+  supervector_->SetFromVector(x0);
+  supervector_->PlusEqScaled({{2, matching}, {-1, *flat}});
+  EXPECT_EQ(supervector_->CopyToVector(), x0 + flat->CopyToVector());
+
+  // SetFrom() works for both matching and non-matching operands, and writes
+  // through to the constituent vectors.
+  supervector_->SetFrom(matching);
+  EXPECT_EQ(supervector_->CopyToVector(), flat->CopyToVector());
+  EXPECT_EQ(vec2_->GetAtIndex(1), 2);
+  supervector_->SetFromVector(x0);
+  supervector_->SetFrom(*flat);
+  EXPECT_EQ(supervector_->CopyToVector(), flat->CopyToVector());
+}
+
 TEST_F(SupervectorTest, OutOfRange) {
   EXPECT_THROW(supervector_->GetAtIndex(-1), std::out_of_range);
   EXPECT_THROW(supervector_->GetAtIndex(10), std::out_of_range);
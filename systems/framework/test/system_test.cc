@@ -411,6 +411,43 @@ TEST_F(SystemTest, SystemConstraintTest) {
   EXPECT_FALSE(system_.CheckSystemConstraintsSatisfied(context_, tol));
 }
 
+// Tests the batched constraint evaluation.
+TEST_F(SystemTest, CalcConstraintValuesTest) {
+  ContextConstraintCalc<double> calc_one = [](
+      const Context<double>& context, Eigen::VectorXd* value) {
+    unused(context);
+    (*value)[0] = 1.0;
+  };
+  ContextConstraintCalc<double> calc_two = [](
+      const Context<double>& context, Eigen::VectorXd* value) {
+    unused(context);
+    *value = Eigen::Vector2d(2.0, 3.0);
+  };
+  const SystemConstraintIndex index_one =
+      system_.AddConstraint(std::make_unique<SystemConstraint<double>>(
+          &system_, calc_one, SystemConstraintBounds::Equality(1), "one"));
+  const SystemConstraintIndex index_two =
+      system_.AddConstraint(std::make_unique<SystemConstraint<double>>(
+          &system_, calc_two, SystemConstraintBounds::Equality(2), "two"));
+
+  // All constraints, stacked in index order, into a preallocated vector.
+  Eigen::VectorXd value(3);
+  system_.CalcConstraintValues(context_, &value);
+  EXPECT_EQ(value, Eigen::Vector3d(1.0, 2.0, 3.0));
+
+  // A subset, stacked in the requested order; the output is resized.
+  system_.CalcConstraintValues(context_, {index_two, index_one}, &value);
+  EXPECT_EQ(value, Eigen::Vector3d(2.0, 3.0, 1.0));
+
+  system_.CalcConstraintValues(context_, {index_two}, &value);
+  EXPECT_EQ(value, Eigen::Vector2d(2.0, 3.0));
+
+  // An invalid index throws.
+  EXPECT_THROW(system_.CalcConstraintValues(
+                   context_, {SystemConstraintIndex(99)}, &value),
+               std::out_of_range);
+}
+
 // Tests GetMemoryObjectName.
 TEST_F(SystemTest, GetMemoryObjectName) {
   const std::string name = system_.GetMemoryObjectName();
@@ -0,0 +1,87 @@
+#include "drake/systems/framework/thread_pool.h"
+
+#include <atomic>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace systems {
+namespace internal {
+namespace {
+
+// Every task in a batch should run exactly once.
+GTEST_TEST(ThreadPoolTest, RunsEveryTask) {
+  ThreadPool pool(4);
+  EXPECT_EQ(pool.num_threads(), 4);
+
+  const int num_tasks = 100;
+  std::vector<std::atomic<int>> run_count(num_tasks);
+  for (auto& count : run_count) count = 0;
+
+  std::vector<std::function<void()>> tasks;
+  for (int i = 0; i < num_tasks; ++i)
+    tasks.push_back([&run_count, i]() { ++run_count[i]; });
+  pool.RunInParallel(tasks);
+
+  for (int i = 0; i < num_tasks; ++i)
+    EXPECT_EQ(run_count[i], 1) << "task " << i;
+}
+
+// An empty batch is a no-op.
+GTEST_TEST(ThreadPoolTest, EmptyBatch) {
+  ThreadPool pool(2);
+  EXPECT_NO_THROW(pool.RunInParallel({}));
+}
+
+// Passing num_threads=0 picks a hardware-dependent default, but always at
+// least one worker.
+GTEST_TEST(ThreadPoolTest, DefaultThreadCount) {
+  ThreadPool pool(0);
+  EXPECT_GE(pool.num_threads(), 1);
+}
+
+// Even with a single worker the calling thread participates, so a batch
+// larger than the worker count completes.
+GTEST_TEST(ThreadPoolTest, CallerParticipates) {
+  ThreadPool pool(1);
+  std::atomic<int> total{0};
+  std::vector<std::function<void()>> tasks(10, [&total]() { ++total; });
+  pool.RunInParallel(tasks);
+  EXPECT_EQ(total, 10);
+}
+
+// The pool is reusable: batches may be run back to back.
+GTEST_TEST(ThreadPoolTest, MultipleBatches) {
+  ThreadPool pool(3);
+  std::atomic<int> total{0};
+  std::vector<std::function<void()>> tasks(7, [&total]() { ++total; });
+  for (int batch = 0; batch < 5; ++batch) pool.RunInParallel(tasks);
+  EXPECT_EQ(total, 35);
+}
+
+// The first exception thrown by a task is rethrown from RunInParallel(),
+// after all tasks in the batch have completed.
+GTEST_TEST(ThreadPoolTest, RethrowsTaskException) {
+  ThreadPool pool(2);
+  std::atomic<int> completed{0};
+  std::vector<std::function<void()>> tasks;
+  for (int i = 0; i < 8; ++i) {
+    tasks.push_back([&completed, i]() {
+      if (i == 3) throw std::runtime_error("task 3 failed");
+      ++completed;
+    });
+  }
+  EXPECT_THROW(pool.RunInParallel(tasks), std::runtime_error);
+  EXPECT_EQ(completed, 7);
+
+  // The pool is still usable after a failed batch.
+  std::vector<std::function<void()>> more(4, [&completed]() { ++completed; });
+  pool.RunInParallel(more);
+  EXPECT_EQ(completed, 11);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,88 @@
+#include "drake/systems/framework/thread_pool.h"
+
+#include <algorithm>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace systems {
+namespace internal {
+
+ThreadPool::ThreadPool(int num_threads) {
+  DRAKE_DEMAND(num_threads >= 0);
+  if (num_threads == 0) {
+    // hardware_concurrency() may return 0 if it can't determine a value.
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  workers_.reserve(num_threads);
+  for (int i = 0; i < num_threads; ++i)
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this);
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    shutting_down_ = true;
+  }
+  work_available_.notify_all();
+  for (std::thread& worker : workers_) worker.join();
+}
+
+void ThreadPool::RunInParallel(
+    const std::vector<std::function<void()>>& tasks) {
+  if (tasks.empty()) return;
+  std::unique_lock<std::mutex> lock(mutex_);
+  DRAKE_DEMAND(tasks_ == nullptr);  // Not reentrant.
+  tasks_ = &tasks;
+  next_task_ = 0;
+  tasks_remaining_ = static_cast<int>(tasks.size());
+  first_exception_ = nullptr;
+  work_available_.notify_all();
+
+  // Pitch in rather than just blocking.
+  ExecuteClaimedTasks(&lock);
+
+  // Wait for tasks claimed by workers to finish.
+  batch_done_.wait(lock, [this]() { return tasks_remaining_ == 0; });
+  tasks_ = nullptr;
+  if (first_exception_ != nullptr) {
+    std::exception_ptr exception = first_exception_;
+    first_exception_ = nullptr;
+    lock.unlock();
+    std::rethrow_exception(exception);
+  }
+}
+
+void ThreadPool::WorkerLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  for (;;) {
+    work_available_.wait(lock, [this]() {
+      return shutting_down_ ||
+             (tasks_ != nullptr && next_task_ < tasks_->size());
+    });
+    if (shutting_down_) return;
+    ExecuteClaimedTasks(&lock);
+  }
+}
+
+void ThreadPool::ExecuteClaimedTasks(std::unique_lock<std::mutex>* lock) {
+  DRAKE_ASSERT(lock->owns_lock());
+  while (tasks_ != nullptr && next_task_ < tasks_->size()) {
+    const std::function<void()>& task = (*tasks_)[next_task_++];
+    lock->unlock();
+    std::exception_ptr exception;
+    try {
+      task();
+    } catch (...) {
+      exception = std::current_exception();
+    }
+    lock->lock();
+    if (exception != nullptr && first_exception_ == nullptr)
+      first_exception_ = exception;
+    if (--tasks_remaining_ == 0) batch_done_.notify_all();
+  }
+}
+
+}  // namespace internal
+}  // namespace systems
+}  // namespace drake
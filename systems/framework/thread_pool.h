@@ -0,0 +1,74 @@
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace systems {
+namespace internal {
+
+/** (Internal use only) A minimal fixed-size worker pool for executing batches
+of independent tasks. This supports the parallel execution modes in the
+systems framework (see Diagram::EnableParallelTimeDerivatives()); it is not a
+general-purpose scheduler. The pool runs one batch at a time: RunInParallel()
+distributes the supplied tasks over the workers (the calling thread pitches
+in as well), blocks until every task has finished, and rethrows the first
+exception any task raised. Workers are started once at construction and
+joined at destruction, so steady-state batch execution performs no thread
+creation. */
+class ThreadPool {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ThreadPool)
+
+  /** Starts `num_threads` worker threads. If `num_threads` is zero the
+  hardware concurrency is used instead.
+  @pre num_threads >= 0 */
+  explicit ThreadPool(int num_threads);
+
+  /** Blocks until any in-progress batch completes, then joins the workers. */
+  ~ThreadPool();
+
+  /** Executes every task in `tasks`, in an unspecified order and with
+  unspecified assignment to threads, returning when all have completed. The
+  calling thread participates in execution. If any task throws, the first
+  exception captured is rethrown here after the batch completes; subsequent
+  exceptions are dropped. Tasks must be mutually independent; this method is
+  not reentrant and may not be called concurrently from multiple threads. */
+  void RunInParallel(const std::vector<std::function<void()>>& tasks);
+
+  /** Returns the number of worker threads (not counting callers of
+  RunInParallel(), which also execute tasks). */
+  int num_threads() const { return static_cast<int>(workers_.size()); }
+
+ private:
+  void WorkerLoop();
+
+  // Claims and executes tasks from the current batch until none remain
+  // unclaimed. The given lock must be held on entry and is held on return;
+  // it is released while a task runs.
+  void ExecuteClaimedTasks(std::unique_lock<std::mutex>* lock);
+
+  std::mutex mutex_;
+  std::condition_variable work_available_;
+  std::condition_variable batch_done_;
+
+  // Batch state, all guarded by mutex_. A batch is in progress whenever
+  // tasks_ is non-null.
+  const std::vector<std::function<void()>>* tasks_{nullptr};
+  size_t next_task_{0};
+  int tasks_remaining_{0};
+  std::exception_ptr first_exception_;
+
+  bool shutting_down_{false};
+  std::vector<std::thread> workers_;
+};
+
+}  // namespace internal
+}  // namespace systems
+}  // namespace drake
@@ -105,6 +105,20 @@ class VectorBase {
     return vec;
   }
 
+  /// Copies the entire vector to a pre-allocated @p vec with no semantics.
+  /// @throws std::out_of_range if @p vec is not the same size.
+  ///
+  /// Implementations should ensure this operation is O(N) in the size of the
+  /// value and allocates no memory.
+  virtual void CopyToPreallocatedVector(Eigen::Ref<VectorX<T>> vec) const {
+    if (vec.rows() != size()) {
+      throw std::out_of_range("Destination vector must be the same size.");
+    }
+    for (int i = 0; i < size(); ++i) {
+      vec[i] = GetAtIndex(i);
+    }
+  }
+
   /// Adds a scaled version of this vector to Eigen vector @p vec, which
   /// must be the same size.
   ///
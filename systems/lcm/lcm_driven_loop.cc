@@ -1,8 +1,35 @@
 #include "drake/systems/lcm/lcm_driven_loop.h"
 
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "drake/common/text_logging.h"
+#include "drake/common/unused.h"
+
 namespace drake {
 namespace systems {
 namespace lcm {
+namespace {
+
+// A hint to the processor that we are in a spin-wait loop, so that it can
+// yield pipeline resources (and, on hyperthreaded parts, the sibling
+// thread) without involving the OS scheduler.
+inline void CpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  asm volatile("yield" ::: "memory");
+#endif
+}
+
+}  // namespace
 
 LcmDrivenLoop::LcmDrivenLoop(
     const System<double>& system, const LcmSubscriberSystem& driving_subscriber,
@@ -34,8 +61,66 @@ LcmDrivenLoop::LcmDrivenLoop(
   lcm_->StartReceiveThread();
 }
 
+bool LcmDrivenLoop::SpinForMessage(int old_message_count,
+                                   double timeout_sec) const {
+  using Clock = std::chrono::steady_clock;
+  const bool bounded = std::isfinite(timeout_sec);
+  const Clock::time_point deadline =
+      bounded ? Clock::now() + std::chrono::duration_cast<Clock::duration>(
+                                   std::chrono::duration<double>(timeout_sec))
+              : Clock::time_point::max();
+  // Check the clock only every few hundred polls so that the hot loop is
+  // just an acquire load and a pause instruction.
+  constexpr int kPollsPerClockCheck = 256;
+  while (true) {
+    for (int i = 0; i < kPollsPerClockCheck; ++i) {
+      if (driving_sub_.GetInternalMessageCount() > old_message_count) {
+        return true;
+      }
+      CpuRelax();
+    }
+    if (bounded && Clock::now() >= deadline) {
+      return driving_sub_.GetInternalMessageCount() > old_message_count;
+    }
+  }
+}
+
+void LcmDrivenLoop::PinCallingThreadToCore(int cpu_index) {
+#ifdef __linux__
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  CPU_SET(cpu_index, &cpuset);
+  const int error =
+      pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+  if (error != 0) {
+    throw std::runtime_error(
+        "LcmDrivenLoop::PinCallingThreadToCore(" + std::to_string(cpu_index) +
+        ") failed with error " + std::to_string(error));
+  }
+#else
+  unused(cpu_index);
+  log()->warn(
+      "LcmDrivenLoop::PinCallingThreadToCore() is only implemented on "
+      "Linux; doing nothing.");
+#endif
+}
+
 const AbstractValue& LcmDrivenLoop::WaitForMessage() {
-  driving_sub_.WaitForMessage(driving_sub_.GetMessageCount(*sub_context_));
+  const int old_message_count = driving_sub_.GetMessageCount(*sub_context_);
+  switch (wait_mode_) {
+    case WaitMode::kBlock:
+      driving_sub_.WaitForMessage(old_message_count);
+      break;
+    case WaitMode::kSpin:
+      SpinForMessage(old_message_count,
+                     std::numeric_limits<double>::infinity());
+      break;
+    case WaitMode::kSpinThenBlock:
+      if (!SpinForMessage(old_message_count, spin_timeout_sec_)) {
+        driving_sub_.WaitForMessage(old_message_count);
+      }
+      break;
+  }
 
   driving_sub_.CalcNextUpdateTime(*sub_context_, sub_events_.get());
 
@@ -1,6 +1,12 @@
 #include "drake/systems/lcm/lcm_publisher_system.h"
 
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -20,6 +26,150 @@ namespace {
 const int kPortIndex = 0;
 }  // namespace
 
+// Performs serialization and transmission on a background thread, fed by a
+// bounded queue of input port snapshots. The parent system enqueues from its
+// publish events; the worker thread drains the queue in FIFO order so that
+// messages are still transmitted in publication order. The serialization
+// resources (translator or serializer, LCM interface, channel name) are
+// borrowed from the parent, which outlives this object.
+class LcmPublisherSystem::AsyncPublisher {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(AsyncPublisher)
+
+  AsyncPublisher(const std::string& channel,
+                 const LcmAndVectorBaseTranslator* translator,
+                 const SerializerInterface* serializer,
+                 DrakeLcmInterface* lcm, int queue_capacity,
+                 QueueOverflowPolicy policy, bool publish_only_on_change)
+      : channel_(channel),
+        translator_(translator),
+        serializer_(serializer),
+        lcm_(lcm),
+        capacity_(queue_capacity),
+        policy_(policy),
+        publish_only_on_change_(publish_only_on_change) {
+    DRAKE_DEMAND((translator != nullptr) != (serializer != nullptr));
+    DRAKE_DEMAND(lcm != nullptr);
+    DRAKE_DEMAND(queue_capacity > 0);
+    worker_ = std::thread(&AsyncPublisher::WorkerLoop, this);
+  }
+
+  // Transmits any queued messages, then stops the worker thread.
+  ~AsyncPublisher() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    not_empty_.notify_one();
+    worker_.join();
+  }
+
+  // Queues a vector-valued input snapshot for publication.
+  void Enqueue(double time, std::unique_ptr<BasicVector<double>> value) {
+    Message message;
+    message.time = time;
+    message.vector_value = std::move(value);
+    EnqueueMessage(std::move(message));
+  }
+
+  // Queues an abstract-valued input snapshot for publication.
+  void Enqueue(double time, std::unique_ptr<AbstractValue> value) {
+    Message message;
+    message.time = time;
+    message.abstract_value = std::move(value);
+    EnqueueMessage(std::move(message));
+  }
+
+  // Returns the number of messages discarded under kDropOldest so far.
+  int64_t num_dropped_messages() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_dropped_;
+  }
+
+ private:
+  // One queued publication: the time stamp plus a snapshot of whichever kind
+  // of input port the parent system has.
+  struct Message {
+    double time{};
+    std::unique_ptr<BasicVector<double>> vector_value;
+    std::unique_ptr<AbstractValue> abstract_value;
+  };
+
+  void EnqueueMessage(Message&& message) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (policy_ == QueueOverflowPolicy::kBlock) {
+      not_full_.wait(lock, [this]() {
+        return static_cast<int>(queue_.size()) < capacity_;
+      });
+    } else if (static_cast<int>(queue_.size()) == capacity_) {
+      queue_.pop_front();
+      ++num_dropped_;
+    }
+    queue_.push_back(std::move(message));
+    lock.unlock();
+    not_empty_.notify_one();
+  }
+
+  void WorkerLoop() {
+    for (;;) {
+      Message message;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_empty_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+        if (queue_.empty()) return;  // Stopping, and fully drained.
+        message = std::move(queue_.front());
+        queue_.pop_front();
+      }
+      not_full_.notify_one();
+
+      // Serialize into the worker's reusable encode buffer.
+      if (message.vector_value != nullptr) {
+        translator_->Serialize(message.time, *message.vector_value,
+                               &message_bytes_);
+      } else {
+        serializer_->Serialize(*message.abstract_value, &message_bytes_);
+      }
+      if (publish_only_on_change_) {
+        if (last_published_valid_ && message_bytes_ == last_published_bytes_) {
+          continue;
+        }
+        std::swap(last_published_bytes_, message_bytes_);
+        last_published_valid_ = true;
+        lcm_->Publish(channel_, last_published_bytes_.data(),
+                      last_published_bytes_.size(), message.time);
+      } else {
+        lcm_->Publish(channel_, message_bytes_.data(), message_bytes_.size(),
+                      message.time);
+      }
+    }
+  }
+
+  const std::string channel_;
+  const LcmAndVectorBaseTranslator* const translator_;
+  const SerializerInterface* const serializer_;
+  DrakeLcmInterface* const lcm_;
+  const int capacity_;
+  const QueueOverflowPolicy policy_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  std::deque<Message> queue_;
+  int64_t num_dropped_{0};
+  bool stop_{false};
+
+  // Touched only by the worker thread: the reusable encode buffer and the
+  // change-detection state (see set_publish_only_on_change()).
+  const bool publish_only_on_change_;
+  std::vector<uint8_t> message_bytes_;
+  std::vector<uint8_t> last_published_bytes_;
+  bool last_published_valid_{false};
+
+  // Declared last so construction of all other members completes before the
+  // worker starts.
+  std::thread worker_;
+};
+
 // TODO(jwnimmer-tri) The "serializer xor translator" disjoint implementations
 // within the method bodies below are not ideal, because of the code smell, and
 // because it is likely confusing for users.  We should take further steps to
@@ -126,6 +276,47 @@ LcmPublisherSystem::LcmPublisherSystem(
 
 LcmPublisherSystem::~LcmPublisherSystem() {}
 
+void LcmPublisherSystem::EnableAsynchronousPublishing(
+    int queue_capacity, QueueOverflowPolicy policy) {
+  DRAKE_THROW_UNLESS(queue_capacity > 0);
+  if (async_ != nullptr) {
+    throw std::logic_error(
+        "LcmPublisherSystem::EnableAsynchronousPublishing(): asynchronous "
+        "publishing is already enabled.");
+  }
+  async_ = std::make_unique<AsyncPublisher>(
+      channel_, translator_, serializer_.get(), lcm_, queue_capacity, policy,
+      publish_only_on_change_);
+}
+
+void LcmPublisherSystem::set_publish_decimation(int keep_every) {
+  DRAKE_THROW_UNLESS(keep_every > 0);
+  publish_decimation_ = keep_every;
+  publish_event_count_ = 0;
+}
+
+void LcmPublisherSystem::set_publish_only_on_change(bool enabled) {
+  if (async_ != nullptr) {
+    throw std::logic_error(
+        "LcmPublisherSystem::set_publish_only_on_change(): must be called "
+        "before EnableAsynchronousPublishing().");
+  }
+  publish_only_on_change_ = enabled;
+  last_published_valid_ = false;
+}
+
+void LcmPublisherSystem::DisableAsynchronousPublishing() {
+  if (async_ == nullptr) return;
+  num_dropped_messages_ += async_->num_dropped_messages();
+  async_.reset();  // Drains the queue and joins the worker thread.
+}
+
+int64_t LcmPublisherSystem::num_dropped_messages() const {
+  int64_t result = num_dropped_messages_;
+  if (async_ != nullptr) result += async_->num_dropped_messages();
+  return result;
+}
+
 void LcmPublisherSystem::AddInitializationMessage(
     InitializationPublisher initialization_publisher) {
   DRAKE_DEMAND(!!initialization_publisher);
@@ -158,22 +349,61 @@ EventStatus LcmPublisherSystem::PublishInputAsLcmMessage(
   SPDLOG_TRACE(drake::log(), "Publishing LCM {} message", channel_);
   DRAKE_ASSERT((translator_ != nullptr) != (serializer_.get() != nullptr));
 
-  // Converts the input into LCM message bytes.
-  std::vector<uint8_t> message_bytes;
+  // Decimation skips superseded events before any snapshot or serialization
+  // work happens.
+  if (publish_decimation_ > 1 &&
+      (publish_event_count_++ % publish_decimation_) != 0) {
+    return EventStatus::DidNothing();
+  }
+
+  // In asynchronous mode just snapshot the input port value; the background
+  // thread performs the serialization and transmission.
+  if (async_ != nullptr) {
+    if (translator_ != nullptr) {
+      const VectorBase<double>* const input_vector =
+          this->EvalVectorInput(context, kPortIndex);
+      DRAKE_ASSERT(input_vector != nullptr);
+      async_->Enqueue(context.get_time(),
+                      std::make_unique<BasicVector<double>>(
+                          input_vector->CopyToVector()));
+    } else {
+      const AbstractValue* const input_value =
+          this->EvalAbstractInput(context, kPortIndex);
+      DRAKE_ASSERT(input_value != nullptr);
+      async_->Enqueue(context.get_time(), input_value->Clone());
+    }
+    return EventStatus::Succeeded();
+  }
+
+  // Converts the input into LCM message bytes, reusing this system's encode
+  // buffer; after the first publish, serializing a same-sized message does
+  // not allocate.
   if (translator_ != nullptr) {
     const VectorBase<double>* const input_vector =
         this->EvalVectorInput(context, kPortIndex);
     DRAKE_ASSERT(input_vector != nullptr);
-    translator_->Serialize(context.get_time(), *input_vector, &message_bytes);
+    translator_->Serialize(context.get_time(), *input_vector, &message_bytes_);
   } else {
     const AbstractValue* const input_value =
         this->EvalAbstractInput(context, kPortIndex);
     DRAKE_ASSERT(input_value != nullptr);
-    serializer_->Serialize(*input_value, &message_bytes);
+    serializer_->Serialize(*input_value, &message_bytes_);
+  }
+
+  if (publish_only_on_change_) {
+    if (last_published_valid_ && message_bytes_ == last_published_bytes_) {
+      return EventStatus::DidNothing();
+    }
+    // Keep the payload for the next comparison (by swap, not copy).
+    std::swap(last_published_bytes_, message_bytes_);
+    last_published_valid_ = true;
+    lcm_->Publish(channel_, last_published_bytes_.data(),
+                  last_published_bytes_.size(), context.get_time());
+    return EventStatus::Succeeded();
   }
 
   // Publishes onto the specified LCM channel.
-  lcm_->Publish(channel_, message_bytes.data(), message_bytes.size(),
+  lcm_->Publish(channel_, message_bytes_.data(), message_bytes_.size(),
                 context.get_time());
 
   return EventStatus::Succeeded();
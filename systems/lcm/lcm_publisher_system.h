@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -29,6 +30,11 @@ namespace lcm {
  * to happen on a per-step or periodic basis. Publishing "by force", through
  * `LcmPublisherSystem::Publish(const Context&)`, is also enabled.
  *
+ * By default, serialization and transmission happen synchronously inside the
+ * publish event, which can add jitter to a real-time simulation loop. See
+ * EnableAsynchronousPublishing() for an opt-in mode that moves that work onto
+ * a background thread.
+ *
  * @note You should generally provide an LCM interface yourself, since there
  * should normally be just one of these typically-heavyweight objects per
  * program. However, if you're sure there isn't any other need for an LCM
@@ -207,6 +213,88 @@ class LcmPublisherSystem : public LeafSystem<double> {
   void AddInitializationMessage(
       InitializationPublisher initialization_publisher);
 
+  /**
+   * Policy applied by asynchronous publishing when a message arrives while
+   * the queue is already full. See EnableAsynchronousPublishing().
+   */
+  enum class QueueOverflowPolicy {
+    /// Discard the oldest queued message to make room for the new one. Use
+    /// this for visualization and other channels where only the most recent
+    /// data matters.
+    kDropOldest,
+    /// Block the publishing (simulation) thread until the queue has room. Use
+    /// this for logging and other channels where every message must be
+    /// delivered.
+    kBlock
+  };
+
+  /**
+   * Switches this publisher to asynchronous operation. Publish events then
+   * only snapshot the input port value into a bounded queue; a background
+   * thread owned by this system performs the serialization and the
+   * DrakeLcmInterface::Publish() call, so that socket writes never block
+   * simulation stepping. Messages on any one channel are still transmitted in
+   * publication order.
+   *
+   * When the queue is full, `policy` determines whether the oldest queued
+   * message is dropped (see num_dropped_messages()) or the publishing thread
+   * blocks until the background thread catches up.
+   *
+   * This method and DisableAsynchronousPublishing() configure the system
+   * itself (not a Context) and must not be called concurrently with
+   * publishing.
+   *
+   * @pre queue_capacity is positive.
+   * @throws std::logic_error if asynchronous publishing is already enabled.
+   */
+  void EnableAsynchronousPublishing(
+      int queue_capacity = 16,
+      QueueOverflowPolicy policy = QueueOverflowPolicy::kDropOldest);
+
+  /**
+   * Returns this publisher to synchronous operation. Any queued messages are
+   * transmitted before the background thread is stopped, so this also serves
+   * as a flush. Does nothing if asynchronous publishing is not enabled.
+   */
+  void DisableAsynchronousPublishing();
+
+  /**
+   * Returns the number of messages discarded so far under
+   * QueueOverflowPolicy::kDropOldest, or zero if asynchronous publishing has
+   * never been enabled. The count is not reset by
+   * DisableAsynchronousPublishing().
+   */
+  int64_t num_dropped_messages() const;
+
+  /**
+   * When enabled, a publish event whose serialized payload is byte-for-byte
+   * identical to the most recently transmitted one is skipped instead of
+   * retransmitted. This is useful for slowly-changing signals published at a
+   * high rate, but should be left disabled for channels whose subscribers
+   * rely on periodic retransmission (e.g. as a heartbeat). Note that
+   * messages that embed the publication time in their payload will never
+   * compare equal, so change detection will have no effect for them.
+   *
+   * This method configures the system itself (not a Context) and must be
+   * called before EnableAsynchronousPublishing(), if that is used.
+   * @throws std::logic_error if asynchronous publishing is already enabled.
+   */
+  void set_publish_only_on_change(bool enabled);
+
+  /**
+   * Publishes only every @p keep_every -th publish event, starting with the
+   * first, and skips the rest before any serialization work is done. This is
+   * the cheap way to wire a high-rate signal into a low-rate consumer, e.g.
+   * `keep_every = 33` turns a 1 kHz per-step publisher into roughly 30 Hz.
+   * A value of 1 (the default) transmits every event. For suppressing
+   * repeats of an unchanged payload instead, see
+   * set_publish_only_on_change(); the two compose.
+   *
+   * This method configures the system itself (not a Context).
+   * @pre `keep_every` is positive.
+   */
+  void set_publish_decimation(int keep_every);
+
   /**
    * Returns the channel name supplied during construction.
    */
@@ -269,6 +357,10 @@ class LcmPublisherSystem : public LeafSystem<double> {
   void get_output_port(int) = delete;
 
  private:
+  // Owns the bounded message queue and background thread used for
+  // asynchronous publishing; defined in the .cc file.
+  class AsyncPublisher;
+
   EventStatus PublishInputAsLcmMessage(const Context<double>& context) const;
 
   // All constructors delegate to here. If the lcm pointer is null, we'll
@@ -310,6 +402,32 @@ class LcmPublisherSystem : public LeafSystem<double> {
 
   // TODO(edrumwri) Remove this when set_publish_period() is removed.
   bool disable_internal_per_step_publish_events_{false};
+
+  // See set_publish_only_on_change().
+  bool publish_only_on_change_{false};
+
+  // See set_publish_decimation(). The counter tracks publish events seen,
+  // including the skipped ones.
+  int publish_decimation_{1};
+  mutable int64_t publish_event_count_{0};
+
+  // Reusable encode buffer for synchronous publishing, sized once to the
+  // message's encoded size instead of freshly allocated per message.
+  mutable std::vector<uint8_t> message_bytes_;
+
+  // The payload most recently transmitted, kept for change detection; only
+  // meaningful when last_published_valid_ is true.
+  mutable std::vector<uint8_t> last_published_bytes_;
+  mutable bool last_published_valid_{false};
+
+  // Dropped-message count carried over from previously-destroyed
+  // AsyncPublisher instances; see num_dropped_messages().
+  int64_t num_dropped_messages_{0};
+
+  // Non-null iff asynchronous publishing is enabled. Declared last so it is
+  // destroyed (draining the queue and joining the background thread) before
+  // the members it references above.
+  std::unique_ptr<AsyncPublisher> async_;
 };
 
 }  // namespace lcm
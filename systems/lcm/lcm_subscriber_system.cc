@@ -1,5 +1,7 @@
 #include "drake/systems/lcm/lcm_subscriber_system.h"
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iostream>
 #include <utility>
@@ -102,23 +104,24 @@ void LcmSubscriberSystem::ProcessMessageAndStoreToDiscreteState(
     DiscreteValues<double>* discrete_state) const {
   DRAKE_ASSERT(is_discrete_state());
 
-  std::lock_guard<std::mutex> lock(received_message_mutex_);
-  if (!received_message_.empty()) {
+  std::vector<uint8_t> message_bytes;
+  const int message_count = CopyLatestMessageInto(&message_bytes);
+  if (!message_bytes.empty()) {
     if (translator_) {
       translator_->Deserialize(
-          received_message_.data(), received_message_.size(),
+          message_bytes.data(), message_bytes.size(),
           &discrete_state->get_mutable_vector(kStateIndexMessage));
     } else {
       DRAKE_THROW_UNLESS(
-          static_cast<int>(received_message_.size()) == fixed_encoded_size_);
+          static_cast<int>(message_bytes.size()) == fixed_encoded_size_);
       auto& xd = discrete_state->get_mutable_vector(kStateIndexMessage);
       for (int i = 0; i < fixed_encoded_size_; ++i) {
-        xd[i] = received_message_[i];
+        xd[i] = message_bytes[i];
       }
     }
   }
   discrete_state->get_mutable_vector(kStateIndexMessageCount)
-      .SetAtIndex(0, received_message_count_);
+      .SetAtIndex(0, message_count);
 }
 
 void LcmSubscriberSystem::ProcessMessageAndStoreToAbstractState(
@@ -126,14 +129,15 @@ void LcmSubscriberSystem::ProcessMessageAndStoreToAbstractState(
   DRAKE_ASSERT(is_abstract_state());
   DRAKE_ASSERT(serializer_ != nullptr);
 
-  std::lock_guard<std::mutex> lock(received_message_mutex_);
-  if (!received_message_.empty()) {
+  std::vector<uint8_t> message_bytes;
+  const int message_count = CopyLatestMessageInto(&message_bytes);
+  if (!message_bytes.empty()) {
     serializer_->Deserialize(
-        received_message_.data(), received_message_.size(),
+        message_bytes.data(), message_bytes.size(),
         &abstract_state->get_mutable_value(kStateIndexMessage));
   }
   abstract_state->get_mutable_value(kStateIndexMessageCount)
-      .GetMutableValue<int>() = received_message_count_;
+      .GetMutableValue<int>() = message_count;
 }
 
 int LcmSubscriberSystem::GetMessageCount(const Context<double>& context) const {
@@ -159,10 +163,8 @@ void LcmSubscriberSystem::DoCalcNextUpdateTime(
 
   // Do nothing unless we have a new message.
   const int last_message_count = GetMessageCount(context);
-  const int received_message_count = [this]() {
-    std::unique_lock<std::mutex> lock(received_message_mutex_);
-    return received_message_count_;
-  }();
+  const int received_message_count =
+      received_message_count_.load(std::memory_order_acquire);
   if (last_message_count == received_message_count) {
     return;
   }
@@ -273,44 +275,91 @@ void LcmSubscriberSystem::HandleMessage(const void* buffer, int size) {
   SPDLOG_TRACE(drake::log(), "Receiving LCM {} message", channel_);
 
   const uint8_t* const rbuf_begin = static_cast<const uint8_t*>(buffer);
-  const uint8_t* const rbuf_end = rbuf_begin + size;
-  std::lock_guard<std::mutex> lock(received_message_mutex_);
-  received_message_.clear();
-  received_message_.insert(received_message_.begin(), rbuf_begin, rbuf_end);
-  received_message_count_++;
+  const int count =
+      received_message_count_.load(std::memory_order_relaxed) + 1;
+  MessageSlot& slot = slots_[count % 2];
+
+  // Mark the slot's contents as in flight (odd stamp), publish the bytes,
+  // then stamp the slot with this message's number (even stamp).
+  slot.sequence.store(2 * static_cast<int64_t>(count) - 1,
+                      std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  if (static_cast<int>(slot.storage.capacity()) < size) {
+    // Grow by swapping in a fresh allocation and retiring the old one (a
+    // reader that is about to fail its stamp re-check may still be copying
+    // from it); doubling keeps the number of retirements logarithmic.
+    std::vector<uint8_t> grown;
+    grown.reserve(std::max<size_t>(size, 2 * slot.storage.capacity()));
+    slot.storage.swap(grown);
+    retired_message_storage_.push_back(std::move(grown));
+  }
+  slot.storage.assign(rbuf_begin, rbuf_begin + size);
+  slot.data.store(slot.storage.data(), std::memory_order_relaxed);
+  slot.size.store(size, std::memory_order_relaxed);
+  slot.sequence.store(2 * static_cast<int64_t>(count),
+                      std::memory_order_release);
+  received_message_count_.store(count, std::memory_order_release);
+
+  // Pass through the (normally uncontended) mutex so that a WaitForMessage()
+  // caller between its predicate check and its wait cannot miss the
+  // notification; only waiters ever hold this mutex, so the receive thread
+  // is never blocked by readers.
+  { std::lock_guard<std::mutex> lock(received_message_mutex_); }
   received_message_condition_variable_.notify_all();
 }
 
+int LcmSubscriberSystem::CopyLatestMessageInto(
+    std::vector<uint8_t>* message_bytes) const {
+  while (true) {
+    const int count = received_message_count_.load(std::memory_order_acquire);
+    if (count == 0) {
+      message_bytes->clear();
+      return 0;
+    }
+    const MessageSlot& slot = slots_[count % 2];
+    const int64_t expected_sequence = 2 * static_cast<int64_t>(count);
+    if (slot.sequence.load(std::memory_order_acquire) != expected_sequence) {
+      // The receive thread has already moved past this message; retry
+      // against the newer message count.
+      continue;
+    }
+    const uint8_t* const data = slot.data.load(std::memory_order_relaxed);
+    const int size = slot.size.load(std::memory_order_relaxed);
+    message_bytes->assign(data, data + size);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.sequence.load(std::memory_order_relaxed) == expected_sequence) {
+      return count;
+    }
+  }
+}
+
 int LcmSubscriberSystem::WaitForMessage(
     int old_message_count, AbstractValue* message) const {
   DRAKE_ASSERT(serializer_ != nullptr);
 
   // The message buffer and counter are updated in HandleMessage(), which is
   // a callback function invoked by a different thread owned by the
-  // drake::lcm::DrakeLcmInterface instance passed to the constructor. Thus,
-  // for thread safety, these need to be properly protected by a mutex.
+  // drake::lcm::DrakeLcmInterface instance passed to the constructor.  The
+  // mutex and condition variable only park this caller; the snapshot itself
+  // is taken lock-free below.
   std::unique_lock<std::mutex> lock(received_message_mutex_);
+  received_message_condition_variable_.wait(lock, [this, old_message_count]() {
+    return received_message_count_.load(std::memory_order_acquire) >
+           old_message_count;
+  });
+  lock.unlock();
 
-  // This while loop is necessary to guard for spurious wakeup:
-  // https://en.wikipedia.org/wiki/Spurious_wakeup
-  while (old_message_count >= received_message_count_) {
-    // When wait returns, lock is atomically acquired. So it's thread safe to
-    // read received_message_count_.
-    received_message_condition_variable_.wait(lock);
-  }
-  int new_message_count = received_message_count_;
+  std::vector<uint8_t> message_bytes;
+  const int new_message_count = CopyLatestMessageInto(&message_bytes);
   if (message) {
-      serializer_->Deserialize(
-          received_message_.data(), received_message_.size(), message);
+    serializer_->Deserialize(message_bytes.data(), message_bytes.size(),
+                             message);
   }
-  lock.unlock();
-
   return new_message_count;
 }
 
 int LcmSubscriberSystem::GetInternalMessageCount() const {
-  std::unique_lock<std::mutex> lock(received_message_mutex_);
-  return received_message_count_;
+  return received_message_count_.load(std::memory_order_acquire);
 }
 
 const LcmAndVectorBaseTranslator& LcmSubscriberSystem::get_translator() const {
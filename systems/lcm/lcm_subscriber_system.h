@@ -1,6 +1,9 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -28,6 +31,13 @@ namespace lcm {
  * earliest possible simulation time. The output is always consistent with the
  * State.
  *
+ * Incoming messages are conflated keep-latest style: the receive thread only
+ * stores the raw bytes of the newest message, and decoding is deferred until
+ * the message is copied into the State during an update event. A consumer
+ * that updates less often than messages arrive (say a 30 Hz process fed by a
+ * 1 kHz channel) therefore decodes only the message it actually uses;
+ * superseded raw buffers are discarded undecoded.
+ *
  * To process a LCM message, CalcNextUpdateTime() needs to be called first to
  * check for new messages and schedule a callback event if a new LCM message
  * has arrived. The message is then processed and stored in the Context by
@@ -232,6 +242,11 @@ class LcmSubscriberSystem : public LeafSystem<double> {
   // Callback entry point from LCM into this class.
   void HandleMessage(const void*, int);
 
+  // Copies the bytes of the most recently received message (if any) into
+  // *message_bytes and returns the message count at the time of the copy.
+  // Never blocks the receive thread; see the comments on slots_ below.
+  int CopyLatestMessageInto(std::vector<uint8_t>* message_bytes) const;
+
   // This pair of methods is used for the output port when we're using a
   // translator.
   std::unique_ptr<BasicVector<double>> AllocateTranslatorOutputValue() const;
@@ -264,17 +279,40 @@ class LcmSubscriberSystem : public LeafSystem<double> {
   const std::unique_ptr<SerializerInterface> serializer_;
   const int fixed_encoded_size_;
 
-  // The mutex that guards received_message_ and received_message_count_.
-  mutable std::mutex received_message_mutex_;
-
-  // A condition variable that's signaled every time the handler is called.
-  mutable std::condition_variable received_message_condition_variable_;
-
-  // The bytes of the most recently received LCM message.
-  std::vector<uint8_t> received_message_;
+  // Lock-free single-producer handoff from the LCM receive thread to readers.
+  //
+  // The receive thread writes message n into slots_[n % 2].  Each slot
+  // carries a sequence stamp that equals 2*n while the slot stably holds
+  // message n, and an odd value while a write is in flight.  A reader loads
+  // received_message_count_, copies the bytes out of the corresponding slot,
+  // and then re-checks the stamp; on a mismatch (the receive thread has moved
+  // on) it simply retries against the newer message.  Readers therefore take
+  // a consistent snapshot without ever blocking the receiver.
+  struct MessageSlot {
+    std::atomic<int64_t> sequence{0};
+    // Touched only by the receive thread; data and size below are what
+    // readers consume.
+    std::vector<uint8_t> storage;
+    std::atomic<const uint8_t*> data{nullptr};
+    std::atomic<int> size{0};
+  };
+
+  std::array<MessageSlot, 2> slots_;
+
+  // When a slot's storage must grow, the old allocation is retired here
+  // (kept until destruction) rather than freed, so that a reader that is
+  // about to fail its stamp re-check never copies from freed memory.  The
+  // doubling growth policy bounds this list's size logarithmically.
+  std::vector<std::vector<uint8_t>> retired_message_storage_;
 
   // A message counter that's incremented every time the handler is called.
-  int received_message_count_{0};
+  std::atomic<int> received_message_count_{0};
+
+  // The receive thread never holds this mutex while publishing a message;
+  // together with the condition variable it exists only to park
+  // WaitForMessage() callers until the message count advances.
+  mutable std::mutex received_message_mutex_;
+  mutable std::condition_variable received_message_condition_variable_;
 };
 
 }  // namespace lcm
@@ -80,7 +80,7 @@ void publish() {
 // The receiving Diagram in this test consists of a LcmSubscriberSystem,
 // a DummySys and a SignalLogger. The intended behavior is that every time
 // a new Lcm message arrives, its timestamp will be logged by the SignalLogger.
-GTEST_TEST(LcmDrivenLoopTest, TestLoop) {
+void RunLoopTest(LcmDrivenLoop::WaitMode wait_mode) {
   drake::lcm::DrakeLcm lcm(kLcmUrl);
   DiagramBuilder<double> builder;
 
@@ -106,6 +106,7 @@ GTEST_TEST(LcmDrivenLoopTest, TestLoop) {
   // every time it handles a message, which triggers the logger to save its
   // input (message time stamp) to the log.
   dut.set_publish_on_every_received_message(true);
+  dut.set_wait_mode(wait_mode);
 
   // Starts the publishing thread.
   std::thread pub_thread(&publish);
@@ -138,6 +139,17 @@ GTEST_TEST(LcmDrivenLoopTest, TestLoop) {
                                      drake::MatrixCompareType::absolute));
 }
 
+GTEST_TEST(LcmDrivenLoopTest, TestLoop) {
+  RunLoopTest(LcmDrivenLoop::WaitMode::kBlock);
+}
+
+// The spin-then-block mode must deliver the same messages as the blocking
+// mode; with the messages arriving every 100ms, each wait spins for the
+// timeout and then parks, so both wait paths are exercised.
+GTEST_TEST(LcmDrivenLoopTest, TestLoopSpinThenBlock) {
+  RunLoopTest(LcmDrivenLoop::WaitMode::kSpinThenBlock);
+}
+
 }  // namespace
 }  // namespace lcm
 }  // namespace systems
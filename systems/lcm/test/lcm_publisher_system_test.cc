@@ -162,6 +162,65 @@ GTEST_TEST(LcmPublisherSystemTest, PublishTest) {
   TestPublisher(channel_name, &lcm, &dut);
 }
 
+// Tests asynchronous publishing. The kBlock overflow policy guarantees no
+// message is dropped, and DisableAsynchronousPublishing() flushes the queue
+// and stops the background thread, so afterwards we can inspect the mock LCM
+// without racing the worker.
+GTEST_TEST(LcmPublisherSystemTest, AsynchronousPublishTest) {
+  lcm::DrakeMockLcm lcm;
+  const std::string channel_name = "drake_system2_lcm_test_async_channel_name";
+  LcmtDrakeSignalTranslator translator(kDim);
+
+  LcmPublisherSystem dut(channel_name, translator, &lcm);
+  dut.EnableAsynchronousPublishing(
+      4, LcmPublisherSystem::QueueOverflowPolicy::kBlock);
+
+  // Enabling twice is an error.
+  EXPECT_THROW(dut.EnableAsynchronousPublishing(), std::logic_error);
+
+  auto context = dut.CreateDefaultContext();
+  auto vec = make_unique<BasicVector<double>>(kDim);
+  for (int i = 0; i < kDim; ++i) (*vec)[i] = i;
+  context->FixInputPort(kPortNumber, std::move(vec));
+
+  // Publish several messages; more than the queue capacity, to exercise the
+  // blocking backpressure path.
+  const double time = 1.41421356;
+  for (int i = 0; i < 10; ++i) {
+    context->set_time(time + i);
+    dut.Publish(*context);
+  }
+  dut.DisableAsynchronousPublishing();
+  EXPECT_EQ(dut.num_dropped_messages(), 0);
+
+  // The most recent publication must be the last one we made, with the same
+  // contents the synchronous path would have produced.
+  const std::vector<uint8_t>& published_message_bytes =
+      lcm.get_last_published_message(channel_name);
+  drake::lcmt_drake_signal received_message;
+  received_message.decode(&published_message_bytes[0], 0,
+                          published_message_bytes.size());
+
+  drake::lcmt_drake_signal expected_message;
+  expected_message.dim = kDim;
+  expected_message.val.resize(kDim);
+  expected_message.coord.resize(kDim);
+  for (int i = 0; i < kDim; ++i) {
+    expected_message.val[i] = i;
+    expected_message.coord[i] = "";
+  }
+  expected_message.timestamp = static_cast<int64_t>((time + 9) * 1000);
+  EXPECT_TRUE(
+      CompareLcmtDrakeSignalMessages(received_message, expected_message));
+  EXPECT_EQ(lcm.get_last_publication_time(channel_name).value_or(-1.0),
+            time + 9);
+
+  // After disabling, publishing is synchronous again.
+  context->set_time(time);
+  dut.Publish(*context);
+  EXPECT_EQ(lcm.get_last_publication_time(channel_name).value_or(-1.0), time);
+}
+
 // Tests LcmPublisherSystem using a dictionary that contains a translator.
 GTEST_TEST(LcmPublisherSystemTest, PublishTestUsingDictionary) {
   lcm::DrakeMockLcm lcm;
@@ -210,6 +269,65 @@ GTEST_TEST(LcmPublisherSystemTest, SerializerTest) {
   EXPECT_TRUE(CompareLcmtDrakeSignalMessages(received_message, sample_data));
 }
 
+// Tests that change detection skips retransmission of identical payloads.
+GTEST_TEST(LcmPublisherSystemTest, PublishOnlyOnChangeTest) {
+  lcm::DrakeMockLcm lcm;
+  const std::string channel_name = "channel_name";
+  int transmission_count = 0;
+  lcm.Subscribe(channel_name, [&transmission_count](const void*, int) {
+    ++transmission_count;
+  });
+  lcm.EnableLoopBack();
+
+  auto dut = LcmPublisherSystem::Make<lcmt_drake_signal>(channel_name, &lcm);
+  dut->set_publish_only_on_change(true);
+  unique_ptr<Context<double>> context = dut->CreateDefaultContext();
+  const lcmt_drake_signal sample_data{
+    2, { 1.0, 2.0, }, { "x", "y", }, 12345,
+  };
+  context->FixInputPort(kPortNumber,
+                        make_unique<Value<lcmt_drake_signal>>(sample_data));
+
+  // The first publish transmits; a repeat of the same payload does not.
+  dut->Publish(*context);
+  dut->Publish(*context);
+  EXPECT_EQ(transmission_count, 1);
+
+  // A changed payload transmits again.
+  lcmt_drake_signal new_data = sample_data;
+  new_data.val[0] = 3.0;
+  context->FixInputPort(kPortNumber,
+                        make_unique<Value<lcmt_drake_signal>>(new_data));
+  dut->Publish(*context);
+  EXPECT_EQ(transmission_count, 2);
+}
+
+// Tests that decimation transmits only every Nth publish event.
+GTEST_TEST(LcmPublisherSystemTest, PublishDecimationTest) {
+  lcm::DrakeMockLcm lcm;
+  const std::string channel_name = "channel_name";
+  int transmission_count = 0;
+  lcm.Subscribe(channel_name, [&transmission_count](const void*, int) {
+    ++transmission_count;
+  });
+  lcm.EnableLoopBack();
+
+  auto dut = LcmPublisherSystem::Make<lcmt_drake_signal>(channel_name, &lcm);
+  dut->set_publish_decimation(3);
+  unique_ptr<Context<double>> context = dut->CreateDefaultContext();
+  const lcmt_drake_signal sample_data{
+    2, { 1.0, 2.0, }, { "x", "y", }, 12345,
+  };
+  context->FixInputPort(kPortNumber,
+                        make_unique<Value<lcmt_drake_signal>>(sample_data));
+
+  // Events 1 and 4 transmit; events 2, 3, 5, and 6 are skipped.
+  for (int i = 0; i < 6; ++i) {
+    dut->Publish(*context);
+  }
+  EXPECT_EQ(transmission_count, 2);
+}
+
 // Tests that per-step publish generates the expected number of publishes.
 GTEST_TEST(LcmPublisherSystemTest, TestPerStepPublish) {
   lcm::DrakeMockLcm lcm;
@@ -0,0 +1,69 @@
+#include "drake/systems/primitives/jit_symbolic_vector_system.h"
+
+#include <vector>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace systems {
+
+JitSymbolicVectorSystem::JitSymbolicVectorSystem(
+    const Eigen::Ref<const VectorX<symbolic::Variable>>& state,
+    const Eigen::Ref<const VectorX<symbolic::Variable>>& input,
+    const Eigen::Ref<const VectorX<symbolic::Expression>>& dynamics,
+    const Eigen::Ref<const VectorX<symbolic::Expression>>& output)
+    : num_states_(static_cast<int>(state.size())),
+      num_inputs_(static_cast<int>(input.size())),
+      num_outputs_(static_cast<int>(output.size())) {
+  DRAKE_THROW_UNLESS(num_states_ > 0);
+  DRAKE_THROW_UNLESS(static_cast<int>(dynamics.size()) == num_states_);
+
+  // The compiled kernels take the stacked vector [x; u] as parameters.
+  std::vector<symbolic::Variable> parameters;
+  parameters.reserve(num_states_ + num_inputs_);
+  for (int i = 0; i < num_states_; ++i) parameters.push_back(state[i]);
+  for (int i = 0; i < num_inputs_; ++i) parameters.push_back(input[i]);
+
+  dynamics_function_ = std::make_unique<symbolic::JitCompiledFunction>(
+      "dynamics", parameters, dynamics);
+
+  this->DeclareContinuousState(num_states_);
+  if (num_inputs_ > 0) {
+    this->DeclareInputPort(kVectorValued, num_inputs_);
+  }
+  if (num_outputs_ > 0) {
+    output_function_ = std::make_unique<symbolic::JitCompiledFunction>(
+        "output", parameters, output);
+    this->DeclareVectorOutputPort(BasicVector<double>(num_outputs_),
+                                  &JitSymbolicVectorSystem::CalcOutputY);
+  }
+}
+
+Eigen::VectorXd JitSymbolicVectorSystem::EvalParameters(
+    const Context<double>& context) const {
+  Eigen::VectorXd p(num_states_ + num_inputs_);
+  p.head(num_states_) = context.get_continuous_state_vector().CopyToVector();
+  if (num_inputs_ > 0) {
+    const BasicVector<double>* input = this->EvalVectorInput(context, 0);
+    DRAKE_DEMAND(input != nullptr);
+    p.tail(num_inputs_) = input->get_value();
+  }
+  return p;
+}
+
+void JitSymbolicVectorSystem::DoCalcTimeDerivatives(
+    const Context<double>& context, ContinuousState<double>* derivatives) const {
+  Eigen::MatrixXd xdot(num_states_, 1);
+  dynamics_function_->Eval(EvalParameters(context), &xdot);
+  derivatives->SetFromVector(xdot.col(0));
+}
+
+void JitSymbolicVectorSystem::CalcOutputY(
+    const Context<double>& context, BasicVector<double>* output_vector) const {
+  Eigen::MatrixXd y(num_outputs_, 1);
+  output_function_->Eval(EvalParameters(context), &y);
+  output_vector->SetFromVector(y.col(0));
+}
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <memory>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/symbolic.h"
+#include "drake/common/symbolic_codegen_jit.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+
+/// A continuous-time system whose dynamics `ẋ = f(x, u)` and output
+/// `y = g(x, u)` are given as symbolic expressions which are compiled to
+/// native code at construction time with symbolic::JitCompiledFunction.
+///
+/// This provides a drop-in System<double> for models whose dynamics are
+/// available in closed form symbolically (e.g. derived offline from a plant
+/// model): every evaluation of the time derivatives or the output calls the
+/// compiled kernel instead of traversing expression trees, which makes long
+/// simulation rollouts considerably cheaper.
+///
+/// This system is only available for `T = double` since the compiled kernels
+/// evaluate in double precision.
+class JitSymbolicVectorSystem final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(JitSymbolicVectorSystem)
+
+  /// Constructs a system with continuous dynamics `ẋ = f(x, u)` and output
+  /// `y = g(x, u)`.
+  ///
+  /// @param[in] state    State variables `x`; defines the ordering of the
+  ///                     continuous state. Must not be empty.
+  /// @param[in] input    Input variables `u`; if empty, no input port is
+  ///                     declared.
+  /// @param[in] dynamics Expressions for `ẋ` in terms of @p state and
+  ///                     @p input; must have the same size as @p state.
+  /// @param[in] output   Expressions for `y` in terms of @p state and
+  ///                     @p input; if empty, no output port is declared.
+  /// @throws std::runtime_error if the sizes are inconsistent or if
+  /// compilation of the generated code fails.
+  JitSymbolicVectorSystem(
+      const Eigen::Ref<const VectorX<symbolic::Variable>>& state,
+      const Eigen::Ref<const VectorX<symbolic::Variable>>& input,
+      const Eigen::Ref<const VectorX<symbolic::Expression>>& dynamics,
+      const Eigen::Ref<const VectorX<symbolic::Expression>>& output);
+
+ private:
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const override;
+
+  void CalcOutputY(const Context<double>& context,
+                   BasicVector<double>* output_vector) const;
+
+  // Gathers [x; u] from the context in the parameter ordering expected by
+  // the compiled kernels.
+  Eigen::VectorXd EvalParameters(const Context<double>& context) const;
+
+  const int num_states_;
+  const int num_inputs_;
+  const int num_outputs_;
+  std::unique_ptr<symbolic::JitCompiledFunction> dynamics_function_;
+  std::unique_ptr<symbolic::JitCompiledFunction> output_function_;
+};
+
+}  // namespace systems
+}  // namespace drake
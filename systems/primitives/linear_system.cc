@@ -84,10 +84,15 @@ unique_ptr<LinearSystem<T>> LinearSystem<T>::MakeLinearSystem(
 namespace {
 
 // Helper function allows reuse for both FirstOrderTaylorApproximation and
-// Linearize.
+// Linearize, either with a freshly constructed AutoDiffXd clone of `system`
+// (the free-function entry points) or with one cached across calls (the
+// Linearizer class). The `autodiff_context` is reinitialized from `context`
+// here, so any state left over from a previous call is overwritten.
 std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
     const System<double>& system, const Context<double>& context,
-    int input_port_index, int output_port_index,
+    const System<AutoDiffXd>& autodiff_system,
+    Context<AutoDiffXd>* autodiff_context, int input_port_index,
+    int output_port_index,
     optional<double> equilibrium_check_tolerance = nullopt) {
   DRAKE_ASSERT_VOID(system.CheckValidContext(context));
 
@@ -105,24 +110,18 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
     time_period = periodic_data->period_sec();
   }
 
-  // Create an autodiff version of the system.
-  std::unique_ptr<System<AutoDiffXd>> autodiff_system =
-      drake::systems::System<double>::ToAutoDiffXd(system);
-
   // Initialize autodiff.
-  std::unique_ptr<Context<AutoDiffXd>> autodiff_context =
-      autodiff_system->CreateDefaultContext();
   autodiff_context->SetTimeStateAndParametersFrom(context);
 
   const InputPort<AutoDiffXd>* input_port = nullptr;
   // By default, use the first input / output ports (if they exist).
   if (input_port_index == kUseFirstInputIfItExists) {
     if (system.get_num_input_ports() > 0) {
-      input_port = &(autodiff_system->get_input_port(0));
+      input_port = &(autodiff_system.get_input_port(0));
     }
   } else if (input_port_index >= 0 &&
              input_port_index < system.get_num_input_ports()) {
-    input_port = &(autodiff_system->get_input_port(input_port_index));
+    input_port = &(autodiff_system.get_input_port(input_port_index));
   } else if (input_port_index != kNoInput) {
     DRAKE_ABORT_MSG("Invalid input_port_index specified.");
   }
@@ -130,11 +129,11 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
   // By default, use the first input / output ports (if they exist).
   if (output_port_index == kUseFirstOutputIfItExists) {
     if (system.get_num_output_ports() > 0) {
-      output_port = &(autodiff_system->get_output_port(0));
+      output_port = &(autodiff_system.get_output_port(0));
     }
   } else if (output_port_index >= 0 &&
              output_port_index < system.get_num_output_ports()) {
-    output_port = &(autodiff_system->get_output_port(output_port_index));
+    output_port = &(autodiff_system.get_output_port(output_port_index));
   } else if (output_port_index != kNoOutput) {
     DRAKE_ABORT_MSG("Invalid output_port_index specified.");
   }
@@ -176,8 +175,8 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
       autodiff_context->get_mutable_continuous_state_vector().SetFromVector(
           std::get<0>(autodiff_args));
       std::unique_ptr<ContinuousState<AutoDiffXd>> autodiff_xdot =
-          autodiff_system->AllocateTimeDerivatives();
-      autodiff_system->CalcTimeDerivatives(*autodiff_context,
+          autodiff_system.AllocateTimeDerivatives();
+      autodiff_system.CalcTimeDerivatives(*autodiff_context,
                                            autodiff_xdot.get());
       auto autodiff_xdot_vec = autodiff_xdot->CopyToVector();
 
@@ -205,8 +204,8 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
           autodiff_context->get_mutable_discrete_state().get_mutable_vector();
       autodiff_x0.SetFromVector(std::get<0>(autodiff_args));
       std::unique_ptr<DiscreteValues<AutoDiffXd>> autodiff_x1 =
-          autodiff_system->AllocateDiscreteVariables();
-      autodiff_system->CalcDiscreteVariableUpdates(*autodiff_context,
+          autodiff_system.AllocateDiscreteVariables();
+      autodiff_system.CalcDiscreteVariableUpdates(*autodiff_context,
                                                    autodiff_x1.get());
       auto autodiff_x1_vec = autodiff_x1->get_vector().CopyToVector();
 
@@ -261,27 +260,67 @@ std::unique_ptr<AffineSystem<double>> DoFirstOrderTaylorApproximation(
                                                 time_period);
 }
 
+// Converts `affine` (the Taylor approximation at an equilibrium point) to a
+// LinearSystem by dropping the (zero) affine terms.
+std::unique_ptr<LinearSystem<double>> MakeLinearizedSystem(
+    const AffineSystem<double>& affine) {
+  return std::make_unique<LinearSystem<double>>(affine.A(), affine.B(),
+                                                affine.C(), affine.D(),
+                                                affine.time_period());
+}
+
 }  // namespace
 
 std::unique_ptr<LinearSystem<double>> Linearize(
     const System<double>& system, const Context<double>& context,
     int input_port_index, int output_port_index,
     double equilibrium_check_tolerance) {
+  std::unique_ptr<System<AutoDiffXd>> autodiff_system =
+      System<double>::ToAutoDiffXd(system);
+  std::unique_ptr<Context<AutoDiffXd>> autodiff_context =
+      autodiff_system->CreateDefaultContext();
   std::unique_ptr<AffineSystem<double>> affine =
-      DoFirstOrderTaylorApproximation(system, context, input_port_index,
-                                      output_port_index,
-                                      equilibrium_check_tolerance);
+      DoFirstOrderTaylorApproximation(
+          system, context, *autodiff_system, autodiff_context.get(),
+          input_port_index, output_port_index, equilibrium_check_tolerance);
 
-  return std::make_unique<LinearSystem<double>>(affine->A(), affine->B(),
-                                                affine->C(), affine->D(),
-                                                affine->time_period());
+  return MakeLinearizedSystem(*affine);
 }
 
 std::unique_ptr<AffineSystem<double>> FirstOrderTaylorApproximation(
     const System<double>& system, const Context<double>& context,
     int input_port_index, int output_port_index) {
-  return DoFirstOrderTaylorApproximation(system, context, input_port_index,
-                                         output_port_index);
+  std::unique_ptr<System<AutoDiffXd>> autodiff_system =
+      System<double>::ToAutoDiffXd(system);
+  std::unique_ptr<Context<AutoDiffXd>> autodiff_context =
+      autodiff_system->CreateDefaultContext();
+  return DoFirstOrderTaylorApproximation(system, context, *autodiff_system,
+                                         autodiff_context.get(),
+                                         input_port_index, output_port_index);
+}
+
+Linearizer::Linearizer(const System<double>& system)
+    : system_(system),
+      autodiff_system_(System<double>::ToAutoDiffXd(system)),
+      autodiff_context_(autodiff_system_->CreateDefaultContext()) {}
+
+std::unique_ptr<LinearSystem<double>> Linearizer::Linearize(
+    const Context<double>& context, int input_port_index,
+    int output_port_index, double equilibrium_check_tolerance) {
+  std::unique_ptr<AffineSystem<double>> affine =
+      DoFirstOrderTaylorApproximation(
+          system_, context, *autodiff_system_, autodiff_context_.get(),
+          input_port_index, output_port_index, equilibrium_check_tolerance);
+
+  return MakeLinearizedSystem(*affine);
+}
+
+std::unique_ptr<AffineSystem<double>> Linearizer::FirstOrderTaylorApproximation(
+    const Context<double>& context, int input_port_index,
+    int output_port_index) {
+  return DoFirstOrderTaylorApproximation(system_, context, *autodiff_system_,
+                                         autodiff_context_.get(),
+                                         input_port_index, output_port_index);
 }
 
 /// Returns the controllability matrix:  R = [B, AB, ..., A^{n-1}B].
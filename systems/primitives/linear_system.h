@@ -3,6 +3,7 @@
 #include <memory>
 #include <utility>
 
+#include "drake/common/autodiff.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_optional.h"
 #include "drake/common/symbolic.h"
@@ -251,6 +252,47 @@ std::unique_ptr<AffineSystem<double>> FirstOrderTaylorApproximation(
     int input_port_index = kUseFirstInputIfItExists,
     int output_port_index = kUseFirstOutputIfItExists);
 
+/// Caches the AutoDiffXd conversion of a System so that repeated
+/// linearizations pay only for derivative evaluation, not reconstruction.
+/// The free functions Linearize() and FirstOrderTaylorApproximation() above
+/// rebuild an AutoDiffXd clone of the given system on every call; for large
+/// systems (e.g. a multibody plant) that construction can dominate the cost
+/// of the linearization itself. Construct a %Linearizer once and call its
+/// methods with a different Context each time, e.g. at successive operating
+/// points along a trajectory. The results are identical to those of the free
+/// functions.
+///
+/// @ingroup primitive_systems
+class Linearizer {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Linearizer)
+
+  /// Converts @p system to AutoDiffXd (the expensive step, paid once) and
+  /// allocates a paired context for it. The @p system reference must remain
+  /// valid for the lifetime of this object.
+  explicit Linearizer(const System<double>& system);
+
+  /// Equivalent to Linearize(system, context, ...) using the cached
+  /// AutoDiffXd system; see that function for documentation.
+  std::unique_ptr<LinearSystem<double>> Linearize(
+      const Context<double>& context,
+      int input_port_index = kUseFirstInputIfItExists,
+      int output_port_index = kUseFirstOutputIfItExists,
+      double equilibrium_check_tolerance = 1e-6);
+
+  /// Equivalent to FirstOrderTaylorApproximation(system, context, ...) using
+  /// the cached AutoDiffXd system; see that function for documentation.
+  std::unique_ptr<AffineSystem<double>> FirstOrderTaylorApproximation(
+      const Context<double>& context,
+      int input_port_index = kUseFirstInputIfItExists,
+      int output_port_index = kUseFirstOutputIfItExists);
+
+ private:
+  const System<double>& system_;
+  std::unique_ptr<System<AutoDiffXd>> autodiff_system_;
+  std::unique_ptr<Context<AutoDiffXd>> autodiff_context_;
+};
+
 /// Returns the controllability matrix:  R = [B, AB, ..., A^{n-1}B].
 /// @ingroup control_systems
 Eigen::MatrixXd ControllabilityMatrix(const LinearSystem<double>& sys);
@@ -1,40 +1,206 @@
 #include "drake/systems/primitives/signal_log.h"
 
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/extract_double.h"
 
 namespace drake {
 namespace systems {
 
 template <typename T>
 SignalLog<T>::SignalLog(int input_size, int batch_allocation_size)
-    : batch_allocation_size_(batch_allocation_size),
-      sample_times_(batch_allocation_size_),
-      data_(input_size, batch_allocation_size_) {
+    : input_size_(input_size), batch_allocation_size_(batch_allocation_size) {
   DRAKE_DEMAND(input_size > 0);
   DRAKE_DEMAND(batch_allocation_size_ > 0);
+  time_chunks_.emplace_back(batch_allocation_size_);
+  data_chunks_.emplace_back(input_size_, batch_allocation_size_);
+}
+
+template <typename T>
+SignalLog<T>::~SignalLog() {
+  StopSpillToDisk();
+}
+
+template <typename T>
+const T& SignalLog<T>::last_time() const {
+  DRAKE_ASSERT(num_samples_ > 0);
+  const int64_t local = num_samples_ - 1 - begin_;
+  return time_chunks_[local / batch_allocation_size_](
+      local % batch_allocation_size_);
 }
 
 template <typename T>
 void SignalLog<T>::AddData(T time, VectorX<T> sample) {
-  if (num_samples_ == 0 || time >= sample_times_(num_samples_ - 1))
-    ++num_samples_;
-
-  // If num_samples exceeds the current allocation, then do a conservative
-  // resize (ouch!).
-  // TODO(russt): change to allocating on a std::vector here and moving into a
-  // single block of contiguous memory on the (first) data access, to avoid the
-  // O(n^2) complexity.
-  if (num_samples_ > sample_times_.size()) {
-    sample_times_.conservativeResize(sample_times_.size() +
-        batch_allocation_size_);
-    data_.conservativeResize(data_.rows(),
-                             data_.cols() + batch_allocation_size_);
-  }
-
-  // Record time and input to the num_samples position.
-  sample_times_(num_samples_ - 1) = time;
-  data_.col(num_samples_ - 1) = sample;
+  const int64_t chunk_size = batch_allocation_size_;
+
+  if (num_samples_ == 0 || time >= last_time()) ++num_samples_;
+
+  // Allocate a fresh chunk when the write position crosses a chunk boundary.
+  // Unlike a conservative resize, this never copies previously logged data.
+  const int64_t write = num_samples_ - 1;
+  while (write >= begin_ + chunk_size * static_cast<int64_t>(
+                                            data_chunks_.size())) {
+    time_chunks_.emplace_back(chunk_size);
+    data_chunks_.emplace_back(input_size_, chunk_size);
+
+    // Chunks before the newly current one can no longer be written (only the
+    // most recent sample is ever overwritten), so they may be released.
+    if (spill_active_) {
+      // Stream every complete chunk out and drop it.
+      while (static_cast<int64_t>(data_chunks_.size()) > 1) {
+        EnqueueSpill(chunk_size);
+        time_chunks_.erase(time_chunks_.begin());
+        data_chunks_.erase(data_chunks_.begin());
+        begin_ += chunk_size;
+      }
+    } else if (sample_capacity_ >= 0) {
+      // Recycle the oldest chunks while at least sample_capacity_ of the
+      // most recent samples remain.
+      while (write + 1 - (begin_ + chunk_size) >= sample_capacity_) {
+        time_chunks_.erase(time_chunks_.begin());
+        data_chunks_.erase(data_chunks_.begin());
+        begin_ += chunk_size;
+      }
+    }
+  }
+
+  // Record time and input at the write position.
+  const int64_t local = write - begin_;
+  time_chunks_[local / chunk_size](local % chunk_size) = time;
+  data_chunks_[local / chunk_size].col(local % chunk_size) = sample;
+  snapshot_valid_ = false;
+}
+
+template <typename T>
+void SignalLog<T>::reset() {
+  num_samples_ = 0;
+  begin_ = 0;
+  time_chunks_.resize(1);
+  data_chunks_.resize(1);
+  snapshot_valid_ = false;
+}
+
+template <typename T>
+void SignalLog<T>::UpdateSnapshot() const {
+  if (snapshot_valid_) return;
+  const int64_t chunk_size = batch_allocation_size_;
+  const int64_t retained = num_samples_ - begin_;
+  snapshot_times_.resize(retained);
+  snapshot_data_.resize(input_size_, retained);
+  for (int64_t out = 0; out < retained; out += chunk_size) {
+    const int64_t count = std::min(chunk_size, retained - out);
+    snapshot_times_.segment(out, count) =
+        time_chunks_[out / chunk_size].head(count);
+    snapshot_data_.middleCols(out, count) =
+        data_chunks_[out / chunk_size].leftCols(count);
+  }
+  snapshot_valid_ = true;
+}
+
+template <typename T>
+void SignalLog<T>::set_sample_capacity(int64_t max_samples) {
+  DRAKE_THROW_UNLESS(max_samples > 0);
+  if (spill_used_) {
+    throw std::logic_error(
+        "SignalLog::set_sample_capacity(): cannot bound retention when "
+        "spill-to-disk is in use.");
+  }
+  sample_capacity_ = max_samples;
+}
+
+template <typename T>
+void SignalLog<T>::StartSpillToDisk(const std::string& filename) {
+  if (spill_used_) {
+    throw std::logic_error(
+        "SignalLog::StartSpillToDisk(): may only be called once.");
+  }
+  if (sample_capacity_ >= 0) {
+    throw std::logic_error(
+        "SignalLog::StartSpillToDisk(): cannot spill to disk when "
+        "set_sample_capacity() is in use.");
+  }
+  spill_stream_.open(filename, std::ios::binary | std::ios::trunc);
+  if (!spill_stream_.is_open()) {
+    throw std::runtime_error("SignalLog::StartSpillToDisk(): could not open '" +
+                             filename + "' for writing.");
+  }
+  const int64_t rows = input_size_;
+  spill_stream_.write(reinterpret_cast<const char*>(&rows), sizeof(rows));
+
+  spill_used_ = true;
+  spill_active_ = true;
+  spill_stop_ = false;
+  spill_thread_ = std::thread(&SignalLog<T>::SpillWorker, this);
+}
+
+template <typename T>
+void SignalLog<T>::StopSpillToDisk() {
+  if (!spill_active_) return;
+
+  // Flush everything still in memory, including the partial current chunk.
+  const int64_t chunk_size = batch_allocation_size_;
+  while (num_samples_ - begin_ > chunk_size) {
+    EnqueueSpill(chunk_size);
+    time_chunks_.erase(time_chunks_.begin());
+    data_chunks_.erase(data_chunks_.begin());
+    begin_ += chunk_size;
+  }
+  if (num_samples_ > begin_) {
+    EnqueueSpill(num_samples_ - begin_);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(spill_mutex_);
+    spill_stop_ = true;
+  }
+  spill_cv_.notify_one();
+  spill_thread_.join();
+  spill_stream_.close();
+  spill_active_ = false;
+}
+
+template <typename T>
+void SignalLog<T>::EnqueueSpill(int64_t count) {
+  SpillChunk chunk;
+  chunk.times.resize(count);
+  chunk.data.resize(input_size_, count);
+  for (int64_t i = 0; i < count; ++i) {
+    chunk.times(i) = ExtractDoubleOrThrow(time_chunks_.front()(i));
+    for (int r = 0; r < input_size_; ++r) {
+      chunk.data(r, i) = ExtractDoubleOrThrow(data_chunks_.front()(r, i));
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lock(spill_mutex_);
+    spill_queue_.push(std::move(chunk));
+  }
+  spill_cv_.notify_one();
+}
+
+template <typename T>
+void SignalLog<T>::SpillWorker() {
+  std::unique_lock<std::mutex> lock(spill_mutex_);
+  while (true) {
+    spill_cv_.wait(lock,
+                   [this]() { return spill_stop_ || !spill_queue_.empty(); });
+    if (spill_queue_.empty()) return;  // Implies spill_stop_.
+    SpillChunk chunk = std::move(spill_queue_.front());
+    spill_queue_.pop();
+    lock.unlock();
+    for (int i = 0; i < chunk.times.size(); ++i) {
+      spill_stream_.write(reinterpret_cast<const char*>(&chunk.times(i)),
+                          sizeof(double));
+      spill_stream_.write(
+          reinterpret_cast<const char*>(chunk.data.col(i).data()),
+          input_size_ * sizeof(double));
+    }
+    lock.lock();
+  }
 }
 
 }  // namespace systems
@@ -1,5 +1,14 @@
 #pragma once
 
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 
@@ -12,6 +21,14 @@ namespace systems {
  primarily intended to support the Drake System primitive SignalLogger, but can
  be used independently.
 
+ Storage grows in fixed-size column chunks, so appending a sample never
+ reallocates or copies previously logged data.  Two optional modes bound the
+ memory footprint for long runs:
+ - set_sample_capacity() retains only (approximately) the most recent samples,
+   recycling storage ring-buffer style; and
+ - StartSpillToDisk() streams completed chunks to an append-only binary file
+   on a background thread and releases them from memory.
+
  @tparam T The vector element type, which must be a valid Eigen scalar.
  */
 template <typename T>
@@ -21,31 +38,35 @@ class SignalLog {
 
   /** Constructs the signal log.
    @param input_size                Dimension of the per-time step data set.
-   @param batch_allocation_size     Storage is (re)allocated in blocks of size
+   @param batch_allocation_size     Storage grows in chunks of size
                                     (input_size X batch_allocation_size).
   */
   explicit SignalLog(int input_size, int batch_allocation_size = 1000);
 
-  /** Returns the number of samples taken since construction or last reset(). */
-  int num_samples() const { return num_samples_; }
+  ~SignalLog();
+
+  /** Returns the number of samples currently retained in memory.  This is the
+   number of samples taken since construction or last reset(), less any
+   samples dropped by set_sample_capacity() or streamed out by
+   StartSpillToDisk(). */
+  int num_samples() const { return static_cast<int>(num_samples_ - begin_); }
 
-  /** Accesses the logged time stamps. */
+  /** Accesses the logged time stamps (of the retained samples). */
   Eigen::VectorBlock<const VectorX<T>> sample_times() const {
-    return const_cast<const VectorX<T>&>(sample_times_).head(num_samples_);
+    UpdateSnapshot();
+    return const_cast<const VectorX<T>&>(snapshot_times_).head(num_samples());
   }
 
-  /** Accesses the logged data. */
+  /** Accesses the logged data (the retained samples). */
   Eigen::Block<const MatrixX<T>, Eigen::Dynamic, Eigen::Dynamic, true> data()
   const {
-    return const_cast<const MatrixX<T>&>(data_).leftCols(num_samples_);
+    UpdateSnapshot();
+    return const_cast<const MatrixX<T>&>(snapshot_data_)
+        .leftCols(num_samples());
   }
 
   /** Clears the logged data. */
-  void reset() {
-    // Resetting num_samples_ is sufficient to have all future writes and
-    // reads re-initialized to the beginning of the data.
-    num_samples_ = 0;
-  }
+  void reset();
 
   /** Adds a `sample` to the data set with the associated `time` value.
 
@@ -54,16 +75,94 @@ class SignalLog {
    */
   void AddData(T time, VectorX<T> sample);
 
+  /** Bounds the number of retained samples:  once more than @p max_samples
+   samples have been logged, the oldest storage chunks are recycled so that at
+   least the most recent @p max_samples samples (rounded up to whole chunks)
+   remain accessible.  Useful for keep-the-last-N-seconds logging of long
+   runs.
+   @pre `max_samples` is greater than zero.
+   @throws std::logic_error if spill-to-disk has been started. */
+  void set_sample_capacity(int64_t max_samples);
+
+  /** Starts streaming the log to @p filename on a background writer thread.
+   Each time a storage chunk fills up it is converted to double (via
+   ExtractDoubleOrThrow), handed to the writer, and released from memory, so
+   the in-memory footprint and the per-sample cost stay flat regardless of
+   run length; only the samples of the current (partial) chunk remain
+   accessible through data() and sample_times().
+
+   The file format is native-endian binary: one int64 holding the input size
+   `r`, followed by one fixed-stride record per sample of `1 + r` doubles
+   (the sample time, then the sample).  The fixed stride makes the file
+   suitable for memory-mapped readers.
+
+   This method may be called at most once, and is incompatible with
+   set_sample_capacity().
+   @throws std::logic_error if called twice or after set_sample_capacity().
+   @throws std::runtime_error if the file cannot be opened for writing. */
+  void StartSpillToDisk(const std::string& filename);
+
+  /** Flushes all logged samples (including the current partial chunk) to the
+   spill file, stops the writer thread, and closes the file.  Called
+   automatically on destruction.  A no-op unless StartSpillToDisk() has been
+   called. */
+  void StopSpillToDisk();
+
   /** Reports the size of the log's input vector. */
-  int64_t get_input_size() const { return data_.rows(); }
+  int64_t get_input_size() const { return input_size_; }
 
  private:
+  // A chunk of samples converted to double, queued for the writer thread.
+  struct SpillChunk {
+    Eigen::VectorXd times;
+    Eigen::MatrixXd data;
+  };
+
+  // Returns the time of the most recently logged sample.
+  // @pre num_samples_ > 0.
+  const T& last_time() const;
+
+  // Rebuilds the contiguous snapshot of the retained samples if stale.
+  void UpdateSnapshot() const;
+
+  // Converts the first `count` samples of the front chunk to double and
+  // queues them for the writer thread.
+  void EnqueueSpill(int64_t count);
+
+  // Body of the background writer thread.
+  void SpillWorker();
+
+  const int input_size_;
   const int batch_allocation_size_{1000};
 
   // Use mutable variables to hold the logged data.
-  mutable int64_t num_samples_{0};
-  mutable VectorX<T> sample_times_;
-  mutable MatrixX<T> data_;
+  //
+  // Chunk k stores the samples with global indices
+  // [begin_ + k * batch_allocation_size_, ...) -- `begin_`, the global index
+  // of the oldest retained sample, is always a chunk multiple because chunks
+  // are dropped whole.
+  mutable int64_t num_samples_{0};  // Total samples since last reset().
+  mutable int64_t begin_{0};
+  mutable std::vector<VectorX<T>> time_chunks_;
+  mutable std::vector<MatrixX<T>> data_chunks_;
+
+  int64_t sample_capacity_{-1};  // Negative means unbounded.
+
+  // Contiguous copies of the retained samples, rebuilt lazily on access.
+  mutable bool snapshot_valid_{false};
+  mutable VectorX<T> snapshot_times_;
+  mutable MatrixX<T> snapshot_data_;
+
+  // Spill-to-disk machinery.  The queue is the only state shared with the
+  // writer thread; everything else is touched only by the logging thread.
+  bool spill_active_{false};
+  bool spill_used_{false};
+  std::ofstream spill_stream_;
+  std::thread spill_thread_;
+  std::mutex spill_mutex_;
+  std::condition_variable spill_cv_;
+  std::queue<SpillChunk> spill_queue_;
+  bool spill_stop_{false};
 };
 }  // namespace systems
 }  // namespace drake
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+#include <string>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -19,9 +21,12 @@ namespace systems {
 //              should be fixed.
 /// A discrete sink block which logs its input to memory (not thread safe). This
 /// data is then retrievable (e.g. after a simulation) via a handful of accessor
-/// methods. This system holds a large, mutable Eigen matrix for data storage,
-/// where each column corresponds to a data point. It saves a data point and
-/// the context time whenever it samples its input.
+/// methods. Data is stored in fixed-size column chunks, where each column
+/// corresponds to a data point; appending a sample never copies previously
+/// logged data. It saves a data point and the context time whenever it
+/// samples its input. For long runs, the log can optionally be bounded to the
+/// most recent samples (set_sample_capacity()) or streamed to disk in the
+/// background (StartSpillToDisk()).
 ///
 /// By default, sampling is performed every time the Simulator completes a
 /// trajectory-advancing substep (that is, via a per-step Publish event), with
@@ -62,15 +67,11 @@ class SignalLogger : public LeafSystem<T> {
 
   /// Constructs the signal logger system.
   ///
-  /// @warning %SignalLogger may become slower and slower as the number of
-  /// log entries increases due to memory reallocations. You can avoid that by
-  /// providing a `batch_allocation_size` comparable to the total expected
-  /// number of log entries for your simulation.
-  ///
   /// @param input_size Dimension of the (single) input port. This corresponds
   /// to the number of rows of the data matrix.
-  /// @param batch_allocation_size Storage is (re)allocated in blocks of
-  /// input_size-by-batch_allocation_size.
+  /// @param batch_allocation_size Storage grows in chunks of
+  /// input_size-by-batch_allocation_size; previously logged data is never
+  /// copied when a new chunk is added.
   /// @see LogOutput() helper function for a convenient way to add %logging.
   explicit SignalLogger(int input_size, int batch_allocation_size = 1000);
 
@@ -89,7 +90,26 @@ class SignalLogger : public LeafSystem<T> {
   /// @throws std::logic_error if set_publish_period() has been called.
   void set_forced_publish_only();
 
-  /// Returns the number of samples taken since construction or last reset().
+  /// Bounds the in-memory log to (approximately) the most recent
+  /// @p max_samples samples, recycling the oldest storage chunks; see
+  /// SignalLog::set_sample_capacity().
+  void set_sample_capacity(int64_t max_samples) {
+    log_.set_sample_capacity(max_samples);
+  }
+
+  /// Streams the log to @p filename on a background writer thread, keeping
+  /// the memory footprint flat regardless of run length; see
+  /// SignalLog::StartSpillToDisk() for the file format and restrictions.
+  void StartSpillToDisk(const std::string& filename) {
+    log_.StartSpillToDisk(filename);
+  }
+
+  /// Flushes all logged samples to the spill file and closes it; called
+  /// automatically on destruction. See SignalLog::StopSpillToDisk().
+  void StopSpillToDisk() { log_.StopSpillToDisk(); }
+
+  /// Returns the number of samples retained in memory; see
+  /// SignalLog::num_samples().
   int num_samples() const { return log_.num_samples(); }
 
   /// Provides access to the sample times of the logged data. Time is taken
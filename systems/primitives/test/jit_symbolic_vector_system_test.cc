@@ -0,0 +1,89 @@
+#include "drake/systems/primitives/jit_symbolic_vector_system.h"
+
+#include <cmath>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using symbolic::Expression;
+using symbolic::Variable;
+
+// A damped pendulum with a torque input: θ̈ = -sin(θ) - 0.1⋅θ̇ + u.
+class JitSymbolicVectorSystemTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    VectorX<Variable> state(2);
+    state << theta_, thetadot_;
+    VectorX<Variable> input(1);
+    input << tau_;
+    VectorX<Expression> dynamics(2);
+    dynamics << thetadot_, -sin(theta_) - 0.1 * thetadot_ + tau_;
+    VectorX<Expression> output(1);
+    output << cos(theta_);
+    dut_ = std::make_unique<JitSymbolicVectorSystem>(state, input, dynamics,
+                                                     output);
+    context_ = dut_->CreateDefaultContext();
+    derivatives_ = dut_->AllocateTimeDerivatives();
+  }
+
+  const Variable theta_{"theta"};
+  const Variable thetadot_{"thetadot"};
+  const Variable tau_{"tau"};
+  std::unique_ptr<JitSymbolicVectorSystem> dut_;
+  std::unique_ptr<Context<double>> context_;
+  std::unique_ptr<ContinuousState<double>> derivatives_;
+};
+
+TEST_F(JitSymbolicVectorSystemTest, Topology) {
+  EXPECT_EQ(dut_->get_num_input_ports(), 1);
+  EXPECT_EQ(dut_->get_input_port(0).size(), 1);
+  EXPECT_EQ(dut_->get_num_output_ports(), 1);
+  EXPECT_EQ(dut_->get_output_port(0).size(), 1);
+  EXPECT_EQ(context_->get_continuous_state().size(), 2);
+}
+
+TEST_F(JitSymbolicVectorSystemTest, TimeDerivatives) {
+  const double theta = 0.3;
+  const double thetadot = -0.7;
+  const double tau = 1.5;
+  context_->get_mutable_continuous_state_vector().SetAtIndex(0, theta);
+  context_->get_mutable_continuous_state_vector().SetAtIndex(1, thetadot);
+  context_->FixInputPort(0, Vector1<double>::Constant(tau));
+
+  dut_->CalcTimeDerivatives(*context_, derivatives_.get());
+  const Eigen::Vector2d expected(thetadot,
+                                 -std::sin(theta) - 0.1 * thetadot + tau);
+  EXPECT_TRUE(CompareMatrices(derivatives_->CopyToVector(), expected, 1e-15));
+}
+
+TEST_F(JitSymbolicVectorSystemTest, Output) {
+  const double theta = -1.2;
+  context_->get_mutable_continuous_state_vector().SetAtIndex(0, theta);
+  context_->FixInputPort(0, Vector1<double>::Zero());
+
+  const auto output = dut_->AllocateOutput();
+  dut_->CalcOutput(*context_, output.get());
+  EXPECT_NEAR(output->get_vector_data(0)->GetAtIndex(0), std::cos(theta),
+              1e-15);
+}
+
+TEST_F(JitSymbolicVectorSystemTest, SizeMismatchThrows) {
+  VectorX<Variable> state(2);
+  state << theta_, thetadot_;
+  VectorX<Expression> dynamics(1);
+  dynamics << thetadot_;
+  EXPECT_THROW(JitSymbolicVectorSystem(state, VectorX<Variable>(0), dynamics,
+                                       VectorX<Expression>(0)),
+               std::runtime_error);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -244,6 +244,41 @@ TEST_F(TestLinearizeFromAffine, ContinuousAtNonEquilibrium) {
                               MatrixCompareType::absolute));
 }
 
+// A Linearizer reusing its cached AutoDiffXd system across several operating
+// points must agree exactly with the one-shot free functions.
+TEST_F(TestLinearizeFromAffine, LinearizerReuse) {
+  Linearizer linearizer(*continuous_system_);
+  auto context = continuous_system_->CreateDefaultContext();
+  context->FixInputPort(0, Vector1d::Constant(u0_));
+
+  // First call: linearize at the equilibrium point.
+  context->get_mutable_continuous_state_vector().SetFromVector(
+      xstar_continuous_);
+  auto linearized_system = linearizer.Linearize(*context);
+
+  double tol = 1e-10;
+  EXPECT_TRUE(CompareMatrices(A_, linearized_system->A(), tol,
+                              MatrixCompareType::absolute));
+  EXPECT_TRUE(CompareMatrices(B_, linearized_system->B(), tol,
+                              MatrixCompareType::absolute));
+  EXPECT_TRUE(CompareMatrices(C_, linearized_system->C(), tol,
+                              MatrixCompareType::absolute));
+  EXPECT_TRUE(CompareMatrices(D_, linearized_system->D(), tol,
+                              MatrixCompareType::absolute));
+
+  // Second call with the same Linearizer, at a non-equilibrium point.
+  context->get_mutable_continuous_state_vector().SetFromVector(x0_);
+  EXPECT_THROW(linearizer.Linearize(*context), std::runtime_error);
+  std::unique_ptr<AffineSystem<double>> affine_system =
+      linearizer.FirstOrderTaylorApproximation(*context);
+  EXPECT_TRUE(CompareMatrices(A_, affine_system->A(), tol,
+                              MatrixCompareType::absolute));
+  EXPECT_TRUE(CompareMatrices(f0_, affine_system->f0(), tol,
+                              MatrixCompareType::absolute));
+  EXPECT_TRUE(CompareMatrices(y0_, affine_system->y0(), tol,
+                              MatrixCompareType::absolute));
+}
+
 TEST_F(TestLinearizeFromAffine, DiscreteAtEquilibrium) {
   auto context = discrete_system_->CreateDefaultContext();
   context->FixInputPort(0, Vector1d::Constant(u0_));
@@ -1,11 +1,15 @@
 #include "drake/systems/primitives/signal_logger.h"
 
 #include <cmath>
+#include <cstdint>
+#include <fstream>
 #include <stdexcept>
+#include <string>
 
 #include <gtest/gtest.h>
 
 #include "drake/common/eigen_types.h"
+#include "drake/common/temp_directory.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/systems/analysis/simulator.h"
@@ -136,6 +140,86 @@ GTEST_TEST(TestSignalLogger, SetForcedPublishOnly) {
       ".*cannot be called if set_forced_publish_only.*");
 }
 
+// The chunked storage (exercised here with a tiny chunk size) must present
+// the same contiguous data()/sample_times() view as before.
+GTEST_TEST(TestSignalLog, ChunkedStorage) {
+  SignalLog<double> log(2, 3 /* batch_allocation_size */);
+  for (int i = 0; i < 10; ++i) {
+    log.AddData(i * 0.1, Eigen::Vector2d(i, -i));
+  }
+  EXPECT_EQ(log.num_samples(), 10);
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(log.sample_times()(i), i * 0.1);
+    EXPECT_EQ(log.data()(0, i), i);
+    EXPECT_EQ(log.data()(1, i), -i);
+  }
+  // A sample at an earlier time overwrites the most recent one.
+  log.AddData(0.05, Eigen::Vector2d(99., 99.));
+  EXPECT_EQ(log.num_samples(), 10);
+  EXPECT_EQ(log.data()(0, 9), 99.);
+
+  log.reset();
+  EXPECT_EQ(log.num_samples(), 0);
+}
+
+// The ring-buffer mode keeps (at least) the most recent samples, in order.
+GTEST_TEST(TestSignalLog, SampleCapacity) {
+  SignalLog<double> log(1, 4 /* batch_allocation_size */);
+  log.set_sample_capacity(6);
+  for (int i = 0; i < 25; ++i) {
+    log.AddData(i, Vector1d::Constant(i));
+  }
+  const int n = log.num_samples();
+  EXPECT_GE(n, 6);       // At least the capacity is retained, ...
+  EXPECT_LE(n, 6 + 8);   // ... rounded up to whole chunks.
+  for (int i = 0; i < n; ++i) {
+    EXPECT_EQ(log.sample_times()(i), 25 - n + i);  // Newest samples, in order.
+    EXPECT_EQ(log.data()(0, i), 25 - n + i);
+  }
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      log.StartSpillToDisk(temp_directory() + "/unused.bin"), std::logic_error,
+      ".*cannot spill to disk when set_sample_capacity.*");
+}
+
+// The spill writer must produce a complete, well-formed binary file.
+GTEST_TEST(TestSignalLog, SpillToDisk) {
+  const std::string filename = temp_directory() + "/signal_log_spill.bin";
+  {
+    SignalLog<double> log(3, 4 /* batch_allocation_size */);
+    log.StartSpillToDisk(filename);
+    DRAKE_EXPECT_THROWS_MESSAGE(log.StartSpillToDisk(filename),
+                                std::logic_error,
+                                ".*may only be called once.*");
+    DRAKE_EXPECT_THROWS_MESSAGE(log.set_sample_capacity(10), std::logic_error,
+                                ".*cannot bound retention.*");
+    for (int i = 0; i < 11; ++i) {
+      log.AddData(i * 0.5, Eigen::Vector3d(i, 2. * i, 3. * i));
+    }
+    // Completed chunks have been released; only the current one is retained.
+    EXPECT_LE(log.num_samples(), 4);
+  }  // The destructor flushes the partial chunk and closes the file.
+
+  std::ifstream input(filename, std::ios::binary);
+  ASSERT_TRUE(input.is_open());
+  int64_t rows{};
+  input.read(reinterpret_cast<char*>(&rows), sizeof(rows));
+  EXPECT_EQ(rows, 3);
+  for (int i = 0; i < 11; ++i) {
+    double record[4];
+    input.read(reinterpret_cast<char*>(record), sizeof(record));
+    ASSERT_TRUE(input.good());
+    EXPECT_EQ(record[0], i * 0.5);
+    EXPECT_EQ(record[1], i);
+    EXPECT_EQ(record[2], 2. * i);
+    EXPECT_EQ(record[3], 3. * i);
+  }
+  // There is nothing in the file beyond the logged records.
+  double extra{};
+  input.read(reinterpret_cast<char*>(&extra), sizeof(extra));
+  EXPECT_TRUE(input.eof());
+}
+
 }  // namespace
 
 }  // namespace systems
@@ -32,19 +32,23 @@ TrajectorySource<T>::TrajectorySource(const Trajectory<T>& trajectory,
 template <typename T>
 void TrajectorySource<T>::DoCalcVectorOutput(
     const Context<T>& context, Eigen::VectorBlock<VectorX<T>>* output) const {
-  int len = trajectory_->rows();
-  output->head(len) = trajectory_->value(context.get_time());
+  const int len = trajectory_->rows();
+  const double time = context.get_time();
 
-  double time = context.get_time();
-  bool set_zero = clamp_derivatives_ && (time > trajectory_->end_time() ||
+  // Evaluate in place into the output block; value() would return a fresh
+  // temporary per evaluation, which is measurable at integrator micro-steps.
+  auto value = output->head(len);
+  trajectory_->EvalValue(time, &value);
+
+  const bool set_zero = clamp_derivatives_ && (time > trajectory_->end_time() ||
       time < trajectory_->start_time());
 
   for (size_t i = 0; i < derivatives_.size(); ++i) {
+    auto derivative = output->segment(len * (i + 1), len);
     if (set_zero) {
-      output->segment(len * (i + 1), len).setZero();
+      derivative.setZero();
     } else {
-      output->segment(len * (i + 1), len) =
-          derivatives_[i]->value(context.get_time());
+      derivatives_[i]->EvalValue(time, &derivative);
     }
   }
 }
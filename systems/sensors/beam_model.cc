@@ -74,35 +74,43 @@ void BeamModel<T>::CalcOutput(const systems::Context<T>& context,
 
   auto measurement = output->get_mutable_value();
 
-  // Loop through depth inputs and compute a noisy measurement based on the
-  // mixture model.
-  for (int i = 0; i < static_cast<int>(depth.size()); i++) {
-    if (w_event[i] <= params->probability_uniform()) {
-      // Then "uniform".
-      measurement[i] = max_range_ * w_uniform[i];
-    } else if (w_event[i] <=
-               params->probability_uniform() + params->probability_miss()) {
-      // Then "miss".
-      measurement[i] = max_range_;
-    } else if (w_event[i] <= params->probability_uniform() +
-                                 params->probability_miss() +
-                                 params->probability_short() &&
-        (w_short[i] / params->lambda_short()) <= depth[i]) {
-      // Then "short".
-      // Note: Returns that would have been greater than depth[i] are instead
-      // evaluated as "hit".
-      measurement[i] = w_short[i] / params->lambda_short();
-    } else {
-      // Then "hit".
-      // Note: The tails of the Gaussian distribution are truncated to return
-      // a value in [0, max_range_].  (Both) tails of the distribution are
-      // treated as missed returns, so return max_range_.
-      measurement[i] = depth[i] + params->sigma_hit() * w_hit[i];
-      if (measurement[i] < 0.0 || measurement[i] > max_range_) {
-        measurement[i] = max_range_;
-      }
-    }
-  }
+  // Evaluate the mixture model as a batched pass over all rays: compute the
+  // candidate return for every event type as a full vector, then classify
+  // each ray against the "event" draw with elementwise selects.  This keeps
+  // the per-ray branch chain out of the inner loop so the depth math
+  // vectorizes (for T = double).
+  const T p_uniform = params->probability_uniform();
+  const T p_uniform_or_miss = p_uniform + params->probability_miss();
+  const T p_uniform_miss_or_short =
+      p_uniform_or_miss + params->probability_short();
+
+  // "Short" returns.
+  // Note: Returns that would have been greater than depth[i] are instead
+  // evaluated as "hit".
+  const VectorX<T> short_return = w_short / params->lambda_short();
+
+  // "Hit" returns.
+  // Note: The tails of the Gaussian distribution are truncated to return
+  // a value in [0, max_range_].  (Both) tails of the distribution are
+  // treated as missed returns, so return max_range_.
+  VectorX<T> hit_return = depth + params->sigma_hit() * w_hit;
+  hit_return =
+      ((hit_return.array() < 0.0) || (hit_return.array() > max_range_))
+          .select(T(max_range_), hit_return);
+
+  measurement.array() =
+      (w_event.array() <= p_uniform)
+          .select(
+              // Then "uniform".
+              max_range_ * w_uniform.array(),
+              (w_event.array() <= p_uniform_or_miss)
+                  .select(
+                      // Then "miss".
+                      T(max_range_),
+                      ((w_event.array() <= p_uniform_miss_or_short) &&
+                       (short_return.array() <= depth.array()))
+                          // Then "short", else "hit".
+                          .select(short_return.array(), hit_return.array())));
 }
 
 }  // namespace sensors
@@ -6,6 +6,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
 #include "drake/common/reset_after_move.h"
 #include "drake/systems/sensors/pixel_types.h"
 
@@ -144,12 +145,128 @@ class Image {
     return data_.data() + (x + y * width_) * kNumChannels;
   }
 
+  /// Returns an Eigen map over every channel value in the image (row-major
+  /// pixel order, channels interleaved), for whole-frame arithmetic without
+  /// copying, e.g. `depth.array() *= 0.001f;`.  The map is invalidated by
+  /// resize() and by assigning to this image.
+  Eigen::Map<Eigen::Array<T, Eigen::Dynamic, 1>> mutable_array() {
+    return {data_.data(), size()};
+  }
+
+  /// Const version of mutable_array().
+  Eigen::Map<const Eigen::Array<T, Eigen::Dynamic, 1>> array() const {
+    return {data_.data(), size()};
+  }
+
  private:
   reset_after_move<int> width_;
   reset_after_move<int> height_;
   std::vector<T> data_;
 };
 
+/// A non-owning, read-only view over image data laid out identically to
+/// Image<kPixelType> (row-major pixels, interleaved channels).  Use this to
+/// wrap an externally owned frame buffer -- e.g. one produced by a renderer
+/// or a decoded message -- in Drake's image vocabulary without copying it.
+/// The viewed buffer must outlive the view.
+///
+/// @tparam kPixelType The pixel type enum that denotes the pixel format and
+/// the data type of a channel.
+template <PixelType kPixelType>
+class ImageView {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ImageView)
+
+  /// An alias for ImageTraits; see Image.
+  using Traits = ImageTraits<kPixelType>;
+
+  /// The data type for a channel.
+  using T = typename Traits::ChannelType;
+
+  /// The number of channels in a pixel.
+  static constexpr int kNumChannels = Traits::kNumChannels;
+
+  /// The size of a pixel in bytes.
+  static constexpr int kPixelSize = kNumChannels * sizeof(T);
+
+  /// The format for pixels.
+  static constexpr PixelFormat kPixelFormat = Traits::kPixelFormat;
+
+  /// Constructs an empty (zero-sized) view.
+  ImageView() = default;
+
+  /// Constructs a view over `image`'s storage.  The image must outlive the
+  /// view and must not be resized while the view is in use.
+  explicit ImageView(const Image<kPixelType>& image)
+      : ImageView(image.at(0, 0), image.width(), image.height()) {}
+
+  /// Constructs a view over the external buffer `data`, which must hold
+  /// `width * height * kNumChannels` channel values.
+  ImageView(const T* data, int width, int height)
+      : data_(data), width_(width), height_(height) {
+    DRAKE_ASSERT(data != nullptr);
+    DRAKE_ASSERT(width > 0);
+    DRAKE_ASSERT(height > 0);
+  }
+
+  /// Returns the size of width for the image.
+  int width() const { return width_; }
+
+  /// Returns the size of height for the image.
+  int height() const { return height_; }
+
+  /// Returns the number of pixels times the number of channels.
+  int size() const { return width_ * height_ * kNumChannels; }
+
+  /// Access to the pixel located at (x, y); see Image::at().
+  const T* at(int x, int y) const {
+    DRAKE_ASSERT(x >= 0 && x < width_);
+    DRAKE_ASSERT(y >= 0 && y < height_);
+    return data_ + (x + y * width_) * kNumChannels;
+  }
+
+  /// Returns an Eigen map over every channel value; see Image::array().
+  Eigen::Map<const Eigen::Array<T, Eigen::Dynamic, 1>> array() const {
+    return {data_, size()};
+  }
+
+  /// Copies the viewed data into a new owning Image.
+  Image<kPixelType> ToImage() const {
+    Image<kPixelType> image(width_, height_);
+    image.mutable_array() = array();
+    return image;
+  }
+
+ private:
+  const T* data_{nullptr};
+  int width_{0};
+  int height_{0};
+};
+
+/// The view type corresponding to ImageRgb8U.
+using ImageRgb8UView = ImageView<PixelType::kRgb8U>;
+
+/// The view type corresponding to ImageBgr8U.
+using ImageBgr8UView = ImageView<PixelType::kBgr8U>;
+
+/// The view type corresponding to ImageRgba8U.
+using ImageRgba8UView = ImageView<PixelType::kRgba8U>;
+
+/// The view type corresponding to ImageBgra8U.
+using ImageBgra8UView = ImageView<PixelType::kBgra8U>;
+
+/// The view type corresponding to ImageDepth32F.
+using ImageDepth32FView = ImageView<PixelType::kDepth32F>;
+
+/// The view type corresponding to ImageDepth16U.
+using ImageDepth16UView = ImageView<PixelType::kDepth16U>;
+
+/// The view type corresponding to ImageLabel16I.
+using ImageLabel16IView = ImageView<PixelType::kLabel16I>;
+
+/// The view type corresponding to ImageGrey8U.
+using ImageGrey8UView = ImageView<PixelType::kGrey8U>;
+
 // TODO(jwnimmer-tri) Deprecate these float-only constants; code should be
 // using ImageTraits exclusively (i.e., based on the pixel type).
 /// Set of constants used to represent invalid depth values.
@@ -188,6 +305,15 @@ constexpr int Image<kPixelType>::kPixelSize;
 template <PixelType kPixelType>
 constexpr PixelFormat Image<kPixelType>::kPixelFormat;
 
+template <PixelType kPixelType>
+constexpr int ImageView<kPixelType>::kNumChannels;
+
+template <PixelType kPixelType>
+constexpr int ImageView<kPixelType>::kPixelSize;
+
+template <PixelType kPixelType>
+constexpr PixelFormat ImageView<kPixelType>::kPixelFormat;
+
 }  // namespace sensors
 }  // namespace systems
 }  // namespace drake
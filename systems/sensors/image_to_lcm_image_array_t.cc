@@ -1,13 +1,17 @@
 #include "drake/systems/sensors/image_to_lcm_image_array_t.h"
 
-#include <memory>
 #include <string>
 #include <vector>
 
+#include <vtkImageData.h>
+#include <vtkJPEGWriter.h>
+#include <vtkNew.h>
+#include <vtkUnsignedCharArray.h>
 #include <zlib.h>
 #include "robotlocomotion/image_array_t.hpp"
 #include "robotlocomotion/image_t.hpp"
 
+#include "drake/common/drake_throw.h"
 #include "drake/systems/sensors/lcm_image_traits.h"
 
 using std::string;
@@ -29,17 +33,87 @@ void Compress(const Image<kPixelType>& image, image_t* msg) {
   // The destination buf_size must be slightly larger than the source size.
   // http://refspecs.linuxbase.org/LSB_3.0.0/LSB-PDA/LSB-PDA/zlib-compress2-1.html
   size_t buf_size = source_size * 1.001 + 12;
-  std::unique_ptr<uint8_t[]> buf(new uint8_t[buf_size]);
+  // Compress straight into the message's byte vector; since the message is
+  // reused from frame to frame, its capacity is retained and steady-state
+  // frames neither allocate nor take an extra full-frame copy.
+  msg->data.resize(buf_size);
 
   auto compress_status = compress2(
-      buf.get(), &buf_size, reinterpret_cast<const Bytef*>(image.at(0, 0)),
-      source_size, Z_BEST_SPEED);
+      msg->data.data(), &buf_size,
+      reinterpret_cast<const Bytef*>(image.at(0, 0)), source_size,
+      Z_BEST_SPEED);
 
   DRAKE_DEMAND(compress_status == Z_OK);
 
   msg->data.resize(buf_size);
   msg->size = buf_size;
-  memcpy(&msg->data[0], buf.get(), buf_size);
+}
+
+// Returns true for the 8-bit color formats that JPEG can represent (after
+// stripping any alpha channel).
+bool IsJpegCompressible(PixelType pixel_type) {
+  switch (pixel_type) {
+    case PixelType::kRgb8U:
+    case PixelType::kBgr8U:
+    case PixelType::kRgba8U:
+    case PixelType::kBgra8U:
+    case PixelType::kGrey8U:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Returns the 3-channel lcm pixel format corresponding to a 4-channel one;
+// other formats pass through unchanged.
+int8_t PixelFormatWithoutAlpha(int8_t pixel_format) {
+  switch (pixel_format) {
+    case image_t::PIXEL_FORMAT_RGBA:
+      return image_t::PIXEL_FORMAT_RGB;
+    case image_t::PIXEL_FORMAT_BGRA:
+      return image_t::PIXEL_FORMAT_BGR;
+    default:
+      return pixel_format;
+  }
+}
+
+template <PixelType kPixelType>
+void CompressJpeg(const Image<kPixelType>& image, int quality, image_t* msg) {
+  msg->compression_method = image_t::COMPRESSION_METHOD_JPEG;
+
+  // JPEG carries 1 or 3 channels; drop any alpha channel on the way in.
+  constexpr int num_channels = Image<kPixelType>::kNumChannels;
+  const int out_channels = (num_channels == 4) ? 3 : num_channels;
+  const int width = image.width();
+  const int height = image.height();
+
+  vtkNew<vtkImageData> vtk_image;
+  vtk_image->SetDimensions(width, height, 1);
+  vtk_image->AllocateScalars(VTK_UNSIGNED_CHAR, out_channels);
+  auto* dest =
+      reinterpret_cast<unsigned char*>(vtk_image->GetScalarPointer());
+  // The vtk image origin is the lower-left corner; flip the rows.
+  for (int v = height - 1; v >= 0; --v) {
+    for (int u = 0; u < width; ++u) {
+      const auto* src = image.at(u, v);
+      for (int c = 0; c < out_channels; ++c) {
+        dest[c] = static_cast<unsigned char>(src[c]);
+      }
+      dest += out_channels;
+    }
+  }
+
+  vtkNew<vtkJPEGWriter> writer;
+  writer->SetQuality(quality);
+  writer->WriteToMemoryOn();
+  writer->SetInputData(vtk_image.GetPointer());
+  writer->Write();
+
+  vtkUnsignedCharArray* encoded = writer->GetResult();
+  const int encoded_size = static_cast<int>(encoded->GetNumberOfTuples());
+  msg->data.resize(encoded_size);
+  memcpy(msg->data.data(), encoded->GetPointer(0), encoded_size);
+  msg->size = encoded_size;
 }
 
 template <PixelType kPixelType>
@@ -54,7 +128,7 @@ void Pack(const Image<kPixelType>& image, image_t* msg) {
 
 template <PixelType kPixelType>
 void PackImageToLcmImageT(const Image<kPixelType>& image, image_t* msg,
-                          bool do_compress) {
+                          bool do_compress, bool jpeg_color, int jpeg_quality) {
   // TODO(kunimatsu-tri) Fix seq here that is always set to zero.
   msg->header.seq = 0;
   msg->width = image.width();
@@ -66,7 +140,16 @@ void PackImageToLcmImageT(const Image<kPixelType>& image, image_t* msg,
   msg->channel_type = LcmImageTraits<kPixelType>::kChannelType;
 
   if (do_compress) {
-    Compress(image, msg);
+    if (jpeg_color && IsJpegCompressible(kPixelType)) {
+      CompressJpeg(image, jpeg_quality, msg);
+      msg->pixel_format = PixelFormatWithoutAlpha(msg->pixel_format);
+      msg->row_stride = (msg->pixel_format == image_t::PIXEL_FORMAT_RGB ||
+                         msg->pixel_format == image_t::PIXEL_FORMAT_BGR)
+                            ? 3 * msg->width
+                            : msg->row_stride;
+    } else {
+      Compress(image, msg);
+    }
   } else {
     Pack(image, msg);
   }
@@ -75,7 +158,8 @@ void PackImageToLcmImageT(const Image<kPixelType>& image, image_t* msg,
 void PackImageToLcmImageT(const AbstractValue& untyped_image,
                           PixelType pixel_type, int64_t utime,
                           const string& frame_name, image_t* msg,
-                          bool do_compress) {
+                          bool do_compress, bool jpeg_color,
+                          int jpeg_quality) {
   msg->header.utime = utime;
   msg->header.frame_name = frame_name;
 
@@ -83,49 +167,57 @@ void PackImageToLcmImageT(const AbstractValue& untyped_image,
     case PixelType::kRgb8U: {
       const auto& image_value =
           untyped_image.GetValue<Image<PixelType::kRgb8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, do_compress, jpeg_color,
+                           jpeg_quality);
       break;
     }
     case PixelType::kBgr8U: {
       const auto& image_value =
           untyped_image.GetValue<Image<PixelType::kBgr8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, do_compress, jpeg_color,
+                           jpeg_quality);
       break;
     }
     case PixelType::kRgba8U: {
       const auto& image_value =
           untyped_image.GetValue<Image<PixelType::kRgba8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, do_compress, jpeg_color,
+                           jpeg_quality);
       break;
     }
     case PixelType::kBgra8U: {
       const auto& image_value =
           untyped_image.GetValue<Image<PixelType::kBgra8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, do_compress, jpeg_color,
+                           jpeg_quality);
       break;
     }
     case PixelType::kGrey8U: {
       const auto& image_value =
           untyped_image.GetValue<Image<PixelType::kGrey8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, do_compress, jpeg_color,
+                           jpeg_quality);
       break;
     }
     case PixelType::kDepth16U: {
       const auto& image_value =
           untyped_image.GetValue<Image<PixelType::kDepth16U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, do_compress, jpeg_color,
+                           jpeg_quality);
       break;
     }
     case PixelType::kDepth32F: {
       const auto& image_value =
           untyped_image.GetValue<Image<PixelType::kDepth32F>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, do_compress, jpeg_color,
+                           jpeg_quality);
       break;
     }
     case PixelType::kLabel16I: {
       const auto& image_value =
           untyped_image.GetValue<Image<PixelType::kLabel16I>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, do_compress, jpeg_color,
+                           jpeg_quality);
       break;
     }
     case PixelType::kExpr:
@@ -179,22 +271,30 @@ const OutputPort<double>& ImageToLcmImageArrayT::image_array_t_msg_output_port()
   return System<double>::get_output_port(image_array_t_msg_output_port_index_);
 }
 
+void ImageToLcmImageArrayT::set_jpeg_color_compression(bool enabled,
+                                                       int quality) {
+  DRAKE_THROW_UNLESS(quality >= 1 && quality <= 100);
+  jpeg_color_compression_ = enabled;
+  jpeg_quality_ = quality;
+}
+
 void ImageToLcmImageArrayT::CalcImageArray(
     const systems::Context<double>& context, image_array_t* msg) const {
   msg->header.utime = static_cast<int64_t>(context.get_time() * kSecToMillisec);
   msg->header.frame_name.clear();
-  msg->num_images = 0;
-  msg->images.clear();
+  // Pack each image directly into the (cached, reused) output message rather
+  // than staging it in a local image_t and copying it in; the per-image data
+  // buffers then keep their capacity across frames.
+  msg->num_images = get_num_input_ports();
+  msg->images.resize(msg->num_images);
 
   for (int i = 0; i < get_num_input_ports(); i++) {
     const AbstractValue* image_value = this->EvalAbstractInput(context, i);
 
-    image_t image_msg;
     PackImageToLcmImageT(*image_value, input_port_pixel_type_[i],
                          msg->header.utime, this->get_input_port(i).get_name(),
-                         &image_msg, do_compress_);
-    msg->images.push_back(image_msg);
-    msg->num_images++;
+                         &msg->images[i], do_compress_, jpeg_color_compression_,
+                         jpeg_quality_);
   }
 }
 
@@ -66,6 +66,17 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
         name, systems::Value<Image<kPixelType>>());
   }
 
+  /// Configures 8-bit color images (rgb/bgr/rgba/bgra/grey) to be compressed
+  /// as JPEG rather than zlib, shrinking color bandwidth by another order of
+  /// magnitude at the cost of lossy encoding. Images with an alpha channel
+  /// are transmitted as their 3-channel equivalent (the receiving side of
+  /// LcmImageArrayToImages restores an opaque alpha). Depth and label images
+  /// always use lossless zlib. Only meaningful when the constructor's
+  /// `do_compress` was true.
+  /// @param quality The JPEG quality in [1, 100]; larger is higher fidelity.
+  /// @throws std::runtime_error if `quality` is out of range.
+  void set_jpeg_color_compression(bool enabled, int quality = 75);
+
  private:
   void CalcImageArray(const systems::Context<double>& context,
                       robotlocomotion::image_array_t* msg) const;
@@ -77,6 +88,8 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
 
   std::vector<PixelType> input_port_pixel_type_{};
   const bool do_compress_;
+  bool jpeg_color_compression_{false};
+  int jpeg_quality_{75};
 };
 
 }  // namespace sensors
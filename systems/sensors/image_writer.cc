@@ -15,13 +15,16 @@
 #include <vtkTIFFWriter.h>
 #include "fmt/ostream.h"
 
+#include "drake/common/drake_throw.h"
+
 namespace drake {
 namespace systems {
 namespace sensors {
 
 template <PixelType kPixelType>
 void SaveToFileHelper(const Image<kPixelType>& image,
-                      const std::string& file_path) {
+                      const std::string& file_path,
+                      int png_compression_level = -1) {
   const int width = image.width();
   const int height = image.height();
   const int num_channels = Image<kPixelType>::kNumChannels;
@@ -30,11 +33,19 @@ void SaveToFileHelper(const Image<kPixelType>& image,
   vtkNew<vtkImageData> vtk_image;
   vtk_image->SetDimensions(width, height, 1);
 
+  auto make_png_writer = [png_compression_level]() {
+    auto png_writer = vtkSmartPointer<vtkPNGWriter>::New();
+    if (png_compression_level >= 0) {
+      png_writer->SetCompressionLevel(png_compression_level);
+    }
+    return png_writer;
+  };
+
   // NOTE: This excludes *many* of the defined `PixelType` values.
   switch (kPixelType) {
     case PixelType::kRgba8U:
       vtk_image->AllocateScalars(VTK_UNSIGNED_CHAR, num_channels);
-      writer = vtkSmartPointer<vtkPNGWriter>::New();
+      writer = make_png_writer();
       break;
     case PixelType::kDepth32F:
       vtk_image->AllocateScalars(VTK_FLOAT, num_channels);
@@ -42,7 +53,7 @@ void SaveToFileHelper(const Image<kPixelType>& image,
       break;
     case PixelType::kLabel16I:
       vtk_image->AllocateScalars(VTK_UNSIGNED_SHORT, num_channels);
-      writer = vtkSmartPointer<vtkPNGWriter>::New();
+      writer = make_png_writer();
       break;
     default:
       throw std::logic_error(
@@ -91,6 +102,93 @@ ImageWriter::ImageWriter() {
   extensions_[PixelType::kDepth32F] = ".tiff";
 }
 
+ImageWriter::~ImageWriter() {
+  if (worker_.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(queue_mutex_);
+      worker_stop_requested_ = true;
+    }
+    queue_cv_.notify_one();
+    // The worker drains the queue before exiting, so no images are lost.
+    worker_.join();
+  }
+}
+
+void ImageWriter::EnableAsynchronousWriting(int max_queue_size,
+                                            bool block_when_full) {
+  DRAKE_THROW_UNLESS(max_queue_size > 0);
+  if (async_enabled_) {
+    throw std::logic_error(
+        "ImageWriter::EnableAsynchronousWriting(): asynchronous writing is "
+        "already enabled.");
+  }
+  max_queue_size_ = max_queue_size;
+  block_when_full_ = block_when_full;
+  async_enabled_ = true;
+  worker_ = std::thread(&ImageWriter::WorkerLoop, this);
+}
+
+void ImageWriter::Flush() {
+  if (!async_enabled_) return;
+  std::unique_lock<std::mutex> lock(queue_mutex_);
+  queue_space_cv_.wait(lock, [this]() {
+    return queue_.empty() && num_jobs_in_flight_ == 0;
+  });
+}
+
+int64_t ImageWriter::num_dropped_frames() const {
+  std::lock_guard<std::mutex> lock(queue_mutex_);
+  return dropped_frame_count_;
+}
+
+void ImageWriter::set_png_compression_level(int level) {
+  DRAKE_THROW_UNLESS(level >= -1 && level <= 9);
+  png_compression_level_ = level;
+}
+
+void ImageWriter::WorkerLoop() {
+  std::unique_lock<std::mutex> lock(queue_mutex_);
+  while (true) {
+    queue_cv_.wait(lock, [this]() {
+      return worker_stop_requested_ || !queue_.empty();
+    });
+    if (queue_.empty()) {
+      // Only stop once the queue has drained.
+      if (worker_stop_requested_) return;
+      continue;
+    }
+    std::function<void()> job = std::move(queue_.front());
+    queue_.pop_front();
+    ++num_jobs_in_flight_;
+    // A blocked producer can refill the freed slot while we encode.
+    queue_space_cv_.notify_all();
+    lock.unlock();
+    job();
+    lock.lock();
+    --num_jobs_in_flight_;
+    queue_space_cv_.notify_all();
+  }
+}
+
+void ImageWriter::DispatchWriteJob(std::function<void()> job) const {
+  if (!async_enabled_) {
+    job();
+    return;
+  }
+  std::unique_lock<std::mutex> lock(queue_mutex_);
+  if (static_cast<int>(queue_.size()) >= max_queue_size_) {
+    if (!block_when_full_) {
+      ++dropped_frame_count_;
+      return;
+    }
+    queue_space_cv_.wait(lock, [this]() {
+      return static_cast<int>(queue_.size()) < max_queue_size_;
+    });
+  }
+  queue_.push_back(std::move(job));
+  queue_cv_.notify_one();
+}
+
 template <PixelType kPixelType>
 const InputPort<double>& ImageWriter::DeclareImageInputPort(
     std::string port_name, std::string file_name_format, double publish_period,
@@ -165,9 +263,18 @@ void ImageWriter::WriteImage(const Context<double>& context, int index) const {
       this->EvalInputValue<Image<kPixelType>>(context, index);
   if (image) {
     const std::string& port_name = get_input_port(index).get_name();
-    SaveToFileHelper(
-        *image, MakeFileName(data.format, data.pixel_type, context.get_time(),
-                             port_name, data.count++));
+    std::string file_name =
+        MakeFileName(data.format, data.pixel_type, context.get_time(),
+                     port_name, data.count++);
+    if (!async_enabled_) {
+      SaveToFileHelper(*image, file_name, png_compression_level_);
+      return;
+    }
+    // Snapshot the image by value; the worker owns the copy outright.
+    DispatchWriteJob([image_copy = *image, file_name = std::move(file_name),
+                      level = png_compression_level_]() {
+      SaveToFileHelper(image_copy, file_name, level);
+    });
     return;
   }
   throw std::logic_error(
@@ -6,7 +6,13 @@
  invoked in any context and a System that can be connected into a diagram to
  automatically capture images during simulation at a fixed frequency.  */
 
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -85,6 +91,45 @@ class ImageWriter : public LeafSystem<double> {
   /** Constructs default instance with no image ports.  */
   ImageWriter();
 
+  /** If asynchronous writing is enabled, blocks until the remaining queued
+   images have been written, then stops the worker thread.  */
+  ~ImageWriter() override;
+
+  /** Moves image encoding and file I/O onto a background worker thread.
+   Each publish event then only copies the image and the file name into a
+   bounded queue and returns, so the simulation no longer stalls on
+   compression and disk latency.
+
+   When the queue is full, the behavior depends on `block_when_full`: if
+   false (the default), the new image is dropped (see num_dropped_frames());
+   if true, the publish event blocks until the worker catches up.
+
+   Images still queued at destruction are written before the worker exits;
+   call Flush() to wait for the queue to drain at any earlier point.
+
+   @param max_queue_size   Maximum number of images awaiting writing.
+   @param block_when_full  Whether a publish event waits for queue space
+                           rather than dropping the new image.
+   @throws std::logic_error if asynchronous writing is already enabled.
+   @pre `max_queue_size` is positive.  */
+  void EnableAsynchronousWriting(int max_queue_size = 8,
+                                 bool block_when_full = false);
+
+  /** Blocks until every queued image has been written to disk. A no-op when
+   asynchronous writing is not enabled.  */
+  void Flush();
+
+  /** Returns the number of images discarded because the queue was full at
+   publish time. Always zero in synchronous mode or with a blocking queue.  */
+  int64_t num_dropped_frames() const;
+
+  /** Sets the zlib compression level used for png output, in the range
+   [0, 9]; smaller values compress less but encode much faster (level 1 is
+   the usual choice when recording every frame). A value of -1 (the default)
+   defers to the library default. Does not affect tiff (depth) output.
+   @pre `level` is in [-1, 9].  */
+  void set_png_compression_level(int level);
+
   /** Declares and configures a new image input port. A port is configured by
    providing:
 
@@ -243,12 +288,37 @@ class ImageWriter : public LeafSystem<double> {
     // be properly instantiated.
   };
 
+  // Body of the background worker thread: drains the queue, exiting only
+  // once a stop has been requested *and* the queue is empty.
+  void WorkerLoop();
+
+  // Runs `job` now (synchronous mode) or hands it to the worker thread,
+  // applying the configured full-queue policy.
+  void DispatchWriteJob(std::function<void()> job) const;
+
   // For each input port, this stores the corresponding image data. It is an
   // invariant that port_info_.size() == get_num_input_ports().
   std::vector<ImagePortInfo> port_info_;
 
   std::unordered_map<PixelType, std::string> labels_;
   std::unordered_map<PixelType, std::string> extensions_;
+
+  // Asynchronous-writing machinery; see EnableAsynchronousWriting(). The
+  // mutable members are guarded by queue_mutex_ (WriteImage() is const).
+  bool async_enabled_{false};
+  int max_queue_size_{0};
+  bool block_when_full_{false};
+  int png_compression_level_{-1};
+  mutable std::mutex queue_mutex_;
+  // Signals the worker that a job has arrived (or a stop was requested).
+  mutable std::condition_variable queue_cv_;
+  // Signals producers and Flush() that the worker has made progress.
+  mutable std::condition_variable queue_space_cv_;
+  mutable std::deque<std::function<void()>> queue_;
+  mutable int num_jobs_in_flight_{0};
+  mutable int64_t dropped_frame_count_{0};
+  bool worker_stop_requested_{false};
+  std::thread worker_;
 };
 
 }  // namespace sensors
@@ -171,6 +171,55 @@ GTEST_TEST(TestImage, ResizeTest) {
   EXPECT_EQ(dut.size(), kWidthResized * kHeightResized * kNumChannels);
 }
 
+GTEST_TEST(TestImage, ArrayMapTest) {
+  ImageDepth32F dut(4, 2, 2.0f);
+  // Whole-frame arithmetic through the map mutates the underlying pixels.
+  dut.mutable_array() *= 0.5f;
+  EXPECT_EQ(*dut.at(0, 0), 1.0f);
+  EXPECT_EQ(*dut.at(3, 1), 1.0f);
+  EXPECT_EQ(dut.array().sum(), 8.0f);
+}
+
+GTEST_TEST(TestImageView, ViewOverImage) {
+  ImageRgba8U image(kWidth, kHeight, kInitialValue);
+  image.at(3, 7)[2] = 42;
+
+  const ImageRgba8UView dut(image);
+  EXPECT_EQ(dut.width(), kWidth);
+  EXPECT_EQ(dut.height(), kHeight);
+  EXPECT_EQ(dut.size(), image.size());
+  EXPECT_EQ(dut.kNumChannels, 4);
+  EXPECT_EQ(dut.kPixelFormat, PixelFormat::kRgba);
+  // The view aliases the image's storage; no copy was made.
+  EXPECT_EQ(dut.at(0, 0), image.at(0, 0));
+  EXPECT_EQ(dut.at(3, 7)[2], 42);
+
+  // Mutations through the image are visible through the view.
+  image.at(3, 7)[2] = 43;
+  EXPECT_EQ(dut.at(3, 7)[2], 43);
+}
+
+GTEST_TEST(TestImageView, ViewOverExternalBuffer) {
+  const uint16_t buffer[6] = {1, 2, 3, 4, 5, 6};
+  const ImageDepth16UView dut(buffer, 3, 2);
+  EXPECT_EQ(dut.width(), 3);
+  EXPECT_EQ(dut.height(), 2);
+  EXPECT_EQ(*dut.at(2, 1), 6);
+  EXPECT_EQ(dut.array().sum(), 21);
+
+  // ToImage() produces an owning copy, decoupled from the buffer.
+  const ImageDepth16U image = dut.ToImage();
+  EXPECT_NE(image.at(0, 0), dut.at(0, 0));
+  EXPECT_EQ(*image.at(2, 1), 6);
+}
+
+GTEST_TEST(TestImageView, EmptyView) {
+  const ImageLabel16IView dut;
+  EXPECT_EQ(dut.width(), 0);
+  EXPECT_EQ(dut.height(), 0);
+  EXPECT_EQ(dut.size(), 0);
+}
+
 }  // namespace
 }  // namespace sensors
 }  // namespace systems
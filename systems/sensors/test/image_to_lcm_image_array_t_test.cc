@@ -126,6 +126,38 @@ GTEST_TEST(ImageToLcmImageArrayT, ValidTest) {
          image_t::COMPRESSION_METHOD_NOT_COMPRESSED);
 }
 
+GTEST_TEST(ImageToLcmImageArrayT, JpegColorCompressionTest) {
+  ImageRgba8U color_image(kImageWidth, kImageHeight);
+  ImageDepth32F depth_image(kImageWidth, kImageHeight);
+  ImageLabel16I label_image(kImageWidth, kImageHeight);
+
+  ImageToLcmImageArrayT dut(
+      kColorFrameName, kDepthFrameName, kLabelFrameName, true);
+  dut.set_jpeg_color_compression(true);
+  auto image_array = SetUpInputAndOutput(
+      &dut, color_image, depth_image, label_image);
+
+  EXPECT_EQ(image_array.num_images, 3);
+  for (auto const& image : image_array.images) {
+    if (image.header.frame_name == kColorFrameName) {
+      // JPEG cannot carry alpha; the color image goes out as 3-channel RGB.
+      EXPECT_EQ(image.compression_method, image_t::COMPRESSION_METHOD_JPEG);
+      EXPECT_EQ(image.pixel_format, image_t::PIXEL_FORMAT_RGB);
+      EXPECT_EQ(image.row_stride, 3 * kImageWidth);
+    } else {
+      // Depth and label images stay lossless.
+      EXPECT_EQ(image.compression_method, image_t::COMPRESSION_METHOD_ZLIB);
+    }
+    EXPECT_EQ(image.data.size(), image.size);
+  }
+
+  // The quality setting is validated.
+  EXPECT_NO_THROW(dut.set_jpeg_color_compression(true, 1));
+  EXPECT_NO_THROW(dut.set_jpeg_color_compression(true, 100));
+  EXPECT_THROW(dut.set_jpeg_color_compression(true, 0), std::runtime_error);
+  EXPECT_THROW(dut.set_jpeg_color_compression(true, 101), std::runtime_error);
+}
+
 }  // namespace
 }  // namespace sensors
 }  // namespace systems
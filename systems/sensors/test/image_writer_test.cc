@@ -659,6 +659,53 @@ TEST_F(ImageWriterTest, WritesDepthImage) {
   TestWritingImageOnPort<PixelType::kDepth32F>();
 }
 
+// Confirms that with asynchronous writing enabled, a publish returns with the
+// file possibly not yet written, and Flush() waits for it to land on disk.
+TEST_F(ImageWriterTest, AsynchronousWriting) {
+  ImageWriter writer;
+  ImageWriterTester tester(writer);
+
+  spruce::path path(temp_dir());
+  path.append("async_{count:03}");
+  const auto& port = writer.DeclareImageInputPort<PixelType::kRgba8U>(
+      "color", path.getStr(), 1 / 10.0, 0.0);
+
+  writer.set_png_compression_level(1);
+  writer.EnableAsynchronousWriting(2 /* max_queue_size */,
+                                   true /* block_when_full */);
+  // Enabling twice is an error.
+  DRAKE_EXPECT_THROWS_MESSAGE(writer.EnableAsynchronousWriting(),
+                              std::logic_error, ".*already enabled.*");
+
+  auto context = writer.AllocateContext();
+  context->FixInputPort(
+      port.get_index(),
+      AbstractValue::Make<ImageRgba8U>(test_image<PixelType::kRgba8U>()));
+
+  auto events = writer.AllocateCompositeEventCollection();
+  writer.CalcNextUpdateTime(*context, events.get());
+  writer.Publish(*context, events->get_publish_events());
+  writer.Flush();
+
+  const std::string expected_name = tester.MakeFileName(
+      tester.port_format(port.get_index()), PixelType::kRgba8U,
+      context->get_time(), "color", 0);
+  spruce::path expected_file(expected_name);
+  EXPECT_TRUE(expected_file.exists());
+  EXPECT_EQ(1, tester.port_count(port.get_index()));
+  EXPECT_EQ(0, writer.num_dropped_frames());
+  add_file_for_cleanup(expected_file.getStr());
+}
+
+// Confirms validation of the png compression level setting.
+TEST_F(ImageWriterTest, PngCompressionLevelValidation) {
+  ImageWriter writer;
+  EXPECT_NO_THROW(writer.set_png_compression_level(-1));
+  EXPECT_NO_THROW(writer.set_png_compression_level(9));
+  EXPECT_THROW(writer.set_png_compression_level(10), std::runtime_error);
+  EXPECT_THROW(writer.set_png_compression_level(-2), std::runtime_error);
+}
+
 // Evaluate the stand-alone test for color images.
 TEST_F(ImageWriterTest, SaveToPng_Color) {
   ImageRgba8U color_image = test_image<PixelType::kRgba8U>();
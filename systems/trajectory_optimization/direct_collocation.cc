@@ -1,7 +1,9 @@
 #include "drake/systems/trajectory_optimization/direct_collocation.h"
 
 #include <cstddef>
+#include <exception>
 #include <stdexcept>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -18,50 +20,74 @@ using solvers::Constraint;
 using solvers::MathematicalProgram;
 using solvers::VectorXDecisionVariable;
 
+namespace {
+
+int GetInputPortSize(const System<AutoDiffXd>& system) {
+  return system.get_num_input_ports() > 0 ? system.get_input_port(0).size()
+                                          : 0;
+}
+
+}  // namespace
+
 DirectCollocationConstraint::DirectCollocationConstraint(
-    const System<double>& system, const Context<double>& context)
+    const System<double>& system, const Context<double>& context,
+    bool parallel_dynamics)
+    : DirectCollocationConstraint(System<double>::ToAutoDiffXd(system),
+                                  context, parallel_dynamics) {}
+
+DirectCollocationConstraint::DirectCollocationConstraint(
+    std::shared_ptr<const System<AutoDiffXd>> system,
+    const Context<double>& context, bool parallel_dynamics)
     : DirectCollocationConstraint(
           system, context, context.get_continuous_state().size(),
-          (context.get_num_input_ports() > 0 ? system.get_input_port(0).size()
-                                             : 0)) {}
+          (context.get_num_input_ports() > 0 ? GetInputPortSize(*system) : 0),
+          parallel_dynamics) {}
 
 DirectCollocationConstraint::DirectCollocationConstraint(
-    const System<double>& system, const Context<double>& context,
-    int num_states, int num_inputs)
+    std::shared_ptr<const System<AutoDiffXd>> system,
+    const Context<double>& context, int num_states, int num_inputs,
+    bool parallel_dynamics)
     : Constraint(num_states, 1 + (2 * num_states) + (2 * num_inputs),
                  Eigen::VectorXd::Zero(num_states),
                  Eigen::VectorXd::Zero(num_states)),
-      system_(System<double>::ToAutoDiffXd(system)),
-      context_(system_->CreateDefaultContext()),
-      // Don't allocate the input port until we're past the point
-      // where we might throw.
-      derivatives_(system_->AllocateTimeDerivatives()),
+      system_(std::move(system)),
       num_states_(num_states),
-      num_inputs_(num_inputs) {
+      num_inputs_(num_inputs),
+      parallel_dynamics_(parallel_dynamics) {
   DRAKE_THROW_UNLESS(system_->get_num_input_ports() <= 1);
   DRAKE_THROW_UNLESS(context.has_only_continuous_state());
 
   // TODO(russt): Add support for time-varying dynamics OR check for
   // time-invariance.
 
-  context_->SetTimeStateAndParametersFrom(context);
-
-  if (context.get_num_input_ports() > 0) {
-    // Allocate the input port and keep an alias around.
-    input_port_value_ = &context_->FixInputPort(
-        0, system_->AllocateInputVector(system_->get_input_port(0)));
+  // One workspace for serial evaluation; a second so that the dynamics at
+  // the two endpoint knots can be evaluated concurrently.
+  workspaces_.resize(parallel_dynamics_ ? 2 : 1);
+  for (Workspace& workspace : workspaces_) {
+    workspace.context = system_->CreateDefaultContext();
+    workspace.derivatives = system_->AllocateTimeDerivatives();
+    workspace.context->SetTimeStateAndParametersFrom(context);
+    if (context.get_num_input_ports() > 0) {
+      // Allocate the input port and keep an alias around.
+      workspace.input_port_value = &workspace.context->FixInputPort(
+          0, system_->AllocateInputVector(system_->get_input_port(0)));
+    }
   }
 }
 
 void DirectCollocationConstraint::dynamics(const AutoDiffVecXd& state,
                                            const AutoDiffVecXd& input,
+                                           int workspace_index,
                                            AutoDiffVecXd* xdot) const {
-  if (context_->get_num_input_ports() > 0) {
-    input_port_value_->GetMutableVectorData<AutoDiffXd>()->SetFromVector(input);
+  const Workspace& workspace = workspaces_[workspace_index];
+  if (workspace.context->get_num_input_ports() > 0) {
+    workspace.input_port_value->GetMutableVectorData<AutoDiffXd>()
+        ->SetFromVector(input);
   }
-  context_->get_mutable_continuous_state().SetFromVector(state);
-  system_->CalcTimeDerivatives(*context_, derivatives_.get());
-  *xdot = derivatives_->CopyToVector();
+  workspace.context->get_mutable_continuous_state().SetFromVector(state);
+  system_->CalcTimeDerivatives(*workspace.context,
+                               workspace.derivatives.get());
+  *xdot = workspace.derivatives->CopyToVector();
 }
 
 void DirectCollocationConstraint::DoEval(
@@ -93,11 +119,27 @@ void DirectCollocationConstraint::DoEval(
   // the dynamics.  Currently the dynamics evaluated here as {u1,x1} are
   // recomputed in the next constraint as {u0,x0}.
   AutoDiffVecXd xdot0;
-  dynamics(x0, u0, &xdot0);
-  const Eigen::MatrixXd dxdot0 = math::autoDiffToGradientMatrix(xdot0);
-
   AutoDiffVecXd xdot1;
-  dynamics(x1, u1, &xdot1);
+  if (parallel_dynamics_) {
+    // The two endpoint evaluations are independent; run the second on a
+    // worker thread (with its own context) while this thread computes the
+    // first.
+    std::exception_ptr error;
+    std::thread worker([&]() {
+      try {
+        dynamics(x1, u1, 1, &xdot1);
+      } catch (...) {
+        error = std::current_exception();
+      }
+    });
+    dynamics(x0, u0, 0, &xdot0);
+    worker.join();
+    if (error) std::rethrow_exception(error);
+  } else {
+    dynamics(x0, u0, 0, &xdot0);
+    dynamics(x1, u1, 0, &xdot1);
+  }
+  const Eigen::MatrixXd dxdot0 = math::autoDiffToGradientMatrix(xdot0);
   const Eigen::MatrixXd dxdot1 = math::autoDiffToGradientMatrix(xdot1);
 
   // Cubic interpolation to get xcol and xdotcol.
@@ -105,7 +147,7 @@ void DirectCollocationConstraint::DoEval(
   const AutoDiffVecXd xdotcol = -1.5 * (x0 - x1) / h - .25 * (xdot0 + xdot1);
 
   AutoDiffVecXd g;
-  dynamics(xcol, 0.5 * (u0 + u1), &g);
+  dynamics(xcol, 0.5 * (u0 + u1), 0, &g);
   *y = xdotcol - g;
 }
 
@@ -137,7 +179,8 @@ DirectCollocation::DirectCollocation(const System<double>* system,
                                      const Context<double>& context,
                                      int num_time_samples,
                                      double minimum_timestep,
-                                     double maximum_timestep)
+                                     double maximum_timestep,
+                                     bool parallel_dynamics)
     : MultipleShooting(system->get_num_total_inputs(),
                        context.get_continuous_state().size(), num_time_samples,
                        minimum_timestep, maximum_timestep),
@@ -154,16 +197,21 @@ DirectCollocation::DirectCollocation(const System<double>* system,
         0, system_->AllocateInputVector(system_->get_input_port(0)));
   }
 
-  // Add the dynamic constraints.
-  auto constraint = std::make_shared<DirectCollocationConstraint>(
-      *system, context);
-
-  DRAKE_ASSERT(static_cast<int>(constraint->num_constraints()) == num_states());
+  // Add the dynamic constraints.  Convert the system to AutoDiffXd once; the
+  // converted system is shared (read-only) by all of the constraints, but
+  // each constraint gets its own evaluation context(s) so that constraints
+  // at different knots may be evaluated concurrently.
+  std::shared_ptr<const System<AutoDiffXd>> autodiff_system =
+      System<double>::ToAutoDiffXd(*system);
 
   // For N-1 timesteps, add a constraint which depends on the knot
   // value along with the state and input vectors at that knot and the
   // next.
   for (int i = 0; i < N() - 1; i++) {
+    auto constraint = std::make_shared<DirectCollocationConstraint>(
+        autodiff_system, context, parallel_dynamics);
+    DRAKE_ASSERT(static_cast<int>(constraint->num_constraints()) ==
+                 num_states());
     AddConstraint(constraint,
                   {h_vars().segment<1>(i),
                    x_vars().segment(i * num_states(), num_states() * 2),
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/solvers/constraint.h"
@@ -38,9 +39,14 @@ class DirectCollocation : public MultipleShooting {
   /// @param num_time_samples The number of knot points in the trajectory.
   /// @param minimum_timestep Minimum spacing between sample times.
   /// @param maximum_timestep Maximum spacing between sample times.
+  /// @param parallel_dynamics If true, each collocation constraint evaluates
+  ///    the dynamics at its two endpoint knots on concurrent threads (see
+  ///    DirectCollocationConstraint).  Worthwhile when a single dynamics
+  ///    evaluation is expensive (e.g. a high-DOF multibody plant).
   DirectCollocation(const System<double>* system,
                     const Context<double>& context, int num_time_samples,
-                    double minimum_timestep, double maximum_timestep);
+                    double minimum_timestep, double maximum_timestep,
+                    bool parallel_dynamics = false);
 
   // NOTE: The fixed timestep constructor, which would avoid adding h as
   // decision variables, has been removed since it complicates the API and code.
@@ -72,16 +78,30 @@ class DirectCollocation : public MultipleShooting {
 /// Implements the direct collocation constraints for a first-order hold on
 /// the input and a cubic polynomial representation of the state trajectories.
 ///
-/// Note that the DirectCollocation implementation allocates only ONE of
-/// these constraints, but binds that constraint multiple times (with
-/// different decision variables, along the trajectory).
+/// The DirectCollocation implementation allocates one of these constraints
+/// per knot interval; all of the instances share a single (read-only)
+/// AutoDiffXd system, but each maintains its own evaluation context(s), so
+/// constraints at different knots may be evaluated concurrently.
 class DirectCollocationConstraint : public solvers::Constraint {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DirectCollocationConstraint)
 
  public:
+  /// @param parallel_dynamics If true, the dynamics at the two endpoint knots
+  ///    are evaluated on concurrent threads (the two evaluations are
+  ///    independent, and each is typically the dominant cost of an Eval).
+  ///    @p system's CalcTimeDerivatives must be safe to call concurrently on
+  ///    separate contexts.
   DirectCollocationConstraint(const System<double>& system,
-                              const Context<double>& context);
+                              const Context<double>& context,
+                              bool parallel_dynamics = false);
+
+  /// Constructs the constraint from an already-converted AutoDiffXd system,
+  /// which may be shared (read-only) among many constraint instances; each
+  /// instance maintains its own evaluation context(s).
+  DirectCollocationConstraint(std::shared_ptr<const System<AutoDiffXd>> system,
+                              const Context<double>& context,
+                              bool parallel_dynamics = false);
 
   ~DirectCollocationConstraint() override = default;
 
@@ -99,20 +119,27 @@ class DirectCollocationConstraint : public solvers::Constraint {
               VectorX<symbolic::Expression>* y) const override;
 
  private:
-  DirectCollocationConstraint(const System<double>& system,
+  // A context, its fixed input port, and a derivatives buffer; one per
+  // evaluation thread.
+  struct Workspace {
+    std::unique_ptr<Context<AutoDiffXd>> context;
+    FixedInputPortValue* input_port_value{nullptr};
+    std::unique_ptr<ContinuousState<AutoDiffXd>> derivatives;
+  };
+
+  DirectCollocationConstraint(std::shared_ptr<const System<AutoDiffXd>> system,
                               const Context<double>& context, int num_states,
-                              int num_inputs);
+                              int num_inputs, bool parallel_dynamics);
 
   void dynamics(const AutoDiffVecXd& state, const AutoDiffVecXd& input,
-                AutoDiffVecXd* xdot) const;
+                int workspace_index, AutoDiffVecXd* xdot) const;
 
-  std::unique_ptr<System<AutoDiffXd>> system_;
-  std::unique_ptr<Context<AutoDiffXd>> context_;
-  FixedInputPortValue* input_port_value_{nullptr};
-  std::unique_ptr<ContinuousState<AutoDiffXd>> derivatives_;
+  std::shared_ptr<const System<AutoDiffXd>> system_;
+  std::vector<Workspace> workspaces_;
 
   const int num_states_{0};
   const int num_inputs_{0};
+  const bool parallel_dynamics_{false};
 };
 
 // Note: The order of arguments is a compromise between GSG and the desire to
@@ -111,6 +111,20 @@ double get_period(const System<double>* system) {
   return periodic_data->period_sec();
 }
 
+// Returns the constraint x[n+1] = A x[n] + B u[n] as a static
+// LinearEqualityConstraint on the stacked variables {u[n], x[n], x[n+1]},
+// avoiding any symbolic expression parsing.
+std::shared_ptr<solvers::LinearEqualityConstraint> MakeTransitionConstraint(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B) {
+  const int num_states = A.rows();
+  const int num_inputs = B.cols();
+  Eigen::MatrixXd Aeq(num_states, num_inputs + 2 * num_states);
+  Aeq << -B, -A, Eigen::MatrixXd::Identity(num_states, num_states);
+  return std::make_shared<solvers::LinearEqualityConstraint>(
+      Aeq, Eigen::VectorXd::Zero(num_states));
+}
+
 }  // end namespace
 
 DirectTranscription::DirectTranscription(const System<double>* system,
@@ -124,8 +138,10 @@ DirectTranscription::DirectTranscription(const System<double>* system,
   // systems, you must use a different constructor that specifies the timesteps.
   ValidateSystem(*system, context);
 
-  // First try symbolic dynamics.
-  if (!AddSymbolicDynamicConstraints(system, context)) {
+  // A (time-varying) linear system passed through the generic interface gets
+  // the static sparse constraints; otherwise try symbolic, then autodiff.
+  if (!AddLinearDynamicConstraints(system) &&
+      !AddSymbolicDynamicConstraints(system, context)) {
     AddAutodiffDynamicConstraints(system, context);
   }
   ConstrainEqualInputAtFinalTwoTimesteps();
@@ -145,11 +161,13 @@ DirectTranscription::DirectTranscription(
   // systems, you must use a different constructor that specifies the timesteps.
   ValidateSystem(*linear_system, context);
 
+  // The dynamics are time-invariant, so a single constraint is shared by all
+  // of the knot bindings.
+  const auto constraint =
+      MakeTransitionConstraint(linear_system->A(), linear_system->B());
   for (int i = 0; i < N() - 1; i++) {
-    AddLinearEqualityConstraint(
-        state(i+1).cast<symbolic::Expression>() ==
-        linear_system->A() * state(i).cast<symbolic::Expression>() +
-        linear_system->B() * input(i).cast<symbolic::Expression>());
+    AddConstraint(solvers::Binding<solvers::LinearEqualityConstraint>(
+        constraint, {input(i), state(i), state(i + 1)}));
   }
   ConstrainEqualInputAtFinalTwoTimesteps();
 }
@@ -169,10 +187,9 @@ DirectTranscription::DirectTranscription(
 
   for (int i = 0; i < N() - 1; i++) {
     const double t = system->time_period() * i;
-    AddLinearEqualityConstraint(
-        state(i+1).cast<symbolic::Expression>() ==
-        system->A(t) * state(i).cast<symbolic::Expression>() +
-        system->B(t) * input(i).cast<symbolic::Expression>());
+    AddConstraint(solvers::Binding<solvers::LinearEqualityConstraint>(
+        MakeTransitionConstraint(system->A(t), system->B(t)),
+        {input(i), state(i), state(i + 1)}));
   }
   ConstrainEqualInputAtFinalTwoTimesteps();
 }
@@ -216,6 +233,31 @@ PiecewisePolynomial<double> DirectTranscription::ReconstructStateTrajectory()
   return PiecewisePolynomial<double>::ZeroOrderHold(times_vec, states);
 }
 
+bool DirectTranscription::AddLinearDynamicConstraints(
+    const System<double>* system) {
+  if (const auto* linear_system =
+          dynamic_cast<const LinearSystem<double>*>(system)) {
+    const auto constraint =
+        MakeTransitionConstraint(linear_system->A(), linear_system->B());
+    for (int i = 0; i < N() - 1; i++) {
+      AddConstraint(solvers::Binding<solvers::LinearEqualityConstraint>(
+          constraint, {input(i), state(i), state(i + 1)}));
+    }
+    return true;
+  }
+  if (const auto* ltv_system =
+          dynamic_cast<const TimeVaryingLinearSystem<double>*>(system)) {
+    for (int i = 0; i < N() - 1; i++) {
+      const double t = ltv_system->time_period() * i;
+      AddConstraint(solvers::Binding<solvers::LinearEqualityConstraint>(
+          MakeTransitionConstraint(ltv_system->A(t), ltv_system->B(t)),
+          {input(i), state(i), state(i + 1)}));
+    }
+    return true;
+  }
+  return false;
+}
+
 bool DirectTranscription::AddSymbolicDynamicConstraints(
     const System<double>* system, const Context<double>& context) {
   const auto symbolic_system = system->ToSymbolicMaybe();
@@ -37,6 +37,11 @@ class DirectTranscription : public MultipleShooting {
   ///    context after calling this method will NOT impact the trajectory
   ///    optimization.
   /// @param num_time_samples The number of knot points in the trajectory.
+  ///
+  /// If @p system is a LinearSystem or TimeVaryingLinearSystem, the dynamics
+  /// are imposed as static sparse linear equality constraints (as with the
+  /// specialized constructors below) instead of generic autodiff constraints,
+  /// keeping the program a QP/LP when the costs permit.
   DirectTranscription(const System<double>* system,
                       const Context<double>& context, int num_time_samples);
 
@@ -97,6 +102,12 @@ class DirectTranscription : public MultipleShooting {
   // Implements a running cost at all timesteps.
   void DoAddRunningCost(const symbolic::Expression& e) override;
 
+  // If @p system is a LinearSystem or TimeVaryingLinearSystem, adds the
+  // dynamics as static sparse LinearEqualityConstraints (the same constraints
+  // the specialized constructors produce) and returns true; otherwise adds
+  // nothing and returns false.
+  bool AddLinearDynamicConstraints(const System<double>* system);
+
   // Attempts to create a symbolic version of the plant, and to add linear
   // constraints to impose the dynamics if possible.  Returns true iff the
   // constraints are added.
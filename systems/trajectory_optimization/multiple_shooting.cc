@@ -176,6 +176,47 @@ void MultipleShooting::SetInitialTrajectory(
   SetInitialGuess(x_vars_, guess_x);
 }
 
+void MultipleShooting::ShiftInitialGuessFromSolution(double time_shift) {
+  DRAKE_THROW_UNLESS(time_shift >= 0.0);
+  const VectorXd times = GetSampleTimes();
+  const MatrixXd inputs = GetInputSamples();
+  const MatrixXd states = GetStateSamples();
+
+  // The shift does not change the interval durations; keep the solution's
+  // timesteps as the guess.
+  if (timesteps_are_decision_variables_) {
+    SetInitialGuess(h_vars_, GetSolution(h_vars_));
+  }
+
+  // Sample the previous solution at the shifted knot times, interpolating
+  // linearly between its samples and holding the final sample beyond the end
+  // of the previous horizon.
+  VectorXd guess_u(u_vars_.size());
+  VectorXd guess_x(x_vars_.size());
+  int segment = 0;
+  for (int i = 0; i < N_; i++) {
+    const double t = times(i) + time_shift;
+    while (segment < N_ - 2 && times(segment + 1) < t) segment++;
+    double alpha = 1.0;
+    if (t < times(N_ - 1)) {
+      alpha =
+          (t - times(segment)) / (times(segment + 1) - times(segment));
+    } else {
+      segment = N_ - 2;
+    }
+    if (num_inputs_ > 0) {
+      guess_u.segment(num_inputs_ * i, num_inputs_) =
+          (1 - alpha) * inputs.col(segment) + alpha * inputs.col(segment + 1);
+    }
+    guess_x.segment(num_states_ * i, num_states_) =
+        (1 - alpha) * states.col(segment) + alpha * states.col(segment + 1);
+  }
+  if (num_inputs_ > 0) {
+    SetInitialGuess(u_vars_, guess_u);
+  }
+  SetInitialGuess(x_vars_, guess_x);
+}
+
 Eigen::VectorXd MultipleShooting::GetSampleTimes(
     const Eigen::Ref<const Eigen::VectorXd>& h_var_values) const {
   Eigen::VectorXd times(N_);
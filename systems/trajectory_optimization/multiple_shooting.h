@@ -246,6 +246,24 @@ class MultipleShooting : public solvers::MathematicalProgram {
       const trajectories::PiecewisePolynomial<double>& traj_init_u,
       const trajectories::PiecewisePolynomial<double>& traj_init_x);
 
+  /// Re-seeds the initial guess for all trajectory decision variables from
+  /// the most recent solution, shifted earlier in time by @p time_shift
+  /// seconds, for receding-horizon (MPC) use: after each solve, call this
+  /// with the replan interval and solve the same program instance again
+  /// rather than reconstructing it.  The costs, constraints, and solver
+  /// selection are untouched; only the initial guesses change.
+  ///
+  /// The input and state guesses are sampled from the previous solution by
+  /// linear interpolation between its knot points; samples falling beyond
+  /// the end of the previous horizon hold the final knot values.  If
+  /// timesteps are decision variables, their guesses are seeded with the
+  /// previous solution's timesteps (the shift does not change durations).
+  ///
+  /// @pre the program has been solved (the solution is the one queried by
+  /// GetSolution).
+  /// @throws std::runtime_error if @p time_shift is negative.
+  void ShiftInitialGuessFromSolution(double time_shift);
+
   /// Returns a vector containing the elapsed time at each knot point.
   Eigen::VectorXd GetSampleTimes(
       const Eigen::Ref<const Eigen::VectorXd>& h_var_values) const;
@@ -8,6 +8,7 @@
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
 #include "drake/solvers/ipopt_solver.h"
 #include "drake/systems/primitives/linear_system.h"
 
@@ -309,6 +310,37 @@ GTEST_TEST(DirectCollocationTest, AddDirectCollocationConstraint) {
   EXPECT_TRUE(val.isZero());
 }
 
+// The parallel-dynamics mode must produce exactly the same constraint values
+// and gradients as the serial mode; the two endpoint dynamics evaluations are
+// simply run on concurrent threads with separate contexts.
+GTEST_TEST(DirectCollocationTest, ParallelDynamicsMatchesSerial) {
+  const auto system = MakeSimpleLinearSystem();
+  auto context = system->CreateDefaultContext();
+
+  const DirectCollocationConstraint serial_constraint(*system, *context,
+                                                      false);
+  const DirectCollocationConstraint parallel_constraint(*system, *context,
+                                                        true);
+  ASSERT_EQ(serial_constraint.num_vars(), parallel_constraint.num_vars());
+
+  Eigen::VectorXd x(serial_constraint.num_vars());
+  x << 0.3,          // h
+      1., -2.,       // x0
+      0.5, 0.25,     // x1
+      -1., 2.,       // u0
+      0.1, -0.2;     // u1
+  const AutoDiffVecXd x_autodiff = math::initializeAutoDiff(x);
+
+  AutoDiffVecXd y_serial, y_parallel;
+  serial_constraint.Eval(x_autodiff, &y_serial);
+  parallel_constraint.Eval(x_autodiff, &y_parallel);
+
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToValueMatrix(y_serial),
+                              math::autoDiffToValueMatrix(y_parallel)));
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToGradientMatrix(y_serial),
+                              math::autoDiffToGradientMatrix(y_parallel)));
+}
+
 }  // anonymous namespace
 }  // namespace trajectory_optimization
 }  // namespace systems
@@ -214,6 +214,44 @@ GTEST_TEST(DirectTranscriptionTest, DiscreteTimeLinearSystemTest) {
   }
 }
 
+// A linear system passed through the generic System<double>* constructor
+// must be detected and still produce only linear equality constraints.
+GTEST_TEST(DirectTranscriptionTest, LinearSystemThroughGenericConstructor) {
+  Eigen::Matrix2d A, B;
+  // clang-format off
+  A << 1, 2,
+      3, 4;
+  B << 5, 6,
+      7, 8;
+  // clang-format on
+  const Eigen::MatrixXd C(0, 2), D(0, 2);
+  const double kTimeStep = .1;
+  LinearSystem<double> system(A, B, C, D, kTimeStep);
+
+  const auto context = system.CreateDefaultContext();
+  int kNumSampleTimes = 3;
+  DirectTranscription prog(static_cast<const System<double>*>(&system),
+                           *context, kNumSampleTimes);
+
+  prog.SetInitialGuessForAllVariables(
+      Eigen::VectorXd::LinSpaced(prog.num_vars(), 1, prog.num_vars()));
+
+  const std::vector<solvers::Binding<solvers::LinearEqualityConstraint>>&
+      dynamic_constraints = prog.linear_equality_constraints();
+  EXPECT_EQ(dynamic_constraints.size(), kNumSampleTimes);
+  EXPECT_EQ(prog.generic_constraints().size(), 0);
+
+  const double kNumericalTolerance = 1e-10;
+  for (int i = 0; i < (kNumSampleTimes - 1); i++) {
+    EXPECT_TRUE(CompareMatrices(
+        prog.EvalBindingAtInitialGuess(dynamic_constraints[i]),
+        prog.GetInitialGuess(prog.state(i + 1)) -
+            A * prog.GetInitialGuess(prog.state(i)) -
+            B * prog.GetInitialGuess(prog.input(i)),
+        kNumericalTolerance));
+  }
+}
+
 // This example tests the TimeVaryingLinearSystem specialization of the
 // constructor.
 GTEST_TEST(DirectTranscriptionTest, TimeVaryingLinearSystemTest) {
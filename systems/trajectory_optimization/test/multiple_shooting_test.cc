@@ -395,6 +395,48 @@ GTEST_TEST(MultipleShootingTest, ResultSamplesTest) {
   EXPECT_TRUE(CompareMatrices(prog.GetStateSamples(), state_trajectory, 0.0));
 }
 
+GTEST_TEST(MultipleShootingTest, ShiftInitialGuessFromSolutionTest) {
+  const int kNumInputs{1};
+  const int kNumStates{1};
+  const int kNumSampleTimes{3};
+  const double kFixedTimeStep{0.1};
+  MyDirectTrajOpt prog(kNumInputs, kNumStates, kNumSampleTimes, kFixedTimeStep);
+
+  const Eigen::RowVector3d input_trajectory(1, 2, 3);
+  const Eigen::RowVector3d state_trajectory(4, 6, 8);
+  for (int i = 0; i < kNumSampleTimes; i++) {
+    prog.SetInitialGuess(prog.input(i), input_trajectory.col(i));
+    prog.SetInitialGuess(prog.state(i), state_trajectory.col(i));
+  }
+  // Pretends that the solver has solved the optimization problem, and sets
+  // the solution to prog.initial_guess().
+  solvers::SolverResult solver_result(solvers::SolverId("dummy"));
+  solver_result.set_decision_variable_values(prog.initial_guess());
+  prog.SetSolverResult(solver_result);
+
+  EXPECT_THROW(prog.ShiftInitialGuessFromSolution(-kFixedTimeStep),
+               std::runtime_error);
+
+  // Shifting by half a timestep interpolates between the solution knots; the
+  // final knot holds the last solution sample.
+  prog.ShiftInitialGuessFromSolution(kFixedTimeStep / 2);
+  EXPECT_TRUE(CompareMatrices(prog.GetInitialGuess(prog.input(0)),
+                              Vector1d(1.5), 1e-12));
+  EXPECT_TRUE(CompareMatrices(prog.GetInitialGuess(prog.state(1)),
+                              Vector1d(7.0), 1e-12));
+  EXPECT_TRUE(CompareMatrices(prog.GetInitialGuess(prog.state(2)),
+                              Vector1d(8.0), 1e-12));
+
+  // Shifting by the entire horizon clamps every knot to the final sample.
+  solver_result.set_decision_variable_values(prog.initial_guess());
+  prog.SetSolverResult(solver_result);
+  prog.ShiftInitialGuessFromSolution(2 * kFixedTimeStep);
+  EXPECT_TRUE(CompareMatrices(prog.GetInitialGuess(prog.input(0)),
+                              Vector1d(3.0), 1e-12));
+  EXPECT_TRUE(CompareMatrices(prog.GetInitialGuess(prog.state(0)),
+                              Vector1d(8.0), 1e-12));
+}
+
 }  // anonymous namespace
 }  // namespace trajectory_optimization
 }  // namespace systems
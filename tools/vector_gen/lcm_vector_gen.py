@@ -23,12 +23,12 @@ INDICES_BEGIN = """
 /// Describes the row indices of a %(camel)s.
 struct %(indices)s {
   /// The total number of rows (coordinates).
-  static const int kNumCoordinates = %(nfields)d;
+  static constexpr int kNumCoordinates = %(nfields)d;
 
   // The index of each individual coordinate.
 """
-INDICES_FIELD = """static const int %(kname)s = %(kvalue)d;"""
-INDICES_FIELD_STORAGE = """const int %(indices)s::%(kname)s;"""
+INDICES_FIELD = """static constexpr int %(kname)s = %(kvalue)d;"""
+INDICES_FIELD_STORAGE = """constexpr int %(indices)s::%(kname)s;"""
 
 
 def to_kname(field):
@@ -285,6 +285,27 @@ def generate_accessors(hh, caller_context, fields):
     put(hh, ACCESSOR_END % caller_context, 2)
 
 
+FIXED_VALUE_ACCESSORS = """
+  /// @name Fixed-size access to the entire vector
+  /// The returned Eigen Maps carry the compile-time size kSize, so reads and
+  /// writes through them compile to fixed-size code.
+  //@{
+  Eigen::Map<const Eigen::Matrix<T, kSize, 1>> fixed_value() const {
+    ThrowIfEmpty();
+    return Eigen::Map<const Eigen::Matrix<T, kSize, 1>>(this->values().data());
+  }
+  Eigen::Map<Eigen::Matrix<T, kSize, 1>> mutable_fixed_value() {
+    ThrowIfEmpty();
+    return Eigen::Map<Eigen::Matrix<T, kSize, 1>>(this->values().data());
+  }
+  //@}
+"""
+
+
+def generate_fixed_value_accessors(hh, caller_context):
+    put(hh, FIXED_VALUE_ACCESSORS % caller_context, 2)
+
+
 GET_COORDINATE_NAMES = """
     /// See %(camel)sIndices::GetCoordinateNames().
     static const std::vector<std::string>& GetCoordinateNames() {
@@ -407,6 +428,12 @@ class %(camel)s final : public drake::systems::BasicVector<T> {
  public:
   /// An abbreviation for our row index constants.
   typedef %(indices)s K;
+
+  /// The size of this vector, fixed at compile time. Use it as the template
+  /// argument to the framework's fixed-size fast paths, e.g.
+  /// LeafSystem::DeclareVectorInputPort<N>() and
+  /// System::EvalEigenVectorInput<N>().
+  static constexpr int kSize = K::kNumCoordinates;
 """
 
 VECTOR_CLASS_END = """
@@ -667,6 +694,7 @@ def generate_code(
             generate_set_to_named_variables(hh, context, fields)
             generate_do_clone(hh, context, fields)
             generate_accessors(hh, context, fields)
+            generate_fixed_value_accessors(hh, context)
             put(hh, GET_COORDINATE_NAMES % context, 2)
             generate_is_valid(hh, context, fields)
             generate_get_element_bounds(hh, context, fields)
@@ -7,11 +7,11 @@ namespace drake {
 namespace tools {
 namespace test {
 
-const int SampleIndices::kNumCoordinates;
-const int SampleIndices::kX;
-const int SampleIndices::kTwoWord;
-const int SampleIndices::kAbsone;
-const int SampleIndices::kUnset;
+constexpr int SampleIndices::kNumCoordinates;
+constexpr int SampleIndices::kX;
+constexpr int SampleIndices::kTwoWord;
+constexpr int SampleIndices::kAbsone;
+constexpr int SampleIndices::kUnset;
 
 const std::vector<std::string>& SampleIndices::GetCoordinateNames() {
   static const drake::never_destroyed<std::vector<std::string>> coordinates(
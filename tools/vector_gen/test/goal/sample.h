@@ -32,13 +32,13 @@ namespace test {
 /// Describes the row indices of a Sample.
 struct SampleIndices {
   /// The total number of rows (coordinates).
-  static const int kNumCoordinates = 4;
+  static constexpr int kNumCoordinates = 4;
 
   // The index of each individual coordinate.
-  static const int kX = 0;
-  static const int kTwoWord = 1;
-  static const int kAbsone = 2;
-  static const int kUnset = 3;
+  static constexpr int kX = 0;
+  static constexpr int kTwoWord = 1;
+  static constexpr int kAbsone = 2;
+  static constexpr int kUnset = 3;
 
   /// Returns a vector containing the names of each coordinate within this
   /// class. The indices within the returned vector matches that of this class.
@@ -54,6 +54,12 @@ class Sample final : public drake::systems::BasicVector<T> {
   /// An abbreviation for our row index constants.
   typedef SampleIndices K;
 
+  /// The size of this vector, fixed at compile time. Use it as the template
+  /// argument to the framework's fixed-size fast paths, e.g.
+  /// LeafSystem::DeclareVectorInputPort<N>() and
+  /// System::EvalEigenVectorInput<N>().
+  static constexpr int kSize = K::kNumCoordinates;
+
   /// Default constructor.  Sets all rows to their default value:
   /// @arg @c x defaults to 42.0 m/s.
   /// @arg @c two_word defaults to 0.0 with unknown units.
@@ -180,6 +186,20 @@ class Sample final : public drake::systems::BasicVector<T> {
   }
   //@}
 
+  /// @name Fixed-size access to the entire vector
+  /// The returned Eigen Maps carry the compile-time size kSize, so reads and
+  /// writes through them compile to fixed-size code.
+  //@{
+  Eigen::Map<const Eigen::Matrix<T, kSize, 1>> fixed_value() const {
+    ThrowIfEmpty();
+    return Eigen::Map<const Eigen::Matrix<T, kSize, 1>>(this->values().data());
+  }
+  Eigen::Map<Eigen::Matrix<T, kSize, 1>> mutable_fixed_value() {
+    ThrowIfEmpty();
+    return Eigen::Map<Eigen::Matrix<T, kSize, 1>>(this->values().data());
+  }
+  //@}
+
   /// See SampleIndices::GetCoordinateNames().
   static const std::vector<std::string>& GetCoordinateNames() {
     return SampleIndices::GetCoordinateNames();
@@ -53,6 +53,17 @@ GTEST_TEST(SampleTest, SimpleCoverage) {
   EXPECT_EQ(dut.x(), 11.0);
   EXPECT_EQ(dut.two_word(), 22.0);
 
+  // Fixed-size access.
+  static_assert(Sample<double>::kSize == SampleIndices::kNumCoordinates,
+                "kSize should match the schema");
+  const auto fixed = dut.fixed_value();
+  static_assert(std::decay_t<decltype(fixed)>::RowsAtCompileTime == 4,
+                "fixed_value() should have a compile-time size");
+  EXPECT_EQ(fixed(SampleIndices::kX), 11.0);
+  dut.mutable_fixed_value()(SampleIndices::kTwoWord) = 66.0;
+  EXPECT_EQ(dut.two_word(), 66.0);
+  dut.set_two_word(22.0);
+
   // Chained construction from a prvalue.
   const auto& chained = Sample<double>{}.with_x(33.0).with_two_word(44.0);
   EXPECT_EQ(chained.x(), 33.0);